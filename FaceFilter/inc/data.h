@@ -24,8 +24,27 @@
 #include <camera.h>
 
 #define BUFLEN 512
-#define MAX_FILTER 30
+/* time the preview filters may take per frame before they are cut down */
+#define FILTER_BUDGET_NS (12 * 1000 * 1000)
+/* preview frames between two logs of the filter timing */
+#define FILTER_STATS_FRAMES 300
+/*
+ * Average time the face_tracker may take per frame, and the most frames
+ * between two full scans, when the camera can't detect faces itself
+ */
+#define FACE_BUDGET_NS (10 * 1000 * 1000)
+#define FACE_FULL_SCAN_FRAMES 30
+/*
+ * Most preview frames in a row the landmarks of a still face are taken from
+ * the frames before instead of the shape predictor
+ */
+#define LANDMARK_MAX_STALE_FRAMES 4
 #define MAX_STICKER 5
+/*
+ * Most captured photos waiting to be processed or written; the next ones are
+ * refused until one is written
+ */
+#define PHOTO_QUEUE_SIZE 3
 
 typedef struct{
 	camera_pixel_format_e format;
@@ -347,6 +347,55 @@ namespace dlib
     ) { a.swap(b); }   
 
 
+    namespace ser_helper
+    {
+        template <typename T, typename mem_manager>
+        typename enable_if<is_raw_block_element<T>,bool>::type serialize_raw_block (
+            const array2d<T,mem_manager>& item,
+            std::ostream& out
+        )
+        {
+            if (!raw_block_serialization_enabled(out))
+                return false;
+            serialize_raw_block_header<T>(out);
+            serialize(item.nr(), out);
+            serialize(item.nc(), out);
+            serialize_raw_block_data(item.size() != 0 ? &item[0][0] : 0, item.size(), out);
+            return true;
+        }
+
+        template <typename T, typename mem_manager>
+        typename disable_if<is_raw_block_element<T>,bool>::type serialize_raw_block (
+            const array2d<T,mem_manager>& ,
+            std::ostream& 
+        ) { return false; }
+
+        template <typename T, typename mem_manager>
+        typename enable_if<is_raw_block_element<T>,bool>::type deserialize_raw_block (
+            array2d<T,mem_manager>& item,
+            std::istream& in
+        )
+        {
+            if (!raw_block_follows(in))
+                return false;
+            const raw_block_header h = deserialize_raw_block_header(in);
+            long nr, nc;
+            deserialize(nr, in);
+            deserialize(nc, in);
+            if (nr < 0 || nc < 0)
+                throw serialization_error("Invalid raw block size found while deserializing an array2d");
+            item.set_size(nr,nc);
+            deserialize_raw_block_data(h, item.size() != 0 ? &item[0][0] : 0, item.size(), in);
+            return true;
+        }
+
+        template <typename T, typename mem_manager>
+        typename disable_if<is_raw_block_element<T>,bool>::type deserialize_raw_block (
+            array2d<T,mem_manager>& ,
+            std::istream& 
+        ) { return false; }
+    }
+
     template <
         typename T,
         typename mem_manager
@@ -358,6 +407,9 @@ namespace dlib
     {
         try
         {
+            if (ser_helper::serialize_raw_block(item, out))
+                return;
+
             // The reason the serialization is a little funny is because we are trying to
             // maintain backwards compatibility with an older serialization format used by
             // dlib while also encoding things in a way that lets the array2d and matrix
@@ -387,6 +439,9 @@ namespace dlib
     {
         try
         {
+            if (ser_helper::deserialize_raw_block(item, in))
+                return;
+
             long nr, nc;
             deserialize(nr,in);
             deserialize(nc,in);
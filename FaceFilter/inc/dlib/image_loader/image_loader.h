@@ -25,6 +25,77 @@ namespace dlib
     public: image_load_error(const std::string& str) : error(EIMAGE_LOAD,str){}
     };
 
+// ----------------------------------------------------------------------------------------
+
+    namespace impl
+    {
+        class image_decode_target
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    The rows the png and jpeg decoders write an image into, so they can
+                    decode straight into the pixels of the caller's image instead of a
+                    buffer of their own.
+            !*/
+        public:
+            virtual ~image_decode_target() {}
+
+            virtual void set_size (
+                unsigned long rows,
+                unsigned long cols,
+                unsigned long bytes_per_pixel
+            ) = 0;
+            /*!
+                ensures
+                    - makes room for an image of rows x cols pixels of bytes_per_pixel
+                      bytes each.  Called once, before row().
+            !*/
+
+            virtual unsigned char* row (
+                unsigned long r
+            ) = 0;
+            /*!
+                ensures
+                    - returns the first byte of row r
+            !*/
+        };
+
+        template <typename image_type>
+        class image_view_decode_target : public image_decode_target
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    An image_decode_target writing into an image whose pixels are laid out
+                    as the decoder's bytes, see decoded_bytes_per_pixel.  Setting the
+                    image to the size it already has doesn't reallocate it.
+            !*/
+        public:
+            explicit image_view_decode_target (
+                image_type& img_
+            ) : img(img_) {}
+
+            virtual void set_size (
+                unsigned long rows,
+                unsigned long cols,
+                unsigned long 
+            ) { img.set_size(rows, cols); }
+
+            virtual unsigned char* row (
+                unsigned long r
+            ) { return reinterpret_cast<unsigned char*>(&img[r][0]); }
+
+        private:
+            image_view<image_type> img;
+        };
+
+        // The bytes of a pixel of this type when it can be decoded into as is: a gray
+        // level, or the red, green, blue (and alpha) bytes of a pixel.  0 otherwise.
+        template <typename pixel_type> struct decoded_bytes_per_pixel { const static unsigned long value = 0; };
+        template <> struct decoded_bytes_per_pixel<unsigned char> { const static unsigned long value = 1; };
+        template <> struct decoded_bytes_per_pixel<rgb_pixel> { const static unsigned long value = 3; };
+        template <> struct decoded_bytes_per_pixel<rgb_alpha_pixel> { const static unsigned long value = 4; };
+    }
+
 // ----------------------------------------------------------------------------------------
 
     template <
@@ -13,9 +13,15 @@
 #include <stdio.h>
 #ifdef DLIB_JPEG_STATIC
 #   include "../external/libjpeg/jpeglib.h"
+#   include "../external/libjpeg/jerror.h"
+    // the libjpeg we bundle returns int where libjpeg returns boolean
+    typedef int jpeg_loader_boolean;
 #else
 #   include <jpeglib.h>
+#   include <jerror.h>
+    typedef boolean jpeg_loader_boolean;
 #endif
+#include <cstring>
 #include <sstream>
 #include <setjmp.h>
 
@@ -25,25 +31,33 @@ namespace dlib
 // ----------------------------------------------------------------------------------------
 
     jpeg_loader::
-    jpeg_loader( const char* filename ) : height_( 0 ), width_( 0 ), output_components_(0)
+    jpeg_loader( const char* filename, unsigned long scale_denom ) : height_( 0 ), width_( 0 ), output_components_(0)
     {
-        read_image( filename );
+        read_image( filename, scale_denom );
     }
 
 // ----------------------------------------------------------------------------------------
 
     jpeg_loader::
-    jpeg_loader( const std::string& filename ) : height_( 0 ), width_( 0 ), output_components_(0)
+    jpeg_loader( const std::string& filename, unsigned long scale_denom ) : height_( 0 ), width_( 0 ), output_components_(0)
     {
-        read_image( filename.c_str() );
+        read_image( filename.c_str(), scale_denom );
     }
 
 // ----------------------------------------------------------------------------------------
 
     jpeg_loader::
-    jpeg_loader( const dlib::file& f ) : height_( 0 ), width_( 0 ), output_components_(0)
+    jpeg_loader( const dlib::file& f, unsigned long scale_denom ) : height_( 0 ), width_( 0 ), output_components_(0)
     {
-        read_image( f.full_name().c_str() );
+        read_image( f.full_name().c_str(), scale_denom );
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    jpeg_loader::
+    jpeg_loader( const unsigned char* image_buffer, size_t buffer_size, unsigned long scale_denom ) : height_( 0 ), width_( 0 ), output_components_(0)
+    {
+        read_image( image_buffer, buffer_size, scale_denom );
     }
 
 // ----------------------------------------------------------------------------------------
@@ -86,80 +100,260 @@ namespace dlib
 
 // ----------------------------------------------------------------------------------------
 
-    void jpeg_loader::read_image( const char* filename )
+    namespace
     {
-        if ( filename == NULL )
+        // A source manager reading the JPEG from memory, since the libjpeg 6b we
+        // bundle has no jpeg_mem_src().
+        void jpeg_loader_init_source (j_decompress_ptr)
         {
-            throw image_load_error("jpeg_loader: invalid filename, it is NULL");
         }
-        FILE *fp = fopen( filename, "rb" );
-        if ( !fp )
+
+        jpeg_loader_boolean jpeg_loader_fill_input_buffer (j_decompress_ptr cinfo)
         {
-            throw image_load_error(std::string("jpeg_loader: unable to open file ") + filename);
+            // The whole buffer was given at once, so the image is cut short.  Insert
+            // a fake EOI marker like jdatasrc.c does, so libjpeg warns instead of
+            // reading past the end.
+            static const JOCTET eoi[2] = { (JOCTET) 0xFF, (JOCTET) JPEG_EOI };
+            WARNMS(cinfo, JWRN_JPEG_EOF);
+            cinfo->src->next_input_byte = eoi;
+            cinfo->src->bytes_in_buffer = 2;
+            return TRUE;
         }
 
-        jpeg_decompress_struct cinfo;
-        jpeg_loader_error_mgr jerr;
-
-        cinfo.err = jpeg_std_error(&jerr.pub);
-
-        jerr.pub.error_exit = jpeg_loader_error_exit;
-
-        /* Establish the setjmp return context for my_error_exit to use. */
-        if (setjmp(jerr.setjmp_buffer)) 
+        void jpeg_loader_skip_input_data (j_decompress_ptr cinfo, long num_bytes)
         {
-            /* If we get here, the JPEG code has signaled an error.
-             * We need to clean up the JPEG object, close the input file, and return.
-             */
-            jpeg_destroy_decompress(&cinfo);
-            fclose(fp);
-            throw image_load_error(std::string("jpeg_loader: error while reading ") + filename);
+            if (num_bytes <= 0)
+                return;
+            if ((size_t) num_bytes > cinfo->src->bytes_in_buffer)
+            {
+                jpeg_loader_fill_input_buffer(cinfo);
+                return;
+            }
+            cinfo->src->next_input_byte += num_bytes;
+            cinfo->src->bytes_in_buffer -= num_bytes;
         }
 
-
-        jpeg_create_decompress(&cinfo);
-
-        jpeg_stdio_src(&cinfo, fp);
-
-        jpeg_read_header(&cinfo, TRUE);
-
-        jpeg_start_decompress(&cinfo);
-
-        height_ = cinfo.output_height;
-        width_ = cinfo.output_width;
-        output_components_ = cinfo.output_components;
-
-        if (output_components_ != 1 && 
-            output_components_ != 3 &&
-            output_components_ != 4)
+        void jpeg_loader_term_source (j_decompress_ptr)
         {
-            fclose( fp );
-            jpeg_destroy_decompress(&cinfo);
-            std::ostringstream sout;
-            sout << "jpeg_loader: Unsupported number of colors (" << output_components_ << ") in file " << filename;
-            throw image_load_error(sout.str());
         }
 
-        std::vector<unsigned char*> rows;
-        rows.resize(height_);
-
-        // size the image buffer
-        data.resize(height_*width_*output_components_);
+        class jpeg_loader_buffer_target : public impl::image_decode_target
+        {
+        public:
+            explicit jpeg_loader_buffer_target (
+                std::vector<unsigned char>& data_
+            ) : rows(0), cols(0), bytes_per_pixel(0), data(data_) {}
+
+            virtual void set_size (
+                unsigned long rows_,
+                unsigned long cols_,
+                unsigned long bytes_per_pixel_
+            )
+            {
+                rows = rows_;
+                cols = cols_;
+                bytes_per_pixel = bytes_per_pixel_;
+                data.resize(rows*cols*bytes_per_pixel);
+            }
+
+            virtual unsigned char* row (
+                unsigned long r
+            ) { return &data[r*cols*bytes_per_pixel]; }
+
+            unsigned long rows;
+            unsigned long cols;
+            unsigned long bytes_per_pixel;
+
+        private:
+            std::vector<unsigned char>& data;
+        };
+
+        // Destroys the decompressor and closes the file however decode() returns.
+        struct jpeg_loader_cleanup
+        {
+            jpeg_loader_cleanup (
+                jpeg_decompress_struct& cinfo_
+            ) : cinfo(cinfo_), fp(0), created(false) {}
+
+            ~jpeg_loader_cleanup()
+            {
+                if (created)
+                    jpeg_destroy_decompress(&cinfo);
+                if (fp)
+                    fclose(fp);
+            }
+
+            jpeg_decompress_struct& cinfo;
+            FILE* fp;
+            // volatile since it's set between setjmp() and a longjmp() to it
+            volatile bool created;
+        };
+
+        bool decode (
+            const char* filename,
+            const unsigned char* image_buffer,
+            size_t buffer_size,
+            unsigned long scale_denom,
+            unsigned long bytes_per_pixel,
+            bool luma,
+            impl::image_decode_target& target
+        )
+        /*!
+            ensures
+                - does impl::decode_jpeg(), where bytes_per_pixel may also be 0 to
+                  decode the JPEG as it is: gray, RGB or CMYK.
+        !*/
+        {
+            DLIB_CASSERT(scale_denom == 1 || scale_denom == 2 || scale_denom == 4 || scale_denom == 8,
+                "\t jpeg_loader: scale_denom must be 1, 2, 4 or 8"
+                << "\n\t scale_denom: " << scale_denom
+            );
+
+            const char* name = filename ? filename : "image buffer";
+            if ( filename == 0 && image_buffer == 0 )
+            {
+                throw image_load_error("jpeg_loader: invalid image buffer, it is NULL");
+            }
+
+            jpeg_decompress_struct cinfo;
+            jpeg_loader_error_mgr jerr;
+            jpeg_source_mgr src;
+            std::memset(&cinfo, 0, sizeof(cinfo));
+            jpeg_loader_cleanup cleanup(cinfo);
+
+            if ( filename )
+            {
+                cleanup.fp = fopen( filename, "rb" );
+                if ( !cleanup.fp )
+                {
+                    throw image_load_error(std::string("jpeg_loader: unable to open file ") + filename);
+                }
+            }
+
+            cinfo.err = jpeg_std_error(&jerr.pub);
+
+            jerr.pub.error_exit = jpeg_loader_error_exit;
+
+            /* Establish the setjmp return context for my_error_exit to use. */
+            if (setjmp(jerr.setjmp_buffer)) 
+            {
+                /* If we get here, the JPEG code has signaled an error.  The cleanup
+                 * object destroys the JPEG object and closes the input file.
+                 */
+                throw image_load_error(std::string("jpeg_loader: error while reading ") + name);
+            }
+
+            jpeg_create_decompress(&cinfo);
+            cleanup.created = true;
+
+            if ( cleanup.fp )
+            {
+                jpeg_stdio_src(&cinfo, cleanup.fp);
+            }
+            else
+            {
+                src.next_input_byte = image_buffer;
+                src.bytes_in_buffer = buffer_size;
+                src.init_source = jpeg_loader_init_source;
+                src.fill_input_buffer = jpeg_loader_fill_input_buffer;
+                src.skip_input_data = jpeg_loader_skip_input_data;
+                src.resync_to_restart = jpeg_resync_to_restart;
+                src.term_source = jpeg_loader_term_source;
+                cinfo.src = &src;
+            }
+
+            jpeg_read_header(&cinfo, TRUE);
+
+            if (bytes_per_pixel == 1)
+            {
+                // The Y of a YCbCr JPEG isn't the mean of its red, green and blue
+                // assign_pixel() would give, so it's only taken when asked for.
+                if (cinfo.jpeg_color_space != JCS_GRAYSCALE &&
+                    !(luma && cinfo.jpeg_color_space == JCS_YCbCr))
+                    return false;
+                cinfo.out_color_space = JCS_GRAYSCALE;
+            }
+            else if (bytes_per_pixel == 3)
+            {
+                if (cinfo.jpeg_color_space != JCS_YCbCr && cinfo.jpeg_color_space != JCS_RGB)
+                    return false;
+                cinfo.out_color_space = JCS_RGB;
+            }
+
+            // libjpeg scales by 1/2, 1/4 and 1/8 in its inverse DCT, so a smaller
+            // image costs less to decode rather than more.
+            cinfo.scale_num = 1;
+            cinfo.scale_denom = scale_denom;
+
+            jpeg_start_decompress(&cinfo);
+
+            const unsigned long output_components = cinfo.output_components;
+            if (output_components != 1 && 
+                output_components != 3 &&
+                output_components != 4)
+            {
+                std::ostringstream sout;
+                sout << "jpeg_loader: Unsupported number of colors (" << output_components << ") in file " << name;
+                throw image_load_error(sout.str());
+            }
+
+            target.set_size(cinfo.output_height, cinfo.output_width, output_components);
+
+            // read the data into the target, a row at a time
+            while (cinfo.output_scanline < cinfo.output_height)
+            {
+                JSAMPROW row = target.row(cinfo.output_scanline);
+                jpeg_read_scanlines(&cinfo, &row, 1);
+            }
+
+            jpeg_finish_decompress(&cinfo);
+            return true;
+        }
+    }
 
-        // setup pointers to each row
-        for (unsigned long i = 0; i < rows.size(); ++i)
-            rows[i] = &data[i*width_*output_components_];
+// ----------------------------------------------------------------------------------------
 
-        // read the data into the buffer
-        while (cinfo.output_scanline < cinfo.output_height)
+    void jpeg_loader::read_image( const char* filename, unsigned long scale_denom )
+    {
+        if ( filename == NULL )
         {
-            jpeg_read_scanlines(&cinfo, &rows[cinfo.output_scanline], 100);
+            throw image_load_error("jpeg_loader: invalid filename, it is NULL");
         }
+        jpeg_loader_buffer_target target(data);
+        decode(filename, 0, 0, scale_denom, 0, false, target);
+        height_ = target.rows;
+        width_ = target.cols;
+        output_components_ = target.bytes_per_pixel;
+    }
 
-        jpeg_finish_decompress(&cinfo);
-        jpeg_destroy_decompress(&cinfo);
+// ----------------------------------------------------------------------------------------
 
-        fclose( fp );
+    void jpeg_loader::read_image( const unsigned char* image_buffer, size_t buffer_size, unsigned long scale_denom )
+    {
+        jpeg_loader_buffer_target target(data);
+        decode(0, image_buffer, buffer_size, scale_denom, 0, false, target);
+        height_ = target.rows;
+        width_ = target.cols;
+        output_components_ = target.bytes_per_pixel;
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    bool impl::decode_jpeg (
+        const char* filename,
+        const unsigned char* image_buffer,
+        size_t buffer_size,
+        unsigned long scale_denom,
+        unsigned long bytes_per_pixel,
+        bool luma,
+        image_decode_target& target
+    )
+    {
+        DLIB_CASSERT(bytes_per_pixel == 1 || bytes_per_pixel == 3,
+            "\t impl::decode_jpeg(): bytes_per_pixel must be 1 or 3"
+            << "\n\t bytes_per_pixel: " << bytes_per_pixel
+        );
+        return decode(filename, image_buffer, buffer_size, scale_denom, bytes_per_pixel, luma, target);
     }
 
 // ----------------------------------------------------------------------------------------
@@ -17,14 +17,18 @@ namespace dlib
     {
     public:
 
-        jpeg_loader( const char* filename );
-        jpeg_loader( const std::string& filename );
-        jpeg_loader( const dlib::file& f );
+        jpeg_loader( const char* filename, unsigned long scale_denom = 1 );
+        jpeg_loader( const std::string& filename, unsigned long scale_denom = 1 );
+        jpeg_loader( const dlib::file& f, unsigned long scale_denom = 1 );
+        jpeg_loader( const unsigned char* image_buffer, size_t buffer_size, unsigned long scale_denom = 1 );
 
         bool is_gray() const;
         bool is_rgb() const;
         bool is_rgba() const;
 
+        unsigned long nr() const { return height_; }
+        unsigned long nc() const { return width_; }
+
         template<typename T>
         void get_image( T& t_) const
         {
@@ -75,13 +79,81 @@ namespace dlib
             return &data[i*width_*output_components_];
         }
 
-        void read_image( const char* filename );
+        void read_image( const char* filename, unsigned long scale_denom );
+        void read_image( const unsigned char* image_buffer, size_t buffer_size, unsigned long scale_denom );
         unsigned long height_; 
         unsigned long width_;
         unsigned long output_components_;
         std::vector<unsigned char> data;
     };
 
+// ----------------------------------------------------------------------------------------
+
+    namespace impl
+    {
+        bool decode_jpeg (
+            const char* filename,
+            const unsigned char* image_buffer,
+            size_t buffer_size,
+            unsigned long scale_denom,
+            unsigned long bytes_per_pixel,
+            bool luma,
+            image_decode_target& target
+        );
+        /*!
+            requires
+                - filename != 0, or image_buffer points to buffer_size bytes
+                - scale_denom is 1, 2, 4 or 8
+                - bytes_per_pixel is 1 or 3
+            ensures
+                - decodes the JPEG file, or the JPEG in image_buffer if filename == 0,
+                  scaled by 1/scale_denom, into target as gray levels if
+                  bytes_per_pixel == 1 or RGB bytes if it's 3, and returns true.
+                  The gray levels of a color JPEG are its luma, and are only decoded
+                  if luma == true.
+                - returns false without touching target if the JPEG's color space
+                  can't be decoded that way.
+            throws
+                - image_load_error
+        !*/
+
+        template <
+            typename image_type
+            >
+        bool decode_jpeg (
+            image_type& image,
+            const char* filename,
+            const unsigned char* image_buffer,
+            size_t buffer_size,
+            unsigned long scale_denom,
+            bool luma
+        )
+        {
+            typedef typename image_traits<image_type>::pixel_type pixel_type;
+            const unsigned long bytes_per_pixel = decoded_bytes_per_pixel<pixel_type>::value;
+            if (bytes_per_pixel != 1 && bytes_per_pixel != 3)
+                return false;
+
+            image_view_decode_target<image_type> target(image);
+            return decode_jpeg(filename, image_buffer, buffer_size, scale_denom, bytes_per_pixel, luma, target);
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_type
+        >
+    void load_jpeg (
+        image_type& image,
+        const std::string& file_name,
+        unsigned long scale_denom = 1
+    )
+    {
+        if (!impl::decode_jpeg(image, file_name.c_str(), 0, 0, scale_denom, false))
+            jpeg_loader(file_name, scale_denom).get_image(image);
+    }
+
 // ----------------------------------------------------------------------------------------
 
     template <
@@ -89,10 +161,31 @@ namespace dlib
         >
     void load_jpeg (
         image_type& image,
-        const std::string& file_name
+        const unsigned char* image_buffer,
+        size_t buffer_size,
+        unsigned long scale_denom = 1
+    )
+    {
+        if (!impl::decode_jpeg(image, 0, image_buffer, buffer_size, scale_denom, false))
+            jpeg_loader(image_buffer, buffer_size, scale_denom).get_image(image);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_type
+        >
+    void load_jpeg_luma (
+        image_type& image,
+        const unsigned char* image_buffer,
+        size_t buffer_size,
+        unsigned long scale_denom = 1
     )
     {
-        jpeg_loader(file_name).get_image(image);
+        typedef typename image_traits<image_type>::pixel_type pixel_type;
+        COMPILE_TIME_ASSERT(impl::decoded_bytes_per_pixel<pixel_type>::value == 1);
+        if (!impl::decode_jpeg(image, 0, image_buffer, buffer_size, scale_denom, true))
+            jpeg_loader(image_buffer, buffer_size, scale_denom).get_image(image);
     }
 
 // ----------------------------------------------------------------------------------------
@@ -21,17 +21,26 @@ namespace dlib
             WHAT THIS OBJECT REPRESENTS
                 This object represents a class capable of loading JPEG image files.
                 Once an instance of it is created to contain a JPEG file from
-                disk you can obtain the image stored in it via get_image().
+                disk or memory you can obtain the image stored in it via get_image().
+
+                Every constructor takes a scale_denom, 1, 2, 4 or 8, and loads the
+                image scaled down by 1/scale_denom, to ceil(width/scale_denom) x
+                ceil(height/scale_denom) pixels.  libjpeg does the scaling in its
+                inverse DCT, so loading a smaller image is also cheaper.
         !*/
 
     public:
 
         jpeg_loader( 
-            const char* filename 
+            const char* filename,
+            unsigned long scale_denom = 1
         );
         /*!
+            requires
+                - scale_denom is 1, 2, 4 or 8
             ensures
-                - loads the JPEG file with the given file name into this object
+                - loads the JPEG file with the given file name into this object,
+                  scaled by 1/scale_denom
             throws
                 - std::bad_alloc
                 - image_load_error
@@ -40,11 +49,15 @@ namespace dlib
         !*/
 
         jpeg_loader( 
-            const std::string& filename 
+            const std::string& filename,
+            unsigned long scale_denom = 1
         );
         /*!
+            requires
+                - scale_denom is 1, 2, 4 or 8
             ensures
-                - loads the JPEG file with the given file name into this object
+                - loads the JPEG file with the given file name into this object,
+                  scaled by 1/scale_denom
             throws
                 - std::bad_alloc
                 - image_load_error
@@ -53,11 +66,15 @@ namespace dlib
         !*/
 
         jpeg_loader( 
-            const dlib::file& f 
+            const dlib::file& f,
+            unsigned long scale_denom = 1
         );
         /*!
+            requires
+                - scale_denom is 1, 2, 4 or 8
             ensures
-                - loads the JPEG file with the given file name into this object
+                - loads the JPEG file with the given file name into this object,
+                  scaled by 1/scale_denom
             throws
                 - std::bad_alloc
                 - image_load_error
@@ -65,6 +82,26 @@ namespace dlib
                   us from loading the given JPEG file.
         !*/
 
+        jpeg_loader( 
+            const unsigned char* image_buffer,
+            size_t buffer_size,
+            unsigned long scale_denom = 1
+        );
+        /*!
+            requires
+                - image_buffer points to buffer_size bytes
+                - scale_denom is 1, 2, 4 or 8
+            ensures
+                - loads the JPEG image held in image_buffer, e.g. a JPEG a camera
+                  captured, into this object, scaled by 1/scale_denom.  image_buffer
+                  isn't used after the constructor returns.
+            throws
+                - std::bad_alloc
+                - image_load_error
+                  This exception is thrown if there is some error that prevents
+                  us from loading the given JPEG image.
+        !*/
+
         ~jpeg_loader(
         );
         /*!
@@ -92,6 +129,20 @@ namespace dlib
                     - returns false
         !*/
 
+        unsigned long nr(
+        ) const;
+        /*!
+            ensures
+                - returns the number of rows of the image stored in this object
+        !*/
+
+        unsigned long nc(
+        ) const;
+        /*!
+            ensures
+                - returns the number of columns of the image stored in this object
+        !*/
+
         template<
             typename image_type 
             >
@@ -115,14 +166,69 @@ namespace dlib
         >
     void load_jpeg (
         image_type& image,
-        const std::string& file_name
+        const std::string& file_name,
+        unsigned long scale_denom = 1
+    );
+    /*!
+        requires
+            - image_type == an image object that implements the interface defined in
+              dlib/image_processing/generic_image.h 
+            - scale_denom is 1, 2, 4 or 8
+        ensures
+            - performs: jpeg_loader(file_name, scale_denom).get_image(image);
+            - When the pixels of image are unsigned char or rgb_pixel and the JPEG
+              can be decoded as them, it is decoded straight into image without the
+              copy jpeg_loader keeps.  If image already has the size of the decoded
+              image its memory is reused.
+    !*/
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_type
+        >
+    void load_jpeg (
+        image_type& image,
+        const unsigned char* image_buffer,
+        size_t buffer_size,
+        unsigned long scale_denom = 1
+    );
+    /*!
+        requires
+            - image_type == an image object that implements the interface defined in
+              dlib/image_processing/generic_image.h 
+            - image_buffer points to buffer_size bytes
+            - scale_denom is 1, 2, 4 or 8
+        ensures
+            - performs: jpeg_loader(image_buffer, buffer_size, scale_denom).get_image(image);
+            - decodes straight into image when it can, like the load_jpeg() above.
+    !*/
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_type
+        >
+    void load_jpeg_luma (
+        image_type& image,
+        const unsigned char* image_buffer,
+        size_t buffer_size,
+        unsigned long scale_denom = 1
     );
     /*!
         requires
             - image_type == an image object that implements the interface defined in
               dlib/image_processing/generic_image.h 
+            - the pixels of image_type are unsigned char
+            - image_buffer points to buffer_size bytes
+            - scale_denom is 1, 2, 4 or 8
         ensures
-            - performs: jpeg_loader(file_name).get_image(image);
+            - loads the JPEG image held in image_buffer, scaled by 1/scale_denom,
+              into image as gray levels, like load_jpeg() does.  But the gray levels
+              of a color JPEG are its luma, the Y it was stored as, rather than the
+              mean of its red, green and blue.  That's the gray a camera preview
+              gives, and libjpeg gets it without decoding the color at all, so it's
+              the cheap way to look for faces in a photo.
     !*/
 
 // ----------------------------------------------------------------------------------------
@@ -21,51 +21,51 @@ namespace dlib
 
 // ----------------------------------------------------------------------------------------
 
-    struct LibpngData
+    png_loader::
+    png_loader( const char* filename ) : height_( 0 ), width_( 0 )
     {
-        png_bytep* row_pointers_;
-        png_structp png_ptr_;
-        png_infop info_ptr_;
-        png_infop end_info_;
-    };
+        read_image( filename, 0, 0 );
+    }
 
 // ----------------------------------------------------------------------------------------
 
     png_loader::
-    png_loader( const char* filename ) : height_( 0 ), width_( 0 )
+    png_loader( const std::string& filename ) : height_( 0 ), width_( 0 )
     {
-        read_image( filename );
+        read_image( filename.c_str(), 0, 0 );
     }
 
 // ----------------------------------------------------------------------------------------
 
     png_loader::
-    png_loader( const std::string& filename ) : height_( 0 ), width_( 0 )
+    png_loader( const dlib::file& f ) : height_( 0 ), width_( 0 )
     {
-        read_image( filename.c_str() );
+        read_image( f.full_name().c_str(), 0, 0 );
     }
 
 // ----------------------------------------------------------------------------------------
 
     png_loader::
-    png_loader( const dlib::file& f ) : height_( 0 ), width_( 0 )
+    png_loader( const unsigned char* image_buffer, size_t buffer_size ) : height_( 0 ), width_( 0 )
     {
-        read_image( f.full_name().c_str() );
+        if ( image_buffer == NULL )
+        {
+            throw image_load_error("png_loader: invalid image buffer, it is NULL");
+        }
+        read_image( 0, image_buffer, buffer_size );
     }
 
 // ----------------------------------------------------------------------------------------
 
     const unsigned char* png_loader::get_row( unsigned i ) const
     {
-        return ld_->row_pointers_[i];
+        return &data_[i*row_size_];
     }
 
 // ----------------------------------------------------------------------------------------
 
     png_loader::~png_loader()
     {
-        if ( ld_ && ld_->row_pointers_ != NULL )
-            png_destroy_read_struct( &( ld_->png_ptr_ ), &( ld_->info_ptr_ ), &( ld_->end_info_ ) );
     }
 
 // ----------------------------------------------------------------------------------------
@@ -108,108 +108,244 @@ namespace dlib
     {
     }
 
-    void png_loader::read_image( const char* filename )
+    namespace
     {
-        ld_.reset(new LibpngData);
-        if ( filename == NULL )
-        {
-            throw image_load_error("png_loader: invalid filename, it is NULL");
-        }
-        FILE *fp = fopen( filename, "rb" );
-        if ( !fp )
-        {
-            throw image_load_error(std::string("png_loader: unable to open file ") + filename);
-        }
-        png_byte sig[8];
-        if (fread( sig, 1, 8, fp ) != 8)
+        // Where libpng reads a PNG held in memory from.
+        struct png_loader_buffer_source
         {
-            fclose( fp );
-            throw image_load_error(std::string("png_loader: error reading file ") + filename);
-        }
-        if ( png_sig_cmp( sig, 0, 8 ) != 0 )
+            const unsigned char* next;
+            size_t left;
+        };
+
+        void png_loader_read_fn(png_structp png_struct, png_bytep data, png_size_t length)
         {
-            fclose( fp );
-            throw image_load_error(std::string("png_loader: format error in file ") + filename);
+            png_loader_buffer_source* src = (png_loader_buffer_source*) png_get_io_ptr(png_struct);
+            if (length > src->left)
+                png_error(png_struct, "read past the end of the image buffer");
+            std::memcpy(data, src->next, length);
+            src->next += length;
+            src->left -= length;
         }
-        ld_->png_ptr_ = png_create_read_struct( PNG_LIBPNG_VER_STRING, NULL, &png_loader_user_error_fn_silent, &png_loader_user_warning_fn_silent );
-        if ( ld_->png_ptr_ == NULL )
+
+        class png_loader_buffer_target : public impl::image_decode_target
         {
-            fclose( fp );
-            std::ostringstream sout;
-            sout << "Error, unable to allocate png structure while opening file " << filename << std::endl;
-            const char* runtime_version = png_get_header_ver(NULL);
-            if (runtime_version && std::strcmp(PNG_LIBPNG_VER_STRING, runtime_version) != 0)
+        public:
+            explicit png_loader_buffer_target (
+                std::vector<unsigned char>& data_
+            ) : rows(0), cols(0), bytes_per_pixel(0), data(data_) {}
+
+            virtual void set_size (
+                unsigned long rows_,
+                unsigned long cols_,
+                unsigned long bytes_per_pixel_
+            )
             {
-                sout << "This is happening because you compiled against one version of libpng, but then linked to another." << std::endl;
-                sout << "Compiled against libpng version:   " << PNG_LIBPNG_VER_STRING << std::endl;
-                sout << "Linking to this version of libpng: " << runtime_version << std::endl;
+                rows = rows_;
+                cols = cols_;
+                bytes_per_pixel = bytes_per_pixel_;
+                data.resize(rows*cols*bytes_per_pixel);
             }
-            throw image_load_error(sout.str());
-        }
-        ld_->info_ptr_ = png_create_info_struct( ld_->png_ptr_ );
-        if ( ld_->info_ptr_ == NULL )
-        {
-            fclose( fp );
-            png_destroy_read_struct( &( ld_->png_ptr_ ), ( png_infopp )NULL, ( png_infopp )NULL );
-            throw image_load_error(std::string("png_loader: parse error in file ") + filename);
-        }
-        ld_->end_info_ = png_create_info_struct( ld_->png_ptr_ );
-        if ( ld_->end_info_ == NULL )
-        {
-            fclose( fp );
-            png_destroy_read_struct( &( ld_->png_ptr_ ), &( ld_->info_ptr_ ), ( png_infopp )NULL );
-            throw image_load_error(std::string("png_loader: parse error in file ") + filename);
-        }
 
-        if (setjmp(png_jmpbuf(ld_->png_ptr_)))
+            virtual unsigned char* row (
+                unsigned long r
+            ) { return &data[r*cols*bytes_per_pixel]; }
+
+            unsigned long rows;
+            unsigned long cols;
+            unsigned long bytes_per_pixel;
+
+        private:
+            std::vector<unsigned char>& data;
+        };
+
+        // Destroys the libpng structures and closes the file however decode() returns.
+        struct png_loader_cleanup
         {
-            // If we get here, we had a problem writing the file 
-            fclose(fp);
-            png_destroy_read_struct( &( ld_->png_ptr_ ), &( ld_->info_ptr_ ), &( ld_->end_info_ ) );
-            throw image_load_error(std::string("png_loader: parse error in file ") + filename);
-        }
+            png_loader_cleanup (
+            ) : fp(0), png_ptr(0), info_ptr(0), end_info(0) {}
+
+            ~png_loader_cleanup()
+            {
+                if (png_ptr)
+                    png_destroy_read_struct( &png_ptr, info_ptr ? &info_ptr : 0, end_info ? &end_info : 0 );
+                if (fp)
+                    fclose(fp);
+            }
 
-        png_set_palette_to_rgb(ld_->png_ptr_);
-
-        png_init_io( ld_->png_ptr_, fp );
-        png_set_sig_bytes( ld_->png_ptr_, 8 );
-        // flags force one byte per channel output
-        byte_orderer bo;
-        int png_transforms = PNG_TRANSFORM_PACKING;
-        if (bo.host_is_little_endian())
-            png_transforms |= PNG_TRANSFORM_SWAP_ENDIAN;
-        png_read_png( ld_->png_ptr_, ld_->info_ptr_, png_transforms, NULL );
-        height_ = png_get_image_height( ld_->png_ptr_, ld_->info_ptr_ );
-        width_ = png_get_image_width( ld_->png_ptr_, ld_->info_ptr_ );
-        bit_depth_ = png_get_bit_depth( ld_->png_ptr_, ld_->info_ptr_ );
-        color_type_ = png_get_color_type( ld_->png_ptr_, ld_-> info_ptr_ );
-
-
-        if (color_type_ != PNG_COLOR_TYPE_GRAY && 
-            color_type_ != PNG_COLOR_TYPE_RGB && 
-            color_type_ != PNG_COLOR_TYPE_RGB_ALPHA &&
-            color_type_ != PNG_COLOR_TYPE_GRAY_ALPHA)
+            FILE* fp;
+            png_structp png_ptr;
+            png_infop info_ptr;
+            png_infop end_info;
+        };
+
+        bool decode (
+            const char* filename,
+            const unsigned char* image_buffer,
+            size_t buffer_size,
+            unsigned long bytes_per_pixel,
+            impl::image_decode_target& target,
+            unsigned& bit_depth,
+            int& color_type
+        )
+        /*!
+            ensures
+                - does impl::decode_png(), where bytes_per_pixel may also be 0 to
+                  decode any PNG png_loader can hold, and sets bit_depth and
+                  color_type to what it's decoded as.
+        !*/
         {
-            fclose( fp );
-            png_destroy_read_struct( &( ld_->png_ptr_ ), &( ld_->info_ptr_ ), &( ld_->end_info_ ) );
-            throw image_load_error(std::string("png_loader: unsupported color type in file ") + filename);
+            const std::string name = filename ? std::string("file ") + filename : std::string("image buffer");
+            png_loader_cleanup cleanup;
+            png_loader_buffer_source src;
+
+            png_byte sig[8];
+            if ( filename )
+            {
+                cleanup.fp = fopen( filename, "rb" );
+                if ( !cleanup.fp )
+                {
+                    throw image_load_error(std::string("png_loader: unable to open file ") + filename);
+                }
+                if (fread( sig, 1, 8, cleanup.fp ) != 8)
+                {
+                    throw image_load_error("png_loader: error reading " + name);
+                }
+            }
+            else
+            {
+                if (buffer_size < 8)
+                {
+                    throw image_load_error("png_loader: error reading " + name);
+                }
+                std::memcpy(sig, image_buffer, 8);
+                src.next = image_buffer + 8;
+                src.left = buffer_size - 8;
+            }
+            if ( png_sig_cmp( sig, 0, 8 ) != 0 )
+            {
+                throw image_load_error("png_loader: format error in " + name);
+            }
+            cleanup.png_ptr = png_create_read_struct( PNG_LIBPNG_VER_STRING, NULL, &png_loader_user_error_fn_silent, &png_loader_user_warning_fn_silent );
+            if ( cleanup.png_ptr == NULL )
+            {
+                std::ostringstream sout;
+                sout << "Error, unable to allocate png structure while opening " << name << std::endl;
+                const char* runtime_version = png_get_header_ver(NULL);
+                if (runtime_version && std::strcmp(PNG_LIBPNG_VER_STRING, runtime_version) != 0)
+                {
+                    sout << "This is happening because you compiled against one version of libpng, but then linked to another." << std::endl;
+                    sout << "Compiled against libpng version:   " << PNG_LIBPNG_VER_STRING << std::endl;
+                    sout << "Linking to this version of libpng: " << runtime_version << std::endl;
+                }
+                throw image_load_error(sout.str());
+            }
+            png_structp png_ptr = cleanup.png_ptr;
+            cleanup.info_ptr = png_create_info_struct( png_ptr );
+            cleanup.end_info = png_create_info_struct( png_ptr );
+            if ( cleanup.info_ptr == NULL || cleanup.end_info == NULL )
+            {
+                throw image_load_error("png_loader: parse error in " + name);
+            }
+            png_infop info_ptr = cleanup.info_ptr;
+
+            if (setjmp(png_jmpbuf(png_ptr)))
+            {
+                // If we get here, we had a problem reading the file.  The cleanup
+                // object destroys the libpng structures and closes the file.
+                throw image_load_error("png_loader: parse error in " + name);
+            }
+
+            if ( cleanup.fp )
+                png_init_io( png_ptr, cleanup.fp );
+            else
+                png_set_read_fn( png_ptr, &src, png_loader_read_fn );
+            png_set_sig_bytes( png_ptr, 8 );
+            png_read_info( png_ptr, info_ptr );
+
+            // The transformations png_read_png() did with PNG_TRANSFORM_PACKING and,
+            // on little endian hosts, PNG_TRANSFORM_SWAP_ENDIAN, so every channel is
+            // one byte or one native uint16.
+            png_set_palette_to_rgb( png_ptr );
+            png_set_packing( png_ptr );
+            byte_orderer bo;
+            if (bo.host_is_little_endian())
+                png_set_swap( png_ptr );
+            const int passes = png_set_interlace_handling( png_ptr );
+            png_read_update_info( png_ptr, info_ptr );
+
+            const unsigned long height = png_get_image_height( png_ptr, info_ptr );
+            const unsigned long width = png_get_image_width( png_ptr, info_ptr );
+            bit_depth = png_get_bit_depth( png_ptr, info_ptr );
+            color_type = png_get_color_type( png_ptr, info_ptr );
+
+            if (color_type != PNG_COLOR_TYPE_GRAY && 
+                color_type != PNG_COLOR_TYPE_RGB && 
+                color_type != PNG_COLOR_TYPE_RGB_ALPHA &&
+                color_type != PNG_COLOR_TYPE_GRAY_ALPHA)
+            {
+                throw image_load_error("png_loader: unsupported color type in " + name);
+            }
+
+            if (bit_depth != 8 && bit_depth != 16)
+            {
+                throw image_load_error("png_loader: unsupported bit depth of " + cast_to_string(bit_depth) + " in " + name);
+            }
+
+            const unsigned long channels = png_get_channels( png_ptr, info_ptr );
+            if (bytes_per_pixel != 0 && (bit_depth != 8 || channels != bytes_per_pixel))
+                return false;
+
+            target.set_size(height, width, channels*bit_depth/8);
+
+            // An interlaced image is read a pass at a time, each pass filling in
+            // more of the same rows.
+            for (int pass = 0; pass < passes; ++pass)
+            {
+                for (unsigned long r = 0; r < height; ++r)
+                    png_read_row( png_ptr, target.row(r), NULL );
+            }
+
+            png_read_end( png_ptr, cleanup.end_info );
+            return true;
         }
+    }
+
+// ----------------------------------------------------------------------------------------
 
-        if (bit_depth_ != 8 && bit_depth_ != 16)
+    void png_loader::read_image( const char* filename, const unsigned char* image_buffer, size_t buffer_size )
+    {
+        if ( filename == NULL && image_buffer == NULL )
         {
-            fclose( fp );
-            png_destroy_read_struct( &( ld_->png_ptr_ ), &( ld_->info_ptr_ ), &( ld_->end_info_ ) );
-            throw image_load_error("png_loader: unsupported bit depth of " + cast_to_string(bit_depth_) + " in file " + std::string(filename));
+            throw image_load_error("png_loader: invalid filename, it is NULL");
         }
+        png_loader_buffer_target target(data_);
+        decode(filename, image_buffer, buffer_size, 0, target, bit_depth_, color_type_);
+        height_ = target.rows;
+        width_ = target.cols;
+        row_size_ = target.cols*target.bytes_per_pixel;
+    }
 
-        ld_->row_pointers_ = png_get_rows( ld_->png_ptr_, ld_->info_ptr_ );
+// ----------------------------------------------------------------------------------------
 
-        fclose( fp );
-        if ( ld_->row_pointers_ == NULL )
+    bool impl::decode_png (
+        const char* filename,
+        const unsigned char* image_buffer,
+        size_t buffer_size,
+        unsigned long bytes_per_pixel,
+        image_decode_target& target
+    )
+    {
+        DLIB_CASSERT(bytes_per_pixel == 1 || bytes_per_pixel == 3 || bytes_per_pixel == 4,
+            "\t impl::decode_png(): bytes_per_pixel must be 1, 3 or 4"
+            << "\n\t bytes_per_pixel: " << bytes_per_pixel
+        );
+        if ( filename == NULL && image_buffer == NULL )
         {
-            png_destroy_read_struct( &( ld_->png_ptr_ ), &( ld_->info_ptr_ ), &( ld_->end_info_ ) );
-            throw image_load_error(std::string("png_loader: parse error in file ") + filename);
+            throw image_load_error("png_loader: invalid image buffer, it is NULL");
         }
+        unsigned bit_depth;
+        int color_type;
+        return decode(filename, image_buffer, buffer_size, bytes_per_pixel, target, bit_depth, color_type);
     }
 
 // ----------------------------------------------------------------------------------------
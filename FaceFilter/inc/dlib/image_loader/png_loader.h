@@ -3,7 +3,7 @@
 #ifndef DLIB_PNG_IMPORT
 #define DLIB_PNG_IMPORT
 
-#include <memory>
+#include <vector>
 
 #include "png_loader_abstract.h"
 #include "image_loader.h"
@@ -13,7 +13,6 @@
 namespace dlib
 {
 
-    struct LibpngData;
     class png_loader : noncopyable
     {
     public:
@@ -21,6 +20,7 @@ namespace dlib
         png_loader( const char* filename );
         png_loader( const std::string& filename );
         png_loader( const dlib::file& f );
+        png_loader( const unsigned char* image_buffer, size_t buffer_size );
         ~png_loader();
 
         bool is_gray() const;
@@ -30,6 +30,9 @@ namespace dlib
 
         unsigned int bit_depth () const { return bit_depth_; }
 
+        unsigned long nr() const { return height_; }
+        unsigned long nc() const { return width_; }
+
         template<typename T>
         void get_image( T& t_) const
         {
@@ -190,13 +193,58 @@ namespace dlib
 
     private:
         const unsigned char* get_row( unsigned i ) const;
-        void read_image( const char* filename );
+        void read_image( const char* filename, const unsigned char* image_buffer, size_t buffer_size );
         unsigned height_, width_;
         unsigned bit_depth_;
         int color_type_;
-        std::unique_ptr<LibpngData> ld_;
+        unsigned long row_size_;
+        std::vector<unsigned char> data_;
     };
 
+// ----------------------------------------------------------------------------------------
+
+    namespace impl
+    {
+        bool decode_png (
+            const char* filename,
+            const unsigned char* image_buffer,
+            size_t buffer_size,
+            unsigned long bytes_per_pixel,
+            image_decode_target& target
+        );
+        /*!
+            requires
+                - filename != 0, or image_buffer points to buffer_size bytes
+                - bytes_per_pixel is 1, 3 or 4
+            ensures
+                - if the PNG file, or the PNG in image_buffer if filename == 0, is an
+                  8 bit gray, RGB or RGBA image of bytes_per_pixel bytes per pixel
+                  then decodes it into target and returns true.
+                - returns false without touching target otherwise.
+            throws
+                - image_load_error
+        !*/
+
+        template <
+            typename image_type
+            >
+        bool decode_png (
+            image_type& image,
+            const char* filename,
+            const unsigned char* image_buffer,
+            size_t buffer_size
+        )
+        {
+            typedef typename image_traits<image_type>::pixel_type pixel_type;
+            const unsigned long bytes_per_pixel = decoded_bytes_per_pixel<pixel_type>::value;
+            if (bytes_per_pixel == 0)
+                return false;
+
+            image_view_decode_target<image_type> target(image);
+            return decode_png(filename, image_buffer, buffer_size, bytes_per_pixel, target);
+        }
+    }
+
 // ----------------------------------------------------------------------------------------
 
     template <
@@ -207,7 +255,23 @@ namespace dlib
         const std::string& file_name
     )
     {
-        png_loader(file_name).get_image(image);
+        if (!impl::decode_png(image, file_name.c_str(), 0, 0))
+            png_loader(file_name).get_image(image);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_type
+        >
+    void load_png (
+        image_type& image,
+        const unsigned char* image_buffer,
+        size_t buffer_size
+    )
+    {
+        if (!impl::decode_png(image, 0, image_buffer, buffer_size))
+            png_loader(image_buffer, buffer_size).get_image(image);
     }
 
 // ----------------------------------------------------------------------------------------
@@ -21,7 +21,7 @@ namespace dlib
             WHAT THIS OBJECT REPRESENTS
                 This object represents a class capable of loading PNG image files.
                 Once an instance of it is created to contain a PNG file from
-                disk you can obtain the image stored in it via get_image().
+                disk or memory you can obtain the image stored in it via get_image().
         !*/
 
     public:
@@ -65,6 +65,24 @@ namespace dlib
                   us from loading the given PNG file.
         !*/
 
+        png_loader( 
+            const unsigned char* image_buffer,
+            size_t buffer_size
+        );
+        /*!
+            requires
+                - image_buffer points to buffer_size bytes
+            ensures
+                - loads the PNG image held in image_buffer, e.g. an asset compiled
+                  into the program, into this object.  image_buffer isn't used after
+                  the constructor returns.
+            throws
+                - std::bad_alloc
+                - image_load_error
+                  This exception is thrown if there is some error that prevents
+                  us from loading the given PNG image.
+        !*/
+
         ~png_loader(
         );
         /*!
@@ -120,6 +138,20 @@ namespace dlib
                   object.  The possible values are 8 or 16.
         !*/
 
+        unsigned long nr(
+        ) const;
+        /*!
+            ensures
+                - returns the number of rows of the image stored in this object
+        !*/
+
+        unsigned long nc(
+        ) const;
+        /*!
+            ensures
+                - returns the number of columns of the image stored in this object
+        !*/
+
         template<
             typename image_type 
             >
@@ -151,6 +183,30 @@ namespace dlib
               dlib/image_processing/generic_image.h 
         ensures
             - performs: png_loader(file_name).get_image(image);
+            - When the PNG is an 8 bit gray, RGB or RGBA image and the pixels of
+              image are unsigned char, rgb_pixel or rgb_alpha_pixel respectively, it
+              is decoded straight into image without the copy png_loader keeps.  If
+              image already has the size of the PNG its memory is reused.
+    !*/
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_type
+        >
+    void load_png (
+        image_type& image,
+        const unsigned char* image_buffer,
+        size_t buffer_size
+    );
+    /*!
+        requires
+            - image_type == an image object that implements the interface defined in
+              dlib/image_processing/generic_image.h 
+            - image_buffer points to buffer_size bytes
+        ensures
+            - performs: png_loader(image_buffer, buffer_size).get_image(image);
+            - decodes straight into image when it can, like the load_png() above.
     !*/
 
 // ----------------------------------------------------------------------------------------
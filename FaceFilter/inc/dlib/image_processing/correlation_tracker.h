@@ -9,6 +9,8 @@
 #include "../array2d.h"
 #include "../image_transforms/assign_image.h"
 #include "../image_transforms/interpolation.h"
+#include "../image_transforms/fhog.h"
+#include "../matrix/matrix_fft.h"
 
 
 namespace dlib
@@ -33,7 +35,7 @@ namespace dlib
             scale_window_size(scale_window_size),
             regularizer_space(regularizer_space), nu_space(nu_space), 
             regularizer_scale(regularizer_scale), nu_scale(nu_scale),
-            scale_pyramid_alpha(scale_pyramid_alpha)
+            scale_pyramid_alpha(scale_pyramid_alpha), area_averaged_chips(false)
         {
             // Create the cosine mask used for space filtering.
             mask = make_cosine_mask();
@@ -63,8 +65,6 @@ namespace dlib
             B.set_size(0,0);
 
             point_transform_affine tform = inv(make_chip(img, p, F));
-            for (unsigned long i = 0; i < F.size(); ++i)
-                fft_inplace(F[i]);
             make_target_location_image(tform(center(p)), G);
             A.resize(F.size());
             for (unsigned long i = 0; i < F.size(); ++i)
@@ -77,8 +77,6 @@ namespace dlib
 
             // now do the scale space stuff
             make_scale_space(img, Fs);
-            for (unsigned long i = 0; i < Fs.size(); ++i)
-                fft_inplace(Fs[i]);
             make_scale_target_location_image(get_num_scale_levels()/2, Gs);
             Bs.set_size(0);
             As.resize(Fs.size());
@@ -118,6 +116,13 @@ namespace dlib
         double get_scale_pyramid_alpha (
         ) const { return scale_pyramid_alpha; }
 
+        bool uses_area_averaged_chips (
+        ) const { return area_averaged_chips; }
+
+        void use_area_averaged_chips (
+            bool enabled
+        ) { area_averaged_chips = enabled; }
+
 
         template <typename image_type>
         double update_noscale(
@@ -132,15 +137,13 @@ namespace dlib
 
 
             const point_transform_affine tform = make_chip(img, guess, F);
-            for (unsigned long i = 0; i < F.size(); ++i)
-                fft_inplace(F[i]);
 
             // use the current filter to predict the object's location
             G = 0;
             for (unsigned long i = 0; i < F.size(); ++i)
                 G += pointwise_multiply(F[i],conj(A[i]));
             G = pointwise_multiply(G, reciprocal(B+get_regularizer_space()));
-            ifft_inplace(G);
+            ifft_inplace(G, scratch.fft_ws);
             const dlib::vector<double,2> pp = max_point_interpolated(real(G));
 
 
@@ -166,7 +169,10 @@ namespace dlib
             B *= (1-get_nu_space());
             for (unsigned long i = 0; i < F.size(); ++i)
             {
-                A[i] = get_nu_space()*pointwise_multiply(G, F[i]) + (1-get_nu_space())*A[i];
+                // Updated in place, assigning an expression of A[i] to A[i] would
+                // allocate a temporary.
+                A[i] *= (1-get_nu_space());
+                A[i] += get_nu_space()*pointwise_multiply(G, F[i]);
                 B += get_nu_space()*(squared(real(F[i]))+squared(imag(F[i])));
             }
 
@@ -183,13 +189,11 @@ namespace dlib
 
             // Now predict the scale change
             make_scale_space(img, Fs);
-            for (unsigned long i = 0; i < Fs.size(); ++i)
-                fft_inplace(Fs[i]);
             Gs = 0;
             for (unsigned long i = 0; i < Fs.size(); ++i)
                 Gs += pointwise_multiply(Fs[i],conj(As[i]));
             Gs = pointwise_multiply(Gs, reciprocal(Bs+get_regularizer_scale()));
-            ifft_inplace(Gs);
+            ifft_inplace(Gs, scratch.fft_ws);
             const double pos = max_point_interpolated(real(Gs)).y();
 
             // update the rectangle's scale
@@ -202,7 +206,8 @@ namespace dlib
             Bs *= (1-get_nu_scale());
             for (unsigned long i = 0; i < Fs.size(); ++i)
             {
-                As[i] = get_nu_scale()*pointwise_multiply(Gs, Fs[i]) + (1-get_nu_scale())*As[i];
+                As[i] *= (1-get_nu_scale());
+                As[i] += get_nu_scale()*pointwise_multiply(Gs, Fs[i]);
                 Bs += get_nu_scale()*(squared(real(Fs[i]))+squared(imag(Fs[i])));
             }
 
@@ -232,39 +237,40 @@ namespace dlib
         void make_scale_space(
             const image_type& img,
             std::vector<matrix<std::complex<double>,0,1> >& Fs
-        ) const
+        )
+        /*!
+            ensures
+                - #Fs contains the FFTs of the scale space features around the current
+                  position, one per HOG cell and feature.
+        !*/
         {
             typedef typename image_traits<image_type>::pixel_type pixel_type;
 
             // Make an image pyramid and put it into the chips array.
             const long chip_size = get_scale_window_size();
             drectangle ppp = position*std::pow(get_scale_pyramid_alpha(), -(double)get_num_scale_levels()/2);
-            dlib::array<array2d<pixel_type> > chips;
-            std::vector<dlib::vector<double,2> > from_points, to_points;
-            from_points.push_back(point(0,0));
-            from_points.push_back(point(chip_size-1,0));
-            from_points.push_back(point(chip_size-1,chip_size-1));
+            dlib::array<array2d<pixel_type> > temp_chips;
+            dlib::array<array2d<pixel_type> >* buffered_chips = scratch.scale_chips((pixel_type*)0);
+            dlib::array<array2d<pixel_type> >& chips = buffered_chips ? *buffered_chips : temp_chips;
+            chips.resize(get_num_scale_levels());
             for (unsigned long i = 0; i < get_num_scale_levels(); ++i)
             {
-                array2d<pixel_type> chip(chip_size,chip_size);
-
                 // pull box into chip
-                to_points.clear();
-                to_points.push_back(ppp.tl_corner());
-                to_points.push_back(ppp.tr_corner());
-                to_points.push_back(ppp.br_corner());
-                transform_image(img,chip,interpolate_bilinear(),find_affine_transform(from_points, to_points));
+                chips[i].set_size(chip_size,chip_size);
+                transform_image(img,chips[i],interpolate_bilinear(),map_chip_to_image(ppp, chip_size, chip_size));
 
-                chips.push_back(chip);
                 ppp *= get_scale_pyramid_alpha();
             }
 
 
             // extract HOG for each chip
-            dlib::array<dlib::array<array2d<float> > > hogs(chips.size());
+            dlib::array<dlib::array<array2d<float> > >& hogs = scratch.scale_hogs;
+            hogs.resize(chips.size());
             for (unsigned long i = 0; i < chips.size(); ++i)
             {
-                extract_fhog_features(chips[i], hogs[i], 4);
+                impl_fhog::impl_extract_fhog_features(chips[i], hogs[i], 4, 1, 1, scratch.hist, scratch.scale_norm);
+                if (hogs[i].size() == 0)
+                    hogs[i].resize(31);
                 hogs[i].resize(32);
                 assign_image(hogs[i][31], chips[i]);
                 assign_image(hogs[i][31], mat(hogs[i][31])/255.0);
@@ -280,11 +286,12 @@ namespace dlib
                 {
                     for (unsigned long j = 0; j < hogs[0].size(); ++j)
                     {
-                        Fs[i].set_size(hogs.size());
+                        scratch.scale_plane.set_size(hogs.size());
                         for (unsigned long k = 0; k < hogs.size(); ++k)
                         {
-                            Fs[i](k) = hogs[k][j][r][c]*scale_cos_mask[k];
+                            scratch.scale_plane(k) = hogs[k][j][r][c]*scale_cos_mask[k];
                         }
+                        fft_real(scratch.scale_plane, Fs[i], scratch.fft_ws);
                         ++i;
                     }
                 }
@@ -296,31 +303,136 @@ namespace dlib
             const image_type& img,
             drectangle p,
             std::vector<matrix<std::complex<double> > >& chip
-        ) const
+        )
+        /*!
+            ensures
+                - #chip contains the FFTs of the feature planes of the part of img
+                  around p.
+                - returns the transform from chip coordinates to img coordinates.
+        !*/
         {
             typedef typename image_traits<image_type>::pixel_type pixel_type;
-            array2d<pixel_type> temp;
+            array2d<pixel_type> temp_chip;
+            array2d<pixel_type>* buffered_chip = scratch.chip((pixel_type*)0);
+            array2d<pixel_type>& temp = buffered_chip ? *buffered_chip : temp_chip;
             const double padding = 1.4;
-            const chip_details details(p*padding, chip_dims(get_filter_size(), get_filter_size()));
-            extract_image_chip(img, details, temp);
-
+            point_transform_affine tform;
+            if (uses_area_averaged_chips())
+            {
+                tform = map_chip_to_image(p*padding, get_filter_size(), get_filter_size());
+                temp.set_size(get_filter_size(), get_filter_size());
+                extract_chip(img, tform, temp);
+            }
+            else
+            {
+                const chip_details details(p*padding, chip_dims(get_filter_size(), get_filter_size()));
+                extract_image_chip(img, details, temp);
+                tform = inv(get_mapping_to_chip(details));
+            }
 
             chip.resize(32);
-            dlib::array<array2d<float> > hog;
-            extract_fhog_features(temp, hog, 1, 3,3 );
+            dlib::array<array2d<float> >& hog = scratch.hog;
+            impl_fhog::impl_extract_fhog_features_cell_size_1(temp, hog, 3,3, scratch.angle, scratch.norm);
+            if (hog.size() == 0)
+                hog.resize(31);
+            matrix<double>& plane = scratch.plane;
             for (unsigned long i = 0; i < hog.size(); ++i)
-                assign_image(chip[i], pointwise_multiply(matrix_cast<double>(mat(hog[i])), mask));
+            {
+                plane = pointwise_multiply(matrix_cast<double>(mat(hog[i])), mask);
+                fft_real(plane, chip[i], scratch.fft_ws);
+            }
+
+            assign_image(plane, temp);
+            plane = pointwise_multiply(plane, mask);
+            plane /= 255.0;
+            fft_real(plane, chip[31], scratch.fft_ws);
+
+            return tform;
+        }
 
-            assign_image(chip[31], temp);
-            assign_image(chip[31], pointwise_multiply(mat(chip[31]), mask)/255.0);
+        static point_transform_affine map_chip_to_image (
+            const drectangle& rect,
+            long rows,
+            long cols
+        )
+        /*!
+            ensures
+                - returns the transform from a rows by cols chip to rect, mapping the
+                  corners of the chip to the corners of rect, as
+                  inv(get_mapping_to_chip()) does for an unrotated chip.  Unlike it,
+                  this doesn't allocate anything.
+        !*/
+        {
+            matrix<double,2,2> m;
+            m = (rect.right()-rect.left())/std::max<long>(cols-1,1), 0,
+                0, (rect.bottom()-rect.top())/std::max<long>(rows-1,1);
+            return point_transform_affine(m, rect.tl_corner());
+        }
 
-            return inv(get_mapping_to_chip(details));
+        template <typename image_type>
+        static void extract_chip (
+            const image_type& img_,
+            const point_transform_affine& tform,
+            array2d<typename image_traits<image_type>::pixel_type>& chip
+        )
+        /*!
+            requires
+                - chip has the size of the chip to extract
+                - tform maps chip coordinates to img coordinates and doesn't rotate
+            ensures
+                - #chip contains the part of img tform maps it to, like
+                  extract_image_chip() would.  When the chip is more than twice smaller
+                  than that part of img, every chip pixel is the average of a grid of
+                  bilinear samples around it instead of coming from an image pyramid,
+                  so nothing is allocated.  Pixels outside img count as black.
+        !*/
+        {
+            typedef typename image_traits<image_type>::pixel_type pixel_type;
+            typedef matrix<double,pixel_traits<pixel_type>::num,1> sample_type;
+            const_image_view<image_type> img(img_);
+
+            // samples taken across and down each chip pixel
+            const long nx = std::max<long>(1, (long)std::abs(tform.get_m()(0,0)));
+            const long ny = std::max<long>(1, (long)std::abs(tform.get_m()(1,1)));
+            const dlib::vector<double,2> step_x(tform.get_m()(0,0)/nx, 0);
+            const dlib::vector<double,2> step_y(0, tform.get_m()(1,1)/ny);
+            const dlib::vector<double,2> first = -(nx-1)/2.0*step_x - (ny-1)/2.0*step_y;
+            const double scale = 1.0/(nx*ny);
+
+            for (long r = 0; r < chip.nr(); ++r)
+            {
+                for (long c = 0; c < chip.nc(); ++c)
+                {
+                    sample_type sum;
+                    sum = 0;
+                    const dlib::vector<double,2> p0 = tform(dlib::vector<double,2>(c,r)) + first;
+                    for (long y = 0; y < ny; ++y)
+                    {
+                        for (long x = 0; x < nx; ++x)
+                        {
+                            const dlib::vector<double,2> p = p0 + x*step_x + y*step_y;
+                            const long left = static_cast<long>(std::floor(p.x()));
+                            const long top = static_cast<long>(std::floor(p.y()));
+                            if (!(left >= 0 && top >= 0 && left+1 < img.nc() && top+1 < img.nr()))
+                                continue;
+
+                            const double lr_frac = p.x() - left;
+                            const double tb_frac = p.y() - top;
+                            sum += (1-tb_frac)*((1-lr_frac)*pixel_to_vector<double>(img[top][left]) + 
+                                                    lr_frac*pixel_to_vector<double>(img[top][left+1])) + 
+                                       tb_frac*((1-lr_frac)*pixel_to_vector<double>(img[top+1][left]) + 
+                                                    lr_frac*pixel_to_vector<double>(img[top+1][left+1]));
+                        }
+                    }
+                    vector_to_pixel(chip[r][c], sum*scale);
+                }
+            }
         }
 
         void make_target_location_image (
             const dlib::vector<double,2>& p,
             matrix<std::complex<double> >& g
-        ) const
+        )
         {
             g.set_size(get_filter_size(), get_filter_size());
             g = 0;
@@ -333,7 +445,7 @@ namespace dlib
                     g(r,c) = std::exp(-dist/3.0);
                 }
             }
-            fft_inplace(g);
+            fft_inplace(g, scratch.fft_ws);
             g = conj(g);
         }
 
@@ -341,7 +453,7 @@ namespace dlib
         void make_scale_target_location_image (
             const double scale,
             matrix<std::complex<double>,0,1>& g
-        ) const
+        )
         {
             g.set_size(get_num_scale_levels());
             for (long i = 0; i < g.size(); ++i)
@@ -349,7 +461,7 @@ namespace dlib
                 double dist = std::pow((i-scale),2.0);
                 g(i) = std::exp(-dist/1.000);
             }
-            fft_inplace(g);
+            fft_inplace(g, scratch.fft_ws);
             g = conj(g);
         }
 
@@ -389,6 +501,48 @@ namespace dlib
         matrix<std::complex<double> > G;
         matrix<std::complex<double>,0,1> Gs;
 
+        struct scratch_buffers
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    The rest of the memory update() reuses from one frame to the next:
+                    the image chips and their HOG features, the FHOG scratch memory and
+                    the FFT workspace.  Chips are only kept for unsigned char and
+                    rgb_pixel images, other pixel types get temporary buffers.  Since
+                    none of it is state, copying a tracker doesn't copy it.
+            !*/
+
+            scratch_buffers() {}
+            scratch_buffers(const scratch_buffers&) {}
+            scratch_buffers& operator= (const scratch_buffers&) { return *this; }
+
+            array2d<unsigned char>* chip(unsigned char*) { return &gray_chip; }
+            array2d<rgb_pixel>* chip(rgb_pixel*) { return &rgb_chip; }
+            template <typename T>
+            array2d<T>* chip(T*) { return 0; }
+
+            dlib::array<array2d<unsigned char> >* scale_chips(unsigned char*) { return &gray_scale_chips; }
+            dlib::array<array2d<rgb_pixel> >* scale_chips(rgb_pixel*) { return &rgb_scale_chips; }
+            template <typename T>
+            dlib::array<array2d<T> >* scale_chips(T*) { return 0; }
+
+            array2d<unsigned char> gray_chip;
+            array2d<rgb_pixel> rgb_chip;
+            dlib::array<array2d<unsigned char> > gray_scale_chips;
+            dlib::array<array2d<rgb_pixel> > rgb_scale_chips;
+            dlib::array<array2d<float> > hog;
+            dlib::array<dlib::array<array2d<float> > > scale_hogs;
+            array2d<matrix<float,18,1> > hist;
+            array2d<float> norm;
+            array2d<unsigned char> angle;
+            array2d<float> scale_norm;
+            // the feature planes before they are transformed into F and Fs
+            matrix<double> plane;
+            matrix<double,0,1> scale_plane;
+            fft_workspace<double> fft_ws;
+        };
+        scratch_buffers scratch;
+
         unsigned long filter_size;
         unsigned long num_scale_levels;
         unsigned long scale_window_size;
@@ -397,6 +551,7 @@ namespace dlib
         double regularizer_scale;
         double nu_scale;
         double scale_pyramid_alpha;
+        bool area_averaged_chips;
     };
 }
 
@@ -21,6 +21,11 @@ namespace dlib
                 This tool is an implementation of the method described in the following paper:
                     Danelljan, Martin, et al. "Accurate scale estimation for robust visual
                     tracking." Proceedings of the British Machine Vision Conference BMVC. 2014.
+
+                The tracker keeps the scratch memory of its updates, so with
+                use_area_averaged_chips(true), tracking an object in unsigned char or
+                rgb_pixel images doesn't allocate anything after the first update.
+                Copying a tracker copies its state but not that memory.
         !*/
 
     public:
@@ -43,6 +48,31 @@ namespace dlib
                   for processing. Recommended values for filter_size = 5-7, 
                   default = 6, for num_scale_levels = 4-6, default = 5
                 - #get_position().is_empty() == true
+                - #uses_area_averaged_chips() == false
+        !*/
+
+        bool uses_area_averaged_chips (
+        ) const;
+        /*!
+            ensures
+                - returns true if the image chips the tracker takes its features from
+                  are sampled directly from the image, and false if they are cut out of
+                  an image pyramid with extract_image_chip().
+        !*/
+
+        void use_area_averaged_chips (
+            bool enabled
+        );
+        /*!
+            ensures
+                - #uses_area_averaged_chips() == enabled
+                - When enabled, each pixel of the chip around the object is the average
+                  of a grid of bilinear samples of the part of the image it covers, instead
+                  of coming from an image pyramid.  Nothing is allocated for it, and only
+                  the generic image interface of the image is used, so it also works on
+                  images whose pixels aren't laid out row by row in memory, which
+                  extract_image_chip() can't handle.  The chips differ a little from
+                  the ones of extract_image_chip(), and so does the tracking.
         !*/
 
         template <
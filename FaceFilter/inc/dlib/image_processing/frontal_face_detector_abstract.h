@@ -17,6 +17,19 @@ namespace dlib
         ensures
             - returns an object_detector that is configured to find human faces that are
               looking more or less towards the camera.
+            - The detector is built from the tables of frontal_face_detector_table.h,
+              which tools/frontal_face_table.cpp makes out of
+              get_serialized_frontal_faces(), so this takes well under a millisecond.
+    !*/
+
+    const std::string get_serialized_frontal_faces(
+    );
+    /*!
+        ensures
+            - returns the detector get_frontal_face_detector() returns, in the format
+              serialize() writes.  Decoding it takes a good fraction of a second.
+            - This function is declared in frontal_face_detector_serialized.h, which
+              frontal_face_detector.h doesn't include.
     !*/
 
 }
@@ -0,0 +1,4967 @@
+// Copyright (C) 2013  Davis E. King (davis@dlib.net)
+// License: Boost Software License   See LICENSE.txt for the full license.
+#ifndef DLIB_FRONTAL_FACE_DETECTOR_TABLe_Hh_
+#define DLIB_FRONTAL_FACE_DETECTOR_TABLe_Hh_
+
+// Made by FaceFilter's tools/frontal_face_table.cpp, don't edit.
+
+namespace dlib
+{
+    namespace frontal_face_table
+    {
+        const unsigned long num_detectors = 5;
+        const unsigned long window_width = 80;
+        const unsigned long window_height = 80;
+        const unsigned long cell_size = 8;
+        const unsigned long padding = 0;
+        const unsigned long max_pyramid_levels = 1000;
+        const unsigned long min_pyramid_layer_width = 64;
+        const unsigned long min_pyramid_layer_height = 64;
+        const double nuclear_norm_regularization_strength = 9;
+        const double iou_thresh = 0.33008212188056446;
+        const double percent_covered_thresh = 0.78857142857142859;
+
+        // Every filter is num_planes planes of filter_rows x filter_cols.
+        const unsigned long num_planes = 31;
+        const unsigned long filter_rows = 10;
+        const unsigned long filter_cols = 10;
+        const unsigned long num_dimensions = 3100;
+
+        // The weight vectors, each of num_dimensions+1 values, the last
+        // one being the threshold.
+        inline const double* weights()
+        {
+            static const double table[15505] = {
+            -0.030968253163276605, 0.043780000466830518, 0.066451012645572266, 0.074807985259648366,
+            -0.0076858661574573939, -0.011933449146032917, -0.041450596588469106, -0.033722989584052447,
+            0.023094437601594367, 0.024495711299315368, -0.025633144534178663, 0.040563859638527502,
+            0.058856193396510111, 0.064203038912849217, -0.0040140158555549595, -0.0089298119033637928,
+            -0.036414520288538518, -0.030378722991434605, 0.019352110363625732, 0.021463185919548006,
+            0.0040829147259481488, -0.00033152959298006707, -0.0039153497995578291, -0.0069920911645486548,
+            0.0039658369675338138, 0.0027652521366649118, 0.0028178269815896089, 0.0013456133617320626,
+            -0.0027476385453197869, -0.0017361527674883365, 0.0068815676227401016, 0.013268766042978834,
+            0.0057165863626944093, -0.0044886127656035418, 0.014188325102003303, 0.0076900858186727044,
+            -0.0019785222028458364, -0.005612204921799706, -0.0038757182242986771, 0.00086942673862821932,
+            0.0088924311193683703, 0.011010034936933281, 0.0019219020861743923, -0.0090379506990408004,
+            0.015004344417019937, 0.0085929140407794875, 0.0004288259579968138, -0.0037553054166725363,
+            -0.0053434088403963706, -0.00056083742043840676, 0.0086574743447755068, 0.0042571228023877599,
+            -0.0038843691901500736, -0.012208888927565331, 0.011101025312877152, 0.0069501564802221102,
+            0.0035616068826771641, 2.6547190697670791e-05, -0.0055551987507072896, -0.0023198261682701705,
+            -0.0039006875118343231, -0.010994032164709124, -0.0063335186887529728, 0.00071178605924804121,
+            -0.0099270879544821541, -0.0051198298028404619, 0.0028112310771164295, 0.0051603322778296544,
+            0.0020071789863305807, -0.0014461172113832048, 0.0083727585794657021, -0.016943996907325402,
+            -0.022515057309660226, -0.022920484618537521, -0.00069373395311883926, 0.0021074577702705601,
+            0.013691840315275332, 0.012028188152783897, -0.0065229279917247401, -0.0080247696696785515,
+            0.016558714896085437, -0.027489764337771096, -0.039165799715059263, -0.042152980666337839,
+            0.0018951176737520637, 0.0054868189167488488, 0.024149057257808301, 0.02035717056966534,
+            -0.012571483563652376, -0.014217968873094572, 0.0012965654698616738, -0.0048998374667865423,
+            -0.0055137055439892103, -0.004750295412780825, -0.0013425777454069011, -0.00017227548787187696,
+            0.0032276350085175634, 0.0031596802766164474, -0.0011344298845661176, -0.0018674270740387446,
+            0.048661596164180587, 0.11336471105690306, 0.12404194278835763, 0.099326811063780968,
+            0.015099666736022962, 0.00595619635870627, -0.044232775182480442, -0.058112036532434408,
+            -0.032480157724698019, -0.011542358335643051, 0.04089760988208696, 0.090818131522946183,
+            0.096995103154900675, 0.076577796080744998, 0.019599215486342279, 0.010345974569524814,
+            -0.036538296611660491, -0.044648496733125653, -0.025279283285945562, -0.0092575693678336578,
+            0.024669320561819266, 0.039309632125976206, 0.033332093005653068, 0.022246447445663262,
+            0.035792735433007983, 0.024768715246956789, -0.019829259108015886, -0.012388164989979678,
+            -0.0082444708041455178, -0.0040464106999233279, 0.064869162241299821, 0.069552881991449891,
+            0.032627411871232082, 0.0061654125119896402, 0.14650710523330468, 0.10562417572488317,
+            -0.047310791024810048, -0.00078959900844169026, -0.0063719411078368027, -0.007279476502646702,
+            0.012375102379846631, -0.0051768769027775155, -0.02378978894693964, -0.027371505641591607,
+            0.056527256016109632, 0.042239385785384824, -0.006390051865201374, 0.017188575966274249,
+            0.0071346093270293863, 0.00044459743065493557, 0.0035817419123048049, -0.0017420639903525407,
+            -0.0072820755056301782, -0.0082993608013797928, 0.016738348869332741, 0.012517260151769584,
+            -0.0018146598926388493, 0.0052040086501140481, 0.0021753072804370772, 0.00015290321699341217,
+            -0.018405514436805371, -0.033533351715635387, -0.031710774668277049, -0.023105601431872534,
+            -0.020189881306007129, -0.013444134105972085, 0.015395174254408381, 0.013195344708132294,
+            0.0080546300041115272, 0.0034369059206554604, -0.034515511471741991, -0.071720322090218197,
+            -0.073844150217944382, -0.057004568076223082, -0.024172072678465929, -0.014630119568800348,
+            0.03013271956812966, 0.033050904884621708, 0.019104647910962304, 0.007323364301034291,
+            -0.042801433274659482, -0.087997653260284317, -0.09004171435054438, -0.069234300187654363,
+            -0.031431454918424279, -0.01926811787825506, 0.037232171188123643, 0.040101496520285711,
+            0.023265394826326193, 0.0089879998777805583, -0.013085870259274233, -0.013381683925254115,
+            -0.0055257628495857195, -0.00023925755205068955, -0.030560001199250248, -0.022084497363767139,
+            0.0094511403495919077, -0.00045081060039172272, 0.00099158534203228933, 0.0014039616275276076,
+            0.0041862891852123343, 0.045530389709149369, 0.043919856594321183, 0.012949737369598003,
+            -0.057517928852725046, -0.040392437951837376, -0.0073405552099827754, -0.046969732824738986,
+            -0.019474996701892375, -0.037096530107418937, 0.017093637268533753, 0.054261103136112043,
+            0.051395497546894535, 0.0089694291684512834, -0.060314263214711616, -0.039444719003339984,
+            -0.00391650671453872, -0.031121091246277651, -0.0072366825599758707, -0.028175199813228389,
+            0.0087725306093332216, 0.0013567692402405192, 0.0006327604151017234, -0.004231764402557894,
+            0.0041678814461021023, 0.0050069426283509706, 0.0032330838265283348, 0.016357528445651734,
+            0.010830933149310478, 0.010350152692106974, 0.0039913251416157439, -0.061030427067406336,
+            -0.059622284942839894, -0.022485840403821417, 0.083630327130735455, 0.061039795414787608,
+            0.013672535464434723, 0.082677899993735288, 0.038776352943324786, 0.062446056283620842,
+            -0.0091925999039492792, -0.02450298153544726, -0.023093755096858036, -0.0032635514758537622,
+            0.026234202690550625, 0.0167540144554051, 0.0011804265714047413, 0.011027796126430343,
+            0.0013234919577492059, 0.010771259006943295, -0.016877371947858263, -0.0063243425101529843,
+            -0.0048267484856964662, 0.0069027437163946218, -0.0030943380512064925, -0.0060926018448646275,
+            -0.0054849908072902541, -0.026937372572778728, -0.018798250498521622, -0.016434083277735472,
+            -0.013776586746586114, -0.022606111173516408, -0.020892007986893089, -0.00018320448984934616,
+            0.020601445584235802, 0.011653848513143123, -0.0010247413754144305, -0.0006998345778008834,
+            -0.0057668577369442368, 0.0029223766891164852, -0.011256638880376689, -0.0062661828961892655,
+            -0.005209613205025017, 0.0039208381486739987, 0.00065154645853904031, -0.0021113793261198911,
+            -0.0032529447018411848, -0.015466846908788648, -0.011413286301963166, -0.0090428449020116854,
+            0.0065680198780682739, -0.0011120243047975584, -0.0015941183066120008, -0.0038780027427204782,
+            0.0059416480914551697, 0.0057769410759990212, 0.0028417697990059014, 0.014843771085595918,
+            0.0092774713359887167, 0.0097420465426248139, 0.016027369033497919, -0.01157890543430113,
+            -0.012505446814908339, -0.012419878140713537, 0.026252752134576431, 0.022547273287586898,
+            0.0086891830668101161, 0.047041309639260717, 0.027506633709593623, 0.032075604579203908,
+            -0.0023825293389689202, 0.013464387121669441, 0.018414652472706589, 0.015161136833485828,
+            -0.0013513908679535342, -0.019422424256353849, -0.022114085231898301, -0.0042126718184364222,
+            -0.0022053027478724121, -0.0030407553566345643, -0.00033786266505616343, 0.0014044217429648054,
+            0.001769158723518125, 0.00046526867022525053, -0.0011659524203914136, -0.00076210173974705989,
+            -0.0022182197647658028, -0.0026934686073356675, -0.00056020409106835242, -0.00064216291959183849,
+            0.0029064158209765505, -0.0076938318258454406, -0.00790099769729391, 0.010636258111745933,
+            0.018495892565048411, -0.010754298771061536, 0.01110752072800311, 0.041383288846267796,
+            0.0069694102247890508, 0.0073571622494818757, 0.0087960929032301263, -0.020616606263063053,
+            -0.019461404904915915, 0.041092670561503543, 0.061125374390540985, -0.043074620336111667,
+            0.028766519830670467, 0.13632054914132283, 0.022400251760773791, 0.023380798080096247,
+            0.0035918063134404293, -0.0069373355493205302, -0.0054762721767263401, 0.021722005984406129,
+            0.027818204173525232, -0.023433247944217115, 0.0090543044056433167, 0.0618142346769038,
+            0.009872920607253359, 0.010166198221498042, -0.001783605076004155, -0.00051909163971109416,
+            -0.0038921951866655964, -0.024012307154098279, -0.021462635996037843, 0.027275708915281818,
+            0.0027085266302702953, -0.047150568044390703, -0.0068454303513787486, -0.0067044037185607953,
+            0.0012081043472456337, -0.010970949545103819, -0.016248589479486139, -0.021512575543721199,
+            -0.0073100510450829007, 0.026196324288379647, 0.018744419390346937, -0.015064460901156351,
+            -0.00091255028752527424, -0.00018927097512714489, 0.00044764179186576212, -0.0037027575476912596,
+            -0.0054162894748660357, -0.0067621975292140443, -0.0020094649471968152, 0.0082770565873739634,
+            0.0062868626115234177, -0.0040777733682234741, -0.00016054790852819813, 8.1247897208167681e-05,
+            -9.36714383189231e-05, 0.0013576743287778211, 0.0021055293729003691, 0.0033596797417639419,
+            0.0015451391584388801, -0.0040315645841276053, -0.002374908141944897, 0.0032727912404935987,
+            0.00031925367571963809, 0.00022650702080765641, 0.0017845514200062588, -0.0072589437726207542,
+            -0.009079212785788179, -0.0019268372823041989, 0.0064653198423662191, 0.0033978319349242331,
+            0.011427304140076373, 0.01488682171189255, 0.0030368835640840306, 0.0034582787961322933,
+            -0.0036562992129148056, -0.0018920526953150603, 0.0085059413690775909, 0.011943431300124136,
+            0.0082052647345218256, 0.0033077503454409518, 0.013282582999125984, 0.012612376244852083,
+            0.0020101430336403655, -0.0015955403935624026, -0.018544486865048934, -0.01521917565746504,
+            0.063573088805720296, 0.080688186341274365, 0.012313916762808703, -0.041656225041323193,
+            0.055745578303752659, 0.090289360211199349, 0.015071761174222308, -0.012572527568331762,
+            -0.01487934012762214, -0.027264198063550665, 0.10570616040693835, 0.11858299827750567,
+            -0.068566315520575599, -0.1898550014221706, 0.013612567366042477, 0.14290702755590504,
+            0.025147824585299263, -0.022081335163521055, -0.038463175412436434, -0.045997124836661206,
+            0.18429481396616754, 0.21897302301264093, -0.049664880423368703, -0.23636752686430806,
+            0.085792299038739805, 0.25482055426183881, 0.043775836077480659, -0.037574809342132205,
+            -0.012507541264737828, -0.023325619369286423, 0.090336709863870754, 0.10113779557819119,
+            -0.059759773770537136, -0.16382537510869927, 0.010600587094652898, 0.12203433787206105,
+            0.021492523949030538, -0.018886119051540827, 0.035322919391538393, 0.029668256362679422,
+            -0.12356018272094185, -0.15612183844645794, -0.019915164819385531, 0.086404517341862538,
+            -0.10477820379802663, -0.17515984691252509, -0.02929730028664828, 0.024488955622800186,
+            0.0057281343868778797, 0.026192669150096007, -0.09773085760075928, -0.10179587406090064,
+            0.10819748035366793, 0.23621063339000223, 0.027205632330815327, -0.1284911815170888,
+            -0.023294379244917725, 0.021007275779569855, -0.012490923734628808, 0.011329012993766568,
+            -0.035594765791378893, -0.022840002485540016, 0.12075622607613445, 0.19620454483249306,
+            0.082155778619446646, -0.040200277747014179, -0.0085638106602213687, 0.0087258476660938035,
+            -0.00086278692031055513, 0.0064500255473021566, -0.023052541675574752, -0.021849386804081293,
+            0.037876422418317346, 0.072449622354856649, 0.017389829323693887, -0.029306175292199827,
+            -0.0055067341708564081, 0.0051183782492779427, 0.016310253685685831, 0.011094933744405467,
+            -0.047590354642991384, -0.062773632684870601, -0.022767718086728908, 0.012832932879106071,
+            -0.053764271955735458, -0.068688891564133339, -0.011269334110079564, 0.0092326933891179637,
+            -0.0050530502728638954, 0.00037757765210873033, 0.01568390896151578, 0.033915607467434612,
+            0.0016090960768497774, 0.0089975844891400127, 0.026943604935215075, 0.017583939906475762,
+            0.0034723713674933397, -0.0077730944962382921, -0.0095037846347187874, 0.0077742372440739527,
+            0.068924256152109023, 0.089370559378690401, -0.060166886916302509, -0.021826101776360636,
+            0.074766845935105589, 0.066133577772076874, 0.024871552959019244, -0.021852385929174708,
+            -0.0075342914554848775, 0.016999467325912402, 0.11512025579432657, 0.11009288693607248,
+            -0.14463677516584833, -0.076743601487897398, 0.096228712664864435, 0.10314512911449843,
+            0.04785199160036608, -0.028418873822350074, -0.017738385829087301, 0.022025394345612806,
+            0.1705873017539335, 0.19402156904583079, -0.17952695267507493, -0.081960317707565872,
+            0.1651784503079006, 0.15860800874973949, 0.06593339936428462, -0.048481042204177198,
+            -0.0061738591173635723, 0.018367411145546599, 0.1190997719839583, 0.1062838261319823,
+            -0.15821659636585697, -0.087227238416301561, 0.093986588707208496, 0.10528909216864429,
+            0.050732690683269951, -0.027830808687881157, 0.013038861591813927, -0.012861252676752576,
+            -0.10681387152649043, -0.13056329024782834, 0.10218511812622372, 0.041986404999657778,
+            -0.11006422807306265, -0.10100737032701257, -0.039822551658048523, 0.032228392744188608,
+            -0.011760524585583165, -0.026014016188830869, -0.11359057296449625, -0.018454553156820055,
+            0.24432012728323724, 0.16845660637174664, -0.029005983377409159, -0.084939856242325432,
+            -0.061740958474880571, 0.0094436527982265858, -0.022083996317327548, -0.024125493581948824,
+            -0.075313195478335579, 0.054881215231913694, 0.23761406704040344, 0.18071104737313803,
+            0.029850108703186773, -0.04378713447248616, -0.051746416427932422, -0.0075807129216794653,
+            -0.0071545886605007261, -0.010312650704006769, -0.038333726635179893, 0.0087384490699586037,
+            0.099314745622536005, 0.072240310907288663, 0.0011559626857415711, -0.025870843915048559,
+            -0.023246565736752826, 0.00010034483874605225, 0.0094932761773554863, -0.0062180063001452176,
+            -0.060210419955082618, -0.083667105004537001, 0.046255669286589855, 0.013312698991264582,
+            -0.069406142127565587, -0.058817140161483698, -0.020825879918997425, 0.020243640072529948,
+            -0.0022310671338525252, -0.0036974736186119856, -0.02143615502021998, -0.021576889368582038,
+            0.00964407265142379, -0.0096942947550474716, -3.9506034220912478e-05, 0.01704172673981592,
+            0.019465785451461944, 0.0070799016287080296, -0.0030184894532871882, -0.0026597454124067162,
+            -0.021449206854593311, -0.016427418641311392, 0.014888051303696108, -0.0076406869126893623,
+            -0.0068620395445015501, 0.006783062207219694, 0.007116422285865464, 0.0016710152581250149,
+            0.0056939927994395841, 0.0054282997086735167, 0.041786282073365759, 0.033227814309532623,
+            -0.027761522111817045, 0.015373787594167861, 0.011749774044672884, -0.015650561527656426,
+            -0.016796325986803126, -0.0045395678285943541, 0.012860298676779092, 0.0099209592910456685,
+            0.086835952959949322, 0.062301500294425327, -0.06453896461621482, 0.029255806978742072,
+            0.033336301241269385, -0.019098575445327743, -0.01874446618531209, -0.0023569404152643373,
+            0.0050752071750116475, 0.0043367785084360852, 0.035628106735152688, 0.026883702094237572,
+            -0.025138609032008485, 0.012530765327545724, 0.01193071536443642, -0.010465386703356777,
+            -0.01085580056469175, -0.002353085255575951, -0.0071078216094083192, -0.0041925277914274719,
+            -0.043832639405111236, -0.027400854855311498, 0.036684261377653585, -0.013152984742382188,
+            -0.022176075141391586, 0.001589728573286122, -0.00022924756626092717, -0.0030541325838541189,
+            -0.0054013749598992265, -0.0027458450091395843, -0.031890344456800897, -0.018424250640598737,
+            0.028222840341205063, -0.0089665724781086541, -0.01813122175947289, -0.0018493198862515993,
+            -0.0037851273639872363, -0.0038065629493009403, -0.00041778439093524125, 0.00020544187190438701,
+            -0.0011196327657914226, 0.00085154961950705931, 0.0025111873076960806, 0.00028294965312400573,
+            -0.0026167419222307585, -0.0030454300211530307, -0.0037206300049076979, -0.0017047788385402328,
+            -0.0013831375810598515, -0.00094456105212074989, -0.0089445367232177646, -0.0060334024909372477,
+            0.007037413812628639, -0.0028603204510619759, -0.0039412218443263076, 0.0012035004217635986,
+            0.0010114222993617573, -0.00015982373841438868, 0.0015678730002948778, 0.0015075762167292089,
+            0.011547557691614899, 0.0092195545324001548, -0.0076341870993970372, 0.0042633215911967977,
+            0.0031979818075217976, -0.0043988238592972458, -0.0047304937743562524, -0.0012934148972058614,
+            -0.020368139946687951, -0.015296830857917856, -0.046581165405261596, -0.033291695447496883,
+            -0.014768936899926512, -0.047678959222466739, -0.0093230176375185825, 0.031994894523479478,
+            0.026140249399098436, 0.00062064674253208907, -0.020517544176422327, -0.0033075774371442526,
+            -0.027728197472081891, -0.021272426222600387, -0.016038505845782772, -0.053526374150216077,
+            -0.01824530051969326, 0.028164127913808429, 0.0347331513860192, 0.0042410793544323498,
+            0.0096953579004524035, 0.0065809175772246209, 0.021061876305835486, 0.015137204354827382,
+            0.0070973189655094424, 0.023013694417264176, 0.0049503013018281986, -0.014994443452440963,
+            -0.012929199632028685, -0.00050472892514424493, 0.042192634556307111, 0.011565011445337062,
+            0.064575948006466502, 0.048572008160009422, 0.032524788509120932, 0.10790862590152796,
+            0.034034973404262689, -0.059517405013107726, -0.068119078862947519, -0.007298183797277839,
+            0.0088109938346673279, -0.0034849197973938666, 0.0041269803664800639, 0.0041641807680653084,
+            0.00735823480572883, 0.025214688930421503, 0.011424127839965041, -0.010446791354990144,
+            -0.018321104845702877, -0.0032869705978866822, 0.00079050612488681601, -0.022157586718108458,
+            -0.034278922206925022, -0.021763778465754394, 0.0027563702352706001, 0.01218634356048731,
+            0.017007547395221076, 0.006401482459778474, -0.016809071321007153, -0.0068221002709806357,
+            0.0095671677961591383, -0.013624832449135944, -0.011127805556557673, -0.0054510203408836052,
+            0.0089340404744532257, 0.031849334701063728, 0.01960449919023604, -0.0080373490863551392,
+            -0.026725221924947484, -0.0065094750467004107, -0.0029650431051483684, -0.0081357522828787738,
+            -0.016153388432906684, -0.010834419251338618, -0.0015829392172692501, -0.0042563187208030321,
+            0.0029660432769451025, 0.0066426782090500012, -0.00029684997382154257, -0.0016752284709394541,
+            -0.0037368187906951351, -0.00095710224637110867, -0.0056126853565682906, -0.0042337524343546481,
+            -0.0028870241936685952, -0.0095875103859475105, -0.0030634674683203797, 0.0052486361574625232,
+            0.0060796363679719778, 0.00066643592830701237, 0.013293666839664812, 0.014699922651268816,
+            0.037882596313642769, 0.02650776337780969, 0.0091866834215734924, 0.028976069660452953,
+            0.0026343357264053523, -0.022466474177602516, -0.013786872498260565, 0.0010040929912620341,
+            -0.047664736889440965, -0.0043388379482472246, -0.065098971916695128, -0.080001696089997423,
+            -0.0031039739772257494, 0.0051884546143567516, 0.075388583783370697, 0.14390803827620169,
+            0.14421478368722113, 0.096184193411196453, -0.035452097402302984, -0.0040207255504415128,
+            -0.046037616654133917, -0.059677945447418827, 0.0024011685769551863, 0.011314554871859648,
+            0.059094513573530856, 0.10862656678446339, 0.10944223271386488, 0.076464090475421687,
+            -0.010236659222773191, -0.0048560975997949266, -0.0022032656163245394, -0.018043141028805502,
+            0.022623584685178316, 0.037981706765160363, 0.031134358552228472, 0.038771699846193622,
+            0.041742841505352048, 0.045006942168265063, -0.0002660441720504312, -0.010970685233727011,
+            0.032489490267442522, -0.002850111491818675, 0.064948983028573368, 0.10286788820940634,
+            0.042104913459894158, 0.022743366735254737, 0.030849097670248592, 0.068459554362004058,
+            0.015446499896976527, -0.00048539553093982922, 0.026773048267758118, 0.025510475788453123,
+            0.01223155803152959, 0.016088358335517246, -0.017228154852742615, -0.042844557262663494,
+            -0.041543652190567867, -0.019433477584261075, 0.0057219623598829539, 0.0012323696105672971,
+            0.0056794712901185171, 0.0097601159124529515, -0.0038501246762002068, -0.0073072798775771965,
+            -0.011759526212277582, -0.018701674985779786, -0.019265251593799212, -0.015961437027883409,
+            0.015945794223632622, -0.00064624835389635155, 0.028074129954434496, 0.02630320494988396,
+            0.01348846075382943, 0.017972163516409519, -0.017232259766797303, -0.043938517752793685,
+            -0.042488093405267463, -0.019160913763725654, 0.02432844561022544, 0.0030929929276000347,
+            0.030590682873107941, 0.041026355309672302, -0.0036290339091563373, -0.010900702133223996,
+            -0.041823918538402741, -0.075212382743430284, -0.076019267972365967, -0.054543712623199687,
+            0.032466897043854727, 0.0045361390261022712, 0.039598105783076785, 0.05484034900216532,
+            -0.0072672389778457233, -0.018384665305985683, -0.057370462818852885, -0.10119142960339572,
+            -0.10257063735088891, -0.075324421937162558, 0.004907528028627108, 0.0018729914199085928,
+            0.0024219902152294946, 0.0085500922277510997, -0.0081451883839561683, -0.013933576108966828,
+            -0.013193180414251503, -0.017675356210567032, -0.018762849921928167, -0.018753030623507326,
+            0.0070798525855717987, 0.001842502644404812, -0.021008388342233911, -0.021023841794655898,
+            -0.0023982294199528806, 0.01224428710389768, 0.022811572657029898, 0.033987216084571475,
+            0.037343879718716812, 0.015566666689062796, 0.0065811307446731627, 0.001712712327506009,
+            -0.019528506948982251, -0.019542871823055048, -0.0022292923726401118, 0.011381770076722305,
+            0.021204670624565033, 0.031593074855238483, 0.03471328703129696, 0.014470113254652851,
+            -0.0010749219779607228, -0.00027974404311153112, 0.0031896678748117202, 0.0031920141462125711,
+            0.0003641190943654576, -0.0018590292881610433, -0.0034634422828041019, -0.0051602212189359375,
+            -0.0056698577501142098, -0.0023634605304866316, 0.0013325052719103335, 0.00034677904059493276,
+            -0.0039540072172428399, -0.003956915725092775, -0.00045137286500147937, 0.0023045080274661754,
+            0.0042933861204968856, 0.0063967637832659067, 0.0070285243933163937, 0.0029298160065534592,
+            0.0032800190246856349, 0.00085361151996264054, -0.0097329587880036102, -0.0097401182051423934,
+            -0.0011110737162857087, 0.0056726456037154548, 0.010568354551694909, 0.015745909114079748,
+            0.017301015021497154, 0.0072118680825530735, 0.0034015577900290803, 0.00088524148595929965,
+            -0.010093606633436754, -0.01010103133767085, -0.0011522437603210054, 0.0058828414402998415,
+            0.010959957391269259, 0.016329362544847202, 0.017942091792417014, 0.0074790987101733845,
+            -0.00475452899138695, -0.0012373467008878808, 0.014108343391079182, 0.014118721274893754,
+            0.0016105492547119423, -0.0082227443736591754, -0.015319285567895609, -0.022824374131735822,
+            -0.025078567191546445, -0.010453913718943489, -0.0045425414586174936, -0.0011821778135434518,
+            0.01347930255183788, 0.013489217722734054, 0.0015387405932170679, -0.007856121455695338,
+            -0.014636253125100135, -0.021806716490367178, -0.023960403101273831, -0.0099878108975960597,
+            -0.0055053441010690487, -0.0014327432587014682, 0.016336273310066974, 0.016348290025401686,
+            0.0018648803814156677, -0.0095212453881615231, -0.01773844235392999, -0.026428702762014186,
+            -0.029038868456025244, -0.012104751560023963, -0.0015266930931892425, -0.00039731562591123595,
+            0.0045302301133344188, 0.0045335624820233749, 0.00051715205183606224, -0.0026403471437586373,
+            -0.004919067169738168, -0.0073289729448307297, -0.0080528008952675395, -0.0033567821124699053,
+            0.012273389815808843, 0.0034449076717715708, -0.004393364188812152, 0.0075328821486707262,
+            0.00094734491574662624, -0.016053737946620572, 0.00367929407224173, 0.046154585632684882,
+            0.040695956855459452, 0.017294798609535408, 0.0020495463835996418, 0.00057526878608709633,
+            -0.00073365254588572747, 0.0012579239800567616, 0.00015819813231948972, -0.0026808307277400817,
+            0.00061440921971284059, 0.0077074032104939858, 0.0067958610010739866, 0.002888076764220448,
+            -0.021539271169700509, -0.0060456647764332008, 0.0077101651646546291, -0.013219884133446484,
+            -0.0016625495757676236, 0.02817361952230827, -0.0064570028267992045, -0.080999312381250799,
+            -0.071419653687778362, -0.030351627599762072, -0.008474287352791262, -0.0023785716865950875,
+            0.0030334431758617842, -0.0052011554167637657, -0.00065410397279992781, 0.011084467330357197,
+            -0.0025404061707090136, -0.031867905050696588, -0.028098939059667698, -0.011941370340659965,
+            0.01352658041006408, 0.003796654496172204, -0.0048419544121476379, 0.0083020369785929259,
+            0.0010440748131707268, -0.017692925954112159, 0.0040549732280437661, 0.050867260245376356,
+            0.044851271004268438, 0.019060706746755276, 0.01992182779230078, 0.0055916791063713358,
+            -0.0071311875620247191, 0.012227166512076192, 0.0015377041350961291, -0.026057984598790527,
+            0.0059721286461561218, 0.074916850242546601, 0.066056554585521898, 0.028072440032654588,
+            0.026198217178840525, 0.0073533425321403575, -0.0093778744822386323, 0.016079346087361345,
+            0.0020221591767608077, -0.034267575589917977, 0.0078536530344088164, 0.098519469873513843,
+            0.086867730268517351, 0.036916686981888859, 0.021112779699854516, 0.0059259567122010078,
+            -0.0075574989185258077, 0.012958121895957291, 0.0016296300212165667, -0.027615763673506211,
+            0.0063291500037066951, 0.079395473722002674, 0.070005498453034845, 0.029750645785416835,
+            -0.0024456536832329952, -0.00068644859018604498, 0.00087544252006993561, -0.0015010377123789362,
+            -0.00018877242695441109, 0.0031989437252484473, -0.00073315353252163492, -0.0091969809518536449,
+            -0.0081092687733300296, -0.0034462433406704011, -0.013673413559855914, -0.0038378677756149169,
+            0.0048945145859632709, -0.0083921568908176102, -0.0010554084088607446, 0.017884985437597218,
+            -0.0040989905977961566, -0.051419432325583159, -0.045338138578635133, -0.01926761370505807,
+            0.027110281453742474, -0.0039987318493665859, -0.019894238785689029, -0.078451692549465074,
+            -0.054584860315796145, -0.029254479782623945, -0.010672395570387369, -0.00061349295713060761,
+            -0.00077626071542929564, -0.0093796710271122456, 0.007888678617141813, -0.0034975094977545444,
+            -0.0050773811598215784, -0.073514285307044125, -0.046219017300630806, -0.0080665374756877569,
+            -0.011099219960306297, -0.041093765130491414, -0.022181006282239131, -0.00055247643591569339,
+            -0.02152678202656385, 0.0049254375099206322, 0.012230336540369752, -0.065012081745622757,
+            -0.029261259247778625, 0.048502961638726638, 0.046506913498577482, -0.039266158109110876,
+            -0.038035023416555312, 0.0070387497579161027, 0.0071525174208405245, -0.0037730721291356828,
+            -0.0033054121030326373, -0.018971544766297702, -0.014686821209454132, -0.016609872004734409,
+            -0.023899246380670765, -0.021925568840284237, -0.0055180813089114765, -0.0003890708889515255,
+            -0.0049196454932196286, -0.0019757559155723918, 0.0069492544288142135, 0.09268209658987818,
+            0.053878651958398013, -0.015414020341359377, -0.033887436288117793, 0.011173487553287287,
+            0.020441652272321472, 0.0032070769360464306, -0.014036083827140311, -0.00069806594108679464,
+            0.013626810744884631, 0.11582402446766576, 0.070334107177996541, -0.0052872821912330805,
+            -0.030182105167948042, 0.0094452828639766777, 0.019477647117989862, 0.0064368739613123501,
+            0.021200486426881826, -0.0082566593492925822, -0.010568651673575128, 0.013933115514694975,
+            -0.0016815454537008508, -0.050814645887936605, -0.062093361680194914, -0.010864941996561156,
+            0.013378505735736382, -0.0039320461346701958, 0.019278209490017767, -0.00070813751025528059,
+            -0.014668571167373218, -0.0023663507845356115, -0.0069959825266992497, -0.022302696031184083,
+            -0.001641255045917429, 0.040000581945830671, 0.021884716813549948, -0.0087137257322553799,
+            -0.012625133552294887, 0.010973680651671786, 0.0016517628091792906, -0.029135170819595144,
+            -0.0081622582543927659, 0.052706032854030832, 0.087250839316706699, 0.047727267133309506,
+            -0.0017920984437904651, -0.0021799965843554607, 0.0080768761881773801, 0.00023329710070828184,
+            -0.0067091718330319246, -0.011393067090486351, -0.0086807958051519727, -0.0060511964704697769,
+            0.0053738882793985619, 0.016713960920729604, 0.0068492651770808502, -0.0039829082168354553,
+            -0.00088994815871597851, -0.004442035079455264, 0.004060568022989779, 0.00018469986793835658,
+            0.0099624558962480188, 0.021402533038130174, 0.011944926573521294, 0.0079180920355649224,
+            0.0096758717900158123, -0.0041561671453751205, -0.0046266437102718688, -0.017664094147775471,
+            0.018878530934176629, 0.0059422909806113589, 0.035309245661106367, 0.077823669882875882,
+            0.043204442689007215, 0.026699183210529904, 0.034567399409274058, -0.015110792374201647,
+            -0.029358618841769504, -0.043313777239646412, 0.091526836348306037, 0.10081944822612529,
+            0.015247636287860154, 0.07017801340246102, 0.034801887533833654, -0.013822527926349033,
+            0.020016300481856424, -0.013593299423642159, -0.023703326887028489, -0.017266197325742392,
+            0.066619417851942683, 0.097645312936045447, -0.041441587375455294, -0.052398784739353638,
+            -0.033517032772553995, -0.05833090799386452, -0.035152145317709611, 0.010209211340499735,
+            -0.029046464440866733, -0.041899513771003143, 0.090161676218594902, 0.10062269782309524,
+            0.012189861215143408, 0.063556804663205707, 0.031112618491952779, -0.016216687255561458,
+            0.017039232216267061, -0.012307572236768295, -0.028206643952368538, -0.051858104642579908,
+            0.092145959479028886, 0.087463015433033739, 0.045751115604823943, 0.13052726529559788,
+            0.069087745337626127, 0.01401367610320481, 0.048921218955893152, -0.025317337932299833,
+            -0.0087534202162341326, -0.012513097088526669, 0.027124316935684831, 0.030427925291839422,
+            0.0033282940045670818, 0.018452980350231636, 0.0089803399731582384, -0.0051900131430774668,
+            0.0048053639586729553, -0.0035729418143279233, 0.002390288883196862, 0.0075884348454357004,
+            -0.0091213893894569898, -0.004480881353692354, -0.013574065092259696, -0.030735599407642443,
+            -0.01697016508968624, -0.0096973185648178053, -0.013402639848705138, 0.0059671038681335872,
+            0.015267029726184557, 0.0097137758688982632, -0.042330391275212813, -0.064183499453509776,
+            0.030964403480602594, 0.042417719208192844, 0.026485266455973752, 0.041319527077741017,
+            0.026719561918944954, -0.0082594013053229748, 0.010072448107726549, -0.0039564176965039286,
+            -0.023667263262220749, -0.051856885818514241, 0.051898629064609, 0.091834795004621772,
+            0.053546998865494987, 0.054877445659541668, 0.047669937547325195, -0.017851616032804093,
+            -0.015672526713879382, -0.01958579441737519, 0.012569485805818854, 0.023619797145416128,
+            -0.012473722478119202, 0.00013364100633727651, 0.031655387033481107, 0.0061899528338185293,
+            -0.0083989873775065504, -0.00087668006748457567, -0.064255226756346956, -0.077194139683009588,
+            0.036592621059110569, 0.093077147778842184, 0.0094094112539264783, 0.087821267073269205,
+            0.16798245230510042, 0.033334702377104938, -0.02642511271338829, -0.0097729031947602456,
+            -0.080959857904783106, -0.10277294704482465, 0.072620962946723877, 0.12394906466582936,
+            -0.095603377828936284, -0.04423294772630431, 0.14385981934257847, 0.027879881899716963,
+            -0.047509679824178586, -0.0013482770961313452, -0.040776065507991295, -0.060658410508161058,
+            0.079382381162037691, 0.073203018303657413, -0.22163339297684026, -0.27232555190331953,
+            -0.036989929977490524, -0.008754965051095815, -0.046876940887441945, 0.017023361954118636,
+            0.034314262098927448, 0.042236168398783698, -0.02441179818250858, -0.050931972527111055,
+            0.014712730194816215, -0.018450511021022478, -0.077255728382386257, -0.015208073502426474,
+            0.016722729988238785, 0.0032049634682793683, 0.014714307596105987, 0.022190691423695823,
+            -0.030097433331547296, -0.026781224356618779, 0.085861537352690684, 0.10675086432096492,
+            0.017059949489851945, 0.0039324486386433394, 0.017694146681246314, -0.0067433734593877817,
+            -0.025197988039901482, -0.02557194122458567, -0.0082662131039058263, 0.030807742083710433,
+            0.095347096785736829, 0.16654902641251362, 0.12369962465623907, 0.02511682278944994,
+            0.0017617396012150205, -0.013185359135967039, 0.020013225109105456, 0.030997605297225825,
+            -0.044860669392725164, -0.037413559280322722, 0.13268710527452265, 0.16811872410296519,
+            0.033237767199634005, 0.0074386569010445481, 0.026170102303895198, -0.010794784621917786,
+            0.019698333876657204, 0.026198235300483541, -0.023407822354968424, -0.031602496895929748,
+            0.046517499401538459, 0.044282578134991327, -0.0203306486172165, -0.0037273983490285307,
+            0.01463592792569135, -0.002045062886013459, 0.012543747200319064, 0.017252965785493252,
+            -0.017649307234270242, -0.020814785884785893, 0.040740174482767018, 0.044223942326623841,
+            -0.0059321745970423436, -0.0009125619248124316, 0.010790767862331241, -0.002436801384324519,
+            -0.0052878459232059945, -0.00095451949288519753, 0.0025245174371925278, 0.012262297414193343,
+            0.031313182551957183, 0.038633444351809598, 0.0058562578783088659, -0.01062770928543811,
+            -0.0095906090378376843, 0.00046414989396808062, 0.015019431197490239, -0.023651962033798438,
+            0.029523866957039912, 0.17070735301587303, 0.1550103733665717, 0.039215658251983893,
+            0.097991235115475722, 0.11097846739388095, -0.036928786018404949, -0.091697831484960718,
+            0.048599899200094034, -0.031259811786733802, 0.032518302977081665, 0.19940827632338756,
+            0.082646928636015082, -0.12889473617748626, 0.1202352299424258, 0.22036103291197445,
+            -0.009296150568703955, -0.14150797337891563, 0.02938471352289505, -0.0013669174809931711,
+            -0.0047432709799008254, -0.016130738634387382, -0.11227623593183478, -0.1769955741758748,
+            -0.0035374311972506747, 0.079502915147271341, 0.03705712637012977, -0.025449872489556616,
+            -0.0087854471196539396, 0.0038473474437331293, -0.0033680779917140678, -0.021986333833201706,
+            0.0017486786134879549, 0.033490085860084472, -0.01389346312765264, -0.034307847943849626,
+            -0.0027094053851903039, 0.019397616137411183, -0.0095843471888964315, -0.0069315633177697792,
+            0.011815592857033251, 0.06277830894036282, 0.10488772137589711, 0.09941179428896435,
+            0.033230259521071136, -0.0033226686568532046, -0.030043940041123166, -0.016990671845201612,
+            -0.015018409455970414, -0.0134332737496086, 0.022094222032877094, 0.11842183888952405,
+            0.1881534433463469, 0.17030540092963631, 0.06325249870948145, 0.0026746496711087392,
+            -0.053337728532973028, -0.035440362144190884, -0.019901368243509517, -0.0074141652000030518,
+            0.014820690891525623, 0.075946066241363935, 0.15321485065588056, 0.16699341190902564,
+            0.038657266876162319, -0.028286530247832169, -0.045397616748340808, -0.011354969763367362,
+            -0.018949050863899142, 0.0058776015178696288, -0.0038952801536314835, -0.028549583277210265,
+            0.026170867702578642, 0.085909931575208098, -0.019441679864697164, -0.066579332757540258,
+            -0.011735778339963771, 0.033539610195074905, -0.008024946787096433, -0.0053246797525403466,
+            0.0092263131305947692, 0.048828871737174678, 0.083388854337068413, 0.080530359977810106,
+            0.025740514394148054, -0.0042502948241122558, -0.023989548285808734, -0.012583771524133147,
+            0.0052329639375568639, -0.0004908589928545251, -0.0058675360505493733, 0.0027350865913864674,
+            -0.012204236190917031, -0.006203716285672992, -0.01348063314197304, -0.016435874891745524,
+            0.00018752728128906379, 0.00099021389309407806, -0.0056849887295678881, 0.00075283837007576032,
+            0.0070508764677480081, 0.019600800136568695, 0.037510831181762579, 0.009546937925977092,
+            -0.0071501381037918669, 0.0026044138279800954, -0.0058937748196417079, -0.011244748706038785,
+            -0.0068361880514053704, 0.0025216022350297951, -0.0054193549702971928, -0.0018407255205791263,
+            0.0954895069741762, 0.0068891317290585546, 0.032212096934496476, 0.087788072518226484,
+            -0.0076388645791436371, -0.031202449823970847, 0.025449957862254301, -0.00020351555096643446,
+            -0.049918690894717642, -0.0474701617758801, -0.0089707839015800671, -0.039859815778022507,
+            0.017352007700506638, 0.061620999714617888, 0.0058717763826784406, -0.011180261328389094,
+            -0.015389178467746158, 0.0020837874214112528, 0.012660350883244648, -0.0088712103318274727,
+            0.062027596910990281, 0.017643292511952735, 0.046105142907667304, 0.072373026569743037,
+            -0.0027632149241686018, -0.012672888299729717, -0.028908764810766634, 0.003039970637324895,
+            0.032693417709431342, 0.011205869682872804, 0.098708792522506167, 0.037488951380302601,
+            0.049693496567126107, 0.075635457929566621, -0.0079395550525181817, -0.018455769744897779,
+            0.0026158521353296868, -0.00032946672416059157, -0.0029262515097554331, -0.0045793941179031383,
+            -0.013584150790925297, -0.0038205513701764617, -0.0012259917244640587, -0.0051486402077067844,
+            0.001690774444846767, 0.0035842898597457438, 0.013281440618278796, -0.0011304206874680704,
+            -0.017521844382202084, -0.01149010580865675, -0.038493400755402286, -0.018263898137589447,
+            -0.0138432477723366, -0.01858850348253285, 0.0040220768503197151, 0.0062105176920389535,
+            -0.014950812381318766, 9.7673376609593769e-05, 0.030041586228160545, 0.033591015236154154,
+            0.008173298572930178, 0.024184865041621467, -0.016377201542009813, -0.042856072024981519,
+            -0.0045985013012504999, 0.0052075556002242505, -0.035326006684850586, 0.00089321546704835024,
+            0.063813704752977721, 0.054007202649467421, 0.029962162578324226, 0.053292041904136875,
+            -0.0062674294746045333, -0.051199620829749194, -0.0078662610972528822, 0.0095195021512007802,
+            -0.0083237329684435254, 0.004638175938267498, -0.01142900471719014, 0.011448268371736238,
+            -0.02059670956623515, -0.036927841302046814, -0.10168712568528378, -0.058229253233127484,
+            0.0022659291841903768, -0.001859818705765315, -0.0042517594605409664, -0.0085446854054721973,
+            -0.054245714079219708, -0.022988780470762919, -0.0047089823142349475, -0.020644170143860347,
+            -0.08894129463935263, -0.042730113269940452, 0.0007158856466726387, -0.0077543037932380193,
+            0.0013170176601257171, -0.028431349172142475, -0.084085705837450231, -0.029040750830129559,
+            0.050463132469984406, 0.01816429533683761, -0.058404427001851875, -0.0059675604610317096,
+            0.00045396620796720258, -0.012387239376060132, -0.00038007992155795751, -0.0051226210722078039,
+            -0.041113275112035226, -0.034624259401706624, -0.012968470251080989, -0.010272983512653711,
+            -0.031617537679479911, -0.017150605492969234, -0.00099795250493627885, -0.0055119798120946981,
+            0.0063246427627235684, 0.0032988613162233706, 0.011102008556675794, -0.025294842784517532,
+            -0.012437135891392359, 0.016482447426448672, 0.085775690435083249, 0.038969023058894763,
+            -0.0029021885279491293, 0.0022111552884012927, 0.0093401029549518861, 0.004398821416837762,
+            0.02904655798607746, -0.020265301462706727, -0.005162872111462183, 0.030985290196569246,
+            0.13281274645209645, 0.064080478379159395, -0.0035335670249983979, 0.0048010299580940764,
+            -0.002628683453618171, 0.015569799887363258, 0.012952288537710889, -0.01631464101528074,
+            -0.054412952356531659, -0.03032376968144412, -0.0084485674224084421, -0.02373259113557339,
+            -0.0011198772758317897, 0.002497442700908045, -0.0083671043677333683, 0.026735988840479646,
+            0.079028612535497075, 0.060642887668985658, -0.038947702770025003, -0.036884735828721843,
+            -0.031263968232404675, -0.035821134013028541, 0.0027842834174687122, 0.010975365098597858,
+            -0.007331224847116939, 0.003487023597701101, 0.048270275907149662, 0.084338941720708771,
+            0.035738135104432162, -0.0048271633027432842, -0.059566321097584821, -0.022660401395249358,
+            0.0051616968066175188, 0.0055584005223422777, -0.0045533934073720339, 0.0033932561042964949,
+            0.015310654729372633, 0.030615156643912501, 0.0038789808622542842, -0.011964564836406125,
+            -0.043396366459473854, -0.022289117887060176, 0.0022034609868685291, 0.0017212154580440735,
+            0.0044642802584752492, 0.0063550982488568726, 0.026530961983887224, 0.018530955002469623,
+            -0.010753567277226733, -0.0074845835343870255, 0.0082721180667127102, 0.0025136483609251989,
+            0.014696068574474268, 0.011749180838298654, -0.0050800579280115971, -0.0078684613969245663,
+            -0.024140652069467784, -0.014454101572923077, 0.0089947960551750306, 0.0060682615895305929,
+            -0.0088084504744313386, -0.001609352687202551, -0.011582225692581206, -0.0099096496566848883,
+            -0.023560713905761754, -0.03951239697354969, -0.083275078548275469, -0.035585268691277448,
+            0.026343995964066867, 0.01653290844110842, -0.037985374619035908, -0.0015320747598219868,
+            -0.029340310795368304, -0.029552869257829559, -0.0062303146370718014, -0.009264631857086085,
+            -0.033268804878276437, -0.021741910329419682, 0.012993929975298543, 0.0089245197676557173,
+            -0.011168934280293244, -0.002731014453742916, -0.017316647663343815, -0.014247943716025536,
+            0.022469142229771991, 0.042277456933337489, 0.035754672146521845, -0.01393371348919638,
+            -0.0017252472221566013, 0.001905579166335168, 0.031861497152932274, -0.0075675902297558627,
+            -0.0091216345383580404, 0.0032114825704714304, 0.033438297000645253, 0.05941428020701512,
+            0.086485985061269893, 0.015747433802433767, -0.020399988216314176, -0.010632899459796043,
+            0.050741825600615388, -0.00438096029284386, 0.014702314393682274, 0.023811355517881969,
+            0.026153166277866943, 0.044045971989526554, 0.090671758221042065, 0.037564270270590991,
+            -0.028296148309293362, -0.017637147009114586, 0.041988471715020209, 0.0013354067058991231,
+            0.031067758979887807, 0.031794429624382524, 0.016206117312854568, 0.027264343808290382,
+            0.056463824551626754, 0.023581937682227733, -0.017683020405626283, -0.011041588561750273,
+            0.026046436831016703, 0.00088498709319846354, 0.019487738835943978, 0.019860793238124091,
+            -0.0063984415989257939, -0.011276735473211402, -0.017425394017136251, -0.0039739722759599781,
+            0.0043731215498634462, 0.0023892752829506015, -0.0097970634577717649, 0.0006571068518174657,
+            -0.003557895220240203, -0.005057476446416455, -0.020353328901724487, -0.036158557341563716,
+            -0.052698766616291096, -0.0096468170256138984, 0.012447248014034771, 0.0064948152127343988,
+            -0.030891313068862728, 0.0026549950573667757, -0.0089968101618209326, -0.014525715930674527,
+            0.023512883991708193, 0.063362827792507931, 0.080699111753112882, -0.069241717769724376,
+            -0.078415004820548639, -0.087509562950156133, -0.11640705400455387, 0.044084918857517925,
+            0.086118736809648641, 0.039291178642432645, 0.039913483053001651, 0.077796735826097363,
+            0.071231393809276414, -0.083074446883563052, -0.049812865654597999, -0.04726866811020896,
+            -0.11992612932873942, 0.030159957338735988, 0.089024262264477655, 0.054541422205247471,
+            0.040386479531021598, 0.057063594594543771, 0.024231520251409587, -0.058982858337004541,
+            0.010203690474295, 0.025861861482248869, -0.064830377972984757, -0.0019877331517708877,
+            0.048487425502128922, 0.046343182780818955, 0.060444505674647007, 0.058017022132848609,
+            -0.024242486056085616, -0.056562941272826329, 0.091921291388860848, 0.13190332533244412,
+            -0.025551153254867794, -0.044084370126168358, 0.019967340106081016, 0.058173810489782464,
+            0.06629665693819517, 0.077983006578297015, 0.0051122834397641474, -0.078654924907950563,
+            0.060662294376331492, 0.095845866243038785, -0.065473642774208418, -0.026814366085670907,
+            0.04945968718303527, 0.069666622421550667, 0.0430244647225516, 0.044384358881469625,
+            -0.010433790068856601, -0.043837138891168873, 0.056787791076209598, 0.083381434449496292,
+            -0.026246043464041548, -0.02674442627581167, 0.020143318649055462, 0.042669323626000552,
+            0.015139547486734645, 0.051585087048579351, 0.07579286842226618, -0.057074470354551966,
+            -0.080679613238250431, -0.093052765363403095, -0.10310477466925648, 0.044576989082714596,
+            0.07616813346142054, 0.029704592832147866, 0.010359347355916333, 0.033731445751964878,
+            0.048401892488317777, -0.03724020082252797, -0.050822710993330265, -0.058342948046412615,
+            -0.066463064951259879, 0.028151460641620506, 0.04911080984533437, 0.019685972873542481,
+            -0.0012643846659863862, 0.0083717779106687248, 0.021684736964911328, -0.009916459151250695,
+            -0.028749791764898322, -0.035377552863700659, -0.024482129795778185, 0.01531019291516692,
+            0.017992490624675294, 0.0026980736556387001, -0.01827015543265777, -0.020015618381533817,
+            0.0018501467484890316, 0.019967758569735778, -0.02084579694284544, -0.031432984123144603,
+            0.014193572267109267, 0.0096037089755386211, -0.010797073924641007, -0.018596388458079489,
+            0.02751589609481531, 0.027815814040210461, 0.019490145990429183, 0.0014073665650940429,
+            -0.016557102794487251, -0.012646962543566089, -0.0052999672154162205, -0.010200109225111484,
+            -0.0055645753283620047, -0.00058866327954809443, 0.029179024330711477, 0.0022645838870315009,
+            -0.015443471669968151, -0.0072584642182028404, 0.021009790534223326, 0.0081433047429893355,
+            -0.037953391546739546, -0.021497683924508796, 0.029583519100711209, 0.012315237078180262,
+            0.028058188899374843, -0.0005052816518198713, -0.021125614634817085, -0.0017440270077830257,
+            0.040555178962298329, 0.024995586989932254, -0.039224735996052466, -0.028321201611148122,
+            0.020997352600131247, 0.0083606758041667728, 0.040134049238296082, -0.016098241950106198,
+            -0.051598039610493515, -0.0052106277814402534, 0.08582424103270235, 0.05341108688532048,
+            -0.074195393734775086, -0.048947730653824885, 0.046075344859870762, 0.017529309192062373,
+            0.037767862394328992, -0.029961168367698576, -0.065375131627917415, -0.015995570385404702,
+            0.08455167691123075, 0.046365412076029996, -0.087881056580702804, -0.045020506447937661,
+            0.074026160352269124, 0.028473090022023882, 0.022585397996525022, -0.017361409549843956,
+            -0.038392981512961694, -0.0093085005701996851, 0.049988499887011803, 0.027480521338709887,
+            -0.051887915950180684, -0.026789473851988974, 0.043403413609301701, 0.016701934902848905,
+            0.0018967240030690318, -0.0078772285736660817, -0.0068857602224119182, -0.013727908130335295,
+            -0.016254825354695232, -0.01945798017536535, -0.012793228255204712, 0.0070070532512838124,
+            0.031545470175223869, 0.012941844084490908, -0.018292316601460499, -0.019254483506940395,
+            -0.0086616152077063739, -0.013087391830533493, -0.020234392284162996, -0.020359403591159925,
+            0.0017270190561016552, 0.019363357596535381, 0.02606605288437926, 0.010041044389245262,
+            -0.011914617052146767, -0.010978519953453853, -0.0041622941628075083, -0.0066918457121455882,
+            -0.011781452756095582, -0.011216269806524182, 0.0030799167717300356, 0.011785883948878844,
+            0.012553579753100858, 0.0047599250318896549, 0.0014918504328583302, 0.0030564079006134221,
+            0.0049652392937502773, -0.0035891186534873199, -0.014391135880141221, -0.012180122899441653,
+            0.00123952073421775, 0.0045580583155570278, 0.005153472992614541, 0.0024795388548824277,
+            0.010387069298288103, -0.0042409586675275224, -0.0040721560092940069, 0.016629102267356026,
+            0.013378163827019873, -0.031247113333279175, -0.051085648296208569, -0.044091720820842589,
+            -0.013622769333217526, -0.0061662487643684705, 0.0057851396435629867, -0.0023126035346269051,
+            -0.0012023247517509805, 0.010555741679989921, 0.0078960439495175689, -0.010456357703681937,
+            -0.021098611580508631, -0.023969679143562156, -0.0085720027349388654, -0.0034063136852064248,
+            0.00058229290292788425, -1.0437624960570133e-05, 0.0046730144225243754, 0.0068838700547453058,
+            0.0027965962362883155, 0.030198461788250312, 0.030957899464738061, 0.00023011044842933918,
+            -0.0052926042364710062, -0.00021682980841282841, 0.00032919698318472875, -8.7760184518524605e-05,
+            0.00087679000039150433, 0.0017484290842311025, 0.00084400375608037904, 0.0055665268659913321,
+            0.0053218711047161938, -0.00084291777312091743, -0.0013611750032426727, -0.00016898470249764134,
+            0.0078396991328246717, -0.0032778195120348659, -0.0047323192036306597, 0.010536581033324921,
+            0.0094045677139773798, -0.034397416529687475, -0.050004094067359374, -0.034192917364402373,
+            -0.008749055964421916, -0.0046976189029020229, 0.015625841279535185, -0.0059926916254121471,
+            0.0022233317499792409, 0.035154644319168898, 0.023611909770538817, 0.007419951261407997,
+            -0.01923604715028138, -0.061727011405879842, -0.028208443990325707, -0.0090567398158136313,
+            0.0085468717055982857, -0.0034233814569941032, -0.00192245372805754, 0.015417401362123237,
+            0.011604456434534822, -0.016400819833059351, -0.032179324589611799, -0.035492986835935485,
+            -0.012529083983439779, -0.005036274974686345, -0.0013111413345417932, 0.00030122964491375919,
+            -0.0045337073198597018, -0.0082285263390730647, -0.0037964712606463214, -0.02896043240842763,
+            -0.02838373863012042, 0.0027830326979590547, 0.0063838040757632246, 0.00064565880996823063,
+            -0.015994537215833708, 0.0064024330776757269, 0.003510301462175056, -0.02895806565588387,
+            -0.021752952258712117, 0.030122863568683458, 0.059617253497601712, 0.066373091500988482,
+            0.023527536233569971, 0.0094225421743894221, -0.012151373152120198, 0.0048148938121214818,
+            0.0016067553856104829, -0.023287298503591132, -0.016968817651562926, 0.015974513859695241,
+            0.037977198976178225, 0.049840597827900228, 0.018853895618740388, 0.0071306277782558413,
+            -0.00011143613164859775, -0.019355447882354437, -0.016062033835487301, 0.0086895739419096483,
+            0.018235420097622839, 0.0043165315465305588, -0.042122969591014664, -0.044549739842101144,
+            -0.0075990506654964509, -0.012121891875485468, -0.012288289945185927, -0.014616920066480119,
+            0.023381832885430213, 0.011569622611098063, -0.021015437911905511, 0.044240680804986346,
+            0.089443245136937286, 0.0064915146775388066, -0.020699462198478458, -0.014883093446483699,
+            -0.022093819082010715, -0.0064446660278493842, 0.058832600787361369, 0.011943258464832372,
+            -0.056798477525143415, 0.075502650123124002, 0.20511841559435987, 0.057702682699990251,
+            -0.029569054274873604, -0.014389965852015404, -0.0014393797084921371, 0.01533719473455632,
+            0.017172754637853355, -0.0062587777263156726, -0.018804174216138916, 0.0017094756438393102,
+            0.048556339073600109, 0.040325033176380046, 0.0041487121865996356, 0.0088882274773608872,
+            0.0071901036385802718, -0.00069377640675842317, -0.021509129787237916, -0.0026402934435647042,
+            0.021159606924242867, -0.024002717502087399, -0.072986604847900191, -0.025255489970242365,
+            0.0085467071151213193, 0.0029425402212605641, -0.0074676341550140093, -0.030019235902421185,
+            -0.0036848979482404691, 0.016470133573248544, 0.0074891095009024158, 0.031190304616133074,
+            0.0071468893666973964, -0.0451043683246568, -0.02072824924275635, -0.022224697892737975,
+            -0.0080554133120436643, -0.031721047659180088, -0.0034153279170967901, 0.017471304807165102,
+            0.0074449724799076555, 0.033510665590775666, 0.0091857776529590835, -0.047120607131767071,
+            -0.022104924040425872, -0.023561819853437232, 0.0025976330984365335, -0.021320035529606644,
+            -0.02560810632940104, 0.0084553890266798378, 0.027840465405496333, -0.00438024533808987,
+            -0.07342672850217126, -0.058017855205175224, -0.005035503685248641, -0.012075275332542969,
+            -0.0058665903760627179, -0.0056593629444696598, 0.012279410385262741, 0.0049344678209456167,
+            -0.011297313220743723, 0.020852435734938213, 0.045647223802951636, 0.0061598770917284749,
+            -0.0093736778129639153, -0.0062829212440667324, -0.0035949503572488273, 0.012971482001208788,
+            0.021442230395840041, -0.0043178482376575907, -0.02268074809337594, 0.0094296298986989522,
+            0.06468915969047398, 0.041924016617037124, 0.00059415075136581494, 0.0064011640516885362,
+            -0.044696755751513967, -0.18101109484800093, -0.15343177602090902, -0.053151860359636989,
+            -0.057030250924080442, -0.065557005546580407, -0.057294143402506964, -0.16046867704652634,
+            -0.1554386000315946, -0.073911723383550509, -0.03723114997072742, -0.11643109056788196,
+            -0.087146816152180298, -0.026996720337544279, -0.03017369657134486, -0.029932456934430807,
+            -0.02249022360363662, -0.097167494881482769, -0.098725722468766874, -0.05123405810502913,
+            -0.017355955355324991, -0.0013068603648780895, 0.022078251950770809, 0.014060545656290982,
+            0.012662228676518818, 0.024100487868475833, 0.028432692476638835, 0.010992596452805262,
+            0.0014012526287452386, -0.0079488189494052904, 0.0011618387226603483, -0.047488036875556167,
+            -0.057796000753720114, -0.024873398091659383, -0.024854058457944073, -0.035792222658375131,
+            -0.03685723597109742, -0.051292755408981261, -0.042688484777998366, -0.01378004599572768,
+            0.0035262262965173475, -0.040037339192486823, -0.052194605932501394, -0.023130448348007662,
+            -0.02290926438234122, -0.033850632037415625, -0.035387345927663599, -0.045061853306639907,
+            -0.03636811039328311, -0.010509347460521526, -0.0065490806790179292, -0.097934520396739541,
+            -0.10701632508630469, -0.043710852848527999, -0.044390600219972438, -0.060909147347064381,
+            -0.060861762618090912, -0.099399723337351809, -0.086711183113988552, -0.032312715052080249,
+            -0.006601453220633928, -0.10095721494715125, -0.11052318232677115, -0.045186962320487599,
+            -0.04587564151209763, -0.063005134092836604, -0.062993852316452312, -0.10257447686818585,
+            -0.089409662791816266, -0.033244832575152906, 0.0062754885669967352, -0.068159603206247019,
+            -0.089226992748052944, -0.039608325210234802, -0.039209863964426536, -0.058020391750559605,
+            -0.060704831991805902, -0.07690769164477243, -0.061953466487164224, -0.01777252083892248,
+            -0.0028379006827144518, -0.08636463671361852, -0.098372078654663977, -0.041037894808947553,
+            -0.041401019027252552, -0.057951289176907179, -0.058646326901853098, -0.089752273805072752,
+            -0.0769024018587431, -0.027216533384693969, -0.012672238496356172, -0.031251765070766789,
+            -0.019744922744125509, -0.0049746113473993362, -0.0060428704256482828, -0.0041695097936318235,
+            -0.0014999527467955617, -0.024170097194444504, -0.026102516312116415, -0.014918159590728609,
+            -0.008005195737773866, -0.029951024145293534, -0.021965547206931779, 0.022050877098383784,
+            0.0060265073105344189, -0.0010182939332700411, 0.030862558411085102, 0.0073557572639544426,
+            -0.039044334131926754, -0.032082894409312904, -0.010253706637260163, -0.028786552693922295,
+            -0.0044875220973749456, 0.069316952948891522, 0.012375337515600014, -0.018153605733796818,
+            0.040997787670902675, 0.039402282232004822, -0.033799582437097242, -0.041773032906618893,
+            -0.017164804830295172, -0.029844878677860037, 0.037782730179549778, 0.19470732714463182,
+            0.029634723246885254, -0.062662450542099679, 0.071439648586561391, 0.12338432555189398,
+            -0.0255291654381084, -0.071228348494679211, -0.0080372538820330502, -0.01657614594512806,
+            0.011267649917878481, 0.080012785863320252, 0.01261137564577039, -0.024764090617319635,
+            0.03305255729963423, 0.049629536991732927, -0.01635755077301684, -0.033167635036385167,
+            -0.0051225801003404754, -0.0076029322228493455, 0.014495077432339819, 0.063699062760425806,
+            0.0094779186566069235, -0.020994523671215928, 0.021519747518715805, 0.040903724829841684,
+            -0.0054117668596586361, -0.021349429441117437, 0.0038170681335128577, 0.0064079308559031375,
+            -0.0089672326918783535, -0.04428021130606348, -0.0067013830830978133, 0.014337436938467401,
+            -0.015921628466761456, -0.028154466495204186, 0.0052896449330140684, 0.015855809567306516,
+            0.0013575643590916908, -0.003239641530270859, -0.016815831057637079, -0.03941575344982351,
+            -0.0050663795633196507, 0.014808296722054424, -0.0065076768823796082, -0.027288988582059422,
+            -0.0074603316541910283, 0.0060302777510390301, 0.0023873051172215525, 0.0034060001394950858,
+            -0.0070940877614483044, -0.030274590331514809, -0.0044837686464234121, 0.010025642077929792,
+            -0.010049984843948756, -0.019492205186685995, 0.0022897697713799596, 0.0099593207566966279,
+            -0.0026417672787479012, -0.0078292610096159232, -0.0021751654904277268, 0.016088994270774669,
+            0.0029877499692992546, -0.0039510501044189095, 0.010499486194887161, 0.0088597330763112887,
+            -0.0094067014750222767, -0.010733170066080929, -0.0037262251626919824, -0.0092270837586933621,
+            0.0014162623823539746, 0.030482199429686142, 0.0050971753510329811, -0.0087681221207758751,
+            0.015087670214554327, 0.018181912683595602, -0.010193979100926821, -0.015267879672565156,
+            -0.014056652174450242, -0.021134766338202625, -0.040003482823556417, -0.047350621421318947,
+            -0.042077415721001654, -0.0062387243989555537, -0.0036468785460407856, -0.0029297893177695424,
+            -0.033815435862456507, -0.015409646659337788, -0.01436659719513288, -0.023856577810727624,
+            -0.039210041875372456, -0.0092912027720435907, 0.029599449240019046, -0.010575543599384571,
+            -0.020096137769215122, -0.0034469431021801559, -0.038678446821116166, -0.019728621550749715,
+            -0.00212920101363519, -0.0053097246747743285, -0.0044934282154585233, 0.029375770502751024,
+            0.061486416079167175, -0.0048698362926590591, -0.015851558328268039, -0.0008667623309876471,
+            -0.0089704424196773297, -0.0060533022714074304, 0.0031856320842616088, 0.0057737374366133454,
+            0.0083350362564340672, -0.0063264396556172546, -0.022135118917981211, 0.0032456376021542145,
+            0.0079667767096815688, 0.00086138160559005742, 0.0094595835544397239, 0.0052280330412714212,
+            -0.007615607218798756, -0.010893161038138794, -0.022086951813321248, -0.035312894576153137,
+            -0.040731397615112422, -0.0023427182491285695, 0.0020676077770629443, -0.0014755110195459836,
+            -0.01730344019252375, -0.0073656957836120834, -0.012762285753515422, -0.021415759072960873,
+            -0.034665665355553682, -0.0043839603542270462, 0.033479080790883457, -0.0098101377247714616,
+            -0.019471879301414762, -0.0031068093394673695, -0.034766700843032378, -0.017919318305518864,
+            -0.026524135036944178, -0.041626134020680265, -0.074187547551111704, -0.059081975577729713,
+            -0.023201847439013705, -0.015022353357364123, -0.019550932571667002, -0.0058786278899816725,
+            -0.066994737311863894, -0.032157056283382224, -0.01843792402984263, -0.02766640654777101,
+            -0.052513472575538671, -0.063076210964700619, -0.056987901346641293, -0.008079404300998877,
+            -0.0043787604645421172, -0.0038317741156719681, -0.044253435158030867, -0.020114223365606615,
+            -0.0099926695549095203, -0.015944409935145655, -0.027754549688487617, -0.017712762075750364,
+            -0.0003008780265775033, -0.006147658529027082, -0.0092684420232968245, -0.0022673153633851061,
+            -0.025718152807170328, -0.012577383523215276, 0.01747975831838456, 0.026972612552818215,
+            0.049231926169008039, 0.046902204793007968, 0.03008178172661476, 0.0090444332057747594,
+            0.0095495657324514826, 0.0037818973282558658, 0.043311604904653488, 0.020381262712340486,
+            0.0074187109669772346, 0.0081818110997927303, -0.033327480121780377, -0.069593355825426959,
+            -0.059737063727494925, -0.0016910391043181068, 0.045181021466951021, -0.010068647500525637,
+            -0.01107968127924204, 0.0072274625217227488, 0.0018158690529887971, 0.0020026521641895692,
+            -0.0081575276401283734, -0.017034282869294887, -0.014621769984304403, -0.0004139136287413968,
+            0.011058904846064831, -0.0024644908641193609, -0.0027119603987150031, 0.0017690573986844718,
+            -0.0060229305344514936, -0.0066424585240492766, 0.027057139515920994, 0.05649983530315341,
+            0.048497938087133999, 0.0013728815021484693, -0.036680517003870323, 0.008174299381857918,
+            0.0089951139740826955, -0.0058676641942858035, 5.6440224330914225e-05, 6.2245753468627183e-05,
+            -0.000253549499748713, -0.00052945378681178731, -0.00045446888181218433, -1.2865122637194539e-05,
+            0.00034372911931000586, -7.6600466869261382e-05, -8.429223077958072e-05, 5.4985240412393968e-05,
+            0.0098058552318915082, 0.010814500731511885, -0.044051378571374283, -0.091986650425296773,
+            -0.078958865158318292, -0.0022351706006909222, 0.059719074877831631, -0.0133084710013078,
+            -0.014644828612862626, 0.0095530681135042907, 0.0056832929890830589, 0.006267885333238736,
+            -0.025531367236577319, -0.053313767446929755, -0.045763103183572462, -0.0012954636902038892,
+            0.034612075289861051, -0.0077133445424686286, -0.0084878727875885903, 0.0055367822336531676,
+            0.0075981595010851718, 0.0083797179888387228, -0.034133626564199562, -0.071276724505257516,
+            -0.061182022099040591, -0.0017319430416381945, 0.046273888962103896, -0.010312194397346588,
+            -0.011347683708881545, 0.0074022850159021717, 0.004018281300945903, 0.0044316079567613175,
+            -0.018051544368975728, -0.037694645556103912, -0.032356069298034862, -0.00091593685780407474,
+            0.02447191358800942, -0.0054535967444035377, -0.0060012145375383102, 0.0039146932174066139,
+            -0.011061303029973952, -0.01219908584006836, 0.049691295225463013, 0.1037637402352533,
+            0.089068002103324745, 0.0025213404392838523, -0.067364933325247456, 0.015012360179693417,
+            0.016519812222198109, -0.010776151469765212, -0.0068230702941135483, -0.0075249019021683614,
+            0.030651651022499966, 0.064005776867948144, 0.054940836324657606, 0.0015552673139870908,
+            -0.041553483725282059, 0.0092602461490326332, 0.010190105065576461, -0.0066471769898158381,
+            3.3162451109113381e-05, 0.029553818169967445, -6.7323861596723863e-05, -0.04224525882073548,
+            0.0036814908710348935, 0.03398767484873487, 0.0049150126096849309, -0.014534575226535802,
+            -0.010710060661400785, 0.023977497796688882, -0.0041363576296418346, 0.029186459012065912,
+            0.014808356013928905, -0.032878466754883137, -0.0042892362062315901, 0.014560817739813249,
+            -0.0073275157690318978, -0.014787015295158211, -0.0086695994315327506, 0.011587945534477409,
+            0.000126483922852669, 0.037099623415933994, -0.00038726253315524151, -0.053211451683413069,
+            0.0047827622798849671, 0.043052349296425194, 0.0064178643342587697, -0.018236789067998787,
+            -0.013483418584728775, 0.030345633195740081, 0.0064592503878982375, 0.0543100673602398,
+            -0.02295206554006108, -0.091201980912533384, 0.018927757820904469, 0.091623951084768188,
+            0.027726940280094595, -0.026045017080212108, -0.022608696581337857, 0.062619425206306437,
+            -0.0026344565574525289, 0.074518050608953529, 0.0095279855820033753, -0.10075432055195779,
+            0.0041159160607999994, 0.073307718621915569, 0.0044511329965282731, -0.036930362900820531,
+            -0.025761231953418871, 0.052574590518947355, -0.00032340007790903008, 0.042348724627558024,
+            0.0012269233717929866, -0.059748112872236539, 0.0045702669503514624, 0.047011362972012159,
+            0.0059591323442138924, -0.020865646411966803, -0.015177136742975, 0.033282450762942291,
+            -0.013630304986458855, 0.04203722788081992, 0.048703718700935462, -0.031082841775852951,
+            -0.02076267451828688, -0.014003222939256743, -0.032972194736007432, -0.022094802540128335,
+            -0.0089766109008436144, -0.0055627769676087164, -0.02378531311647936, 0.035440846890330224,
+            0.08492410525752167, -0.00013310983908893653, -0.04087374115759293, -0.067845897315227124,
+            -0.063718823946356071, -0.019904883873099792, -0.0019436884682425236, -0.040345252505696448,
+            -0.012452892684111516, 0.0064003325681983372, 0.044441370418308972, 0.017275965589127425,
+            -0.022887798457493318, -0.049437221454053576, -0.035341826490710604, -0.0044420988898908852,
+            0.0033809559166828188, -0.030944793642324185, -0.0047758220959355528, -0.0030167657328823583,
+            0.017034316244007908, 0.014433462333158981, -0.0094476161565962783, -0.025223949208591848,
+            -0.014445970208081617, 0.00098786196303410605, 0.0032766025944947954, -0.01628887216602587,
+            0.0014889418615194514, 0.013925540146180616, -0.013906572653587929, 0.024310985888419217,
+            -0.011304711433950315, -0.1195491623689008, -0.13481019661148852, -0.075770314907027028,
+            -0.0031723788049885472, 0.029203543513649798, 0.0020934778466385816, 0.019579548773486121,
+            -0.019552880152920539, 0.034181663974046261, -0.01589461856184617, -0.16808817689368394,
+            -0.18954545331886746, -0.10653436496762633, -0.0044604191211414469, 0.041060684079888776,
+            0.0005496278773142614, 0.0051404727537105333, -0.0051334710950419714, 0.0089741553479012436,
+            -0.0041730202566483496, -0.044130368045709308, -0.049763824981236646, -0.027969847864498607,
+            -0.0011710516533152292, 0.010780193670612516, -0.00092304647717390397, -0.0086329232234484167,
+            0.0086211646197910281, -0.015071219676791051, 0.0070081810003829173, 0.074112654110681228,
+            0.08357349624274113, 0.046972634766219823, 0.0019666671720933301, -0.018104285102012431,
+            -0.00064660834824840604, -0.0060474963765205971, 0.006039259292607021, -0.010557622722460944,
+            0.0049093392943307945, 0.051917061647356731, 0.058544528037543314, 0.032905057903534721,
+            0.0013776808028075575, -0.012682332012004392, -0.0014757393115602398, -0.013802061423310042,
+            0.013783262116779571, -0.024095418703396963, 0.011204471779643807, 0.11848911171847003,
+            0.13361482532012192, 0.075098454310022683, 0.0031442491037927843, -0.028944593683445208,
+            -0.0013265559019013844, -0.012406802404782299, 0.012389903531902587, -0.021659597761871693,
+            0.010071804722244317, 0.10651097333377006, 0.12010761909061944, 0.067506704611199522,
+            0.0028263949960610608, -0.026018566611413614, -0.0013764395891185501, -0.012873346671509588,
+            0.01285581233495447, -0.022474083301798189, 0.010450543948956646, 0.11051620226634816,
+            0.12462413505087962, 0.070045220578042675, 0.0029326784958620014, -0.026996966418630509,
+            -0.00089702859268538961, -0.0083895872649887918, 0.0083781601007543016, -0.014646407641483431,
+            0.0068106416042077334, 0.072023642862089857, 0.081217812509239082, 0.045648618461850754,
+            0.0019112327811106134, -0.017593980138850163, 0.00078884769649396717, 0.007377810074826306,
+            -0.0073677610170177366, 0.012880063159757101, -0.0059892839369163108, -0.063337651918962221,
+            -0.07142301241523813, -0.040143433348052142, -0.0016807397101238713, 0.015472160885244227,
+            -0.03154181439775057, 0.032309592057491926, 0.056593773471933145, 0.035361281713218819,
+            -0.014888224824942816, -0.061264833841558404, -0.053789332067333814, -0.0063960194466077067,
+            6.4772179989114158e-05, 0.011090023316406737, -0.022369286124181535, -0.057550168072134304,
+            -0.0088308819190574071, 0.099266294867227295, 0.1123219914740312, 0.03526473902903373,
+            0.0046009050763265551, -0.0035099466970306991, 0.011870279835600754, -0.013627146949007171,
+            -0.019131455628155148, -0.042922119005270987, -0.0037199821962768734, 0.079091270910438563,
+            0.086446034997742893, 0.023999397754519886, 0.00058902733624238181, -0.0030822131406750886,
+            0.0092266213097887823, -0.0099724858405983389, -0.011974892625267602, -0.042307716189088032,
+            -0.011725531129787432, 0.063742610501738475, 0.077690569812338212, 0.030127537524367903,
+            0.0085723364372691669, -0.0017323287800193547, 0.0080443663411596689, -0.01036654057352077,
+            0.035788374118508361, -0.044147575112601867, -0.06877005265895364, -0.033218033665504548,
+            0.028328060502856613, 0.076838233642307435, 0.065009307390540214, 0.007352620485604611,
+            0.00102689246695228, -0.014583182163638967, 0.079315231789007373, -0.11953944576970466,
+            -0.16561483647640177, -0.053612793384000275, 0.095918072434837159, 0.1915173748671932,
+            0.15560315201059188, 0.016571787358553719, 0.0054644400990548157, -0.038115345997011947,
+            0.078508718893866999, -0.094956778271254871, -0.14971056203871302, -0.074612277853556494,
+            0.059257580337381897, 0.1667111650995991, 0.14160667238810667, 0.016105300341115743,
+            0.0019750265229830288, -0.031486349125016695, 0.057421797547385314, -0.009934436175018907,
+            -0.073279472992499983, -0.10944748962358261, -0.047550966225832256, 0.063710899836199347,
+            0.071952209429236122, 0.011020555480237615, -0.0073016831803424196, -0.0071320240207814961,
+            0.030598522459987156, 0.044462930946432944, -0.0087688597325011833, -0.10419761037690871,
+            -0.10132466980072219, -0.014724430387988506, 0.011907178004105037, 0.0052380583207779332,
+            -0.01120272201684264, 0.0094896873610470361, -0.0015773276532874171, 0.012647033972394337,
+            0.0095432927888120678, -0.0084026073279897303, -0.017591005422767689, -0.013855022858547509,
+            -0.0085504652958257321, -0.00046052026327835101, -0.0016178347918873025, 0.0035010764716210466,
+            0.037088831651157159, 0.0099325369524953036, -0.054600769669249392, -0.15551346262029014,
+            -0.17604610280511543, -0.040016274742810554, 0.020362948614302098, -0.016595215263122444,
+            -0.00069945420541302574, -0.00057204312270297349, 0.05211534104660321, 0.013956696064356384,
+            -0.076722226234677851, -0.21851961307445872, -0.24737103540784391, -0.056228835279880811,
+            0.028612980363745169, -0.023318752968926097, -0.00098283749686257351, -0.00080380591962106787,
+            0.013607447175879389, 0.0036441285930702283, -0.020032367048517907, -0.05705602289247818,
+            -0.064589202134257589, -0.014681490909711154, 0.0074709214412694283, -0.0060885852967611769,
+            -0.00025662135280035133, -0.00020987575579946703, -0.02533851173227071, -0.0067857544413686705,
+            0.037302394852120439, 0.10624437389111778, 0.12027195365181527, 0.027338495226522951,
+            -0.013911649124461471, 0.011337592421331144, 0.00047785621172272987, 0.00039081094579375452,
+            -0.027503806393940265, -0.0073656289826418697, 0.040490059435353165, 0.11532345391166506,
+            0.13054975615034053, 0.029674697857424819, -0.015100464785874308, 0.012306442865488368,
+            0.00051869126609457319, 0.00042420757396160043, -0.038729488937315787, -0.010371911513398811,
+            0.057016083029084716, 0.16239273824545739, 0.18383365793717452, 0.041786430064477832,
+            -0.021263721664420171, 0.017329319294570503, 0.00073039518110184533, 0.000597347956408359,
+            -0.02518871755691535, -0.0067456389641279832, 0.037081873554946659, 0.10561628694815428,
+            0.11956093959124174, 0.027176877709630749, -0.013829407356260939, 0.01127056775448358,
+            0.00047503125981040897, 0.00038850058108237857, -0.031866985925950018, -0.0085341058529750432,
+            0.046913366669551669, 0.13361826469025273, 0.15126005405548901, 0.034382265692057934,
+            -0.017495989170167425, 0.014258726082344369, 0.00060097599000663105, 0.00049150348848056558,
+            -0.01924659227414496, -0.0051543141280534534, 0.028334102340097755, 0.080700956998191756,
+            0.091356006951395854, 0.02076573701617291, -0.010566991518229988, 0.0086117930291023277,
+            0.00036296937128243377, 0.00029685164659397681, 0.02194590620092382, 0.0058772011571270625,
+            -0.032307929808358039, -0.092019179675056698, -0.10416858895793002, -0.023678109363920015,
+            0.012049000746826247, -0.0098195877663151375, -0.00041387543636352443, -0.00033848477169086914,
+            0.007283698665086354, 0.0059653322613661321, -0.0028150090684206583, -0.01847386344601919,
+            -0.047681674574051661, -0.026926735956028267, 0.0017518143705859096, 0.033156275619709047,
+            0.023668351904630357, -0.0057748101059588199, -0.01438881082246584, -0.0043038247347239808,
+            0.032309678574125353, 0.0066154459330533943, 0.011653313027439674, 0.066031665490814448,
+            0.077498595210617652, 0.023611296222964678, -0.0046542591846240825, -0.016265449146057244,
+            -0.011807143491070659, -0.0031848677663020605, 0.027752531095911085, 0.0040434560250667143,
+            0.0057363289375447421, 0.054779255295757008, 0.067346459971844561, 0.023505583628414525,
+            -0.0018675700719945891, -0.014629855635664595, -0.0084427549474806306, -0.0029923796309087526,
+            0.017287831828046558, 0.0057472823303631442, 0.01199139454751815, 0.037943023476027016,
+            0.040417989350639415, 0.0082901927597035154, -0.0053597105083396483, -0.0078160033703968349,
+            -0.0033547464142860521, -0.0060511452926359389, -0.010516361298012273, 0.02170422393166916,
+            0.058413566498574834, 0.0067322233458185672, -0.036560554497431674, -0.054624878515207045,
+            -0.02949462000532737, 0.014881099018124353, -0.019630645275825621, -0.017223118793846203,
+            0.0034902500075654321, 0.054365875287137377, 0.14115048251027651, 0.070605308603542222,
+            -0.017120478914572832, -0.10300858594259914, -0.070237737424322239, 0.019802217978744638,
+            -0.019032477713896514, -0.015233193984767687, 0.0086227920954205142, 0.046857236514198479,
+            0.1206833179304939, 0.07096836635640133, -0.00074242681838617049, -0.082416881227198369,
+            -0.059851554364208644, 0.013778801121284979, 0.00015901656965365031, -0.0036109107707896319,
+            -0.013438858178599324, 0.014539764083684707, 0.040238939518452914, -0.007008529944830616,
+            -0.040450655195311332, -0.043841784899293114, -0.020539158441237434, 0.013713831466430234,
+            0.0093245789546971009, 0.0019933499730999411, -0.02378336999736411, -0.0011088037125135002,
+            0.0012281085300268886, -0.044157042177204071, -0.058834201401522089, -0.024779971054021001,
+            -0.0014622830982440544, 0.01348437908191074, -0.0015363761411035172, -0.00091210553644579672,
+            0.0018316436331837151, 0.0025140143358810944, 0.0062378688829832834, 0.0062738809583716615,
+            0.0033770818323379183, -0.0028699339456579524, -0.0030440644921371656, -6.2560312144984039e-05,
+            3.2744957766996508,
+            -0.0038743017807603211, -2.4899098070635698e-05, -0.003362962255067234, -0.014885808402163686,
+            -0.003661700969493864, -0.0052638197606249158, -0.0051404394970038271, 0.00206992618148172,
+            0.0016890662009595833, -0.0047036357228366675, -0.011181458352515199, 0.020772906676940303,
+            0.049394532412376728, 0.0097495595361220735, 0.017619897592659989, 0.010360849932942142,
+            -0.0141405676472458, -0.027869840586619638, -0.024602789337836477, -0.016643090752295673,
+            -0.011396922652165147, 0.016996212159939957, 0.038503538603841182, -0.00062504794688289251,
+            0.012311014158341214, 0.0054401495420771506, -0.014552328548073597, -0.021625094511270222,
+            -0.019170017030623671, -0.01634899215489493, -0.0038794266575256399, -0.0029319318054124503,
+            -0.011609497183752588, -0.022256526947801718, -0.0075975966590439703, -0.0088343255244019113,
+            -0.0052441687069376556, 0.0067924974414812706, 0.0058022209076385731, -0.0042819783469426886,
+            -0.0099002556837388452, 0.011576284760760256, 0.024408522749047291, -0.0086044424247086124,
+            0.006383333374930248, 0.0008177921897210812, -0.012747584660869388, -0.013609255941200054,
+            -0.012144346097968045, -0.013732777176133002, -0.016490949084659631, 0.028024878701417004,
+            0.065443739291057221, 0.0077740726554876988, 0.022454539052843437, 0.01207876295317474,
+            -0.020942277945685806, -0.036862909334856864, -0.032591626173205594, -0.024161567545132781,
+            -0.0063995721406431257, 0.0026385307079173216, 0.0020425759888714427, -0.017812236420547384,
+            -0.0024247723764601269, -0.0054099206675408953, -0.0084016294001370943, -0.0009316162490548049,
+            -0.00099942782689469312, -0.0081638832046683138, -4.0414446306236661e-05, -0.0092538657425224602,
+            -0.02627141573486386, -0.023555183809441119, -0.012551581525215006, -0.011398433037260892,
+            -0.00036216952364395445, 0.015045837249767867, 0.013103563967444012, 0.001312966293944071,
+            -0.0011115511514980256, -0.0042595597582650042, -0.013021531239894931, -0.015024019321629962,
+            -0.0068009750132676638, -0.006723029044084828, -0.0016166009997170914, 0.0074981335787018934,
+            0.0064981339880705469, -0.00072357986395842847, -0.00034006294224183786, -0.0023515108062731214,
+            -0.006956117623865876, -0.0072474045497406868, -0.0034983270553861101, -0.0033419446421204292,
+            -0.00052953159952093525, 0.0039960731861750087, 0.0034705437340226079, -6.7061327577167418e-05,
+            -0.046469030572384572, -0.022273304765704469, 0.10081455765676214, 0.1011290160107009,
+            0.072677768508269, 0.0022632214625970355, 0.0077811165728631374, -0.0020883217944477409,
+            -0.041989930820369649, -0.04160387996110302, -0.051550830878487157, -0.025533732182506871,
+            0.10206031389641831, 0.097167349262927194, 0.088149363784528617, 0.0040834192862001985,
+            0.0046253646480506408, -0.0049060072667814862, -0.047637265671843405, -0.04177182124721851,
+            0.001343194449438475, 0.0028760048714834515, 0.023556834045546798, 0.037736565465045488,
+            -0.022466151903392895, -0.0043224736591473212, 0.010620600872146474, 0.0070692454443075023,
+            0.0040704414358593002, -0.010658359350631131, -0.082713751881001746, -0.045642299399537754,
+            0.10833849205479153, 0.070782671830927915, 0.18407238982347499, 0.015464241787076342,
+            -0.015284198975131304, -0.022545181313130935, -0.08241508279970515, -0.042191796702993722,
+            -0.13042235131789873, -0.071115556802046384, 0.18094078661247259, 0.12714411276651344,
+            0.28246293297995095, 0.022757422132388114, -0.019956322649365692, -0.032871215822744632,
+            -0.12885996579660219, -0.071059297258662849, -0.077527394301544872, -0.044711445745169269,
+            0.078645869140575225, 0.031170379045685696, 0.19014835418182077, 0.018177302845535599,
+            -0.023708116661275588, -0.027194809916127119, -0.079718750070273278, -0.029285576545015082,
+            0.0060991779051275223, -0.0024246007125974019, -0.076652839172362069, -0.11068860347009893,
+            0.039253571470517494, 0.0099022727283655087, -0.0270056751122488, -0.016518233784726534,
+            -0.0013330195651287506, 0.033877784630774836, 0.048125005567769635, 0.022199755224139917,
+            -0.11469204861700669, -0.12053055822607832, -0.0673550659096393, -0.00068986152512328681,
+            -0.012272261107711563, -0.00056045048296609473, 0.042376355679136529, 0.047694857831382304,
+            0.065066581453724057, 0.032797922176751586, -0.12206312680521082, -0.11226616632687597,
+            -0.11645809926242745, -0.006240469754791078, -0.0030701612831411911, 0.0079810230188455192,
+            0.060856011534694235, 0.049696642643753036, 0.02263980937258557, 0.01087647537353866,
+            -0.048822085441844063, -0.048817176792575009, -0.035635703730663507, -0.0011500848335267294,
+            -0.0036701191258105984, 0.0010955383921021113, 0.020489416433013202, 0.020137325294348841,
+            0.013241668833221591, -0.0024126138674216389, 0.0050955440671139147, 0.020286196161568626,
+            0.0084941126375071424, 0.0048226522318505312, -0.02379111362999432, -0.0097797523524737386,
+            -0.045810661238951035, -0.082638853806271173, 0.00027276759907155206, -0.001759037977610792,
+            -0.0023527248513732059, 0.0030603069511964945, -0.0045121234215510751, 0.0073856806399931509,
+            -0.016787306332319136, -0.017579046958477181, -0.023528011251529316, -0.029738592707598422,
+            0.00069965280355303427, -0.00052910100605832303, -0.00030822236622130462, 0.0016927287528386817,
+            -0.00065247107691799428, 0.0019668077998335433, -0.0050862402684787459, -0.0045997603820624022,
+            -0.0077269085638540262, -0.010953793527004478, 0.0039785181372350006, 0.0019748910537975102,
+            0.0054127099723955035, 0.0019215655213753085, 0.0099550012776022153, -0.010059224715103917,
+            0.018592077366269239, 0.02450820393335159, 0.021906230751804371, 0.019451974904748925,
+            0.016410690720103059, 0.0027329044814507308, 0.014543418316385958, 0.016294219140824972,
+            0.026219442310746674, -0.018418007511319601, 0.02507864594374213, 0.046060314341381248,
+            0.018838759732787248, -0.008549971684147159, 0.010166760581227143, -0.0025590013341649865,
+            0.0028962898707435348, 0.016667810835286227, 0.0045840373900234493, 0.0067148930629717749,
+            -0.025003652905872562, -0.014692549730728699, -0.044509000945225377, -0.075038956681051955,
+            -0.0086452106522413794, -0.0035237674427469469, -0.010657991127400056, -0.0053621491550083448,
+            -0.019527101690507413, 0.018586329533869, -0.033081446267070685, -0.04545186605704734,
+            -0.037459641645981215, -0.029678293318007282, 0.011093175262142992, -0.0038413795641983055,
+            0.0016516698823464343, 0.019808542317129276, 0.0021247931364365927, 0.01179913901011782,
+            -0.037285312477321496, -0.026697771460831139, -0.062427074890069691, -0.099085399272654473,
+            -0.030378153284729096, 0.0035879827902459195, -0.014489073830827948, -0.043529610612394548,
+            -0.024825054269746849, -0.0027649382554061092, 0.036018046415523371, 0.0026436223670150277,
+            0.079373026831928484, 0.15765223971869394, -0.065690907677039806, 0.0092128046896021772,
+            -0.029241164632892936, -0.09637785332885801, -0.049695700824251267, -0.012176964053326425,
+            0.091749690713129994, 0.020498515662914572, 0.19085018936836431, 0.36476179782324747,
+            -0.0021704732501413105, -0.0015380803413074719, 0.0015913648253885729, -0.01040898722249633,
+            0.0047686672239201991, 0.0092739160314585407, -0.050269241758177825, -0.025545369085297111,
+            0.01531634457419632, 0.011144250288191136, -0.0030437234410767024, -0.0021454133485173566,
+            0.0022320871874844921, -0.013046676127224308, 0.0060404647175723459, 0.010671491843506537,
+            -0.068347142346379341, -0.033570266611167007, 0.022172022151510373, 0.015696104907550128,
+            0.0049973785797292353, 0.0036339243140052361, -0.0036602622815336506, 0.036462875814147713,
+            -0.016193678872759742, -0.04016517452072519, 0.133050009397567, 0.076977798439847034,
+            -0.029674825547785007, -0.025109385654979877, 0.011579534511718132, 0.0087081762777951911,
+            -0.0084695948591351662, 0.12335057290262424, -0.053737180082171342, -0.15156939439905051,
+            0.36211681231813436, 0.23484312689880252, -0.05137654846845658, -0.056472550871329311,
+            0.0060942170933910699, 0.0054202242671661151, -0.004423524724472965, 0.17791138130541051,
+            -0.075426106905124357, -0.24986781028462726, 0.34707548453237819, 0.28780454635607194,
+            0.023505057801559075, -0.024752157475922246, 0.00097804428218031402, 0.00068714017918527289,
+            -0.00071733117941036437, 0.0038887972290473564, -0.0018143561714562379, -0.0029721853332880781,
+            0.021541725592242138, 0.010346103458356265, -0.0072603364810863262, -0.0050570002465068417,
+            0.0041021578150685052, 0.0017632137432885002, -0.0030540421501996768, -0.13469499590545247,
+            0.055395006267070085, 0.21485563061311402, -0.11879281299046333, -0.17605669581918262,
+            -0.097999602727971494, -0.027850813803740816, 0.01638484260154744, 0.010458576392701759,
+            -0.012059908109547064, -0.076953735434791282, 0.028894450449927396, 0.16412553365647672,
+            0.16406940040714768, -0.033185997051097732, -0.18519490499300123, -0.090967153422101335,
+            0.012338944498940343, 0.0079006811290463132, -0.0090809640100981606, -0.05462679687888649,
+            0.02037233725858853, 0.11859301127856955, 0.12816073943264861, -0.020159585765068197,
+            -0.13797759719816916, -0.068358486501665011, -0.013247415992406553, -0.0083986895091866416,
+            0.0097529567230254799, 0.069944277231176119, -0.026585163693397418, -0.14432868563106871,
+            -0.12195236422317164, 0.038059206459284331, 0.15318910336285677, 0.07388819586068246,
+            -0.00062853382563600804, -0.0078016112087892229, -0.0013940917670235424, 0.014521303534821315,
+            -0.0059985284637577027, -0.01126587670703745, 0.0046990428825553123, 0.0058705794199281694,
+            -9.3621438989130315e-05, -0.0031599798821865571, -0.0011534963253018956, -0.00449501548329746,
+            -0.0017675947659194177, 0.0040505887670921198, -0.0075999119480381142, -0.011826053454550919,
+            -0.0067498890206011807, 0.00030189206836750871, 0.0024344025137708618, 0.0039789634510907085,
+            -0.0025377708011013623, -0.02052858826599099, -0.004745445299323219, 0.033389523786130269,
+            -0.020412401757401992, -0.035603095771601312, 0.0018015314828046074, 0.012006666361001639,
+            0.0025329649900545288, -0.0018371373805996767, -0.011907132757254921, -0.079348709974243148,
+            -0.020899072744331944, 0.11761758743797807, -0.089885034099926639, -0.15175946052217518,
+            -0.018108564380280669, 0.038242411535336522, 0.016387385222324836, 0.0082741778010889475,
+            -0.012153007449898869, -0.1081742333880263, -0.023519580704038111, 0.18259610384860697,
+            -0.10117565669345041, -0.17938616963628765, 0.024068589363798042, 0.06801613275026458,
+            0.0095123035731856792, -0.018619031199497031, -0.0088531602316271382, -0.059454304407532743,
+            -0.015575631973636329, 0.088502516943212872, -0.066989730857367272, -0.11324765507233658,
+            -0.012748521700407949, 0.028921274250394056, 0.012063008904669997, 0.0056969037076363624,
+            0.001860167941033772, 0.039404535661521703, 0.0054394928110159148, -0.080513495594087214,
+            0.02341469143217742, 0.048040406027662012, -0.039442608877188631, -0.034767999356233856,
+            0.0046060019011288323, 0.02559367566467342, 0.020942501907664224, 0.09962743637849876,
+            0.033542538598890122, -0.11499421039902272, 0.14423399016708419, 0.2309419603458073,
+            0.094349288199355882, -0.024689379771851577, -0.039417698515935157, -0.054304839456909268,
+            0.014686996584692243, 0.057987284823974722, 0.022566776220819307, -0.053309446196208456,
+            0.097028256508286656, 0.15125566525851086, 0.08476332533331947, -0.0046478048728686265,
+            -0.030796169174304493, -0.049911831057853961, -0.0066807556732928122, -0.018293565870824702,
+            -0.0096142395278820507, 0.0056514314546221439, -0.041330635364552462, -0.061520085330493801,
+            -0.051208344675811396, -0.0065035608121918539, 0.016153183049827789, 0.030750545359764538,
+            0.017376355829838371, -0.0049605553540104808, -0.0023376920748244641, 0.005142448474571318,
+            -0.023366411303533775, 0.003203625657437864, 0.051251453284974942, 0.05090325848466043,
+            0.035973074086157103, 0.010275044041454257, 0.0095425365475966389, -0.0014539224626143887,
+            -0.0027403982872934206, -0.0026625562266144511, -0.016021585910630312, -0.0030327797007055073,
+            0.026540296624367396, 0.028269699492228635, 0.023575076511294958, 0.0093854778468562914,
+            -0.002996855797580229, 0.0016163273639754686, -0.0004692322889846983, -0.0041730045265796819,
+            0.002119658539297355, -0.0034226548902051477, -0.0098007018890997454, -0.0085903339315814408,
+            -0.0039163826639655782, 0.00046953404807319123, 0.00029223239689403241, -0.001124398444060328,
+            0.0011543777360366653, 0.0045827667752690229, 0.0022208222889524357, 0.0039810051304163367,
+            0.002177524648244388, 0.00059772261995325385, -0.0025253492121189284, -0.0028943785929693819,
+            0.013279508103286536, -0.0072162750487608524, 0.0021412639798073676, 0.018724832194922394,
+            -0.0092566999350814673, 0.015370348276887416, 0.043496709921124602, 0.038051606182735905,
+            0.017191407668955626, -0.0022399516288487565, 0.0057605195429013935, -0.0021897960990698564,
+            -0.00014968101161572794, 0.004060110020981467, -0.0063771134661461809, 0.0031192179896329117,
+            0.017679767687157705, 0.016739847085206639, 0.010285825243549001, 0.0017996303905380346,
+            -0.01240164760893815, 0.0034447874104007151, 0.0017780572122568128, -0.0032572748055418764,
+            0.016916846861011137, -0.0019257915270936982, -0.036457760533845175, -0.036353800265781576,
+            -0.025961764137630565, -0.0076150693058625622, -0.0063918586901972616, -0.0016119899965591866,
+            0.0048008333839279198, 0.012952615894037055, 0.017224603395502872, 0.011786771061238066,
+            -0.014509401089701546, -0.019577624692709423, -0.023567282887825183, -0.013905807983587138,
+            -0.0080782897323169837, -0.0012893322546806683, 0.0052097883901678303, 0.013139344790494481,
+            0.019891071806005637, 0.012074855467519737, -0.019282851838507781, -0.024557356765818307,
+            -0.027536056959520987, -0.015370872725045899, -0.0090671099393988402, 0.0044559171915989097,
+            -0.00092161146265350808, -0.010749515638951995, 0.0075037233441456125, -0.0087167828157979667,
+            -0.029103494248651253, -0.026098207830988776, -0.013155314309692859, 0.00014080800455991763,
+            0.00449516491473271, 0.0010758039372889337, 0.0023087731849393825, -0.0010816889167559671,
+            0.0030894516275283392, -0.019792587504955328, -0.012736188078486189, 0.026973047243084722,
+            0.04070314899252029, 0.039058205486437, 0.0003171086227001694, 0.00072471051398573922,
+            -0.0015053499672273956, -0.0027663887173278549, 0.00065247848196679499, -0.01268829387081581,
+            -0.0070926532414243302, 0.0098871680639338131, 0.012726293241476415, 0.0081758842852950649,
+            0.00020684323849459003, 0.0014757138186689742, -0.0035607896669579342, -0.0059630201408701353,
+            0.0010973401339857971, -0.025732524934712404, -0.014201902861897504, 0.018792129264618207,
+            0.023535680399602712, 0.013712512177117371, 0.0011784935369481785, -0.0009543178587361487,
+            0.0037841782699256053, 0.0048425169811410875, -1.8072146588853414e-05, 0.016328610277191138,
+            0.0084643370136110486, -0.0081431693067538745, -0.0081079868313165028, -8.9302772275382837e-05,
+            0.0013218833471822491, -0.0039568158214204098, 0.011665982721693651, 0.017399019538844152,
+            -0.0019533768476273209, 0.068549972317494628, 0.037050144458061908, -0.044653851106827951,
+            -0.05293583169954108, -0.024214430714835363, -0.00079093037382506446, -0.0014044963322922736,
+            0.0027182687667848108, 0.0052287229406358564, -0.0013574571969775016, 0.024631996859026277,
+            0.013842374443364665, -0.019700301642685155, -0.025619573325624808, -0.017024778484314933,
+            -0.00052012570966498376, 0.00081815680854248232, -0.0026908169677449271, -0.0037831237612811269,
+            0.00027384028289828403, -0.014115474167806693, -0.007525544286280373, 0.0084790968588075288,
+            0.0096080351057806022, 0.0033558996560463933, -0.0018365647698655771, -0.00064446212500598944,
+            -0.00041638162954149138, 0.0012915915363654685, -0.0013994864392424238, 0.011653094882673258,
+            0.007159964072621372, -0.0135420620099062, -0.019742498016458065, -0.017669854752388931,
+            -0.0022616594918418403, 0.00048881989510266011, -0.0038101523039819132, -0.003726651407436863,
+            -0.00086451519379800634, -0.0079694238159147401, -0.003426164766817182, -0.00089467913081242969,
+            -0.0048329757523742954, -0.011045535210294773, -0.0027772324977310696, 0.00021534102555691858,
+            -0.0036890518573075692, -0.0029802974756981057, -0.0013193797548341009, -0.0030871548422790329,
+            -0.00053250234221647024, -0.0058353570418539398, -0.011781135895780181, -0.016779237822632145,
+            0.00075690138587034689, 0.033283751836001421, 0.0056866277678280864, -0.027849757940072647,
+            0.00074429940049947801, 0.039002820381328115, -0.034751610507900724, -0.038020005364130277,
+            0.060473666331737681, 0.1609165086213, 0.0004798052409565456, 0.021098810053369426,
+            0.0036047943065073348, -0.017654162178145281, 0.00047181675164964878, 0.024724168802425166,
+            -0.022029296239427804, -0.024101155283167194, 0.038334692718868066, 0.10200613400139064,
+            0.0010278052422959141, 0.04519639580390248, 0.0077219383394819055, -0.03781751195311206,
+            0.001010692859006218, 0.052962385854478669, -0.047189618258096859, -0.05162780985060262,
+            0.08211789862842285, 0.21851040864821239, 0.0010558370089860758, 0.04642905620518737,
+            0.0079325420268542748, -0.03884892493705832, 0.0010382579124357839, 0.054406851384067423,
+            -0.048476640657645891, -0.053035876924889307, 0.084357534778065638, 0.22446993535865806,
+            0.00034969390087760747, 0.015377333471242031, 0.002627263054465272, -0.012866789088201439,
+            0.00034387169272023392, 0.018019584398953098, -0.01605549476741043, -0.017565516770566066,
+            0.027939270127771438, 0.074344587902533649, 2.8668956536738133e-05, 0.0012606799942223303,
+            0.00021539091797144323, -0.00105485802357797, 2.8191634421045854e-05, 0.0014772996630687057,
+            -0.001316277694599594, -0.0014400738347934688, 0.0022905452996207993, 0.0060949926606395869,
+            -7.9685787507666479e-05, -0.0035040786366268167, -0.00059868223311717607, 0.0029319934337294481,
+            -7.8359063647486099e-05, -0.0041061762009226574, 0.0036586132647881252, 0.0040027064622198856,
+            -0.0063666044415802191, -0.016941121990056655, -0.0003188106315004428, -0.014019281956179795,
+            -0.0023952359232167863, 0.01173045667739063, -0.00031350261253093565, -0.01642818209636562,
+            0.014637551335622811, 0.016014215518776825, -0.025471809290187844, -0.067778834455973408,
+            -0.00022395280761690166, -0.0098480327964065202, -0.001682565626449367, 0.0082402167555269065,
+            -0.00022022411844016304, -0.011540197035485899, 0.01028234442126722, 0.011249400656223868,
+            -0.017893014353920388, -0.047612152085321401, -4.6773961945688104e-05, -0.002056824007524714,
+            -0.00035141448513247427, 0.001721021446654768, -4.5995201600971136e-05, -0.0024102432236836266,
+            0.0021475327404491731, 0.0023495085585446504, -0.0037370693468401985, -0.0099440994443825217,
+            0.012353411960972074, -0.0004468891357279044, -0.015143769176655776, -0.037909646484233915,
+            -0.030239462503256934, -0.03673427826608805, 0.010789633523434736, 0.032953387872228887,
+            0.0044272449555942985, -0.02344908984047098, 0.0075555671401928773, -0.0045262848275199122,
+            -0.0084483482687452774, -0.045028117843638339, -0.040607256042782119, -0.0040465658852309894,
+            0.0012050697859560811, 0.0057033651675863373, 0.020294044939550011, 0.042911674922129148,
+            -0.025326085110428189, -0.014824673824673576, 0.034058864294547263, -0.0031205659503834512,
+            -0.019846072819090125, 0.14348810521831573, -0.04208438935258689, -0.12104595673277958,
+            0.05601302942979821, 0.25997783197613372, -0.049871581317535156, -0.014846105274098605,
+            0.064322653405050764, 0.067533385682067654, 0.035509869931042957, 0.22041569060976832,
+            -0.064676116503425571, -0.18961242488943569, 0.050976675421086602, 0.31881181553884547,
+            -0.045530854256053778, -0.014688336042903451, 0.058941214142979592, 0.055829438874915385,
+            0.026521074701395343, 0.20614457063854544, -0.060485608982327237, -0.17696362725570486,
+            0.051230611102528224, 0.30633449467583207, -0.011460493282108157, -0.0046938186425245663,
+            0.015026710665832048, 0.0089342793638948013, 0.001493764926135815, 0.056205039059060304,
+            -0.016488778952303093, -0.047929793642458418, 0.0170163516745113, 0.090523786032246326,
+            0.0067837771421070236, 0.0068028257901825324, -0.0096648369519234684, 0.015379786721727649,
+            0.020039861050945722, -0.050700224184173734, 0.014864369086031688, 0.042045910206060383,
+            -0.026713707368098336, -0.10776052904074185, 0.0031181658647426273, 0.0098690140376159891,
+            -0.0057326205786397688, 0.041694654192909533, 0.044265252327395678, -0.052506293477801197,
+            0.015383463057477587, 0.042235983739580693, -0.040157955392017955, -0.1402945616848193,
+            -0.00203431318145713, 0.0080585776722547527, 0.00096580278707639015, 0.047251266530346905,
+            0.046495773148639036, -0.028535976260600629, 0.0083506252393217364, 0.021706264011973342,
+            -0.033747495061482613, -0.10363277567890192, 0.00044941084305919182, 0.0034872893717656219,
+            -0.0012213653236631513, 0.016614014277506094, 0.017115771264472848, -0.016511230292905049,
+            0.0048360980784884471, 0.013103845908279153, -0.01432633282433643, -0.048017993517484765,
+            0.037307647543323309, 0.033439988432783896, 0.033163430387152887, -0.0059624934952153298,
+            -0.049174959683322396, -0.040088090754429297, 0.0047098582111678652, 0.025833126548918839,
+            0.00955789286354773, 0.0047609169884773352, 0.033006142739569283, 0.048924517004291374,
+            0.045160683220175031, -0.046801046059068117, -0.088538101345351672, -0.032665469832757352,
+            0.032353154884188759, 0.051748658654956495, 0.026949110486634901, 0.038378103978200628,
+            0.02949787084132708, 0.020328046679831895, 0.021221496777441097, 0.0084085878442672051,
+            -0.024649776848463395, -0.032581288325405668, -0.0051834374281513823, 0.011294354204702185,
+            0.0017129234348066328, -0.0070327780782085993, -0.016767689610678743, -0.015945556754770093,
+            -0.015654552754456763, 0.004646940038943251, 0.024234639827629825, 0.017884677913771976,
+            -0.0034520350407475971, -0.012979281353613311, -0.0051717804160524607, -0.0037582519181763169,
+            -0.0082166581038446863, -0.015039378960092258, -0.013581995966878847, 0.017791533369235904,
+            0.02870028344168632, 0.007717716106743943, -0.012222200686712779, -0.017155235212656789,
+            -0.0094435159269288648, -0.014606340570024343, -0.0034864524230108097, -0.01725710756355445,
+            -0.014659759400026336, 0.030900871662849473, 0.03750168735686437, 0.0016998961552346838,
+            -0.021036310032320333, -0.023527443642220629, -0.014406468956772486, -0.025410592277403082,
+            0.030697382912241375, -0.00024623347465159776, 0.0045776992438688775, 0.054701390706947566,
+            0.024179320602721731, -0.037005136148781217, -0.036583982910475633, -0.020219253714690671,
+            -0.018681215442680265, -0.045125485613981123, 0.037149631863638337, 0.0016729492333694175,
+            0.0071521832435235046, 0.061967123250951966, 0.02467226595722001, -0.044497803780635337,
+            -0.041401076829215039, -0.021524540958541345, -0.020723165604590591, -0.051128512913087593,
+            0.021338355544777303, -0.0063599727036405419, -0.0018806338674005312, 0.051312295124058355,
+            0.031218010042503068, -0.026619167582744012, -0.034449844024550119, -0.023300864960241606,
+            -0.018903493129696452, -0.04230073311569451, 0.03120929600290117, -0.006146750970604754,
+            -0.00016945123441509252, 0.068274053492053663, 0.038312180548726454, -0.038476065740543533,
+            -0.045787514059485744, -0.029365651557917073, -0.024630961884526709, -0.056294570914123439,
+            -0.0030584315929411241, 0.0060349184490746015, 0.0071109662552798179, 0.00088251533340925317,
+            -0.010695084091872122, -0.023777201981860539, -0.0039038582788816852, 0.019066753007295784,
+            0.041224363201883926, 0.042397171849834221, -0.0065918893578021283, 0.013007161837941554,
+            0.015326385880284567, 0.0019021002293542685, -0.02305129569310195, -0.051247405717455709,
+            -0.0084140517977651218, 0.041094895346594822, 0.08885156748310491, 0.091379341804755598,
+            -0.0034740822613721924, 0.0068550832332320384, 0.0080773693894939519, 0.0010024519993392159,
+            -0.012148580342032884, -0.027008600035683578, -0.0044344051470288741, 0.021657985928961832,
+            0.046826886455977858, 0.048159083562897567, 0.00072787136022548448, -0.0014362408204636804,
+            -0.001692327758022763, -0.00021002844648577551, 0.0025453063667155097, 0.0056586991805986338,
+            0.00092907313740001345, -0.0045376667827178334, -0.0098109218422405605, -0.010090036741471272,
+            -0.0024919044674014605, 0.0049170431924523954, 0.005793769793632237, 0.00071904302419202137,
+            -0.0087139852626690658, -0.019372843250002918, -0.0031807289421479359, 0.015534932057130114,
+            0.03358818783642236, 0.034543751830719178, 0.00046212102245783335, -0.00091186040929367395,
+            -0.0010744484212553446, -0.00013334576099431844, 0.0016159992615874068, 0.0035926730930991055,
+            0.00058986278572685752, -0.002880936560758354, -0.0062288935665576655, -0.0064061018888850532,
+            -0.0037073590865316437, 0.0073153866839109905, 0.0086197466117526548, 0.0010697644007698691,
+            -0.012964330240616054, -0.028822166898615935, -0.0047321654982075021, 0.023112271065797,
+            0.049971206763533851, 0.051392857915639606, -0.0064732343218138746, 0.012773030897294124,
+            0.015050508545352876, 0.0018678621287253241, -0.0226363687773758, -0.050324944426064014,
+            -0.0082625975538177208, 0.040355180824458256, 0.087252225418171389, 0.089734499408001336,
+            -0.0027146436427701406, 0.0053565536794178588, 0.0063116465914756694, 0.00078331476990229948,
+            -0.0094928858653899016, -0.021104487133828086, -0.0034650387746127877, 0.016923523795328629,
+            0.036590471976397677, 0.037631449171275026, 0.0047999765885713471, -0.0094713471232616264,
+            -0.011160122602134346, -0.0013850409305202328, 0.016785123908696256, 0.037316516451790349,
+            0.0061268096978140405, -0.029923823788088198, -0.06469851367756721, -0.066539147964117293,
+            0.0068167225840353157, -0.0026657597650314702, -0.0063791089008479011, -0.0062561772798679768,
+            0.005326133956276121, 0.0054549003414627786, 0.015143250448639548, -0.0082631443611737108,
+            -0.020639369685590683, -0.0099386844749559042, -0.0083674755461105345, 0.00113209980335937,
+            0.0070471714880015416, -0.00053028838889463727, -0.007957647931115041, -0.0068384518903765621,
+            -0.017701649520568366, 0.0058155838711452402, 0.022911870548391847, 0.020262201758295132,
+            0.001289645762479091, -0.012160197838996226, -0.0054721383748133528, -0.045896996239645785,
+            -0.0067254913790488194, 0.00025533065575150844, 0.0076935881223218552, -0.025131895140491058,
+            -0.017100298471139558, 0.042031635048633005, -0.0035087891835348288, 0.00084129241900305349,
+            0.0030892748023598343, 0.0011838074772421384, -0.0030937366547048946, -0.0028431881614660562,
+            -0.0075748053342813461, 0.003179888634808733, 0.010022770074704651, 0.0071157124653229613,
+            -0.017857438495418088, 0.014334264168614325, 0.019400992056631049, 0.044588008694962378,
+            -0.0090756278530269713, -0.01380012053996673, -0.042715288332401923, 0.036510361843968622,
+            0.062389889644838221, -0.0016576508688766816, -0.026957923620121869, 0.029477626907153671,
+            0.032156425107889741, 0.097379821265071179, -0.0085003486233866526, -0.020310621674632438,
+            -0.067730982394491157, 0.070966172610893274, 0.10305871856949961, -0.032032369301694674,
+            -0.012842620850513404, 0.015090736980688567, 0.0157025661063445, 0.050410535635274201,
+            -0.0033543949036188088, -0.0096060642710933796, -0.032700749977593292, 0.035926505918571675,
+            0.05028280649900229, -0.019207289567362233, -0.012646371565619336, -0.0018474282570739072,
+            0.0093487397541579705, -0.014452143930288907, -0.014387840136121285, -0.010572560416688599,
+            -0.025279629502042995, 0.0015941871645560332, 0.030599856746382503, 0.044029727314199921,
+            -0.033727138054139037, 0.021569506063413554, 0.034628526254865788, 0.06310090500825781,
+            -0.020792323369301237, -0.026430844101514018, -0.07839596473572831, 0.057828508594003014,
+            0.1116046242977186, 0.017602738846861324, -0.012474534256225495, 0.016958154156003061,
+            0.016094136327108384, 0.057788558858068634, -0.0017323498803555855, -0.0091774882450520248,
+            -0.032716294830000582, 0.039547365580151664, 0.051445385985312966, -0.027321491335432997,
+            -0.026148795299247428, -0.028059256393537756, -0.0076228256759653581, -0.021492551694939445,
+            -0.063238511006206491, -0.022706923555228711, -0.030572345546312177, -0.074888311426844212,
+            -0.011021857884607437, 0.020692868072810074, 0.0052721080653899601, 0.005534789416073025,
+            0.0056029533060802002, 0.00083221455250348866, 0.014442755979178329, 0.025921949884076055,
+            0.015882342712057539, 0.0083977391759377223, 0.00052055491280063554, -0.0034689928125957014,
+            0.0024678295789890914, 0.0021087565680057876, 0.018621744671120932, -0.013386577212207098,
+            0.013420712626272573, 0.096117311902197342, 0.04567415893975596, -0.022436974954377707,
+            -0.0064520453748242992, 0.0011427240124638562, -0.014533252902855133, -0.015979522826329914,
+            0.0085236510742080392, -0.022932770688326005, -0.029835413079477024, 0.054362313322640833,
+            0.013507032258770644, -0.0626524228509166, -0.011466137108168663, 0.013707399085718362,
+            -0.046329335684348327, -0.049537926869226125, -0.019356798382394621, -0.03304154427624937,
+            -0.11447902168498419, -0.070944681869587883, -0.068151423517513812, -0.12304098674905908,
+            -0.017079381721785018, 0.035651008183077391, 0.053000196387979828, 0.056961970064452597,
+            0.012479284783023013, 0.04612096738088535, 0.12693934696903891, 0.030427376677431575,
+            0.05486463673218564, 0.15668562461960081, 0.023583330744272591, -0.042455516959065256,
+            0.058205051996876721, 0.062566703680088057, 0.013345874835391213, 0.050959313205221034,
+            0.1392559387668528, 0.031531350094358215, 0.059394696988210732, 0.1726644030836581,
+            0.026049534235466132, -0.046686903876750438, -0.019128499306755375, -0.020519184128496706,
+            -0.0058041553264892715, -0.015526133174917921, -0.046355414113388081, -0.017806822444381875,
+            -0.022909068970848052, -0.054407131333613259, -0.0079674013415913583, 0.015097949316008387,
+            -0.014702398566208027, -0.015928360536070121, 0.00075196262136322531, -0.016422370424379315,
+            -0.033459194900797851, 0.013678510902330068, -0.005148199282295705, -0.050409661206180824,
+            -0.0083055636472510047, 0.012505910882640591, 0.085780151809156185, 0.092117335130736222,
+            0.022683480027083872, 0.072505686409896936, 0.20648458913354628, 0.062295583871028605,
+            0.094739377520140763, 0.24949670163309545, 0.037128952056536949, -0.06828386024777662,
+            -0.024112421851444677, -0.023701973029310441, -0.023938004486805893, -0.022917434462511217,
+            -0.028290980099608471, -0.039892539869198503, -0.07774508679096169, -0.057813079697828229,
+            -0.0023451615278981559, 0.0398146881117813, -0.0044097745773298913, -0.0050368162082052243,
+            -0.0083088826374329208, -0.0066311822017105322, -0.0057797511171068568, 0.0037238941866362466,
+            -0.0035986640696425978, -0.016572295321766659, 0.001382878832341735, 0.0093283007005533214,
+            0.037319655677006749, 0.030825408690948883, 0.0042459884885564774, 0.01510906467528747,
+            0.038731762392162597, 0.15370016979094972, 0.20894849925195499, 0.039416754596928255,
+            0.018748675881565605, -0.044542061380924834, 0.017093367750912792, 0.013919633610222266,
+            0.00082947048158969142, 0.0062280812706582041, 0.017568276193529776, 0.073525126155593076,
+            0.098716820901074129, 0.016351801484097886, 0.0091014129250213509, -0.01982069025012706,
+            -0.047040657623620002, -0.041315328117564699, -0.019128215753927147, -0.027595489972207562,
+            -0.050943567501335434, -0.15511764963942473, -0.22615860795277162, -0.07070828137027918,
+            -0.017282956952331507, 0.063317492904907638, -0.0020736260989806334, -0.00094571590698964937,
+            0.004058775975972673, 0.0018261752177758436, -0.0014902561338763559, -0.020579306066161481,
+            -0.023212182174579654, 0.0043641049553914575, -0.0030211446013233105, 0.00023872591340800154,
+            0.013773012764545157, 0.012127609064082353, 0.0057736192672279358, 0.0081870992230829581,
+            0.014942416005007441, 0.044931645900678649, 0.065749304496508079, 0.020966783945130879,
+            0.004980498913356216, -0.018628819704822521, 0.015754227184308203, 0.0092818352532872874,
+            -0.019096392096277098, -0.0065873705300408588, 0.013131280998807436, 0.12344000901746541,
+            0.14463749789131022, -0.015239453035198011, 0.01754211376396609, -0.0079265311848390474,
+            -0.006289772927659378, -0.0079269485562491297, -0.016010073190089204, -0.012039629099104165,
+            -0.0088847104960213114, 0.016969937785471446, 0.0061024663148723773, -0.029984496160903377,
+            0.0038892425641256748, 0.015470688886187009, 0.029752362117453763, 0.028474928599904879,
+            0.025220525892577741, 0.025598563759426939, 0.034243082393096091, 0.061324056839570845,
+            0.10759121716953872, 0.064747955703569005, 0.0048831979362366079, -0.046879797448697566,
+            0.00067558448925000261, -0.00024137661395802782, 0.0015803509910177144, -0.01931383446135768,
+            -0.0048842259211848149, 0.0021694010716561815, -0.014101401953578691, -0.014166405694092605,
+            0.0041022595313103443, 0.0053851870625565594, 0.0047191926043150421, 0.0071681019332324658,
+            0.012515059235183076, -0.011989559133399769, -0.020378092944870332, -0.013334352337068332,
+            -0.014962643846495007, -0.012145736823758701, 0.0067084444642734227, 0.0080630175717291992,
+            -0.023208426868427286, -0.032915018088669458, -0.061158079231543941, 0.091406126342122751,
+            0.10384335437918024, 0.058057936482712111, 0.095633014356189011, 0.08264309780763722,
+            -0.038783781962401516, -0.047453127511518367, -0.026488839612226596, -0.037569562020083706,
+            -0.069802872071908606, 0.10429620609064061, 0.11851784262297715, 0.066271083353162036,
+            0.1091300908083957, 0.094303311958992775, -0.044260386555979372, -0.054153263882825417,
+            0.0085185726904447954, 0.014111732926026299, 0.022786272629409188, -0.0053620802306167583,
+            -0.034964591032640269, -0.027842738241874963, -0.015944774911856998, -0.010426790398175984,
+            0.009202644684726792, 0.010640280817419251, -0.027386041578168797, -0.043137801094828912,
+            -0.072883142910952728, 0.048190615266685756, 0.11586606406929637, 0.082337225097903463,
+            0.072295723671102083, 0.055379792104792026, -0.035111547407496439, -0.041648818949651667,
+            -0.046996055204111258, -0.074326741981682695, -0.12512171132355668, 0.078536550127309895,
+            0.19836782877597806, 0.14225993364203759, 0.1212355951483301, 0.092096130417264249,
+            -0.059510492633253996, -0.070471309339197916, -0.042032944095642809, -0.067274331373196813,
+            -0.11204082665892844, 0.059177503926515052, 0.17618200272384241, 0.12980067571175186,
+            0.10091236212521618, 0.074555790476243083, -0.051250185040327238, -0.060368707457426028,
+            0.011597579583626384, 0.016531386260604089, 0.030575439784811042, -0.044520668846708931,
+            -0.05176275249600578, -0.029280344239174371, -0.047003361259171032, -0.040481348058295064,
+            0.019174361790326142, 0.023435001405041331, -0.0080391551579584442, -0.012322089852795972,
+            -0.021337967489848696, 0.018880264448628073, 0.034541548192319901, 0.023072923954338145,
+            0.024439595803864837, 0.019599903613638121, -0.011152184065623783, -0.013364154009284222,
+            -0.02065447427553023, -0.018138885908602277, -0.031440215173335707, -0.030008750000281324,
+            -0.063382323672972113, -0.051049729815214162, -0.032104671532060126, -0.042790297674763347,
+            -0.018414762919819333, 0.02358491583631192, -0.03001438887857448, -0.024591531579083961,
+            -0.037085492148875895, 0.0092047689729622684, -0.048307279687039135, -0.067155131488934122,
+            -0.010957603335899711, -0.003331620446963876, -0.040478669990607688, 0.0058192172895648866,
+            -0.052778125999729947, -0.037931892122256394, -0.039362843241389285, 0.17488233492302027,
+            0.046663287768027584, -0.096967092795510121, 0.087994379763000549, 0.17097958962761955,
+            -0.11240294445255261, -0.075267633117455185, -0.058977126909195023, -0.039488308960588206,
+            -0.029875930353570525, 0.28204980838863358, 0.12398437478479238, -0.096827408073477519,
+            0.15688055000342041, 0.28759153033195528, -0.14810793950437498, -0.13077975506528064,
+            -0.03696549064449766, -0.028338069876942588, -0.036188943551656999, 0.069569319643393523,
+            -0.011201976447359801, -0.074957750224566022, 0.02586410896743065, 0.060786556361409623,
+            -0.064980195069568703, -0.024206973932261056, -0.0082155196366215065, -0.0041768787949112013,
+            0.0022821747618785374, 0.078850514496449309, 0.050079228566845227, -0.0082230432261897919,
+            0.048592627024436272, 0.08414493792006518, -0.030908091247198455, -0.039531744438398152,
+            -0.015206220030050965, -0.009143175691351535, -0.0026495217538368612, 0.10374629537183186,
+            0.057696209387202789, -0.020836288407138172, 0.061418417403520824, 0.10872175880552204,
+            -0.046246239629481115, -0.050434332281150622, 0.013923230829040085, 0.0094835710953696164,
+            0.0078378645470177487, -0.061767774971280012, -0.025274342893052665, 0.023500093736145811,
+            -0.033779569056712581, -0.062525267041503019, 0.033713508953779205, 0.028278446912278449,
+            -0.0053856539109260818, -0.0065451936402187057, -0.01703497980899835, -0.062077356162977056,
+            -0.0615190099231539, -0.020531496533601482, -0.04504047915963965, -0.071612097904610567,
+            0.0092913955386641107, 0.035379233681259725, 0.0094197973160886905, 0.0091882220279137262,
+            0.018796014799200504, 0.041050078767821727, 0.051599772778316129, 0.026923822830611344,
+            0.033137181283984032, 0.050007468759440642, 0.0012900390510257043, -0.025499139418615327,
+            -0.0021266722846753484, -0.0072204673304569781, -0.0027688228420761607, 0.0093954797825377585,
+            0.0098594231354879706, 0.0020195780295594692, 0.0027978031802079182, 0.0030522461511020534,
+            -0.0038657182604487353, -0.0044205949707942973, -0.0041628411354374872, -0.012944434148340863,
+            -0.0062427326188996077, 0.021265035308880041, 0.023333346561359342, 0.00065757880428372103,
+            0.003390495960743263, 0.0059236734226200067, -0.010853231917260748, -0.011256457933350119,
+            -0.015254176131152051, -0.047531615456687187, -0.022807526762969699, 0.077684937221743522,
+            0.085167930666325775, 0.0026824748916425972, 0.012596736501656745, 0.021710727701397259,
+            -0.039498127846630995, -0.041032238334301391, -0.0065863773474057318, -0.01146530391847058,
+            -0.01611545084832413, 0.055431490135814936, 0.0674988392235151, -0.023942822341642689,
+            -0.010449328915973211, 0.0089862783275027926, -0.042084343167089366, -0.037545347168227647,
+            0.011363929121627807, 0.043352044023203182, 0.011495030128372911, -0.038679391306385619,
+            -0.036505721699920668, -0.024008536862092041, -0.023316057323322412, -0.016513993603884839,
+            0.0074770956257414825, 0.01318086589857026, -0.0068906822503505376, -0.029989615094268049,
+            -0.0044081396395691278, 0.014506288117718182, 0.0095762338659725662, 0.024818400241141611,
+            0.020632634170537859, 0.010172050139970041, 0.0056976008164394184, 0.00011288263223148409,
+            -0.015687991114877398, -0.06322515683482155, -0.013531936407711167, 0.045235444164189439,
+            0.038939864054890735, 0.042503376288933761, 0.038112248911446225, 0.022942322622075694,
+            -0.00098926296009629183, -0.010802798394271848, -0.0091289538961789474, -0.035508572665136642,
+            -0.0087618605796092233, 0.029422389230043006, 0.027010206481951037, 0.021178626164391076,
+            0.0199279550706878, 0.013295376195869702, -0.0041199935161349323, -0.0090940261388052744,
+            -0.012398427319539119, -0.042139612866167346, -0.016111327307111373, 0.054667708535071073,
+            0.057329037474583684, 0.011897483681696405, 0.016389214317464072, 0.017796398633091699,
+            -0.022413943358833788, -0.025674428995491067, -0.025464966101149303, -0.087340579678287275,
+            -0.032543773734547379, 0.11037073230420019, 0.11506553100635503, 0.026626991266837027,
+            0.035048375850245742, 0.036585643495613329, -0.043850994733306545, -0.051001658237828831,
+            -0.011847996347894943, 0.0013561921798823566, -0.036359236406996419, -0.031806918913445677,
+            -0.0018553441271555165, -0.025755971081697821, -0.044755296186851319, -0.044351952379109709,
+            -0.069838906921051797, -0.040045596102479729, -0.01144290887617946, 0.0013098234568360788,
+            -0.035116100376469825, -0.030719428338045869, -0.0017919092104351775, -0.024875364698921903,
+            -0.043225095700131021, -0.042835542369573272, -0.067451088305877413, -0.038676422041130948,
+            -0.0091804507726668573, 0.0010508490364193796, -0.028173048856948123, -0.024645673811924746,
+            -0.0014376182204625717, -0.019957081153200117, -0.034678757605501286, -0.034366225607456759,
+            -0.054114858595436147, -0.03102943425081606, -0.019730787821052389, 0.0022585034093620033,
+            -0.060550016881916975, -0.05296891979833513, -0.0030897546077016847, -0.042892113199244117,
+            -0.074532201648425805, -0.073860502328489813, -0.11630461502955544, -0.06668901109224043,
+            -0.020669026053293335, 0.002365899741709615, -0.063429290700919461, -0.055487697361908957,
+            -0.0032366785890186015, -0.044931718552569076, -0.07807635618264222, -0.07737271622312053,
+            -0.12183513096214092, -0.069860206304745806, -0.0038528773004652141, 0.00044102326769078953,
+            -0.011823744074638792, -0.010343365433356663, -0.00060334364243275673, -0.0083756437306585791,
+            -0.014554078148796354, -0.01442291384425916, -0.022711075464944039, -0.013022519899261748,
+            0.019391775685507696, -0.0022196980625665838, 0.059509653429804653, 0.0520588138876543,
+            0.003036666798062965, 0.042155145824926431, 0.073251597899764501, 0.072591439640578889,
+            0.11430628246055366, 0.065543168145025657, 0.023384518792435964, -0.0026767312029302181,
+            0.071762618933377195, 0.062777660561408585, 0.0036619128107354968, 0.050834839249795184,
+            0.088334013111711532, 0.087537929067203687, 0.13784180745706312, 0.079038427014633414,
+            0.004811725484789425, -0.00055077873782190018, 0.014766265897618374, 0.012917472105369896,
+            0.00075349505161476018, 0.010460052383568117, 0.018176085889816566, 0.018012279316801615,
+            0.028363078312525596, 0.016263375651202082, -0.015044758106548078, 0.0017221125575336068,
+            -0.046169487280374351, -0.040388888307886769, -0.0023559429609732044, -0.032705306732495547,
+            -0.056830926120071262, -0.056318754285858579, -0.088682459902988772, -0.05085048044443187,
+            0.049081395976803055, 0.035089858824530591, 0.05289368046016385, -0.011749528585522702,
+            -0.035236863753087939, -0.079990660280985476, -0.093274752248979909, 0.015222036835787465,
+            0.045893801152115409, -0.030752489250110756, 0.041639227537343837, 0.040012879477632358,
+            0.07172289725794305, -0.013540374351903814, 0.0050769166783852238, -0.016177513519739502,
+            -0.0945227332820784, -0.039755590504212068, 0.020872724638483515, 0.016895008033066226,
+            0.052357114811757643, 0.050846848993649295, 0.091585781161097266, -0.017212124684022723,
+            0.0082091290216043875, -0.017643754954871672, -0.11965616396777823, -0.052737893492232304,
+            0.02530252001399648, 0.023487483639277804, 0.017744034446911298, 0.028017145725938157,
+            0.059306965077533538, -0.0095944425551614185, 0.039600833847670644, 0.048435722410479699,
+            -0.056756376546606049, -0.073325695671559971, -0.01044153558933934, 0.053215855326237418,
+            0.041424772522515786, 0.055251377196843379, 0.1118349330187071, -0.018856840175918852,
+            0.057777007306256983, 0.061831150580628713, -0.11724145204133937, -0.1189617219977331,
+            -0.0064675742931365084, 0.081616613938624974, 0.067776780512465107, 0.087763887235914093,
+            0.176070761046211, -0.029933454347720802, 0.085535133480326, 0.087868783158613364,
+            -0.18786422303232081, -0.1810890049867124, -0.0059353729673967534, 0.12247858769031007,
+            0.035283244581245654, 0.035187116165009982, 0.064134954485516232, -0.011920594247841344,
+            0.0086784628882294185, -0.007239967960999457, -0.082020555512967164, -0.040278583332419425,
+            0.015426185146829441, 0.019695482563057587, 0.033919777516809975, 0.010719048080899365,
+            0.0010878721747495101, -0.0034010552622773908, -0.070546379965144013, -0.12355279954906236,
+            -0.04413065618349029, 0.080093208993135823, 0.055576023460213612, -0.078032866123147873,
+            0.002894924440997225, -0.008804772332379994, -0.025382984918775359, 0.0030993855984257088,
+            -0.039202616014065647, -0.059584849891279615, 0.010837358790967561, 0.056810620882046484,
+            0.021881385313936109, -0.04744526081676731, 0.015007733158093809, 0.012722226907725481,
+            0.021396494485422714, -0.0042876294744640499, -0.0039715157849568011, -0.014404702941529821,
+            -0.03151490720480439, -0.0055914205595957601, 0.010519374340537098, -0.0010414026218074912,
+            -0.00023843324530381299, 0.0075430228789342768, 0.031458057975983146, 0.021571855199995552,
+            -0.0086556731168993418, -0.022746438043183336, -0.00052660849216479462, 0.010176785551719431,
+            0.010978271174926557, 0.014687744609816516, -0.011288134634262911, 0.0069780698780955155,
+            0.034422010506028056, 0.022556951546624186, 0.026830276936612964, -0.0011186048590357918,
+            -0.011663031251486792, 0.007637696623999623, 0.01548859472054335, 0.021905840667069229,
+            0.012178661595654491, -0.00098926902776471336, -0.01097911528581068, -0.019249067150251074,
+            -0.079104912697991719, -0.074233944399443683, -0.003691948456166317, 0.0090987543094699624,
+            0.0033490603666605327, 0.010566457552812044, -0.038242825135957031, -0.0014567003795735412,
+            0.012260647355244268, 0.0039042281922718122, 0.11932304992686393, 0.06953784988619699,
+            -0.039657525740267416, -0.0075325958552892808, 0.017055714029094685, 0.027418886699467626,
+            -0.073449210523782255, 0.0031440792427046595, 0.047653666693518039, 0.016634324711530916,
+            0.1975715955793923, 0.083421462430944768, -0.085621986712170584, -0.0015347570104437248,
+            0.047443421655243317, 0.076542449430187662, -0.044982646148809917, -0.00074180234277894516,
+            0.017911442246280287, 4.2756867064366617e-05, 0.11647208011165108, 0.048936811689982082,
+            -0.055333143178865563, -0.0029660672795259958, 0.027204049424667136, 0.04578928922035163,
+            -0.029637862161077857, -0.0043369383584948989, -0.0051714033936259406, -0.024088686256679457,
+            0.040852039152769908, -0.0095477641093434009, -0.051836670485019866, 0.0010517041234102075,
+            0.022690097111681136, 0.043712434130174241, -0.0095050456550068267, -0.0032708980283140763,
+            -0.010420059667995057, -0.025788174587195459, -0.02387859482007906, -0.049104648688215777,
+            -0.031558168697566009, 0.0057334479579452622, 0.01453227048749605, 0.030646199515548839,
+            -0.007387168173067022, -0.00047249031842836354, 0.00088195324105200246, -0.0090499966359242033,
+            -0.0053820582515905387, -0.023758960476622938, -0.018592592958490951, 0.0040763618864272169,
+            0.010282821748374058, 0.019687197127632887, 0.014735006900083079, 0.0021837156641365788,
+            0.0026608131684068394, 0.011725248007816326, -0.021364620651353028, 0.0033182506117371158,
+            0.025381324285295978, -0.00027960114788238015, -0.010982744906651538, -0.021154440462240871,
+            0.014449704628772713, -0.0093550670950473449, -0.0084757626213533659, 0.020616898373211734,
+            0.019209923856567085, 0.018945104488574907, 0.007750534047377463, 0.0040392986798484919,
+            -0.011944591496599846, -0.051414746904624498, -0.009373615559235899, 0.0060740688161021192,
+            0.0030898022824355324, -0.018121639716100806, -0.015664265222644927, -0.014692590787620415,
+            -0.0092254257771206428, -0.0081365784076495168, 0.0044607283505352473, 0.038113731140082791,
+            -0.024796130085890711, 0.016073030437775682, 0.0058316870320032259, -0.052553275222113456,
+            -0.044550856976906569, -0.041202735686998074, -0.02848551839737061, -0.02688732668923477,
+            0.0086032314093485197, 0.10545153987190885, 0.0069633401134903752, -0.0045086470058533692,
+            -0.0038952883107973776, 0.010308248180771862, 0.0095088838031715198, 0.009318432014773519,
+            0.0040647394692053173, 0.0023798748668515911, -0.0054978482311488167, -0.025150837087561634,
+            -0.0069624348852970058, 0.0044664976578211741, 0.022511466263562343, 0.026388231969088162,
+            0.015247812186007872, 0.0092554176772457163, 0.028381779017699577, 0.040259155398058515,
+            0.03091068944852322, -0.011650613678724353, 0.016988766109939612, -0.011018712280042722,
+            -0.0010968418551053991, 0.041719766723315274, 0.034377967411888699, 0.031121361145107045,
+            0.024568432683099953, 0.025060486490816734, -0.0019374406523802509, -0.077978411363515396,
+            0.011614673646887969, -0.0074827991955634535, -0.023297976600058834, -0.015921847682858578,
+            -0.0064801331747581402, -0.0012180786327177242, -0.022501190769240252, -0.034509991152873613,
+            -0.032104881971995812, -0.0087422218868284662, -0.039443719830805309, 0.025588821672783289,
+            -0.00018237088196253887, -0.10224203261942892, -0.083445983767652082, -0.074978625948126071,
+            -0.061797999379212619, -0.064434550244797217, 0.00077295787267032262, 0.18644075654130265,
+            -0.049383380060743734, 0.031948487557478679, 0.0394635246171397, -0.049770447584107834,
+            -0.051693961034931013, -0.054274997392980494, -0.0081941137307988028, 0.010236429153927761,
+            0.055150917405910889, 0.15496722484199335, -0.043008427224644694, 0.027801989132374617,
+            0.04432816735416855, -0.023715392349897609, -0.031777752216941922, -0.037333112076831168,
+            0.010220717597037601, 0.031724663040268108, 0.061626457465439682, 0.11527708418332827,
+            -0.012781585995109961, -0.018186412641599106, -0.014978221284029735, -0.0092236756850586476,
+            0.034563913131316529, 0.04659969042851457, -0.0096150352404933796, -0.036422840989139539,
+            -0.027775578144834591, 0.020131868598678698, -0.0067211806830289982, -0.020084604477764761,
+            -0.018903812588326258, -0.014894951768707417, 0.024523172085777766, 0.015935994080854721,
+            -0.028860432356605948, -0.054187449128578133, -0.039927930584296556, 0.0047374447568762582,
+            -0.015884415109464894, -0.018780349958475825, -0.014609500378349209, -0.0078149261721436915,
+            0.040649286777983469, 0.061023856338156192, -0.0033042730441907621, -0.032541492551635298,
+            -0.025322218700732563, 0.027143134154660367, 0.0034910657098710142, 0.01833083801890897,
+            0.01809756225977599, 0.015277463270778025, -0.017503105177782481, -0.0018448179961947503,
+            0.032861097257360576, 0.054447074330574136, 0.039749150623728989, 0.0019302272392872511,
+            0.019282766500506796, 0.033081754988430738, 0.028513372562275999, 0.019304524933679793,
+            -0.055550200449629911, -0.065704729706477949, 0.027277526611133064, 0.073746161223475326,
+            0.055489539645272729, -0.02723353311172709, -0.010260220095152111, -0.0086145670275623518,
+            -0.0057513074155230749, -0.0016909538723597368, 0.024135161543392174, 0.04228070007995665,
+            0.0058211052905178303, -0.0093109647919713927, -0.007893696689723893, 0.019487260345349547,
+            -0.021323612305509453, -0.035230522214569703, -0.030113555182683945, -0.02005640925977498,
+            0.060613492664110612, 0.073760257687757846, -0.027104422534209652, -0.07704753664260465,
+            -0.05810721723812836, 0.030867754280223259, -0.0023465009525996915, -0.011136231573596968,
+            -0.010922432780485046, -0.0091375903695461724, 0.011049831028608657, 0.0022048209793264027,
+            -0.01940693758843777, -0.032651272302598351, -0.023865794895777639, -0.00063878457962257811,
+            -0.017519492948145005, -0.0093482020666798889, -0.0042011806630385066, 0.0022311158726283998,
+            0.037976559290444918, 0.076561157105096755, 0.022069564237166387, 0.0019538332940925995,
+            -0.00057526239009472041, 0.036255208561158964, 0.012037173664579251, 0.054167642856664991,
+            0.052928496180977953, 0.04404899483021664, -0.054898352673181369, -0.013720502084604951,
+            0.092858765487775941, 0.15764124975304786, 0.11530506071188118, 0.0016316873440167905,
+            -7.9822368462950481e-05, -0.00085898813979656049, -0.0045307062534794959, -0.0055615036053834428,
+            0.010319355902328568, 0.00575394790719648, -0.0050368445294252107, -0.0014113277160122568,
+            -0.0039440908176863725, 0.00023948121571545217, 0.062843601426494491, 0.013878154013732484,
+            -0.047665481735538771, -0.0023636194555638756, -0.033043340181808531, -0.0089552003412374862,
+            -0.02142515065132863, -0.10597454049558877, -0.099322199724316926, -0.10097091694979012,
+            0.02005444428614132, 0.0033332274622568455, -0.021189054066930675, -0.0079997351388069668,
+            0.0028373558321590255, 0.0046195695120662527, -0.013430962785180696, -0.035831187100504043,
+            -0.03699518690306168, -0.032076676707017159, 0.032023263042952922, 0.012774348076581805,
+            0.0068289450001722445, 0.036509838816442042, -0.086494434810166679, -0.043484457225609841,
+            0.023404781065845367, -0.043523731011219424, -0.023024980559872232, -0.052205710233038563,
+            0.041803079734033764, 0.02124451421313012, 0.033846762101186256, 0.077877279300334792,
+            -0.16871980548047474, -0.087948902550819899, 0.058052347316362662, -0.048420735201007661,
+            -0.0079537163920184173, -0.068753215835672898, 0.035775905611084416, -0.002518180456717649,
+            -0.083989965246808643, -0.070252407188570745, 0.10845666848173477, 0.066013834146047778,
+            -0.074906663914891217, -0.079473425549926091, -0.10694563013516539, -0.056103807644332968,
+            0.050543057296261878, -0.0017216413220538782, -0.10863960634995865, -0.08710784500841956,
+            0.13079745829713479, 0.080731156855726252, -0.094775275452415653, -0.10890407907488815,
+            -0.14220753529063795, -0.079504388457180108, 0.037502138907072637, 0.0044657996961546048,
+            -0.049268412057045775, -0.026648624435790719, 0.026894924027976375, 0.020701713851371997,
+            -0.035753851866634143, -0.070252347088883449, -0.077731703882784525, -0.059750255702910482,
+            0.050802463288852247, 0.0093358557799214995, -0.048808918962614224, -0.014365505090078962,
+            -0.0037086980616473433, 0.0056139857079874865, -0.028654626809023899, -0.089129495494111546,
+            -0.089401825198656582, -0.081375438793618721, 0.024074101313833491, 0.010567369837312015,
+            0.010394325207537917, 0.033822637171878264, -0.076799409486996262, -0.039269965178153891,
+            0.023397259125131444, -0.030948507335104708, -0.012645886118331572, -0.039374087539663753,
+            0.059943407695769342, -0.01199631258740071, -0.11958223993971269, -0.073145563147289067,
+            -0.026970291773555956, 0.056763664862812119, 0.10086522116215547, -0.012987338486882393,
+            0.01889176436415697, 0.057641778307553924, 0.034251314232958061, -0.0076667150653435632,
+            -0.067843698547536913, -0.037606273121474687, -0.018420219729003189, 0.033154148861542346,
+            0.061384456633045467, -0.0057869199906917679, 0.0096045336482942847, 0.033215102738841408,
+            -0.015199424122506999, -0.041407871475920746, 0.056862377434039692, 0.24781336110309227,
+            -0.15788857820393512, 0.025000639203584023, 0.1797157702811179, 0.092728116729306073,
+            -0.069930719610070066, 0.00065115176739639555, -0.0475450703938851, -0.05173503636653682,
+            0.13142078845487637, 0.37393750986374413, -0.20559640073031282, 0.0092602550663829029,
+            0.20288149796383056, 0.13353939618356142, -0.10474556792448365, -0.024682154035790015,
+            -0.026315128429546971, -0.042755894001541929, 0.081170480948201798, 0.27980417480776099,
+            -0.16612700739688527, 0.017640794265631827, 0.17751166000155744, 0.10232465234433413,
+            -0.07866951423542741, -0.0088106860401645816, -0.016763267522524765, -0.0098025582138276338,
+            0.041297566075574998, 0.088319336672234211, -0.041217858725689865, -0.0042132729450999693,
+            0.032560247319478486, 0.030105169449900389, -0.024565037775456634, -0.011600509271341292,
+            0.019831843710670476, 0.03293703700877311, -0.061599325335811042, -0.21455619697513115,
+            0.12784770171411239, -0.013928247676702666, -0.13707996517443438, -0.078553351371806107,
+            0.060335385405026365, 0.0063944252918706731, 0.023802169728405327, -0.010641140630041426,
+            -0.043973858918771536, 0.0012719284172636597, -0.032491523473437534, 0.027748691049668036,
+            0.06719741696443407, 0.0066692022283410465, -0.0011121700203854216, 0.024907028258392777,
+            0.018602307187481147, -0.0032591597239177541, -0.037386950808768145, -0.025090902864562319,
+            -0.0066513959351621882, 0.017204603781751017, 0.029160155990245903, -0.0049633028450168353,
+            0.0065422055467045694, 0.017728784928990396, 0.034890871813778847, -0.0021152942041114866,
+            -0.072510722587229418, -0.067680447886089748, 0.0023395089306023145, 0.028726366980404743,
+            0.036230180871574973, -0.01735275211872158, 0.018129206821224975, 0.031879416545411793,
+            -0.0050141467515528743, -0.016116915069709085, -0.0072878065309137218, 0.0079137310056940809,
+            -0.017893823735959907, -0.02729977971183592, -0.021764375369090188, 0.0025141227116693122,
+            0.025089283257143956, 0.024652688585302823, -0.00070950817373689572, -0.01492066913792876,
+            -0.042725946112809866, -0.034106650302128755, -0.0057694479216742695, -0.016842175470095377,
+            -0.018733472989800208, -0.011352684049727809, 0.0040955080260213043, 0.004631174564314982,
+            -0.0036591578641116374, -0.004603130254058169, 0.018294529757467759, 0.025724944031765219,
+            -0.011224857017331745, -0.01257196202229478, -0.0070177240571241799, 0.0084655511811310216,
+            0.018000482867418614, 0.017343519938032959, -0.0055661561006405411, 0.0062736619473584537,
+            0.071620314569938046, 0.076129612615276995, -0.013674524121361747, -0.0054920175805274725,
+            0.0057659166036931409, 0.025174666034282516, 0.026808806341788678, 0.025181972648286258,
+            0.0040607327535426823, 0.011604885582681855, 0.0011273977914782012, -0.010442933544060368,
+            0.01412066947806671, 0.020622552565689938, 0.015833398906076646, -0.0033768668694183074,
+            -0.020256236291286509, -0.019834241387560677, 0.0070245404459528173, 0.01356157803223036,
+            -0.019534773418561829, -0.036216890974756194, 0.022758687584746303, 0.028986226403310545,
+            0.019323426050146864, -0.011874825133224553, -0.034759647325178694, -0.033721791122237117,
+            0.006806251538943639, 0.0015517089221833611, -0.057153413149478548, -0.067387035078577726,
+            0.019083365869984631, 0.016186131487395162, 0.0043715655483088159, -0.022240099301092661,
+            -0.033179515231208247, -0.031626173173151986, 0.010241871645540574, -0.0086675021641216751,
+            -0.12229579436613439, -0.13206484273655963, 0.025898146024799076, 0.013058817907301417,
+            -0.0070474881096094632, -0.04365783724727873, -0.049452989440303838, -0.046595519190300964,
+            0.0026405613941781008, -0.016382296730421797, -0.07819779907751731, -0.073476755024122195,
+            0.0030534986583167431, -0.011160374326329525, -0.019337735006876629, -0.024360726013923847,
+            -0.012139596445667228, -0.010734182759375918, 0.0078666583458712868, 0.0053926864817451011,
+            -0.054185440239584062, -0.067855262329907406, 0.022978385704536496, 0.022403698856694416,
+            0.0095100082613725403, -0.022371149762963734, -0.038504132905076531, -0.036878902106442776,
+            0.0321472863356295, -0.037585596696346937, -0.14197324600134065, -0.12638009337674971,
+            -0.1773581476198211, -0.12514340778164837, 0.11173004587397473, 0.077913629596551362,
+            0.056144416648859587, 0.19400795278436334, 0.016731864303905358, -0.026136105740951997,
+            -0.08079965435825108, -0.063925592429139269, -0.091003781311021603, -0.078209440117943826,
+            0.045163573654113852, 0.041440993081094737, 0.035501182781559962, 0.1046723125684856,
+            0.0048944696650331278, -0.023489481694772284, -0.040280951955225353, -0.014235802581987665,
+            -0.023471290259514086, -0.054392522945124255, -0.018095060689356086, 0.014264870498787257,
+            0.025519599822160254, 0.039527242042638307, -0.013599997869927693, 0.0023459961419227157,
+            0.045822150665254413, 0.05728439435359034, 0.077726261042472003, 0.025981475599847231,
+            -0.074050620850184878, -0.031128744688107363, -0.010804244465298211, -0.074454662060401411,
+            -0.0064740985747844476, 0.02921045318010362, 0.051327120456195599, 0.019354263229230204,
+            0.031416080663249094, 0.06824749047101028, 0.020259883049725577, -0.018617179500014725,
+            -0.031979043355969371, -0.051238426160135714, 0.011347882848099709, 0.046189509423477666,
+            0.012347184375204732, -0.061363400783954601, -0.0744257360735507, 0.074087166537518831,
+            0.15692247425975867, 0.019463612119852078, -0.036976217960960643, 0.03505523237054238,
+            0.012998538606760278, 0.0068338293208487205, -0.034260706556715204, -0.057308120540947992,
+            -0.076092967486415919, -0.006779799624462457, 0.08870928270815652, 0.02852483426801684,
+            0.001656719244127882, 0.066059013401770991, 0.0020064119524507537, -0.0012736938963439372,
+            -0.007734643630069692, -0.008189842580798655, -0.011282593184331878, -0.0056780627589949903,
+            0.0090918759480786409, 0.0047178595590802253, 0.0024800107239485729, 0.011505843140463089,
+            -0.012944302161921561, -0.023037885102553703, 0.017064462323172023, 0.061642425074899483,
+            0.079002187987591607, -0.025535670742644869, -0.12041331517348614, -0.026210888322017786,
+            0.013855977485329402, -0.056656848064351492, -0.032416624363367008, 0.0056206196285368531,
+            0.10925077894852903, 0.13653358702026755, 0.18526070964205887, 0.06198601893061538,
+            -0.17644843220528919, -0.074201608114070006, -0.025780207055866415, -0.17748449284733314,
+            -0.00033557570065667966, 0.0074611480588450216, 0.006533303912984444, -0.076522882643669993,
+            -0.048090683764894074, -0.030831847504426076, -0.0035860675652201295, 0.076302964647086552,
+            0.10823222408406936, 0.119743146403577, 0.010475926313871602, 0.0046439166071476565,
+            -0.0091468015944611153, -0.047679651552271704, -0.030680732303570386, -0.01332952965496919,
+            0.0098701198473964795, 0.042786475795290366, 0.056412861373089991, 0.053176525232468824,
+            -0.028246249005941575, -0.0044600252446155876, 0.027082650426909272, 0.0043273833080114971,
+            0.0051242412455160371, -0.0016744173482294402, -0.034029846819207059, -0.016283722527789646,
+            0.0014032240925058921, 0.041320890999148034, -0.056417016721396554, -0.012967665918206885,
+            0.048436096306078272, 0.02719643371561991, 0.022182903040474346, 0.010830006051823143,
+            -0.068420537009741766, -0.064626217737176778, -0.035375652702503084, 0.048882709201106787,
+            -0.02955811361355172, -0.012422344055652842, 0.008905094193070541, -0.045588688092232994,
+            -0.024559383604906927, 0.016056475487866196, -0.044613634788620231, -0.04377295169776526,
+            0.0046037967885378828, 0.094374636888782171, -0.026830738502934971, -0.010357018391445117,
+            0.01334805012587513, -0.0060793879739806465, -0.00064511797755622061, 0.015645517006332672,
+            -0.036636421600636612, -0.048437933938279665, -0.022298748953936583, 0.03999723738563038,
+            -0.027286272264943071, 0.015400675132153631, 0.067326638334494371, 0.049952843577800554,
+            0.030690701506531682, -0.055716666117187376, -0.017755202962553576, 0.085200190734353337,
+            0.065932060560743702, 0.020029755372249644, -0.012980799819934496, 0.036693584367994171,
+            0.091465663107938772, 0.073132275159160931, 0.041343738792847758, -0.10915539204798085,
+            0.012287876431340833, 0.19853583730188512, 0.1443309507821737, 0.005302499550332837,
+            -0.01898055657190599, 0.01001259757204935, 0.053051692607839054, 0.10928630659653235,
+            0.067388812103836432, -0.028583289750554207, -0.0056414358460587276, 0.024884812176085652,
+            -0.024147967644170033, -0.088102377647340233, -0.019929152428193077, -0.024072429947952216,
+            -0.01344472131834298, 0.065038999239097187, 0.044459261678398636, 0.068237500761861442,
+            -0.029540072723770426, -0.16336084202204809, -0.16588985752058655, -0.098902209055625662,
+            -0.0090177330792379374, 0.0022720130450219521, 0.016115488477846451, 0.0062859723485920596,
+            -0.0022804307714841317, -0.010457848751532762, -0.014036396776245757, 0.0008518482079015819,
+            0.035916000699697123, 0.060864995010238808, 0.034372586851368792, 0.026685967883964823,
+            0.023640130334805481, -0.022245303696289916, -0.086150661406602769, -0.11779737383330141,
+            -0.141478879406712, -0.18204970657610359, -0.11020677497844256, 0.010060888528588496,
+            0.030285863647162251, 0.025930371255543868, 0.026646945840781127, -0.019483186498460075,
+            -0.082393845909092642, -0.11457376698393913, -0.1379919978863326, -0.17263277968242663,
+            -0.09527829322222528, 0.025418397737042235, -0.019440029315469655, -0.021275301473137023,
+            -0.028249612622942753, 0.012281296778265888, 0.065313514154787866, 0.094199406341183456,
+            0.11412104541226183, 0.13423678751622625, 0.057660388840360739, -0.048029741331541309,
+            -0.030794336890101179, -0.030843227793255684, -0.037870277533657418, 0.019593077754112731,
+            0.095791493584141074, 0.13646900983915203, 0.16500818350041924, 0.19818116409638339,
+            0.093496564989095393, -0.056508098750362598, -0.035669546560014836, -0.043471355548245341,
+            -0.062505920698724085, 0.022319221744947805, 0.1317390772317473, 0.19262100821129891,
+            0.23385644680648549, 0.26873618526575749, 0.10244940858599833, -0.11849484592923611,
+            -0.012469816773506989, -0.031947911340277101, -0.062165133137150129, 0.0069900264253963239,
+            0.091001381519732971, 0.14205410712574876, 0.17415660703046235, 0.1786834174410544,
+            0.023165667880837508, -0.15613695280129825, -0.018987463297483905, -0.056354460467477517,
+            -0.11320846133367041, 0.010269586560654773, 0.15924857280362092, 0.25068407531012771,
+            0.30770476146097686, 0.31106950913576342, 0.029452593237244071, -0.29053316257181322,
+            0.013311951188941067, -0.033172482437522764, -0.09555348379458313, -0.010725901683762022,
+            0.08337732437563973, 0.14844161943460746, 0.18520946282804054, 0.14958330397499858,
+            -0.075537749447451091, -0.29405258629979458, 0.083255197648983231, 0.030349857977672878,
+            -0.025258989768097498, -0.055544583501968441, -0.11666717230492388, -0.13238537948152485,
+            -0.15354158059876868, -0.26750332906571406, -0.29282956960489037, -0.21043784059798837,
+            0.031275177174868683, 0.045752944340268054, 0.034423594490309274, -0.048173355985327057,
+            -0.071865392782978446, -0.047860602195244302, -0.04557134076718905, -0.068074371250233329,
+            0.043429875200059996, 0.079789312977571067, 0.0058926495472937102, 0.0086204489025462055,
+            0.0064858522576985191, -0.0090764858901154453, -0.013540373308867776, -0.0090175590143621587,
+            -0.0085862324309109676, -0.012826095618487113, 0.0081827525070681043, 0.015033342780675533,
+            -0.06981413455550961, -0.1021321860024164, -0.076842201218987716, 0.10753515920774985,
+            0.16042179948598398, 0.10683701335676075, 0.10172680072783234, 0.15195927708650814,
+            -0.096946505977986014, -0.17811000082148071, -0.066397864542565049, -0.097134471333059427,
+            -0.073082021286593746, 0.10227305659661516, 0.15257175326689321, 0.10160907366622347,
+            0.096748923095288458, 0.1445233341387859, -0.092202546272104266, -0.1693944039199943,
+            -0.046132593696655143, -0.067488090630908659, -0.050776681114246068, 0.071058329941651385,
+            0.10600537760571768, 0.0705970010275319, 0.067220215446577275, 0.10041341388677399,
+            -0.064061436828909663, -0.11769359247266981, -0.060479517268011873, -0.088476428824619327,
+            -0.066567884356435778, 0.093156988332389973, 0.13897233065982945, 0.092552189256682557,
+            0.088125246275834596, 0.13164130417287792, -0.083984108944401462, -0.15429550103100495,
+            -0.080153749466716412, -0.11725816987413644, -0.088222687056022236, 0.12346133436844588,
+            0.18418059332634973, 0.12265979170108081, 0.11679274621826241, 0.17446475419745899,
+            -0.11130448012149385, -0.20448845315142516, -0.054527545555115721, -0.079769196601045811,
+            -0.060016738074611754, 0.083989128130135274, 0.1252956444307208, 0.083443849155665509,
+            0.079452574986125138, 0.11868608637222031, -0.075718979469992578, -0.13911081538786391,
+            -0.015789970466684063, -0.023099393997268566, -0.017379519141329181, 0.024321392778570761,
+            0.036282845762156561, 0.024163492054902969, 0.023007707384606748, 0.034368864021752238,
+            -0.021926540749760002, -0.040283413533632483, -0.042391334138542618, -0.062014943688599236,
+            -0.046658795508311049, 0.065295643849778942, 0.097408556998003312, 0.064871727772681631,
+            0.061768792637108737, 0.092270090167825142, -0.05886618454332318, -0.10814888140217775,
+            -0.0022709192819664924, 0.0050417943813773312, 0.0021087525038660793, 0.0013443419186313984,
+            0.0002331850873164792, -0.0046320620638745482, -0.0088869363504150301, -0.01209263334048199,
+            -0.0062973156312340619, 0.0087407919513538147, -0.020796589752683531, 0.046171667218437185,
+            0.019311501320677112, 0.012311193793247809, 0.0021354588143551899, -0.042419426888634315,
+            -0.081384649338020365, -0.11074173204159603, -0.057669460454151208, 0.080046290402912515,
+            -0.035849154754766764, 0.079590705162886702, 0.033289159791330881, 0.021222031917666442,
+            0.0036811032202225171, -0.073122594484172049, -0.14029083246231, -0.19089656222399692,
+            -0.099410597459999278, 0.13798376975863211, -0.018581089371906351, 0.041252911426259038,
+            0.017254210243719731, 0.010999658831933172, 0.0019079643129681337, -0.037900404417077788,
+            -0.072714587383534063, -0.098944204061104837, -0.051525822813806847, 0.071518806379020111,
+            -0.012223578410198841, 0.027138247245625836, 0.011350690349675972, 0.0072361307524229793,
+            0.0012551552234977693, -0.024932798927863192, -0.047835325618300548, -0.065090491325242694,
+            -0.03389628684886746, 0.047048680520290188, -0.020294411564514832, 0.045056753453044905,
+            0.018845183772494306, 0.012013913659013824, 0.0020838935889478183, -0.041395119000109455,
+            -0.0794194427231215, -0.1080676358069412, -0.056276907852598111, 0.078113401330127258,
+            -0.04115510662528285, 0.091370744436436405, 0.038216212629005805, 0.024363056600674397,
+            0.0042259349366329411, -0.083945303405327104, -0.16105495953899304, -0.21915072827997142,
+            -0.11412413391993129, 0.15840643373104629, -0.020435799988944032, 0.045370657769036989,
+            0.018976475622627602, 0.012097612972890285, 0.0020984117941336548, -0.041683513203404236,
+            -0.079972747254271406, -0.10882052843011282, -0.056668981468910244, 0.078657606847284678,
+            -0.010296854878356052, 0.022860621019782822, 0.0095615545119138948, 0.0060955463071551376,
+            0.0010573132312370751, -0.021002803242725913, -0.040295352917242497, -0.0548306985602275,
+            -0.028553434590537344, 0.039632701593451371, -0.01817885883941921, 0.040359897018034024,
+            0.016880703070105377, 0.010761545848319046, 0.0018666620251306958, -0.037079962754857039,
+            -0.071140512440055065, -0.096802328572028959, -0.050410427546478162, 0.069970616873179167,
+            -0.0041196669262568266, 0.011788712467364444, -0.0094465569859091218, 0.00073572508230867345,
+            0.037099210641891783, -0.014211474301553869, -0.05766148686017205, -0.060240955831773912,
+            -0.028264238674985002, 0.056417135421917231, 0.0018530918934697674, -0.0053027509016531464,
+            0.0042492120079459751, -0.00033094087707895102, -0.01668781669130771, 0.006392547818517896,
+            0.025937056509343887, 0.02709734279614702, 0.012713705379890748, -0.025377327384603063,
+            0.002379775249601587, -0.0068098918326861355, 0.0054569174914933438, -0.00042500046065134739,
+            -0.021430806141784161, 0.0082094294049922661, 0.033308852812949465, 0.034798914151794383,
+            0.016327178107254588, -0.032590038207892157, -0.0029971741725580863, 0.0085766216462072123,
+            -0.0068726373089317821, 0.00053526080002839029, 0.026990724723272987, -0.010339249384243748,
+            -0.041950362071050393, -0.043826998682453502, -0.020563032808250215, 0.041045061215645676,
+            -0.0035810316513482576, 0.010247370292295346, -0.0082114452863164909, 0.00063953102364807854,
+            0.032248589492006006, -0.012353362589054635, -0.050122403875425589, -0.052364614276490702,
+            -0.024568766142545408, 0.049040748012086154, -0.0056082539053086133, 0.016048407290472137,
+            -0.01285994500436039, 0.0010015695783057315, 0.050504518129892519, -0.019346601965295328,
+            -0.078496700014359655, -0.082008225871318383, -0.038477146275897121, 0.076802718695459724,
+            -0.0089256114303917569, 0.025541255793685064, -0.020466775232212343, 0.0015940114387467906,
+            0.080378619070705301, -0.030790376925913684, -0.12492855258086727, -0.13051719315531043,
+            -0.061236895191909911, 0.12223255855525239, -0.0099964819409429154, 0.028605625987840014,
+            -0.022922323091670645, 0.0017852565827402749, 0.090022226515743417, -0.034484522354029025,
+            -0.13991713951723792, -0.14617628994211698, -0.068583930824162392, 0.13689768748304085,
+            -0.010224116616007167, 0.029257018389208897, -0.023444298282494433, 0.0018259095148937309,
+            0.092072165724610605, -0.03526978591846907, -0.14310325967211732, -0.14950494020724547,
+            -0.070145688340458645, 0.14001505025039759, -0.00076889893790883508, 0.0022002576076472062,
+            -0.0017631152623206014, 0.00013731649779124956, 0.0069242354225285303, -0.0026524444068375288,
+            -0.010762000132208401, -0.011243434915198384, -0.00527526702692541, 0.010529753080107807,
+            3.9868216360740241,
+            0.0037972367857535038, 0.023661139048641488, 0.03623621374909812, 0.0095729468697561895,
+            -0.043471410376289349, -0.079167931096704905, -0.036403888582441833, 0.032408575779943008,
+            0.01740865506679827, 0.068404713780156029, 0.017956202118834214, 0.049518360062805307,
+            0.05360376539907695, 0.01880520893361079, -0.045633580969275306, -0.10606654444744999,
+            -0.066407782143259292, 0.041971182958899497, 0.018802316039513694, 0.094481630786909215,
+            0.0043541004771598469, 0.020037616820436407, 0.028158428145772612, 0.0079671249049510975,
+            -0.031657013373204555, -0.060263558035824415, -0.029716747059323319, 0.024505019123830567,
+            0.012737463325566698, 0.052392934625434977, 0.012233811306397009, 0.0029419620429736344,
+            -0.021618628889981846, -0.0002541131811087758, 0.047877489342129986, 0.060211178827009243,
+            0.0069644438610028947, -0.026350727249639518, -0.018552925874116305, -0.048693539425058864,
+            -0.0024712774532685581, -0.011359491386077124, -0.015956801659840515, -0.0045162729287919886,
+            0.017933478392704691, 0.034146628278067401, 0.016843835796562102, -0.01388460369824533,
+            -0.0072158625178925222, -0.029687878194061438, -0.0044709386670480772, -0.012767614940654591,
+            -0.014173730270033512, -0.0048681628657595861, 0.012485447120386401, 0.02829371096889647,
+            0.017277474472035849, -0.011231902605337334, -0.0051276588753663439, -0.025133111752679866,
+            -0.023061910179159411, -0.028009562884241501, -0.0016564521092158812, -0.009052163965882383,
+            -0.032650664273180689, -0.01687007848830558, 0.024954932501962311, 0.0095933752263322875,
+            0.012096320776424981, 0.0093171844680544468, -0.024515995529588358, -0.027498603003152475,
+            0.0025379042921490624, -0.0086567987012770159, -0.040548186760635194, -0.027728916531919036,
+            0.022668083617559773, 0.014260935573330039, 0.015177981357618251, 0.018264597379224558,
+            -0.017557790716626498, -0.02289163788800793, -0.0042195517156273996, -0.0075565933594284804,
+            -0.020839715862630306, -0.0061027020699959177, 0.021655670466194175, 0.0045078053759844746,
+            0.0076134071088030083, 0.0013401458150678082, -0.024871836451296508, -0.028166253043916824,
+            0.0020678011120455449, -0.0088963793028968285, -0.04044817677731416, -0.026976288482415098,
+            0.023452331453575476, 0.013988831890620557, 0.015124817438089048, 0.017543846034629374,
+            0.019255517860633779, 0.033008174771388975, 0.012756242191155724, -0.0023459144335272551,
+            0.0018573995510711826, -0.025192688106434342, -0.047129995393728377, -0.01163679331941281,
+            -0.00593214606338365, 0.0044681889698398054, 0.10001729682682348, 0.1287964096074323,
+            -0.0061487345237212984, -0.026027323033306397, 0.033031413704399527, -0.012950619374239775,
+            -0.10380435137504257, -0.0013328078134329513, 0.021317613819445233, 0.0068551676276214675,
+            0.17216786090087141, 0.20478652242998371, -0.039308086832685454, -0.05029406636695509,
+            0.066135871873172339, 0.024479815856281541, -0.1227530029008477, 0.021154944718531278,
+            0.057375710088633486, 0.0053129493557237421, 0.17063952896812731, 0.18864017407189115,
+            -0.063281810588407691, -0.054497375526668258, 0.07340369140143771, 0.063868660165214655,
+            -0.074299792490413269, 0.040823433360192812, 0.074377738266356047, -0.00022760597508329674,
+            0.15294488198264725, 0.16741495885321658, -0.059544340441168006, -0.049386192643021153,
+            0.066704212502299548, 0.061845216349961846, -0.061094842860254697, 0.038896125202656624,
+            0.068698662917346706, -0.00084195487884999084, 0.0079875988628077526, 0.0093368849532889445,
+            -0.0021021151215127962, -0.0023865860809947647, 0.0031582472013517576, 0.001589134043480038,
+            -0.0051528156942960606, 0.001208782564394946, 0.0028623730693545816, 0.00018360193170522868,
+            -0.076844795738270424, -0.092489598878585016, 0.015701301931744543, 0.022095686169673719,
+            -0.028923555376077433, -0.0079246205770958696, 0.058378661742098339, -0.0079373841271742109,
+            -0.024281746902687508, -0.0027876884000342748, -0.088320870283582334, -0.11604907942569828,
+            0.0015005559263197472, 0.02223245182888179, -0.027899692865946839, 0.017834161334073614,
+            0.09931623073053511, 0.004384558571244028, -0.015995834828733915, -0.0069409078438597577,
+            -0.085875939797069256, -0.11215552715018361, 0.0026150860749344883, 0.021838011006618047,
+            -0.027500711330321982, 0.015457968046233003, 0.094315708608978838, 0.003319403984627517,
+            -0.016385356207779533, -0.0064876632316478132, -0.033080735523549183, -0.04244878813089064,
+            0.0022894126173685801, 0.0086574265205832789, -0.011007727944192906, 0.0038670175691781876,
+            0.033835344979575993, 0.00023206616364413683, -0.0072349105418727973, -0.0022095925790866361,
+            0.056922204210869611, 0.033947961776502923, -0.020791129338346651, -0.026783161360213723,
+            0.032151492748411649, 0.029910008865534111, -0.015759314744825757, 0.0084968040036393477,
+            0.0081189630979254072, 0.0051500745152576882, 0.018757439156784083, 0.011186791452429196,
+            -0.0068512516156286766, -0.008825791738131715, 0.010594805267800132, 0.0098561743919079632,
+            -0.005193129668408591, 0.0027999317021344425, 0.002675422683235275, 0.0016970918591800359,
+            0.10016858031335982, 0.059739765577018086, -0.036587091765078572, -0.047131541846440694,
+            0.056578437680188991, 0.052633996992134162, -0.0277323797731493, 0.014952210759310346,
+            0.014287307008052374, 0.0090628193312807109, 0.14361351382202781, 0.085649987476916656,
+            -0.052455578310828012, -0.067573348002362824, 0.081117534224739787, 0.075462317933343681,
+            -0.039760416823414933, 0.021437256271722275, 0.020483971681156215, 0.01299352876149161,
+            0.14395067488971616, 0.085851067726655531, -0.052578728133701964, -0.067731989773275741,
+            0.081307973645930703, 0.075639480618160199, -0.03985376224914227, 0.021487584461740938,
+            0.020532061847455436, 0.013024033634700777, 0.049040462145592878, 0.029247351846271589,
+            -0.017912282305586034, -0.023074626659908136, 0.027699631188064591, 0.025768514727763814,
+            -0.01357719872057471, 0.0073202926850016239, 0.0069947695804310752, 0.0044369686278636616,
+            -0.0096561401371724857, -0.005758847199081072, 0.0035269551009905714, 0.0045434284036622334,
+            -0.0054540986931539788, -0.0050738589819843615, 0.0026733706776026016, -0.0014413765474240469,
+            -0.0013772805626372649, -0.00087364574028060411, -0.020937445890213128, -0.012486930585917568,
+            0.0076475103442134491, 0.0098515333255706841, -0.011826143225509582, -0.0110016679937059,
+            0.005796679947850992, -0.0031253423252357799, -0.0029863627542903504, -0.0018943294271303506,
+            -0.059213650871801971, -0.035314562819745252, 0.021628092076523081, 0.027861337908695924,
+            -0.033445775563416734, -0.031114059040567528, 0.016393717956212948, -0.0088388493167584452,
+            -0.0084457981377642488, -0.0053573946852184745, 0.032150624115329908, 0.019174383242690992,
+            -0.011743181655687664, -0.015127582732434466, 0.018159707137685811, 0.016893679112629036,
+            -0.0089011276302493822, 0.0047991386751406609, 0.0045857277381712701, 0.002908849230303906,
+            0.018457996112559966, 0.057790893789970099, 0.042776366223385279, 0.012033374625082789,
+            -0.023196221227854544, -0.03729901492506859, -0.010841943801893466, -0.01675596170349742,
+            -0.010325398609748267, 0.0071003029248682048, 0.0086200863862149514, 0.026988980481317513,
+            0.019977031628207881, 0.0056197177718179895, -0.010832889420850972, -0.017419048569201366,
+            -0.0050633065256317014, -0.0078252176719212068, -0.0048220742623067709, 0.0033159192475401373,
+            0.014933780760770912, 0.046756784028204837, 0.034609004738482635, 0.0097358227495198506,
+            -0.018767328814171928, -0.030177453071661919, -0.0087718737597902996, -0.013556718561969577,
+            -0.0083539533850385886, 0.0057446304879699202, -0.00017978390828325547, -0.00056289278020128244,
+            -0.00041664882010474322, -0.00011720704169299406, 0.00022593499772756857, 0.00036329852045972053,
+            0.000105602310142728, 0.00016320581409427548, 0.00010057107528481205, -6.9158114566901041e-05,
+            -0.017502727310530274, -0.054800003687798915, -0.040562532832793603, -0.011410603480675878,
+            0.021995731947825378, 0.035368654495524857, 0.010280833559798417, 0.015888779406689826,
+            0.0097910214704172282, -0.0067328362818087567, -0.0082605199642712904, -0.025863199287396579,
+            -0.019143737220033843, -0.0053853045976324969, 0.010381021178022715, 0.016692454346467506,
+            0.0048521027245263162, 0.0074988073097556262, 0.0046209328918888348, -0.0031776035548808602,
+            0.00055851089677671345, 0.0017486645743846935, 0.0012943477999767842, 0.00036411161927441882,
+            -0.00070188238424129148, -0.0011286114780635779, -0.00032806073414859042, -0.00050700992352081939,
+            -0.00031243086204701357, 0.00021484437041657109, -0.0089395655534135823, -0.027989250852331452,
+            -0.020717423909877693, -0.0058279967464350997, 0.011234379885733425, 0.018064636430035388,
+            0.0052509636881709395, 0.0081152372741576002, 0.0050007908320102183, -0.0034388144335322584,
+            -0.0010808753484884603, -0.0033841567678188334, -0.0025049262913924755, -0.00070465818239760455,
+            0.0013583394183408677, 0.0021841799895047421, 0.00063488960089170849, 0.00098120650990944506,
+            0.00060464141137182533, -0.00041578415942282709, 0.001935743200226898, 0.0060606974346932132,
+            0.0044860806959964947, 0.0012619746457979018, -0.0024326545113000759, -0.0039116550938719102,
+            -0.0011370258647674346, -0.0017572459509153592, -0.0010828542831283763, 0.00074462921232344758,
+            0.0035818473638116574, 0.007931413962179161, 0.039652176743050389, 0.043130742740576475,
+            0.040226704620651046, -0.033815034457880533, -0.010559921778335443, 0.02497635055953969,
+            -0.010792265419507691, 0.0073121024560270746, 0.0040328559895415634, 0.0089300986485558505,
+            0.044644984063865883, 0.048561554004805538, 0.045291853669687035, -0.038072857494658059,
+            -0.01188957525748152, 0.028121249936161673, -0.012151174468659596, 0.0082328064796568356,
+            0.00072548945101159456, 0.0016064774896057308, 0.0080313963758962131, 0.0087359665821395115,
+            0.0081477647948083459, -0.0068491055851915084, -0.0021388716702705375, 0.005058864048419676,
+            -0.002185931984002252, 0.0014810383184275066, 0.0016318581417439373, 0.0036134824114755822,
+            0.018065182818722374, 0.019649986878774735, 0.01832693266440083, -0.015405832155483693,
+            -0.0048110074438844587, 0.011379005544296203, -0.0049168611623762173, 0.0033313295386869124,
+            0.0056514043996577848, 0.012514108840658972, 0.062562823967801648, 0.06805127201880927,
+            0.063469308539981506, -0.053353036882755986, -0.016661343250154483, 0.039407446242871194,
+            -0.017027932817655217, 0.011536965089088818, 0.0014890197553367544, 0.0032971902144012005,
+            0.016483916961128012, 0.017930001331693448, 0.0167227555471555, -0.014057342265303963,
+            -0.0043898945280626172, 0.010382988335883305, -0.0044864827510080509, 0.0030397345012726307,
+            -0.0061666875693657565, -0.013655118970791542, -0.068267170703625882, -0.074256043907126937,
+            -0.069256306632992731, 0.058217654597983996, 0.018180489493175418, -0.043000534327552013,
+            0.018580503926597106, -0.012588881306635713, -0.0032190267519333986, -0.0071280071794414136,
+            -0.035635638469094261, -0.038761845665284303, -0.036151969965074013, 0.030389765247180092,
+            0.0094902622167049207, -0.02244638937692393, 0.0096990707784910882, -0.0065714283798461552,
+            -0.0033643726876720864, -0.0074498519335509409, -0.037244663686366898, -0.040512025817032206,
+            -0.037784308652602676, 0.031761928079960991, 0.0099187678330263825, -0.02345989181705881,
+            0.010137004547525114, -0.0068681424119475792, -0.0056451589007227845, -0.012500279206835292,
+            -0.062493684330495708, -0.067976066969433466, -0.063399167125412825, 0.05329407519616168,
+            0.016642930410767018, -0.03936389615405507, 0.017009114851578612, -0.011524215319636573,
+            -0.0089270415306399505, -0.010865596202406531, -0.004036174226752935, 0.019163294743227793,
+            0.04865931848894349, 0.02950425816795671, 0.0098724090098387205, 0.0080400398125237207,
+            0.0057287180835248388, 0.0061850951917346835, -0.00098866261745115917, 0.00668879247930878,
+            -0.0042965606184496921, -0.027486083237544232, -0.028952125462079099, -0.0018089577247978814,
+            -0.01766893344214002, -0.015618674107508501, 0.0017008991444763322, 0.0023188032339315338,
+            0.0019036085706071889, -0.0066669288124176695, 0.0052427663247857159, 0.029617914095771192,
+            0.028715567205817083, -0.00051271165794325273, 0.019252594800524932, 0.017078440241097469,
+            -0.0024355722119540619, -0.0031787374477440971, 0.059227810113544721, 0.014646948814391304,
+            0.054797367584571141, 0.088361074817245366, -0.072888090672027145, -0.15880127193777671,
+            0.071060164354598651, 0.066817576766525777, -0.045770123641004495, -0.052927525145701704,
+            0.049611968112509765, 0.0011911250200472255, 0.051304267746117523, 0.11557527835154321,
+            -0.012851447213806017, -0.1258936415353423, 0.085859055764037323, 0.079142565611250132,
+            -0.039836107727303526, -0.046627857806931593, 0.034043975218945824, 0.0087940784715964913,
+            0.031314429109630969, 0.049382627881049634, -0.043527839226413997, -0.09151976444956092,
+            0.039953547987931354, 0.037621998093371835, -0.026257855420436772, -0.030344946879211829,
+            -0.010063657802807583, 0.0054658498273177335, -0.013190870385078483, -0.04485643153259028,
+            -0.022228016205424247, 0.021865935745921477, -0.030984854401460062, -0.027992961615922334,
+            0.0088518872167618005, 0.010639881457845106, -0.061056900002609084, -0.047828785150084249,
+            -0.040525146578574901, 0.031699051078677543, 0.21755493686236493, 0.18475828150391232,
+            0.0045543918004650741, -0.0004162086635011164, 0.042760945107115783, 0.047786483667257254,
+            -0.050782132589294315, -0.040960846168443157, -0.03312955217183073, 0.030794511916401573,
+            0.1860823067035359, 0.15442633882026105, 0.0065950748091786124, 0.0021238266568708759,
+            0.03540549889898157, 0.03950044541083373, 0.020067512566590919, 0.018237056283140565,
+            0.012091537340739653, -0.019862151942202838, -0.082456731517819806, -0.062343495442675825,
+            -0.007481156532334424, -0.0051288140274913206, -0.013714053013667691, -0.015184831182461073,
+            0.02378729216480182, 0.03912349178300932, 0.027254053829123045, -0.04023816639756389,
+            -0.05578260308177925, -0.017724115246187215, 0.0053685368038138333, 0.0067951189065354189,
+            0.0011074133312403284, -0.018299741110859413, 0.014309058687440087, 0.029804115444577502,
+            -0.011365655298795921, -0.06981167968402649, -0.029079922548566464, 0.025060758889319128,
+            -0.019066645416244338, -0.0083816930007008413, -0.0054345233766378625, -0.017380422371886358,
+            0.0055567697720894926, 0.0050598042154929353, 0.024429477665484374, 0.020275504154305658,
+            -0.015943163525012939, -0.027384238069144803, 0.015761623278488866, 0.0097008036527509098,
+            0.0042282647834923784, -0.00012851968039213641, -0.012920456748822546, -0.060072019457481779,
+            0.15708519930653353, 0.30424964835741675, 0.0025862378094323873, -0.21156443142859568,
+            0.13513953623283095, 0.073517794012396484, 0.037173464655243259, 0.049396987319191746,
+            0.012635178538543887, -0.024225460650548637, 0.21375209104678008, 0.30601355382928902,
+            -0.061758705789567853, -0.26584828904979213, 0.16290336009336831, 0.093119607608836447,
+            0.04438183511210083, 0.03602350287181813, -0.00095330491540920642, -0.0021020249730117854,
+            0.0012725936514549785, 0.0054977470041950721, 0.0018542826722707756, -0.0023328235739055658,
+            0.0016842084706652789, 0.00078990916781863322, 0.00047532468182569801, 0.0012762339308910427,
+            -0.033577646004075139, -0.026718709236884949, -0.16469178156139611, -0.15056666548210787,
+            0.099091642561072946, 0.18744339576067226, -0.10895444257101057, -0.066287375124700607,
+            -0.029301951140294925, -0.003142488702302746, -0.066027395748732273, -0.1008582188362078,
+            -0.10991384953091095, 0.05539954604495563, 0.16036233710005307, 0.09328903962597393,
+            -0.04242112631103323, -0.034251974098331993, -0.010603809423875579, 0.042930127257506036,
+            -0.050740919080904792, -0.077131477474174148, -0.086133173532138424, 0.039836108345549133,
+            0.12350434708596655, 0.073835229241544426, -0.033938200966648346, -0.027070505405689262,
+            -0.0085150315238932441, 0.032608571798579504, 0.047691484135886475, 0.073125271445524415,
+            0.078170606241829171, -0.042019317653490658, -0.11563276862767621, -0.06581260075824176,
+            0.029660851943826446, 0.024192151951090396, 0.0073910038030896149, -0.031288414114627863,
+            -0.096652860738104474, -0.034838610790070682, 0.000357219418428395, -0.021585400780223557,
+            -0.031467184123649933, 0.0090415306137369214, 0.054758425426497018, 0.025567711418914882,
+            0.023007190298693747, 0.013761937681349088, 0.043178305605779788, -0.069801498600595202,
+            -0.024732238719247433, -0.016844272787650952, 0.029380478749318047, 0.012976411918244146,
+            0.019530246476845047, -0.027308064214820772, 0.00073090324261829804, -0.0044114379574951542,
+            0.12526836999228588, -0.062647871768546012, -0.022284336759144187, 0.0038802359331124381,
+            0.047346959442007952, 0.010197471067627735, 0.0043880035145593774, -0.049014973866086768,
+            -0.0078349651994823761, -0.01313766809207159, 0.19472804529109464, -0.10489869185484237,
+            -0.031401731482220238, 0.0091862949004667682, 0.067448985243517209, 0.01760062990219231,
+            0.022308559198235114, -0.075137454737701614, -0.0064703526074174292, -0.018799755393078526,
+            0.078432538270382546, -0.02985150811813413, 0.038942858490513516, 0.056316224758798175,
+            -0.041732867759417105, 0.006850530215752099, 0.10585702053945152, -0.0061412109107543897,
+            0.037933869151652443, 0.0052416269702708872, 0.090795605803635923, -0.13561690095975359,
+            -0.049052905642384528, -0.032219723618512518, 0.060137264846972807, 0.025049929589556368,
+            0.034759317140804331, -0.055463940784745765, -0.00012971253011235476, -0.0095738921295896919,
+            0.097711578619184947, -0.17897270702580165, -0.10686984133090187, -0.090188752008802539,
+            0.13253354691684438, 0.031468318099751931, -0.041421454814865165, -0.08608357154833797,
+            -0.034994249200069626, -0.02175929901992987, -0.068522890826246935, -0.061576151998473355,
+            -0.026396104312095655, -0.04302909860597981, 0.006572670683238648, 0.013015098032935612,
+            0.023347384349920113, 0.0039798421634654642, 0.0069969128954213309, 0.0061441207525750711,
+            0.29865710245179622, -0.08164562739014225, -0.026546083680899075, 0.03746294667009973,
+            0.090881937181979788, 0.011144340808609422, -0.009188244871985678, -0.10103578131446928,
+            -0.021190405800264732, -0.030770215459220332, 0.24432905580316647, 0.22744853965248732,
+            0.11180951521103136, 0.17153391622751829, -0.04626029559020587, -0.047262921612613917,
+            -0.054158300263301366, -0.00571802702685127, -0.012435636084439842, -0.017872957307216452,
+            0.0074748310865389526, -0.041114016408491272, 0.0010859306435063595, 0.017572655132441762,
+            -0.011219052784921904, 0.036076419384283957, 0.047217231333495369, 0.032058233542554486,
+            0.029137002825570354, -0.035975795556120523, 0.0053212819082536023, -0.029268791382341054,
+            0.00077306671147591148, 0.012509854838678282, -0.0079867681183668996, 0.025682559988529228,
+            0.033613628982898179, 0.022822040549889153, 0.020742436076670215, -0.025610926562951285,
+            0.0054994292975091945, -0.030248660305155162, 0.000798947658725902, 0.012928663317142899,
+            -0.0082541514131083404, 0.026542368036710274, 0.034738955614704969, 0.023586083314686469,
+            0.021436857251411652, -0.02646833644693615, 0.016817229388622991, -0.092500263487473006,
+            0.0024431782498562627, 0.039535792703279865, -0.025241156893414444, 0.081166438850806086,
+            0.10623156580234393, 0.072126133826633215, 0.06555381045292058, -0.080940050591246177,
+            0.031932572941766935, -0.17563959809840293, 0.0046391094436788018, 0.075070604980992911,
+            -0.047927935393377974, 0.15411891989653442, 0.20171260945018374, 0.13695317915950689,
+            0.12447364458944635, -0.15368905362995147, 0.0094957646176802822, -0.052229811989403463,
+            0.0013795284017096207, 0.02232368797548329, -0.014252293228511832, 0.045830224490129481,
+            0.059983123290754455, 0.04072566139011892, 0.037014631808143073, -0.045702395489566436,
+            -0.0090673868623966907, 0.049873594189180609, -0.0013172944159414799, -0.021316610427796034,
+            0.013609336539220505, -0.043762708130818034, -0.05727713417405398, -0.03888842467341936,
+            -0.035344808942367939, 0.04364064581703863, -0.013217063929430194, 0.072698175647776794,
+            -0.0019201523849813925, -0.031072127731899626, 0.019837630599171659, -0.063790651029653991,
+            -0.083489935475513921, -0.056685658483921382, -0.051520311910602086, 0.063612727066655675,
+            -0.010595298569796345, 0.058277608444684277, -0.0015392668089531949, -0.024908593336320384,
+            0.015902595329628028, -0.051136999656625624, -0.066928691474842414, -0.045441368784281053,
+            -0.0413006315181981, 0.050994369075374447, -0.0033381574489056015, 0.018360958065740104,
+            -0.0004849617903933242, -0.007847707720519341, 0.0050102757092525801, -0.016111236053797127,
+            -0.021086570474676526, -0.014316769149680502, -0.013012187418672095, 0.016066298826770544,
+            0.00061255799255431913, -0.00090916678335601915, -0.0015208540182613296, -0.0011762355807960504,
+            6.8132197953608872e-05, 0.0009147060217293857, 0.0011826738157922102, 0.0020628281654715328,
+            0.0023282968910921342, -8.0450541688622103e-05, 0.0099221520009678682, -0.014726590997650741,
+            -0.024634638554868814, -0.019052544189226649, 0.0011035984061473047, 0.014816315016891683,
+            0.019156830064239835, 0.033413480614851755, 0.037713516005994353, -0.0013031296838787486,
+            0.0071256811372927709, -0.010576031457525465, -0.017691583363904407, -0.013682752968646945,
+            0.00079255894740003219, 0.010640467554795988, 0.013757646791317173, 0.023996186364139721,
+            0.027084294777855542, -0.00093585409767511199, -0.0055933107674618378, 0.0083016668145309142,
+            0.013887026631726409, 0.010740291073020117, -0.0006221199642431715, -0.0083522459956270473,
+            -0.01079907905646852, -0.0188358312675715, -0.021259845156030251, 0.00073459964043356225,
+            0.0028574747239848465, -0.0042411022873006729, -0.007094515080818522, -0.0054869310047869534,
+            0.00031782465645439353, 0.0042669418548753595, 0.0055169642326481829, 0.0096227286467676556,
+            0.010861093312137799, -0.00037528755187328901, 0.013693253734013486, -0.020323710738174513,
+            -0.033997499367538903, -0.026293824347393167, 0.001523041875830345, 0.020447536069753983,
+            0.026437746043743906, 0.046112906570174979, 0.052047251828180485, -0.0017984087935697685,
+            0.0025040072172524508, -0.0037164810758840783, -0.0062169288204594955, -0.0048082017038431849,
+            0.00027850998187405231, 0.0037391243080899853, 0.0048345198436645703, 0.0084324042410307953,
+            0.0095175841145916651, -0.00032886475969426729, -0.0068871622692700668, 0.010222018556468279,
+            0.017099390651911826, 0.01322474836717303, -0.00076602951683292942, -0.010284297775724666,
+            -0.013297135259002401, -0.023192958841302375, -0.026177698593274977, 0.00090452812957310901,
+            -0.0036162619564497752, 0.0053673044686077444, 0.0089784258705342367, 0.0069439563834899649,
+            -0.00040222130551515524, -0.0054000055960777872, -0.0069819647754565941, -0.012177993117649654,
+            -0.013745198941029477, 0.00047494316753779399, -0.0035032801253259576, 0.0051996153204306346,
+            0.0086979154960982307, 0.0067270083534803158, -0.00038965482107310216, -0.0052312947759903259,
+            -0.006763829260199976, -0.011797519584920275, -0.013315761647984682, 0.00046010465489839276,
+            -0.031190025148944214, -0.026727660045279607, -0.036119412682550825, -0.018924561272968769,
+            -0.0093049287353270081, 0.0025523776439878628, 0.0083384712635591919, -0.039624168074909032,
+            -0.0080135592498576814, 0.00054324338675615944, -0.037205092661763257, -0.031882150266569959,
+            -0.043085123828066528, -0.022574206092547927, -0.011099405471965884, 0.0030446094961098769,
+            0.0099465644717080751, -0.047265779294255378, -0.0095589924348482725, 0.00064800911335068817,
+            -0.055455905547379815, -0.04752181455113947, -0.064220363035461484, -0.033647894718510124,
+            -0.016544175472999322, 0.0045381307924667073, 0.014825812822954143, -0.070451822711340137,
+            -0.014248118837232883, 0.00096588745284189258, -0.085370316522715789, -0.073156362878222997,
+            -0.098862558737896261, -0.051798476538950824, -0.025468549882944534, 0.0069861209252703432,
+            0.022823256079026102, -0.10845543581162452, -0.021933938378278117, 0.0014869131927524367,
+            -0.079698890382320961, -0.068296349167797504, -0.092294799324901325, -0.048357336270981155,
+            -0.023776591770950806, 0.0065220103251298969, 0.021307033387019666, -0.10125039055955155,
+            -0.020476795936416891, 0.0013881327419662409, 0.043488068646744815, 0.037266219224428021,
+            0.050361084696722222, 0.026386404493689633, 0.012973807416396615, -0.0035587651393066693,
+            -0.011626281446933876, 0.055247744529956816, 0.011173258536932096, -0.00075744105951584004,
+            0.11150141573014249, 0.095548878847361865, 0.12912351401492883, 0.067653532304999528,
+            0.033264247858170316, -0.0091245107826482732, -0.029809253005473518, 0.14165268595915276,
+            0.028647723018163578, -0.0019420441766267538, 0.10645685365304654, 0.091226043593780989,
+            0.12328169059236764, 0.064592742079040755, 0.031759302273671484, -0.008711698436143174,
+            -0.028460618763717256, 0.13524401605098088, 0.027351638872628287, -0.0018541819522657048,
+            0.041346283244242887, 0.035430859622932104, 0.047880803566424733, 0.025086875272740294,
+            0.012334847991340854, -0.0033834961180904261, -0.011053687614572781, 0.052526795625175454,
+            0.010622976062279766, -0.00072013712179203754, -0.075966709627920792, -0.065098132495807426,
+            -0.087972770848479376, -0.046092833981189581, -0.02266316926547943, 0.006216594261008024,
+            0.020309256635562701, -0.096508985036725309, -0.019517897972604996, 0.0013231285458065868,
+            0.0039253935614762137, -0.011258236288065906, 0.003572048717556829, 0.031256418244972634,
+            0.022721207778650394, 0.0096971746075808461, -0.01257151290980687, -0.0074531008030751991,
+            -0.020910940767188038, -0.034138080854753589, 0.00069665332048519544, -0.011687387166371592,
+            0.00048624040625842076, 0.013795346948591525, 0.020667455095513307, 0.034243825714960319,
+            0.0037220048820984959, 0.00025440088503474612, -0.03079482471157359, -0.02975036583357301,
+            -0.0051773597391579253, -0.013022464622550965, -0.0051361882251075991, -0.017499518428977581,
+            0.017882775578232195, 0.080761920997960521, 0.033705207735302341, 0.014366804958799564,
+            -0.050325928671611356, -0.023123248227365861, -0.0033782492536110716, 0.019042089352169469,
+            -0.0029315779787226822, -0.034861634889207599, -0.035611937502930929, -0.039739695606765421,
+            0.0050727021227159191, 0.0048918475705347179, 0.044140032987077735, 0.052249283810340844,
+            0.010126090080399584, 0.015543934009187752, 0.0098942551650142499, 0.042675821380649792,
+            -0.017934642182196887, -0.1246405057397601, -0.059823541277849286, -0.026483542622427938,
+            0.070684511171720588, 0.020955151114176864, 0.0099983506360411152, -0.015448172936677556,
+            0.0092999884673271999, 0.068352912356076642, 0.035163385355343635, -0.019699629947162463,
+            -0.040147863666437869, -0.021136808067477073, -0.016288269115783571, -0.054609613820726328,
+            0.0044868350950091947, -0.022810709047869866, 0.0039313935620479933, 0.044190391998138678,
+            0.043040175851497511, 0.044455783371401783, -0.0082611080966072357, -0.0069008136808522344,
+            -0.051692330673384329, -0.063330872520367176, 0.0052449801759641753, -0.022423241927004574,
+            0.0046603469862678661, 0.048046396567180828, 0.043030207081842985, 0.037729633045449351,
+            -0.012263158540429434, -0.0087572886714183742, -0.048570104151666751, -0.063660143917181833,
+            -0.0030235593725300397, -0.010390478907942239, -0.0030419758485267577, -0.0078485484594256333,
+            0.015225568556965545, 0.056514041295993432, 0.021395067412973645, 0.0088435409250992997,
+            -0.037175934737621021, -0.020314587456026722, -0.0099667854172102721, -0.033299429069311402,
+            -0.010012988667718143, -0.026681720771406073, 0.048555636498220985, 0.18309775727095354,
+            0.069941573917626093, 0.028996754248941846, -0.11988622641860075, -0.064637987485443929,
+            0.020642168449552901, 0.033338236553357596, -0.034273817003244736, -0.082713222856603583,
+            -0.016713801879936034, -0.029248975245197678, -0.092922132312268105, -0.011279009056938641,
+            0.035430529891802419, 0.018899500322427466, 0.0031419087712265563, 0.0049746553806344759,
+            -0.0050701341667775375, -0.012336876500075622, -0.0028051679853721692, -0.0049893550695598822,
+            -0.013934304770286163, -0.0013998525715951649, 0.0055514254589503192, 0.0027097458119566607,
+            -0.049216525670254009, -0.086728165691738773, 0.092366749204024309, 0.21556760895148094,
+            0.020881214891182345, 0.030707090413374695, 0.23674572990705384, 0.049907702213477789,
+            -0.072957146954399268, -0.057183798137145858, -0.068156748521084096, -0.12686387976283495,
+            0.13785387900245019, 0.3156627669412011, 0.011208262091634554, 0.006086924672984495,
+            0.34203839591613699, 0.090600311038850481, -0.090280023323902975, -0.090506996901859857,
+            -0.0092424946503984057, -0.023629911368576676, 0.028144821001800303, 0.059098043369224411,
+            -0.015315527872112156, -0.033814945915071129, 0.059867791622411327, 0.032712759281141174,
+            -0.0020193171891801989, -0.023032121499594764, -0.030197740627615741, -0.050487048742542083,
+            0.052663385533317106, 0.12535293854491597, 0.019955281410203557, 0.033538699281476583,
+            0.13953816082015266, 0.021954824081885139, -0.04910193266979343, -0.030521300227953668,
+            -0.041764834611285502, -0.062745345687765519, 0.062422836846288063, 0.15541817785139905,
+            0.046148240446886035, 0.084552086383548677, 0.17812966743325484, 0.0078584134528693374,
+            -0.079174083868854356, -0.030358362479660842, -0.0054494775133974663, 0.0059128012108570476,
+            -0.012591032703971234, -0.015466996643375905, 0.042959435191262087, 0.087035505763143187,
+            -0.0063449607258253974, -0.043792252535738513, -0.032761058456940224, 0.019644296335833509,
+            0.014125070975262465, 0.026671016082968457, -0.029127122310338059, -0.066380662678077532,
+            -0.0013293040803336702, 0.0007828161876047169, -0.071681199141420016, -0.019981844284036508,
+            0.018106662795062834, 0.019391951475717189, -0.023630028116240494, -0.031353581339849702,
+            0.029219321476807825, 0.077420278738358481, 0.036974110968489293, 0.070192157262616961,
+            0.092081504795297059, -0.0087353197995650202, -0.051392832494079541, -0.010233678906580095,
+            0.011092726282067299, 0.023389848936827044, -0.026038503195252645, -0.039129650719440315,
+            -0.001721052879388122, 0.011501811115466347, -0.030395584571668265, -0.042978182207618391,
+            0.0019175107942005915, -0.0026527225465114517, 0.0069417998942061625, 0.021347994293696649,
+            -0.019065000906763569, -0.030530620741490745, -0.0023839847741624945, 0.0011653102649679878,
+            -0.027153522259654523, -0.027094705995142781, 0.0072621629747960451, -0.0013869695379845385,
+            -0.010131325607062282, -0.10720422651749743, 0.059217164003567996, 0.11304390033972425,
+            0.018290149872251464, 0.066661325578397906, 0.13178444480824519, 0.041799729605112017,
+            -0.079297462853226183, -0.0010705880158315079, -0.012807747311610898, -0.075680511098821832,
+            0.050157057291497567, 0.089013690706233647, 0.01146683137092609, 0.03047521930490945,
+            0.094078867574607067, 0.051066840700007374, -0.046184662902064771, 0.0010820044675445145,
+            -0.0042097204817543882, 0.024969581130389204, -0.0040899857795147262, -0.015630673255643327,
+            -0.0059386250181523263, -0.034790524070171559, -0.029479654400097699, 0.015306313637135078,
+            0.029847627743064872, 0.002384113166865434, 0.0092614614284956924, -0.081977094796018043,
+            0.020161627955605638, 0.058742153079343377, 0.018332010567686206, 0.10085028267460644,
+            0.097627297757426929, -0.0328719349954113, -0.090095492610565792, -0.0063456546299314248,
+            0.025310732730317663, -0.11030204292246247, 0.0081505307597282035, 0.058112602536382243,
+            0.027949225358205862, 0.17337487745451358, 0.12898322341010587, -0.093209867025475415,
+            -0.14347972487193986, -0.012713592700151523, 0.026480769136742053, -0.061643097994813732,
+            -0.013663946457917905, 0.01238671082476725, 0.018771501526886048, 0.13306444719692259,
+            0.069801670639625141, -0.099113367097198188, -0.10154944872356979, -0.011113577299280464,
+            0.0019914055374005216, 0.11101151275586503, -0.048766726139338135, -0.1032158903225005,
+            -0.021111466387185734, -0.093953001794365623, -0.13489261763139987, -0.010884130162910642,
+            0.096834746106253589, 0.0038706050618058391, -0.0058627388491665385, 0.027171367449440806,
+            -0.0025574921906147746, -0.014921404925666898, -0.0067897992259951028, -0.041617036167443222,
+            -0.031842056611506762, 0.021542135330854369, 0.034699583417932771, 0.0030108670189192268,
+            0.017616826694666916, 0.0052341877857974579, -0.0019329863180043004, -0.037725940700992784,
+            -0.070495377300476336, -0.042539754317339237, 0.00185123974444551, 0.0038244592294740219,
+            -0.0024297217134865738, -0.0091077542255168665, -0.0052245451047312416, -0.0015522801380461217,
+            0.00057325728295318148, 0.011188216937527156, 0.0209065051705868, 0.012615828550008139,
+            -0.00054901405980537009, -0.0011342031168213463, 0.00072057192274578899, 0.0027010467650467563,
+            -0.064846804987501061, -0.019266827136144749, 0.0071152420909651537, 0.13886761571809642,
+            0.25949054637111135, 0.15658706305306366, -0.0068143363599932954, -0.014077675062298697,
+            0.0089437043832677476, 0.033525263793108322, -0.032202828028219888, -0.0095678780324535331,
+            0.0035334187625537835, 0.068961453822138627, 0.12886262386170549, 0.077760905320065687,
+            -0.0033839894189020762, -0.0069909527409367988, 0.0044414304489653863, 0.016648596715570858,
+            0.058807166553359602, 0.017472372194257506, -0.0064525496173868935, -0.12593389925650267,
+            -0.23532236911918031, -0.14200300999930257, 0.0061796693507101741, 0.012766522301788723,
+            -0.0081107143732403481, -0.030402820493725797, -0.022414780323668768, -0.0066597220614650829,
+            0.0024594363353668065, 0.048000623947359322, 0.08969483684043239, 0.054125482674734764,
+            -0.0023554260320192907, -0.0048660530622940609, 0.0030914579225517738, 0.011588256713039452,
+            -0.033788818842828867, -0.010039096481388286, 0.0037074398049500132, 0.072357808708366278,
+            0.1352091142262157, 0.081590633611793001, -0.0035506510590042908, -0.007335257496493516,
+            0.0046601711101772183, 0.017468540896991382, -0.061168443115166733, -0.018173938097862736,
+            0.006711638008622481, 0.13099050684499347, 0.24477123780707838, 0.14770483851561392,
+            -0.0064278008158490298, -0.013279134822571355, 0.0084363828397131732, 0.031623581017522245,
+            -0.020910330186622257, -0.0062127304058081645, 0.0022943622512861046, 0.04477888613716681,
+            0.083674639112486668, 0.050492652521957011, -0.0021973329806708251, -0.004539450075749794,
+            0.0028839633931342624, 0.010810468389963492, -0.044988620571204854, -0.013366702890081926,
+            0.0049363253403833292, 0.09634187026444084, 0.18002616682124434, 0.10863505098534051,
+            -0.0047275666550324743, -0.0097666366450057385, 0.0062048534708442219, 0.023258746095947393,
+            0.01737327673181259, 0.0009100603816801021, -0.023960438907622311, -0.02037500132196959,
+            -0.012859426151743921, -0.024968705386800981, -0.01096780606706326, -0.0090136565563370564,
+            -0.0061866104021822601, -0.014242850333609072, 0.0010497033323104985, -0.0035389956674923909,
+            -0.018046735706327532, -0.0081352194035842536, 0.011541144866096805, 0.005500953192391269,
+            -0.0080932399963358735, 0.0017037065726077617, 0.00032123668357469091, -0.006632183149972562,
+            -0.01510358143390491, -0.0096604540592287302, -0.020133180850130945, 0.00067497935307327291,
+            0.04157828475904219, 0.039005067169000374, -0.0088023125025980808, 0.013384518780138402,
+            0.0070935927639635696, -0.0018611784000097309, 0.0045489768793919964, -0.0076008171862310967,
+            -0.042479144344654232, -0.020394103665418144, 0.023500896466020924, 0.0087513705969905729,
+            -0.019079136094919451, 0.0025438593402064835, -0.0001038934066803247, -0.016318233439679392,
+            0.054032232374904593, 0.0014635427127213715, -0.080831538235248801, -0.065993522061212159,
+            -0.035309145678648915, -0.07498881328921797, -0.036936615049873917, -0.027178118104125029,
+            -0.018976509606455427, -0.04649135087540697, -0.051186271904846883, 0.0035582297117282818,
+            0.099411357967264538, 0.072016435011599336, 0.016501800091497668, 0.06139509641493044,
+            0.045214245365811909, 0.022653317524835462, 0.017020741883180965, 0.051983314043158341,
+            -0.02763744015110264, 0.0042616307371723481, 0.064485331805487558, 0.043380438595871207,
+            0.00088838381429182794, 0.028584933017904157, 0.029251701844854441, 0.010767292197123395,
+            0.0087375464879621313, 0.031826281094723831, 0.016351081324880074, 0.0023408957515454617,
+            -0.015694967001486301, -0.016324651550125569, -0.017190423192307892, -0.026394700342281679,
+            -0.0072535330674603597, -0.0094119142988224984, -0.0061096697634137834, -0.011021054318111788,
+            0.013029527836647082, -0.0015829030304581973, -0.028432748229140648, -0.019632699762484936,
+            -0.001879665122663291, -0.014307504320881861, -0.012909351764152168, -0.0053428184414376642,
+            -0.0042016972098865108, -0.014319861904629215, -0.10270932226754002, 0.0055126332542893295,
+            0.1919612913287386, 0.14138072667677992, 0.038689414236264069, 0.12636784680858756,
+            0.087361662588085434, 0.046473646121386485, 0.034468160401041559, 0.10169544914322214,
+            -0.035225419356798016, -0.0074889676302554876, 0.016462665708277688, 0.007465670441652081,
+            -0.0016503622974959904, -0.00054583670466686312, 0.022922002593453065, 0.015690091785656442,
+            -0.0033133061988598958, 0.0067122342288888481, 0.014413581982909124, 0.015896963037145519,
+            0.0014416541170555711, -0.011596870496812579, -0.0094241306335191323, -0.0053940010241462395,
+            -0.0073998656840093303, -2.2094873473836943e-05, 0.0047528731338893496, -0.0037793923850917271,
+            0.0511091753343366, 0.012451719622941389, -0.022875353558527801, -0.011887692968615459,
+            0.0011464592387814571, 9.7776182809685731e-05, -0.03301332191640486, -0.021974367880533495,
+            0.0052271487232713777, -0.0098665392890748584, 0.0068936004012220544, 0.0095876334364901877,
+            0.0019542155493000525, -0.0068674847139343206, -0.0060691744559851829, -0.0034485223323242648,
+            -0.0032330282206911366, 0.00097888803471376769, 0.0027985310265376908, -0.0019673087957189474,
+            -0.029511309358620182, 0.014985035284682422, 0.027340044503259355, -0.0078965908046995121,
+            -0.018113880959938017, -0.0097632804512484562, 0.022482854954660191, 0.023744166730271882,
+            0.0028520246725158424, 0.0039122968891412554, -0.11273316101222401, 0.02868386979493065,
+            0.086239115164216756, -0.011154646905637246, -0.046718759826616073, -0.024794332013837614,
+            0.081479352837565744, 0.076463965226277311, 0.0033344291615922533, 0.017243621235579841,
+            -0.068342884298055198, 0.032282322351629165, 0.061772220576690129, -0.016675990367850731,
+            -0.040043665399683945, -0.021550529320916407, 0.051692921180993848, 0.05378051106314722,
+            0.0059640529397388571, 0.0092549829510342185, 0.067698775180294074, 0.042949601961151496,
+            -0.013440725032075206, -0.033356933207268576, -0.019302734015619084, -0.011451400437544956,
+            -0.039648388261022391, -0.01591673129145622, 0.013927475638152184, -0.015198536976002455,
+            -0.019688297057027987, 0.044154094462345965, 0.040006998457071057, -0.028004784527020293,
+            -0.038966482524572278, -0.02146535602600598, 0.020267895445318557, 0.03287049817997599,
+            0.010944942537659716, -0.00013915616954325062, -0.075996488370097412, 0.0053408579951437912,
+            0.049217051656180101, 0.0017966275501818786, -0.02047958349566743, -0.010588050617179599,
+            0.052768653726504119, 0.044568550074346833, -0.0014572041712937966, 0.012750881308054856,
+            0.0039649307976892039, 0.0088098748288370134, 0.004019434475427775, -0.00042021617352857254,
+            -0.0044434127340488121, -0.0030917358288649562, -0.00050850809603864618, 0.00071721153354654596,
+            -0.00063928367950002942, -0.0018587964218114521, 0.039162155733070352, 0.087016320748107015,
+            0.039700495902050603, -0.0041505317668777235, -0.043888186290298975, -0.030537491369606925,
+            -0.0050226029821753178, 0.0070839949556430375, -0.0063142910410394614, -0.018359582716923905,
+            0.028461536518889035, 0.063240088405558267, 0.028852781282927335, -0.0030164455772296629,
+            -0.031896232305575804, -0.022193464826998289, -0.0036502331273952134, 0.0051483728961171952,
+            -0.0045889819314435558, -0.013343032940549665, -0.0024619470002234948, -0.0054703211768136169,
+            -0.0024957900034829283, 0.00026092509570835624, 0.0027590510930788391, 0.0019197534932498038,
+            0.00031574825526875164, -0.00044533861336740053, 0.00039695082142523341, 0.0011541836436015362,
+            0.006397306110173695, 0.014214489217625498, 0.0064852462857820847, -0.00067800716624736126,
+            -0.0071693234722081181, -0.0049884301941834552, -0.00082046373968411952, 0.0011572009601071524,
+            -0.0010314665243043759, -0.0029991165832588432, 0.004585411281656771, 0.010188550946129228,
+            0.0046484443562667711, -0.00048597669950647038, -0.0051387718775922735, -0.0035755681682621619,
+            -0.0005880856134357652, 0.00082944949737215454, -0.00073932654710314729, -0.002149683441598767,
+            0.03511574341687615, 0.078025398124107748, 0.035598459827427188, -0.0037216799188149519,
+            -0.039353458969593129, -0.027382218661283937, -0.0045036447638138657, 0.0063520443288248695,
+            -0.0056618697287233732, -0.016462587001664728, 0.050979669530524692, 0.11327423612062848,
+            0.051680458427251462, -0.0054029900522736627, -0.057131820031147487, -0.03975243929177228,
+            -0.0065382161788939625, 0.0092216507246464675, -0.0082196821029419664, -0.023899743058238759,
+            0.015089162948509338, 0.033527353598647266, 0.015296585200410849, -0.0015991982305636023,
+            -0.01691010063293405, -0.011766083217058146, -0.0019352069211990375, 0.0027294604245151847,
+            -0.0024328938139148567, -0.0070739398814137011, -0.032689932892750573, -0.072635370361586113,
+            -0.033139303047891845, 0.0034645846835721357, 0.036634905248662801, 0.02549064332386625,
+            0.0041925310637481467, -0.0059132423988856537, 0.0052707453543618579, 0.015325344474035966,
+            -0.044873410921082053, 0.020147895463303311, 0.081922973162342219, -0.03103736878087494,
+            -0.062712186408623805, -0.071951024328596555, -0.046263130922815962, 0.080816196243318428,
+            0.04099344214319655, 0.096050453286256221, 0.012813954750753139, 0.031153785838918875,
+            0.052616731403331535, -0.068424959041554101, -0.059481042844376754, -0.01636725053406362,
+            -0.03843400427428393, 0.079388948363668582, 0.081527474047616497, 0.076444149003828968,
+            0.029326524454477206, 0.0039484720217688347, -0.023672687168227947, -0.10928420286447509,
+            -0.058099215242855787, 0.021200552147816958, -0.032542365428246553, 0.084988589654141994,
+            0.10864077744745967, 0.071679663157284829, 0.068845535988791576, -0.012982138447466738,
+            -0.092255891920833402, -0.050750517341512168, 0.01760949521864056, 0.086808255178770471,
+            0.020692819290485952, -0.015621808387757757, 0.042228001612418242, -0.040910432559719531,
+            0.1176167181061443, 0.0070843778629533314, -0.095657507275984849, -0.11862827258244077,
+            -0.011483667493578275, 0.12176223639473015, 0.0065640366616255925, 0.026278146830395085,
+            0.11719101404144805, -0.01455669392742397, 0.15954618702533988, 0.0056789072844990254,
+            -0.13873629968602311, -0.16803788811280757, -0.017685524060795245, 0.16767566166551001,
+            0.0080452968161418403, 0.039520405369963783, 0.16413903055638329, -0.016677353800523577,
+            0.054396295742435374, 0.018087106406569811, -0.012811613406558989, -0.069753557371894051,
+            -0.02549403954212312, 0.042997827575157944, -0.011008769116724522, 0.037738711493838867,
+            0.075751227615855371, 0.020106096403561823, -0.035282618029789811, 0.039602977467447467,
+            0.11791136987999322, 0.0052546380464933776, -0.045585590029383907, -0.072963494772603887,
+            -0.036725643953548728, 0.053010159745605696, 0.01413723066372493, 0.069286449570545305,
+            -0.060038496583395849, -0.026735012771095207, -0.0039139295652815889, 0.019648856138359143,
+            -0.0058849690810905885, -0.047326231692623948, -0.0080014695500329469, 0.0084418234983019581,
+            -0.030363095697806597, 0.024589674558702965, -0.055741326206240865, -0.042429339654804055,
+            -0.044005999753636935, -0.016422614491187378, -0.016777154669193127, -0.032971172034146658,
+            -0.012425002616372761, 0.027864724046760644, -0.002301156180395867, 0.039129746383220962,
+            0.056136964594500502, 0.062633496037619502, 0.017505824098331849, -0.021685802295862155,
+            -0.020758766898112697, -0.035344034107371462, -0.044053493386503065, -0.026064364317140321,
+            0.0074286131566294305, -0.038065684574506597, 0.025028506146111833, 0.027467866477649476,
+            0.038894746304638225, 0.021544899842208701, -0.0030953828331925343, -0.031500099658460623,
+            -0.01076995971249437, -0.0077487299464597727, -0.0099406002116913597, 0.0042045294569986701,
+            -0.0046713658908726328, -0.0021638516701646257, -0.076226089845894129, -0.076753448946682304,
+            -0.018003819182061207, 0.044861056473848089, -0.01492896686454365, -0.00034429603526700027,
+            0.034556614939734102, -0.054029295837626848, -0.0045280581142807825, -0.0023773903122666514,
+            -0.093169513634313236, -0.092748007386803832, -0.019850268726773163, 0.052073928912927135,
+            -0.020764974756728713, -0.0047006931358362335, 0.040760862938964561, -0.063692516506988317,
+            0.022238636878312922, 0.027081614108840774, -0.04489782767524967, -0.063330040026545242,
+            -0.022296374248326742, 0.015384608049800966, -0.030122589504989621, -0.011522292660280879,
+            0.027592169007995371, -0.055233504263742669, 0.010087487420894237, 0.013632893464964119,
+            -0.046580355315271056, -0.056771067320938604, -0.017737883559807988, 0.022259241968706985,
+            -0.019789564685835478, -0.0051310895475109568, 0.025322803163404184, -0.046008216124789635,
+            0.019242952101033457, 0.030069503860512967, 0.057488019661541767, 0.027495939175351706,
+            -0.020522584103274972, -0.018687311889967813, 0.012745026162735875, 0.030119819421542838,
+            -0.003543055899644194, -0.0080813017821262795, 0.013400856654232197, 0.023963695413120406,
+            0.10399966745092119, 0.076266542859304287, -0.011619366406906959, -0.037142121651391698,
+            0.032699902892953325, 0.042769593759221465, -0.023015895904478952, 0.025188284794393449,
+            -0.030443079313429412, -0.030059629681231489, -0.015847606299374005, -0.0014504508080952715,
+            0.00037757845873917333, 0.0303305656895459, 0.027437972881508319, 0.026645890484272981,
+            0.0051426305887527606, 0.0040475500147558637, -0.062847195814409409, -0.072090794254174972,
+            -0.18688038928480313, -0.13573289264577756, 0.0012738304201222882, 0.11503898423728078,
+            -0.0046410401705714553, -0.0071084092295792631, 0.055482454202619567, -0.057071766485607682,
+            0.1184427763539386, 0.17311607068668819, 0.090407465018483887, 0.026861079164020599,
+            -0.059125019720009178, -0.20495836984580557, -0.15540320003660749, -0.18930551289164449,
+            -0.024462314162679438, 0.0031813759584139569, 0.074831061017913342, 0.10599078636150414,
+            0.055066462877867081, 0.022127740036661486, -0.03080071368049362, -0.1285294233906191,
+            -0.099054992749748008, -0.11912002998897582, -0.012599882732038437, 0.0018712216652621368,
+            0.007864695690299078, 0.027154238474014113, 0.015503869389314976, -0.02209229813872346,
+            -0.034268445565234847, -0.018060344827910826, -0.0062787080753101705, -0.014799030323374655,
+            -0.014842853441224161, 0.00085357702747895369, -0.04876275156734481, -0.050969487845321071,
+            -0.024902904628264517, -0.04201385259812665, -0.014997446984243384, 0.078610455705669546,
+            0.069217433621441546, 0.075046961359750641, -0.0070667701302221924, -0.00047698432175656742,
+            -0.0099048396882501239, -0.044278698812870304, -0.025641697824370539, 0.043193115135321432,
+            0.062690653888830106, 0.025610561756771809, 0.0053065919258749299, 0.020072877165813179,
+            0.027202517990505933, -0.0014884960553906356, 0.035778127923764509, -0.04417506724871266,
+            -0.031219816516125692, 0.15520134482045503, 0.16906491812370081, -0.034491950272830162,
+            -0.071832376999521358, -0.043452006898014005, 0.074043401578933229, -0.0029960776755784016,
+            0.014803038016765177, -0.018076156818792086, -0.012795060144420344, 0.063907266034129787,
+            0.069560220150948593, -0.014328041584347886, -0.029668440596667556, -0.018006692671159157,
+            0.030465384565063886, -0.0012313654854943061, 0.0010875538337204252, -0.0054947771184735922,
+            -0.0034680823556573056, 0.01104829195725337, 0.013184302093040088, 0.00013169461175401346,
+            -0.0032547431084050393, -0.00072980862067304701, 0.0057555585509250608, -0.00026138413145926294,
+            -0.069888255474591696, -0.036271731504564732, -0.013376880194486945, -0.11629366916852002,
+            -0.092761266486633825, 0.10221280473993186, 0.10869385925708756, 0.10232427240471298,
+            -0.041175141863523099, 0.00082503684913616494, -0.12829073771115607, -0.12502541382317914,
+            -0.060013874670650127, -0.12436578522598782, -0.057033847810772385, 0.20423921642334761,
+            0.1844457050770813, 0.19615109300804601, -0.026249322635699714, -0.00088281619381782184,
+            0.035725170648510822, 0.051482033360086103, 0.029367093387381485, 0.0010439340144300026,
+            -0.02233970932232926, -0.0041025284199728432, -0.0010650690549381884, -0.053808938422420488,
+            -0.048021613876103847, -0.0084919314121602741, 0.013031495442433656, 0.016105396728659321,
+            0.011334056302936376, 0.0036348259064882468, -0.0038862343847260727, 0.015426906172486394,
+            -0.010837392358448378, -0.048737650614048049, -0.034791158747349255, -0.0014121380295085157,
+            0.063961683620549506, 0.013878848689637241, 0.017860301611669616, 0.039750958355810488,
+            0.0098742694471583743, -0.032758677928705848, 0.051604776061293232, 0.070632711066976259,
+            -0.0043322550962649128, -0.030971624165333132, 0.10824043835846597, -0.0031564476713576003,
+            0.01757144063085123, 0.079251037879948014, 0.032493454671742125, -0.072338724054418269,
+            0.11123456492134937, 0.19250010420663694, 0.02975992099721108, -0.058809884039705586,
+            0.033417337149582144, -0.038463215372814635, -0.007569249701957206, 0.046542793504557173,
+            0.039051045875945434, 0.0012259882970276394, 0.035311349106786231, 0.069472488506142668,
+            0.0079923271938362721, -0.021240447227590331, 0.0060302221377845303, -0.032403981253840121,
+            -0.0091032511324374912, 0.024573538526273812, 0.028298922500871172, 0.026938320606492483,
+            -0.00036300186375501928, -0.0016091028225243467, -0.011452717321096706, -0.0045881516906312331,
+            -0.011067543242585179, -0.0055431997010866431, -0.0012133639097484221, -0.0018112782452094876,
+            0.0049235944310364651, 0.036838593119868229, -0.028993840299690252, -0.068507346267387942,
+            -0.032273524042098642, 0.008750241226645623, -0.069516338554768464, -0.016774545201158675,
+            -0.015338077543824331, -0.037154247862755216, -0.0028252808826996247, 0.08252830031247195,
+            -0.087688556548678701, -0.16605203569820778, -0.047062556975943061, 0.039255144629515466,
+            -0.052993715640835597, 0.0028171093056201897, -0.0073632172065823424, -0.038683170564816891,
+            -0.015761740858712854, 0.042480499194798176, -0.059918272648000578, -0.10997303517043409,
+            -0.023396683348515766, 0.029880415447516479, -0.024239605675670101, -0.013750071070794697,
+            -0.0073529357271738937, -0.0075067950426858931, 0.0061700918849106473, 0.040965848589611387,
+            -0.035356306163093591, -0.069919044183336054, -0.024808208112675208, 0.013940890233962892,
+            0.037614934092541859, 0.090996244306149748, 0.033383187678789041, 0.022212398888166167,
+            0.0092431158674699532, 0.018540067272670824, -0.069217541410753605, -0.096474758477505862,
+            0.01697698929008068, -0.0093240421456827031, -0.046722627047692304, -0.057981479551745777,
+            -0.061540191216413902, 0.015969316830027433, 0.013763587894951992, -0.093234068417123242,
+            -0.091076853245100592, -0.062203505698714093, -0.056205295252002359, 0.043547857076532748,
+            -0.076590729678987265, -0.12653270319184726, -0.052963465158091819, 0.040634928153426612,
+            0.050556160798280167, -0.14137654402190653, -0.002546600123391347, 0.109922974723886,
+            -0.067083795600033025, 0.016402476628014424, -0.058889323432380625, -0.11634802350974904,
+            -0.03519601054222548, 0.014623499993870456, 0.028473466166864962, -0.083273850222946352,
+            0.057566440381513276, 0.14333436249100834, -0.039614791439037893, 0.0029777722741508549,
+            -0.076287032812897254, -0.12638279072871342, -0.055727681192507726, 0.036842824743863231,
+            0.046581108722580013, -0.1379237294427498, -0.0052778190446990574, 0.10147374363128117,
+            -0.06701614802978656, 0.019258204645746953, -0.038105858707776892, -0.079571219523416226,
+            -0.042876132599086687, -0.017338898483604915, -0.0087713184057369026, -0.031356535899834496,
+            0.023989139486815712, 0.042839315000864853, -0.025852293152581401, 0.021260155721210913,
+            -0.0017669254434044129, -0.025182738968216017, -0.069344701416777593, -0.099066803822868227,
+            -0.097836001170970743, 0.085180292317823925, -0.023622983801771365, -0.14935126411006419,
+            0.0022657742874659242, 0.064245530733206019, -0.0380888975946393, -0.059373198766773695,
+            -0.067219868275471675, -0.019757474801166873, -0.019331279880200627, -0.043659653016045227,
+            -0.06210597330537377, -0.074169336939319153, -0.041021574321953559, 0.050092957132656074,
+            -0.043488846198477218, -0.079351050962234909, -0.071765790490319226, -0.030876177313853628,
+            -0.026478679082157123, -0.035711010089022374, -0.032769233313877662, -0.044182758303405192,
+            -0.039357643795377442, 0.04970772362820685, -0.050645195966917786, -0.081143555735302575,
+            -0.069682679433335337, -0.0075912721972371359, -0.0047059002178439068, -0.070131781217708133,
+            -0.051924480363625992, -0.035463170529693666, -0.050567795656058089, 0.046297700724225448,
+            -0.007160332015549443, 0.0022030415509999399, -0.0093287119535048219, -0.0058137946813569168,
+            0.0088931867124979001, 0.028905812436532809, -0.0015706619853651353, -0.013886161086474237,
+            0.0027602270781025089, 0.0030556300948932969, -0.0015618157369939492, 0.00048052869002880187,
+            -0.002034784016052278, -0.0012681082392934544, 0.0019397870000220797, 0.006304952431805377,
+            -0.000342593695503824, -0.0030288574418325031, 0.0006020623176265558, 0.00066649579352927031,
+            -0.0099254386599510833, 0.0030537904851742435, -0.012931182251017394, -0.0080589087721136942,
+            0.012327470152879034, 0.040068374990407801, -0.0021772047940520518, -0.019248582298515626,
+            0.0038261444429878457, 0.0042356232935152087, 0.020963480715928406, -0.0064498991067011855,
+            0.027311900162878527, 0.017021190138156003, -0.026036802168634458, -0.084628260292340746,
+            0.0045984658490612253, 0.040654856439955263, -0.008081184922392905, -0.0089460436234241828,
+            0.041813937674894948, -0.012865023843680911, 0.054476549322547911, 0.033950611219281557,
+            -0.051933227973236198, -0.16880025074795921, 0.0091721392558002709, 0.081090523868512343,
+            -0.016118800463679243, -0.017843855015094223, -0.018831038717274602, 0.0057938040655872011,
+            -0.024533685811952092, -0.015289764846262707, 0.02338829302039697, 0.076019725337395344,
+            -0.0041307018437039154, -0.036519373191892836, 0.0072591526291437766, 0.0080360363873699225,
+            -0.023925826434598858, 0.0073613331983725609, -0.031171339900611737, -0.019426451478851688,
+            0.029716058036364432, 0.096587064650867874, -0.005248274237515933, -0.04639978694791979,
+            0.0092231357215483787, 0.010210207451273323, -0.024250381654249527, 0.0074611901090481589,
+            -0.031594180929568588, -0.019689972416947029, 0.030119158082647372, 0.097897273770242085,
+            -0.0053194673811509108, -0.047029202742011209, 0.0093482480911527312, 0.010348709505991689,
+            -0.034641614548632287, 0.010658292950470792, -0.045132214962483826, -0.028127080417373711,
+            0.043025148210216156, 0.13984603094757381, -0.007598846948025692, -0.06718110820465148,
+            0.013353950947899923, 0.014783107783357697, -0.0011361931542617496, 0.00034957607040631716,
+            -0.0014802691602337115, -0.00092252617656504352, 0.0014111605216586198, 0.00458674068987883,
+            -0.00024923081660956987, -0.0022034398867490589, 0.00043798962164568459, 0.00048486382869322009,
+            0.015345693437266638, -0.025099771504564817, -0.078139230230073561, -0.066010826091473157,
+            -0.016562736066931042, 0.028831161049061284, 0.015621627616976556, -0.020084763225970657,
+            -0.028212686433404778, -0.026181441641233295, 0.018961517495036304, -0.031013897055276487,
+            -0.096550761105267974, -0.081564605660349551, -0.020465325401073625, 0.03562449405553611,
+            0.019302468576682573, -0.024817229071450741, -0.034860291558402458, -0.032350435368396276,
+            0.012940160706333501, -0.021165226471458246, -0.0658904207085768, -0.055663219226516944,
+            -0.013966424346924074, 0.024311697535871566, 0.013172840490040468, -0.016936351879776032,
+            -0.023790172656458327, -0.022077338097886319, -0.0076605803827645754, 0.012529822649317245,
+            0.039007155764702081, 0.03295264834226317, 0.0082681288739363118, -0.014392534794706875,
+            -0.0077983269090236423, 0.010026327177088958, 0.014083791854721492, 0.013069793101839252,
+            -0.01112017301366152, 0.018188412460808785, 0.056623166809952913, 0.047834384931037192,
+            0.01200209631430582, -0.020892343533444574, -0.011320127211319701, 0.014554314076731772,
+            0.020444169277991496, 0.018972238823080158, 0.0057105012531527043, -0.0093402280722345871,
+            -0.029077485092045607, -0.024564214491707297, -0.0061633920586578583, 0.010728767779283718,
+            0.0058131829915480868, -0.0074740229915351416, -0.010498618514137267, -0.009742743520376072,
+            0.017130216332698758, -0.028018578471686709, -0.0872258997863921, -0.073687105497690975,
+            -0.018488786645437995, 0.032183884547954851, 0.017438238398390343, -0.022420383963645305,
+            -0.031493488639435657, -0.02922603406940855, 0.0084100375119388268, -0.013755652082939208,
+            -0.042823340637905688, -0.036176502931772568, -0.0090770242604327044, 0.015800598840748362,
+            0.0085612601863440715, -0.011007232279163101, -0.015461650670102538, -0.014348449434333858,
+            -0.0035673216636178885, 0.0058347939117987255, 0.018164559973629809, 0.015345142330131742,
+            0.0038502402919677087, -0.0067022077443436882, -0.0036314664336822614, 0.0046689849016951987,
+            0.006558434645796622, 0.0060862433055455939, -0.036779459383474752, 0.060157335369725104,
+            0.18727851277960061, 0.1582100220512028, 0.039696380026304455, -0.069100462687937389,
+            -0.037440798670398567, 0.04813772256797233, 0.067618147007695292, 0.062749804913089194,
+            -0.0040865208983963501, -0.0064718532064304297, -0.012272328024764858, -0.017214958303527293,
+            0.0021861732797889052, -0.00059693220560563722, -0.0098840584564065439, -0.0021305546249235649,
+            -0.00064671313201014559, -0.0037360102224892893, 0.028298435455252024, 0.017423535419540316,
+            -0.015379781007859493, -0.02465926903861064, -0.017829820719014684, -0.017446125895846896,
+            -0.020339620920587505, 0.00015518533554505324, 0.0037631762515129095, 0.00018816518638327482,
+            0.072873630920577609, 0.040788809345220653, -0.054554141196070827, -0.084930461753060099,
+            -0.046315837425327668, -0.048141103599567817, -0.065602100360087831, -0.0017747127187468837,
+            0.0095843415212525946, -0.0033407405905155345, -0.024715113928099143, -0.020562335276326324,
+            -0.0061512516748938265, -0.0065360163171726288, 0.015047023097250974, 0.011026209631861182,
+            0.00043981314035323842, -0.0029840910595246299, -0.003426213681581144, -0.005175774954832576,
+            -0.045299158490610794, -0.015200849700271357, 0.071114202955857173, 0.1061233994516563,
+            0.029787984649720142, 0.037924287419070925, 0.073689839940779267, 0.0065145563628533753,
+            -0.0056926372166337365, 0.011596819859224252, -0.053325265165743381, -0.032366186943982106,
+            0.030690804666635808, 0.04891793697443781, 0.033644151243445435, 0.033242820392579517,
+            0.03983987726496388, -4.3798893924655493e-05, -0.0070791078658799696, 8.2837004664574384e-05,
+            0.013946179545992952, -0.004103664610231976, -0.054075334323224089, -0.078803849954545938,
+            -0.010033633673205984, -0.01859523780732996, -0.051155647757713932, -0.0066866396000446913,
+            0.0015232551334656789, -0.01180555452611606, 0.19773325435720471, 0.1301599982537697,
+            -0.076636313564646008, -0.12811216255555447, -0.12375798741483804, -0.115274844197518,
+            -0.11484941805346471, 0.0055685957750408578, 0.026514607971958735, 0.009203885744964866,
+            0.088049821138255935, 0.067993935977235645, 0.0026380076597293176, -0.004347306379948325,
+            -0.054123216551955948, -0.043426600020149808, -0.018619421419943046, 0.0078272169682582944,
+            0.012068830089849511, 0.013506333191633779, 0.096929247692719517, 0.080400998083548642,
+            0.023239067236843932, 0.024364299218438953, -0.059036073316824492, -0.043433615677202116,
+            -0.0025080425580234211, 0.011574420086518277, 0.013430826050869926, 0.02007212569530812,
+            0.0011664456349905284, -0.037088480897634141, 0.0047341417992650143, 0.029545282658318,
+            -0.011762619783890198, -0.038071769487047283, -0.015536295587826404, 0.10365907980366568,
+            0.027272909701102535, 0.0014545679287894433, 0.0020275312459837923, -0.030979885935070402,
+            0.0047075511616602814, 0.023135857036539007, -0.010439253419402222, -0.026215483705986007,
+            -0.006261474115351176, 0.087728964245687407, 0.02439326016798276, -0.0005118547733324267,
+            -0.0044681938324136186, -0.028312449328236698, -0.00021798951266925582, 0.030405960862437555,
+            -0.0058554293009165361, -0.057482958141455036, -0.046030320762219183, 0.073315952446525473,
+            0.012616258062704841, 0.0098964880147257399, 0.0037086661821468291, 0.0082029505340431557,
+            0.0017894631048434597, -0.012346793985967388, 0.00028916590753321966, 0.029457857063133894,
+            0.028730283661303674, -0.018622147668054506, 4.0304710154755868e-05, -0.0068255037197443085,
+            0.019417757330519914, 0.010248189611857934, 0.012807857632717931, -0.037088277203261966,
+            -0.0082574649591880198, 0.11521278580554037, 0.13016910199510368, -0.0072219967374748534,
+            0.02268296542916292, -0.032768088662002731, 0.010190815178243799, 0.016428458996568474,
+            0.0055598522372235729, -0.028776481362535949, -0.0010317586571639272, 0.073652003153060433,
+            0.075160162631249153, -0.034296946430322703, 0.0043108743489869723, -0.018200507442272546,
+            0.00485775938679285, 0.039545544514748003, -0.00068464662649232689, -0.040442897472946902,
+            0.0089849554386954404, 0.072953626107562536, 0.055472764661544799, -0.10390537784925769,
+            -0.019739295688572168, -0.01155502786266047, -0.0025923973460294544, 0.017719223548902936,
+            -0.003717063176242325, -0.011133429633809934, 0.0068060512621810178, 0.0073955777250498487,
+            -0.0055547763893819234, -0.051732088103609186, -0.016145232670629443, 0.0026418940606888182,
+            -0.0028733140288344089, 0.009051297651419897, -0.0030064723653223276, -0.0034173583837196226,
+            0.0043797004967653687, -0.0044378176922349995, -0.012715414279209199, -0.028106643808076502,
+            -0.010618659198045614, 0.0038894113192574397, 0.0012564504542931162, -0.021651631884893864,
+            0.0031752477902114665, 0.016404781550356337, -0.0072023130456354435, -0.019173457401011597,
+            -0.0054000527486040319, 0.061138927851363586, 0.016802465133603756, -9.44463045024534e-05,
+            0.033564917704131926, -0.0084854232016304057, -0.018249190933023584, -0.02321250925451443,
+            -0.017479375224797724, -0.0011355596699372166, 0.0072819436802429756, 0.010189846912153419,
+            0.0090665645982181704, -0.0051467883414785653, 0.058892222281445472, -0.014888325773581,
+            -0.03201960506376756, -0.040728127706944693, -0.030668904364775391, -0.0019924265295473927,
+            0.012776728655736995, 0.01787886788980763, 0.015907982922943924, -0.00903043486397688,
+            0.10958416697140866, -0.027703569576637527, -0.059580732594836372, -0.075785184769243133,
+            -0.057067405619002587, -0.0037074233750043982, 0.023774398589808138, 0.03326824439962954,
+            0.029600904657242581, -0.016803452877516098, 0.084753414815869829, -0.021426198593284696,
+            -0.046080293204775469, -0.058612967357965375, -0.044136462725995328, -0.0028673557493189817,
+            0.018387341176810321, 0.025729969900972965, 0.022893615206244645, -0.012995946872859971,
+            0.080556807919292359, -0.020365269862809756, -0.043798604889565988, -0.055710717536200681,
+            -0.041951024130171766, -0.002725377223277575, 0.017476882961528165, 0.024455937823684496,
+            0.021760026622577013, -0.012352446190407394, 0.12686877849421677, -0.032073228544362307,
+            -0.068978347648247756, -0.08773871340502104, -0.06606859588215741, -0.0042921919100816271,
+            0.027524312972243017, 0.038515614493189333, 0.034269828570836866, -0.019453846298907493,
+            0.17092222960493214, -0.04321021923988061, -0.092930137063155144, -0.11820478368157339,
+            -0.089010013725010745, -0.0057825969467881827, 0.037081754844626218, 0.051889635747380106,
+            0.046169558633949108, -0.026208928810270669, 0.072586040727437129, -0.018350209570967099,
+            -0.039464911786277375, -0.050198369529348787, -0.037800141598474286, -0.0024557122760456239,
+            0.015747616758909917, 0.02203612264125605, 0.019606960844810572, -0.01113022208077908,
+            0.035919484197715665, -0.0090806724833522399, -0.019529364889792136, -0.024840858145593458,
+            -0.018705546895941727, -0.001215218758449447, 0.0077927693211338883, 0.01090466088326441,
+            0.0097025807327743123, -0.0055078336294555729, 0.043452123977511373, -0.010984971398082912,
+            -0.023624848834752278, -0.030050210128539236, -0.022628268777904768, -0.0014700610916707133,
+            0.0094269833276612383, 0.013191466615282232, 0.011737299416151819, -0.0066628760145122081,
+            0.069518811762771818, -0.028641091972692143, -0.059488195215444434, -0.075343832455949097,
+            -0.044911350756205101, 0.036588054712212541, 0.038284132299546109, -0.013039828712213403,
+            0.01130891770673079, -0.0040980446838092205, -0.071401366125732113, 0.029416686538910154,
+            0.061099122655194502, 0.077384127117430243, 0.046127540405721097, -0.037578851307898765,
+            -0.039320858308882982, 0.013392944448975437, -0.01161516074842452, 0.0042090188461041331,
+            -0.085521887136383618, 0.035234207447473458, 0.073182245037836463, 0.09268781459770109,
+            0.055249843504539889, -0.045010543280219445, -0.047097054144263989, 0.016041568190336759,
+            -0.013912205332997465, 0.0050414054274194519, 0.074762828532491929, -0.030801577211139852,
+            -0.0639755718750845, -0.08102724836705881, -0.048299151418276294, 0.039348003675911992,
+            0.041172021587385081, -0.014023462907148589, 0.012161983986169689, -0.0044071727385045709,
+            0.14086045064813424, -0.058033171454298996, -0.12053620845658684, -0.15266322775364072,
+            -0.091000305475923707, 0.074135471312252468, 0.077572098711772342, -0.026421569963606409,
+            0.022914362373578769, -0.0083035426857897381, 0.16329342940237895, -0.067275346218653095,
+            -0.13973241428286462, -0.17697587852959654, -0.10549271913765877, 0.085942046154455762,
+            0.089925979693384936, -0.030629383547335166, 0.02656362944555208, -0.0096259379770031045,
+            0.18753831041893115, -0.07726400755296417, -0.16047908958291973, -0.20325225188676818,
+            -0.12115567895769322, 0.098702233082733098, 0.10327767844784347, -0.035177060465097686,
+            0.030507646284638746, -0.011055142579902769, 0.16456581783255522, -0.067799558199980181,
+            -0.14082121441343204, -0.17835488110848449, -0.10631472229963435, 0.086611709750797683,
+            0.09062668624693633, -0.030868048834675213, 0.02677061422683635, -0.0097009436410788602,
+            0.17648809589467546, -0.072711423835233394, -0.15102327032877816, -0.19127613361594836,
+            -0.1140168909398013, 0.092886456843996185, 0.097192305811892893, -0.033104342290321997,
+            0.028710061378801072, -0.010403746623357841, 0.0016055546856377884, -0.00066147332286775606,
+            -0.0013738950385719898, -0.0017400850239839363, -0.0010372390985480258, 0.00084501045389016286,
+            0.00088418179828599617, -0.00030115816939235961, 0.00026118233832151197, -9.4645387014028327e-05,
+            0.032400357671371859, 0.017555539923027344, -0.02722094331746441, -0.037163159731688968,
+            -0.039108258216831109, -0.029111648443691095, -0.0046981288807203189, 0.012065162099540658,
+            0.0048233706868421695, 0.0016794349805886845, 0.041132314136628309, -0.031866250821045022,
+            -0.1603949075015749, -0.16690876425068576, -0.14800910823190336, -0.10082522936443154,
+            -0.041661843023558458, 0.0088687800861587326, 0.016768227734142948, 0.02327762439602879,
+            0.067880823968124726, -0.0086174423685497423, -0.16252166189467085, -0.17823096393529173,
+            -0.16439210260912898, -0.11453235430979956, -0.039768756925707825, 0.019871847106312738,
+            0.019029114210779182, 0.02124522473994853, -0.046638032118048407, -0.0017131421525836332,
+            0.093922678966871662, 0.1055768757214974, 0.099081111657320559, 0.069687011960614345,
+            0.022291227294128024, -0.01456205627774658, -0.011573504094489054, -0.011615851745328559,
+            -0.064508150845756396, 0.015875164237422024, 0.17230676846588128, 0.1863686764307653,
+            0.17018452867407383, 0.11790649584652001, 0.042859353017279223, -0.017969357543207175,
+            -0.019594474589099704, -0.023190819850537867, -0.12068430571144838, -0.017300350513995654,
+            0.21314154777014033, 0.24475015399991207, 0.23301866708612981, 0.16515205110132827,
+            0.049200478684785387, -0.039214041675683341, -0.027419182684589153, -0.025033713807616754,
+            -0.090603265454395288, -0.036501378843025269, 0.10537646784190124, 0.13175850846097187,
+            0.13222952804384222, 0.096255839870279108, 0.021437211789410486, -0.032239488491481283,
+            -0.015962814000536479, -0.0096125676531335254, -0.18852343617481127, -0.069986725364505203,
+            0.2331212350784774, 0.28734322356376357, 0.28596996780119621, 0.2073187585148028,
+            0.048536963449582818, -0.066372456503806826, -0.034387060220636805, -0.022330155957427072,
+            -0.20623517175912809, -0.1460112517058057, 0.093640472997201893, 0.16078964182066904,
+            0.18669227899491087, 0.14488802350179686, 0.0073161898389280042, -0.080877413562916639,
+            -0.023965959531678294, 0.0026903595476501264, -0.066424370524085299, -0.16054907503121921,
+            -0.23363563913602506, -0.19920432169817995, -0.14606557128233655, -0.087221483323310894,
+            -0.072476817245747185, -0.039566002028073324, 0.014596161977452091, 0.045194241897194842,
+            0.031849075809752644, 0.030164205300900009, -0.023283608752746165, -0.029211085844579689,
+            -0.024687980295045823, -0.040956129134134781, -0.030523617193158964, 0.011741239735570069,
+            0.027112553720252983, 0.021978982833697706, -0.0014471379718155875, -0.0013705819013814721,
+            0.001057945748513022, 0.0013272746680678136, 0.0011217566859963864, 0.0018609384461460584,
+            0.0013869126294665478, -0.00053349095462074624, -0.0012319229052622481, -0.00099866698897389263,
+            -0.098302944823424138, -0.093102551139923981, 0.071865423040329598, 0.090160724824948218,
+            0.076200049861494576, 0.1264120857541817, 0.094211884661080519, -0.036239621167622936,
+            -0.083683554534038196, -0.067838663504149951, -0.088571946600950163, -0.083886339344054053,
+            0.0647514723329633, 0.081235724108189675, 0.068657014898640206, 0.11389856661207709,
+            0.084885860056022666, -0.032652264860050365, -0.075399728226659982, -0.061123321301943694,
+            -0.060023469641723684, -0.056848125577033941, 0.043880801799978053, 0.055051855660345796,
+            0.046527511335239101, 0.077186822889613593, 0.057525481144044585, -0.022127798967666916,
+            -0.051096915805603299, -0.041422075062864008, -0.10763329041012544, -0.10193930550877203,
+            0.078686472337532176, 0.098718258095953484, 0.083432516805477724, 0.13841038802824729,
+            0.10315393053611788, -0.03967927590057542, -0.091626312354046946, -0.074277516132325097,
+            -0.15864413491449406, -0.15025158921186429, 0.11597849778535366, 0.14550398483799395,
+            0.12297384389076373, 0.20400747936119099, 0.15204186372613901, -0.058484548556439364,
+            -0.13505094012665758, -0.10947999680683886, -0.11863517255511573, -0.11235916929697565,
+            0.08672951637868255, 0.10880887817262301, 0.091960684191759137, 0.15255819277273461,
+            0.11369794886192131, -0.043735146676180892, -0.10099201961857614, -0.081869892760379759,
+            -0.04954435895920848, -0.046923377748041978, 0.036219935448129528, 0.045440707018221942,
+            0.038404573025037976, 0.063711272990217088, 0.047482478172514365, -0.018264649170984013,
+            -0.042176234621090866, -0.034190461964285726, -0.086021784115825575, -0.081471084810093714,
+            0.06288714867364413, 0.078896786058132024, 0.066680242901926812, 0.11061920036993936,
+            0.08244182733302409, -0.031712141219372027, -0.07322882010404054, -0.059363459326089128,
+            3.8959356750348184,
+            0.042015125284064106, 0.026278993486050919, -0.0079105562154095851, -0.039313260110490925,
+            -0.043368386273505796, -0.022881732724848596, -0.0028218346664303923, 0.0076112671386643974,
+            0.018484720142350773, 0.028041053430440586, 0.037306173560817307, 0.024564660478761647,
+            0.00064560739215768987, -0.015347580916202874, -0.020835054113710783, -0.019662424791414321,
+            0.0027965890770162483, 0.0017782589246639023, 0.0078371106443300646, 0.020136809075881397,
+            0.044269379003718426, 0.033019534435881445, 0.024877749821316325, 0.043279222458477699,
+            0.030835664708080551, -0.021273919798528124, 0.019987537866581757, -0.013545848505763874,
+            -0.017661024464101185, 0.0089262004288120887, 0.049955212828453451, 0.043102311782561492,
+            0.064471154176572204, 0.14166342546801364, 0.11866712257746892, -0.020898833397021161,
+            0.047717628250777758, -0.038919476491864793, -0.060628737843222494, -0.01252430160565839,
+            0.028561617933470947, 0.024703768345467666, 0.037236476316397614, 0.081952783298957763,
+            0.068712407337800305, -0.011916739476804109, 0.027541848203878342, -0.022495780530399849,
+            -0.035083963051118959, -0.0073937891343245814, 0.0092848107421056175, 0.0040126102315540327,
+            -0.012930280853228353, -0.037205341496457545, -0.035350486929135026, -0.0060112350425601752,
+            -0.0083540815495946972, 0.0089427164912967341, 0.016588441564329572, 0.013138893309828353,
+            -0.0050373977539746231, -0.0046497477141290641, -0.008391428997541776, -0.019105810641122725,
+            -0.016321866873142635, 0.0019460231118190367, -0.0061185524349065918, 0.0051519505785817595,
+            0.0082273410694980228, 0.0024364582070254479, -0.017086545164479213, -0.014521647777852847,
+            -0.020674888882157117, -0.044943331429115864, -0.037416416141452712, 0.0072657098581335854,
+            -0.015369496505186023, 0.012418034497530374, 0.019197959367226985, 0.0034291174383005354,
+            -0.013079720624739902, -0.013376494488262589, -0.029908982366942023, -0.070318082032507709,
+            -0.061091749547010979, 0.0043596218806845905, -0.021500823275122292, 0.018649874238552452,
+            0.030442524013729329, 0.011367706969395082, -0.0069323564381850835, -0.0076006889264943513,
+            -0.019036085033379262, -0.045389454686644626, -0.039716089147253143, 0.0020387971481522302,
+            -0.013596844060444296, 0.011952052883480753, 0.019695132566773396, 0.0080017405947539044,
+            -0.0021309003648690883, -0.0062421114817598055, -0.007606881064864548, 0.0011981727177637035,
+            0.0066615187643090301, -0.0066683454769798532, -0.004956422578238316, -0.013300980427615279,
+            -0.0089224330992290976, -0.0031285932579754, 0.0046071374360109859, 0.013495828318156194,
+            0.016446543960009889, -0.0025905229891662785, -0.014402612616579682, 0.014417372388565816,
+            0.010716089961481937, 0.028757536426383064, 0.019290848239301557, 0.0067642107338770647,
+            0.005812549501061178, 0.017026878673935666, 0.020749619957442973, -0.0032683077762063221,
+            -0.018170914139466539, 0.018189535660201567, 0.013519849195744723, 0.036281662166269033,
+            0.024338108395022012, 0.0085339997498125528, -0.0042593930368392836, -0.012477170035219205,
+            -0.015205167155593021, 0.0023949916265967935, 0.013315510714277468, -0.013329156426153064,
+            -0.0099072449211759679, -0.026586932148749551, -0.01783478478913093, -0.0062536515352004376,
+            -0.013571298283037186, -0.039754818306644728, -0.048446775661989509, 0.0076309336726626004,
+            0.042425943351903826, -0.042469421383761044, -0.031566510727114555, -0.084711409231513352,
+            -0.056825275830069646, -0.019925414163083934, -0.0081772221159632525, -0.023953786343309517,
+            -0.02919102042621027, 0.004597927058425876, 0.02556324052662055, -0.025589437690388277,
+            -0.019020020359009092, -0.051041838046412831, -0.034239384661094212, -0.012005818011365195,
+            -0.010282072536189398, -0.030119588927086233, -0.036704908484967116, 0.0057814522903263223,
+            0.03214332320038818, -0.032176263621264897, -0.023915851397671564, -0.064180215937772248,
+            -0.04305274232341072, -0.0150961646753073, -0.0056740069092075769, -0.016621041630787356,
+            -0.020255051071903757, 0.0031904073935587014, 0.017737808917606263, -0.017755986592874438,
+            -0.013197602486498403, -0.035416885786755371, -0.023758007594634051, -0.0083305911691198345,
+            -0.0024151020326977513, -0.0070746321022147991, -0.0086214232373896336, 0.0013579749733497674,
+            0.0075499764201905012, -0.007557713622698776, -0.0056174687662357125, -0.015074953947731928,
+            -0.010112432598828583, -0.0035458588591893471, 0.0012551206821372694, 0.003676663325103221,
+            0.0044805256540731897, -0.0007057351829447148, -0.0039236982232359928, 0.0039277192222490955,
+            0.0029193802722640295, 0.0078344046031587102, 0.0052553983764119204, 0.0018427713321647425,
+            0.02421734572941869, 0.014527897329598321, 0.005416425095282543, -0.0098715175786782197,
+            0.010418505462480245, -0.013311315485702259, -0.070947176979023502, 0.00090859714559723623,
+            0.01527962857851538, 0.032232091776856889, 0.011061717715703176, 0.007058147499404332,
+            -0.011335309463313402, -0.036467209794990713, -0.02051392767458491, 0.048864143378531358,
+            0.08474002370397278, 0.019298447551697712, -0.014265417499641234, 0.0037524680992031215,
+            0.0073265796515550449, 0.0052273229326176137, -0.025574800412278713, -0.065965012444696658,
+            -0.046651899970529896, 0.10424906575577203, 0.2093910120327821, 0.037487562905780307,
+            -0.03724325123570528, -0.011867004976016466, -0.0061543118827510233, -0.0034665151123390221,
+            -0.0087488821683031921, -0.014552926884082721, -0.016140032854848371, 0.032715958739993077,
+            0.080570758600552406, 0.0098504122904773256, -0.015224894875847661, -0.014047719205179617,
+            -0.027498936868885965, -0.016956737769361959, 0.0089004733171324651, 0.046040497485135397,
+            0.015714580115223122, -0.044768880997250252, -0.047117262576065175, -0.021612811533602977,
+            0.0058045076942363875, -0.024643354524531595, -0.017193846614427164, -0.010283205588995717,
+            -0.0048698291436343796, 0.004638171969454645, -0.0092714769653501703, 0.013526124151054033,
+            0.059060144713952573, 0.00075554113655291934, -0.012424006579657958, -0.023697841162113958,
+            -0.0069367040836559486, -0.0037274930309305013, -0.015738441481633648, -0.030004576150377577,
+            -0.028948097832538485, 0.060259646047058746, 0.1406716654332843, 0.019139552624478869,
+            -0.026202241802443186, -0.020502527259815655, -0.0022868252020396269, -0.0011820722290765404,
+            -0.0067180723328167076, -0.013431426851472359, -0.01234263317353667, 0.025951651753677488,
+            0.059350841545713719, 0.0084013401211213111, -0.010991238481653277, -0.0079741663471731162,
+            0.0074588947183668848, 0.004614177952467882, -0.0028975826702438306, -0.013606848631653295,
+            -0.0051471338726627311, 0.014066551809515326, 0.016880895277579959, 0.006523331499931808,
+            -0.0023180936908537477, 0.006300332662305683, 0.019142845092403625, 0.011643274292324146,
+            -0.00093637144120902556, -0.019878386822493915, -0.0013138530635844123, 0.010238541262399432,
+            -0.011817361224986112, 0.0078532753794394398, 0.0040506812542389957, 0.021333139596370287,
+            -0.004625248954434876, 0.00044266174011158704, 0.033289248922647431, 0.025675996339362277,
+            -0.0068490287499560504, -0.07560496577766547, -0.07944721854802457, -0.030784063284993932,
+            0.013198747469383694, 0.031367699187886601, -0.0041727702036553037, -0.00044452439581809181,
+            0.0019864765801939372, 0.005853714154149682, -0.0022061786054502139, 0.034449242725120593,
+            0.047943460812495287, 0.010427049718302897, -0.012297736862959317, -0.017335489610473927,
+            -0.060544174979970972, 0.044450395677753017, 0.044979055900733839, -0.084509340155626042,
+            -0.12802408033884383, 0.060969729112454275, 0.21222125795317931, -0.0077058272591858483,
+            -0.076682964876112883, -0.00052738923804438592, -0.11483018526702225, 0.072786138595766436,
+            0.13560227732503, -0.082858251168514432, -0.22570877892679628, 0.029716532299527958,
+            0.29516005232103437, -0.047700713905995493, -0.12473362445999334, 0.022739977419247877,
+            -0.11539808348261088, 0.046521386256986798, 0.24806609384931302, 0.092456068984954079,
+            -0.18690900127328394, -0.15345659404508938, 0.066376914484331431, -0.11871420755386035,
+            -0.081097599390635433, 0.071086085043274447, -0.020288756072552594, -0.0013037106018754276,
+            0.063720961012109972, 0.064566671294909547, -0.01695520909629512, -0.024594667901204473,
+            0.0088534442024882538, -0.020846413838115051, -0.014474613096020605, 0.00025003746689378561,
+            -0.0068794343780705829, 0.017602346855292217, -0.07737674433255011, -0.1140168371296045,
+            -0.030811398407877912, 0.19562307492920258, 0.2523241332866078, 0.070623906035910955,
+            -0.053720559512484167, -0.067268224764045578, -0.029467961994308359, 0.032794756222035301,
+            -0.063140945430017026, -0.14243757591702788, -0.075770674438892585, 0.23759313477023369,
+            0.35317124624815788, 0.074789417180407214, -0.08681768047960059, -0.07746852173604532,
+            -0.020713180318186118, 0.018677803705699662, -0.017467302826958946, -0.06506025028529247,
+            -0.047435200099119244, 0.10753279763498863, 0.17607195407657564, 0.029996717613779644,
+            -0.046823987065367861, -0.03376437258439325, -0.022133528350418326, 0.012187862848127614,
+            0.050672535339805085, 0.0083539698405011888, -0.042184530098211027, -0.06464640329291034,
+            -0.026540163633146045, -0.035601474087554569, -0.007360673402146886, 0.032805458941468947,
+            0.013123739864954277, -0.025061668126369278, -0.06892034167402579, 0.0034625386819912563,
+            0.045696040992242996, -0.011114604804481905, -0.021115574755191907, 0.018431089998379939,
+            0.023380582059463716, 0.0058881394760505173, 0.0030873690945018061, -0.00646770480753829,
+            -0.020020610870068109, -0.0051265792179943509, 0.012551771172680788, 0.0039851427226040093,
+            -0.00097321362099881889, 0.0047664394877019057, 0.0046594281250820734, 0.0010206012903972144,
+            -0.0095100406739322459, 0.015982851060889272, 0.035445260850327322, -0.025133304573856059,
+            -0.026252223735119106, 0.033186760825938827, 0.030511559105851599, -0.011716565758289124,
+            -0.020144680530269139, -0.0056551751211859061, -0.029633236583048901, 0.048328120459280435,
+            0.10063316885798024, -0.09363072963801479, -0.077157129338934011, 0.12042334359654787,
+            0.10537048175684188, -0.03539895263777372, -0.064938371131789838, -0.018561354816218047,
+            -0.047241187138299418, 0.096136855100917476, 0.28751735101169207, 0.049063647675169422,
+            -0.18315008613596667, -0.028340511257292339, 0.034644047895598523, -0.070804390803158757,
+            -0.07545425747621462, -0.017419641391963947, -0.0066417235390531029, 0.016769211296665476,
+            0.06207723844901241, 0.040691401566320243, -0.03599779618134076, -0.041524708864927568,
+            -0.017848723363421738, -0.012403288515748847, -0.0058253469450675732, -0.0003752699345907144,
+            0.0021681406487805109, -0.017839681773020418, -0.10257563578587325, -0.14173488237543014,
+            0.050706138104035889, 0.15624881904646815, 0.092184711802059047, 0.013356926979918537,
+            -0.016278535479197335, -0.007760124190660851, -0.0030582973846671573, -0.0032077946037962785,
+            -0.044167511704562817, -0.094797102796947849, 0.017855206452457726, 0.10700136186300817,
+            0.068110442077768965, 0.0025157046641255624, -0.01875126054822808, -0.007140003337542257,
+            -0.0064775968803245706, 0.0094706549492343806, 0.014718752202339497, -0.031826108889024311,
+            -0.013421111404316025, 0.03894220065802477, 0.030669951106545395, -0.0069148206963151717,
+            -0.015802726671517078, -0.0047544413874560775, 0.0059370328157661726, -0.011671351653260423,
+            -0.033400290979149136, -0.0019003783604834923, 0.02172373588183309, -0.0011769540138568896,
+            -0.0072217196502707536, 0.0085892323341899193, 0.010086446357319112, 0.0024509831246996528,
+            0.0026351417364288807, -0.0067089234963456082, -0.01260486767023241, -0.004567266957432238,
+            -0.0018612019523636741, -0.0015627912747896453, 0.0014581067397967989, 0.0046648852675333936,
+            0.0068596452030877325, 0.0036820787212506643, 0.0022355735194332905, -0.0056916451608631843,
+            -0.010693583570848235, -0.0038747293646736757, -0.0015789867169196446, -0.0013258242401244806,
+            0.0012370130877341163, 0.003957545748345591, 0.0058195128393786905, 0.003123762783573117,
+            0.002927436420704187, -0.0074530894165624959, -0.014003022374804611, -0.0050738764634290032,
+            -0.0020676498369377972, -0.0017361389076467255, 0.0016198425748210582, 0.0051823227729261897,
+            0.0076205294474374716, 0.0040905015481621735, -0.0092703534614171149, 0.023601801488300579,
+            0.044343564910402075, 0.016067514875092441, 0.0065476553776850493, 0.0054978551261353212,
+            -0.0051295779181537359, -0.016410933305468913, -0.024132036153287167, -0.012953447910173785,
+            -0.016984621723318712, 0.043241897079333923, 0.081243792806954818, 0.029437999675313842,
+            0.011996246985347849, 0.010072861838079549, -0.0093981249908902283, -0.030067191664274812,
+            -0.044213363296546654, -0.023732580821506588, -0.0075519804917226346, 0.019226920003750262,
+            0.036123944845313484, 0.01308920521662746, 0.0053339676728185337, 0.0044787606892978497,
+            -0.0041787481491289821, -0.01336896685651478, -0.019658869212880164, -0.010552368507341016,
+            0.0066865772601502338, -0.01702365177197096, -0.031984397790002367, -0.011589275429255898,
+            -0.0047227329290027509, -0.0039655265809462699, 0.0036998933432741384, 0.011836978375732417,
+            0.017406102675078243, 0.0093431421571134234, 0.0048111360057527565, -0.012248883218270926,
+            -0.02301346142321279, -0.0083387326772660399, -0.0033981078145455838, -0.0028532815778653789,
+            0.002662152755993311, 0.0085169602693745683, 0.01252406486035529, 0.0067225915277833647,
+            0.006597530455803172, -0.016796943587853282, -0.031558453648275517, -0.011434938179939499,
+            -0.0046598391256784943, -0.003912716681972836, 0.0036506209478728282, 0.011679342404969616,
+            0.017174301297624667, 0.0092187172205155064, 0.013553633656293817, -0.034506793331275647,
+            -0.064832094731995318, -0.023491359988636773, -0.0095729383638020783, -0.0080380877153333787,
+            0.0074996514645777248, 0.023993451695874725, 0.035282017968718687, 0.018938467480348071,
+            -0.030666052844411904, -0.010414711285775636, 0.014549944198106209, 0.021809887899915243,
+            0.029056281216154726, 0.025067762010844971, 0.035372527504605282, 0.051676691036412675,
+            0.049224098052805906, 0.021348293866460179, -0.015296471938045272, -0.010520012043863434,
+            -0.0035283385806936306, -0.0011032898180936218, 0.019371766594791943, 0.01137988440061872,
+            -0.0067993177369489212, 0.0073326253624945627, 0.01544022563853617, 0.0088380856934097869,
+            -0.011770377466901176, -0.013184076637745332, -0.013023012599793483, -0.012300238057504116,
+            0.019568342480961121, 0.0076823261315162655, -0.028592232369944934, -0.011984486863809528,
+            0.0031716709811848974, 0.0050703768820311379, -0.020216298344429378, -0.017217942389215753,
+            -0.01137642903090055, -0.0089159750911007828, 0.02863860212545135, 0.014340355335197046,
+            -0.024199956094457013, -0.0017887292302884005, 0.014734197218725388, 0.01055375259178281,
+            0.003802938432636677, 0.0017769356885123093, -0.00082119066365299775, -0.0016124631622256786,
+            -0.0040479740605038625, -0.0030062209728715203, -0.0021585169767091021, -0.0047272688496451483,
+            -0.0052736607120147973, -0.0024823887155648082, 0.0071368335179237902, 0.0056282737057520111,
+            0.003104532018266529, 0.0021348260292728301, -0.0096978016866057261, -0.0051574950170496202,
+            0.0064772295346161267, -0.00092741219531197131, -0.0059717544571566104, -0.0038787563609384641,
+            0.0059121858590555441, -0.0020783840089742449, -0.011081872697780569, -0.013399508277610193,
+            -0.0018584363463574234, -0.0056954817958889178, -0.025576533251547962, -0.024116216092507727,
+            -0.016483130650087687, -0.0055051895461987179, 0.014151596661786305, 0.0055647161209357492,
+            -0.0051778886398569412, -0.0083577494049673663, -0.014103671249638614, -0.011407990870366451,
+            -0.012841376221636759, -0.021219971624164422, -0.021417426071473449, -0.0095937551997803509,
+            0.0066811356005736346, 0.0021288885010506031, -0.0034538108865697853, -0.0050669983882327243,
+            -0.0062020388866538701, -0.0054910331204232532, -0.0083497938432239033, -0.011744059057945668,
+            -0.010964158229646583, -0.0046987483569683299, -0.00086462937254005827, 0.0052399335271220374,
+            0.01161853164042897, 0.013066335281688515, -0.0042500301189165174, 0.0018749161546258494,
+            0.02639783750111236, 0.020623332243409398, 0.010857849966776075, 0.002483424186531886,
+            -0.064383535786565638, -0.1255746473087154, -0.074475757351438465, 0.050600194539564117,
+            0.12776243573556159, 0.18469031466648542, 0.070793698217967729, 0.10242500529817571,
+            0.072144008829196776, 0.016466092141934889, -0.071583759111937803, -0.078444574172891635,
+            -0.049579915705999997, -0.0079779904678508838, 0.011860913975499624, -0.0014419599099895885,
+            0.036283686192755848, 0.045694029951744118, 0.043638715059660667, 0.037993243785658493,
+            -0.04489791013619697, -0.067715736566835605, -0.032939444342843502, 0.047347793857013223,
+            0.049854157822205238, 0.028555041911666565, 0.012925071436895429, 0.04721043460347895,
+            0.062369460405471658, 0.047551397269226969, 0.028106845699176937, -0.023675372927445155,
+            -0.005923840213118434, 0.07715033300519164, 0.11281782085007395, 0.1677891295536364,
+            0.011951728123111269, 0.041713134617099329, 0.027660539363925575, -0.017284767320509868,
+            0.076203960447655497, 0.067120531708516284, 0.032715258290657238, -0.019034772254838486,
+            0.018154322679549119, 0.10195840606103801, 0.0035602923923473504, -0.027542063471087778,
+            -0.069186432206267606, -0.086063486868821329, 0.053690554048229977, 0.056726294681003618,
+            0.022352606178656656, -0.046647964690223802, -0.0094250363431350927, 0.063422849163377093,
+            0.012036666271246723, -0.028443499342586217, -0.071350379420045726, -0.07863981213614557,
+            0.024061165497421232, 0.039474681285771446, 0.012441874696250934, -0.056529493108656681,
+            -0.036041372399418056, 0.0019235005440239629, 0.010024398989265286, -0.027087922878664242,
+            -0.055550586342617947, -0.049539263203321797, 0.050830378576851729, 0.049727948336971778,
+            0.032584480915308606, 0.014436136237495605, 0.0045206247542492759, 0.01870442964833343,
+            -0.023341831952157811, -0.025945900816016606, -0.025599162180650205, -0.026648232894071172,
+            0.044318430086545658, 0.024448863195178638, 0.01926426788963434, 0.036944936818534002,
+            0.044594443218785182, 0.075692184573202773, -0.01033983230298521, -0.0018316381217975382,
+            -0.0077407629656693674, -0.025258019465034233, 0.043045977631051342, 0.037138660183536731,
+            0.030544019029758479, 0.040091361967417846, 0.016485723188040431, 0.0098605676612807235,
+            -0.031917719821788856, -0.017863939877307781, -0.0022406243470408684, -0.0037468883993094122,
+            -0.00081623469059498841, -0.0059279147617479879, -0.0068322637546427388, -0.00056386113380500096,
+            0.0026233886577993483, 7.6126323086707015e-05, -0.0034940001461311338, 0.0065952030951402082,
+            0.0047524142880643779, 0.0049514869243124111, -0.0037746577949942925, -0.027413499966759639,
+            -0.031595640244253952, -0.0026075623206603697, 0.012131798072982718, 0.00035204435948934035,
+            -0.016157920067929613, 0.030499358897003885, 0.021977426154735157, 0.022898032797459385,
+            -0.00721774448557765, -0.052418960595012463, -0.060415876226894906, -0.0049860727999516312,
+            0.02319792240704166, 0.00067316466084755221, -0.030896506333199868, 0.05831961238564045,
+            0.042024325131112858, 0.043784671069682632, -0.0053054790850449512, -0.038531108943014432,
+            -0.044409325983614724, -0.0036650653136189224, 0.017051877133221229, 0.00049481677220002552,
+            -0.022710802312175763, 0.042868445174002436, 0.030890422692540678, 0.032184383510658825,
+            -0.0016140151991371591, -0.011721805792983934, -0.013510057427807887, -0.0011149739782568987,
+            0.0051874653402022132, 0.00015053151248301715, -0.0069090047343274849, 0.013041295793484729,
+            0.0093973816377997538, 0.0097910260936638072, -0.001783383154454125, -0.012951842710134146,
+            -0.014927745937795804, -0.0012319746502641679, 0.0057318160987436233, 0.00016632765522916262,
+            -0.0076340065842195092, 0.014409794432411459, 0.010383503276665491, 0.010818455123344202,
+            -0.0010681729489589783, -0.0077576195488801326, -0.0089411040806687877, -0.0007379019993144347,
+            0.0034331214185768051, 9.9623404839185427e-05, -0.0045724550582816282, 0.008630872493282574,
+            0.0062192901664790854, 0.0064798083818505669, 0.0056111135411601515, 0.0407507830453041,
+            0.046967628443368881, 0.0038761999210311228, -0.018034190155252705, -0.00052332184264207633,
+            0.024019110874203178, -0.045337981612698912, -0.03266993730139401, -0.034038439740455437,
+            0.0037450055067238443, 0.027198149848241808, 0.031347436808738707, 0.0025870782943420321,
+            -0.01203649524204106, -0.00034927883175185734, 0.016030989540786071, -0.030259767434361328,
+            -0.021804779782222419, -0.022718154486308408, -0.00015341533260430858, -0.0011141807929783451,
+            -0.0012841576429382328, -0.00010598047887707346, 0.0004930788266218892, 1.4308317584219471e-05,
+            -0.00065671454633651149, 0.0012396009237200544, 0.00089323968593566839, 0.00093065636897341831,
+            0.020586884292746389, 0.0012578735530891527, -0.010135450641581882, -0.022023638445864128,
+            -0.013319924177584121, 0.01515466719050652, 0.029128652570062148, -0.028396683874577753,
+            -0.066875780786011196, -0.03215946984537793, 0.0031717021928585653, -0.013067286063511509,
+            -0.014067611668350603, -0.0058876158425923159, -0.0050229186270619366, -0.0062117314571740355,
+            -0.0072425914840069452, -0.010301192131884331, -0.020527035017581911, -0.0068052307769472043,
+            -0.01473206552662786, -0.028644457851966076, -0.016592654565597355, 0.016709263233769606,
+            0.01021987427823776, -0.030980973971020717, -0.054840201583850764, 0.0096101742904716146,
+            0.030558674807819444, 0.0043650102254101861, -0.012749577300525583, -0.017026703592411502,
+            -0.0084330693348339744, 0.012212462218609971, 0.0064329848061864137, -0.020452576456216846,
+            -0.03490921031183844, 0.010771219081639699, 0.029971137660345995, 0.013745471161782612,
+            -0.0151596994366896, -0.0086257572296515664, 0.00083238020312080432, 0.016444928951458951,
+            0.0099589849411792167, -0.016734449395680365, -0.030828587251602715, 0.017928395589163384,
+            0.04442133302260208, 0.018592817172000051, -0.031372315831949306, -0.0067987703246322187,
+            0.012059341289077329, 0.035882621822405571, 0.02282991736357139, -0.027424957361074493,
+            -0.053672236275986537, 0.04197848784127213, 0.10029704670946028, 0.040566469319694147,
+            -0.027979595151968139, -0.011407978647190885, 0.0058140763172310509, 0.031260251704861297,
+            0.019458596728425172, -0.027999864273410821, -0.052999249464004868, 0.035122485378814995,
+            0.085504931534156406, 0.034802454588551121, -0.015966426570732124, 0.0044578149080735097,
+            0.013570245347133168, 0.019660066187979861, 0.013290575364194711, -0.0088211445642228815,
+            -0.020171803193473135, 0.024877755567766571, 0.057088472776059634, 0.021969235992303587,
+            0.0072257971344982233, 0.0042375833089725416, 0.0030198200946229886, 0.0009556922504343748,
+            0.0050973573567387976, 0.0048505860663048544, 0.0013633198851678954, -0.0060887821013611097,
+            -0.015257473351906222, -0.029855460776599934, 0.02609211882982955, -0.0091321961409828751,
+            -0.01897518553629611, -0.019328530056374135, -0.0074184689990886661, 0.0084172296958756106,
+            0.011179381570869366, -0.037882238596248723, -0.085995245065832976, -0.067655949569152898,
+            0.0057617599049862214, 0.0060149042177333493, -0.029958629451557924, -0.044290256964210281,
+            -0.025144264428691495, 0.011551405691305422, 0.011922385122037527, 0.01545520748714913,
+            -0.010603042677643115, -0.026489357863075758, -0.0098607095847068026, -0.015279300881788131,
+            -0.0014025526721019622, 0.021254058724822132, 0.021529678745037546, -0.0062687620251863771,
+            -0.023947423635108954, -0.0014937067134517248, 0.019536716068002682, 0.0093201604098355692,
+            -0.021028807578466611, -0.03394234752624109, -0.017338578074420987, 0.030469059695723694,
+            0.040056992367757366, -0.0096913892000168693, -0.052035091310271023, 0.0036122639589477798,
+            0.042042498494596334, 0.010066448978293637, 0.00060731819847180749, -0.004285907619041884,
+            -0.055140186779171152, -0.05849687304657538, -0.02387039992378789, 0.014540717509080935,
+            -0.0022401860257923976, 0.02625784181112694, 0.00025473677674713383, -0.038333184474313595,
+            -0.0012805382140780469, -0.001252448080490689, 0.0075494664548493625, 0.010766288888863274,
+            0.0059520703896532188, -0.002795696718494224, -0.0025897702711913779, -0.0038571410152382678,
+            0.0023329737671570522, 0.0064965452774384171, -0.016346381859582142, -0.019157465345105866,
+            0.062881012320155263, 0.10275520464814264, 0.062308554696008593, -0.027104288080998629,
+            -0.035311909750447498, -0.033370198948944899, 0.03066511717565059, 0.060032573021746263,
+            -0.025829449783124674, -0.037236041717187224, 0.025773152570993413, 0.086166344806255624,
+            0.068416277814344978, -0.023967897664873169, -0.060747719669975733, -0.017864402089355653,
+            0.050397672089921686, 0.044546863005488123, -0.014415522793154244, -0.021513594903563353,
+            0.006649929761004824, 0.040080954974961523, 0.035026191057808638, -0.011394306315535693,
+            -0.034423832855098271, -0.0063058159549244453, 0.028331333719725633, 0.019573828811802259,
+            -0.0074870115655233608, -0.013115135983489413, -0.017060501395800759, -0.00042590791806315295,
+            0.0098173366473358857, -0.00066004553498488555, -0.01925875688024109, 0.0064444202100895718,
+            0.015256070082795191, -0.0038598079026574412, 0.0035240252607605296, 0.003986029195833107,
+            -0.015077862003780584, -0.023728156924505733, -0.0140539347292325, 0.0062332743280877441,
+            0.0075103328907188648, 0.0079150604020934885, -0.0065707483189833028, -0.013982491358444114,
+            0.0054374126697925721, -0.011226355936711632, -0.030585131216200309, 0.0042463441119386285,
+            0.01911524244960346, -0.00474303219879787, -0.019801524464798249, -0.018467883939423533,
+            -0.0014190917716106876, -0.010530500964661493, 0.012015888452446052, -0.037166955238405137,
+            -0.059472523938163512, 0.031000579318752403, 0.040064820711676559, -0.00058843008457888993,
+            -0.0051218365084493723, -0.025792652824845268, 0.0076508505097052223, 0.010650498224300788,
+            -0.011206078412726871, 0.013652543623126231, 0.0023259676601789063, -0.0065839343923821646,
+            0.039461312462866147, 0.037364970828805966, -0.026196122981645864, 0.0097166307470276121,
+            0.00043173480550579946, -0.008374746637109045, -0.03327443396068263, 0.10297341049179018,
+            0.10248349287135494, -0.0993312788259718, -0.036139724872790026, 0.02016435846296637,
+            -0.075755499071971127, 0.034329763785903231, -0.031235708137498409, -0.081750351179384104,
+            -0.037447200420550324, 0.084311478750724408, 0.10453871911746319, -0.063351570915353164,
+            -0.0082983181878439269, 0.057390255713104299, -0.032074136486287937, 0.058224713758603573,
+            -0.012666860396847774, -0.031766779836063033, -0.011374347076024638, 0.0057486733117645865,
+            0.039708101700132253, 0.01440025149710604, 0.00010171705162565837, 0.034850420925669839,
+            0.045001520502462602, 0.038790497420130188, 0.012668723092544871, 0.040599229370855229,
+            0.0068026982579375544, -0.035140699526666423, -0.017945087659652342, 0.043605109544943399,
+            0.012420335437303268, 0.0090215466227895162, 0.050514936187173162, 0.0063827902434410175,
+            0.017677948213683875, 0.050148395664136744, 0.0058918456697975435, -0.038619650810372642,
+            -0.019439130310139833, 0.050084352198501582, 0.020469734622481663, 0.017135079114995705,
+            0.055949490732623945, 0.0099515077758193099, 0.02096244040462095, 0.058125730106262888,
+            0.0019293701381345408, -0.021734463871487149, -0.00095037928517443127, 0.032177909085410183,
+            0.0057675589275455368, 0.013051325509867441, 0.045934850449372976, 0.013973534403922679,
+            0.014707719751967056, 0.04351508017287465, 0.0052486877441345267, -0.013299242815959308,
+            -0.0051880541870060158, 0.013301131792957169, -0.009313107297318093, -0.0093944408093257804,
+            0.02138988299013991, -0.0013023070460211801, 0.0044352555264118819, 0.015637855800639318,
+            0.013905480107541422, -0.028198141682641745, -0.049338646490945902, 0.0049043642675624674,
+            0.059478635907134744, 0.010491361621346396, -0.056652653337385256, -0.014846031002893927,
+            0.0183748444213797, 0.063948553944238415, -0.019906324942378699, -0.023006697603821895,
+            -0.061108963525821181, -0.0098929198925434177, 0.11050739644080938, 0.1956787352191669,
+            0.043008198970222844, 0.00039968590100229739, -0.027526369742844059, 0.053387570688642361,
+            -0.04863225998489875, 0.033440754702301498, 0.043637059186889621, -0.018279396392252029,
+            -0.015638534992943334, 0.1440358192176463, 0.10801220611608731, 0.018485194719235605,
+            -0.044865601249362203, -0.049838823869034751, -0.066907412230275881, 0.098989336023235064,
+            0.19489219939894173, -0.01587742685039626, -0.21835233014934152, -0.11325613296880598,
+            -0.01114257348131981, -0.0022251785105115284, 0.016972272780280274, -0.096647930856048725,
+            -0.03019627793296446, 0.027789144184842459, 0.051895506513098509, -0.0081976863423298737,
+            -0.045121415341903913, 0.010278337376972708, -0.0077411326066987533, -0.0048102131496928803,
+            0.0043188243427616999, -0.0086143282555617637, -0.018392101230153866, -0.00094354278864481472,
+            -0.024963511000005174, -0.011201656970538671, 0.053827245464730271, 0.17197236863822957,
+            0.13510580632496422, 0.026624742724415736, -0.058755909866529003, -0.037533029802676622,
+            -0.026369287316556293, 0.0014016766547635231, -0.038449232398182244, -0.018265430048607711,
+            0.079952620047525111, 0.28328443168639816, 0.26034421282286968, 0.05437279051929568,
+            -0.11053301174210171, -0.091684822559387535, -0.011173573534855159, -0.015248541195789144,
+            -0.05817481998138261, -0.010944926369278823, 0.094832912544945566, 0.22168297981850663,
+            0.17015974034970521, 0.034151746382437294, -0.07526480210030341, -0.036321325649839184,
+            -0.010515842277124631, 0.012275026892521308, 0.01712488617490129, -0.0045011361156997711,
+            -0.015191080308989137, 0.029677270673062632, 0.048060969307216088, 0.010757644800225374,
+            -0.018391103292804876, -0.032842703513115107, -0.021354865791779382, 0.051121849140152303,
+            0.085670653274153991, -0.008942289781743995, -0.10693158024560434, -0.0073520483973984543,
+            0.14092079723405238, 0.03695537413027563, -0.048022724752915295, -0.13999923738776809,
+            0.01069630171509391, -0.013138695386108994, -0.053753307789447966, -0.033248105547095452,
+            0.034187444534212318, -0.00086365111041479189, -0.066035946513936461, 0.0096040227976101275,
+            -0.0029111495050353799, 0.0017527230243379035, -0.020021211445182947, -0.0035056184953684991,
+            0.023645004219021371, 0.0053557172306851778, 0.017087935724174396, 0.052754792547168798,
+            0.064981724213663564, 0.0078614544298362052, -0.024321895124112168, -0.026183101872590864,
+            -0.025031436652838988, 0.038239228920815001, 0.14631630156383263, 0.092972805854873802,
+            -0.10162418186535169, -0.011614267520646898, 0.17016828167105691, -0.029364716885519507,
+            0.014750717993181981, 0.002004923372036109, -0.0087546818624204097, 0.046432471676449649,
+            0.14173022044443401, 0.099434712603474057, -0.13093450907385173, -0.064227166546155443,
+            0.1284877056967007, -0.040669320267287395, 0.040185125537174529, 0.027646304801315996,
+            -0.0040114425922717703, -0.012193989862605038, -0.026741309170889696, -0.022188550800241638,
+            0.036583351261074752, 0.031484243235025543, -0.010955932089519782, 0.012142305554160878,
+            -0.017048734549482573, -0.014612561980355852, -0.0080446970924789619, -0.023250775722051795,
+            -0.050331267794304135, -0.042061576736576074, 0.069892837754619991, 0.060949338156025448,
+            -0.019460483351738334, 0.023243939732739478, -0.03291502721985537, -0.028323628927715679,
+            -0.020763932274446444, -0.0057254504020568314, 0.018797633316419281, 0.0013241969271048301,
+            0.023752023958235512, 0.058515155429489589, 0.063032283928428537, 0.010074765108654453,
+            -0.027438330299191113, -0.028857740934485596, -0.0049856798141189873, -0.019312895731968691,
+            -0.04462418922660525, -0.035992921832331951, 0.05746459398116157, 0.046697002459851027,
+            -0.022290617637997411, 0.018914224404691003, -0.025594143582897903, -0.021550044583187329,
+            -0.0020978219328993534, 0.00073300579458467085, 0.0054916279277036004, 0.0027884784663637805,
+            -0.0013845692646102504, 0.0035250943916127226, 0.0091044578911512637, -0.00018808815736807527,
+            -0.0013826295560302627, -0.0018466172426693959, -0.015423438532081227, -0.0098775123914322093,
+            -0.0014446638837883798, -0.010401958134656549, 0.033873210508029765, 0.053701692051139803,
+            0.035085292723507841, 0.012655718004037076, -0.026340619098477448, -0.026020030167934263,
+            0.0011023646516754996, 0.010376306631732264, 0.011900922315946885, -0.003426107289355388,
+            -0.018845042641189393, -0.027933471988735505, -0.041974839616426327, -0.014625058386089955,
+            0.006032249366363626, -0.0018819605894720565, -0.00088203825813703098, -0.028886814561671168,
+            -0.0052491829420488944, 0.051857257670134028, -0.00010043212614074424, 0.0051305072331191033,
+            0.11900379124463834, 0.023150138187354709, -0.029541780645580308, -0.00014299812929851138,
+            0.00056181793124107442, -0.032316901323224033, 0.01387178012353027, 0.08798266898656866,
+            -0.037334463955625348, -0.045695043688580857, 0.13465647672135522, 0.013460734740628512,
+            -0.042077288776736013, -0.0039713241996620048, -0.00036097043695633619, -0.043927430125867702,
+            0.0045166367974868128, 0.097828816989900813, -0.02371585365811589, -0.024758495461965596,
+            0.18192940724472409, 0.027329855363313886, -0.050638294506337368, -0.0026301929201473146,
+            -0.0017140669386926583, -0.034486987915434503, -0.014694853044835629, 0.049118588957085006,
+            0.01576871721694843, 0.028080567985181229, 0.14142495051077236, 0.032947576222601825,
+            -0.031415389446689375, 0.0014561897226009523, -0.0013874957704731899, -0.013124109421126746,
+            -0.014965873439101466, 0.004464822674730029, 0.023672248717517837, 0.035105098680984249,
+            0.053097086061113755, 0.018443443842233835, -0.0076692729501703881, 0.0023636166696338642,
+            0.0006521299694108438, 0.0010983324619647178, 0.0080865360662185064, 0.0099990702393113664,
+            -0.014864751745111818, -0.02074096271348369, -0.0039168220713189398, -0.0058487603474748993,
+            -0.0024829074421869909, -0.0015170256323104028, 0.00079635760067547044, -0.0093756974093352902,
+            0.012099728258612275, 0.037781939400731504, -0.026054993299210915, -0.034293431390522371,
+            0.039688643833584225, -0.0011819959273101036, -0.015899609442831725, -0.002710967714195078,
+            -0.0019330253298633004, -0.017311274959054455, -0.021052059028798191, 0.0038988337412918135,
+            0.033697029988464043, 0.049721466042107913, 0.069936296418669774, 0.025153863843047838,
+            -0.0095164891075507439, 0.0033708640155146797, -0.0021719655934129747, -0.014561300637414508,
+            -0.024669374828732302, -0.0072866961255943496, 0.041468059924808398, 0.059958109741484425,
+            0.05828999973030511, 0.025543617982501494, -0.0048217382743488517, 0.0041792104200557038,
+            0.012545196642771454, -0.013337399990438871, -0.020927967547525669, -0.0062615329011613662,
+            -0.060079582797753751, -0.060882438239523488, -0.012735674704380272, -0.012834518467673504,
+            -0.003064406701833066, -0.0023490228605545917, 0.031327414211885472, -0.03932588790585588,
+            -0.077336519019020486, -0.030071728113446092, -0.081309326800435622, -0.068897829667471822,
+            0.033695165454718512, -0.013098487082794713, -0.0053169102097173002, -0.0054384460863665419,
+            0.010677643794442231, -0.018411028182730174, -0.020156601270003394, 0.0014892230937349968,
+            -0.042508824206306327, -0.05034959048641946, -0.0073606785556723474, -0.018952234591289207,
+            -0.0095695391280802636, 0.0032855958438415215, 0.044139264834247474, -0.065173532290124653,
+            -0.13150684264948673, -0.049874280012685637, -0.05131000481828548, -0.026561535737083766,
+            0.1045843774834383, -0.0079849847634371716, -0.010202473357339146, -0.0037640329698878368,
+            0.050203493005531827, -0.07241064644030426, -0.15410130280955223, -0.062857797187051104,
+            -0.046904456762505417, -0.01248250421413816, 0.13191838718276688, -0.0014311429930789943,
+            -0.0080838591834953358, -0.006467714263595015, 0.033441713786016049, -0.029878897620356358,
+            -0.092865564125463276, -0.05636343525078602, -0.063487311788300638, -0.025227793671852461,
+            0.068829579305683355, 0.015797690197785912, 0.011393773711808807, -0.017398194385098761,
+            -0.02984310785806004, 0.053784291694112286, 0.10663631032177158, 0.037052268868379333,
+            -0.015730516343846979, -0.035497789702002167, -0.11477901989032853, 0.00024822219749799342,
+            0.01128696284297798, -0.0021692933977360629, -0.013608336233622516, 0.014214057444269981,
+            0.050286497676963277, 0.031317889530385695, -0.008092224306690609, -0.032082533970553211,
+            -0.06103514453608886, -0.017298404473446091, -0.0068444328797309826, 0.0076295258339082019,
+            -0.022616001219252609, 0.0021485178206990165, 0.04204010337322462, 0.042602067971463868,
+            0.10426896240885433, 0.073216082568531002, 0.0023648936404481935, -0.014713046665694497,
+            -0.020219918519807832, 0.022674967654949217, -0.021533461311306745, 0.0078564303571419473,
+            0.053319523706132445, 0.044920787701895518, 0.061964394646223407, 0.028186104083563104,
+            -0.031400110485147875, -0.020102269160562226, -0.017594746270510705, 0.019247965812354009,
+            -0.016794412699669692, -0.0024461709981558029, -0.024275815121612195, -0.018487145898092167,
+            -0.027955343441495757, -0.028625205890536423, -0.00092606493476718368, 0.015035213150174597,
+            0.019907492102127323, 0.041055274665477433, -0.0050979405314876139, 0.0030480003745774293,
+            -0.0018679539515544545, -0.0050788597498071181, -0.022593182917663487, -0.0267018878812533,
+            -0.0098849241729815213, 0.0073950833876425034, 0.01053467342903233, 0.028381892856521512,
+            0.011595691662304859, 0.012822673062646289, 0.032918881603846824, 0.014329722260986253,
+            -0.022134923319970544, -0.033143426080693587, -0.02756932713722746, -0.0020652902821645582,
+            -0.00055173784402232084, 0.018413036299018769, 0.0012348189750081831, 0.002756806623000489,
+            0.0055246593187093041, 0.0017215704606538531, -0.0075352782844310458, -0.010141044778287828,
+            -0.0064609522611043932, 0.00081924937735556387, 0.001589958832215164, 0.0078041203409139519,
+            -0.022536180212928719, -0.017995883887570813, -0.053928000026634976, -0.026876184996234419,
+            0.0172464230955282, 0.031506685334472075, 0.036035659655235634, 0.0091861076859305456,
+            0.0092782949347898734, -0.0067021897745141532, -0.011262293219589816, -0.0071468056593227873,
+            -0.024270408659634844, -0.013171579634386615, 0.0017465757233531319, 0.0069705919985288628,
+            0.013330192361030621, 0.0059698456999365745, 0.0068248594148320402, 0.004405630997120334,
+            0.033013244455048774, 0.024719569682489839, 0.076615317110155429, 0.039139984512966623,
+            -0.019150983997638895, -0.038348480496175757, -0.048626896412690523, -0.014683580235322843,
+            -0.015538236750967738, 0.0029194256985874724, 0.016524013793850167, 0.0090583625623680015,
+            0.033537975180063066, 0.019124635158207129, 0.0027498839140382035, -0.0034441227561531531,
+            -0.015941485173285523, -0.0098250815118976521, -0.011704898417785249, -0.012458826933715503,
+            0.013966306956564645, 0.0073635801155801147, 0.027922000027569484, 0.016123239860798055,
+            0.0034134504503548152, -0.001520273417285941, -0.012732445483140391, -0.0085228740435006126,
+            -0.010239933288777234, -0.01175949307116941, -0.001757093069283823, 0.0034234917848728497,
+            0.0027998843932002934, -0.0014169051647191571, -0.01661859143502593, -0.020479561118135755,
+            -0.0094191789419473555, 0.00432119429537058, 0.0064428815420880881, 0.019748259055044674,
+            0.023124801554813595, 0.01316624905639621, -0.022436489136634295, -0.051036134952125979,
+            -0.069278988688613458, -0.04564041551789013, 0.0096050581169566367, 0.049123127842367165,
+            0.013486275172964376, 0.010176224232366861, 0.071634787079441903, 0.040191029284465545,
+            -0.018664419904238731, -0.0095029539358126094, -0.02230325641971535, -0.037134857346126503,
+            0.014943726612932588, 0.032983272517182534, 0.037779159206212352, 0.028345460671606183,
+            0.089978518374370889, 0.050290960319276073, -0.0070383177988948067, 0.036015154593176009,
+            0.034042796694013056, -0.013003213803037466, 0.013991097752618201, 0.0029673102113445503,
+            0.046163247566437651, 0.034578450078975552, 0.084432131147990627, 0.047108428473614392,
+            0.00045128181278126936, 0.054418281721572315, 0.058634146979305454, 0.0022666864108358518,
+            0.011073168294555904, -0.013757484614880921, 0.042762823949293129, 0.032005934564909813,
+            0.079920974112596702, 0.044447020848188246, 0.012774494199721088, 0.0876005598034406,
+            0.10220759850424006, 0.027464734038463431, 0.0068844780992954871, -0.041970176619428708,
+            0.03950703923795483, 0.02952404203157466, 0.056375108031563509, 0.031473836502923867,
+            -0.0013797938764862228, 0.031421238850107829, 0.032790712795654452, -0.0019337945436433265,
+            0.0078832716187697514, -0.0052445405942001012, 0.028684825842212443, 0.021475363791386586,
+            0.044894448333157588, 0.02519199141591345, -0.012018080343318287, -0.006893422643039146,
+            -0.01519140704601097, -0.023930817262984093, 0.0094588969059624106, 0.021423254701944124,
+            0.023701919486398396, 0.017784523350657097, -0.0015355158137544261, -0.00071424029266956186,
+            -0.012189589109752496, -0.036594455756513114, -0.04714487196716069, -0.025020100710233972,
+            0.0033473338743400241, 0.028808901015805775, 0.0001802420716085721, 0.00017938949830944781,
+            -0.018667422632633282, -0.010315422970852223, -0.0086451341299948817, -0.037008649689872802,
+            -0.045288185852352329, -0.01802407738917771, 4.1249054314167026e-05, 0.023075903527464386,
+            -0.0087825894566498659, -0.006542141410151265, -0.04212040514531689, -0.023448848758175714,
+            -0.0046698541904790667, -0.040138906358875827, -0.046063706961497808, -0.010245031011638919,
+            -0.0042291885870189986, 0.017283612128290996, -0.020983429271517067, -0.015688863892026932,
+            0.048649687513704964, -0.002264385400717701, -0.039649832334881993, -0.02666758539379032,
+            0.008213956439065884, -0.044238937201949484, -0.038524197042989143, 0.0063527189596135486,
+            0.025816226354674874, 0.0058123747013510956, 0.05377370767391651, -0.0039981846960277347,
+            -0.046125591462837158, -0.028187390818178955, 0.011808619955239977, -0.049082737376122454,
+            -0.043414893371188756, 0.0066601220650535104, 0.034108449253671909, 0.0087386733187235915,
+            0.028236431168366171, -0.0047602669647305307, -0.028312553413967174, -0.012507484230367929,
+            0.011057761434447219, -0.026101243333559353, -0.024279586806929425, 0.0028535893251896097,
+            0.027827417850913607, 0.0087065200747948098, 0.02342752162310267, -0.0055676053733485558,
+            -0.025979105597856076, -0.0089825868508794458, 0.012128126551900261, -0.021855449035557122,
+            -0.021046096867898139, 0.0019762105785188361, 0.02911880039094045, 0.00972780145699359,
+            0.047036803169102206, -0.01008997937214098, -0.050485860593232401, -0.018973089779942474,
+            0.022363530730713226, -0.04374627954273317, -0.041649036097546853, 0.0042310308391182352,
+            0.054406847935421859, 0.017846639980430758, 0.037715379358136382, -0.011420893134545994,
+            -0.045602909627912663, -0.012342261676596441, 0.024011139712334637, -0.035487530850394154,
+            -0.035250971067291144, 0.0025869527834281232, 0.056037868157519904, 0.019464116470174844,
+            0.077268760965992278, -0.019001539215165206, -0.086666268400103691, -0.029076076012008765,
+            0.041166448242037065, -0.072162450614859736, -0.069770054361976502, 0.0063635166186837532,
+            0.098419277543139491, 0.033072316953634204, 0.049487012959944059, -0.010928492388814288,
+            -0.053596968820806806, -0.019691692276942487, 0.024099668105948616, -0.046063657545638223,
+            -0.043992936154535568, 0.0043757410822704923, 0.05840722706376994, 0.019260554482995417,
+            0.034231425628578713, -0.0030892167981841612, -0.030199452608823139, -0.017474648746580702,
+            0.0085102590411859601, -0.031312303429919412, -0.02794030543484409, 0.004108123273663675,
+            0.023740546740599222, 0.0064048403398739373, 0.029076615746299869, -0.00087382723643332581,
+            -0.022960159422881318, -0.016351861923254964, 0.0040339170636305302, -0.026381311081646888,
+            -0.022757697337607245, 0.0039128438860823022, 0.013642395072117034, 0.00273177838184615,
+            0.042438942928510207, 0.024617494197600499, 0.010408881995801776, -0.017221932613093838,
+            -0.031901577332022493, -0.036169785699148888, -0.045050918216195016, -0.010363418382867383,
+            0.00060102392652825604, -0.010915773716672048, 0.0079631866860323131, 0.0017158777982787016,
+            0.0066112005252714464, -1.794257452638259e-05, -0.0045715242785172227, -0.0034534952272945144,
+            -0.0040772578861519183, -0.012948260367750233, -0.0067241632644576615, -0.0086795839249185457,
+            -0.021549049785455354, -0.01322840747105648, -0.0041164957409291995, 0.0095510371941691461,
+            0.016553438396757998, 0.019202170439003907, 0.02397333026594892, 0.0025012139284636588,
+            -0.0020206624700507478, 0.0038787569735182111, -0.0005345629332556914, -0.0010771753871638191,
+            0.0010996151223076583, 0.0010659903207575051, 0.00077554781720211221, 0.0013363102998458047,
+            0.0017236668334954521, -0.0027767718854165178, -0.0018139748962816998, -0.0016145930540301576,
+            0.004336097856416552, -0.0027367951400732783, 0.0094898789121152568, 0.0040536391787131306,
+            -0.00070077028089688981, 0.0023343977857570291, 0.0033131745105409978, -0.020964254778599856,
+            -0.012306449584948809, -0.013111269072281211, -0.0063158852938287281, -0.019823155453111068,
+            0.02437730154387252, 0.020449296057480457, 0.012620316805938486, 0.023935947065076908,
+            0.031061101489503952, -0.059702865080324088, -0.038143027870343245, -0.035284854145012971,
+            0.0027506828838730329, -0.0046542137155514158, 0.010701853591030937, 0.005801397096869324,
+            0.00097709039839083411, 0.0048311712602976615, 0.0065000588100918872, -0.024358687848474319,
+            -0.01467852166657818, -0.01498245247373621, 0.010739459828355663, 0.019217386590043965,
+            -0.018203583119124782, -0.018733733669569663, -0.014400321938924017, -0.024064519182864029,
+            -0.030976304871810658, 0.046601606686549897, 0.030736619977367246, 0.026902588695347306,
+            0.003387278694031973, 0.016972939053944446, -0.023248243599232443, -0.017986390483666015,
+            -0.0098579140072325884, -0.020117986662276988, -0.02621675990417752, 0.056054076731277887,
+            0.035390096273926058, 0.033408197493765654, -0.00049848392390399853, 0.0046785120312705982,
+            -0.0080924063036583761, -0.00529621347473539, -0.0020454480876196108, -0.0052786306652940814,
+            -0.0069583747113845492, 0.018949381417223968, 0.01169116178233536, 0.011474690068223286,
+            0.019548552856315238, 0.000875360627565287, -0.016635796623855011, -0.025556107843333752,
+            -0.020413268486518615, -0.02609228824535078, -0.010790291137667093, 0.023543107670268851,
+            0.021716113109859627, 0.013785197264197208, -0.026276039196095325, 8.5757711462404289e-05,
+            0.014948282143575591, 0.035001301210762135, 0.033243076852874712, 0.04804489164003567,
+            0.017633761179602039, -0.03383093041537804, -0.027559580729844144, -0.016312351988697616,
+            -0.036996805553155848, 0.0046008846261264731, -0.0052600274162138208, 0.051589766107954904,
+            0.067407427153027333, 0.11368910688695325, 0.035937052278612561, -0.055390966022558143,
+            -0.033019286406693292, -0.015100049463428439, -0.0045575246051971644, -0.0038205268347917634,
+            0.025114159655512332, 0.00409526606409856, -0.011870365504263465, -0.031082505901967785,
+            -0.0064514414337963301, 0.00077264307597883558, -0.0097324218228190332, -0.0095649157452586814,
+            -0.047871367672348279, -0.0052066811843209035, 0.058724710792006085, 0.061005136880172776,
+            0.035904071428423841, 0.032417401079271144, 0.018828808594144562, -0.052350083781954285,
+            -0.057134407219268185, -0.039137022307570227, -0.068511027712277475, -0.0045794672087742898,
+            0.067179049958084255, 0.088786817086448561, 0.064590658972600884, 0.075909860847983443,
+            0.03406818246575663, -0.079893380212960871, -0.078059400278230079, -0.050967081546010838,
+            -0.0075410715550127492, 0.00090611722246432844, -0.00088611310809465042, 0.010499239782610531,
+            0.013593992712278248, 0.022847692019645836, 0.0072465036549385752, -0.011235504761296439,
+            -0.0067712411197228114, -0.0031334880382484134, 0.035816532188915014, 0.0042595329238126877,
+            -0.046074123115365406, -0.045455501798507672, -0.025189102351296851, -0.020513538664314278,
+            -0.013184882425358188, 0.03853723508873947, 0.043216954550980388, 0.029920858724783488,
+            0.042454117560332544, 0.0048125209137350302, -0.05322454808219991, -0.054001167846780419,
+            -0.030944213693868884, -0.026744552996468829, -0.016214480369077269, 0.046088318866524848,
+            0.050920764687250375, 0.035050697477695181, 0.030205313660445578, 0.0012370084448065943,
+            -0.025026185913420734, -0.039547366435591924, -0.032072751961132448, -0.041503800995498059,
+            -0.016959052117511947, 0.036577532593293112, 0.033405307705215208, 0.021097181429122105,
+            0.04524600186763645, 0.0057097295011118033, -0.04009545402594572, -0.023543722791616185,
+            -0.0011751619389836487, -0.042740119259568485, -0.068209170149298476, -0.03408083184698818,
+            -0.0089812362410698135, -0.018447204868852703, -0.08080164490906433, 0.011216668623757288,
+            0.071923713252094373, 0.046693037902157189, 0.0062684873162544789, 0.08871492753817764,
+            0.018161312551641336, -0.030250326700698792, -0.00036919729259517111, 0.061824679040992689,
+            -0.10228668261622219, 0.01109468711226198, 0.071239718174917366, 0.056198902664861015,
+            0.035221490563295911, 0.12538936611045598, 0.078655683310248206, -0.0021602201211070714,
+            0.017143091521928486, 0.078613442093962912, -0.083199669931662737, -0.0062108323312786828,
+            0.11291646427520617, 0.048650202886604675, -0.052220520796790217, 0.051611577044313371,
+            0.024213945334981203, -0.00096206369167649644, -0.016925744683718883, 0.030723454541047034,
+            -0.08052326184947893, 0.00062422422359387263, 0.086516983616124934, 0.045938338129848891,
+            -0.016976595309093248, 0.071009004465574233, 0.038339829220227849, -0.0026387865792833858,
+            -0.0038413411066877696, 0.043933925498733553, -0.027759767340385537, 0.0047222409372223153,
+            0.035368698034920577, 0.017434659538565, -0.012702318095166355, 0.022964261038163798,
+            -0.019857814914531223, -0.026438435128081403, -0.0089979276669799151, 0.019967770041477578,
+            0.030867812708964097, -0.00086730212145271694, -0.013463088357282405, -0.015516131771675061,
+            -0.021434317992766096, -0.042427423781777641, -0.052192454580760578, -0.019182137764603632,
+            -0.013239122998671492, -0.02221396881438429, 0.087303629610803735, -0.0012836860817703188,
+            -0.068503849108162332, -0.047074973227660223, -0.017429074337911223, -0.096396410678046454,
+            -0.090672217913313535, -0.023913412125789707, -0.014875808627032878, -0.054261763029553697,
+            0.067369804962510133, -0.0073780580355572375, -0.048889281862640487, -0.037252585275347513,
+            -0.020435707782046775, -0.081145701421708308, -0.047418271690962709, 0.0040054290392228485,
+            -0.0097207623485931101, -0.051421472345577111, 0.055196095447833556, -0.012547525027973763,
+            -0.039092065962661571, -0.031812578450873111, -0.019505455722963534, -0.0710430357318734,
+            -0.0095543182459565529, 0.029720611563935496, -0.0037985707188624611, -0.051143480818139644,
+            -0.12053881871013886, -0.017640131187187061, 0.013041706141441678, -0.025959442958867384,
+            -0.0073316254368139336, 0.048217319682302535, -0.040634319287141736, -0.11887366159768409,
+            -0.054672877708913568, 0.052131329579770826, -0.15300134624366912, -0.035673043021346142,
+            0.022624632115893641, -0.041551376373806861, -0.041412198924657549, 0.055416565230293445,
+            -0.041928450043124406, -0.14571675686956848, -0.09152772643614146, 0.038714123108687687,
+            -0.10295600733403606, -0.030018463217250248, 0.017972906331299811, -0.031854434833466401,
+            -0.042403213477269511, 0.034670493597554024, -0.023845214156041038, -0.095712890003573844,
+            -0.071609934481398185, 0.013619566884757964, -0.073438224231885271, -0.040475996299337381,
+            0.021533188902812937, -0.035066297882313309, -0.076327821207739524, 0.01642538424594419,
+            -0.0031593049778048769, -0.060849833847041804, -0.082843406653407559, -0.029693823909577616,
+            -0.11564765100976541, -0.054630964250547843, 0.029746329499486759, -0.049322571996815459,
+            -0.098179454910759537, 0.029834312218578182, -0.011592633384882615, -0.099370250537442278,
+            -0.11528107807527614, -0.027930577909864945, -0.049738961343496195, -0.03102709459607168,
+            0.016235584509497657, -0.026089677865345696, -0.060429759967623453, 0.0095507327475527516,
+            0.00048506504587740064, -0.039806327673112207, -0.062129158459711731, -0.027580298287182062,
+            -0.061541464890811581, -0.035933066135734298, 0.018965404002195024, -0.030689845998144366,
+            -0.068831371405759706, 0.012887124640483413, -0.0011843526067046757, -0.050208249833177919,
+            -0.07277884763446206, -0.029046937100063917, -0.042513603050170032, -0.042482083125712236,
+            0.021172621294554647, -0.032635860243922045, -0.090235491783680732, 0.0012096059728201845,
+            0.012010677749557696, -0.027809508093361392, -0.079700039179439047, -0.056570551529427193,
+            -0.038060679956221907, -0.036357525431633168, 0.018189446915171679, -0.028132957275164884,
+            -0.076735429709856071, 0.0018125775183849505, 0.0095358699181623541, -0.025548788832628944,
+            -0.068561392067434113, -0.047182886142205581, 0.030099366111570519, -0.0098151787830306272,
+            0.0032426700363086822, -0.002725775871788128, -0.032542252690583223, -0.018234994501461179,
+            0.020477142027987248, 0.03521966107761982, -0.010041205983947026, -0.04241299294021298,
+            -3.7702385191662379e-05, -2.8380101999768863e-05, -0.00017261052574889645, -7.1805428107827611e-05,
+            -0.00016894885510614362, -0.00021556704995486824, -0.00021223382568080141, -0.00016613017683504049,
+            4.6335044580727843e-06, -3.2134003679728154e-06, -0.0010900187935419523, -0.00082050099443646421,
+            -0.004990366420399895, -0.0020759765123074055, -0.0048845033617082112, -0.0062322883426262831,
+            -0.0061359210416358258, -0.0048030121702933451, 0.00013395987849534413, -9.2903055720718283e-05,
+            0.0054320409868444958, 0.0040889157672619547, 0.024869181243104284, 0.010345500067881442,
+            0.024341619262326551, 0.031058222041266265, 0.030577981579475, 0.023935512969063537,
+            -0.00066758073795670884, 0.0004629766105575104, 0.013982948921396553, 0.010525528149729638,
+            0.064017280407393837, 0.026630984443201881, 0.062659250847611161, 0.079948868840310008,
+            0.078712652496678179, 0.061613867801145403, -0.0017184604060175705, 0.0011917764083344347,
+            0.0071045714455101579, 0.0053478967249215937, 0.032526425216760517, 0.013530889135372792,
+            0.031836426412729484, 0.04062107741769351, 0.039992970472240798, 0.031305279615062478,
+            -0.00087312946642823408, 0.00060552753840996138, 0.0070439583378934028, 0.0053022708005154399,
+            0.032248923930838794, 0.013415449485620092, 0.031564811895923237, 0.040274516086596865,
+            0.039651767875892835, 0.031038196611276297, -0.00086568030630395666, 0.00060036144132274765,
+            0.0053849894169944483, 0.0040534981578771541, 0.024653767916657139, 0.01025588881121816,
+            0.024130775603054027, 0.03078920011979475, 0.030313119432881386, 0.023728186944998533,
+            -0.00066179824813408273, 0.00045896637271443418, -0.0040882191707104594, -0.0030773670279044102,
+            -0.018716843956840791, -0.0077861473819011966, -0.018319794485237594, -0.023374790261118061,
+            -0.023013355532035429, -0.018014154020173936, 0.00050242926692220524, -0.00034844174767010986,
+            -0.00079422365733091739, -0.00059784409636410771, -0.0036361456273174418, -0.0015126249821622107,
+            -0.0035590103098821001, -0.0045410509161381545, -0.0044708345210693621, -0.0034996331390762122,
+            9.7607587377880075e-05, -6.7692231665074536e-05, 0.014808842837522448, 0.011147211723898437,
+            0.067798420044862487, 0.028203926471076151, 0.066360179339516143, 0.08467099753773534,
+            0.083361764868079558, 0.065253051413415142, -0.0018199601685076846, 0.0012621679180623753,
+            -0.0034475672870707317, -0.004385825763763361, -0.0034376391201550271, 0.0034404195119673805,
+            -0.0049543048626954668, -0.0089098843590917388, -0.0069512647051001002, 0.0032763528528720379,
+            0.0050808154534361365, 0.0044040161370627901, -0.0074283481069978407, 0.0031321110774905252,
+            -0.0058627146084097113, -0.0088107283746003458, -0.019368036836287839, -0.014916907888685205,
+            -0.0063116923527902795, 0.01190601131920095, 0.006807785866168997, -0.003446864364842493,
+            0.0087776457319258955, -0.036582251542073112, 0.0028920071385243698, 0.052809023508617201,
+            0.045604261004286724, 0.0064390230552033613, -0.015188860146036272, -0.026734357620457991,
+            0.0027739623330743754, 0.037879160355298522, 0.017316227158889523, -0.039129290228608761,
+            0.0097602191324184483, 0.061578577908659546, 0.067139355214696439, 0.023943732817161247,
+            -0.0072084384304041856, -0.040014142769914829, -0.0053978222200651727, 0.040758367566254464,
+            0.0010869008078449793, 0.013107343591488354, 0.0025227748899705363, -0.016202705841564517,
+            -0.0065388262749606907, 0.0067981442204157966, 0.010266872949239895, 0.0034833640190983098,
+            -0.005459359991744777, -0.013442904884451701, -0.012567290462396383, 0.050433383871530305,
+            -0.0043790460053422502, -0.073103569396036586, -0.063951033177415115, -0.0098800156544172641,
+            0.020408347440029933, 0.03752823275778569, -0.0033323753606947035, -0.052235564099797883,
+            -0.0066701615933328663, 0.018589224208714172, -0.003327988499140152, -0.028254460165281655,
+            -0.028291658325010318, -0.0080265343775238682, 0.0051988281221769812, 0.016767966126546501,
+            0.00092217748070524258, -0.019315669560029135, -0.0055737384504343842, -0.00064324661327174425,
+            -0.004766377943906672, -0.0027512496473281831, -0.012464314630735388, -0.012211113392247419,
+            -0.0067975681542043892, 0.0077804428766952271, 0.0060929668826588202, 0.00049128344487218891,
+            0.017591071248756151, -0.027587418231422276, 0.011407931032349418, 0.046872752255890333,
+            0.059801420901486289, 0.028462052930462944, 0.0010543992285801593, -0.035964134113569551,
+            -0.0094852518909841407, 0.028900196259564394, 0.016457428095078292, -0.031042159376250853,
+            0.010030542383578365, 0.050599112973401847, 0.059562848422162903, 0.024847514943846211,
+            -0.0026175106162121412, -0.035662026895607726, -0.0071523951131236534, 0.03241753471395234,
+            -0.070055538037907081, -0.021148207774317578, -0.036191751767961147, -0.072295369932607337,
+            -0.043179486340875678, 0.00802880903012302, 0.033734286857421629, 0.038411407769091001,
+            0.033328182293386806, 0.048196874928752131, -0.055143964225367312, -0.014018184020523291,
+            -0.017901615558123904, -0.052534099568153192, -0.042784545078036695, -0.0063161433318080469,
+            0.024064240105325135, 0.034098513335907105, 0.024366694673055522, 0.034499467115836388,
+            0.052633889309249955, 0.010558616177385703, 0.031344485799364954, 0.079326829347897559,
+            0.027466864530176632, -0.034058691257457238, -0.043508812054039857, -0.023728678295854386,
+            -0.021269124929076164, -0.023593050477150837, 0.06164458109866567, -0.0049663313698816245,
+            -0.056135623641547304, 0.033609292951368525, 0.11068156041864093, 0.091674441505974424,
+            -0.01366870791952395, -0.064921648022966461, -0.01258186766129819, -0.010034696560551087,
+            0.008274433763999986, -0.017441224659282967, -0.092327226020444339, -0.046180372288649671,
+            0.086332001053605598, 0.12902764461902133, 0.029664654409125982, -0.042086816452052554,
+            0.010239564585307843, 0.016799996111395869, -0.0033583852794553011, -0.0064036362395386032,
+            -0.041292618797181192, -0.036034570924863327, 0.031858606072308851, 0.063672400907503784,
+            0.022893614557510406, -0.015111918454807456, 0.0054381447798029191, 0.005428297860168122,
+            0.020087770452695258, 0.016637106195462773, 0.049184829825871371, 0.033326592458774076,
+            -0.019637377703351118, -0.045221737230947551, -0.016265921725440145, 0.0026140727728472084,
+            -0.017065837259304863, -0.028483112673590341, 0.049350046884060944, 0.020577182845030059,
+            0.052876633777918729, 0.066336189727933148, 0.0073990303233059888, -0.042396477063269176,
+            -0.03322651209094421, -0.01643092761016746, -0.027515618199524316, -0.040388430876371222,
+            0.06426013061001469, 0.012671126884962906, 0.012499681791610496, 0.063581574701297591,
+            0.05642407303068394, 0.011579959454048187, -0.030367652420344133, -0.04188400344066405,
+            -0.025795467187593093, -0.033999534660371519, -0.014654071890433971, -0.0075506769468283762,
+            -0.016117256092938403, -0.014973344081569057, -0.0021717896246692429, 0.0082366643655959974,
+            0.0063515016512302978, 0.005487080478777771, 0.0091905219862935296, 0.015063916308728777,
+            -0.011015586034304106, -0.0056133133688641224, 0.0048993617686465827, -0.0091792266688402215,
+            0.0066908850693216237, 0.029711557420184515, 0.018879716619347155, 0.0015556396189835239,
+            0.00068727808446961526, -0.00082622142112159314, -0.018167146570630063, 0.0049446212626956237,
+            0.020288355503420306, -0.00050692197364383463, -0.063675506463987994, -0.045848735354102589,
+            0.036906194356359778, -0.0030120703573553644, -0.037762664863558268, -0.012273375913481783,
+            0.029227688146475, 0.012840029092908739, -0.014764930299516268, 0.022239376264150196,
+            -0.0069490462098166974, -0.065117490855163385, -0.050927919486553563, -0.0033209935288242569,
+            0.0038012389991164998, 0.0037700269944836067, 0.054621870926410979, -0.0023918303487701761,
+            -0.050276218980131168, 0.014376144841728975, 0.12582534080284943, 0.054536973966946845,
+            -0.10589560925567794, 0.0041569216641357595, 0.079373105640393155, 0.027317805102745524,
+            0.046594823826334425, -0.013378871987430896, -0.052634393720679566, 0.00058208900090010859,
+            0.1669804271346006, 0.12224694673250053, -0.094939585360339779, 0.0079990396942585893,
+            0.09876196349914064, 0.032014020905757272, 0.02600511440845453, -0.012925325454414757,
+            -0.034067924107707821, -0.0052985992460800602, 0.12190754607207853, 0.10468157079891488,
+            -0.055204257117440404, 0.0066080534283371115, 0.070069379313506555, 0.022060790699193693,
+            0.018678054848167282, 0.0019402704671069079, -0.014821136807419734, 0.0077575119970114056,
+            0.028517012576480701, 0.00022861236088942208, -0.035090764694732574, 0.00033824939998599321,
+            0.0195879104706751, 0.0072224389255924806, 0.0029692317984224585, 0.0045405451178749685,
+            0.0012818111008918468, 0.0055932743150502355, -0.017729497054752488, -0.028227798991207361,
+            -0.0038591422575437514, -0.0016083104338194751, -0.0084767416313478502, -0.0021031379552305211,
+            0.0038118580760778346, 0.0046045114182702391, 0.00059292577701146407, 0.0059189622660340922,
+            -0.01631903900136147, -0.028060103430017184, -0.0054517708817989549, -0.0015837960256944073,
+            -0.0075285293203045641, -0.0017592068466396962, 0.009849956673083084, 0.0018414745161004903,
+            -0.0071126141814011144, 0.0049339653813188994, 0.01073412725887821, -0.0053442260825751816,
+            -0.018172870992141803, -0.0001429810782018953, 0.0080887634800857512, 0.0031801603472167445,
+            0.046207739914827677, -0.025123087782710194, -0.068769692932671156, -0.12249762004651008,
+            -0.12367035527735483, -0.058643658209880864, 0.01590837115878263, 0.036591421346414077,
+            0.018189081283691129, 0.0033103721469856942, 0.051602845042572405, -0.028434446065890691,
+            -0.057242133470329984, -0.10716164586041903, -0.13170741687267029, -0.040173267732534726,
+            0.07252389342034038, 0.081112277008311293, 0.030632355357819063, -0.00312371022778967,
+            0.025387132556721745, -0.014256622626752221, -0.014313810590642222, -0.031734338815691508,
+            -0.060262959844084661, -0.0018375470260013297, 0.074452277509225853, 0.068403722309868131,
+            0.022377222245623548, -0.0063662363632337963, 0.01119223404804465, -0.0066321338233192237,
+            0.011636493031599584, 0.013208028475084593, -0.020692362670663673, 0.022423111342693289,
+            0.08307334291706775, 0.067091695062841433, 0.019335278183391466, -0.0090657215185259033,
+            -0.01434480546994738, 0.0075310224654322553, 0.035224905747920698, 0.059057300253637139,
+            0.042935014308636887, 0.036168548123486841, 0.033913032418397202, 0.017197405811984021,
+            0.0016752276771586604, -0.0058669857382024869, 0.0020097729186392193, -0.0014055591495495544,
+            0.013193038307631171, 0.01919905991077972, -8.0726694776536365e-05, 0.018400532091615799,
+            0.04600636705692427, 0.034898731547725742, 0.0093309564380765798, -0.0055003225070617001,
+            0.019981155815642894, -0.011163472594863812, -0.014231157862779066, -0.029470763411115285,
+            -0.048401241616270997, -0.0052850609201138873, 0.050295505416134, 0.047734976117725765,
+            0.016047460711405094, -0.0039764163370708417, 0.02661575558173581, -0.01525980972930184,
+            0.0011973776029124104, -0.0087131470494203334, -0.057874711223567146, 0.019050332951931287,
+            0.12342527279901358, 0.1050620859498515, 0.032010454200391975, -0.012325538444086116,
+            0.0044034876846794071, -0.0024759556441731104, -0.0023227149438724316, -0.0052618533660363327,
+            -0.010400421838011032, -0.00011151524680246862, 0.013362183895926711, 0.012194285470064323,
+            0.0039658697175502626, -0.0011600700590174635, -0.0048896337798187209, 0.0033176466294819427,
+            -0.026822224203547428, -0.038714940195143106, 0.0019234506923182515, -0.037937776062089784,
+            -0.09715917909098562, -0.074049059303326836, -0.019917843630194165, 0.011542033138696834,
+            0.037371411249581307, -0.036065979981509053, -0.072867032948046959, -0.078937064349962532,
+            -0.031086053704463042, 0.039288046791492781, 0.074622007100296317, 0.041967581754553306,
+            0.036836995894648596, -0.0027949847243144161, 0.016992093371737137, -0.031891030815876721,
+            -0.047030296484087748, -0.045150750999294581, -0.0071866721036103537, 0.038865758113691154,
+            0.055804221112029713, 0.027410317237390926, 0.022275326030341283, -0.0027921031307226829,
+            -0.0026817800357434463, 0.043571902645450515, 0.041997322750939987, 0.030159648758702785,
+            -0.016148381160980652, -0.058378498611951227, -0.063222870683774052, -0.02504360826293333,
+            -0.017262482188310065, 0.0042249455328398373, -0.028827120377456418, 0.063045316337443591,
+            0.087809359998687053, 0.081942845504210896, 0.0081821241019393483, -0.078058108660215494,
+            -0.10729799435965165, -0.051308747940984882, -0.040979817334313696, 0.0056148739121742721,
+            -0.02815899693840769, -0.051935871727268455, -0.016069566519605782, 0.012195280950786362,
+            0.058900354798549069, 0.077643005323274047, 0.055475896209718149, 0.010906326495619397,
+            0.00046291012749272858, -0.0056622811737441761, 0.041766014857631935, -0.1714998083116003,
+            -0.19913443156009303, -0.16663047217040489, 0.024091635311724431, 0.22175783331506035,
+            0.26863747866004095, 0.11742904166924149, 0.087965621207652833, -0.016006037076102531,
+            0.088267611657346381, -0.14108926781962355, -0.22225958733831241, -0.21985476496942305,
+            -0.048351720617040517, 0.16858137768060191, 0.25518610493176508, 0.12917661352403154,
+            0.10694685071776654, -0.012091029876655071, 0.087463008647437057, -0.022447483577786254,
+            -0.11494863499728766, -0.14770978825457243, -0.10053894836491349, 0.0079528968216512341,
+            0.087157010896822873, 0.06491122257005448, 0.064110831218019054, -0.00045715116506661081,
+            0.056249423509572634, 0.011218072132319113, -0.050910219397782591, -0.079662322093837973,
+            -0.076163598586232381, -0.029663589190407808, 0.019829118746775592, 0.027954530435079439,
+            0.032080053780979459, 0.0022251274379808754, -0.012723875107603817, 0.010914880118995123,
+            0.023584915391520869, 0.026060215625369289, 0.011195817321318875, -0.011526620375921427,
+            -0.023479932627610639, -0.013555193192700628, -0.012055188754555232, 0.00081762127035177161,
+            -0.0073616286111097247, -0.013845148612891267, -0.039907376997012939, -0.029337246173900523,
+            -0.037755853103329892, -0.036883558800106526, -0.0039725573488346485, 0.02228108337233644,
+            0.037247304812534479, 0.014042164133374418, 0.0017220073522294032, -0.025923568128795649,
+            -0.11003788015638283, -0.057984060261502636, 0.050441027068130723, 0.029448479736673937,
+            -0.033396701230672718, -0.049664448952837226, 0.029234292453674936, 0.074902008604753323,
+            0.0071394348896282531, -0.020246566290932688, -0.099138077030299934, -0.046427104778224391,
+            0.084662920672071984, 0.059812282100924555, -0.035783827912951635, -0.072938321950469648,
+            0.0076947278085599743, 0.07666455996330386, 0.0048566686490648901, 0.00055560193494824401,
+            -0.0087870463843355371, 0.00027916188848571555, 0.037148475994702737, 0.030457798829168319,
+            -0.0074766058457621399, -0.027775716616150262, -0.013410464620344766, 0.013735604631586231,
+            0.022335859879024752, 0.033342942054994128, 0.085615210274347459, 0.069745044919149402,
+            0.12691747994458841, 0.11809428638856313, 0.0018543574962587728, -0.080810367065144065,
+            -0.10173712409712934, -0.019374792560930797, 0.035767036409225135, 0.044171409470587647,
+            0.09935030042587889, 0.091179117044655061, 0.21639407375412556, 0.19569157038990256,
+            -0.007885012199174958, -0.14346054266798267, -0.15091499661058178, -0.0063014355707031698,
+            0.033012734322448112, 0.031425822411920885, 0.05345042083696229, 0.063379706289439716,
+            0.21306265357826387, 0.18729336799205748, -0.018276470730866853, -0.14665651621034134,
+            -0.12713460179833128, 0.019236257683738371, 0.016206983511374919, 0.014698300034529703,
+            0.023253850821289227, 0.029492661420459469, 0.10564015645841603, 0.092469093546918568,
+            -0.0098313039189787052, -0.073110442974495843, -0.061464940482134356, 0.011399861017188092,
+            0.011352892258614421, 0.0064710994852035719, 0.00063199548893102392, 0.012154028222205075,
+            0.079457838914371692, 0.067504928988151899, -0.011389027508050464, -0.057043898127408045,
+            -0.038078601425161757, 0.018240655971950889, -0.0046717501438437673, -0.013920538780168693,
+            -0.046342340368091289, -0.030034538723198168, -0.016634440655265183, -0.019740899576508764,
+            -0.0085644444229942326, 0.0063134456157844607, 0.030318405508575695, 0.022676824912033055,
+            -0.010943374488245122, -0.014351538985740812, -0.045988172791467441, -0.023140510846703974,
+            0.072965234043963448, 0.074408432620037934, -0.017377311115968224, -0.069032575680011019,
+            -0.046269726886432952, 0.0074389742694686498, -0.012080691141867172, 0.0036357125260951125,
+            -0.040178897990614706, -0.0066164159302503486, 0.11217809704675648, 0.090203994011484004,
+            -0.03867748172538249, -0.1106388950782925, -0.063427910039711793, 0.013650626383383635,
+            -0.0090609120348849135, 0.021902227304211083, -0.019711729664708716, 0.013671619446443087,
+            0.11527426595040956, 0.075592820600611718, -0.048199877515726117, -0.11687832882900888,
+            -0.059730105746586701, 0.015592230346341718, -0.010447135463216912, 0.017905584620806644,
+            -0.026721507579438766, 0.0086231452077957342, 0.12097915887346405, 0.084116526446054024,
+            -0.048220679277100879, -0.12177164029892792, -0.064209913261432994, 0.015926242879585974,
+            -0.010521079943282196, 0.0072585150115139635, -0.032767308079926602, -0.0017855604679144019,
+            0.10434085932429867, 0.080252499728280177, -0.037779649124920905, -0.10358905713396745,
+            -0.057833824468772048, 0.013030885417095918, -0.0091693625833391759, -0.0052802157987603751,
+            -0.034866607640796007, -0.012834778628821996, 0.07208925271123677, 0.065137965378075646,
+            -0.021310464122600126, -0.069764403904915007, -0.043045218004934514, 0.008116231267833866,
+            -0.014407611912364849, -0.0087425728908937204, -0.055027498022495361, -0.020600302342508883,
+            0.11254817286758347, 0.10216525216915302, -0.033038407669950497, -0.10883104602549473,
+            -0.067353284210946704, 0.012628356701532829, -0.0076754998588655868, 0.0010577328121967806,
+            -0.026208485384131553, -0.0054206436925681722, 0.069239282277876971, 0.056793041030526917,
+            -0.02332062443860395, -0.068081203872400589, -0.039505185862971338, 0.0083233364386561034,
+            -0.0054736010147811353, 0.00033347672606994384, -0.018918719882710284, -0.0042745474658011443,
+            0.048693023642422423, 0.04032643033371449, -0.016209397668567861, -0.04780662926874827,
+            -0.027905389012046151, 0.0058180958528688247, 0.0036582157119548469, -0.00071530669333511553,
+            0.01237641297782212, 0.0023783088066128668, -0.033343013469503614, -0.027155509975684538,
+            0.011326178264796309, 0.032821442375105599, 0.018962432993302303, -0.0040259432648935521,
+            3.5148690352596796,
+            0.0053602835470229282, -0.010719485449640038, -0.015888313757071504, 0.009581755061839484,
+            0.024677682541495775, -0.0030596562768587291, -0.013652022202448672, -0.0025049871996348457,
+            0.0070489401877839595, 0.0074442196202973848, 0.01131979454832209, 0.020436266818675431,
+            0.012192523473189035, -0.020886175238591525, -0.037166426016571288, 0.0004352055658099342,
+            0.011905076235908795, -0.0083263825923295468, -0.019687621612932298, -0.014854330558211117,
+            -0.0063440396218017708, 0.017862014356001679, 0.014590069280515712, -0.033836343524202235,
+            -0.060670711377165135, 0.003718043223415889, 0.025230469326475977, -0.0063080604908763212,
+            -0.024675842061499677, -0.02120050143171676, 0.019373316668866606, 0.052116425039030856,
+            0.048117095839455372, -0.035754539180383668, -0.079818067291248254, 0.0041709529503813477,
+            0.032692311213774153, -0.0071597978576747132, -0.036106331421609371, -0.029469112539152305,
+            0.02970848385636745, 0.034224699424754486, 0.032239199702914903, 0.0014164851130154586,
+            -0.012776154802743656, -0.00039402645803929325, 0.0039144730941888233, -0.0013534990681538812,
+            -0.0099341272008703491, -0.0064876476766596771, 0.016871867650873763, 0.04324427726290947,
+            0.047513663999799532, -0.014836369257527496, -0.048230867972842893, 0.0038835074044617428,
+            0.023051255814625755, 0.0011493695927015969, -0.01983417526972843, -0.017064771310738976,
+            0.033470933164668051, 0.075493325020749791, 0.077164493889606944, -0.030740195847929072,
+            -0.087495791376819856, 0.0055915184950278956, 0.038643509465323744, -0.0026449545909216915,
+            -0.038809553482880642, -0.03207466254577411, 0.0045112784803423428, 0.019554888010826752,
+            0.030770913232860728, 0.005720714161609782, -0.0090057013234612834, 0.0030398332818115828,
+            0.0095997280375143389, 0.0085311240974505764, 0.00029589281734210022, -0.0016375007723945609,
+            -0.051010438442494983, -0.028084024537320416, -0.010178053920949785, -0.008953827002367111,
+            -0.014761929060631706, 0.0065379442575702971, 0.016874636141130751, 0.011714267400472276,
+            0.0082265707146962335, 0.0006660230310368007, -0.06244411293709768, -0.056100978373343866,
+            -0.049482660611535834, -0.015450608143492257, -0.0028455189728786691, 0.0034739109762703222,
+            0.0061188101607893642, 0.0030704876539261071, 0.010004412400106941, 0.003708693498989482,
+            -0.029113040006821612, -0.024244732063342149, -0.0041956148408621545, 0.044010453099771772,
+            0.059040730267327646, 0.016943820678147876, 0.00056546827134646999, -0.011116379070123883,
+            -0.00020269995012398012, -0.0076460470893527522, 0.0075078213276293469, 0.005191132459117123,
+            0.010759392184396727, 0.0052320813791461107, 0.0012633404975319141, 0.0082649385028562596,
+            -0.0039084163598403793, -0.0096923145698363002, -0.0087483024635220154, -0.0064158317630842593,
+            0.058081924100239178, 0.044061042226168599, 0.047658902440124148, -0.020484297197601302,
+            -0.050846590714690769, 0.017489948507396009, -0.016403547108270144, -0.028809725838196083,
+            -0.035324288241519924, -0.018797984071616605, 0.033259457763002709, 0.024564099008064735,
+            0.033369525899139191, -0.0013145570240407781, -0.018759119006543284, 0.017951294186912329,
+            -0.011756535599561566, -0.024385957061009648, -0.025755597491903769, -0.016032759946993342,
+            -0.0063132158019011848, -0.0059027485936173577, 0.0049741249594992178, 0.019625588492968107,
+            0.022828596239995773, 0.011356190077477546, -0.0021650668838482301, -0.01004663373888161,
+            -0.0053947870850087161, -0.0067578180330632219, 0.013237721445657036, 0.009453694929415923,
+            0.016228403460424919, 0.0045261006596793675, -0.0024452893601014571, 0.010992201785195228,
+            -0.0058250118251941645, -0.013530315396900899, -0.01293095130336922, -0.0089353830833419322,
+            0.01418627091725528, 0.010821715811048328, 0.011093458336694317, -0.0059405165720364328,
+            -0.013351144300473903, 0.003557660579831895, -0.0037938117944039287, -0.0063267336852768016,
+            -0.008130343923557333, -0.004117204413794387, -0.037158364415151059, -0.026834054745924429,
+            -0.042840517936233224, -0.0080567078620501498, 0.011486053681831067, -0.027313554383014187,
+            0.015296137976091646, 0.03445920007237506, 0.03383033703845318, 0.022730506047757969,
+            -0.02907123693586201, -0.021092104538867569, -0.032621236430344064, -0.0047688698972083079,
+            0.01051204119060218, -0.020199920411247834, 0.011618925203130612, 0.025797371724364391,
+            0.025653163616792034, 0.017007305513191743, 0.0064160000701365318, 0.005318311604356969,
+            0.0011507869341451683, -0.0093116351028321581, -0.012626208078076035, -0.0034388683155916243,
+            -0.00021254572602548948, 0.0021563658642401737, -0.00016098571385678682, 0.0014890464704466855,
+            -0.069611237614211036, 0.11050726752196008, 0.10975790118918166, 0.13337889120880389,
+            0.12124418952078198, 0.15338305898594259, 0.06200624421392785, -0.051019293367251271,
+            -0.15335130749024403, -0.1459922790529653, -0.013714741447346463, 0.063656046858856258,
+            0.049999950174083659, 0.061234917514047436, 0.031569239741138393, 0.027474806410749557,
+            0.012178095814988958, -0.01498725248765468, -0.07511961584251925, -0.076871792230937569,
+            -0.026494080676406462, 0.045002460872696881, 0.044446901686601682, 0.060822115271341293,
+            0.041076718783804263, 0.05052620924456741, 0.0067285390770883153, -0.03432381321975328,
+            -0.072787525074627768, -0.07394238940636734, -0.055792982059402661, -0.0042865187578978396,
+            0.024640343683758874, 0.024689643198733568, 0.083623356611294497, 0.13376893760146302,
+            0.060241501436655243, -0.02092258874409797, -0.01636645244572725, -0.0010561086556614141,
+            -0.024587464401986035, -0.071260982307205456, -0.036036045535300487, -0.045861964723445996,
+            0.023275862408072903, 0.062331971725192392, 0.024046253168181354, -0.0032597464215704244,
+            0.065452294158078086, 0.076935621997401504, -0.038801144902585676, -0.080175460957037537,
+            -0.033236689761067924, -0.025705750970527453, 0.028096498826510712, 0.076374958116993782,
+            -0.0058579258240180065, -0.046730348822664421, 0.039442269101103572, 0.0454144944701328,
+            -0.010787910997651851, -0.03847102540943511, -0.019214934489933309, -0.0095960939508072298,
+            -0.0033124191211084258, 0.01115709641179026, -0.026145146011663553, -0.032258693887221468,
+            0.011929382731577145, 0.0094013359158960693, 0.0036014985504906382, -0.010293392732315354,
+            -0.0097249091599325432, -0.021313249981474533, 0.00070413477661164297, 0.0030371959644542985,
+            0.020303768900037426, 0.023468120138432979, 0.028540713764701183, 0.033708881229338655,
+            -0.0080030212247449439, -0.0047231963002316059, -0.0006440350256572136, -0.015507982868207672,
+            0.022767153995535395, 0.035195211216500398, 0.043308442988765974, 0.027400871176601539,
+            0.025208563713298202, 0.035385152059687841, 0.011628078617650826, -0.015543623339032257,
+            -0.018127021800111748, -0.039643078418445457, -0.0051113824421886748, -0.0058672852661709775,
+            0.033570072239079485, 0.04609495412412614, 0.051830647655135079, 0.060094336327440219,
+            0.0036308826495820897, 0.032154238267711702, 0.057015182845275771, 0.03746696661154076,
+            0.025798994958495303, 0.056190099587934771, 0.037139318546231773, 0.013243758405999657,
+            0.00068244803216304089, -0.027480690427808787, 0.0029715308831816953, 0.011185666417760009,
+            0.012698258560533231, 0.0044423904269657085, 0.0042109757105333713, 0.013914906669450408,
+            0.011477062767652785, 0.00015913041883487732, -0.0058182100230761502, -0.010368454962131847,
+            0.0023340516184093452, 0.0059532463401808667, 0.0036150153011718957, -0.0014200681890708198,
+            0.00014276163419239796, 0.0049248868448307044, 0.0054728062270224054, -0.001874605070890794,
+            -0.0057639816494912859, -0.005874485654571349, 0.0030714565125870715, 0.013929505049271271,
+            0.018440342855502844, 0.008695190446735987, 0.0069978203114266467, 0.019401831300600521,
+            0.014823568146854375, 0.0018357878854448964, -0.0050159373362926897, -0.012614132164832995,
+            -0.0026121713175711056, 0.0018772490730129109, 0.01512481255195584, 0.016389611201183693,
+            0.0093811679791916992, 0.012590974796746576, 0.0045533131920607864, 0.0081261035721778563,
+            0.010050155258402473, -0.0002677279079258835, -0.0031064918757069035, -0.006576271517389317,
+            -0.0017872201996004778, 0.0042247856734419983, 0.0013150771197250313, -0.003699044860027046,
+            -0.005599503520828315, 0.0034459319566892987, 0.008239334835068687, 0.0067392526518122416,
+            0.00029821552140309898, -0.004221913839402896, -0.010723100930079443, -0.0088166178915245856,
+            -0.005548374089211737, -0.0099326898355955075, -0.0055309232000732376, -0.0037565929530128284,
+            -0.0028364725545614194, 0.0032414816544959432, -0.00024526334402754464, -0.011694796584805073,
+            -0.025228437181099093, -0.019034704323997814, -0.01238179892767915, -0.023981905345539439,
+            -0.014416036547514912, -0.0076165641871575544, -0.0040597339439441766, 0.0094860349306918092,
+            0.00018957170627296441, -0.0057430020553358493, -0.01368389947808878, -0.010906443475440187,
+            -0.0069448233896117666, -0.012798903299757317, -0.0073411399141688153, -0.0045474365392808224,
+            -0.0030924830374489997, 0.0045116090494524055, -0.0018397492417556349, 0.006329080552594674,
+            0.021892125794142177, 0.020220637310202787, 0.012201011471690362, 0.019481444322639634,
+            0.0094675619777871804, 0.0092575028956850165, 0.0091886174629237163, -0.0042001524628930663,
+            0.0053411639244986785, 0.008055984456092638, 0.012863919651856293, 0.014965312935716887,
+            0.004289214987338163, -0.0045541552746725771, 0.0080037682058053342, -0.01810702963897428,
+            -0.012997683197023708, 0.0067790530610581014, 0.00084963166873526356, -0.010153326485210383,
+            -0.01982975992603133, -0.025827184124715293, -0.0040699990052461771, 0.015444181584247972,
+            -0.026084811204287857, -0.0247557302294002, -0.0055776894938577553, -0.027120730326838465,
+            0.0027271861473698914, -0.0087889896463109671, -0.018115343172176789, -0.024186685693727387,
+            -0.0031721416460476961, 0.015918364634754198, -0.026782413496960776, -0.033928303310619898,
+            -0.010597193632030971, -0.028356798064505667, -0.0012725685391937352, -0.011443454989593265,
+            -0.021285496757174859, -0.027059843439560909, -0.004980124048572579, 0.014551914690142722,
+            -0.024693440474201866, -0.013905914618320667, 0.00017320728133045664, -0.025102197189398632,
+            -0.023634899462390835, -0.024681254453686415, -0.035942646614070227, -0.039168830709834221,
+            -0.014422164794102811, 0.0046454128762425436, -0.0091786573272769467, 0.10110462271483542,
+            0.060881823221130234, -0.0029525561676884832, -0.0026514592116876649, -0.010905181813011727,
+            -0.019597904392326702, -0.024465094181903773, -0.0049993901701265763, 0.012025780562940042,
+            -0.020496033575661113, -0.0042229197672459902, 0.0043323781018204223, -0.020396041984836813,
+            0.012125786810247396, 0.001900711161663177, -0.0021484829622912798, -0.0064523973495512945,
+            0.0029265965370565902, 0.012833832933312982, -0.02103897477016441, -0.0724594001698569,
+            -0.034538722302224739, -0.025024854343942679, 0.0080916904059563401, 0.0093304474503297149,
+            0.013989936002642905, 0.015582024043805714, 0.005303545706368382, -0.0028354593719240265,
+            0.0052490946190396331, -0.032929885402469154, -0.020573327415185801, 0.0031822824771877345,
+            0.0031864185032614402, -0.0032621875124442651, -0.0077610437455179664, -0.010974937298185664,
+            -0.00079428838238889722, 0.0086913960627542104, -0.014528460795656227, -0.026237156575982974,
+            -0.010230804554728391, -0.015852564664172463, 0.012945319035085385, 0.014683470463833313,
+            0.02191537703345087, 0.024327532353791675, 0.0083835052373950128, -0.0041917358625131835,
+            0.0078147210251000455, -0.053148288802355795, -0.03298859287142078, 0.0044902537274188652,
+            -0.0010988223060913768, 0.0013120662186559477, -0.0048133865538825225, -0.0053970185806983401,
+            -0.001807557675061639, -0.0082286312932859564, -0.0035123438510016934, 0.013777196460681842,
+            0.010079515384683806, -0.0018880615856278595, 0.00053029778347223045, -0.013406216125814316,
+            -0.0082987184872585825, 0.018232128721515518, 0.052220855313764913, 0.032426385965723468,
+            -0.017066382980183783, 0.00047349753680224916, 0.017181452288235186, -0.0039333376689108072,
+            -0.0030859927587891583, -0.0080620618589184283, -0.02328661621577776, -0.00078515383353979992,
+            0.042147208883875999, 0.0030596358501219952, -0.027118596473458198, 0.045242931062346586,
+            0.048582783576770178, -0.0097578978532975903, -0.0021041347827921242, -0.035059128041008705,
+            -0.040460682175455509, 0.035633297459930602, 0.1475795993574526, 0.067943543720296179,
+            -0.061912338156855699, 0.047332530765202899, 0.08414889530943491, -0.017865551428684456,
+            -0.012164755228930717, -0.0025541496501037455, -0.067490650011500758, -0.038852280182126386,
+            0.048650685835599485, -0.053047463410397219, -0.063971423663729071, 0.16204741837261877,
+            0.14106657676168946, -0.027380154700380785, -0.006460741732085119, -0.010326157961213875,
+            -0.043303417766025795, -0.00966041228659658, 0.061897222455738241, -0.008191468558325872,
+            -0.047150372223733951, 0.091065547016518852, 0.090402296941460611, -0.017943682779516641,
+            0.0072173358964000194, -0.045488650083862374, 0.00095485422172701326, 0.080559426811818019,
+            0.1600955886753824, 0.13618672907157914, -0.031087061667655302, -0.069932295775335176,
+            -0.0025668949705226762, -0.0015830013220084205, 0.0059049294081593325, -0.039311897067622781,
+            -0.00096087412503585712, 0.068473548350644828, 0.13940550647658467, 0.11608944791248849,
+            -0.02851129134017983, -0.05604757186971572, 0.0015156875333888833, -0.002089713431553555,
+            0.0016876752796289949, -0.011788793039126055, -0.00073460461682738152, 0.020247038076564652,
+            0.042066872516382359, 0.034411549155315843, -0.0089612289786781384, -0.015710394514492583,
+            0.0013879071755255826, -0.00080705202208643505, 0.00062242346225212534, 0.0039925616907629195,
+            0.006664666775492413, -0.0027370009516452893, -0.018014320821794709, -0.0058891022877406137,
+            0.0089456351555813936, -0.010444788372394636, -0.013883330228800648, 0.0028656631202397123,
+            0.011156405619453753, 0.049427489069036788, -0.012746855186478223, -0.1140678353566446,
+            -0.12777550920186259, -0.013478596360959992, 0.072469964674354792, 0.028678322053598378,
+            -0.0032368434370693929, 0.035793692327502569, 0.0013355918889914331, -0.018180287541245354,
+            -0.0064410607529415981, 0.040639769488901835, 0.05192046355908491, -0.0098213232879555325,
+            -0.032002351215852293, 0.0031341718578625239, 0.0093970451413322061, -0.021538438757238782,
+            0.016924772314535787, -0.077243228263514763, -0.050386648349444577, 0.16994488011588144,
+            0.23077777154564705, -0.072296886247440476, -0.14702844988022074, 0.041617109566577479,
+            0.056899742544147508, -0.10882953077557252, 0.032627956072902732, -0.062090815249341895,
+            -0.079428118380996018, 0.1320037051734817, 0.20272335793958215, -0.10980410494458354,
+            -0.13688644207209641, 0.081307877474941226, 0.074440072581747951, -0.11676510947719579,
+            0.086877126075980665, 0.019025932808888139, -0.17388838273417984, -0.063894130665139881,
+            0.025553542555041071, -0.22957950952405262, -0.053283169843333207, 0.21878306102300407,
+            0.12335407593328646, -0.1133488710815147, 0.037877021699323957, -0.019436551864601598,
+            -0.081468809572894582, 0.03462667472179997, 0.08849479119812742, -0.10953845375800289,
+            -0.07004319718760138, 0.09504171505838406, 0.065040490333103579, -0.079136090053343308,
+            -0.042359759593241557, -0.10148704124891667, 0.065977166790922456, 0.23891782232399503,
+            0.24475028344094921, 0.08053164607016236, -0.12967688455062784, -0.10781914535380183,
+            -0.022704230917348321, -0.043547953951763266, -0.052798347661392075, -0.11198326181445736,
+            0.085195861626867708, 0.26509375151571429, 0.26458128084778348, 0.10531999030119096,
+            -0.13713404036593779, -0.1342085811034151, -0.03419198908109243, -0.038726935202520088,
+            -0.0022684223160395912, -0.027999683915469902, -0.0010693043161997809, 0.06363662473088072,
+            0.076048854834663629, -0.0033731417542136439, -0.045035365377133041, -0.0060539012551222675,
+            0.0079464077709404651, -0.026513173624102881, 0.025839622850255199, 0.017354902613116261,
+            -0.049333541303083879, -0.045356917561976434, -0.025024481655916163, -0.064299458214188226,
+            0.003895837771543658, 0.065217192897360818, 0.031939792199900258, -0.021179240427405668,
+            0.081415949647088245, 0.0039948534199792454, 0.044463892310482298, -0.031473666052980832,
+            -0.045547861728793083, 0.038316628690729465, -0.049728944716911874, -0.057048560414648605,
+            0.036022685952171909, 0.074990344402763934, 0.01774882439442943, -0.029559601304579096,
+            -0.018682090323163439, 0.084956475986629199, 0.12687575381181823, 0.0082704916937407242,
+            -0.0422538328058224, -0.027700280849739325, 0.0001475950807440559, 0.023344716364668908,
+            0.033578487078765505, -0.044607730122236434, -0.024793079548098479, 0.12658531530519673,
+            0.18916311104972799, 0.015677418684855553, -0.068258305149940843, -0.046729769834431265,
+            0.0031444004063008544, 0.041563556645061506, -0.007776084160015238, -0.019695162641524433,
+            -0.022255998199338243, 0.061280956118505259, 0.091177829358471837, -0.0037120695036796623,
+            -0.015187447017791837, -0.0042387507157124905, -0.0083310182961039893, -0.0027217166723122162,
+            -0.10341250189958888, 0.0017421139994282311, -0.050120998175745612, 0.01941033665823105,
+            0.027210057682104813, -0.048650320336810729, 0.070200778666621513, 0.075880622024562458,
+            -0.044029139687032558, -0.096818081491459304, -0.05296805778950428, -0.015054105825067277,
+            -0.040541504144078491, 0.058057078604271672, 0.085626795916297238, -0.024962062200371084,
+            0.019495760908629541, 0.030867636973207106, -0.026589651231926234, -0.045923927125637698,
+            0.00076139228819621381, -0.03016190990600888, -0.027743876760175989, 0.090825803144086087,
+            0.13533983651296275, 0.00027635747418369727, -0.031639210670156855, -0.015681126775021734,
+            -0.0073099884026143784, 0.0076448240375780498, 0.004169579525569872, -0.020715402632808654,
+            -0.017229973659466654, 0.061509943263626563, 0.091716618372890149, 0.001905534290806089,
+            -0.024142107501252303, -0.013414879019740337, -0.0034523876893886606, 0.0086505019864944153,
+            0.017171586520472442, -0.012615319612881442, -0.0031710142895580821, 0.033968246457128752,
+            0.050895542437861999, 0.0080448990346595837, -0.024380746515236446, -0.018782538663377736,
+            0.0041898906747054945, 0.018910634286053163, 0.054104896583670667, -0.00072124784033183792,
+            0.026400422716925418, -0.010729331859826946, -0.015091317746652315, 0.025454117231718705,
+            -0.036532333506536049, -0.03960494574534152, 0.023083988251465789, 0.050610993813587496,
+            0.026728042058272131, -0.0022207826898021986, -0.01677357734992703, -0.018906501720412867,
+            -0.018263242598685697, -0.0079838471292317196, 0.0065097413778142828, -0.012942867421031852,
+            -0.021451466510596928, -0.0013259286698444383, 0.0089177509723993385, 0.0079162321500909696,
+            0.030999901495035169, 0.012766710814187414, 0.0084915958521069711, 0.00092969859997284751,
+            -0.017027837393581578, -0.00172189148976488, 0.015004764114609563, 0.0043196587267225681,
+            0.00086071049997525368, 0.011782621317284104, 0.049570595770134403, 0.025509973798805253,
+            0.019382972457454788, 0.0046634027273665321, -0.026080307430401201, 0.0031385025277290415,
+            0.029655232723767768, 0.0064778935731575815, -0.0055484777831539085, -0.0091247558676993828,
+            -0.037039693835111256, -0.017195999771328831, -0.01235822438368973, -0.0023215640079820563,
+            0.019907825293778977, -0.00018815458525092428, -0.020085998086627501, -0.0049975835588707256,
+            -0.01068129818102243, -0.022534598929998595, -0.092308506972580306, -0.044051472932129854,
+            -0.032161525153301923, -0.0065316379407330226, 0.049343698568651929, -0.0018524147061870307,
+            -0.051386803852650521, -0.012353883099964005, 0.00078556440183299601, -0.0070363732395192615,
+            -0.02996179024774891, -0.015915459381117363, -0.012281245124776772, -0.0031282702196869178,
+            0.015651740971580265, -0.0024711788292331805, -0.018476170154793112, -0.0038735570192681328,
+            -0.0089829132242533055, -0.016283177997507354, -0.066351314480567941, -0.031167856859857387,
+            -0.022552290571553682, -0.0043854955276983361, 0.035580070018858372, -0.00075759453374798743,
+            -0.036385309172449129, -0.0089218011790405671, 0.014882069304966428, -0.0077343098639396299,
+            -0.03680742336406919, -0.024843964703536933, -0.02111596012992566, -0.0071425243977514281,
+            0.018035299238991723, -0.009155355847662602, -0.02857811740136847, -0.0043125024185932765,
+            0.056476638009671475, 0.0067525314748546105, 0.012938758298531028, -0.014732146990372836,
+            -0.019308501741771573, -0.012119250000674221, -0.011627561180997226, -0.02391580889348947,
+            -0.016028345838204817, 0.0034938752826166809, 0.058427744985456331, 0.011705236819715165,
+            0.033336082749269094, -0.0048425564431802005, -0.012024568885248107, -0.010578961780864832,
+            -0.022495934300346576, -0.023326580920671566, -0.0045005771928086271, 0.006210587510414891,
+            0.023195430073596531, 0.0086618319770573847, 0.013629431172933913, 0.0097368895289573383,
+            -0.0097044698795431244, -0.051941005041144434, -0.039320638873836994, -0.017937884023390659,
+            0.019102043329517447, 0.036200364062363773, 0.031234172246703079, 0.0041685405184751318,
+            0.0092905158577006892, 0.016507881153842708, -0.010065389208313848, -0.049062825880618451,
+            -0.025540258911290293, -0.0099291671230797417, 0.034436379929934466, 0.054790354624029751,
+            0.019861156246472, -0.01042772878738267, -0.0099054344546179868, 0.016423632099450067,
+            -0.001161599358145503, 0.0052341966716288393, 0.031583191745805643, 0.018508230936325962,
+            0.037102896602283816, 0.045386588635332778, -0.0053396232885653903, -0.038586101298201336,
+            -0.047380969471036101, 0.014340647286904923, 0.016891554130971653, 0.11389070026018201,
+            0.14285774354868924, 0.073578810012698892, 0.038146253279491671, 0.021174837681927693,
+            -0.00029599347605102633, -0.02166442222426217, -0.026234674837443926, 0.009643111150701893,
+            0.0087575959957793201, 0.060704948315182444, 0.079317647049938753, 0.04113677830216584,
+            0.024815711253786475, 0.016919297376925428, -0.0015498586296096104, 0.010386574198818974,
+            0.012347474930427642, -0.0056196458918671369, -0.0037439146159210894, -0.027075299480093754,
+            -0.037469523173027604, -0.019612927613230049, -0.01402511471050254, -0.011261356849020836,
+            -0.0044371222262817485, 0.0045661576641644009, 0.0049171258990938277, -0.0046826610131321051,
+            -0.00063636856761024613, -0.0073996014596231221, -0.015234201747153606, -0.0083796563096758658,
+            -0.010889332970996278, -0.011943240629411763, 0.0064670577177917341, 0.012646201069918452,
+            0.016170525389990982, -0.0019216625784603016, -0.0068039577528314328, -0.042982387782250782,
+            -0.048375273098578683, -0.024419398949609775, -0.0065694584656905619, 0.0018423860255428583,
+            0.0012614769897641414, 0.025059117256616147, 0.030470574636865286, -0.010612782522193418,
+            -0.010376913787948834, -0.071319107242282964, -0.092049290733452832, -0.047642052547226803,
+            -0.027548249316626017, -0.01785926815894523, 0.00069482927657403689, 0.0079608898645153019,
+            0.0097200433749304021, -0.0031983036105504648, -0.0033756301662236986, -0.023009572875803526,
+            -0.029339571673841568, -0.01515413116837901, -0.0083817895958629828, -0.0051260952488309062,
+            0.0043070135568242622, -0.002105195345072702, 0.02564101097415003, 0.02863719003474182,
+            -0.011382909225847724, -0.05900717178662522, -0.051634410693810327, -0.041585583704153981,
+            -0.015652178656517069, 0.0099665665163505071, 0.015657372408127489, 0.029060663657342268,
+            0.038028733550466418, 0.017197809302582218, -0.01251426589391191, -0.023488042990115549,
+            -0.013048551227471349, -0.037430694331131692, -0.0023516532718830278, 0.073034564684516592,
+            0.020203536769871883, 0.05109723018775484, 0.028630201867537362, -0.0099992001339075896,
+            -0.0054557965085538151, 0.040446410304139313, 0.047856258698042435, -0.006167353333119208,
+            0.017170427814318032, 0.10787211701436986, 0.019591806344144279, 0.056430746475921938,
+            0.017420980851822209, -0.025984111777293432, 0.00011932971958450542, 0.075021897726506831,
+            0.079140763451357732, 0.015336992065833679, 0.026873774354707905, 0.11150329584543428,
+            0.014693266424632433, 0.046289419452280746, 0.0071008140646221492, -0.028880353451638877,
+            0.0032093857323150675, 0.076910000644606485, 0.078230513368715407, 0.023796082393737386,
+            0.026050234432709561, 0.087601816768668156, 0.01454747702132138, 0.039798145383490531,
+            0.016097054546342575, -0.014315084763290027, -0.0015651182510545464, 0.044762417373895518,
+            0.048758207622398797, 0.0048717281561563982, 0.016829477621123995, 0.080685980449238942,
+            0.015383358003223171, 0.027537383132392498, 0.038888404636737532, 0.019298800474821416,
+            -0.013093067932443333, -0.02835648016094517, -0.01764744730132067, -0.039919367948621984,
+            -0.0038181322935732726, 0.070739246835475555, 0.0078078582647654301, 0.0054640224096869205,
+            0.032533280257927191, 0.029945994249394557, -0.013338498883180498, -0.058683751030117151,
+            -0.049454378784311831, -0.046634966600536683, -0.014585928582595994, 0.027370547691190267,
+            -0.0041850296482130603, -0.019366131793031302, 0.0072692165339203214, 0.022858970897759928,
+            -0.0057744819950460366, -0.054069370673534865, -0.05169038674147293, -0.025929805972080056,
+            -0.016604503022028736, -0.031148008088897589, -0.0020960926229703957, -0.010293083742865271,
+            0.0045328573934111166, 0.012853850983636237, -0.0033587882662078614, -0.030168697111134082,
+            -0.028712672788369507, -0.014825729428213712, -0.0091982084802200749, -0.016195535886397411,
+            0.036710592559457439, 0.023645866680336036, 0.017875117172448288, -0.00037965829199302237,
+            -0.0080811592269812715, -0.017492643542112874, -0.012973547583989699, -0.021054372809237217,
+            -0.013574176224822251, -0.0033890981716262997, 0.031334875596500077, 0.013915830406255172,
+            0.0052052359304417609, -0.0052786076081904349, -0.013203630335143917, -0.020460087918411106,
+            -0.0051587881671265878, -0.001623191841619567, 0.0027858654789526885, 0.0085862290652952387,
+            0.026192664516227662, 0.0033362929105284897, -0.0089546911323753822, -0.010970417160072422,
+            -0.019383533072348181, -0.024420888630673269, 0.003517122393049037, 0.020282232348625306,
+            0.021352515571206335, 0.022371359675671412, 0.016739668785016773, 0.0056081024109362314,
+            -0.00014796513634303485, -0.0042634113226210297, -0.0088907966729085911, -0.012540997213153495,
+            -0.0010326207945132513, 0.003895793024806987, 0.0056755602581209218, 0.0079312840888879372,
+            0.00072199624014913401, 0.013507852203000192, 0.021270843968607216, 0.010303125131292667,
+            0.012963745512862052, 0.011161981909235931, -0.012564442594795517, -0.034435051818652203,
+            -0.030176272617192836, -0.023954973729339073, 0.0012902894017197322, 0.0064698643415269427,
+            0.0096722618397958628, 0.0044442133402477811, 0.005389268226341162, 0.0043595473045532039,
+            -0.0057776390486221655, -0.015448228219845525, -0.013407729678920025, -0.010446707654044648,
+            0.012603145498889133, -0.010567788436292467, -0.023833137250430465, -0.014901731032015166,
+            -0.021574455810694691, -0.02248941711545753, 0.013180847714424713, 0.041511686162231748,
+            0.03818917470033259, 0.033059902814935094, -0.0044902804659650462, -0.010695059852287435,
+            -0.014701280445856373, -0.0061218284411874487, -0.0068621334247276162, -0.004743798331243553,
+            0.0089508462294370823, 0.022928176415142065, 0.019553445984075039, 0.014705622567338284,
+            -0.0026473993227434708, -0.013157974508726987, -0.019658071478838801, -0.0090262391610477499,
+            -0.010940105825097312, -0.0088418163423873812, 0.011744244800870414, 0.031391787705002984,
+            0.027241942663890149, 0.02122047906277225, 0.03856061913114564, 0.014786235451174369,
+            0.0026547603348355993, -0.0083445113073351614, -0.018601226469425303, -0.027241139772974512,
+            -0.0041413590774086496, 0.0041024012059703938, 0.0087909622544127645, 0.01484932337381686,
+            -0.012751847007642874, -0.0083783037934017663, 0.0045867333735440906, -0.0093790389532613996,
+            -0.048990985150340484, -0.047726824189288558, -0.022533442380697235, -0.0012200977086859529,
+            5.9078623099192637e-05, 0.010488716387214773, -0.0249818896502128, -0.0068786019558994393,
+            0.013808265978860923, 0.01684751533499336, -0.011083020574791269, -0.058548986675005188,
+            -0.050259076265227617, -0.028988668513461532, -0.0385681882794933, 0.016673902496307229,
+            -0.00043514217383196913, -0.0019155951068088848, -0.00066771452966833743, -0.0063399545660911549,
+            -0.016181390941907833, -0.0076023616052235034, 0.00027608542801435716, 0.0045044090908420414,
+            0.0066136476966684524, 0.0010200938683507148, -0.030166757847441321, -2.6953539708699089e-05,
+            0.020861410961782102, 0.05092679629877557, 0.060329387643935577, -0.040352419736891451,
+            -0.065999035478516932, -0.058100189252728425, -0.080161608104484597, 0.016770452838230483,
+            -0.024339701883031594, 0.0022826279396488654, 0.017997246145555996, 0.049601796029695153,
+            0.069192566978478948, -0.02411107046416772, -0.05472820333498863, -0.053305537162198706,
+            -0.07402626367232458, 0.012594732424332527, -0.014911686479407804, 0.0082279912232508801,
+            0.014480085830262387, 0.055616016248068396, 0.10319605376827405, 0.010262452802630984,
+            -0.037908486038719734, -0.05170861358219378, -0.073059373314163817, 0.0049411636856844052,
+            0.0030896338174796617, -0.012408727719014582, -0.0084138054267652099, -0.051062451153872507,
+            -0.11668178496656698, -0.04136216974664407, 0.014718170402668276, 0.040572449405435924,
+            0.058563124600680493, 0.0033254369773789878, 0.0096958805092463764, -0.005050552973877907,
+            -0.0092637939646411146, -0.035056513176126687, -0.06443404556058481, -0.0055751909599855085,
+            0.024456845947490011, 0.032786660339070517, 0.046289808561856792, -0.0033345187808222687,
+            0.041024779281143731, 0.018985185484901791, -0.018786754464924893, 0.00073663777749678055,
+            0.086660104643842328, 0.12433349745769119, 0.077603875472357947, 0.026155352131563211,
+            0.032140733777860551, -0.030505873036429799, 0.036183675437936866, 0.0066665403650152423,
+            -0.021667022355913387, -0.036578402903803063, -0.013296171181776124, 0.072718991215137418,
+            0.074908817089531746, 0.051182407782500307, 0.069235434727263762, -0.022811022841556249,
+            0.0070125240946389712, 0.0011712358554545341, -0.038955485136389974, -0.025394578127165342,
+            -0.035601058500096108, -0.075932150920913363, 0.014258067998233646, 0.024920557389878369,
+            0.019779204824174106, -0.0044908447004955634, 0.012731142446873317, -0.023211612536640971,
+            -0.0038018607401020367, 0.058746985011379711, 0.031580774462968558, -0.05233487126524429,
+            0.0043147606101451713, 0.020072990171999053, -0.040080304644725707, -0.028892463230225915,
+            0.018397870299418972, -0.021456578301649227, -0.037416834576188406, 0.03488002090990569,
+            -0.00025830768327934905, -0.11642367806100512, 0.016524866801003964, 0.041014174480708106,
+            -0.021672058605506611, -0.031859629115015026, 0.026464000523153255, -0.04347541149320712,
+            -0.020512106077334027, 0.10236048913415095, 0.047517845879243417, -0.12490096272747522,
+            0.013033322149306768, 0.046467865918321256, -0.068996411861823453, -0.056150555255479094,
+            0.0080657529325665212, -0.032407394644065862, 0.044344366421683504, 0.11047024274732292,
+            0.087225543231357699, 0.026589316504593057, -0.012336184057938068, -0.004867255404146488,
+            -0.078480768114397623, -0.032793778205009352, -0.0060528964733527106, -0.0013301252702523705,
+            0.034467595269973547, 0.023240199156256351, 0.031941187021198796, 0.066618458663446012,
+            -0.012578636460767434, -0.02182735850528672, -0.0180297122945038, 0.0036150543693252218,
+            0.0020660755547945199, 0.0073554760973557126, -0.029992806720547729, -0.036491488007955486,
+            -0.037109083647673541, -0.046032621637985931, 0.010168854438087153, 0.014306165827405161,
+            0.026851829282461593, 0.0044149622961133644, 0.01194669217148529, -0.0081896042336920653,
+            -0.03946549694464007, -0.0011166690446877472, -0.021976209684480864, -0.094984196821397374,
+            0.015619775335027387, 0.03233781119292746, 0.003151396406667669, -0.015987188318900988,
+            0.0065963661726101928, -0.020922943875096533, 0.02152670476333373, 0.067252257649371983,
+            0.050144340357945516, 0.0029101371647333382, -0.0053379847211202092, 0.0015630341136543546,
+            -0.047447101926044864, -0.022251758768437498, -0.0029297147253671864, -0.0035217563883191295,
+            0.024284047552540485, 0.023157872792924687, 0.026388359568964421, 0.041958029781674136,
+            -0.0085383339531079003, -0.013423713939480209, -0.017357759341182423, -0.00060587899958627033,
+            -0.0029280317322244514, 0.0014491386560925635, 0.0029008728970186114, -0.023009357287432152,
+            -0.03030774084197236, 0.0036253384250391017, -0.010267783907428909, -0.026489630204060109,
+            -0.011040193255777783, 0.010289637488882944, 0.0052964388970772264, -0.011081417376132489,
+            -0.0041264523466626717, 0.071064661080971481, 0.097908693671388367, 0.026683949015829413,
+            0.043104442897243016, 0.061086135183865214, 0.022236192339896176, -0.028952190308065191,
+            0.011317094861006849, -0.013537944736455806, -0.010160582803057823, 0.11655587018049308,
+            0.15756323981755191, 0.017173669252774693, 0.062700066784382114, 0.11473997424550908,
+            0.044797045805843892, -0.049470431359629405, 0.01110942143604738, 0.002434093089796802,
+            -0.012057315564233834, 0.059694271652330495, 0.074594343116167292, -0.044923183829451763,
+            0.01595658878236678, 0.08815769868904301, 0.03976373027507546, -0.029345987471517367,
+            -0.0019020028015181902, -0.0025383672097558526, 0.0023453786198195862, -0.0028361257630489948,
+            -0.001965911118152659, 0.016027527523601426, 0.0034201226224198386, -0.011790429300050935,
+            -0.0062395608953830506, 0.0024312571368586386, -0.0076192069154426148, -0.020919912616192495,
+            0.010819760912473568, 0.026057164819515602, 0.046880266700090094, 0.10644959514372557,
+            0.044876172879747198, -0.03049438937552032, -0.022115385352345425, -0.0034006292239347011,
+            0.0025663810264550811, -0.024854279419948479, 0.00058202828349100504, 0.10224703951095331,
+            0.14667409319005451, 0.089489942700502076, 0.077385200936302079, 0.059930928922778515,
+            0.015993144748383138, -0.037842118318384549, -0.00075309151197726311, -0.015538215720310552,
+            0.0028541080821918498, 0.049456671828434016, 0.073236384866223372, 0.063450188337415239,
+            0.043495199175832555, 0.017955205508617209, 0.0014218979220346588, -0.016799078455362899,
+            -0.0020223229883320716, -0.0030415758314160483, 0.0025391411640493448, -0.0018230784024596074,
+            -0.0003453094887081335, 0.018387705861678892, 0.0046299907335890095, -0.012002917429989549,
+            -0.006542506307747482, 0.002166309227878983, 0.0015843096554688102, -0.019137131454134867,
+            0.00086193424517034059, 0.076323865783224074, 0.10986770821512623, 0.070151681040351466,
+            0.058773008337528243, 0.04290302925914271, 0.01088917649484419, -0.027997739039314802,
+            0.065795204812424402, 0.017915573222060926, -0.001496202828744938, -0.028080175639594043,
+            -0.049315535272320923, 0.015120879015256283, 0.051448301867655984, -0.0097519183306015392,
+            -0.058994780949622544, 0.020246860007836407, 0.046093250568980282, -0.036814212336408442,
+            0.0045297355295184829, 0.089146128290954807, 0.15088770596369505, 0.11671839346763233,
+            0.014639249682772446, -0.016491628134704995, -0.029705061143476229, -0.031512024134457396,
+            0.024108079912505867, -0.012266473775504841, 0.002624396613079432, 0.025331136607276612,
+            0.049820948164764622, 0.032290554334656212, -0.023371352670805288, 0.0087440691261934864,
+            0.033887983411036812, -0.027097523342302247, -0.078388594017246724, 0.014011798136158153,
+            0.0025193086171526346, -0.071156473475452689, -0.086948526657920328, -0.1562150821569126,
+            -0.20020217693608391, 0.091004769047538042, 0.293238409217351, -0.068764284328513087,
+            -0.032702858378693855, -0.015434579569522469, 0.0037227455592076289, 0.015716898172783985,
+            0.042935335100054678, -0.022935002743627714, -0.10145849463291493, 0.037894400253930094,
+            0.14040728717270359, -0.05275547186731655, 0.018544058493988186, -0.034315874013041425,
+            0.0028782221788936288, 0.085332415793879887, 0.13710066472184451, 0.10397898810946,
+            0.034855682289880272, -0.028034694049148868, -0.063473570920486652, -0.011960307912108321,
+            -0.016370979749954294, -0.086270720768391887, 0.0074730945013557031, 0.19941427748353063,
+            0.32543358985710702, 0.20029207876044555, 0.021596029319179321, -0.046410733588581526,
+            -0.070824953739416566, -0.045721212279652618, -0.0066411109439077675, -0.056769485348840569,
+            0.004203130379661784, 0.13615335054650296, 0.21731372165406185, 0.14499416979144772,
+            0.041323316099373286, -0.042822507611804964, -0.086587165897109727, -0.017631713629099093,
+            -0.065344395769435959, -0.021694149327258248, 0.00053112328219571026, 0.044355053565644995,
+            0.067434459790722351, 0.01171313799202402, -0.0072948047883636246, -0.012452932004885163,
+            -0.0087068903765149877, -0.00089870705355200517, -0.34235636003824832, -0.044221066881724856,
+            -0.0026460279789044705, 0.065689299516621336, 0.085874508506583208, -0.11968912901946474,
+            -0.086914169790827084, -0.014630914181475989, 0.056194814672772431, 0.020040526390041946,
+            -0.0019867879911110008, 0.014314963227452352, -0.0052064527004432358, -0.044863609761228593,
+            -0.0037086586117667918, 0.02741921692728496, 0.0064695093459064892, -0.023356449203716163,
+            -0.050051164646530727, -0.0058587613638220286, 0.0031347962793662112, 0.0038485564550296836,
+            -0.016011864030273298, -0.076059776279114338, 0.040970144062018626, 0.15704299922079124,
+            0.056614046889268715, -0.024499963460563042, -0.027245213768628367, -0.021648033283974809,
+            0.0052775057986927101, -0.011932870658876717, -0.012999338477965021, -0.039443571922101059,
+            0.051001350056289599, 0.15245636715325736, 0.058672223535937679, -0.0025143569915217082,
+            0.024487748904376418, -0.018862015907901864, -0.038646512766886396, -0.046068310926946562,
+            -0.0044233065628010203, -0.010146889233359373, -0.057215614666076699, -0.029040935050544146,
+            -0.013597169103982915, 0.023815743713057769, 0.081138022000255175, -0.0051787693713719139,
+            0.0092119772461397922, -0.028921032250738055, 0.0034078304767566074, 0.063680668251982056,
+            0.036723917298563807, 0.028129975316195949, 0.018534297288800277, 0.040010976806018422,
+            0.098472307637038931, 0.0017253304956653945, 0.009448433022727281, -0.028807445949678216,
+            -0.0030150941976499184, 0.033718408237305361, 0.051538227948918214, 0.089485247685819239,
+            0.040612578248609039, 0.031199396161875059, 0.090445706738033371, -0.0069520226696056613,
+            0.028095529731387816, 0.013370084614703071, 0.0047231006432036085, 0.03977174178021585,
+            0.052523078428902116, 0.028774270223784273, 0.016508129191959254, 0.0061644659877059969,
+            0.00082027812521893312, 0.0044448356628114033, 0.03361175022045295, 0.030279219704448801,
+            0.0035312523089043972, 0.019665176749551649, 0.057410523454269433, 0.038904827208931188,
+            0.018608844734078311, -0.010731179161672884, -0.042779451210914379, 0.0034202075325831939,
+            0.02615146470142481, 0.022674369703275968, 0.0083336309406658524, 0.04260020483796309,
+            0.032871917936778045, -0.02159260098967665, -0.0039698199300959988, 0.00025193874289884151,
+            -0.023797116470700555, 0.010134486256444952, 0.0060719582374499925, 0.0010820378232835933,
+            0.012749619582255674, 0.065853147282809291, -0.013451042420153356, -0.10272658589363781,
+            -0.035195659974272743, 0.019339545050145839, 0.019955644242604431, 0.016655318072214771,
+            -0.05260566145839389, -0.0335743768751956, 0.0096863794598416354, 0.030360780691646043,
+            -0.0037393295912101672, -0.019831958580276754, -0.049376923603328383, -0.030896458266853426,
+            0.0070567985019316711, 0.014017896049027759, -0.020826653151723096, -0.00064244269715592328,
+            0.019591230391233533, -0.044989662091468249, -0.049868070318013262, 0.017241604544750162,
+            0.026797644837641042, -0.01937138596340738, -0.025445199528585601, -0.028708566275161877,
+            -0.0078565426464767101, 0.0097803230040562038, 0.01987467407534926, -0.062141766410885931,
+            -0.057150746580603942, 0.02638603477265429, 0.04683014091865971, -0.012964319761243893,
+            -0.031973287149308263, -0.037973566242533348, -0.036787443959543246, -0.006143726243131125,
+            0.028366137723247885, -0.056893870405429176, -0.068924941779046123, 0.020518753468570638,
+            0.0289826094810627, -0.03138988920264172, -0.033763597739272816, -0.037144420199331216,
+            -0.0043033113431185602, -0.010057198451889526, -0.0083137905128457552, 0.035431430384971589,
+            0.027659048483300856, -0.016124507257147629, -0.030824198841516669, 0.0015987027023853621,
+            0.016897580035545839, 0.020945771210434484, 0.07441053375022437, 0.051886372785471202,
+            -0.0082263116553623651, -0.062754945240995091, -0.011524516982349617, 0.036771612499458997,
+            0.085947854314475408, 0.041222120597684, -0.019794327995815722, -0.031732360044764742,
+            0.073665414145174746, 0.062181290254294946, 0.0053265173629461135, -0.11086516876953084,
+            -0.052776726974469251, 0.057856007188883063, 0.12470938630465869, 0.03470568647274886,
+            -0.043738214605774622, -0.060702705723960707, 0.032947776219166391, 0.021194123188499638,
+            -0.005860032127354517, -0.019763341337914127, 0.0017072171489544777, 0.012750266300322364,
+            0.031533567327460786, 0.019257290860251623, -0.0047902471642425294, -0.00922906042411328,
+            -0.033586396270854364, -0.020800171224836878, 0.0069760112734542053, 0.016519555830966648,
+            -0.0048186526054511854, -0.011401019506741283, -0.029196316330275283, -0.020084750363735415,
+            0.0030865764064702522, 0.0072284897753516287, -0.054450763330838953, -0.031581450285027603,
+            0.013975301388869236, 0.01713678757361051, -0.01599837057449717, -0.014238211817482225,
+            -0.039492606939803311, -0.033769555678990787, 0.00022648666146901815, 0.0059230678240152785,
+            0.0041108002568972478, 0.00028965489760411633, 0.0029612860343944314, 0.00056232257084089417,
+            -0.063991561713446957, -0.032068659661574489, 0.0036700746294190574, -0.02282558929797272,
+            -0.0016887242580857741, 0.037889895576231347, 0.0086044425831223632, -0.023627214892114091,
+            -0.0078213256576575539, 0.01636413661077047, -0.068942746258369242, -0.053293848248027131,
+            -0.015556885824066198, -0.016209218116238915, 0.021863371963057474, 0.037700758986738941,
+            -0.00049844853738432288, 0.0097674932474214951, 0.0053119912594624466, -0.006211477092293664,
+            -0.018533729394129683, -0.0017059147995999182, 0.0089552557202232166, -0.010001678102207534,
+            -0.01006893675431187, 0.012236336627439419, -0.0076927664639213338, 0.070809692834809534,
+            0.035737144413977268, -0.045768402812239053, -0.071631262442634125, 0.019291431234307301,
+            0.061555082404112879, -0.050231435320438264, -0.071620496526294597, 0.051602041718988786,
+            0.0010304048064401087, 0.011762086857272423, 0.0075049272146619321, -0.0071848419007410382,
+            -0.047393942530206658, -0.014709448603037995, 0.012129619026774292, -0.020948698974281164,
+            -0.012674537587199126, 0.029567679990316238, -0.0088029216952384016, 0.055617981504319347,
+            0.026193895222989511, -0.036448647905204253, -0.013811880643888729, 0.036577097425730107,
+            0.046070796935673793, -0.024379640853937273, -0.055324644392043175, 0.015420438332056838,
+            -0.012389015480528729, 0.096691246598996833, 0.047518682625547981, -0.062838144931812265,
+            -0.068834199320868969, 0.040967777906516394, 0.082498891218452094, -0.05830070328463368,
+            -0.097163424698999704, 0.053321499068350112, -0.00087995700192850445, 0.019166186685670009,
+            0.010490095488328324, -0.012170667237841376, -0.037876519705083968, -0.0041089114445712659,
+            0.017653350205299533, -0.020161526513991716, -0.019790753633909346, 0.024903169577309901,
+            0.000335528466798084, 0.020161455219886736, 0.011891931110740279, -0.012574459454661921,
+            -0.05923743128290726, -0.014110125911309605, 0.019610808929554822, -0.028095538111846952,
+            -0.021243414239931535, 0.037668270059697452, 0.00048839154009986145, 0.013137626559079582,
+            0.0079323572423409643, -0.0081449691827997668, -0.042748548775560703, -0.011287978462640669,
+            0.013001420043157314, -0.019780715545480984, -0.013933548385921295, 0.026999165799861304,
+            -0.014258216003667595, 0.010762791238403544, 0.0097414390354449501, -0.0024926081979331446,
+            -0.0071162182143539735, -0.0014882562991226662, 0.00014940216997393063, -0.014734733078944398,
+            -0.0069256075265060595, 0.01596054997727946, -0.0096813099817796948, -0.017468053641825333,
+            -0.010039903036339518, 0.0040092876565650647, -0.010379064811106786, -0.027992887622579746,
+            -0.01935747343383724, 0.0057247926818432002, 0.0088095008487621973, -0.0069436158014637289,
+            -0.015479583311619201, 0.010846887161985133, 0.010012695747635827, -0.0025133094311664168,
+            -0.0079133865611058646, -0.0025282060654927135, -0.00049584378300438284, -0.015464987995252496,
+            -0.0070619234759597659, 0.01672644515098539, 0.0040393278726579048, 0.075546413879332502,
+            0.050071895355335586, -0.017381252388519404, 0.019612976229543916, 0.08601632294350528,
+            0.061686152772644401, -0.0457240220690215, -0.040901313478716651, 0.05188350700036496,
+            0.018834409247777635, 0.063107060921848909, 0.039109091223197369, -0.014502219758446124,
+            0.026712504707588139, 0.086176092212849109, 0.060532645305639475, -0.029627357989159803,
+            -0.033021606302778311, 0.034409621193657758, 0.0041989723458491111, 0.072898438108631655,
+            0.048263867919157447, -0.016771690016718948, 0.019126772207479069, 0.083280437993676154,
+            0.059699419883095066, -0.043954414659508494, -0.039445373926212592, 0.049890930701257982,
+            -0.032501315773318835, 0.021971547561974242, 0.020483233876800067, -0.0050922456461098666,
+            -0.016794893210946987, -0.0061826250006710923, -0.0016716358949762922, -0.031960964629619053,
+            -0.01438954464903879, 0.034543085408538621, -0.033178776412075381, 0.0025918535209470605,
+            0.0075753722395054471, -0.00063308938525712794, -0.021586479044977281, -0.02791578263553245,
+            -0.01728687983941081, -0.020032712545747788, -0.0038706863585108099, 0.021026335958609681,
+            -0.026211702009969178, -0.017877190396150707, -0.0074087269835627929, 0.0040851991800600739,
+            -0.021514640340513803, -0.043753027471022859, -0.029305703134708178, -0.0031763658471906393,
+            0.0078084108638193841, 0.0023118105371837967, -0.0083257045460976287, 0.0081320547165431214,
+            0.0069300761452325364, -0.0018806417402117454, -0.0037417038275692933, 0.001142901054906084,
+            0.0015381853900969748, -0.009776829235208305, -0.0050515386539406468, 0.010645555509366356,
+            0.029617000184510849, 0.04341474385218777, 0.053093468468786417, 0.014000626072036407,
+            0.00055693607866079756, -0.019459109838376881, -0.048701834871642952, -0.034185377904741243,
+            -0.0092064260257293425, -0.047350991537970899, 0.012324686823948456, 0.021139920814726175,
+            0.026887744877842273, 0.01310007991908882, -0.011395120459341126, -0.033075653885488651,
+            -0.03262807344603174, -0.010919220410338069, 0.0060041849266157781, -0.030021875316935447,
+            0.0029347464580312243, -0.0033317623516086071, -0.0066451045460880704, -0.016679080599106506,
+            0.028933131813455387, 0.060110280514740815, 0.0258766931081372, -0.011599931153987147,
+            -0.025340433731604245, 0.020933660178370093, -0.0025755488981779465, -0.019613331850077222,
+            -0.029319092697445495, -0.038700389917553993, 0.059865449519308812, 0.13040517752527295,
+            0.067934651297939769, -0.014065889679817324, -0.049881200180688437, 0.057284017902744733,
+            0.017398084361571007, 0.0084473146427415588, 0.0045870931044971336, -0.032141347242466464,
+            0.064849243349854813, 0.12718179047466371, 0.039989611204181735, -0.038430936051321994,
+            -0.059988116279748968, 0.029439839002587131, 0.013884128135478999, 0.007219980648133173,
+            0.0044073959193013067, -0.024516480102516759, 0.049940119520838669, 0.097603237080883531,
+            0.029987037380137006, -0.030153792204779963, -0.046339910822770475, 0.021886474184094666,
+            -0.028279502462354313, -0.033603508114653201, -0.038451338901149761, 0.0052113886355887856,
+            -0.030230282153622855, -0.045220933910599295, 0.014927517908248455, 0.041087431783770861,
+            0.033912949350159038, 0.018858823476541171, -0.026211301204638628, -0.038528635103427682,
+            -0.047153833975333653, -0.012642041090370051, -9.1101393225743316e-05, 0.018084649768536378,
+            0.043528723356333579, 0.030140090708868261, 0.0078078865008782538, 0.042262578300785184,
+            -0.021822262092658862, -0.036994201332481387, -0.046927115846804174, -0.022162288262325355,
+            0.018525343754034494, 0.055017337764689991, 0.056016389041950464, 0.019803250509110634,
+            -0.009234481619383221, 0.051692075116900778, 0.014012879867012393, 0.02056093278197085,
+            0.025151392555951148, 0.0066711564996866108, 0.00018845842082652192, -0.0093680387603907421,
+            -0.023122399319831066, -0.016153002765735482, -0.0042924107911147136, -0.022470072345645964,
+            0.0084754574931418577, 0.0055533033792262865, 0.0031159018572466781, -1.6415835710049053e-05,
+            -0.00998368472817311, 0.0031144729319344802, 0.0080205393345897935, 0.0075608349806175479,
+            -0.011102112870643659, -0.0069181271676772571, 0.00071717616448896924, 0.0027550420956063892,
+            0.013467857642707044, -0.0010180936273742269, -0.012583776838825502, -0.0096082533100125718,
+            -0.012524125438321749, -0.0010585677391211938, -0.0018830685555532552, -0.010444363391524689,
+            0.022015401071596191, 0.0049857349842457772, -0.046449073658534033, 0.0041570761580074413,
+            0.022557281698430725, 0.04886756013282878, 0.075370768180997985, 0.02665502785761904,
+            -0.024940395159397975, 0.022754417313285084, 0.038176333410840646, 0.0091241161557545913,
+            -0.077781307137881825, 0.0069957901031419377, 0.03665797474048365, 0.082672911941988017,
+            0.12793395491796633, 0.045866172440649264, -0.043446075774599614, 0.037393477452958915,
+            0.0015342365631517171, 0.00096958607261465033, 0.00035787997821503206, 1.2902723821551625e-05,
+            -0.0016239707489545065, 0.0007179187321391244, 0.0016580290710993435, 0.0013951878247788567,
+            -0.0019949831987078072, -0.0010983937804845288, -0.033589295208678309, -0.020414475191126512,
+            -0.0031383260745032338, -0.00064412843384542996, 0.031378246781347832, -0.019228960804401,
+            -0.040995810600921528, -0.031149189990520819, 0.043340843609579634, 0.020540433001265908,
+            -0.0030187031641630583, -0.0040831495528078484, -0.013274452861227966, 0.00094250872267230231,
+            0.014370684962356137, 0.0079853299956252847, 0.0093067076967063324, -0.001128298697099535,
+            0.0048235792578251767, 0.011546822131422838, 0.0013965681242679975, 0.0001144128482734989,
+            -0.0041129622831187684, 0.00035352087196945797, 0.0024679302945042523, 0.0039720064567843215,
+            0.0059475150735316794, 0.0018409146880961926, -0.0014987603712513298, 0.0023143609265197326,
+            0.023180535742605188, 0.00091859310665508547, -0.073933199114962544, 0.0063040406640457059,
+            0.045999942471662135, 0.070163788386060175, 0.10438290186679766, 0.031284586602542484,
+            -0.024471871893198466, 0.042644330030104052, 0.027516319720104699, 0.0092160836974258184,
+            -0.040809346631786474, 0.0038678884922237499, 0.012861489258100023, 0.048184535542134074,
+            0.076959427598283309, 0.031097044455520507, -0.03240463447916847, 0.015563339234777632,
+            0.013469139543282145, 0.0023824877033013156, -0.049546074332171779, -0.037329011293737765,
+            -0.028880927782989438, -0.055578547990804403, 0.01291060481218529, -0.036907228471862209,
+            -0.039873647520183866, -0.053175575821373916, 0.0038736848772953879, -0.025910770239408722,
+            -0.075156221409885759, -0.04982184840930054, -0.037079861145191885, -0.080707658174367675,
+            -0.03035520307091491, -0.056266997171936214, -0.050895650504513945, -0.072206974488308234,
+            0.019451414390690761, 0.014396893602649244, -0.046461146002879664, -0.037807003885551693,
+            -0.029854910181117484, -0.05360070663816513, 0.032679255628508208, -0.034492831848325169,
+            -0.041340956327925046, -0.053347632006951626, 0.00062014551856917578, -0.0071119767388405017,
+            -0.018819409518580986, -0.012331859177968866, -0.0091427558334850959, -0.020133464545905339,
+            -0.0086562112776772272, -0.014095445116491294, -0.012541875796818654, -0.017902267362457182,
+            -0.032033514573596669, -0.0703783507661426, -0.030361044498890318, -0.0063234181144826429,
+            -0.0013238792761183921, -0.025300247282714815, -0.11359849672149336, -0.023303734903101843,
+            -0.0011036075600230483, -0.012013254809438351, -0.027481327497362429, -0.067588986705030302,
+            -0.042562346181869659, -0.016023604597655131, -0.0089381895488042772, -0.03925562875074036,
+            -0.10669346926805245, -0.03237149078136782, -0.01163829659641738, -0.025739122633326901,
+            -0.0019015058626478953, -0.019799224821237502, -0.037576896461641127, -0.023333234515988042,
+            -0.016979339817996951, -0.039518180340264789, -0.026753737993682979, -0.028198096802447427,
+            -0.023224250082354576, -0.034142372693866094, -0.025546569322558103, -0.087462383797604945,
+            -0.095974752989337164, -0.051095103561435942, -0.034957749122356371, -0.096435500675165611,
+            -0.13073426321892673, -0.07237357161776746, -0.047335250229001015, -0.076637739146118322,
+            -0.016586820353335825, -0.051639081150251502, -0.050524245849219142, -0.025608834393068557,
+            -0.017127415912411216, -0.05008461878688604, -0.078288106796730747, -0.038153373105231925,
+            -0.023101447962732863, -0.038742110972826448, -0.0028228373748885142, 0.017545351760040254,
+            0.051707527480976262, 0.03434226725890864, 0.025575077782706891, 0.055561208031140896,
+            0.020408640995562787, 0.038709037240865232, 0.035107586633240477, 0.049758990566038941,
+            -0.0067618172957033618, -0.014860626081654581, -0.034492370234146995, -0.027764681679017397,
+            0.010917173113714262, 0.018752577243166639, 0.0040298200554225857, 0.023648453679070286,
+            0.020463509473404286, -0.0064454758318405036, -0.0036065419264257248, -0.010445523390718461,
+            -0.0055674106442223231, 0.00055210707076197357, 0.060621963873884105, 0.015313025313367703,
+            -0.019248066572507685, 0.061274581861609209, 0.039134902099724485, -0.034979945849125525,
+            -0.0031614167779787901, -0.011873858128297329, 0.0089588465446608038, 0.017053402629725618,
+            0.11225029668018831, 0.019151895117927292, -0.039953325963129865, 0.10620162447206477,
+            0.064745343054171567, -0.064686366604547546, -0.0042777441212292124, -0.016074178366260485,
+            0.012160722350701496, 0.023121125450969574, 0.15205107733257009, 0.025930521459817061,
+            -0.054125313383191792, 0.143848179544284, 0.087692066675558566, -0.087622212358606275,
+            -0.012196212924936209, -0.031512586975882315, -0.038234623603331457, -0.021369177818074014,
+            0.12211103782102219, 0.043750080369360372, -0.032723430346893095, 0.13360262285235958,
+            0.089653740008982089, -0.070578084629066382, -0.0057646152601542157, -0.015696443636821614,
+            -0.013988519826714549, -0.0052113666681189216, 0.075157393448456705, 0.022369068624581732,
+            -0.022277078341592239, 0.078635473997081637, 0.051357045989245835, -0.043398054118121449,
+            -0.0029745661498124386, -0.0061209142487988104, -0.017293779717798264, -0.014752554337798885,
+            -0.0042540977075073141, 0.0073716317204557229, 0.0053090939690162552, 0.0023608738249689368,
+            0.0043380641710329872, 0.0023775545178341519, 0.0010184443561983142, 0.0027060817685388601,
+            0.0028127554867101584, 0.001329431785326958, -0.011820063615289323, -0.0038106639870046531,
+            0.0033663756058322754, -0.012597860861539139, -0.0083224368731888779, 0.0068279195627734364,
+            0.0044095064012166525, 0.010185586183399448, 0.019973861997594274, 0.015089588478165817,
+            -0.017879656531338523, -0.013271770299206077, 0.0015736889814953131, -0.024976730625982959,
+            -0.018885982008900737, 0.010396836943556115, 0.0051775107589677235, 0.0096961550887624155,
+            0.034979409915363323, 0.031518543357242773, 0.028239695645062301, -0.010811736138107693,
+            -0.017376451345171351, 0.014392060464803744, 0.0031787742364409802, -0.0161309207224309,
+            -0.021801418319887633, -0.045073696606649151, -0.05359287192419853, -0.11402711532497692,
+            -0.035415076601482069, -0.075196913174593843, -0.057707211193202407, -0.022520598550388776,
+            0.0006457790173238602, -0.019229283804400872, 0.03980783402111901, -0.0028161981692210953,
+            -0.009926887801671426, -0.011923539815987807, 0.036134252592002279, 0.0049627541292750505,
+            0.0043000008958871344, 0.022148308869234735, 0.0057816769201565338, -0.042469820453552382,
+            0.097991733128046488, -0.0063838271270398733, -0.023741555600151447, -0.027932490071973154,
+            0.089132656737500884, 0.013069349009412715, 0.011236354267415918, 0.054642983514342734,
+            0.014187425233837522, -0.10404452179228867, 0.020172472378028133, -0.024644933123387912,
+            -0.034430965070755638, -0.066087602894340305, 0.010528349370555922, -0.033584416614865845,
+            -0.02539003008961243, 0.0060483194429806209, 0.0048285733503117285, -0.042683518567084668,
+            0.051127051935206308, -0.016510474494889453, -0.029076495617665048, -0.048658809268511974,
+            0.042087037607899717, -0.01367302042514499, -0.0097871523084326062, 0.025572142372199375,
+            0.0084800932751777046, -0.066297855963451086, 0.0043106341898547854, -0.034623047768134754,
+            -0.044531659020054855, -0.090043759333619924, -0.0075904860646969011, -0.052820645063968226,
+            -0.0402839423223895, -0.0052511472403065432, 0.0034325724312100903, -0.035878409402976,
+            -0.019895493569859625, -0.06241344228215312, -0.075854588892551048, -0.15909291008934223,
+            -0.039452071150182642, -0.10170963817418806, -0.077930581927742729, -0.025295152554972816,
+            0.0023295943614225247, -0.03694422312027041, -0.089586610359686653, -0.064695079661896832,
+            -0.067608098902314728, -0.1568698040395948, -0.10512930637514425, -0.12161102982786585,
+            -0.094022038069089098, -0.065677479149948967, -0.0072025374278986585, 0.030833833680597958,
+            -0.085534052453163228, -0.017277956909711848, -0.0082117354246354704, -0.034713211691387531,
+            -0.085460551611669766, -0.046935529074448312, -0.036940394528753154, -0.052789535760696386,
+            -0.010515113184381164, 0.069990332498418073, -0.079433047687306885, -0.0220788476129666,
+            -0.015265922346324325, -0.047840344692263739, -0.081387133492665326, -0.052968315607995295,
+            -0.041469483172028886, -0.050368966109925098, -0.0092716904426512568, 0.059498933772635605,
+            -0.011110454294944824, -0.011822346722853518, -0.013667658945532382, -0.0090913672089506532,
+            -0.012884902248281545, -0.0079692652177850102, 0.0064954693645401657, 0.014855151882837318,
+            0.032705376881108195, 0.0040785930456332326, -0.0077209960179952606, -0.01039213077391829,
+            -0.012952613724822591, -0.0048506890448870724, 0.014005238016454332, 0.010990504617157729,
+            0.0037422286773934688, 0.012259098666850956, 0.010402634051822783, -0.0035463902258218247,
+            -0.0039872704369605348, -0.0065515790572201879, -0.008569693505369614, -0.0017062277190567202,
+            0.019732077341829701, 0.014674184031540308, 0.0015124456087272763, 0.0073847181649293082,
+            -0.0013380258559355217, -0.0053052134085770607, -0.019484291524474309, -0.022027233866684863,
+            -0.026023546638106774, -0.015070779754943496, -0.0089402181714667468, -0.0041446424640407273,
+            0.010932058910917291, 0.027202715270458856, 0.050024149452770859, 0.0033574177213941698,
+            -0.02130882466764078, -0.026198981200003916, -0.031808093011955745, -0.015060233067176621,
+            0.01247169889653077, 0.011484517354365491, 0.011207950071227263, 0.031625923278164277,
+            0.04276442774843503, -0.0025115273994683876, -0.017436336846109665, -0.022123065923402609,
+            -0.027115253976528874, -0.011861354360102046, 0.017434194190770667, 0.014601621022630247,
+            0.0089281414841781131, 0.026487998595040255, 0.03111201360529571, -0.0040641444229031522,
+            0.0011986302614089184, 0.00040845121665022987, 9.8388388461080178e-05, 0.0015652591046746702,
+            0.010535960951067735, 0.0074439421855870885, -0.0010081484648584254, -0.0008314916659856494,
+            -0.0084381768186357394, -0.002981786027580131, 0.012101668979948948, 0.014340913586811995,
+            0.017210506533512856, 0.0089156360493593059, -0.0014078435310547611, -0.0024367517085952207,
+            -0.0065559395875299069, -0.017482449180414177, -0.027333255899437657, -0.00015083791587232803,
+            0.023936458930312376, 0.028581765182608319, 0.034384632417816197, 0.017488909267150837,
+            -0.0050653566946058624, -0.0064616689524958047, -0.012890644779452695, -0.034771653180257975,
+            -0.052839365411795715, 0.00033549420186506713, 0.017048614665072601, 0.02071920825475913,
+            0.025064856129000498, 0.01221234881793112, -0.007426553183226093, -0.0073514544489342018,
+            -0.0090529420566179478, -0.025087900753123029, -0.035584508026395782, 0.0013002471010714104,
+            0.0071016921349241627, -0.0025047930251447838, -0.013400332683983121, -0.009547424132581056,
+            -0.078518447664826463, -0.056577169365102709, -0.043696106991861113, -0.0029304810503800616,
+            0.047782516672340569, 0.059660617748246297, -0.0027063824137859398, -0.0083987564567067335,
+            -0.017734030036342826, -0.010220433873109488, 0.00039049254222908291, -0.005281366005999889,
+            -0.007469837732647918, 0.0038095583065605246, 0.006910226292469188, 0.00896150566157187,
+            -0.0072456928017020777, -0.0058144104158280082, -0.0067674572478175939, -0.0026608591600545024,
+            0.05368318804798955, 0.033703973650598018, 0.022996099473558643, 0.0053995916189107981,
+            -0.026272577473248689, -0.032505163531792974, 0.0028413045255258618, 0.0062726030955066545,
+            0.012403588639253503, 0.0069592210818688136, -0.0084450855023484872, -0.0017586387051653041,
+            0.0012790970319794086, -0.0032668220577355698, -0.00042013779326003026, -0.00078395661254894358,
+            -0.0044238027641212117, -0.010699896249247979, -0.021591989772965465, -0.012218700332678818,
+            0.010200639925914716, 5.8600079116732928e-05, -0.004399478095717611, 0.005355123871288222,
+            0.003161704340238651, 0.0043847944790632101, -0.017907063088480116, -0.031398580732112609,
+            -0.058309447705070246, -0.031807758692905919, 0.078906410162983553, 0.034426606921914363,
+            0.012915835289389808, 0.018247121127318248, -0.01919695937542619, -0.022624374440723256,
+            -0.011137204305525157, -0.019158848176840534, -0.03536334082112462, -0.019235423063019841,
+            0.050241565995759539, 0.022471374829864076, 0.0089854433082641287, 0.01124237146941915,
+            -0.012931351006681305, -0.015322756210318599, 0.011619764998972118, 0.020314104101830974,
+            0.037689550137521698, 0.020550613143332751, -0.051391911478956713, -0.022511971027887177,
+            -0.0085362735169480005, -0.011823091971152127, 0.01261847230828634, 0.014884841353269701,
+            0.020836017892837465, 0.041240164826953113, 0.079338585688139271, 0.043983133783826435,
+            -0.076954291132567354, -0.026552463235372799, -0.0028919899470589115, -0.022586508003069099,
+            0.0096985228530032056, 0.010377021321359481, 0.012261222957244796, 0.026051265910854979,
+            0.051041797254038714, 0.02852426535486877, -0.039655234151393867, -0.010508357045156375,
+            0.0028963867093573532, -0.01380462884743535, 0.00091882442735109586, 6.4192926044814858e-05,
+            0.0042426463729869366, -0.00087065298639859732, -0.0056301889638261625, -0.0028632454384327306,
+            0.0064131361636096153, 0.010001462137272776, 0.0053388002976427328, -0.0024114760433444453,
+            -0.00020397616135258085, 0.0010378235428427952, 0.034109304751649215, 0.017642609563337193,
+            0.0022918770243053367, 0.00079172743159508421, 0.0089309110303498248, 0.0049589108311442129,
+            -0.01757401515380182, -0.046401641508768063, -0.034412176241941123, -0.0058844608218589344,
+            0.054970093415295518, 0.022208441744785916, -0.0083182409010254012, -0.0047382732983256032,
+            0.025159976231464792, 0.027048618193164953, -0.013041998345942728, -0.067957006950851329,
+            -0.047180590490748443, -0.0058895715660344846, 0.018339501032628575, -0.0012574680130300001,
+            -0.019500989670610293, -0.0099552885246528486, 0.023386585248406179, 0.035559888010331539,
+            0.016925503099467169, -0.013171266462188268, -0.0042145798541502241, 0.0030391833687816463,
+            -0.018507677862166293, -0.044627395361775631, -0.068894263498126024, -0.034301745247483646,
+            0.05579428759154495, 0.10463817043639276, 0.095593173633577111, 0.063606169177970073,
+            0.065291662254582786, 0.023432951664316807, -0.0073084326721696629, -0.075167502804716416,
+            -0.13825930223036709, -0.069149079104961972, 0.12157801395117653, 0.2175089111843769,
+            0.17901859788682478, 0.088200893716303755, 0.10231258146274554, 0.042478974224195089,
+            -0.00033767393034043417, -0.054913532756178912, -0.10566160921384843, -0.052900390500747026,
+            0.094603363703957971, 0.16754868876427154, 0.13455581577451159, 0.060467091992500714,
+            0.073138878777105717, 0.031663797509292241, 0.011331052162529907, -0.022463586782896297,
+            -0.053901116217948998, -0.027106047865196121, 0.051964748040985199, 0.088370201784954874,
+            0.063697333870480669, 0.015636234111228622, 0.026237500785831272, 0.014399365055773244,
+            0.020925617398447043, -0.012901219721519442, -0.044379615806464393, -0.02243879131689613,
+            0.046519978751235598, 0.075681873888453502, 0.047461876645413618, -0.0024584671383515375,
+            0.010440519877473093, 0.01008832360244569, 0.024473338471492179, 0.02709262394004509,
+            0.029500348416972518, 0.014515302433649745, -0.018561374217768163, -0.040635862057347108,
+            -0.048044464583394314, -0.049116499221597873, -0.043886810972093661, -0.012556152782000689,
+            0.020818571646523787, -0.012885189989925654, -0.034844374163879241, 0.0068878176082486954,
+            0.067770921250103797, 0.075161527127647731, -0.0047777525013798991, -0.094194332779523868,
+            -0.069962254410391389, -0.028724466090139584, 0.068433194375425221, -0.036338018989391901,
+            -0.12311667554005973, -0.062358910985815252, 0.1130518856599575, 0.23224030926069791,
+            0.10643142643102092, -0.083395416643698567, -0.032293669315548675, -0.03369499518429013,
+            0.043430258415799505, -0.021235988410012428, -0.080737093153416414, -0.065362349706337391,
+            0.038460579961999405, 0.14289084970419066, 0.10459876845480859, 0.01570803874934662,
+            0.039477072110947434, -0.002961270202192192, 0.047110171214765573, -0.022968488020768799,
+            -0.087673394591264261, -0.071845059887107529, 0.040500282812545849, 0.1548334892191269,
+            0.1148186740368991, 0.019552738176589084, 0.045018508947889106, -0.0025374424082951139,
+            0.016755751651845847, -0.0083186385310112226, -0.030969935304794634, -0.023442808621331031,
+            0.017128994709002997, 0.055437962005278382, 0.037805253221148714, 0.0013372816330520787,
+            0.011103645077300503, -0.0024102411362782305, 0.046690016593177001, -0.025530643007122506,
+            -0.08294644243052865, -0.032117033640613482, 0.090593581552882343, 0.16026980144171701,
+            0.057630170652689133, -0.084654884069189418, -0.046286559845938782, -0.030439602952784126,
+            0.050128711594578108, -0.027457982652798529, -0.088988363694786576, -0.033818202656065798,
+            0.098123154555732103, 0.17218943629033073, 0.060920165329340512, -0.092657570831478242,
+            -0.051240319448354471, -0.033156006347376976, 0.021205930086573274, -0.01152132188307519,
+            -0.037779045154021251, -0.015637049472329901, 0.03979099160602112, 0.072609102383244542,
+            0.027683473217444018, -0.035654495775281042, -0.018580845565581372, -0.0130751150587899,
+            0.0099168558724502427, -0.0049837918728633159, -0.018243341894300477, -0.013021021733741117,
+            0.011239541415046099, 0.032959707826997961, 0.021148486272134386, -0.0014803219631487671,
+            0.0045865939817724341, -0.0020362938617993474, -0.00091729358145724955, 0.00070181951445601307,
+            0.0013441235820073644, -0.0021975464926615815, -0.0054309602133388096, -0.0036420581522057295,
+            0.0029320884551656862, 0.0091914865985136054, 0.0074875621735325743, 0.0026187951582110742,
+            0.0073929183817618635, 0.01398738665090815, 0.035779625553354427, 0.064840524657590243,
+            -0.021336540018640562, -0.12616322542582326, -0.12839379416359192, -0.090715158214318331,
+            -0.044620687567442578, 0.045623208920188396, 0.00033641479155632065, 0.01759828337052205,
+            0.051017232340034198, 0.091683264245455712, -0.011377235796715065, -0.15115112927128579,
+            -0.15551548821594022, -0.10260143970566342, -0.050560758959213317, 0.060975163335042305,
+            -0.010006384402747504, 0.009177351617091288, 0.033420505742970202, 0.059287327101145773,
+            0.011633652888290897, -0.070213347913359481, -0.074258743310941289, -0.040408332321813095,
+            -0.02003084820323902, 0.035857281960376915, -0.025427075879718725, 0.0021961326484396995,
+            0.023414930657006387, 0.040145980618513766, 0.04252218576577324, 0.0026763740564510387,
+            -0.0022943358452592148, 0.01995833678067812, 0.0095397941046679209, 0.017763183745835208,
+            -0.036864861141659155, -0.0028156857115529273, 0.016477766773673734, 0.026818329675724038,
+            0.065330719765097481, 0.055314513048582731, 0.049615695016308414, 0.063768016126352439,
+            0.030997114474600421, 0.0049198489399170375, -0.030624787676364916, -0.00082456466471598458,
+            0.018098530538825621, 0.030201738127234524, 0.053343085519306159, 0.032967864431495852,
+            0.02785304963411217, 0.044181410319825358, 0.021417011858662571, 0.009346153465145661,
+            -0.022181125174339521, 0.0077427280833203757, 0.037392664673168, 0.065503737557319877,
+            0.033518998549208048, -0.047618562757591167, -0.053419161026261944, -0.016418449492029797,
+            -0.0083498275819584786, 0.035729410503695727, -0.065796194415854478, 0.014284160535260954,
+            0.085634773777414963, 0.14887997706675865, 0.10475517344682077, -0.066812212064976687,
+            -0.081836337171762571, 0.0017089857746508189, 7.5780354877257039e-05, 0.075832608255950798,
+            -0.010563037856016739, -0.00041115036471978133, 0.0058734582965721833, 0.0097540848481743672,
+            0.018476744659224397, 0.012457751916744102, 0.010725413935465215, 0.015974781110150965,
+            0.0077497430341743733, 0.0027835452784236245, 0.048485709483178895, -0.0030083596602358221,
+            -0.041214847957121437, -0.070382969973984008, -0.081807125568487626, -0.015213734735200404,
+            -0.0060317130668652366, -0.044904428967520775, -0.021565274484012624, -0.029776569468167972,
+            -0.0016134769586878084, 0.038251222096523367, 0.052895905402927115, 0.051821772166354599,
+            0.078149668447254697, 0.0010263061583705366, -0.082002226443637388, -0.10662244311961037,
+            -0.076659408669146542, 0.04468167737674171, -0.00072323234892444422, 0.010505432476018839,
+            0.016853609242669702, 0.017702605552204459, 0.029854309363335572, 0.0051073848996298805,
+            -0.019539828923576391, -0.027114284416948544, -0.023002634268401181, 0.0065131916741391306,
+            0.0013882807652972717, -0.021730443771210427, -0.033967037673785852, -0.035283220844507461,
+            -0.058526466576427176, -0.0087087952385452288, 0.041564693292835915, 0.056919879225732939,
+            0.0468314335989585, -0.015687059451402228, 0.0014987105810322556, -0.02987554910351288,
+            -0.043294427342837671, -0.043429694588961829, -0.068183255125815356, -0.0049108778321345203,
+            0.061507635217849785, 0.081428952452982678, 0.061533126031240316, -0.0299943104749869,
+            -0.0021253712716567284, 0.0022820486496548317, 0.02000656385554779, 0.028229828201938603,
+            0.065448673975093699, 0.035018176643703477, 0.016706426304693732, 0.009350361849080141,
+            -0.018689919946172195, -0.039048665351974279, -0.005704568578152336, 0.060166562430066781,
+            0.10949943249124586, 0.12074331985936201, 0.21778861483688738, 0.056168934455006717,
+            -0.095276570999092813, -0.14319024727144225, -0.14261049198712328, 0.0051808432513263808,
+            -0.0043127275374022249, 0.068845848453585018, 0.10690274398975101, 0.11072307857740221,
+            0.18285809389108226, 0.026116487446880415, -0.13259526199076022, -0.18099485179899671,
+            -0.14777473805188931, 0.051458879560612091, -0.00098621518565597142, 0.044820527116291836,
+            0.054470002843282073, 0.049517780540402637, 0.0644791154360079, -0.014377518435323554,
+            -0.1057117468005539, -0.13193636322290828, -0.083533362639967829, 0.070947169886502112,
+            2.509945043194196e-05, 0.023389430127698618, 0.02394258544932568, 0.019153817319525594,
+            0.017478782582588684, -0.016801550176747705, -0.060910620999698684, -0.073029813292421072,
+            -0.039836546606718079, 0.048119716076746658, 5.9392784380242741e-05, -0.0071759762421080963,
+            -0.0079028657718400747, -0.0067076758564958427, -0.0073724880139809761, 0.0039989212972566888,
+            0.017973468937782643, 0.021886352243486881, 0.012688787590465364, -0.013384030993098607,
+            3.5580290258303688,
+            };
+            return table;
+        }
+
+        // How many separable filters each plane of each detector has.
+        inline const unsigned char* separable_counts()
+        {
+            static const unsigned char table[155] = {
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 3, 2, 2, 2, 3,
+            3, 2, 2, 3, 2, 2, 2, 2, 2, 1, 2, 1, 2, 1, 2, 2,
+            2, 2, 2, 2, 2, 2, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2,
+            1, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 2, 2,
+            1, 1, 1, 2, 2, 3, 1, 1, 1, 2, 2, 2, 1, 2, 2, 1,
+            3, 3, 2, 3, 3, 1, 1, 2, 2, 1, 1, 2, 1, 2, 1, 2,
+            3, 2, 1, 2, 3, 1, 3, 2, 3, 3, 2, 2, 3, 2, 2, 2,
+            2, 2, 3, 2, 1, 2, 3, 2, 2, 2, 2, 2, 3, 2, 3, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            };
+            return table;
+        }
+
+        // The separable filters, in the order of separable_counts(), each
+        // being its column filter of filter_rows values followed by its row
+        // filter of filter_cols values.
+        inline const float* separable_filters()
+        {
+            static const float table[6100] = {
+            -0.29568404f, -0.258705169f, 0.0214267969f, -0.0085081812f, 0.0088067716f, 0.0294272397f,
+            0.0160298385f, 0.096424602f, 0.17127046f, 0.0222765096f, 0.1012206f, -0.153492197f,
+            -0.226456404f, -0.249997571f, 0.0194796268f, 0.0367272161f, 0.140540674f, 0.116149135f,
+            -0.0760526806f, -0.0829186141f, -0.0154593447f, 0.00823083054f, 0.0284814406f, 0.115212053f,
+            0.119054563f, 0.0845007375f, -0.0821855068f, -0.0206444059f, -0.0115674445f, -0.0142591028f,
+            0.0672045201f, 0.103833117f, 0.0328945965f, -0.0574213974f, 0.124588184f, 0.0694594607f,
+            -0.00679422589f, -0.0401345752f, -0.0392562039f, 0.00142294297f, -0.335752994f, -0.270575166f,
+            -0.122934036f, -0.235236183f, 0.00314179203f, 0.00154377578f, 0.102665968f, 0.215529323f,
+            0.264822751f, 0.0457639731f, -0.173523873f, -0.328471005f, -0.319017798f, -0.236909956f,
+            -0.171251729f, -0.111989513f, 0.146903828f, 0.135988757f, 0.0815168917f, 0.0336274765f,
+            -0.138608873f, -0.0874089822f, 0.0481879935f, 0.347260863f, 0.18655692f, 0.0555850267f,
+            -0.00852654129f, 0.0416418724f, 0.045506712f, -0.0742851421f, 0.069256492f, -0.0222178269f,
+            -0.122147709f, -0.142729536f, 0.305886745f, 0.22830154f, -0.036726553f, 0.0898456424f,
+            0.0368707851f, 0.00181685505f, 0.227127641f, 0.215491131f, -0.032660339f, -0.348232031f,
+            -0.0905921012f, 0.0427502915f, -0.0594342463f, 0.0174377207f, -0.0359596126f, -0.135690138f,
+            0.00504373759f, 0.189174131f, 0.183447942f, 0.0603992976f, -0.247381017f, -0.176695809f,
+            -0.0354287997f, -0.220513433f, -0.0972130224f, -0.170492008f, 0.0231541302f, 0.121886559f,
+            0.0680545121f, 0.0437671021f, -0.0665195137f, -0.130157918f, -0.102621838f, -0.0863855854f,
+            0.0513945483f, 0.127254903f, 0.131325036f, 0.110723898f, 0.0973371565f, -0.0331954919f,
+            -0.0574784242f, -0.0112263281f, 0.0305044763f, 0.134531647f, 0.11249692f, 0.0702646449f,
+            -0.00240894291f, -0.00667406106f, 0.11243625f, 0.373744786f, 0.171191946f, -0.134722292f,
+            -0.0507431217f, -0.0142579442f, 0.0102930842f, 0.0372462459f, 0.0219262615f, -0.0459409542f,
+            -0.039420858f, 0.120618522f, 0.162886187f, -0.128877804f, 0.0618004501f, 0.362436205f,
+            0.0585090928f, 0.060559161f, 0.157978594f, 0.012987419f, -0.0299117882f, -0.04077214f,
+            0.0109712603f, -0.0793619975f, -0.157368377f, -0.0515538938f, 0.0216559526f, -0.0656323656f,
+            -0.0147469994f, 0.0845286548f, 0.115963109f, 0.0978088155f, -0.00607048906f, -0.124908589f,
+            -0.139039159f, -0.021139469f, -0.0130673246f, -0.0183244552f, -0.0153928362f, -0.156748027f,
+            -0.336394906f, -0.527035475f, -0.288473219f, 0.308073133f, 0.349137068f, 0.196377322f,
+            0.09286616f, 0.105811544f, 0.0567372628f, 0.0837569237f, -0.329652846f, -0.37990275f,
+            0.156154484f, 0.513966799f, -0.0936734453f, -0.450344294f, -0.0783689246f, 0.0681003854f,
+            -0.0399488211f, -0.138539001f, 0.0603877343f, -0.122886389f, 0.0554045141f, 0.256143302f,
+            -0.202129722f, -0.339245498f, -0.0880203992f, 0.147952378f, 0.0696629286f, 0.0150892092f,
+            -0.0859011337f, -0.15258649f, -0.265562922f, -0.280838281f, -0.296396315f, -0.142189428f,
+            -0.0201213211f, 0.0136995865f, -0.0334707201f, -0.176360622f, -0.313782036f, -0.449819177f,
+            -0.328364044f, 0.277204096f, 0.353844285f, 0.267528385f, 0.126753926f, 0.151319459f,
+            0.0110034244f, -0.0585709736f, -0.356459141f, -0.282986522f, 0.51309973f, 0.297177404f,
+            -0.255617499f, -0.308568925f, -0.157496288f, 0.0760540143f, -0.072942324f, -0.117760278f,
+            -0.0635513067f, -0.199123919f, -0.0398709215f, 0.155524924f, -0.243735299f, -0.389685124f,
+            -0.133114025f, 0.121886835f, 0.0642255098f, 0.021699816f, -0.0514511317f, -0.335111976f,
+            -0.257503629f, -0.259716511f, -0.252088279f, -0.0994747058f, 0.0246652756f, 0.0716663748f,
+            -0.0827911496f, -0.0781494901f, 0.153360069f, 0.312563151f, 0.129443601f, -0.154095635f,
+            -0.110738508f, -0.0025260679f, -0.0318465978f, 0.0424144864f, 0.0409752093f, 0.0318948478f,
+            0.277593344f, 0.200056046f, -0.205408871f, 0.0938800573f, 0.105387405f, -0.0628305003f,
+            -0.0620605387f, -0.00847129524f, -0.122455724f, -0.0193705894f, 0.0622095093f, -0.00558421621f,
+            0.024122918f, 0.0836942792f, 0.0910881981f, 0.0331392325f, 0.0082475869f, 0.0179330669f,
+            -0.00948357023f, 0.00863056909f, -0.012625915f, 0.0409455709f, 0.0601193942f, 0.0156942997f,
+            -0.0709288046f, -0.0966873392f, -0.117003292f, -0.0520886518f, -0.18412593f, -0.174492493f,
+            0.0870092735f, 0.363152832f, 0.0704811662f, -0.0135043841f, 0.0675978214f, -0.0321670286f,
+            -0.0321019106f, 0.124454081f, 0.115215264f, 0.0407689437f, 0.190911427f, 0.141946822f,
+            0.0879336149f, 0.290491402f, 0.0862165764f, -0.165610775f, -0.179633662f, -0.017183654f,
+            0.0690706521f, -0.0337479189f, -0.0268972926f, 0.0287299957f, 0.0563753955f, 0.191575214f,
+            0.145237043f, 0.0605068803f, -0.00311792572f, -0.0853479207f, 0.0122480216f, -0.112786129f,
+            -0.165474325f, -0.103598334f, 0.0205864813f, 0.0840883851f, 0.0948549062f, 0.021740865f,
+            -0.100403972f, -0.0368218534f, -0.397008538f, -0.303375334f, -0.125259027f, -0.113781728f,
+            0.109379105f, 0.0549109615f, 0.111435197f, 0.211588964f, 0.286533624f, 0.0554121658f,
+            0.113615893f, 0.0156083638f, 0.139368162f, 0.191852093f, -0.0238550957f, -0.0618410073f,
+            -0.199753076f, -0.353580862f, -0.358210683f, -0.261945277f, 0.069775559f, 0.0268338397f,
+            -0.108955652f, -0.34533456f, -0.0823502466f, 0.0140954331f, -0.0895968452f, -0.007870798f,
+            0.00239685806f, 0.0378619954f, -0.036664065f, 0.026625596f, -0.140000582f, -0.0549587347f,
+            -0.180215701f, -0.277503401f, -0.0561098307f, 0.0506398007f, 0.0286931414f, -0.111934841f,
+            0.183537513f, 0.170608684f, -0.0278661884f, 0.0345437564f, 0.0850309432f, 0.0881817043f,
+            -0.12325602f, -0.117760472f, -0.142720088f, -0.0395778641f, 0.0385744162f, 0.0100388341f,
+            -0.114463732f, -0.114547931f, -0.0130666988f, 0.0667127222f, 0.124288335f, 0.185178578f,
+            0.20346728f, 0.0848146304f, -0.127799228f, -0.0213413276f, 0.224282146f, 0.0882402807f,
+            -0.140848339f, -0.207440183f, -0.272794396f, -0.219841212f, 0.0254658777f, 0.142377272f,
+            -0.0960364938f, -0.0269556232f, 0.0343770795f, -0.0589430965f, -0.00741275959f, 0.125616863f,
+            -0.0287896432f, -0.361149192f, -0.318436652f, -0.135327876f, -0.166871488f, -0.171561897f,
+            -0.192393124f, -0.0339744762f, 0.233882248f, 0.281963408f, 0.0702131093f, 0.0116588594f,
+            -0.107082911f, -0.0224720873f, -0.0170385856f, -0.00802364759f, 0.0262617003f, 0.395302415f,
+            0.228906438f, -0.0686420947f, -0.140780225f, 0.060584262f, 0.0930132344f, 0.0114690447f,
+            -0.14861773f, -0.115420923f, 0.105286583f, -0.0986975729f, -0.00112626073f, 0.0460569896f,
+            -0.199362203f, -0.0367980301f, 0.244409189f, -0.00788789056f, -0.104475453f, 0.0390025079f,
+            0.0557579808f, 0.0670643151f, 0.0857776031f, 0.224038973f, 0.266819984f, 0.0974141508f,
+            -0.0243312754f, 0.0196743086f, 0.0986380875f, -0.0800508782f, -0.155798897f, -0.0421839356f,
+            -0.011875785f, -0.0498826541f, 0.0177000128f, 0.176421672f, 0.125102565f, 0.0775313079f,
+            0.0886079818f, 0.00465149526f, -0.0732504576f, -0.0255483985f, -0.0368907228f, -0.0751507059f,
+            0.0556537732f, 0.243047729f, 0.11282596f, -0.0460457355f, 0.0380107015f, 0.146584511f,
+            0.283785254f, 0.0627290681f, 0.271804333f, 0.368926525f, 0.0808420703f, -0.0612810068f,
+            -0.0271777883f, 0.0794851407f, -0.087532647f, -0.145514444f, 0.27961731f, 0.285566539f,
+            0.0951760188f, 0.310103655f, 0.16074945f, 0.00241653994f, 0.107137628f, -0.0601214916f,
+            -0.0405575186f, -0.136526138f, 0.075185664f, 0.303070903f, 0.0874427631f, -0.0680022612f,
+            0.0279083382f, 0.0494864993f, -0.214468464f, -0.283393234f, -0.0600931533f, -0.0268525034f,
+            0.161939949f, 0.263080329f, -0.156438276f, -0.237077519f, -0.143863022f, -0.192966387f,
+            -0.138161689f, 0.0461297221f, 0.0226645637f, -0.0549037382f, 0.193170726f, 0.520827055f,
+            -0.0188667644f, -0.202308133f, -0.245300487f, -0.313993722f, -0.103777647f, -0.0932285041f,
+            -0.076455012f, -0.114226922f, 0.151211888f, 0.137852073f, -0.425167531f, -0.524454534f,
+            -0.0754159316f, -0.0176777747f, -0.0891647637f, 0.0328989215f, 0.0777195618f, 0.381652832f,
+            0.3690418f, 0.00533135375f, -0.183273733f, 0.00419919193f, 0.245052814f, 0.0222635455f,
+            -0.0655891746f, -0.0301961936f, -0.179359049f, -0.218695149f, 0.117632344f, 0.263710171f,
+            -0.0365092941f, 0.154660851f, 0.42929545f, 0.0847999081f, -0.0820656568f, -0.0208740197f,
+            0.054955218f, 0.377118737f, 0.304600656f, -0.170458183f, -0.0185856372f, 0.204810828f,
+            0.372947335f, 0.284126759f, 0.00887183379f, 0.161797449f, 0.0011637531f, -0.0498300828f,
+            0.0690944567f, 0.387432724f, 0.456155032f, 0.274218857f, 0.216282308f, 0.155690774f,
+            -0.119690336f, -0.171652317f, -0.0522454306f, 0.142338559f, 0.470982194f, 0.288796455f,
+            -0.0855542868f, -0.095891282f, -0.150849938f, -0.197509363f, -0.18508552f, -0.0801794156f,
+            0.10243576f, -0.0341446809f, 0.0243577939f, 0.17282185f, -0.119533591f, -0.451019138f,
+            0.115408815f, 0.367184848f, 0.0576701276f, -0.189439356f, -0.0511823073f, 0.0597379655f,
+            0.277632505f, 0.0533283316f, 0.223582461f, 0.295734257f, -0.0296385586f, -0.0999972597f,
+            -0.0390214585f, 0.00582744973f, -0.0600283295f, 0.00952752121f, 0.0427659191f, -0.00166298053f,
+            0.322318822f, 0.0720895454f, 0.157456502f, 0.299119234f, -0.0231101234f, -0.0811370984f,
+            0.00101603416f, -0.0627689362f, 0.0418868996f, 0.242361501f, 0.0159542747f, -0.0756443664f,
+            0.0160781574f, 0.060515333f, -0.159951732f, -0.285257339f, 0.11859224f, -0.00293616299f,
+            -0.216014788f, -0.194974869f, -0.107125588f, -0.18075563f, 0.0359445848f, 0.188192785f,
+            0.0291237347f, -0.0288542286f, 0.046509292f, 0.121851526f, 0.110846475f, -0.00207514199f,
+            -0.0879982114f, -0.049824439f, -0.0243946426f, 0.00232818793f, 0.0382051393f, -0.0261464696f,
+            0.0438639596f, -5.05708022e-06f, -0.074376516f, 0.0612366349f, 0.0946397781f, -0.0501051098f,
+            -0.117356479f, -0.0283270814f, -0.0220363028f, -0.0673683286f, -0.234925196f, -0.197638378f,
+            -0.111275539f, -0.0709342211f, 0.190432921f, 0.297253817f, -0.0343279541f, -0.0888371095f,
+            -0.130984619f, -0.0990663543f, 0.0326877795f, 0.00866396166f, 0.0775625631f, -0.0815430656f,
+            -0.00942494068f, 0.109966926f, 0.445014924f, 0.219026268f, -0.0123374658f, 0.0133210104f,
+            -0.0223257877f, 0.118379466f, 0.233842924f, 0.107796691f, 0.010462895f, -0.0184576176f,
+            -0.0514837056f, -0.265127689f, -0.176025957f, -0.0700119361f, 0.020022925f, -0.0899751708f,
+            -0.3254655f, -0.239976808f, 0.0885616392f, 0.0744314566f, -0.0243607741f, 0.0446655117f,
+            -0.00881560333f, -0.0450834036f, 0.0810474455f, 0.0663499534f, -0.11166811f, 0.0901895165f,
+            0.0450056419f, 0.00282677007f, 0.19519946f, 0.0634293854f, -0.194871709f, -0.0355785936f,
+            -0.00243712007f, 0.0575563088f, -0.00584692881f, -0.161213264f, -0.257055074f, -0.116377488f,
+            0.028553877f, -0.0712825805f, -0.0102318786f, 0.00324624428f, -0.0734006092f, 0.0671714619f,
+            0.233989701f, 0.0922799706f, -0.105123408f, -0.246394157f, -0.25496164f, -0.158741474f,
+            0.0495163016f, 0.150127903f, -0.115218684f, -0.19884488f, -0.353865385f, -0.115504436f,
+            0.100227199f, 0.0592473932f, -0.180424765f, 0.00354458718f, -0.0981274918f, -0.113995455f,
+            0.0693544447f, -0.0461920984f, -0.0590443388f, -0.0764624923f, -0.179897264f, -0.0877010748f,
+            0.0559856668f, 0.0361961275f, 0.0120413387f, 0.0530781224f, -0.0575715303f, -0.118813396f,
+            0.00803160295f, 0.144949019f, -0.0489778258f, -0.0452139564f, -0.0716777444f, 0.039994888f,
+            0.108045727f, 0.0487617664f, 0.340425819f, 0.341874123f, 0.174210802f, 0.043564178f,
+            0.161561802f, 0.0554936901f, 0.304729015f, 0.196095183f, 0.0750963762f, -0.0328267738f,
+            0.119305477f, 0.229780987f, 0.206816956f, -0.245120376f, -0.141167298f, -0.131894022f,
+            -0.351264536f, 0.0860062242f, 0.260798931f, 0.16190204f, -0.109607734f, -0.00560140703f,
+            0.125633135f, 0.35408625f, 0.301367134f, 0.233316883f, -0.135978237f, -0.0835488141f,
+            -0.0655257404f, -0.0919951648f, 0.156027123f, 0.135579407f, -0.0939101651f, -0.129585594f,
+            0.276969612f, 0.388744771f, -0.0289438032f, -0.135083362f, 0.0243043881f, 0.144373536f,
+            0.0223907661f, -0.118513741f, -0.147014782f, -0.297553152f, -0.337614447f, -0.199238196f,
+            -0.0162843671f, 0.0183055457f, 0.015933292f, 0.0222997125f, -0.131134674f, 0.0660004243f,
+            0.180333599f, 0.0348581821f, -0.262682855f, -0.151756167f, 0.259349853f, 0.150554404f,
+            -0.192289606f, -0.074193798f, -0.0674537718f, 0.00778154517f, -0.0551175103f, -0.0597500652f,
+            0.0600355156f, 0.033378005f, 0.147175193f, 0.184556842f, 0.10029617f, 0.0399053358f,
+            -0.0814365149f, -0.107299596f, -0.0627182648f, -0.0752021f, -0.0866755247f, -0.098234266f,
+            -0.0186810754f, 0.0885632038f, 0.162119567f, 0.0627583563f, 0.184833035f, 0.105687276f,
+            0.0317760557f, -0.027780395f, -0.0119673926f, -0.00609803852f, 0.0869902372f, -0.00638471032f,
+            -0.0122741582f, 0.0567695461f, 0.135034859f, 0.103337869f, 0.0607129261f, -0.0240530577f,
+            -0.089388907f, -0.0858899355f, -0.0669096783f, -0.0411031246f, 0.0523527227f, 0.028706342f,
+            -0.177907348f, -0.0854898691f, 0.0525603443f, 0.007194818f, -0.155441016f, -0.161110386f,
+            -0.128166139f, -0.0419450551f, 0.23873432f, 0.167845994f, -0.0662965998f, 0.0265757944f,
+            0.0153696816f, -0.119034506f, -0.0898226947f, 0.130200893f, 0.252766728f, 0.275565147f,
+            0.0967631415f, 0.0390775353f, -0.0474004149f, 0.0039552059f, 0.136951908f, 0.0271484572f,
+            -0.0830262303f, 0.16651544f, 0.00168015773f, -0.137796834f, -0.00563262729f, -0.0344749987f,
+            0.0296955705f, -0.0102756554f, 0.0282228906f, 0.0959487557f, 0.0548930503f, 0.170534745f,
+            0.129040867f, -0.104078062f, -0.0757821426f, -0.0165807009f, 0.0973045006f, -0.182241067f,
+            -0.429774612f, -0.109114602f, 0.154231966f, -0.00194041058f, -0.00549593568f, 0.164183438f,
+            -0.0937940404f, -0.142103747f, 0.0455597043f, -0.00880905055f, -0.140027463f, -0.0147593096f,
+            0.138306737f, -0.151193097f, -0.472332031f, -0.170270786f, 0.0524543375f, 0.0158934258f,
+            0.119116537f, 0.104460649f, 0.0658780113f, -0.0925717652f, -0.00428125681f, 0.193413764f,
+            0.204573974f, 0.127973497f, 0.0417628996f, -0.0754668787f, -0.0381525569f, -0.155295715f,
+            -0.0204567071f, 0.085006848f, 0.0401082188f, 0.159745231f, 0.032212656f, -0.234909669f,
+            -0.10664425f, -0.114748076f, -0.452371508f, -0.270657867f, 0.0375433341f, -0.149556935f,
+            -0.132193491f, -0.286999762f, -0.296216667f, -0.225699052f, -0.260131687f, -0.06623023f,
+            0.0539008789f, 0.365329325f, 0.359091669f, 0.138065264f, 0.142971843f, 0.184694946f,
+            0.177125916f, 0.34977138f, 0.319096357f, 0.133367106f, 0.139702365f, 0.155719057f,
+            0.133279234f, -0.0634299964f, -0.0732541084f, -0.0613487139f, -0.0644051656f, -0.126823455f,
+            -0.0769118369f, 0.0625997782f, -0.145405799f, -0.11271479f, 0.064501822f, 0.0666053891f,
+            0.0547316223f, 0.128800437f, 0.163437277f, -0.0160489157f, -0.0793723613f, -0.0972084254f,
+            -0.0784087852f, -0.181278497f, -0.458314687f, -0.192640126f, -0.147783518f, 0.103851207f,
+            0.0835214481f, 0.0700308904f, -0.0432209112f, -0.0762942284f, 0.0405894667f, 0.080497779f,
+            -0.0648406968f, -0.417863518f, -0.0652523264f, 0.130718112f, -0.167413116f, -0.260700107f,
+            0.0771670416f, 0.16772984f, 0.211319879f, 0.126885444f, -0.0630084425f, 0.00955655519f,
+            -0.038379427f, 0.0174483694f, 0.0890621394f, 0.0199466497f, 0.0388868265f, 0.0275829639f,
+            -0.022821445f, -0.111864969f, -0.12800324f, -0.0506970473f, 0.00430698507f, 0.0436833277f,
+            0.0839291587f, -0.061922349f, -0.156131834f, -0.0895864666f, -0.174266011f, -0.106293194f,
+            0.0407256931f, 0.00816684123f, -0.112153508f, -0.0873166025f, -0.273245454f, -0.230358422f,
+            -0.0945937485f, 0.194703043f, 0.0912250206f, 0.141274035f, 0.256559819f, 0.235992312f,
+            0.14068158f, 0.0481453948f, 0.0535157658f, 0.019839f, 0.226963773f, 0.107261673f,
+            -0.0620722473f, 0.157476172f, 0.197078079f, -0.0822994336f, -0.0882001445f, 0.161752924f,
+            0.0538626797f, -0.0868826285f, 0.0459733605f, 0.00951032713f, -0.0296552684f, -0.0561361685f,
+            -0.0758176893f, 0.100289285f, 0.282918632f, -0.0346593149f, -0.0914917886f, -0.00849774573f,
+            -0.0924187005f, -0.0528806075f, -0.193901047f, -0.0474609286f, 0.157419875f, -0.00147516443f,
+            -0.256293267f, -0.148542851f, -0.198591247f, -0.105024844f, 0.289106578f, 0.178332925f,
+            -0.0382602923f, -0.0421958081f, 0.1718788f, 0.358911693f, 0.308080137f, 0.00872114487f,
+            -0.233010709f, 0.0519267321f, 0.0571409054f, -0.0372739732f, -0.126680046f, -0.0786959976f,
+            -0.159969106f, -0.304019958f, -0.289158732f, -0.177395403f, -0.0279351845f, 0.1133001f,
+            0.111267701f, 0.0660566092f, -0.0170061905f, -0.189683035f, 0.0603486076f, 0.306754202f,
+            -0.0555507354f, -0.294690996f, -0.0806129947f, 0.0915415883f, 0.0764223933f, -0.20259808f,
+            -0.0301198773f, -0.0777380541f, -0.0368334129f, 0.018303657f, -0.107234359f, -0.0474296845f,
+            -0.200290263f, -0.310381413f, -0.149956718f, -0.051863227f, 0.0704246759f, -0.183425784f,
+            -0.251582712f, 0.112404898f, 0.111410782f, 0.111016236f, 0.175865427f, 0.0975462869f,
+            0.0341591127f, 0.0560306385f, -0.275637776f, -0.387551457f, -0.101748906f, 0.170877367f,
+            0.11970225f, 0.273193687f, 0.245576352f, 0.254810989f, 0.166060865f, -0.146034062f,
+            -0.00540180644f, -0.0505211614f, 0.0504523478f, -0.0881990343f, 0.0410129242f, 0.433718354f,
+            0.489084631f, 0.2748909f, 0.0115092313f, -0.105948992f, -0.158644438f, 0.0648501068f,
+            0.0415813066f, 0.0600634888f, 0.196508452f, 0.483335495f, 0.426914513f, 0.181058541f,
+            -0.013193341f, -0.0322488025f, 0.173870444f, -0.235035315f, -0.34661305f, -0.1424326f,
+            0.169014215f, 0.393408984f, 0.326753706f, 0.0359832868f, 0.00800931174f, -0.0763392523f,
+            0.0340435989f, 0.289368898f, 0.226724938f, 0.192811877f, -0.0139448494f, 0.0406170078f,
+            -0.0368187763f, -0.223111391f, -0.282898158f, -0.0346589796f, -0.116269588f, -0.146208197f,
+            0.047161296f, 0.374964505f, 0.350284368f, 0.0337013565f, -0.0573285818f, -0.020193832f,
+            0.0392263159f, -0.0299843494f, -0.306301296f, -0.430399001f, -0.112378269f, 0.20926027f,
+            0.227142543f, 0.319850802f, 0.208023176f, 0.263176233f, 0.158949628f, -0.181242138f,
+            -0.121086113f, -0.0324273445f, 0.178258374f, 0.507714033f, 0.574748158f, 0.130643502f,
+            -0.06648013f, 0.0541793853f, 0.00228354963f, 0.00186758314f, 0.128814146f, -0.0306302551f,
+            -0.0147585943f, -0.0319487266f, -0.158182949f, -0.381454676f, -0.325990945f, -0.109133206f,
+            -0.00396031095f, -0.0168124624f, 0.0520433746f, 0.045283556f, -0.010601718f, -0.142624497f,
+            -0.370046586f, -0.187831074f, 0.0413067937f, 0.268596262f, 0.184086606f, -0.0511029921f,
+            0.0115166754f, -0.254154086f, -0.219279796f, -0.134678617f, 0.0968891829f, 0.00440072129f,
+            -0.0410550945f, 0.115979463f, 0.189317554f, -0.0131380251f, 0.0503423326f, 0.0114764161f,
+            -0.125848636f, -0.00884039048f, -0.00125393015f, -0.237172469f, -0.309905827f, -0.125272304f,
+            -0.0038730849f, 0.0701572299f, 0.0115389945f, -0.190889329f, -0.149643049f, 0.0428198874f,
+            -0.0957042873f, -0.253439933f, -0.00976040028f, 0.0996455923f, 0.0490465499f, 0.0262805f,
+            0.0594052859f, -0.109046146f, -0.258691281f, -0.0484676026f, -0.0918307975f, -0.0534311347f,
+            0.0751704723f, 0.145929754f, 0.128848284f, 0.0882282183f, -0.0785671026f, 0.00272891182f,
+            -0.0432025306f, -0.110673919f, -0.0726249367f, -0.0247304998f, -0.100277029f, -0.102691658f,
+            -0.0693556368f, -0.0327596515f, 0.0580367483f, -0.0156984758f, 0.00481021963f, 0.182347834f,
+            0.0331190266f, 0.059150435f, 0.076467514f, -0.0049135536f, -0.00257469784f, 0.0728256553f,
+            -0.207205787f, -0.222707003f, -0.0133879036f, -0.31676811f, -0.506880641f, -0.280143052f,
+            0.0736214742f, 0.222118512f, 0.276151717f, 0.100735165f, 0.248656914f, 0.13171415f,
+            -0.390881568f, -0.312923193f, -0.503210247f, -0.0360051543f, 0.0192383025f, 0.0505151078f,
+            0.240723714f, 0.156048685f, -0.120796084f, -0.0914625973f, -0.11166773f, 0.0943394452f,
+            0.104755469f, 0.188046575f, 0.291761011f, 0.169844165f, 0.0860525891f, 0.0575688258f,
+            -0.0418400988f, -0.0415463001f, -0.164091706f, -0.300419629f, 0.261517644f, 0.043025028f,
+            -0.0974154398f, -0.0693623573f, -0.0653118566f, 0.0767383203f, -0.140599445f, -0.055622045f,
+            -0.0198172983f, 0.0410326459f, 0.00227923482f, -0.129746765f, -0.0654851347f, -0.173932776f,
+            0.26250115f, 0.61249274f, -0.10104695f, 0.01604685f, -0.0422826298f, -0.151149526f,
+            -0.0712999925f, -0.026725648f, 0.159012914f, 0.0505984798f, 0.31834954f, 0.591845632f,
+            -0.0122656301f, -0.0679379925f, -0.0165513735f, 0.103218518f, 0.211410955f, -0.0373981036f,
+            -0.193895429f, -0.082351312f, -0.0489520878f, -0.0482809693f, 0.0787139907f, 0.0127539746f,
+            0.0692480206f, 0.0787032247f, 0.124789894f, -0.0868313238f, 0.116910771f, 0.217325479f,
+            0.0856775194f, -0.0468231477f, 0.0596302375f, 0.0789819211f, -0.174696103f, -0.521099389f,
+            -0.612421989f, -0.0244710147f, 0.349300295f, 0.0153343873f, 0.0015972195f, -0.0355206355f,
+            -0.0109228212f, -0.00947303977f, 0.00793820247f, -0.286244184f, 0.121573366f, 0.398722321f,
+            -0.57687813f, -0.468418151f, -0.0275322217f, 0.0457988754f, 0.040890988f, 0.058706779f,
+            -0.0831525624f, -0.158478975f, 0.016019972f, -0.0191314071f, -0.213116556f, -0.44554165f,
+            -0.332598746f, 0.367026061f, -0.0371510424f, -0.0237998832f, 0.0273411814f, 0.162867725f,
+            -0.0606681705f, -0.35465005f, -0.388101697f, 0.0583628751f, 0.414714783f, 0.205748335f,
+            -0.0253466982f, -0.0211938787f, -0.0740560293f, -0.303717732f, -0.38007763f, -0.226997972f,
+            0.117075637f, 0.431238115f, 0.271797031f, -0.102794684f, 0.0421492346f, 0.251746356f,
+            0.0716334134f, -0.349315584f, 0.308067381f, 0.510955215f, 0.109700643f, -0.10431125f,
+            -0.0657388046f, -0.0582920909f, -0.0267213769f, 0.0158082955f, -0.0354596525f, -0.0543369055f,
+            -0.234944269f, -0.0434185378f, 0.186795056f, -0.168061584f, -0.196302146f, 0.142658859f,
+            -0.016459113f, 0.0531661361f, -0.0157768354f, -0.212088853f, -0.0677346364f, -0.063063778f,
+            -0.279910415f, -0.120751016f, 0.065860495f, 0.173549876f, -0.220907658f, -0.125672817f,
+            0.035489589f, -0.000144275808f, -0.157074019f, -0.0713635981f, 0.157991558f, 0.093049638f,
+            0.115034103f, 0.108865172f, -0.078482762f, 0.0217522401f, 0.011307098f, -0.020406913f,
+            0.10717684f, -0.0120068705f, -0.230659395f, -0.23007378f, -0.164440542f, -0.0483321622f,
+            0.00492918072f, -0.0406137407f, -0.026796151f, 0.0355841517f, 0.120582402f, 0.0202309135f,
+            -0.000257606502f, 0.115392469f, 0.120329097f, -0.0662598982f, 0.00789422262f, -0.031510096f,
+            0.032486625f, 0.128703997f, 0.0628449768f, 0.111827105f, 0.0602584556f, 0.0158646051f,
+            -0.0716350898f, -0.081534937f, 0.159358561f, 0.0607924312f, 0.116253234f, -0.052642528f,
+            -0.279482156f, -0.120845295f, 0.0535505004f, -0.0807586089f, -0.00150980952f, -0.0312498491f,
+            0.00427345466f, 0.0121330759f, -0.0263716206f, -0.0470931455f, 0.0103780273f, -0.2121806f,
+            -0.118176915f, 0.162366599f, 0.207450598f, 0.129952922f, -0.129451513f, -0.00194525602f,
+            0.00984116644f, -0.0476330854f, -0.0854005441f, 0.00931658782f, 0.0254199207f, 0.0506193638f,
+            0.0765412375f, 0.0897261724f, -0.0294639524f, 0.00662569003f, -0.0502992719f, -0.0496170856f,
+            -0.0110900523f, -0.108304702f, -0.0470934287f, -0.00848609861f, -0.0590500645f, -0.141744912f,
+            -0.281373322f, -0.178364575f, -0.382080108f, -0.392500758f, -0.129996508f, -0.0106575042f,
+            0.0296226889f, 0.118515842f, 0.0832530484f, 0.0173879247f, -0.00269002537f, -0.118290365f,
+            -0.0202102587f, 0.0989779606f, -0.00264523807f, -0.138615921f, 0.123507127f, 0.135123f,
+            -0.214923248f, -0.571896851f, -0.0630517229f, 0.0291543249f, 0.379898399f, 0.519657969f,
+            0.49249056f, 0.139833033f, -0.146850035f, -0.174850851f, -0.116758071f, -0.0580791272f,
+            -0.0818886235f, -0.0335922092f, 0.107380532f, 0.063563399f, 0.010395322f, 0.401833296f,
+            -0.117885046f, -0.342654318f, 0.12180803f, 0.647539258f, 0.127007633f, 0.17563279f,
+            0.10215573f, -0.129256532f, -0.0918790251f, -0.000172392276f, -0.0925871283f, -0.197839186f,
+            -0.204822481f, -0.0760719702f, 0.0566122942f, -0.0201951284f, -0.0659270734f, -0.266927779f,
+            -0.232931033f, -0.0897426158f, 0.0264297388f, 0.0893524587f, 0.0953285247f, 0.136837244f,
+            0.0837028623f, 0.245249882f, 0.0120795565f, -0.0457295626f, -0.0863694623f, -0.132918894f,
+            -0.176869228f, -0.196598515f, -0.1777284f, -0.232013524f, -0.0410322659f, 0.0865907222f,
+            0.0644463897f, -0.258333921f, -0.233177677f, 0.0619547293f, 0.174618676f, 0.155901f,
+            0.107454941f, 0.212707117f, 0.199516505f, 0.210912615f, 0.146879852f, -0.0913010165f,
+            -0.0575922392f, -0.0437816828f, 0.114787087f, 0.142419741f, 0.0687827989f, 0.106213413f,
+            0.204204485f, 0.131277844f, 0.139181882f, 0.0784937292f, -0.148645952f, -0.226917952f,
+            -0.0496511534f, 0.0640737265f, 0.00282486272f, -0.0653744265f, -0.128851041f, -0.277714819f,
+            -0.146362305f, 0.0306650586f, -0.104983382f, 0.0194690563f, -0.156190217f, -0.272715926f,
+            -0.114367329f, 0.202221945f, 0.0237361807f, -0.0468363985f, -0.0551874973f, -0.00684911292f,
+            0.0830034763f, 0.184532478f, 0.0302974526f, -0.147975162f, -0.319938153f, -0.3290402f,
+            -0.0495868437f, 0.0458023585f, -0.0914320871f, 0.0217869971f, 0.181646526f, 0.329394639f,
+            0.164297491f, 0.0441748947f, 0.304332435f, 0.175778791f, -0.0916380137f, 0.0831975639f,
+            0.103086308f, 0.265787065f, -0.0401777029f, -0.070175007f, -0.223192871f, 0.206849039f,
+            0.331075221f, -0.0448209606f, -0.0500145182f, 0.0917736739f, 0.156006515f, 0.0332802944f,
+            0.0266659372f, -0.0710192174f, -0.0487071276f, 0.189220607f, 0.128491625f, -0.079961434f,
+            -0.0454404652f, -0.0291864183f, 0.0253403336f, -0.138427094f, -0.0666576177f, -0.0394914001f,
+            -0.0814927518f, -0.0398653597f, 0.0844233856f, 0.243153691f, -0.152605638f, 0.0330739953f,
+            0.0245541874f, -0.0775808021f, -0.273698151f, 0.307626843f, 0.33763364f, -0.111764058f,
+            -0.0829470456f, 0.499299854f, 0.171765938f, 0.184444696f, 0.045779936f, 0.144876406f,
+            0.413613439f, 0.1266229f, 0.190562963f, 0.49900049f, 0.0741968378f, -0.136669397f,
+            -0.0104800826f, 0.0673180297f, 0.28807953f, 0.198806375f, -0.112397596f, -0.0264056604f,
+            -0.0347548127f, -0.0113206329f, 0.0748987496f, -0.00287189637f, -0.0060738204f, -0.00840091892f,
+            0.0607389733f, -0.0588167422f, 0.0113328788f, 0.322855949f, 0.142304584f, -0.120416485f,
+            -0.0287208464f, 0.0156155834f, -0.15730761f, -0.0120061906f, 0.383354247f, 0.180342108f,
+            -0.424464673f, -0.0396143906f, 0.123540767f, 0.250905633f, 0.000609925482f, 0.212509364f,
+            0.104531512f, 0.0894309655f, 0.0291917138f, 0.0530574061f, 0.111152612f, 0.382017821f,
+            0.538527071f, 0.136805594f, 0.0445417315f, -0.133768603f, 0.15596503f, 0.064159885f,
+            0.055988159f, 0.0357547514f, 0.0543159954f, -0.0420443527f, -0.0174721852f, 0.213001654f,
+            0.12921524f, -0.153313369f, -0.0491701216f, -0.0617689863f, -0.124040149f, -0.0934254378f,
+            -0.0692836642f, 0.129527569f, 0.0446851701f, -0.232696518f, 0.0298886988f, 0.120359465f,
+            -0.0247118697f, -0.0485408604f, 0.271466136f, 0.309806645f, -0.0711874291f, 0.26010111f,
+            0.442148298f, 0.384285271f, -0.134488329f, 0.081130974f, -0.100498691f, -0.155055776f,
+            -0.266918391f, 0.221927091f, 0.4302333f, 0.29170537f, 0.295941979f, 0.235065103f,
+            -0.136898041f, -0.163677767f, 0.0694548264f, 0.00611213548f, -0.1564935f, -0.178497106f,
+            -0.0524132326f, 0.0478758439f, 0.0983752459f, 0.131108209f, 0.0736958757f, -0.00439493405f,
+            -0.0260302424f, -0.0586437955f, -0.0722153038f, -0.199116483f, 0.0827536881f, 0.135022819f,
+            -0.0977343544f, -0.120330118f, 0.0103556933f, 0.0192989241f, 0.0611449778f, -0.0245817527f,
+            -0.384088248f, -0.615266204f, -0.155352548f, -0.170679346f, -0.225273341f, 0.134902313f,
+            0.132472306f, -0.0866613388f, 0.0987941995f, 0.0666254535f, 0.0523702726f, -0.458199918f,
+            -0.195855871f, 0.164097309f, -0.253150225f, -0.465851784f, 0.244392931f, 0.211384848f,
+            0.224304155f, 0.231787428f, 0.124628074f, -0.01518822f, 0.181639418f, -0.0726522952f,
+            -0.0592325665f, -0.00500501739f, 0.155218825f, -0.151087239f, -0.119013593f, -0.0990293622f,
+            -0.15444383f, -0.00888136122f, -0.229183093f, -0.272324234f, -0.0741217062f, -0.0637785792f,
+            -0.148718432f, 0.0475238338f, -0.0309020355f, -0.0675425753f, -0.246916756f, -0.160335913f,
+            0.136838004f, -0.0610133708f, -0.16887413f, -0.105876468f, -0.179893687f, -0.364792109f,
+            0.0696695372f, 0.238623381f, 0.0892658159f, -0.302764118f, -0.315932006f, -0.0719300583f,
+            -0.0953072757f, -0.100080378f, 0.12088789f, 0.140261009f, 0.00112271751f, 0.0232091658f,
+            0.0833072215f, 0.196003363f, 0.0782657266f, -0.11287389f, -0.167717934f, -0.0749350116f,
+            0.00575858215f, -0.00214079046f, 0.0233881269f, 0.136704773f, -0.0091984868f, 0.0351398513f,
+            0.0859352276f, -0.180995852f, -0.131275848f, -0.0360208116f, -0.115822881f, -0.0768174082f,
+            0.168640494f, 0.162874609f, 0.130671531f, 0.280841559f, 0.294196129f, 0.0548405908f,
+            -0.276016176f, -0.332847565f, -0.0684885234f, 0.214142159f, -0.0702559352f, 0.00804191269f,
+            -0.215602055f, -0.188607842f, -0.0110017713f, -0.152727082f, -0.265388787f, -0.262997061f,
+            -0.414128929f, -0.237461329f, -0.0727095306f, -0.16940476f, -0.218632147f, -0.187507406f,
+            -0.330944031f, -0.513760269f, -0.157027006f, 0.09204299f, 0.110064708f, -0.0431875512f,
+            -0.142643899f, -0.176980957f, -0.350304961f, 0.0603032261f, -0.153635517f, -0.145937964f,
+            0.383770049f, 0.341387153f, -0.00113492692f, -0.225341484f, 0.28642416f, 0.129299685f,
+            0.156646624f, -0.0666137487f, -0.0427853055f, -0.0407550819f, 0.0953343213f, 0.348129034f,
+            0.137589172f, 0.0654634386f, 0.1351486f, 0.0775830299f, 0.0957432091f, -0.0257132947f,
+            -0.16202414f, -0.316320181f, -0.228231475f, 0.13980712f, 0.159942091f, -0.164570481f,
+            0.00566532509f, -0.0681734681f, 0.146697313f, -0.250504851f, -0.436903089f, -0.257634878f,
+            -0.108678386f, 0.0259384885f, -0.00293507497f, 0.0556815118f, 0.164814219f, -0.00244958559f,
+            -0.0880245194f, -0.0272730514f, -0.4586263f, -0.213923261f, 0.188311145f, 0.0116091967f,
+            -0.0974074528f, -0.157981634f, 0.0540190451f, 0.0325647034f, 0.18969962f, -0.058511205f,
+            0.0327999219f, 0.0340729356f, 0.166808531f, 0.206284583f, 0.108592972f, -0.0784189478f,
+            -0.0644790828f, -0.00754489703f, -0.00695453305f, -0.0946149454f, -0.060870111f, -0.220798314f,
+            -0.169084996f, 0.0346154533f, 0.0894278213f, 0.174608156f, 0.175312579f, 0.155332476f,
+            0.0176390242f, -0.0552892052f, 0.0510965064f, -0.02456134f, -0.0736208335f, -0.0363407396f,
+            0.00747616123f, 0.0380463451f, 0.0131818224f, 0.0454301052f, 0.184427291f, 0.153082997f,
+            -0.0157961324f, -0.0548002869f, 0.0430109352f, 0.0470081605f, 0.0382135175f, 0.0350835994f,
+            -0.10439039f, 0.0796512291f, 0.222304448f, -0.0512432866f, -0.0409974605f, -0.166670278f,
+            -0.00223530526f, 0.400487572f, 0.304760396f, 0.21607776f, -0.127501503f, 0.0825829133f,
+            0.0588675477f, -0.213301376f, -0.190675676f, -0.183051407f, -0.096137099f, -0.0721066818f,
+            0.0836631581f, 0.48514396f, -0.0158696026f, -0.0108886482f, -0.0494007729f, -0.0059835352f,
+            0.169722587f, 0.0593410656f, -0.157748342f, -0.161777452f, 0.146558091f, 0.215231687f,
+            -0.0718211606f, 0.0462648347f, 0.146856621f, 0.103954442f, 0.0437808186f, 0.0103155086f,
+            0.144002065f, 0.219787866f, 0.202334091f, 0.0485442616f, -0.127789497f, -0.142450795f,
+            -0.131482273f, 0.130485192f, 0.233163849f, -0.0597788058f, -0.2481675f, -0.0792311355f,
+            -0.0637268946f, 0.385275871f, 0.0614939816f, 0.141351387f, 0.12850751f, 0.0957908556f,
+            -0.198783353f, -0.180339649f, 0.16810365f, 0.354562134f, 0.263245523f, -0.0669193417f,
+            -0.0830428749f, 0.0343871601f, -0.131548971f, -0.0764593482f, 0.0834020153f, -0.11105749f,
+            -0.102263235f, 0.042602405f, -0.229406819f, -0.196588099f, 0.0592862591f, 0.00148346694f,
+            -0.0173848532f, -0.0363353156f, -0.110322408f, -0.283638775f, -0.142900229f, -0.107010663f,
+            -0.0706193298f, -0.139449418f, -0.0176153369f, -0.210750252f, -0.0905391648f, 0.0138127152f,
+            0.115142882f, -0.341427416f, -0.44333455f, -0.206875414f, -0.2103962f, 0.0308738817f,
+            -0.132894084f, -0.00326770358f, 0.243114904f, 0.177484572f, -0.2486981f, -0.159068555f,
+            0.202280939f, 0.272022426f, 0.336202502f, 0.210073277f, -0.0163987819f, 0.235984415f,
+            0.0543442406f, 0.22936441f, 0.386835724f, -0.0650165826f, -0.0567230508f, 0.0678064302f,
+            0.154734939f, 0.190874949f, 0.147620514f, 0.0558913387f, 0.0151325483f, 0.148489892f,
+            -0.362127841f, -0.180007383f, 0.0898602009f, -0.206139654f, -0.120632708f, -0.240261301f,
+            -0.039931763f, -0.0156157259f, 0.404273361f, 0.57479471f, 0.443357259f, 0.127836928f,
+            -0.340466589f, 0.0362630412f, -0.016503565f, -0.0664027631f, -0.0707111433f, -0.0933106467f,
+            0.20522812f, 0.640560746f, -0.3664307f, 0.0282784961f, 0.377330184f, 0.231538966f,
+            -0.179769367f, -0.0310865417f, -0.375041991f, -0.217640117f, -0.0878988728f, 0.045309063f,
+            -0.0330603458f, 0.0507134013f, 0.0278586466f, -0.173118576f, -0.114478327f, -0.19825992f,
+            -0.152302384f, 0.0419216305f, 0.296999067f, 0.126830712f, 0.110927619f, -0.154363722f,
+            -0.309119195f, 0.009976428f, -0.0312318541f, -0.150384337f, -0.0341474935f, 0.0832880288f,
+            -0.074824594f, -0.206371307f, 0.0377455801f, 0.110702612f, 0.188050821f, 0.359677285f,
+            0.191361725f, 0.192257106f, 0.0306436718f, -0.0150094545f, -0.329875946f, -0.364694864f,
+            0.0802850649f, 0.0502887443f, -0.00755792018f, -0.120505668f, -0.148434594f, -0.140401363f,
+            0.160833478f, 0.132216275f, 0.055381611f, -0.0307183843f, -0.117717229f, -0.147232428f,
+            -0.0423060097f, 0.0316159204f, 0.130663991f, -0.0800650418f, -0.0246698763f, -0.103395455f,
+            -0.115350626f, -0.0282259919f, -0.0942110419f, -0.159062311f, -0.136927083f, -0.00995342433f,
+            0.124480382f, 0.123471394f, -0.466160417f, -0.243676573f, -0.0738159195f, 0.195041999f,
+            0.09734153f, -0.155041203f, -0.184964299f, -0.0289230011f, 0.181595683f, 0.464901954f,
+            -0.0695306733f, 0.0297337063f, 0.252904654f, 0.287871301f, 0.393853128f, 0.168116495f,
+            -0.343535423f, -0.161545992f, -0.0721826628f, -0.390627116f, 0.158828765f, 0.126465604f,
+            0.142559156f, 0.0231186189f, -0.176175863f, -0.340081871f, -0.0825678259f, 0.00276959408f,
+            0.190376908f, 0.0549133569f, -0.00166948885f, -0.149374202f, -0.151604161f, 0.0491984002f,
+            0.0392913334f, -0.294494241f, -0.304809898f, 0.0164156761f, 0.141635031f, 0.075005658f,
+            0.24469538f, 0.125306919f, 0.00251298025f, -0.0849271789f, -0.010820793f, -0.0625820681f,
+            0.187651441f, 0.400121838f, -0.0170367118f, -0.399583489f, 0.0133961933f, 0.0707999915f,
+            0.111231305f, -0.0346966237f, -0.0311889891f, -0.2085554f, 0.0505426005f, 0.437151611f,
+            0.395222068f, 0.170308307f, -0.218271121f, -0.122413017f, -0.0285092592f, -0.00685369875f,
+            -0.187831834f, -0.0647136793f, 0.132068902f, 0.244808301f, 0.312025845f, 0.138303697f,
+            -0.0275897402f, 0.0398706309f, 0.141604021f, 0.332804054f, 0.202008978f, -0.098563388f,
+            0.0221747123f, 0.119259268f, -0.054531496f, -0.308942258f, 0.050483264f, -0.0283964109f,
+            0.152286276f, 0.29061237f, 0.181253582f, 0.145534649f, 0.137039378f, 0.0607055835f,
+            0.053144861f, 0.0563768148f, -0.190867335f, -0.0229913164f, 0.202514321f, 0.0912923515f,
+            0.0719811693f, -0.0260055661f, -0.220142439f, -0.0918157697f, -0.00751619739f, 0.210689977f,
+            0.0227160063f, 0.269349068f, 0.261666298f, -0.214593619f, -0.311147898f, -0.438401133f,
+            -0.321940541f, -0.567831993f, -0.333805561f, 0.307128668f, 0.0742419437f, 0.0991716459f,
+            0.15101558f, -0.0460331924f, -0.297519982f, -0.439684242f, -0.534687877f, -0.603307903f,
+            -0.206672847f, 0.306151986f, -0.098260738f, 0.131962597f, 0.0996839032f, -0.0322038159f,
+            -0.0706291199f, -0.0286569241f, 0.104938567f, 0.212687373f, 0.349691868f, 0.554939628f,
+            0.108936831f, -0.000195696703f, -0.129095495f, -0.0746143684f, -0.0455729812f, 0.00478297751f,
+            0.0192388538f, -0.148142532f, -0.413296133f, -0.548646867f, -0.179163128f, -0.0337566622f,
+            0.3999376f, 0.38036713f, 0.264275402f, 0.346463263f, 0.459169149f, 0.312366754f,
+            0.0904545039f, 0.242843196f, -0.174562573f, -0.255370319f, -0.192135483f, 0.268879861f,
+            0.401117086f, 0.267134219f, 0.254356682f, 0.379957467f, -0.242404088f, -0.445344478f,
+            -0.0251180232f, -0.23002544f, -0.396517783f, -0.205520391f, -0.135201693f, -0.224470988f,
+            -0.45520547f, -0.226034835f, -0.113890722f, -0.201071426f, 0.0904099569f, -0.200724185f,
+            -0.0839537606f, -0.053521011f, -0.00928357709f, 0.184411898f, 0.353807181f, 0.481432557f,
+            0.250709057f, -0.347988874f, 0.156171128f, -0.0702482685f, -0.0902141407f, 0.113618918f,
+            0.135752186f, 0.212601498f, 0.338358134f, 0.378953427f, 0.387582779f, 0.0291479435f,
+            -0.0263791829f, 0.0754858628f, -0.060488496f, 0.00471101841f, 0.237554848f, -0.0909993649f,
+            -0.369219869f, -0.385736823f, -0.180982471f, 0.36125201f, 0.249933138f, 0.345503211f,
+            0.191463411f, -0.17757076f, -0.108490728f, -0.0919004828f, 0.0335013904f, 0.066148147f,
+            0.00449184841f, 0.0635074601f, 0.00872260332f, 0.0861103982f, 0.143195599f, 0.0354648978f,
+            -0.181295484f, -0.318474412f, -0.137464672f, 0.131109953f, 0.0723332316f, 0.273732722f,
+            -0.0113369962f, -0.10475295f, -0.0188161898f, -0.0966221243f, 0.0106905447f, 0.0257234368f,
+            0.163721696f, 0.175911725f, 0.123361737f, 0.178244844f, -0.142645285f, -0.188700587f,
+            -0.0394187421f, -0.0625469163f, -0.162330434f, -0.0378736816f, 0.180551454f, 0.0317673795f,
+            0.0590823144f, 0.000896387268f, -0.0565415472f, -0.244507402f, -0.401380211f, -0.381296396f,
+            -0.339838892f, -0.0184326041f, 0.180402681f, 0.218582511f, 0.211746395f, 0.0806971639f,
+            -0.430905551f, -0.508569181f, 0.105128929f, 0.127167076f, -0.167705506f, -0.0722564682f,
+            0.294088989f, -0.0584557466f, -0.14845933f, -0.0117733497f, -0.136296481f, -0.142532989f,
+            -0.0210532453f, 0.169066235f, 0.173591703f, 0.00119759922f, 0.0237911697f, 0.156546608f,
+            0.143185437f, 0.04514594f, 0.0374811552f, -0.0312032066f, -0.137203798f, -0.0355424397f,
+            0.0559436977f, 0.214812443f, 0.223789692f, 0.109628446f, 0.105111055f, -0.027898781f,
+            0.142213196f, 0.0468631759f, 0.250259012f, 0.358800888f, 0.359643221f, 0.122521624f,
+            -0.0241246894f, -0.0523096584f, -0.147938102f, 0.0803244188f, 0.400259644f, 0.238711759f,
+            -0.146196902f, -0.188331053f, 0.226079538f, 0.210318103f, -0.110814713f, 0.0597469434f,
+            0.0570900813f, 0.0362137593f, 0.224189892f, 0.104699135f, 0.181384951f, -0.0021836462f,
+            -0.212587237f, -0.100331858f, 0.00678364513f, -0.108579509f, -0.0131282574f, 0.0235114396f,
+            0.0823319778f, 0.257776529f, 0.190804169f, 0.0536749214f, -0.103466846f, -0.166372418f,
+            -0.0483605377f, -0.0747400448f, -0.0460564867f, 0.0316709317f, 0.155359313f, 0.174921393f,
+            0.031467434f, 0.0707803369f, 0.245124429f, 0.0645848513f, -0.267474353f, -0.139622301f,
+            -0.14592655f, -0.244853541f, 0.0230552461f, 0.0510520674f, 0.255228847f, 0.277619302f,
+            0.258926898f, -0.217656955f, -0.0679709613f, 0.160765067f, -0.0694664866f, 0.0470657498f,
+            -0.0710998327f, 0.0142435906f, -0.0100161536f, 0.310739368f, 0.229243949f, 0.179663181f,
+            -0.0305062924f, -0.412060529f, -0.346027374f, 0.142486066f, 0.16561082f, 0.087742269f,
+            0.130401269f, 0.0715450421f, -0.40739134f, -0.474129975f, 0.0874677002f, 0.0889623091f,
+            -0.121658675f, -0.13830848f, -0.075782381f, 0.0890794024f, -0.0947962627f, -0.206655726f,
+            -0.309921682f, -0.114152998f, 0.133357048f, -0.191189095f, -0.173598662f, 0.0939268842f,
+            -0.0375794582f, 0.0610581972f, -0.069083795f, -0.319997013f, -0.259873897f, 0.0555050373f,
+            -0.212336272f, -0.189559162f, 0.0385471322f, 0.0481459536f, 0.0142411422f, -0.0705754012f,
+            0.054822661f, 0.482306689f, 0.57568419f, 0.00617123442f, -0.379947931f, -0.137212783f,
+            -0.110196084f, 0.0956304669f, 0.0431321971f, -0.00623448892f, 0.391123801f, 0.488421798f,
+            -0.15623951f, -0.471855223f, 0.284181535f, 0.165807933f, 0.0771026462f, 0.0452568531f,
+            -0.1443948f, -0.108130045f, -0.0198907685f, 0.210135758f, 0.0759910941f, 0.00759879267f,
+            0.107111417f, 0.37454915f, 0.286557853f, -0.271471053f, -0.160483897f, -0.271562934f,
+            -0.150171638f, 0.32683897f, 0.370910674f, 0.0762102082f, -0.00915176515f, -0.0307062604f,
+            -6.49860158e-05f, 0.131197587f, -0.118836425f, 0.106738925f, 0.212508693f, 0.329631537f,
+            0.076681219f, 0.217696398f, 0.299862176f, -0.044948183f, 0.456961066f, 0.139804661f,
+            0.607156396f, -0.252168149f, -0.0955329761f, 0.0324007422f, 0.223494977f, 0.0390560292f,
+            -0.0102961492f, -0.22905235f, -0.0466684997f, -0.0653605834f, 0.102605671f, 0.081297338f,
+            0.0151668545f, 0.0274943281f, -0.072041817f, 0.154677197f, 0.275652438f, 0.149250478f,
+            -0.0742352903f, -0.564683318f, -0.28558898f, -0.452906072f, -0.23013103f, -0.30484578f,
+            0.150956169f, 0.0904077888f, 0.0616494119f, -0.0488391891f, -0.00135400426f, 0.0122896126f,
+            0.143047154f, 0.0473214574f, 0.0170925818f, 0.072744213f, 0.336603373f, 0.083220683f,
+            -0.167646885f, 0.0414615385f, 0.000282572379f, -0.0542577021f, 0.0335727371f, -0.128171995f,
+            0.0882028788f, 0.0946813226f, -0.14258793f, 0.0308042318f, 0.33002606f, 0.0234826487f,
+            0.123037755f, 0.03309213f, -0.127346098f, -0.0906568244f, -0.0936918631f, -0.286509275f,
+            -0.54402411f, -0.161776036f, 0.154477909f, 0.225174516f, 0.18050842f, 0.0568710268f,
+            -0.0586969778f, 0.322852582f, -0.00852739625f, -0.137991309f, 0.0880989134f, -0.283294261f,
+            -0.370778799f, -0.251740992f, -0.228801697f, 0.282504112f, 0.010848986f, 0.175730765f,
+            0.126202598f, -0.09906286f, 0.0506086014f, 0.242520571f, 0.0443483554f, -0.121978208f,
+            -0.0640474483f, -0.062046431f, 0.0564622357f, -0.0838020071f, -0.140183985f, -0.108418941f,
+            0.00628005248f, 0.0843125805f, 0.109012388f, 0.190140188f, 0.214609638f, -0.00741548976f,
+            0.0989604741f, 0.118045233f, 0.175951853f, 0.270865023f, 0.252870589f, -0.137980014f,
+            -0.353774428f, -0.337768912f, -0.131184503f, 0.241029039f, -0.315176576f, -0.270084202f,
+            -0.364988267f, -0.191233531f, -0.0940267146f, 0.0257918891f, 0.0842606202f, -0.400403976f,
+            -0.0809773728f, 0.00548949838f, -0.0521030352f, -0.0948635563f, -0.177555457f, 0.12748605f,
+            0.259563029f, -0.0158299524f, -0.147406369f, -0.134832412f, -0.128304049f, -0.414530784f,
+            0.0164328497f, 0.0907257944f, 0.017055111f, 0.0134970872f, -0.14155893f, -0.422126323f,
+            -0.137326524f, -0.0536396094f, 0.297796249f, 0.194164634f, -0.116971605f, -0.0551768169f,
+            0.0552767664f, 0.133890465f, -0.14337036f, -0.250952065f, -0.169017538f, -0.182509288f,
+            0.0223874096f, 0.0771770626f, -0.0408782549f, 0.0558353178f, -0.0381346531f, -0.273225784f,
+            -0.131190449f, 0.105127133f, 0.168644711f, 0.0876100436f, 0.0461210348f, 0.205361918f,
+            -0.163460627f, -0.0245220866f, 0.415732533f, 0.59999162f, 0.104436606f, 0.245290488f,
+            0.31382513f, -0.00967761409f, -0.1257063f, 0.162668675f, -0.118969366f, -0.208270326f,
+            0.221253321f, 0.517599046f, 0.0540765151f, 0.0816367269f, 0.569392562f, 0.11627084f,
+            -0.178543478f, -0.135927066f, -0.0492609888f, -0.00925298315f, -0.0100102667f, -0.132856146f,
+            -0.131141439f, 0.0418566316f, 0.182530373f, 0.272020519f, 0.034209691f, 0.176273823f,
+            -0.0242658779f, 0.014327012f, -0.0384155884f, -0.0384451598f, 0.159851044f, 0.322863698f,
+            -0.00306814746f, -0.15685223f, -0.126787975f, 0.0673803762f, 0.0430344306f, 0.0471176021f,
+            -0.297529131f, -0.196107924f, 0.0854825154f, -0.269414246f, -0.394155711f, -0.250664473f,
+            0.329033881f, 0.0961778611f, -0.0238677263f, 0.312884539f, -0.0939078182f, -0.242900655f,
+            -0.0670349151f, -0.351252675f, -0.374740571f, 0.0816997737f, 0.323986173f, 0.0204889644f,
+            -0.14453508f, -0.096195519f, 0.20550774f, 0.208557427f, 0.0258716866f, -0.0337628797f,
+            -0.189652383f, -0.244448096f, -0.117402665f, 0.0425404534f, -0.083854109f, -0.068668738f,
+            0.152193055f, 0.198405534f, -0.0080517251f, -0.18416132f, 0.0987223163f, 0.321680307f,
+            0.0831981376f, 0.024453951f, -0.112293273f, 0.0333023258f, 0.413346857f, 0.205267444f,
+            -0.374848962f, 0.142876416f, 0.215376869f, 0.389900237f, 0.133286744f, 0.286766708f,
+            -0.156882301f, -0.0466117673f, 0.017213732f, 0.335959047f, 0.627779186f, 0.378827274f,
+            -0.0164857581f, -0.0340577774f, 0.021637287f, 0.0811068565f, -0.075788714f, -0.0228772871f,
+            0.0207311325f, -0.0597556792f, -0.24266763f, 0.255060911f, 0.149632946f, -0.0637720674f,
+            -0.0683736503f, 0.503515184f, -0.205022469f, 0.0100046135f, 0.378566414f, 0.280296266f,
+            0.080654934f, 0.254197448f, 0.172320113f, 0.0933932289f, 0.0689966381f, 0.201393709f,
+            0.036032144f, -0.0714924335f, -0.213127613f, -0.151251554f, 0.084045738f, 0.0217373352f,
+            0.0597105026f, 0.0643389747f, -0.0194135271f, 0.0102625461f, 0.050923638f, 0.0463002473f,
+            0.131288901f, 0.0240976736f, -0.187240958f, -0.158286706f, 0.0580624156f, -0.0537160411f,
+            -0.0265719406f, 0.0283224583f, -0.0827304944f, 0.0118999789f, 0.117322333f, 0.00229655416f,
+            -0.105676793f, -0.354831576f, -0.240588188f, 0.110147595f, -0.128931314f, -0.215260193f,
+            0.3267304f, -0.0665339828f, -0.239365324f, 0.021279661f, 0.122339316f, 0.0645942762f,
+            -0.233588219f, -0.213336691f, -0.00526974956f, -0.0513126105f, -0.0623568334f, 0.0800913498f,
+            0.0972190946f, 0.0467456169f, 0.0381719954f, 0.0243580528f, 0.0781060308f, 0.241291523f,
+            0.170732856f, -0.0431022495f, 0.13141866f, 0.208371028f, 0.0535650402f, -0.14795728f,
+            -0.135844454f, -0.0769455358f, -0.0576862656f, 0.0314217098f, 0.0601261333f, -0.0395644903f,
+            -0.0233798064f, -0.2309255f, -0.167827696f, 0.0145172374f, -0.0377226695f, -0.0270385612f,
+            -0.207065225f, -0.300609231f, -0.088975504f, 0.192761064f, -0.169587836f, -0.376815557f,
+            -0.171919063f, 0.0179734677f, 0.190053448f, 0.13223958f, 0.0217498858f, -0.03067654f,
+            0.0273434129f, 0.0795043558f, -0.0594604947f, 0.0780280977f, 0.196659818f, 0.204913139f,
+            0.357924968f, 0.500229359f, 0.167755514f, -0.117168568f, -0.0975462422f, -0.0208552163f,
+            0.318434298f, 0.0127051035f, -0.274049819f, -0.337773412f, -0.0378488563f, 0.333333313f,
+            0.014338064f, 0.0822212771f, 0.330591828f, -0.029869752f, 0.324447244f, 0.288814098f,
+            0.244939566f, -0.130709529f, -0.00856923126f, -0.00638010679f, 0.100928292f, 0.263376772f,
+            0.0323313661f, 0.0617989227f, -0.0681942552f, 0.0767107904f, 0.21883817f, -0.153910458f,
+            -0.198843539f, -0.156393096f, -0.139037549f, 0.260629117f, 0.188787505f, 0.285099179f,
+            0.0229066443f, -0.0460245498f, 0.0996654332f, 0.0319508277f, -0.0183600895f, 0.00107562426f,
+            -0.0472097211f, -0.120059676f, 0.160800785f, 0.269602746f, -0.166489333f, -0.173978269f,
+            -0.234587133f, -0.0517630205f, -0.0195776336f, -0.0606615096f, -0.0131067215f, 0.0499730371f,
+            -0.0262365919f, 0.0774768963f, -0.0188913066f, -0.0898728967f, 0.205068216f, 0.247091666f,
+            0.134197563f, 0.133312836f, -0.104814075f, -0.225087076f, 0.0417868309f, 0.442096204f,
+            -0.0865342394f, -0.1007073f, -0.412218779f, -0.33573997f, -0.0195435025f, 0.229072616f,
+            -0.055824589f, -0.0420679115f, 0.136114299f, -0.172112629f, 0.275072724f, 0.0858032778f,
+            0.0721351653f, 0.0909085199f, 0.17536068f, 0.113784462f, 0.0641752928f, -0.0180121306f,
+            -0.12905474f, -0.124372102f, 0.195898965f, 0.225487679f, 0.0459082052f, -0.102911487f,
+            -0.0923408419f, -0.101700492f, -0.148651227f, -0.0694905892f, 0.0437412374f, -0.164715156f,
+            -0.0411417037f, -0.0295753274f, 0.0706326589f, 0.0638112947f, 0.0335176252f, 0.0445414446f,
+            0.160282806f, 0.170264661f, 0.103254788f, 0.0151248872f, -0.0149668464f, 0.0314645246f,
+            0.070721969f, -0.00680023292f, -0.103847809f, 0.0739279687f, 0.102528527f, 0.188230351f,
+            0.0493910238f, -0.0970190391f, -0.456149936f, -0.288423538f, -0.0292138234f, 0.18919f,
+            0.0361000821f, -0.144411594f, -0.0597358383f, -0.00467470987f, 0.273677528f, 0.498365819f,
+            -0.257846296f, -0.275248438f, -0.135159448f, -0.213417783f, -0.06819354f, 0.417303801f,
+            0.364526719f, 0.397647321f, -0.0325276591f, -0.00275736582f, 0.23077485f, 0.129079685f,
+            0.0927397162f, 0.00536047341f, -0.16663301f, -0.407211185f, -0.167487696f, -0.0329046734f,
+            0.189512625f, 0.0589485802f, 0.00358012435f, 0.206094861f, 0.12459974f, -0.305446774f,
+            -0.390993625f, -0.0632879362f, 0.0471266322f, -0.0343135856f, -0.170295f, 0.00833541248f,
+            0.0479282662f, 0.0654417649f, -0.179240495f, -0.419968694f, -0.142083257f, 0.000256652391f,
+            0.123528868f, 0.341207951f, 0.231231958f, 0.139505029f, -0.226938128f, 0.00032026507f,
+            -0.0351689309f, -0.158269748f, -0.0577930361f, 0.193564132f, -0.259232312f, -0.476148129f,
+            -0.105379507f, 0.12752603f, -0.278791666f, -0.129265919f, -0.109237626f, -0.0332066268f,
+            0.0943370536f, 0.0634382889f, -0.0394284911f, 0.0180434827f, -0.00536075188f, 0.0117331371f,
+            -0.159334153f, -0.194303557f, -0.112333596f, -0.0184982028f, 0.0813768432f, 0.0591658689f,
+            -0.0396730378f, 0.107149825f, 0.144196227f, 0.0486605316f, -0.0225118585f, -0.0752111897f,
+            -0.0606943332f, -0.0788893402f, -0.167266786f, -0.167184293f, -0.110279381f, -0.111395605f,
+            0.0141676106f, -0.0958831385f, -0.0968772322f, 0.120093688f, 0.011771284f, -0.154246867f,
+            -0.138478011f, -0.138381779f, -0.0132806757f, 0.0495519005f, 0.123057216f, 0.0461037457f,
+            -0.169648185f, 0.159104869f, 0.362676352f, 0.293902099f, 0.355408669f, 0.151184678f,
+            -0.12212f, 0.0984393805f, 0.124761321f, 0.170464814f, -0.223013133f, -0.38375634f,
+            -0.184085086f, 0.0678773597f, 0.0988852903f, -0.364183128f, -0.00238636811f, 0.265869051f,
+            -0.190386817f, 0.0745755881f, 0.0724089593f, 0.21875006f, -0.0470452569f, -0.134100959f,
+            -0.0293258745f, 0.0254009049f, 0.353401601f, 0.245399863f, 0.210532978f, 0.195178509f,
+            -0.0693469271f, -0.113538653f, -0.213245049f, -0.140604228f, -0.145818681f, 0.000573061116f,
+            -0.211473823f, -0.391666293f, -0.0838679895f, 0.181562155f, 0.23544769f, 0.192647606f,
+            0.0504190475f, -0.129663467f, 0.0460897423f, -0.128850996f, -0.220321909f, 0.0432461314f,
+            -0.0522430874f, 0.0444042161f, 0.0203973092f, 0.144889474f, 0.0747271627f, 0.186490148f,
+            0.155352578f, -0.183838859f, -0.230666026f, -0.0977304578f, -0.0392825939f, -0.041704189f,
+            0.0602987222f, 0.0131523916f, 0.0835842863f, -0.17653805f, -0.352124304f, 0.158580288f,
+            0.201484621f, 0.204217762f, 0.291724622f, 0.0095681306f, -0.118747659f, 0.0365354605f,
+            -0.154708281f, -0.0964165479f, 0.147485495f, 0.479376882f, -0.0260480139f, -0.230289474f,
+            0.0457758792f, 0.0506748743f, 0.188661009f, 0.233114198f, 0.159087226f, -0.0941797048f,
+            -0.136712179f, 0.0702052936f, 0.210600063f, 0.103393584f, -0.0438569002f, -0.45216921f,
+            0.0813400373f, -0.13304165f, -0.414177954f, -0.349891186f, -0.0877909809f, 0.152819917f,
+            0.082802631f, -0.106459536f, -0.149541691f, -0.138775051f, 0.0117587941f, 0.0806583837f,
+            0.231851563f, -0.0388177f, -0.20420374f, -0.154752314f, 0.114840686f, 0.513806462f,
+            0.169422716f, 0.153667375f, 0.373264223f, 0.240621626f, -0.163292721f, -0.268538266f,
+            -0.234119311f, -0.221610874f, -0.233279511f, 0.00780278025f, 0.0499193259f, 0.0126081472f,
+            -0.0551026352f, -0.0117572723f, -0.0888612121f, -0.0664811581f, 0.201037765f, 0.0288542192f,
+            -0.188015372f, 0.0386676304f, 0.161299288f, 0.257260352f, 0.153815836f, 0.168799058f,
+            0.187871277f, 0.255110681f, -0.089635171f, -0.0364582278f, 0.129594028f, 0.040330302f,
+            0.0223892052f, 0.0704914853f, -0.193871006f, -0.150972113f, -0.203799367f, 0.0841862783f,
+            0.2591362f, 0.197379962f, 0.27025342f, 0.0714298636f, 0.0203561652f, -0.10718558f,
+            0.0284067206f, 0.12677072f, 0.00698291976f, -0.148452923f, 0.0213211123f, 0.301934063f,
+            0.25966841f, -0.319161355f, -0.0436308198f, -0.0580850989f, -0.155508891f, -0.147177771f,
+            -0.0307834931f, -0.0306933727f, -0.280939311f, -0.106813088f, 0.0656936988f, 0.107688949f,
+            0.0804277062f, -0.100226678f, -0.0429151356f, 0.0804540068f, -0.0391484201f, -0.00491653942f,
+            0.0490587689f, -0.131596908f, -0.223819226f, -0.268685281f, -0.120984457f, 0.0630603731f,
+            0.0771520138f, 0.135369137f, 0.251889169f, 0.19481343f, 0.185167149f, 0.29161942f,
+            0.392880291f, 0.16684562f, 0.0825642049f, 0.0998786613f, 0.435049117f, -0.109983169f,
+            -0.236535504f, -0.30086717f, -0.226557598f, -0.0147184702f, 0.0943843573f, 0.132074922f,
+            0.117515586f, -0.0667097047f, 0.156120017f, -0.160347715f, -0.192058504f, 0.167896628f,
+            0.316333592f, 0.366711855f, 0.421159148f, 0.369569302f, 0.39634344f, 0.00360563165f,
+            0.445290834f, -0.183455601f, -0.381041437f, -0.482602f, -0.287671953f, 0.234358504f,
+            0.245222449f, -0.0835243836f, 0.0724373311f, -0.026249323f, -0.0720513165f, -0.285198748f,
+            -0.313358873f, 0.187986001f, 0.325285375f, 0.440415621f, 0.246523112f, 0.534290016f,
+            0.33603546f, -0.297886848f, -0.272367239f, -0.0373547003f, 0.484956473f, 0.556101978f,
+            0.528958976f, 0.374717414f, 0.112152308f, -0.0882992968f, -0.0622133277f, -0.0571573116f,
+            0.0380013995f, -0.108705692f, -0.0519572832f, 0.0135729946f, 0.0716513097f, -0.00216992432f,
+            -0.0697759986f, -0.127902418f, -0.341199577f, -0.438906908f, 0.336196542f, 0.391145706f,
+            0.20317173f, 0.0764372572f, -0.0262113679f, -0.0555970147f, 0.0890123099f, 0.15007557f,
+            0.00896857772f, -0.06417723f, -0.0991645977f, 0.00450577773f, 0.306073934f, 0.275775701f,
+            0.186887771f, 0.335124701f, 0.493950963f, 0.369379908f, 0.154260248f, 0.267835557f,
+            -0.321173877f, -0.304183215f, 0.234797597f, 0.294571728f, 0.248959631f, 0.413011611f,
+            0.307807624f, -0.118401527f, -0.273409605f, -0.221641436f, 0.0813248381f, 0.0207545385f,
+            -0.137138128f, -0.398949414f, -0.230616048f, 0.0929934978f, 0.0529113039f, 0.127219543f,
+            0.191865996f, 0.123052739f, -0.104900979f, -0.0943919122f, -0.159566104f, -0.359152764f,
+            -0.304913402f, 0.0418208688f, -0.116920635f, 0.0974294469f, 0.154355153f, 0.041313298f,
+            0.224892527f, 0.17567122f, 0.132958919f, 0.0360612832f, 0.0194421895f, 0.0847133324f,
+            0.00228268676f, -0.0166450404f, 0.031354785f, 0.0265886914f, 0.22475706f, 0.150985017f,
+            0.0225269031f, -0.0449335463f, -0.0825787932f, -0.11686831f, 0.0297329463f, -0.00138807192f,
+            0.0263762083f, 0.109746896f, -0.0463663228f, 0.100246832f, 0.126475424f, -0.0926802531f,
+            -0.295298249f, -0.177928403f, -0.223727912f, -0.123460874f, -0.0525502749f, 0.0273102056f,
+            0.0459579341f, 0.134625986f, 0.164060488f, -0.0258414447f, -0.143671498f, 0.143818736f,
+            0.106897041f, 0.286867291f, 0.192433491f, 0.0674755573f, 0.114696741f, -0.17993398f,
+            -0.423129857f, -0.153178602f, 0.122971468f, -0.0986644551f, -0.271530032f, -0.115248434f,
+            -0.0414875597f, 0.00288010691f, -0.00321465288f, -0.00377369509f, 0.059626136f, 0.140963614f,
+            0.109055772f, -0.238332659f, -0.502497196f, -0.0826387554f, 0.0908082128f, 0.0436595157f,
+            0.163678855f, 0.0697913244f, 0.0397203863f, -0.0442498326f, -0.180439293f, -0.11657761f,
+            -0.0519913808f, -0.0176907312f, 0.0487688556f, 0.127502948f, 0.150209114f, 0.091402933f,
+            -0.00869078841f, -0.159089476f, -0.0127679044f, 0.0856840238f, -0.0813323632f, 0.0634595826f,
+            0.0297180898f, 0.166328669f, 0.114405803f, -0.0616525635f, -0.315565497f, -0.427993834f,
+            -0.0608497001f, 0.0106508005f, -0.376421601f, -0.521745265f, -0.258287102f, 0.0369632207f,
+            0.123854645f, -0.096830152f, -0.0184688419f, 0.247139171f, 0.266559601f, -0.332825571f,
+            -0.681120217f, -0.0623648316f, 0.206214949f, 0.0845902488f, 0.0977264196f, -0.0185283888f,
+            0.111673169f, 0.320650667f, 0.55774349f, 0.110711254f, -0.205974117f, -0.182315961f,
+            -0.0585649423f, 0.138816357f, -0.193159029f, 0.0825598463f, 0.425391942f, 0.145430088f,
+            -0.322448283f, -0.327098578f, 0.0316977799f, -0.224469945f, -0.11933507f, 0.155071214f,
+            -0.0700580403f, 0.099124521f, -0.0948583335f, -0.0988386571f, 0.109946147f, 0.191012442f,
+            0.0373680815f, 0.0542624481f, 0.0303799585f, -0.0873892382f, -0.00116761809f, -0.0492779203f,
+            0.0880675316f, 0.239951342f, 0.0832635313f, 0.079385832f, 0.0659570619f, 0.0244443193f,
+            -0.0181099847f, -0.0932873487f, 0.132232487f, 0.0393855609f, -0.064299278f, -0.179017186f,
+            -0.561720133f, -0.12605755f, 0.220121548f, 0.100141369f, -0.0233051069f, 0.0646507666f,
+            0.0797004625f, -0.165807351f, -0.509133935f, -0.120329022f, 0.320380747f, 0.0895308256f,
+            -0.0332003236f, 0.122175135f, 0.121983513f, 0.0270840693f, -0.059940815f, 0.00119842764f,
+            0.101697259f, 0.356328338f, 0.0573222786f, -0.0789653733f, 0.356564015f, 0.256010562f,
+            0.107142553f, -0.0181889217f, -0.043121703f, 0.0523274541f, 0.0266311672f, -0.323217899f,
+            -0.0555764623f, 0.382935882f, 0.279032111f, -0.0379635915f, -0.120959297f, -0.038483724f,
+            0.0415971428f, 0.0352897421f, 0.0462111756f, -0.146337569f, -0.268111497f, -0.119212113f,
+            0.105551258f, 0.0759463981f, 0.104145601f, 0.213951468f, 0.063349098f, -0.16128327f,
+            -0.303022414f, -0.109797604f, -0.0447435044f, -0.0375696756f, 0.0350530483f, 0.112144366f,
+            0.164906636f, 0.0885175839f, -0.282386571f, -0.0681927055f, 0.016970925f, -0.0448990278f,
+            0.0283956397f, 0.0219918992f, 0.110201672f, 0.119962662f, 0.0634351298f, -0.0834710523f,
+            0.107724555f, 0.0359970108f, -0.0523025952f, -0.0779376328f, -0.101530969f, -0.0881828666f,
+            -0.126956999f, -0.18356818f, -0.173922181f, -0.0751928315f, -0.0028510259f, -0.0921102613f,
+            -0.157546848f, -0.178180799f, 0.00862000789f, 0.0552371964f, -0.0690410733f, 0.0142348437f,
+            -0.00176546851f, 0.0941586941f, 0.08631441f, 0.0875611305f, 0.0770271793f, 0.069678098f,
+            -0.135143414f, -0.0582612194f, 0.16780822f, 0.0562954172f, -0.0388664789f, -0.0402830578f,
+            -0.478318632f, -0.16284804f, -0.21327059f, -0.264351308f, 0.0737894475f, 0.108517542f,
+            0.133049905f, 0.0796437263f, -0.044530008f, 0.0378187485f, 0.151562303f, 0.274890214f,
+            0.14848949f, -0.159776211f, -0.262377381f, -0.301904947f, -0.109279647f, -0.214063168f,
+            -0.202829123f, -0.10172084f, -0.0861761868f, 0.155534387f, 0.0835548416f, -0.253184944f,
+            -0.317284197f, -0.228781104f, -0.0841471404f, -0.130277485f, -0.182784081f, -0.088052012f,
+            -0.228875652f, -0.164698601f, -0.0920528546f, -0.0369987711f, -0.138119161f, -0.375156015f,
+            0.00190374744f, 0.0451105125f, 0.145438582f, 0.220375285f, 0.118298508f, 0.115160815f,
+            -0.0667236149f, -0.104164079f, 0.0774086043f, 0.154025614f, 0.156515211f, -0.0910973623f,
+            -0.0940581188f, -0.174829349f, -0.0981592536f, -0.0700146258f, -0.0962246507f, -0.245245337f,
+            -0.0814899653f, 0.0672370419f, 0.157967016f, 0.033153858f, -0.10430903f, -0.111563385f,
+            -0.0305302385f, -0.141186357f, -0.269970715f, -0.198444813f, -0.060370218f, -0.0667052194f,
+            -0.0399536714f, 0.209876686f, 0.140077248f, -0.00573830865f, 0.0267352872f, 0.194165364f,
+            0.223786786f, 0.0184689406f, -0.0859275535f, -0.002493473f, 0.114443921f, -0.216022f,
+            -0.155662537f, -0.162183046f, -0.176914632f, -0.0364708044f, 0.116404146f, 0.100673571f,
+            0.127392814f, 0.270976901f, 0.238346711f, 0.143276751f, -0.047720328f, -0.216067061f,
+            -0.117998436f, -0.0295477994f, 0.0374092013f, 0.123046957f, 0.0724784955f, -0.101630211f,
+            -0.188273385f, 0.153057307f, 0.366765618f, 0.178779289f, 0.0245089009f, 0.0833732858f,
+            0.187855631f, 0.0926124752f, 0.0387246981f, 0.0123631256f, 0.0447653309f, -0.0418090709f,
+            0.0360451117f, 0.162249699f, -0.00290442025f, -0.123871915f, -0.0996473134f, 0.0212625526f,
+            0.0205312166f, -0.0970045626f, -0.177016571f, -0.0399348103f, -0.058447998f, -0.111962445f,
+            0.0160484556f, 0.0656190366f, 0.0332612544f, 0.0443487689f, 0.00111179613f, -0.0470906943f,
+            -0.0202807654f, -0.0603769645f, -0.125357613f, -0.0787584484f, -0.0135577191f, -0.0581738055f,
+            -0.0669827536f, -0.0483506545f, -0.0623496659f, -0.027898578f, 0.00989621691f, -0.0211763587f,
+            -0.0347124301f, 0.137912288f, -0.128568426f, 0.0823142305f, 0.138029873f, -0.149462238f,
+            0.0309042037f, 0.306939065f, 0.292607158f, 0.1430839f, 0.0206781104f, -0.070149824f,
+            -0.0723369196f, -0.0977464244f, 0.141229853f, 0.312816799f, 0.219791472f, -0.0848212689f,
+            -0.165482581f, -0.082745865f, 0.139318749f, 0.171966985f, 0.0610128604f, 0.0673558712f,
+            0.190430492f, 0.175949574f, -0.0164663345f, -0.100984111f, 0.080405049f, 0.0700961128f,
+            0.10330455f, 0.0267329644f, -0.0579957105f, -0.107390471f, -0.193417102f, -0.0667382777f,
+            0.0510380641f, 0.0105890594f, -0.153302923f, 0.0789456815f, 0.119793579f, -0.0717854127f,
+            -0.0324290432f, -0.132603064f, 0.0434148088f, 0.389140993f, 0.293240815f, -0.0070879003f,
+            -0.146849871f, -0.16430971f, -0.0984255522f, -0.0513706096f, -0.0894744769f, 0.266456217f,
+            0.267882645f, -0.251977593f, -0.0815150216f, 0.0669238642f, -0.192081794f, 0.0963310376f,
+            -0.0772229806f, -0.203371316f, 0.0983163565f, 0.090948306f, -0.0113432426f, 0.0163782854f,
+            -0.168525666f, -0.232277006f, -0.120457307f, -0.148057625f, -0.138990849f, -0.028087683f,
+            0.0512318425f, -0.0327613316f, -0.179912508f, -0.0540474765f, 0.00503490679f, -0.149808928f,
+            -0.189266369f, -0.169690281f, -0.0519634746f, -0.16868329f, 0.0773838833f, 0.139482632f,
+            0.20854944f, -0.0218024012f, 0.0796939954f, 0.00335869147f, 0.00511648878f, 0.0378835276f,
+            -0.00753553398f, -0.064705424f, -0.032320518f, 0.00821281318f, -0.0543990768f, 0.0179456323f,
+            0.206461281f, 0.157085851f, -0.0959188491f, 0.0173081215f, 0.015319732f, -0.00699515222f,
+            -0.0111307949f, 0.257497847f, 0.206758201f, -0.220658675f, -0.0234520361f, 0.292067856f,
+            0.51107204f, 0.386705279f, 0.0597754717f, 0.0651767924f, -0.0378292874f, -0.0340958238f,
+            -0.140750632f, -0.0307674278f, 0.240347698f, 0.584086061f, 0.433430582f, 0.085337095f,
+            -0.192367464f, -0.0886247158f, 0.180293187f, 0.160785526f, -0.164108023f, -0.441977859f,
+            -0.0930595472f, -0.0438706167f, -0.126553982f, 0.00257552485f, -0.0839836746f, -0.362974733f,
+            0.117518887f, -0.180184245f, -0.321879685f, 0.0369298644f, 0.357851207f, 0.0362484902f,
+            -0.244376987f, -0.0593961589f, 0.0755402818f, 0.310598582f, 0.0522076264f, 0.196949586f,
+            0.145878449f, 0.158003315f, 0.136541158f, 0.0148268174f, -0.0531106293f, -0.0213653184f,
+            -0.0109457504f, -0.161073998f, -0.147554025f, 0.0748614073f, 0.136520296f, -0.0401532315f,
+            -0.0452852547f, 0.200303063f, -0.148804337f, -0.0610531271f, 0.0500739887f, 0.133376688f,
+            -0.146650597f, 0.0399071388f, 0.405742079f, 0.417908996f, -0.0879466459f, -0.166323513f,
+            0.0239401255f, -0.144015685f, 0.0133679826f, -0.0291770101f, -0.0329644494f, 0.106134117f,
+            0.345473766f, 0.235341311f, -0.294775754f, -0.116805486f, 0.340467334f, -0.089960292f,
+            0.0785214826f, 0.0481020063f, 0.0665713847f, -0.212428227f, -0.132373735f, 0.0570253804f,
+            -0.0784786195f, -0.153622434f, -0.226840153f, -0.110532142f, -0.0188192017f, -0.186076388f,
+            0.0880565345f, 0.0364411436f, -0.0464068949f, 0.0189997386f, -0.135818064f, -0.27028501f,
+            -0.241938874f, -0.0539076775f, 0.129245833f, 0.132292747f, 0.0703552961f, -0.227466017f,
+            -0.276854694f, -0.360068411f, -0.262011349f, -0.089084588f, -0.000290645723f, -0.0894731805f,
+            -0.116020061f, -0.089699313f, 0.00317807239f, 0.125778198f, 0.0144094117f, -0.238615468f,
+            0.0163606256f, -0.000335730205f, -0.518814206f, -0.0954787061f, 0.132491991f, 0.00225310284f,
+            -0.0983617231f, 0.017812131f, -0.161369041f, -0.0876815394f, 0.0986533612f, 0.123614281f,
+            -0.073096998f, -0.120965019f, 0.175094366f, 0.21120216f, -0.00893406942f, -0.0155257992f,
+            -0.11068476f, -0.135843024f, 0.203291461f, 0.283747077f, 0.0556467846f, 0.0803933218f,
+            0.0334404856f, 0.0207446367f, -0.0673722103f, -0.19908905f, -0.0571770445f, -0.306199014f,
+            -0.355152637f, -0.232051402f, 0.22626318f, 0.110245839f, 0.137525156f, 0.146064684f,
+            -0.144324645f, 0.182603329f, 0.418444008f, 0.191286489f, 0.208829254f, 0.0982509181f,
+            -0.323076129f, -0.00698496168f, 0.00379427895f, 0.0348887928f, 0.171285361f, 0.150925472f,
+            0.12433701f, -0.0332202464f, -0.089665167f, 0.0373787023f, 0.214372829f, 0.123381898f,
+            -0.245567247f, -0.0888762698f, 0.0138686048f, 0.0438065752f, 0.0527905226f, -0.0139120948f,
+            -0.288163513f, -0.279910862f, -0.19598873f, -0.0107426373f, 0.0341048427f, -0.0364464857f,
+            0.0750290006f, 0.0842086375f, 0.11789874f, 0.0685868859f, 0.031903442f, -0.0954029635f,
+            -0.0270377398f, 0.099489972f, 0.107261702f, 0.131123617f, 0.0059475326f, -0.113801792f,
+            -0.0237069894f, 0.120070897f, 0.0446213782f, -0.0842130557f, -0.0124222161f, -0.152808309f,
+            -0.115294598f, 0.0832246467f, -0.0376719013f, 0.028277874f, 0.142657712f, 0.0297683794f,
+            -0.204702675f, -0.0829529539f, 0.282659531f, 0.106753461f, 0.0871631727f, 0.0346076451f,
+            0.115935579f, 0.0875123516f, 0.270076275f, 0.13755016f, -0.0698684156f, -0.138009682f,
+            -0.172547102f, -0.0510410219f, -0.053734675f, 0.0132024074f, 0.21973601f, 0.148113072f,
+            0.0874108374f, 0.0391909406f, -0.0211505461f, 0.0290890336f, -0.00429587392f, -0.073337093f,
+            -0.0682711974f, 0.102015316f, -0.0565537699f, 0.0038709424f, -0.0641748682f, -0.0605516173f,
+            -0.139200762f, -0.153931499f, -0.0337961987f, 0.0596734285f, 0.0813849568f, 0.18910253f,
+            0.0807460397f, -0.086428225f, -0.217168316f, -0.250492305f, -0.318850487f, -0.156123728f,
+            -0.0520416163f, 0.0851988122f, 0.111954339f, 0.15438734f, -0.304981679f, -0.169994608f,
+            -0.016007863f, -0.238591656f, -0.266182214f, -0.0376703478f, -0.035809394f, 0.0834021419f,
+            -0.153335139f, -0.114711538f, -0.247356996f, -0.23453559f, -0.123008862f, -0.0416306928f,
+            0.0897336975f, -0.0453793891f, -0.150342211f, -0.126647398f, -0.08017122f, -0.0257189889f,
+            -0.19304432f, -0.108719945f, 0.0854793563f, 0.128441095f, 0.193185672f, 0.172215402f,
+            -0.0505201966f, -0.171366632f, -0.104575492f, -0.0785857141f, -0.158324778f, -0.183145896f,
+            -0.110664137f, -0.100631326f, -0.196114242f, -0.17539227f, -0.335380554f, -0.208034664f,
+            -0.119551182f, -0.0920142457f, -0.248993903f, 0.0464090295f, 0.256481409f, 0.106472716f,
+            -0.105599761f, 0.230711833f, 0.216571212f, -0.0240913779f, -0.261906147f, -0.0836347714f,
+            -0.117586918f, -0.104126997f, -0.00868715812f, 0.0207586829f, 0.0228661075f, 0.0758984089f,
+            0.0795010999f, 0.0294655971f, -0.0568823069f, -0.078566812f, -0.0784762651f, -0.0432302691f,
+            -0.00814318191f, 0.0834303275f, 0.0723303482f, 0.0655815899f, 0.0360210799f, -0.0215879176f,
+            0.133093119f, 0.0631795079f, -0.0877638981f, 0.0234498437f, 0.0545794331f, 0.0116522433f,
+            0.0632431731f, 0.235238656f, 0.0802401677f, -0.200778246f, -0.213351339f, -0.0672696754f,
+            -0.0510836467f, -0.0946809426f, 0.0918356106f, 0.0927299038f, 0.0700905547f, 0.118221447f,
+            0.152272969f, -0.234063581f, -0.153905362f, -0.135436684f, -0.254831553f, -0.0615069196f,
+            0.12595959f, -0.000407375541f, -0.0508028977f, -0.0382758714f, -0.045988027f, -0.00324265822f,
+            0.0504315943f, 0.0264184047f, -0.14894405f, -0.0639949292f, -0.0724742785f, 0.0356454886f,
+            0.101047762f, 0.101220638f, 0.124344304f, 0.121279135f, 0.0506464392f, 0.0894796029f,
+            -0.102240957f, 0.146771312f, 0.239819825f, -0.00293507404f, 0.227697372f, 0.347129703f,
+            0.0486480221f, -0.167664781f, -0.200486705f, -0.158832297f, -0.193082869f, -0.00997572858f,
+            0.172121346f, 0.251735091f, 0.195509344f, 0.244050741f, 0.10327965f, -0.230235219f,
+            -0.216208979f, -0.138492852f, -0.00503147719f, 0.0539425127f, 0.243391231f, -0.133987412f,
+            -0.102156937f, -0.0388616323f, 0.0484264158f, 0.0900355279f, 0.0978860334f, -0.0120928641f,
+            0.0382441692f, 0.0287325978f, -0.191207126f, -0.0360789672f, 0.0843103901f, 0.226634711f,
+            0.0458872057f, -0.00072309532f, 0.0773730204f, 0.0744204447f, -0.144258901f, 0.236107469f,
+            0.3234514f, 0.218504921f, 0.229622081f, 0.0686907768f, -0.108782068f, -0.275808841f,
+            -0.210831523f, -0.16735132f, -0.331620038f, 0.019312961f, 0.290971339f, 0.185402438f,
+            0.0259046983f, 0.351509064f, 0.211720839f, -0.00602796301f, 0.0218995083f, 0.218570814f,
+            -0.0922626182f, -0.0833496749f, 0.0986583531f, -0.213025108f, -0.0884344354f, -0.129311442f,
+            -0.126594141f, -0.112483107f, -0.0474185385f, 0.0274733379f, 0.0433538221f, 0.00433313102f,
+            -0.164765164f, -0.0370991118f, 0.176945373f, 0.0535185374f, 0.199933738f, 0.118729539f,
+            0.0896350294f, 0.00979152136f, -0.14082785f, -0.111101858f, -0.0699800327f, 0.150519118f,
+            0.0542576872f, -0.0626273602f, -0.0282136071f, -0.0717217848f, 0.0490895249f, 0.149359912f,
+            -0.00998948701f, -0.0631663501f, 0.0945971459f, 0.0015666862f, -0.134115964f, -0.0916434675f,
+            0.136479706f, 0.170393288f, -0.0173823945f, -0.0993196368f, -0.241120219f, -0.339066923f,
+            -0.24310714f, -0.220786989f, -0.325048089f, -0.158516422f, -0.190025702f, -0.175160035f,
+            -0.152650878f, 0.0248684343f, 0.384836882f, 0.148939624f, -0.0839699358f, 0.14285484f,
+            0.24729301f, -0.113591149f, 0.0624439977f, 0.343461722f, 0.328875721f, 0.0250283126f,
+            -0.221329957f, -0.17960377f, -0.0749768242f, 0.0919620618f, 0.0753232613f, 0.0898502171f,
+            0.092430152f, 0.198576897f, 0.164999276f, 0.163755432f, 0.125364244f, -0.0825564861f,
+            0.0325538553f, -0.0383398086f, -0.236279443f, -0.0941047221f, 0.115564145f, 0.162915543f,
+            -0.111262448f, -0.262802929f, 0.00081625412f, 0.023598833f, -0.117603324f, -0.302729905f,
+            -0.153813496f, -0.152501225f, -0.116584659f, 0.0885096714f, 0.0171948895f, -0.320610464f,
+            -0.0461895205f, -0.0347687081f, -0.211466655f, -0.0879694521f, -0.206980705f, -0.264093071f,
+            -0.260009497f, -0.203527525f, 0.0056765466f, -0.00393676478f, -0.00136728538f, -0.0503605232f,
+            0.183418036f, 0.237336516f, -0.0437522084f, -0.255285233f, -0.104673848f, -0.026506925f,
+            0.195268601f, 0.202403218f, 0.0673905313f, -0.172540635f, 0.0354979374f, 0.26577127f,
+            0.275287271f, 0.0862903073f, -0.0420069098f, -0.163528964f, -0.0143415518f, 0.179450512f,
+            -0.070160158f, -0.0843597874f, -0.0749184713f, 0.0276421737f, 0.0843777582f, 0.0969471186f,
+            0.00802640337f, -0.079192996f, 0.092666924f, 0.0589096546f, 0.0478252247f, 0.0658741146f,
+            0.0483052395f, -0.0542160235f, 0.0652494058f, 0.125311881f, 0.0998957306f, -0.0435113348f,
+            -0.0721378997f, -0.0662680417f, -0.249945641f, -0.179876029f, 0.225146309f, 0.0881150141f,
+            -0.143948346f, -0.0964265317f, 0.128970876f, 0.225107595f, 0.203965932f, -0.0610449463f,
+            0.241757646f, 0.0766997412f, 0.180539593f, 0.309446216f, 0.100358643f, -0.130739897f,
+            -0.15678072f, -0.106512852f, -0.117681012f, -0.162228703f, 0.0657641217f, 0.0856640637f,
+            -0.00538111851f, -0.331227005f, -0.336631417f, -0.144919649f, 0.100873411f, 0.0467546172f,
+            -0.118925318f, -0.00875591859f, -0.125790223f, 0.0247790627f, 0.204259485f, -0.00358857331f,
+            -0.302218437f, -0.321812987f, -0.0138171921f, 0.169548765f, 0.0152503783f, 0.0080890879f,
+            0.0632835105f, 0.0411317199f, 0.11538545f, 0.061708346f, -0.034053769f, -0.080410704f,
+            -0.0744858682f, -0.0377726182f, 0.000458774506f, 0.0465208441f, -0.0214398205f, -0.0569977202f,
+            -0.0711024776f, 0.0835187361f, 0.0281249844f, -0.055074539f, -0.0717990324f, 0.0100936359f,
+            0.0460056625f, 0.112455003f, 0.011158227f, -0.157721937f, -0.00413670298f, 0.31950897f,
+            0.413166255f, 0.298283786f, 0.0750522465f, -0.0405520909f, -0.0368740074f, 0.029431697f,
+            0.122418448f, -0.0282549188f, -0.132358953f, 0.00863317214f, 0.402434438f, 0.275128365f,
+            -0.24663341f, 0.0183078293f, 0.24059248f, 0.0788130388f, -0.10836377f, 0.00998544134f,
+            0.2602337f, 0.135727182f, -0.0348711312f, -0.0919866562f, 0.0830591694f, 0.0694347173f,
+            0.0728686675f, 0.0546736978f, 0.114259213f, 0.0488912351f, -0.0588411912f, 0.0855964869f,
+            -0.0203059576f, -0.245853513f, -0.19962123f, -0.0124705583f, 0.0184315052f, 0.0157399029f,
+            0.280846745f, 0.356469631f, 0.205700934f, 0.129991591f, -0.0567966662f, 0.0476602912f,
+            0.155404195f, 0.25114432f, 0.0360301137f, -0.10440015f, 0.133536175f, -0.0742661282f,
+            -0.112725049f, -0.22365433f, -0.329237819f, -0.0581263825f, 0.286804557f, 0.282762378f,
+            0.0979511067f, -0.0204308797f, -0.238128975f, -0.109461747f, 0.0569401197f, 0.168691888f,
+            0.184943274f, 0.11912822f, 0.021090094f, 0.189339533f, 0.0111571159f, -0.24762243f,
+            -0.0365538895f, 0.0179133546f, 0.155845076f, 0.250641614f, 0.131042361f, 0.17771484f,
+            0.271448523f, 0.17982468f, 0.039139159f, -0.0379975513f, -0.174490184f, -0.1202344f,
+            0.120710067f, 0.227583215f, -0.0773603618f, -0.541330159f, -0.559706032f, -0.244809732f,
+            -0.0897200108f, 0.0558067374f, -0.141509399f, 0.265092045f, 0.391222119f, 0.37571758f,
+            0.0600722916f, -0.323001236f, -0.464036107f, -0.228005797f, -0.185331345f, 0.0232039019f,
+            0.0709513649f, -0.000124257698f, 0.0805784836f, 0.0189028475f, -0.218830347f, -0.194942355f,
+            0.0507199429f, 0.295570582f, 0.243714735f, -0.027009204f, 0.178705633f, 0.143619269f,
+            -0.0648699701f, -0.188552141f, -0.290396512f, -0.24062255f, -0.089466095f, 0.0307648536f,
+            0.0634024963f, 0.017672224f, -0.0993093625f, 0.0269239843f, 0.100577287f, 0.0666037127f,
+            0.302411258f, 0.485427678f, 0.449230075f, 0.220633507f, 0.155036911f, -0.0623721965f,
+            0.0735651702f, 0.0783877f, 0.153324232f, 0.159821585f, 0.46285969f, 0.411394358f,
+            -0.0308881849f, -0.314066112f, -0.294182003f, 0.0204551127f, -0.0716254711f, -0.331317335f,
+            -0.33245793f, -0.0551364012f, 0.113901019f, 0.0723267123f, -0.0447714366f, -0.0306882281f,
+            -0.0671506971f, -0.106735624f, 0.000780702394f, 0.0846139789f, 0.344581962f, 0.187998295f,
+            -0.114630282f, -0.0554516837f, 0.0982896611f, 0.124377847f, -0.112142771f, -0.224411055f,
+            -0.19578521f, -0.280400276f, -0.273575783f, -0.291188031f, -0.257702321f, -0.186300427f,
+            -0.291258514f, -0.174021512f, -0.122710884f, 0.0836370587f, 0.0426901057f, -0.0156168295f,
+            0.140476748f, 0.0206897501f, -0.40090555f, -0.319904268f, 0.139447764f, 0.395864755f,
+            0.22589381f, -0.0490110107f, -0.140777141f, -0.00601023715f, 0.14256227f, 0.108019598f,
+            0.0261516552f, -0.0662248433f, -0.107477456f, -0.0134229017f, -0.0127998162f, 0.00477777189f,
+            0.0183643717f, 0.123664141f, 0.131306157f, 0.135602728f, 0.0392545424f, -0.0836493149f,
+            -0.0704979375f, -0.0601794347f, 0.0145127364f, 0.0153196529f, 0.0651976392f, -0.105898462f,
+            -0.138817549f, -0.247998163f, -0.0986082554f, -0.177557796f, -0.314566493f, -0.0607221425f,
+            0.0378178917f, 0.122591555f, -0.121149436f, -0.242394328f, -0.235762969f, 0.101271756f,
+            0.275728106f, -0.0144868819f, -0.115323f, 0.0172748938f, 0.129208714f, 0.103856698f,
+            0.0466403775f, -0.0399757102f, -0.132908791f, -0.0666246787f, 0.0886386856f, -0.00154036563f,
+            -0.00869855564f, 0.0341393985f, -0.171620756f, -0.2280173f, 0.213127404f, 0.115325689f,
+            0.0843478814f, 0.118807316f, 0.159728065f, -0.0243257713f, -0.091324769f, -0.00847417861f,
+            0.0223810244f, 0.0381067321f, 0.0377002619f, 0.0796376541f, 0.0586736165f, 0.0400793888f,
+            -0.0128278472f, -0.0489726923f, -0.0316352434f, -0.114979997f, -0.111918643f, 0.011411652f,
+            0.0880258828f, -0.00781906582f, -0.118066579f, -0.0679608807f, -0.0198650118f, -0.0260099676f,
+            -0.04970292f, -0.0858357623f, -0.0641646236f, -0.0292917006f, -0.0993268341f, 0.0433048643f,
+            0.269979686f, 0.165709972f, -0.0107835559f, 0.0713416189f, 0.0649414733f, -0.195297629f,
+            -0.151156232f, 0.0223032702f, 0.208400398f, 0.156215101f, 0.188125819f, -0.044158034f,
+            -0.153263181f, 0.0851107538f, -0.0655143261f, -0.125593111f, -0.142317191f, -0.0822894424f,
+            -0.239488542f, -0.0431801714f, 0.0517516397f, -0.0362811647f, -0.115738444f, -0.0463959724f,
+            0.0185720846f, 0.100817457f, 0.069164969f, 0.0503267273f, 0.0351302326f, 0.0364459194f,
+            -0.0605053082f, -0.165454164f, -0.182963178f, -0.106049344f, 0.0248106346f, 0.0985063687f,
+            0.05987183f, 0.0660557598f, -0.542309582f, -0.221222326f, -0.229176298f, -0.171946153f,
+            0.111425318f, 0.0494471975f, 0.0365024991f, 0.0610888638f, 0.0168350153f, 0.121001661f,
+            0.114984892f, -0.216284946f, -0.204717994f, -0.254697978f, -0.201876864f, -0.244887471f,
+            -0.0886006132f, 0.100154363f, 0.298701793f, 0.292176187f, 0.0627424344f, -0.0799688548f,
+            -0.0183787122f, 0.277163863f, 0.269629747f, 0.261511087f, 0.0563556403f, 0.0566904061f,
+            0.122318938f, 0.0762480274f, -0.138890386f, -0.175439924f, -0.0492787212f, -0.0647521019f,
+            0.169611007f, 0.332411468f, 0.125031933f, -0.0543178134f, 0.119164065f, 0.164326563f,
+            -0.0306978319f, -0.0129387118f, 0.0566434525f, -0.0519926101f, -0.00103595585f, 0.171627954f,
+            0.15045023f, -0.093553707f, -0.148185268f, -0.174557611f, -0.0475764647f, -0.137514263f,
+            -0.0595883541f, 0.0222675987f, -0.036569871f, 0.00905840751f, -0.199117377f, -0.218367636f,
+            -0.0378168002f, -0.0699537247f, -0.291254461f, -0.0692249611f, -0.0227054842f, -0.0980222225f,
+            -0.0700597093f, 0.0151592046f, 0.0528009012f, 0.126133353f, 0.0677647516f, -0.105317578f,
+            -0.00926258415f, -0.105015367f, -0.197053403f, -0.13542071f, -0.091497533f, -0.192073971f,
+            -0.123488791f, -0.0500124246f, -0.0114299078f, 0.0885230079f, 0.0252992697f, 0.0631816015f,
+            0.0575804152f, 0.0586588867f, -0.0884175003f, -0.0804185122f, 0.0213455427f, 0.0250266157f,
+            0.0221578423f, -0.0763294697f, 0.0368830301f, 0.0619797818f, -0.0149213476f, -0.0780623257f,
+            -0.0336005576f, 0.00979073346f, 0.0463514104f, -0.0522775203f, -0.104610279f, -0.0671153218f,
+            0.0648296699f, 0.0350910127f, 0.0610603504f, 0.0051918393f, -0.310638696f, -0.0172178615f,
+            0.182692155f, 0.104442842f, 0.0561591461f, 0.167618617f, 0.0734520182f, 0.0607347228f,
+            0.0811510533f, 0.0823348686f, 0.0381841324f, 0.00814315863f, -0.00968120247f, -0.344760507f,
+            -0.194109187f, -0.0302051697f, -0.0536070801f, 0.159895197f, 0.162666336f, 0.153051555f,
+            0.0756837577f, 0.128330126f, 0.119682156f, -0.0388804339f, 0.0868553296f, -0.0586133674f,
+            -0.0108062904f, -0.0768288821f, -0.141826853f, -0.179595128f, -0.0338341556f, 0.0948022828f,
+            -0.161012262f, -0.0791626945f, 0.00771629484f, -0.162986755f, -0.00174590223f, 0.113787554f,
+            0.0989687294f, 0.328882694f, 0.131698132f, 0.149259135f, 0.337495506f, 0.294649512f,
+            0.0891043097f, -0.0408870205f, 0.0020980204f, -0.115218706f, -0.0845391527f, 0.148207292f,
+            0.456568748f, 0.26681f, -0.158851534f, 0.0365457274f, 0.175295502f, -0.0391448773f,
+            -0.0364526883f, 0.00970496144f, -0.109629445f, -0.093003653f, -0.414104193f, -0.225470856f,
+            0.21666266f, 0.175970912f, 0.0499523096f, 0.0235728119f, 0.0300433096f, -0.0304752737f,
+            0.136093765f, 0.140957043f, 0.027719032f, 0.212955683f, 0.103961691f, -0.37969771f,
+            -0.284905314f, 0.0536696985f, -0.225149989f, 0.0870409012f, 0.37855649f, 0.319080293f,
+            -0.0224895328f, 0.121380769f, 0.447172254f, 0.488713264f, 0.130691424f, -0.0620180033f,
+            -0.0380010679f, -0.217634007f, 0.0333683491f, 0.499560088f, 0.572673082f, 0.0291281175f,
+            -0.330024838f, -0.0982959121f, 0.0310323946f, -0.17472364f, 0.0164756831f, 0.0294180103f,
+            0.198371723f, 0.283542246f, 0.545009792f, 0.269200027f, -0.160715163f, -0.216849059f,
+            0.0170935709f, 0.148779631f, 0.157836616f, 0.0259287916f, -0.317678601f, -0.0966207609f,
+            0.0705174357f, -0.420037299f, -0.111383826f, 0.397373468f, 0.227614224f, -0.215185717f,
+            -0.0673156828f, 0.259748638f, 0.389369667f, 0.18060042f, 0.024033187f, 0.156115398f,
+            0.271708906f, 0.185210019f, 0.107166134f, -0.0142894303f, 0.00521578081f, -0.11111103f,
+            -0.100997046f, 0.33401078f, 0.49775058f, 0.00215239031f, -0.118147872f, -0.059515141f,
+            -0.0258919019f, 0.0304100215f, -0.283402264f, -0.0568212457f, -0.109343141f, 0.0302165337f,
+            0.358859211f, 0.186407983f, 0.00227292115f, -0.0111034624f, -0.0575789027f, -0.187784329f,
+            -0.288519412f, 0.0122958142f, -0.132903695f, 0.0317199379f, 0.0424888767f, -0.135713518f,
+            0.203534544f, 0.215435341f, -0.120957948f, -0.271830648f, -0.0714695901f, 0.0934415758f,
+            0.158297807f, -0.115031183f, -0.288760096f, -0.0965447426f, -0.206695691f, -0.127825707f,
+            0.00404128106f, 0.0681194514f, 0.0329354592f, 0.0775757879f, 0.31883356f, 0.153658763f,
+            0.112800352f, 0.0234985948f, -0.170093983f, 0.00813852996f, 0.179162323f, 0.0425434522f,
+            -0.110884778f, -0.0222677942f, 0.0165969208f, 0.00671011629f, 0.00446427194f, -0.0151190991f,
+            0.0082940571f, -0.0727950335f, -0.214828983f, -0.214221448f, -0.262271583f, -0.0299727991f,
+            -0.0542304032f, 0.0714667365f, 0.0920004323f, 0.0568555258f, 0.0509249903f, 0.111477971f,
+            0.0779801309f, -0.0154632078f, 0.109453693f, 0.074424006f, -0.0799884126f, -0.381405979f,
+            -0.211215094f, 0.0994296819f, 0.0396416821f, 0.130113259f, 0.245307267f, 0.0782489404f,
+            0.0202442128f, 0.100472972f, 0.124236442f, -0.0336065181f, -0.0456876308f, -0.304158419f,
+            -0.374072522f, -0.191998795f, -0.0913532153f, -0.0433315299f, -0.16964893f, -0.240387574f,
+            -0.173698843f, -0.0192588177f, -0.0321828462f, 0.0288095716f, 0.042369619f, -0.030995179f,
+            0.0299565513f, 0.00719087292f, -0.123664953f, 0.0137655232f, -0.000184461853f, -0.0790765211f,
+            0.0277266111f, 0.10993138f, -0.00956670381f, -0.0181380138f, -0.171536535f, -0.241340518f,
+            -0.0957104862f, 0.0648700669f, 0.236608967f, 0.306810796f, 0.274715602f, 0.204166353f,
+            0.0523255393f, -0.0691579878f, -0.147752985f, -0.0806756765f, 0.0614656992f, 0.180370659f,
+            0.0496504717f, -0.0894019902f, 0.00299224141f, 0.25269112f, 0.26412937f, 0.0584325865f,
+            0.089258559f, 0.353158772f, -0.18570286f, -0.212677583f, -0.103152424f, -0.0133668045f,
+            0.0399531983f, -0.0364164263f, -0.22173579f, -0.219759747f, -0.0892384499f, -0.0521702021f,
+            -0.0548722073f, -0.081625931f, -0.163665131f, -0.108132325f, 0.0597541705f, 0.187514514f,
+            0.141917363f, 0.193820238f, 0.0382826552f, -0.235686004f, 0.0399262123f, -0.0428638086f,
+            -0.137675375f, -0.0453157164f, 0.160907373f, 0.0706285909f, -0.215690643f, -0.100675963f,
+            -0.143480793f, -0.0814576969f, -0.0651030391f, 0.0452889539f, 0.108196333f, 0.0696246624f,
+            0.102088243f, 0.107967354f, -0.0593100563f, -0.190174788f, -0.175943792f, -0.153741211f,
+            -0.183052227f, -0.132920682f, -0.0802320018f, -0.0642126799f, -0.0521430224f, -0.0274202973f,
+            0.00670077559f, 0.0514307246f, 0.0558258668f, -0.1548682f, -0.214746967f, -0.11929737f,
+            -0.0740512535f, 0.0172601398f, 0.0664135888f, 0.119110107f, 0.0579371341f, 0.0735386536f,
+            0.0357788987f, -0.0150186969f, -0.000755732879f, 0.127547681f, -0.0220785402f, 0.2660532f,
+            0.245844379f, 0.243032411f, -0.195198879f, -0.153972447f, -0.105406374f, -0.229345903f,
+            -0.106805377f, 0.00419363473f, 0.0760290399f, 0.196149588f, 0.251782864f, -0.127145901f,
+            -0.236419812f, -0.217668042f, -0.301212728f, 0.0576330386f, -0.150419369f, -0.133148015f,
+            -0.0327416062f, -0.0205228627f, 0.0224798601f, 0.129471764f, -0.208161518f, -0.0791121051f,
+            0.348917425f, 0.13700664f, 0.085311912f, 0.0556785651f, -0.0308749545f, 0.0613671131f,
+            0.324431002f, 0.317930549f, 0.150991946f, 0.00920490921f, 0.00112058537f, -0.0700193867f,
+            0.0476146974f, 0.188679472f, 0.223893777f, 0.372941524f, 0.19096151f, -0.0398110747f,
+            -0.0142575493f, 0.122212477f, 0.133655861f, -0.00765712187f, 0.0698893517f, -0.118555203f,
+            -0.0442928411f, 0.285802633f, 0.139692724f, -0.317230493f, 0.0312360246f, 0.119002745f,
+            -0.193430617f, -0.151350483f, 0.193826392f, -0.0239625294f, 0.144660026f, 0.0210071281f,
+            -0.277761459f, -0.172036633f, 0.161095381f, 0.179128185f, -0.144379959f, -0.125959113f,
+            0.0190106407f, 0.0351665542f, -0.190100506f, -0.201226383f, -0.217991397f, -0.3138237f,
+            0.065887697f, 0.0993377492f, 0.149563462f, 0.014010801f, -0.0694552958f, 0.225482732f,
+            0.362122625f, 0.169906184f, -0.00404929556f, 0.110669091f, 0.339218467f, 0.169918209f,
+            -0.000261679903f, 0.254185021f, 0.0176265463f, -0.0580272153f, -0.010930948f, 0.310105294f,
+            0.433544427f, 0.1719006f, 0.204774052f, 0.236215875f, 0.0796661973f, -0.122199267f,
+            0.0477879904f, -0.0370786525f, -0.138393804f, -0.22759971f, 0.0513460003f, 0.268420041f,
+            0.0957251787f, 0.105129607f, 0.0565933548f, 0.0812305436f, -0.035652779f, -0.0540127084f,
+            0.0448158756f, -0.0307797622f, -0.00409694063f, 0.325704098f, 0.0827584043f, -0.210998341f,
+            -0.115237191f, 0.0377134755f, -0.00622503972f, -0.251391828f, -0.048882328f, 0.400051594f,
+            0.0725890249f, -0.251082182f, -0.505571246f, -0.372787744f, -0.0769636631f, 0.0544653684f,
+            -0.0780422762f, 0.124575518f, -0.00893601496f, -0.320650846f, -0.504996598f, -0.407224268f,
+            -0.185766295f, 0.128418848f, 0.317495257f, 0.0166804045f, 0.171095073f, -0.04183596f,
+            -0.0487669669f, -0.313449919f, -0.213201731f, -0.0260265116f, -0.208439335f, -0.094486028f,
+            -0.116213724f, -0.496589571f, 0.450485766f, 0.10774228f, -0.0059851585f, -0.173869997f,
+            -0.288609058f, 0.101791605f, 0.261918008f, -0.0302839652f, -0.274650872f, 0.0827417448f,
+            -0.0350264683f, 0.134909943f, 0.125805289f, 0.279928952f, 0.20541808f, 0.0317731202f,
+            0.113332599f, 0.0203323737f, -0.0565536693f, -0.340542823f, 0.335931957f, -0.00733409636f,
+            0.0150685664f, 0.00936259609f, 0.0879211649f, 0.13790001f, -0.156425029f, 0.107663393f,
+            0.286267787f, -0.176837415f, 0.0651999414f, 0.333135098f, 0.315356851f, -0.0828100443f,
+            0.0442541912f, 0.173748791f, 0.0661663488f, 0.0958530679f, -0.0352900214f, -0.216470599f,
+            0.0338418148f, -0.00401232531f, -0.0386319533f, -0.13453801f, 0.176113367f, 0.475693554f,
+            0.182087138f, -0.0319458731f, 0.00383705134f, -0.0557649583f, 0.147198588f, 0.0957381502f,
+            -0.0524976887f, -0.147575095f, -0.286642909f, -0.254384696f, -0.0566190146f, 0.0539339297f,
+            0.00680770166f, -0.0856684372f, 0.00125017576f, 0.122629501f, -0.0105979163f, -0.202515423f,
+            -0.0602375939f, -0.0294386726f, -0.0337807052f, -0.144405901f, -0.364762276f, -0.00617205258f,
+            0.0278897304f, 0.0526204705f, 0.0339541696f, 0.22720325f, -0.0514347441f, -0.0247625448f,
+            -0.165193409f, -0.193058044f, -0.17417784f, -0.0860452801f, -0.156950116f, -0.124573536f,
+            -0.0404325612f, -0.225235432f, -0.226762727f, 0.0264382455f, -0.0154210646f, -0.000617992249f,
+            0.121591322f, -0.047127448f, -0.143890634f, 0.100789212f, 0.163015038f, 0.115563415f,
+            -0.102943301f, 0.258349925f, 0.390631497f, 0.092190586f, -0.083941333f, -0.109397583f,
+            0.183386847f, 0.157005906f, 0.0160107668f, -0.285946339f, -0.139832541f, 0.148410589f,
+            0.318549365f, 0.085151948f, -0.113814145f, -0.15709731f, -0.111127004f, -0.166618675f,
+            -0.160011947f, -0.245753646f, 0.0617778078f, 0.114579514f, 0.00859894045f, 0.067991972f,
+            -0.0771109462f, -0.145759016f, 0.235928357f, 0.0988301337f, -0.107896179f, 0.0970440879f,
+            0.214708582f, -0.0137044555f, 0.0318613388f, 0.167771026f, 0.0838679224f, 0.0772713646f,
+            0.0811426267f, 0.0169394333f, 0.0520113558f, 0.298351347f, 0.0940945297f, 0.181078687f,
+            0.371041685f, 0.103952028f, 0.133683681f, 0.0923158079f, -0.0251890887f, 0.235516608f,
+            0.119133644f, -0.1521561f, -0.244360909f, 0.0610797927f, 0.205063283f, -0.169242635f,
+            -0.238347307f, 0.175246179f, 0.179642752f, 0.263599336f, 0.0236909091f, -0.00518281898f,
+            0.0992550552f, -0.123806544f, -0.0888131931f, 0.0507430807f, 0.108079664f, 0.0821271092f,
+            0.034260828f, -0.104767837f, -0.0373270363f, 0.0718574449f, -0.245840564f, -0.20610258f,
+            -0.0721949488f, -0.0506159998f, 0.0982583612f, 0.131761283f, 0.0295035709f, -0.079671897f,
+            0.0286591388f, 0.307929814f, 0.272199273f, 0.29742831f, 0.0569425859f, -0.0217022952f,
+            -0.0973275155f, 0.0246622674f, 0.031308271f, 0.240958765f, 0.156467393f, -0.0554179698f,
+            0.0748660192f, 0.291422516f, 0.207480893f, -0.135628194f, -0.129092112f, 0.154841542f,
+            -0.0834436193f, -0.0395011045f, -0.090011254f, -0.0307868104f, 0.0566790849f, -0.0281022843f,
+            -0.1884339f, -0.178624332f, -0.127318114f, -0.0500039794f, 0.181942269f, -0.0437858142f,
+            -0.0614198186f, 0.0102773607f, 0.111752495f, 0.120875165f, 0.0715695769f, 0.128628373f,
+            0.0373537131f, -0.136525378f, 0.0998861268f, 0.103160888f, -0.143086463f, -0.326086849f,
+            -0.283136308f, -0.216354758f, 0.0619558543f, -0.0905286223f, -0.173911661f, 0.0476573333f,
+            0.00565449335f, 0.0572359785f, 0.0864783749f, 0.118514203f, -0.185058147f, -0.401503921f,
+            -0.206161991f, 0.0461316295f, 0.154874951f, -0.173351243f, 0.212075606f, 0.085709773f,
+            0.0273292456f, -0.00534122344f, 0.138689727f, 0.110281974f, -0.208992437f, -0.187600896f,
+            -0.152119935f, 0.100324273f, 0.136989802f, 0.177755773f, 0.209620893f, 0.0101977866f,
+            0.0897872075f, 0.0973500013f, -0.132542878f, -0.182921961f, -0.116356075f, -0.14162688f,
+            -0.0151933637f, 0.0392759368f, -0.207013771f, -0.350484014f, -0.00338362809f, 0.0885062814f,
+            -0.0319568366f, -0.0167152099f, -0.294845909f, -0.205762759f, -0.109321266f, -0.0263328571f,
+            0.22154811f, -0.019941777f, -0.103919409f, -0.235854834f, -0.365164727f, -0.131189317f,
+            0.124496348f, -0.106194369f, 0.0713545829f, 0.0524687991f, -0.00644599739f, -0.00145568466f,
+            0.0121917352f, -0.250399977f, -0.0681898817f, -0.00451048138f, -0.0947875157f, 0.0525861122f,
+            0.0955019146f, 0.0722198635f, 0.0908415765f, -0.00447621569f, -0.162043825f, -0.00657217996f,
+            0.0346503146f, 0.0780276135f, -0.129082024f, -0.119565919f, 0.138253629f, 0.247024f,
+            0.114276506f, 0.0626440272f, 0.175494954f, 0.206758246f, 0.132156461f, 0.384158134f,
+            0.209304556f, -0.169597238f, -0.0472252704f, -0.19887577f, -0.262593925f, -0.149114296f,
+            -0.104861528f, -0.268782884f, -0.289317608f, -0.197632447f, -0.142642081f, -0.221263483f,
+            0.178837344f, 0.138964251f, 0.222208828f, 0.032001581f, -0.2123501f, -0.15843828f,
+            0.0388077758f, -0.0662168711f, -0.0599369518f, -0.0968680084f, 0.111823432f, 0.167066827f,
+            -0.0740421861f, -0.0934559777f, -0.0804275051f, -0.102989323f, 0.295854419f, -0.0535896197f,
+            -0.112688221f, -0.126288474f, -0.052885063f, -0.160723969f, -0.2838296f, -0.384449452f,
+            -0.343062848f, -0.204326749f, -0.00136346696f, 0.0325726829f, 0.0605083555f, -0.0480106547f,
+            0.0210091341f, 0.062059883f, 0.0262609851f, -0.0106043806f, -0.379497141f, -0.0917571858f,
+            0.122417085f, -0.380346686f, -0.241545185f, 0.218939096f, 0.155781209f, 0.00633712392f,
+            -0.0772351399f, -0.104737461f, 0.137531355f, 0.0405773409f, 0.0812138692f, -0.00921111368f,
+            -0.0865168273f, -0.170541942f, -0.0362736173f, -0.0743259415f, -0.212500319f, -0.181828707f,
+            -0.0587526411f, 0.0892276615f, 0.0674269721f, 0.0226843469f, 0.0493601039f, 0.0329509079f,
+            -0.240408033f, 0.0380234718f, 0.0961833969f, -0.0900988728f, -0.0118992478f, -0.157537237f,
+            -0.319630921f, -0.420169771f, -0.191591039f, -0.206344888f, 0.195520878f, 0.158813462f,
+            0.169862539f, 0.3879278f, 0.235347927f, 0.292805821f, 0.226120636f, 0.147266716f,
+            0.0142786186f, -0.0512362793f, 0.0993067622f, 0.12755844f, 0.312009543f, 0.148895621f,
+            0.210618809f, 0.138350695f, 0.167849407f, -0.0292941183f, -0.189422026f, -0.15401645f,
+            0.25379312f, -0.0694178939f, -0.128456041f, -0.209111229f, 0.213121995f, -0.0483757891f,
+            -0.0336935073f, 0.129734397f, 0.041069448f, -0.31767118f, -0.0974146351f, -0.0637474582f,
+            -0.030770516f, -0.168486267f, -0.18043673f, -0.146402285f, 0.0120824706f, 0.103449397f,
+            0.204225138f, 0.144801438f, 0.117376216f, 0.140954524f, 0.169879213f, 0.0852207914f,
+            -0.0332709178f, -0.0377561711f, -0.0629279092f, -0.17121926f, -0.254579544f, 0.00398855982f,
+            -0.0997925177f, 0.0735437274f, 0.115772821f, -0.0900145844f, 0.0400284752f, 0.0777453035f,
+            0.0676874444f, 0.0125870993f, 0.010702068f, -0.0161445327f, -0.00324379839f, -0.0191265568f,
+            -0.0288705267f, 0.00791256595f, 0.161595047f, 0.11671485f, -0.0036612968f, 0.018279016f,
+            -0.0792204067f, -0.0447642505f, -0.187345728f, 0.0141291684f, 0.139898583f, -0.0304146595f,
+            0.0416378565f, 0.241486266f, 0.152452394f, -0.157067344f, -0.25217253f, -0.137477845f,
+            -0.0708239675f, -0.116850369f, -0.212709963f, -0.114936009f, 0.335236996f, 0.15720661f,
+            0.0699966922f, 0.0700575784f, -0.0956213325f, -0.114334621f, 0.266018122f, 0.0735780522f,
+            -0.114850335f, -0.0296442397f, 0.0636197925f, 0.0346839167f, 0.0146630201f, -0.0213799067f,
+            -0.128381431f, -0.108898208f, -0.0231821649f, -0.0917088389f, -0.200176746f, -0.116834886f,
+            -0.0590682589f, -0.101967424f, -0.114964075f, 0.0383226089f, 0.11227908f, 0.143751547f,
+            -0.0167492162f, 0.0382469445f, 0.0179661438f, -0.0548171438f, -0.26671499f, -0.509088337f,
+            -0.384457231f, -0.186034501f, -0.143002003f, 0.128719792f, 0.0145136397f, 0.147707582f,
+            0.271544129f, 0.135808542f, -0.238730282f, -0.42715174f, -0.351664841f, -0.173439562f,
+            -0.201097772f, -0.0834539235f, -0.022745993f, -0.170144483f, -0.277416587f, -0.0970290154f,
+            0.0742186978f, -0.000407138054f, -0.0265818089f, -0.0711479485f, -0.116632476f, -0.114624716f,
+            -0.197210044f, -0.0704885945f, 0.0475704819f, 0.0258752704f, -0.106154568f, -0.12516515f,
+            0.0242376905f, 0.233731389f, 0.157047704f, 0.0158253927f, -0.156192064f, -0.436031103f,
+            -0.25324285f, -0.273840606f, -0.099318862f, -0.306986749f, -0.33020094f, -0.138472974f,
+            -0.0595588051f, 0.00860654283f, -0.157867804f, 0.0833709687f, 0.28466785f, 0.150308266f,
+            -0.252468348f, -0.534627199f, -0.254798055f, 0.175208509f, 0.0594900958f, 0.0731203482f,
+            0.244286016f, 0.0255845897f, -0.219612509f, -0.246858656f, -0.0684984475f, 0.112836689f,
+            0.127222151f, 0.0416458398f, -0.0327340141f, -0.0280867107f, -0.0157157034f, 0.000559562759f,
+            0.0393738672f, 0.1243001f, 0.116000786f, -0.0341525823f, -0.182471305f, -0.273565203f,
+            -0.248357952f, -0.0708335638f, -0.323015034f, -0.402944684f, -0.206204891f, -0.0404607393f,
+            0.0786686763f, 0.0306861587f, -0.168671221f, -0.301578134f, 0.0134852882f, 0.050158184f,
+            0.051358439f, -0.0445537046f, -0.164108902f, -0.290958047f, -0.0612747595f, 0.338516921f,
+            0.358639389f, 0.192596123f, 0.0955146849f, -0.175186291f, 0.132728353f, 0.116393916f,
+            0.00323195662f, -0.129222915f, -0.226385161f, -0.178211719f, -0.0748163089f, -0.278421998f,
+            -0.0622930117f, 0.254082054f, 0.180688351f, -0.00304479059f, -0.129814148f, -0.219570979f,
+            -0.309875101f, -0.12670368f, -0.0945380256f, -0.214752287f, -0.103730738f, -0.0826093107f,
+            -0.244726166f, -0.0722917244f, 0.147581697f, 0.195465222f, -0.0513962395f, -0.442362249f,
+            -0.466012537f, -0.27035594f, -0.131296381f, 0.0414989628f, 0.00925199036f, -0.147742078f,
+            -0.229386196f, -0.237572104f, -0.392319053f, -0.0559929647f, 0.284579784f, 0.388435662f,
+            0.317100942f, -0.110492676f, 0.0836959854f, -0.00699559832f, 0.00293976767f, -0.0398374423f,
+            -0.212202817f, -0.20731318f, -0.000152269306f, 0.194872901f, 0.159468785f, -0.0417440236f,
+            0.0077748904f, 0.0250295382f, -0.0387222692f, -0.0754915252f, -0.213404089f, -0.151460513f,
+            -0.147654757f, -0.138143748f, 0.0112728141f, 0.210777462f,
+            };
+            return table;
+        }
+    }
+}
+
+#endif // DLIB_FRONTAL_FACE_DETECTOR_TABLe_Hh_
+
@@ -361,6 +361,23 @@ namespace dlib
         long _nc;
     };
 
+// ----------------------------------------------------------------------------------------
+
+    template <typename view_type>
+    struct has_contiguous_rows
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                value is true if pixel c+1 of every row of a view_type (e.g. a
+                const_image_view) comes right after pixel c in memory, so that code
+                may read a run of pixels starting at &view[r][c] directly.  This is
+                true of the views defined in this file, since they assume it.  An
+                image type whose const_image_view is specialized to read its rows
+                with some other stride must specialize this to false for that view.
+        !*/
+        const static bool value = true;
+    };
+
 // ----------------------------------------------------------------------------------------
 
     template <typename image_type>
@@ -0,0 +1,419 @@
+// Copyright (C) 2017  Davis E. King (davis@dlib.net)
+// License: Boost Software License   See LICENSE.txt for the full license.
+#ifndef DLIB_MAPPED_SHAPE_PREDICToR_H_
+#define DLIB_MAPPED_SHAPE_PREDICToR_H_
+
+#include "mapped_shape_predictor_abstract.h"
+#include "shape_predictor.h"
+#include "../platform.h"
+#include "../noncopyable.h"
+#include "../uintn.h"
+#include <fstream>
+#include <memory>
+#include <cstring>
+
+#ifdef POSIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace dlib
+{
+
+// ----------------------------------------------------------------------------------------
+
+    namespace impl
+    {
+        /*
+            Layout of a mapped shape_predictor file.  Everything is stored in the byte
+            order of the machine that wrote the file, which is recorded by endian_marker.
+            All offsets are in bytes from the start of the file and every array starts on
+            a 16 byte boundary, so the arrays can be used in place once the file is
+            mapped.
+        */
+        const char mapped_sp_magic[8] = {'d','l','i','b','s','p','m','1'};
+        const uint32 mapped_sp_endian_marker = 0x01020304;
+
+        struct mapped_sp_header
+        {
+            char magic[8];
+            uint32 endian_marker;
+            uint32 leaf_type;
+            uint32 dims;
+            uint32 num_cascades;
+            uint64 initial_shape_offset;    // float[dims]
+            uint64 cascades_offset;         // mapped_sp_cascade[num_cascades]
+        };
+
+        struct mapped_sp_cascade
+        {
+            uint32 num_trees;
+            uint32 num_splits;
+            uint32 num_pixels;
+            uint32 reserved;
+            uint64 tree_start_offset;       // uint32[num_trees+1]
+            uint64 splits_offset;           // packed_split[num_splits]
+            uint64 leaf_values_offset;      // (num_splits+num_trees)*dims values of leaf_type
+            uint64 leaf_scale_offset;       // float[num_trees], only for int8_leaves
+            uint64 anchor_idx_offset;       // uint32[num_pixels]
+            uint64 deltas_offset;           // float[2*num_pixels]
+        };
+
+        COMPILE_TIME_ASSERT(sizeof(mapped_sp_header) == 40);
+        COMPILE_TIME_ASSERT(sizeof(mapped_sp_cascade) == 64);
+        COMPILE_TIME_ASSERT(sizeof(packed_split) == 12);
+
+        inline unsigned long leaf_type_size (
+            shape_predictor_leaf_type leaf_type
+        )
+        {
+            switch (leaf_type)
+            {
+                case float16_leaves: return sizeof(uint16);
+                case int8_leaves: return sizeof(signed char);
+                default: return sizeof(float);
+            }
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        class mapped_file : noncopyable
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    A read-only mapping of a whole file.  On POSIX systems the file is
+                    mmap()ed, so its pages are only read in when they are touched and are
+                    shared through the page cache by every process mapping the same file.
+                    Elsewhere the file is simply read into memory.
+            !*/
+        public:
+            explicit mapped_file (
+                const std::string& filename
+            ) : _data(0), _size(0)
+            {
+#ifdef POSIX
+                int fd = ::open(filename.c_str(), O_RDONLY);
+                if (fd == -1)
+                    throw serialization_error("Unable to open " + filename + " for reading.");
+                struct stat st;
+                if (::fstat(fd, &st) == -1 || st.st_size == 0)
+                {
+                    ::close(fd);
+                    throw serialization_error("Unable to read " + filename + ".");
+                }
+                _size = st.st_size;
+                void* p = ::mmap(0, _size, PROT_READ, MAP_SHARED, fd, 0);
+                ::close(fd);
+                if (p == MAP_FAILED)
+                    throw serialization_error("Unable to map " + filename + " into memory.");
+                _data = (const char*)p;
+#else
+                std::ifstream fin(filename.c_str(), std::ios::binary);
+                if (!fin)
+                    throw serialization_error("Unable to open " + filename + " for reading.");
+                fin.seekg(0, std::ios::end);
+                _size = fin.tellg();
+                fin.seekg(0, std::ios::beg);
+                // use uint64 storage so the buffer is at least 8 byte aligned
+                buf.resize((_size+7)/8);
+                if (_size != 0)
+                    fin.read((char*)&buf[0], _size);
+                if (!fin)
+                    throw serialization_error("Unable to read " + filename + ".");
+                _data = (const char*)&buf[0];
+#endif
+            }
+
+            ~mapped_file (
+            )
+            {
+#ifdef POSIX
+                if (_data)
+                    ::munmap((void*)_data, _size);
+#endif
+            }
+
+            const char* data() const { return _data; }
+            uint64 size() const { return _size; }
+
+        private:
+            const char* _data;
+            uint64 _size;
+#ifndef POSIX
+            std::vector<uint64> buf;
+#endif
+        };
+
+    // ------------------------------------------------------------------------------------
+
+        inline void write_mapped_array (
+            std::ofstream& out,
+            const void* data,
+            uint64 num_bytes,
+            uint64& offset
+        )
+        /*!
+            ensures
+                - pads out to a 16 byte boundary, writes the given bytes there and sets
+                  #offset to where they start.
+        !*/
+        {
+            const char zeros[16] = {0};
+            uint64 pos = (uint64)out.tellp();
+            if (pos%16 != 0)
+                out.write(zeros, 16 - pos%16);
+            offset = (uint64)out.tellp();
+            if (num_bytes != 0)
+                out.write((const char*)data, num_bytes);
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    inline void save_mapped_shape_predictor (
+        const shape_predictor& item,
+        const std::string& filename
+    )
+    {
+        using namespace impl;
+        std::ofstream out(filename.c_str(), std::ios::binary);
+        if (!out)
+            throw serialization_error("Unable to open " + filename + " for writing.");
+
+        mapped_sp_header header;
+        std::memcpy(header.magic, mapped_sp_magic, sizeof(header.magic));
+        header.endian_marker = mapped_sp_endian_marker;
+        header.leaf_type = item.get_leaf_type();
+        header.dims = item.initial_shape.size();
+        header.num_cascades = item.forests.size();
+        out.write((const char*)&header, sizeof(header));
+
+        std::vector<mapped_sp_cascade> cascades(item.forests.size());
+        std::vector<float> initial_shape(item.initial_shape.begin(), item.initial_shape.end());
+        write_mapped_array(out, initial_shape.size() ? &initial_shape[0] : 0,
+                           initial_shape.size()*sizeof(float), header.initial_shape_offset);
+        for (unsigned long i = 0; i < item.forests.size(); ++i)
+        {
+            const forest_view forest = item.forests[i].view();
+            const unsigned long num_splits = item.forests[i].splits.size();
+            mapped_sp_cascade& c = cascades[i];
+            c.num_trees = forest.num_trees;
+            c.num_splits = num_splits;
+            c.num_pixels = item.anchor_idx[i].size();
+            c.reserved = 0;
+
+            write_mapped_array(out, forest.tree_start, (forest.num_trees+1)*sizeof(uint32), c.tree_start_offset);
+            write_mapped_array(out, forest.splits, num_splits*sizeof(packed_split), c.splits_offset);
+
+            const uint64 num_leaf_bytes = item.forests[i].num_leaf_elements()*leaf_type_size(forest.leaf_type);
+            if (forest.leaf_type == float16_leaves)
+                write_mapped_array(out, forest.leaf_values_f16, num_leaf_bytes, c.leaf_values_offset);
+            else if (forest.leaf_type == int8_leaves)
+                write_mapped_array(out, forest.leaf_values_i8, num_leaf_bytes, c.leaf_values_offset);
+            else
+                write_mapped_array(out, forest.leaf_values, num_leaf_bytes, c.leaf_values_offset);
+
+            if (forest.leaf_type == int8_leaves)
+                write_mapped_array(out, forest.leaf_scale, forest.num_trees*sizeof(float), c.leaf_scale_offset);
+            else
+                c.leaf_scale_offset = 0;
+
+            std::vector<uint32> anchor_idx(item.anchor_idx[i].begin(), item.anchor_idx[i].end());
+            std::vector<float> deltas;
+            for (unsigned long j = 0; j < item.deltas[i].size(); ++j)
+            {
+                deltas.push_back(item.deltas[i][j].x());
+                deltas.push_back(item.deltas[i][j].y());
+            }
+            write_mapped_array(out, anchor_idx.size() ? &anchor_idx[0] : 0,
+                               anchor_idx.size()*sizeof(uint32), c.anchor_idx_offset);
+            write_mapped_array(out, deltas.size() ? &deltas[0] : 0,
+                               deltas.size()*sizeof(float), c.deltas_offset);
+        }
+        write_mapped_array(out, cascades.size() ? &cascades[0] : 0,
+                           cascades.size()*sizeof(mapped_sp_cascade), header.cascades_offset);
+
+        // now that all the offsets are known, write the real header
+        out.seekp(0);
+        out.write((const char*)&header, sizeof(header));
+        if (!out)
+            throw serialization_error("Error writing " + filename + ".");
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    class mapped_shape_predictor
+    {
+    public:
+
+        mapped_shape_predictor (
+        )
+        {}
+
+        explicit mapped_shape_predictor (
+            const std::string& filename
+        )
+        {
+            load(filename);
+        }
+
+        void load (
+            const std::string& filename
+        )
+        {
+            using namespace impl;
+            std::shared_ptr<mapped_file> file(new mapped_file(filename));
+            const char* base = file->data();
+            const uint64 size = file->size();
+
+            if (size < sizeof(mapped_sp_header))
+                throw serialization_error("The file " + filename + " is not a mapped shape_predictor.");
+            const mapped_sp_header& header = *(const mapped_sp_header*)base;
+            if (std::memcmp(header.magic, mapped_sp_magic, sizeof(header.magic)) != 0)
+                throw serialization_error("The file " + filename + " is not a mapped shape_predictor.");
+            if (header.endian_marker != mapped_sp_endian_marker)
+                throw serialization_error("The file " + filename + " was written on a machine with a different byte order.");
+            if (header.leaf_type != float32_leaves && header.leaf_type != float16_leaves && header.leaf_type != int8_leaves)
+                throw serialization_error("Unknown leaf type found in " + filename + ".");
+            const shape_predictor_leaf_type leaf_type = (shape_predictor_leaf_type)header.leaf_type;
+
+            const float* shape = array_at<float>(file, header.initial_shape_offset, header.dims, filename);
+            const mapped_sp_cascade* cascades = array_at<mapped_sp_cascade>(file, header.cascades_offset,
+                                                                            header.num_cascades, filename);
+
+            matrix<float,0,1> new_initial_shape(header.dims);
+            std::copy(shape, shape+header.dims, new_initial_shape.begin());
+            std::vector<forest_view> new_forests(header.num_cascades);
+            std::vector<std::vector<unsigned long> > new_anchor_idx(header.num_cascades);
+            std::vector<std::vector<dlib::vector<float,2> > > new_deltas(header.num_cascades);
+            for (unsigned long i = 0; i < header.num_cascades; ++i)
+            {
+                const mapped_sp_cascade& c = cascades[i];
+                forest_view& f = new_forests[i];
+                f.num_trees = c.num_trees;
+                f.dims = header.dims;
+                f.leaf_type = leaf_type;
+                f.tree_start = array_at<uint32>(file, c.tree_start_offset, c.num_trees+1, filename);
+                f.splits = array_at<packed_split>(file, c.splits_offset, c.num_splits, filename);
+                const uint64 num_leaf_values = ((uint64)c.num_splits + c.num_trees)*header.dims;
+                f.leaf_values = 0;
+                f.leaf_values_f16 = 0;
+                f.leaf_values_i8 = 0;
+                f.leaf_scale = 0;
+                if (leaf_type == float16_leaves)
+                    f.leaf_values_f16 = array_at<uint16>(file, c.leaf_values_offset, num_leaf_values, filename);
+                else if (leaf_type == int8_leaves)
+                    f.leaf_values_i8 = array_at<signed char>(file, c.leaf_values_offset, num_leaf_values, filename);
+                else
+                    f.leaf_values = array_at<float>(file, c.leaf_values_offset, num_leaf_values, filename);
+                if (leaf_type == int8_leaves)
+                    f.leaf_scale = array_at<float>(file, c.leaf_scale_offset, c.num_trees, filename);
+
+                // Check the tree structure so a damaged file can't make inference read
+                // outside the mapping.  The leaf tables themselves are not touched here.
+                if (f.tree_start[0] != 0 || f.tree_start[c.num_trees] != c.num_splits)
+                    throw serialization_error("Corrupt trees found in " + filename + ".");
+                for (unsigned long t = 0; t < c.num_trees; ++t)
+                {
+                    if (f.tree_start[t] > f.tree_start[t+1])
+                        throw serialization_error("Corrupt trees found in " + filename + ".");
+                }
+                for (unsigned long j = 0; j < c.num_splits; ++j)
+                {
+                    if (f.splits[j].idx1 >= c.num_pixels || f.splits[j].idx2 >= c.num_pixels)
+                        throw serialization_error("Corrupt splits found in " + filename + ".");
+                }
+
+                // The pixel encodings are tiny, so they are copied out of the file.
+                const uint32* anchor_idx = array_at<uint32>(file, c.anchor_idx_offset, c.num_pixels, filename);
+                const float* deltas = array_at<float>(file, c.deltas_offset, 2*(uint64)c.num_pixels, filename);
+                new_anchor_idx[i].resize(c.num_pixels);
+                new_deltas[i].resize(c.num_pixels);
+                for (unsigned long j = 0; j < c.num_pixels; ++j)
+                {
+                    if (anchor_idx[j] >= header.dims/2)
+                        throw serialization_error("Corrupt pixel anchors found in " + filename + ".");
+                    new_anchor_idx[i][j] = anchor_idx[j];
+                    new_deltas[i][j] = dlib::vector<float,2>(deltas[2*j], deltas[2*j+1]);
+                }
+            }
+
+            data = file;
+            initial_shape.swap(new_initial_shape);
+            forests.swap(new_forests);
+            anchor_idx.swap(new_anchor_idx);
+            deltas.swap(new_deltas);
+        }
+
+        unsigned long num_parts (
+        ) const
+        {
+            return initial_shape.size()/2;
+        }
+
+        shape_predictor_leaf_type get_leaf_type (
+        ) const
+        {
+            if (forests.size() == 0)
+                return float32_leaves;
+            return forests[0].leaf_type;
+        }
+
+        template <typename image_type>
+        full_object_detection operator()(
+            const image_type& img,
+            const rectangle& rect
+        ) const
+        {
+            using namespace impl;
+            matrix<float,0,1> current_shape = initial_shape;
+            std::vector<float> feature_pixel_values;
+            for (unsigned long iter = 0; iter < forests.size(); ++iter)
+            {
+                extract_feature_pixel_values(img, rect, current_shape, initial_shape,
+                                             anchor_idx[iter], deltas[iter], feature_pixel_values);
+                unsigned long leaf_idx;
+                // evaluate all the trees at this level of the cascade.
+                const forest_view& forest = forests[iter];
+                for (unsigned long i = 0; i < forest.num_trees; ++i)
+                    forest.add_leaf(&current_shape(0), i, forest.find_leaf(i, feature_pixel_values, leaf_idx));
+            }
+
+            // convert the current_shape into a full_object_detection
+            const point_transform_affine tform_to_img = unnormalizing_tform(rect);
+            std::vector<point> parts(current_shape.size()/2);
+            for (unsigned long i = 0; i < parts.size(); ++i)
+                parts[i] = tform_to_img(location(current_shape, i));
+            return full_object_detection(rect, parts);
+        }
+
+    private:
+
+        template <typename T>
+        static const T* array_at (
+            const std::shared_ptr<impl::mapped_file>& file,
+            uint64 offset,
+            uint64 num,
+            const std::string& filename
+        )
+        {
+            if (offset%sizeof(float) != 0 || offset > file->size() || num > (file->size() - offset)/sizeof(T))
+                throw serialization_error("The file " + filename + " is truncated or corrupt.");
+            return (const T*)(file->data() + offset);
+        }
+
+        // The forests point into data, so copies of this object share the mapping.
+        std::shared_ptr<impl::mapped_file> data;
+        matrix<float,0,1> initial_shape;
+        std::vector<impl::forest_view> forests;
+        std::vector<std::vector<unsigned long> > anchor_idx;
+        std::vector<std::vector<dlib::vector<float,2> > > deltas;
+    };
+
+// ----------------------------------------------------------------------------------------
+
+}
+
+#endif // DLIB_MAPPED_SHAPE_PREDICToR_H_
@@ -0,0 +1,116 @@
+// Copyright (C) 2017  Davis E. King (davis@dlib.net)
+// License: Boost Software License   See LICENSE.txt for the full license.
+#undef DLIB_MAPPED_SHAPE_PREDICToR_ABSTRACT_H_
+#ifdef DLIB_MAPPED_SHAPE_PREDICToR_ABSTRACT_H_
+
+#include "shape_predictor_abstract.h"
+#include <string>
+
+namespace dlib
+{
+
+// ----------------------------------------------------------------------------------------
+
+    void save_mapped_shape_predictor (
+        const shape_predictor& sp,
+        const std::string& filename
+    );
+    /*!
+        ensures
+            - Writes sp to the given file in a form that mapped_shape_predictor can run
+              from in place.  The leaf type of sp (see shape_predictor::get_leaf_type())
+              is kept, so quantized models stay quantized.
+            - This is the way to convert an existing shape_predictor .dat file: load it
+              with deserialize(), optionally call set_leaf_type(), and save it with this
+              function.
+            - The file is written in the byte order of this machine and can only be
+              loaded on machines with the same byte order.
+        throws
+            - serialization_error if the file can't be written.
+    !*/
+
+// ----------------------------------------------------------------------------------------
+
+    class mapped_shape_predictor
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This object predicts the same shapes as a shape_predictor but runs
+                directly from a file written by save_mapped_shape_predictor().  On POSIX
+                systems the file is memory mapped, so loading it only reads and checks the
+                tree structure.  The split and leaf tables of each cascade level are paged
+                in by the OS the first time that level is evaluated, and the pages are
+                shared by every process that maps the same file.  On other systems the
+                file is read into memory.
+
+                Copying a mapped_shape_predictor is cheap, all the copies share the same
+                mapping.
+
+            THREAD SAFETY
+                operator() is const and may be called from several threads at once.
+        !*/
+
+    public:
+
+        mapped_shape_predictor (
+        );
+        /*!
+            ensures
+                - #num_parts() == 0
+        !*/
+
+        explicit mapped_shape_predictor (
+            const std::string& filename
+        );
+        /*!
+            ensures
+                - calls load(filename)
+        !*/
+
+        void load (
+            const std::string& filename
+        );
+        /*!
+            ensures
+                - maps the given file and makes *this run from it.
+            throws
+                - serialization_error if the file can't be opened, was not written by
+                  save_mapped_shape_predictor(), was written on a machine with a
+                  different byte order, or is truncated or corrupt.  In that case *this
+                  is unchanged.
+        !*/
+
+        unsigned long num_parts (
+        ) const;
+        /*!
+            ensures
+                - returns the number of parts in the shapes predicted by this object.
+        !*/
+
+        shape_predictor_leaf_type get_leaf_type (
+        ) const;
+        /*!
+            ensures
+                - returns the leaf type the model was saved with.
+        !*/
+
+        template <typename image_type>
+        full_object_detection operator()(
+            const image_type& img,
+            const rectangle& rect
+        ) const;
+        /*!
+            requires
+                - image_type == an image object that implements the interface defined in
+                  dlib/image_processing/generic_image.h
+            ensures
+                - returns exactly what shape_predictor::operator()(img,rect) returns for
+                  the shape_predictor the file was saved from.
+        !*/
+    };
+
+// ----------------------------------------------------------------------------------------
+
+}
+
+#endif // DLIB_MAPPED_SHAPE_PREDICToR_ABSTRACT_H_
@@ -8,6 +8,7 @@
 #include <vector>
 #include "box_overlap_testing.h"
 #include "full_object_detection.h"
+#include "../threads/thread_pool_extension.h"
 
 namespace dlib
 {
@@ -64,6 +65,96 @@ namespace dlib
         feature_vector_type w;
     };
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_scanner_type
+        >
+    void detect_all_weight_vectors (
+        const image_scanner_type& scanner,
+        const std::vector<processed_weight_vector<image_scanner_type> >& w,
+        const double adjust_threshold,
+        std::vector<std::pair<double, rectangle> >& dets,
+        std::vector<rect_detection>& dets_accum
+    )
+    /*!
+        ensures
+            - Runs scanner.detect() with every weight vector in w, in order, and stores
+              all the detections in #dets_accum.  dets is only used as scratch.
+            - This is how object_detector scans a loaded image.  A scanner that can
+              evaluate several weight vectors in one pass over the image overloads this
+              function (see scan_fhog_pyramid.h).
+    !*/
+    {
+        dets_accum.clear();
+        for (unsigned long i = 0; i < w.size(); ++i)
+        {
+            const double thresh = w[i].w(scanner.get_num_dimensions());
+            scanner.detect(w[i].get_detect_argument(), dets, thresh + adjust_threshold);
+            for (unsigned long j = 0; j < dets.size(); ++j)
+            {
+                rect_detection temp;
+                temp.detection_confidence = dets[j].first-thresh;
+                temp.weight_index = i;
+                temp.rect = dets[j].second;
+                dets_accum.push_back(temp);
+            }
+        }
+    }
+
+    template <
+        typename image_scanner_type
+        >
+    void detect_all_weight_vectors (
+        const image_scanner_type& scanner,
+        typename image_scanner_type::workspace& ws,
+        const std::vector<processed_weight_vector<image_scanner_type> >& w,
+        const double adjust_threshold,
+        std::vector<std::pair<double, rectangle> >& dets,
+        std::vector<rect_detection>& dets_accum
+    )
+    /*!
+        ensures
+            - Like the version above, but scans the image loaded into ws.
+    !*/
+    {
+        dets_accum.clear();
+        for (unsigned long i = 0; i < w.size(); ++i)
+        {
+            const double thresh = w[i].w(scanner.get_num_dimensions());
+            scanner.detect(ws, w[i].get_detect_argument(), dets, thresh + adjust_threshold);
+            for (unsigned long j = 0; j < dets.size(); ++j)
+            {
+                rect_detection temp;
+                temp.detection_confidence = dets[j].first-thresh;
+                temp.weight_index = i;
+                temp.rect = dets[j].second;
+                dets_accum.push_back(temp);
+            }
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <typename image_scanner_type_>
+    class object_detector;
+
+    template <
+        typename image_scanner_type
+        >
+    class object_detector_workspace
+    {
+    public:
+        object_detector_workspace() {}
+
+    private:
+        friend class object_detector<image_scanner_type>;
+
+        typename image_scanner_type::workspace scanner_ws;
+        std::vector<std::pair<double, rectangle> > dets;
+        std::vector<rect_detection> dets_accum;
+    };
+
 // ----------------------------------------------------------------------------------------
 
     template <
@@ -74,6 +165,7 @@ namespace dlib
     public:
         typedef image_scanner_type_ image_scanner_type;
         typedef typename image_scanner_type::feature_vector_type feature_vector_type;
+        typedef object_detector_workspace<image_scanner_type> workspace;
 
         object_detector (
         );
@@ -94,6 +186,12 @@ namespace dlib
             const std::vector<feature_vector_type>& w_ 
         );
 
+        object_detector (
+            const image_scanner_type& scanner_, 
+            const test_box_overlap& overlap_tester_,
+            const std::vector<processed_weight_vector<image_scanner_type> >& w_ 
+        );
+
         explicit object_detector (
             const std::vector<object_detector>& detectors
         );
@@ -168,6 +266,25 @@ namespace dlib
             double adjust_threshold = 0
         );
 
+        template <
+            typename image_type
+            >
+        void operator() (
+            const image_type& img,
+            std::vector<rect_detection>& final_dets,
+            double adjust_threshold,
+            thread_pool& tp
+        );
+
+        template <
+            typename image_type
+            >
+        std::vector<rectangle> operator() (
+            const image_type& img,
+            thread_pool& tp,
+            double adjust_threshold = 0
+        );
+
         template <
             typename image_type
             >
@@ -177,6 +294,27 @@ namespace dlib
             double adjust_threshold = 0
         );
 
+        template <
+            typename image_type
+            >
+        void detect (
+            const image_type& img,
+            workspace& ws,
+            std::vector<rect_detection>& final_dets,
+            double adjust_threshold = 0
+        ) const;
+
+        template <
+            typename image_type
+            >
+        void detect (
+            const image_type& img,
+            workspace& ws,
+            std::vector<rect_detection>& final_dets,
+            double adjust_threshold,
+            thread_pool& tp
+        ) const;
+
         template <typename T>
         friend void serialize (
             const object_detector<T>& item,
@@ -191,6 +329,22 @@ namespace dlib
 
     private:
 
+        void detect_loaded (
+            std::vector<rect_detection>& final_dets,
+            double adjust_threshold
+        );
+
+        void detect_loaded (
+            workspace& ws,
+            std::vector<rect_detection>& final_dets,
+            double adjust_threshold
+        ) const;
+
+        void suppress_overlaps (
+            std::vector<rect_detection>& dets_accum,
+            std::vector<rect_detection>& final_dets
+        ) const;
+
         bool overlaps_any_box (
             const std::vector<rect_detection>& rects,
             const dlib::rectangle& rect
@@ -370,6 +524,46 @@ namespace dlib
         }
     }
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_scanner_type
+        >
+    object_detector<image_scanner_type>::
+    object_detector (
+        const image_scanner_type& scanner_, 
+        const test_box_overlap& overlap_tester,
+        const std::vector<processed_weight_vector<image_scanner_type> >& w_ 
+    ) :
+        boxes_overlap(overlap_tester)
+    {
+        // make sure requires clause is not broken
+        DLIB_CASSERT(scanner_.get_num_detection_templates() > 0 && w_.size() > 0,
+            "\t object_detector::object_detector(scanner_,overlap_tester,w_)"
+            << "\n\t Invalid inputs were given to this function "
+            << "\n\t scanner_.get_num_detection_templates(): " << scanner_.get_num_detection_templates()
+            << "\n\t w_.size():                     " << w_.size()
+            << "\n\t this: " << this
+            );
+
+        for (unsigned long i = 0; i < w_.size(); ++i)
+        {
+            DLIB_CASSERT(w_[i].w.size() == scanner_.get_num_dimensions() + 1, 
+                "\t object_detector::object_detector(scanner_,overlap_tester,w_)"
+                << "\n\t Invalid inputs were given to this function "
+                << "\n\t scanner_.get_num_detection_templates(): " << scanner_.get_num_detection_templates()
+                << "\n\t w_["<<i<<"].w.size():                   " << w_[i].w.size()
+                << "\n\t scanner_.get_num_dimensions(): " << scanner_.get_num_dimensions()
+                << "\n\t this: " << this
+                );
+        }
+
+        // The weight vectors are already processed, so unlike the constructor above
+        // this one doesn't call init() on them.
+        scanner.copy_configuration(scanner_);
+        w = w_;
+    }
+
 // ----------------------------------------------------------------------------------------
 
     template <
@@ -431,22 +625,100 @@ namespace dlib
     ) 
     {
         scanner.load(img);
+        detect_loaded(final_dets, adjust_threshold);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_scanner_type
+        >
+    template <
+        typename image_type
+        >
+    void object_detector<image_scanner_type>::
+    operator() (
+        const image_type& img,
+        std::vector<rect_detection>& final_dets,
+        double adjust_threshold,
+        thread_pool& tp
+    ) 
+    {
+        scanner.load(img, tp);
+        detect_loaded(final_dets, adjust_threshold);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_scanner_type
+        >
+    template <
+        typename image_type
+        >
+    std::vector<rectangle> object_detector<image_scanner_type>::
+    operator() (
+        const image_type& img,
+        thread_pool& tp,
+        double adjust_threshold
+    ) 
+    {
+        std::vector<rect_detection> dets;
+        (*this)(img,dets,adjust_threshold,tp);
+
+        std::vector<rectangle> final_dets(dets.size());
+        for (unsigned long i = 0; i < dets.size(); ++i)
+            final_dets[i] = dets[i].rect;
+
+        return final_dets;
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_scanner_type
+        >
+    void object_detector<image_scanner_type>::
+    detect_loaded (
+        std::vector<rect_detection>& final_dets,
+        double adjust_threshold
+    ) 
+    {
         std::vector<std::pair<double, rectangle> > dets;
         std::vector<rect_detection> dets_accum;
-        for (unsigned long i = 0; i < w.size(); ++i)
-        {
-            const double thresh = w[i].w(scanner.get_num_dimensions());
-            scanner.detect(w[i].get_detect_argument(), dets, thresh + adjust_threshold);
-            for (unsigned long j = 0; j < dets.size(); ++j)
-            {
-                rect_detection temp;
-                temp.detection_confidence = dets[j].first-thresh;
-                temp.weight_index = i;
-                temp.rect = dets[j].second;
-                dets_accum.push_back(temp);
-            }
-        }
+        detect_all_weight_vectors(scanner, w, adjust_threshold, dets, dets_accum);
+
+        suppress_overlaps(dets_accum, final_dets);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_scanner_type
+        >
+    void object_detector<image_scanner_type>::
+    detect_loaded (
+        workspace& ws,
+        std::vector<rect_detection>& final_dets,
+        double adjust_threshold
+    ) const
+    {
+        detect_all_weight_vectors(scanner, ws.scanner_ws, w, adjust_threshold, ws.dets, ws.dets_accum);
+
+        suppress_overlaps(ws.dets_accum, final_dets);
+    }
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_scanner_type
+        >
+    void object_detector<image_scanner_type>::
+    suppress_overlaps (
+        std::vector<rect_detection>& dets_accum,
+        std::vector<rect_detection>& final_dets
+    ) const
+    {
         // Do non-max suppression
         final_dets.clear();
         if (w.size() > 1)
@@ -460,6 +732,47 @@ namespace dlib
         }
     }
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_scanner_type
+        >
+    template <
+        typename image_type
+        >
+    void object_detector<image_scanner_type>::
+    detect (
+        const image_type& img,
+        workspace& ws,
+        std::vector<rect_detection>& final_dets,
+        double adjust_threshold
+    ) const
+    {
+        scanner.load(img, ws.scanner_ws);
+        detect_loaded(ws, final_dets, adjust_threshold);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_scanner_type
+        >
+    template <
+        typename image_type
+        >
+    void object_detector<image_scanner_type>::
+    detect (
+        const image_type& img,
+        workspace& ws,
+        std::vector<rect_detection>& final_dets,
+        double adjust_threshold,
+        thread_pool& tp
+    ) const
+    {
+        scanner.load(img, ws.scanner_ws, tp);
+        detect_loaded(ws, final_dets, adjust_threshold);
+    }
+
 // ----------------------------------------------------------------------------------------
 
     template <
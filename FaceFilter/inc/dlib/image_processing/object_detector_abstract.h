@@ -7,6 +7,7 @@
 #include <vector>
 #include "box_overlap_testing_abstract.h"
 #include "full_object_detection_abstract.h"
+#include "../threads/thread_pool_extension_abstract.h"
 
 namespace dlib
 {
@@ -27,6 +28,32 @@ namespace dlib
         full_object_detection rect;
     };
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_scanner_type
+        >
+    class object_detector_workspace
+    {
+        /*!
+            REQUIREMENTS ON image_scanner_type
+                image_scanner_type must define a workspace type, like
+                scan_fhog_pyramid::workspace, and the const load(img,ws) and
+                detect(ws,w,dets,thresh) routines that use it.
+
+            WHAT THIS OBJECT REPRESENTS
+                This object holds the per-image state of an object_detector: the
+                scanner's workspace and the lists the detections are gathered in.
+                Giving every thread its own workspace lets them all run the const
+                object_detector::detect() routines on one shared detector.  Reusing a
+                workspace for a stream of same sized images avoids allocating memory
+                after the first image.
+        !*/
+    public:
+        object_detector_workspace(
+        );
+    };
+
 // ----------------------------------------------------------------------------------------
 
     template <
@@ -67,6 +94,7 @@ namespace dlib
     public:
         typedef image_scanner_type_ image_scanner_type;
         typedef typename image_scanner_type::feature_vector_type feature_vector_type;
+        typedef object_detector_workspace<image_scanner_type> workspace;
 
         object_detector (
         );
@@ -143,6 +171,34 @@ namespace dlib
                   I.e. the copy is done using copy_configuration())
         !*/
 
+        object_detector (
+            const image_scanner_type& scanner, 
+            const test_box_overlap& overlap_tester,
+            const std::vector<processed_weight_vector<image_scanner_type> >& w 
+        );
+        /*!
+            requires
+                - for all valid i:
+                    - w[i].w.size() == scanner.get_num_dimensions() + 1
+                    - w[i] holds what w[i].init(scanner) leaves in it, e.g. because
+                      it was returned by get_processed_w() of a detector whose
+                      scanner makes the same feature vectors as scanner.
+                - scanner.get_num_detection_templates() > 0
+                - w.size() > 0
+            ensures
+                - Like the constructor above, except the weight vectors are used as they
+                  are.  This avoids processing them again, which for scan_fhog_pyramid
+                  means taking the SVD of every filter.
+                - for all valid i:
+                    - #get_w(i) == w[i].w
+                    - #get_processed_w(i) == w[i]
+                - #num_detectors() == w.size()
+                - #get_overlap_tester() == overlap_tester
+                - #get_scanner() == scanner
+                  (note that only the "configuration" of scanner is copied.
+                  I.e. the copy is done using copy_configuration())
+        !*/
+
         explicit object_detector (
             const std::vector<object_detector>& detectors
         );
@@ -191,6 +247,17 @@ namespace dlib
                   have the same dimension and logically each represents a different detector.
         !*/
 
+        const processed_weight_vector<image_scanner_type>& get_processed_w (
+            unsigned long idx = 0
+        ) const;
+        /*!
+            requires
+                - idx < num_detectors
+            ensures
+                - returns the idx-th weight vector along with the form get_scanner() uses
+                  it in, i.e. #get_processed_w(idx).w == get_w(idx).
+        !*/
+
         const test_box_overlap& get_overlap_tester (
         ) const;
         /*!
@@ -257,6 +324,42 @@ namespace dlib
                   of detections by setting adjust_threshold equal to negative infinity.
         !*/
 
+        template <
+            typename image_type
+            >
+        void operator() (
+            const image_type& img,
+            std::vector<rect_detection>& dets,
+            double adjust_threshold,
+            thread_pool& tp
+        );
+        /*!
+            requires
+                - img == an object which can be accepted by image_scanner_type::load(img,tp)
+                  (e.g. scan_fhog_pyramid)
+            ensures
+                - This function is identical to the above operator() routine, except that
+                  the scanner is loaded with get_scanner().load(img,tp), i.e. the image
+                  pyramid is built using the threads in tp.  The detections are exactly
+                  the same.
+        !*/
+
+        template <
+            typename image_type
+            >
+        std::vector<rectangle> operator() (
+            const image_type& img,
+            thread_pool& tp,
+            double adjust_threshold = 0
+        );
+        /*!
+            requires
+                - img == an object which can be accepted by image_scanner_type::load(img,tp)
+            ensures
+                - This function is identical to operator()(img,adjust_threshold), except
+                  that the image pyramid is built using the threads in tp.
+        !*/
+
         template <
             typename image_type
             >
@@ -350,6 +453,47 @@ namespace dlib
                   simply a convenience function for performing this set of operations.
         !*/
 
+        template <
+            typename image_type
+            >
+        void detect (
+            const image_type& img,
+            workspace& ws,
+            std::vector<rect_detection>& dets,
+            double adjust_threshold = 0
+        ) const;
+        /*!
+            requires
+                - image_scanner_type has a workspace type (e.g. scan_fhog_pyramid)
+                - img == an object which can be accepted by image_scanner_type::load(img,ws)
+            ensures
+                - Outputs the same #dets as operator()(img,dets,adjust_threshold), but the
+                  image is loaded into ws rather than into get_scanner(), so this object
+                  is not modified.  Therefore, many threads may call detect() on the same
+                  object_detector at once, as long as each uses its own ws.
+                - Once ws and dets have grown to the size needed for the images being
+                  processed, this function doesn't allocate any memory.
+        !*/
+
+        template <
+            typename image_type
+            >
+        void detect (
+            const image_type& img,
+            workspace& ws,
+            std::vector<rect_detection>& dets,
+            double adjust_threshold,
+            thread_pool& tp
+        ) const;
+        /*!
+            requires
+                - image_scanner_type has a workspace type (e.g. scan_fhog_pyramid)
+                - img == an object which can be accepted by image_scanner_type::load(img,ws,tp)
+            ensures
+                - This function is identical to detect(img,ws,dets,adjust_threshold),
+                  except that the image pyramid is built using the threads in tp.
+        !*/
+
         template <
             typename image_type
             >
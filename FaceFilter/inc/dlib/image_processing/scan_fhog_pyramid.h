@@ -8,6 +8,7 @@
 #include "../image_transforms.h"
 #include "../array.h"
 #include "../array2d.h"
+#include "../threads.h"
 #include "object_detector.h"
 
 namespace dlib
@@ -62,6 +63,105 @@ namespace dlib
     inline void serialize   (const default_fhog_feature_extractor&, std::ostream&) {}
     inline void deserialize (default_fhog_feature_extractor&, std::istream&) {}
 
+// ----------------------------------------------------------------------------------------
+
+    namespace impl
+    {
+        struct fhog_stream_level
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    Where stream_fhog_pyramid() is in building one pyramid level: the
+                    size of the level, the resampling from the level above it, and
+                    which rows of its FHOG cell histograms have been cleared and
+                    finished.
+            !*/
+
+            long nr, nc;
+            double x_scale, y_scale;
+            double y;       // source row of the last row made, as in resize_image()
+            long next_row;  // the next row of this level to make
+            bool has_features;
+            int cells_nr, cells_nc;
+            int visible_nr, visible_nc;
+            int cleared_hist_rows;  // rows of the padded histograms zeroed so far
+            int done_hist_rows;     // rows of the padded histograms no pixel votes into anymore
+        };
+
+        struct fhog_pyramid_buffers
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    The memory create_fhog_pyramid() reuses from one image to the
+                    next: the downsampled pyramid levels and the FHOG histogram
+                    scratch of each level.  Levels are only kept for unsigned char
+                    and rgb_pixel images, other pixel types get temporary buffers.
+                    When the pyramid is streamed the level images, histograms and
+                    norms only hold the last few rows of each level.
+            !*/
+
+            array<array2d<unsigned char> >* images(unsigned char*) { return &gray_images; }
+            array<array2d<rgb_pixel> >* images(rgb_pixel*) { return &rgb_images; }
+            template <typename T>
+            array<array2d<T> >* images(T*) { return 0; }
+
+            array<array2d<unsigned char> > gray_images;
+            array<array2d<rgb_pixel> > rgb_images;
+            array<array2d<matrix<float,18,1> > > hists;
+            array<array2d<float> > norms;
+            std::vector<fhog_stream_level> stream_levels;
+        };
+
+        struct fhog_detection_buffers
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    The memory detect_from_fhog_pyramid() and
+                    detect_all_from_fhog_pyramid() reuse from one image to the next:
+                    the saliency images of every pyramid level and filterbank, a
+                    filtering scratch image per level, and the per-filterbank lists
+                    the detections are gathered in.
+            !*/
+
+            array<array2d<float> > saliency_images;
+            array<array2d<float> > scratch;
+            std::vector<rectangle> areas;
+            std::vector<double> thresholds;
+            std::vector<std::vector<std::pair<double, rectangle> > > dets;
+        };
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    class scan_fhog_pyramid_workspace : noncopyable
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This object holds everything scan_fhog_pyramid needs to scan one
+                image: the FHOG pyramid of the image and the scratch memory used to
+                build and filter it.  Passing one to the const load() and detect()
+                routines of a scan_fhog_pyramid lets any number of threads scan
+                images with the same scanner at once, each with its own workspace.
+                Since the memory is kept, scanning a stream of same sized images
+                doesn't allocate anything after the first one.
+        !*/
+    public:
+
+        bool is_loaded_with_image (
+        ) const { return feats.size() != 0; }
+        /*!
+            ensures
+                - returns true if an image has been loaded into this workspace
+        !*/
+
+    private:
+        template <typename T, typename U> friend class scan_fhog_pyramid;
+
+        array<array<array2d<float> > > feats;
+        impl::fhog_pyramid_buffers buffers;
+        impl::fhog_detection_buffers detection_buffers;
+    };
+
 // ----------------------------------------------------------------------------------------
 
     template <
@@ -78,6 +178,8 @@ namespace dlib
         typedef Pyramid_type pyramid_type;
         typedef Feature_extractor_type feature_extractor_type;
 
+        typedef scan_fhog_pyramid_workspace workspace;
+
         scan_fhog_pyramid (
         );  
 
@@ -92,6 +194,31 @@ namespace dlib
             const image_type& img
         );
 
+        template <
+            typename image_type
+            >
+        void load (
+            const image_type& img,
+            thread_pool& tp
+        );
+
+        template <
+            typename image_type
+            >
+        void load (
+            const image_type& img,
+            workspace& ws
+        ) const;
+
+        template <
+            typename image_type
+            >
+        void load (
+            const image_type& img,
+            workspace& ws,
+            thread_pool& tp
+        ) const;
+
         inline bool is_loaded_with_image (
         ) const;
 
@@ -290,6 +417,26 @@ namespace dlib
             const double thresh
         ) const;
 
+        void detect (
+            workspace& ws,
+            const fhog_filterbank& w,
+            std::vector<std::pair<double, rectangle> >& dets,
+            const double thresh
+        ) const;
+
+        void detect (
+            const std::vector<processed_weight_vector<scan_fhog_pyramid> >& w,
+            const double adjust_threshold,
+            std::vector<rect_detection>& dets
+        ) const;
+
+        void detect (
+            workspace& ws,
+            const std::vector<processed_weight_vector<scan_fhog_pyramid> >& w,
+            const double adjust_threshold,
+            std::vector<rect_detection>& dets
+        ) const;
+
 
         void get_feature_vector (
             const full_object_detection& obj,
@@ -385,6 +532,7 @@ namespace dlib
 
         feature_extractor_type fe;
         array<fhog_image> feats;
+        impl::fhog_pyramid_buffers pyramid_buffers; // reused by load()
         int cell_size;
         unsigned long padding; 
         unsigned long window_width;
@@ -416,8 +564,16 @@ namespace dlib
         rectangle apply_filters_to_fhog (
             const fhog_filterbank& w,
             const array<array2d<float> >& feats,
-            array2d<float>& saliency_image
+            array2d<float>& saliency_image,
+            array2d<float>& scratch
         )
+        /*!
+            ensures
+                - Filters feats with w and stores the result in saliency_image.
+                  scratch is only used as temporary memory.  The memory of both
+                  images is reused when they already have the size of feats.
+                - returns the part of saliency_image that isn't border.
+        !*/
         {
             const unsigned long num_separable_filters = w.num_separable_filters();
             rectangle area;
@@ -434,25 +590,17 @@ namespace dlib
             }
             else
             {
-                saliency_image.clear();
-                array2d<float> scratch;
-
-                // find the first filter to apply
-                unsigned long i = 0;
-                while (i < w.row_filters.size() && w.row_filters[i].size() == 0) 
-                    ++i;
-
-                for (; i < w.row_filters.size(); ++i)
+                // The first filter overwrites saliency_image, all the others add to it.
+                bool first = true;
+                for (unsigned long i = 0; i < w.row_filters.size(); ++i)
                 {
                     for (unsigned long j = 0; j < w.row_filters[i].size(); ++j)
                     {
-                        if (saliency_image.size() == 0)
-                            area = float_spatially_filter_image_separable(feats[i], saliency_image, w.row_filters[i][j], w.col_filters[i][j],scratch,false);
-                        else
-                            area = float_spatially_filter_image_separable(feats[i], saliency_image, w.row_filters[i][j], w.col_filters[i][j],scratch,true);
+                        area = float_spatially_filter_image_separable(feats[i], saliency_image, w.row_filters[i][j], w.col_filters[i][j],scratch,!first);
+                        first = false;
                     }
                 }
-                if (saliency_image.size() == 0)
+                if (first)
                 {
                     saliency_image.set_size(feats[0].nr(), feats[0].nc());
                     assign_all_pixels(saliency_image, 0);
@@ -460,6 +608,17 @@ namespace dlib
             }
             return area;
         }
+
+        template <typename fhog_filterbank>
+        rectangle apply_filters_to_fhog (
+            const fhog_filterbank& w,
+            const array<array2d<float> >& feats,
+            array2d<float>& saliency_image
+        )
+        {
+            array2d<float> scratch;
+            return apply_filters_to_fhog(w, feats, saliency_image, scratch);
+        }
     }
 
 // ----------------------------------------------------------------------------------------
@@ -596,22 +755,552 @@ namespace dlib
                 "Invalid feature extractor used with dlib::scan_fhog_pyramid.  The output does not have the \n"
                 "indicated number of planes.");
 
-            if (feats.size() > 1)
-            {
-                typedef typename image_traits<image_type>::pixel_type pixel_type;
-                array2d<pixel_type> temp1, temp2;
-                pyr(img, temp1);
-                fe(temp1, feats[1], cell_size,filter_rows_padding,filter_cols_padding);
-                swap(temp1,temp2);
+            if (feats.size() > 1)
+            {
+                typedef typename image_traits<image_type>::pixel_type pixel_type;
+                array2d<pixel_type> temp1, temp2;
+                pyr(img, temp1);
+                fe(temp1, feats[1], cell_size,filter_rows_padding,filter_cols_padding);
+                swap(temp1,temp2);
+
+                for (unsigned long i = 2; i < feats.size(); ++i)
+                {
+                    pyr(temp2, temp1);
+                    fe(temp1, feats[i], cell_size,filter_rows_padding,filter_cols_padding);
+                    swap(temp1,temp2);
+                }
+            }
+        }
+
+        template <
+            typename feature_extractor_type,
+            typename image_type
+            >
+        void extract_fhog_level (
+            const feature_extractor_type& fe,
+            const image_type& img,
+            array<array2d<float> >& hog,
+            int cell_size,
+            int filter_rows_padding,
+            int filter_cols_padding,
+            array2d<matrix<float,18,1> >& ,
+            array2d<float>& 
+        )
+        {
+            fe(img, hog, cell_size, filter_rows_padding, filter_cols_padding);
+        }
+
+        template <
+            typename image_type
+            >
+        void extract_fhog_level (
+            const default_fhog_feature_extractor& ,
+            const image_type& img,
+            array<array2d<float> >& hog,
+            int cell_size,
+            int filter_rows_padding,
+            int filter_cols_padding,
+            array2d<matrix<float,18,1> >& hist,
+            array2d<float>& norm
+        )
+        {
+            // Same as default_fhog_feature_extractor::operator() except that the
+            // histogram memory comes from the caller.
+            impl_fhog::impl_extract_fhog_features(img, hog, cell_size, filter_rows_padding,
+                filter_cols_padding, hist, norm);
+            if (hog.size() == 0)
+                hog.resize(31);
+        }
+
+        template <typename pyramid_type>
+        struct fhog_pyramid_stream_traits
+        {
+            const static bool can_stream = false;
+        };
+
+        template <unsigned int N>
+        struct fhog_pyramid_stream_traits<pyramid_down<N> >
+        {
+            // pyramid_down<N> makes its levels with the bilinear resize_image(),
+            // except for N <= 3, which have their own filters.
+            const static bool can_stream = N > 3;
+
+            static long level_size (long size)
+            {
+                // the size pyramid_down<N>::operator() gives the next level
+                return ((N-1)*size)/N+0.5;
+            }
+        };
+
+        const long fhog_stream_ring_rows = 4; // must be a power of 2
+
+        template <typename T>
+        class fhog_ring
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    The last fhog_stream_ring_rows rows of an image that is being
+                    streamed (a pyramid level, its cell histograms or their norms),
+                    seen through the row interface of an image: (*this)[r] is row r.
+            !*/
+        public:
+            typedef T pixel_type;
+
+            explicit fhog_ring (
+                array2d<T>& ring
+            ) : data(&ring[0][0]), nc(ring.nc()) {}
+
+            T* operator[] (
+                long r
+            ) const { return data + (r&(fhog_stream_ring_rows-1))*nc; }
+
+        private:
+            T* data;
+            long nc;
+        };
+
+        inline void clear_fhog_stream_hist_rows (
+            fhog_stream_level& l,
+            int last_row,
+            array2d<matrix<float,18,1> >& hist_ring
+        )
+        /*!
+            ensures
+                - zeros the rows of the padded histograms of level l up to last_row that
+                  haven't been zeroed yet.
+        !*/
+        {
+            const fhog_ring<matrix<float,18,1> > hist(hist_ring);
+            for (; l.cleared_hist_rows <= last_row; ++l.cleared_hist_rows)
+            {
+                matrix<float,18,1>* row = hist[l.cleared_hist_rows];
+                for (long c = 0; c < hist_ring.nc(); ++c)
+                    row[c] = 0;
+            }
+        }
+
+        inline void finish_fhog_stream_hist_rows (
+            fhog_stream_level& l,
+            int last_row,
+            array<array2d<float> >& hog,
+            array2d<matrix<float,18,1> >& hist_ring,
+            array2d<float>& norm_ring,
+            int filter_rows_padding,
+            int filter_cols_padding
+        )
+        /*!
+            requires
+                - no more pixels will vote into rows up to last_row of the padded
+                  histograms of level l.
+            ensures
+                - computes every row of norms and of hog that only needs histogram rows
+                  up to last_row.
+        !*/
+        {
+            const fhog_ring<matrix<float,18,1> > hist(hist_ring);
+            const fhog_ring<float> norm(norm_ring);
+            for (; l.done_hist_rows <= last_row; ++l.done_hist_rows)
+            {
+                const int h = l.done_hist_rows;
+                // rows that no pixel voted into still have to be zero
+                clear_fhog_stream_hist_rows(l, h, hist_ring);
+
+                // norm row h-1 comes from histogram row h, and feature row h-3 is the
+                // last one that needs it
+                if (h >= 1 && h <= l.cells_nr)
+                    impl_fhog::compute_fhog_norm_row(hist, norm, h-1, l.cells_nc);
+                if (h >= 3 && h-3 < l.cells_nr-2)
+                    impl_fhog::compute_fhog_feature_row(hog, h-3, l.cells_nc-2, filter_rows_padding,
+                        filter_cols_padding, hist, norm);
+            }
+        }
+
+        template <
+            typename image_type,
+            typename T
+            >
+        void stream_fhog_row (
+            const const_image_view<image_type>& img,
+            array<array2d<T> >& rings,
+            array<array<array2d<float> > >& feats,
+            fhog_pyramid_buffers& buffers,
+            const matrix<float,2,1>* directions,
+            int cell_size,
+            int filter_rows_padding,
+            int filter_cols_padding,
+            unsigned long i,
+            long k
+        )
+        /*!
+            requires
+                - row k of level i has just been made (for i == 0, it is row k of img)
+            ensures
+                - adds row k-1 of level i into its FHOG histograms, since that row now
+                  has both of its neighbors, and finishes the histogram rows it was the
+                  last to vote into.
+                - makes every row of level i+1 that only needs rows up to k of level i,
+                  and recursively streams each of them into the levels below.
+        !*/
+        {
+            fhog_stream_level& l = buffers.stream_levels[i];
+            const int y = k-1;
+            if (l.has_features && y >= 1 && y < l.visible_nr)
+            {
+                // Row y votes into histogram rows iyp+1 and iyp+2, so no later row
+                // votes into iyp or above it.
+                const int iyp = impl_fhog::fhog_histogram_row(y, cell_size);
+                finish_fhog_stream_hist_rows(l, iyp, feats[i], buffers.hists[i], buffers.norms[i],
+                    filter_rows_padding, filter_cols_padding);
+                clear_fhog_stream_hist_rows(l, iyp+2, buffers.hists[i]);
+
+                fhog_ring<matrix<float,18,1> > hist(buffers.hists[i]);
+                if (i == 0)
+                    impl_fhog::add_row_to_fhog_histograms(img, y, l.visible_nc, cell_size, directions, hist);
+                else
+                    impl_fhog::add_row_to_fhog_histograms(fhog_ring<T>(rings[i]), y, l.visible_nc, cell_size,
+                        directions, hist);
+            }
+
+            if (i+1 == buffers.stream_levels.size())
+                return;
+
+            // Same row loop as resize_image(), except that it stops at the first row
+            // whose source rows haven't been made yet.
+            fhog_stream_level& next = buffers.stream_levels[i+1];
+            while (next.next_row < next.nr)
+            {
+                const double sy = next.y + next.y_scale;
+                const long top = static_cast<long>(std::floor(sy));
+                const long bottom = std::min(top+1, l.nr-1);
+                if (bottom > k)
+                    break;
+                DLIB_ASSERT(k - top < fhog_stream_ring_rows, "top: " << top << "  k: " << k);
+
+                next.y = sy;
+                const long r = next.next_row++;
+                T* const out_row = fhog_ring<T>(rings[i+1])[r];
+                if (i == 0)
+                    dlib::impl::resize_row_bilinear(img[top], img[bottom], l.nc, out_row, next.nc,
+                        next.x_scale, sy - top);
+                else
+                    dlib::impl::resize_row_bilinear(fhog_ring<T>(rings[i])[top], fhog_ring<T>(rings[i])[bottom],
+                        l.nc, out_row, next.nc, next.x_scale, sy - top);
+
+                stream_fhog_row(img, rings, feats, buffers, directions, cell_size, filter_rows_padding,
+                    filter_cols_padding, i+1, r);
+            }
+        }
+
+        template <
+            typename pyramid_type,
+            typename image_type,
+            typename feature_extractor_type
+            >
+        bool stream_fhog_pyramid (
+            const image_type& ,
+            const feature_extractor_type& ,
+            array<array<array2d<float> > >& ,
+            fhog_pyramid_buffers& ,
+            int ,
+            int ,
+            int 
+        )
+        {
+            return false;
+        }
+
+        template <
+            typename pyramid_type,
+            typename image_type
+            >
+        typename enable_if_c<fhog_pyramid_stream_traits<pyramid_type>::can_stream &&
+                             (is_same_type<typename image_traits<image_type>::pixel_type,unsigned char>::value ||
+                              is_same_type<typename image_traits<image_type>::pixel_type,rgb_pixel>::value),bool>::type
+        stream_fhog_pyramid (
+            const image_type& img_,
+            const default_fhog_feature_extractor& ,
+            array<array<array2d<float> > >& feats,
+            fhog_pyramid_buffers& buffers,
+            int cell_size,
+            int filter_rows_padding,
+            int filter_cols_padding
+        )
+        /*!
+            requires
+                - feats, buffers.hists, buffers.norms and buffers.images() have been
+                  sized to the number of pyramid levels.
+            ensures
+                - if the pyramid can't be streamed (cell_size == 1 or an empty level)
+                  then returns false without doing anything.
+                - else computes the same feats as building every level with
+                  pyramid_type and running default_fhog_feature_extractor on it, and
+                  returns true.  But the levels are never stored: img is read from the
+                  top down and every row of every level goes into the FHOG histograms
+                  of its level, and into the rows of the next level, as soon as it is
+                  made.  Rows of features are computed as soon as their histograms are
+                  complete, so each level only keeps a ring of fhog_stream_ring_rows
+                  rows of pixels, histograms and norms.  The arithmetic is the same,
+                  so the results are identical.
+        !*/
+        {
+            typedef typename image_traits<image_type>::pixel_type T;
+            const_image_view<image_type> img(img_);
+            array<array2d<T> >& rings = *buffers.images((T*)0);
+            std::vector<fhog_stream_level>& levels = buffers.stream_levels;
+
+            if (cell_size == 1)
+                return false;
+
+            levels.resize(feats.size());
+            levels[0].nr = img.nr();
+            levels[0].nc = img.nc();
+            for (unsigned long i = 1; i < levels.size(); ++i)
+            {
+                levels[i].nr = fhog_pyramid_stream_traits<pyramid_type>::level_size(levels[i-1].nr);
+                levels[i].nc = fhog_pyramid_stream_traits<pyramid_type>::level_size(levels[i-1].nc);
+            }
+            for (unsigned long i = 0; i < levels.size(); ++i)
+            {
+                if (levels[i].nr == 0 || levels[i].nc == 0)
+                    return false;
+            }
+
+            for (unsigned long i = 0; i < levels.size(); ++i)
+            {
+                fhog_stream_level& l = levels[i];
+                if (i != 0)
+                {
+                    rings[i].set_size(fhog_stream_ring_rows, l.nc);
+                    l.x_scale = (levels[i-1].nc-1)/(double)std::max<long>(l.nc-1,1);
+                    l.y_scale = (levels[i-1].nr-1)/(double)std::max<long>(l.nr-1,1);
+                    l.y = -l.y_scale;
+                }
+                l.next_row = 0;
+                l.has_features = impl_fhog::start_fhog_features(l.nr, l.nc, feats[i], cell_size,
+                    filter_rows_padding, filter_cols_padding, l.cells_nr, l.cells_nc);
+                if (l.has_features)
+                {
+                    buffers.hists[i].set_size(fhog_stream_ring_rows, l.cells_nc+2);
+                    buffers.norms[i].set_size(fhog_stream_ring_rows, l.cells_nc);
+                    l.visible_nr = std::min((long)l.cells_nr*cell_size, l.nr)-1;
+                    l.visible_nc = std::min((long)l.cells_nc*cell_size, l.nc)-1;
+                    l.cleared_hist_rows = 0;
+                    l.done_hist_rows = 0;
+                }
+            }
+
+            matrix<float,2,1> directions[9];
+            impl_fhog::get_fhog_directions(directions);
+            for (long k = 0; k < img.nr(); ++k)
+            {
+                stream_fhog_row(img, rings, feats, buffers, directions, cell_size, filter_rows_padding,
+                    filter_cols_padding, 0, k);
+            }
+
+            for (unsigned long i = 0; i < levels.size(); ++i)
+            {
+                DLIB_ASSERT(i == 0 || levels[i].next_row == levels[i].nr, "level " << i << " wasn't finished");
+                if (levels[i].has_features)
+                    finish_fhog_stream_hist_rows(levels[i], levels[i].cells_nr, feats[i], buffers.hists[i],
+                        buffers.norms[i], filter_rows_padding, filter_cols_padding);
+                if (feats[i].size() == 0)
+                    feats[i].resize(31);
+            }
+            return true;
+        }
+
+        template <
+            typename pyramid_type,
+            typename image_type,
+            typename feature_extractor_type
+            >
+        void create_fhog_pyramid (
+            const image_type& img,
+            const feature_extractor_type& fe,
+            array<array<array2d<float> > >& feats,
+            fhog_pyramid_buffers& buffers,
+            int cell_size,
+            int filter_rows_padding,
+            int filter_cols_padding,
+            unsigned long min_pyramid_layer_width,
+            unsigned long min_pyramid_layer_height,
+            unsigned long max_pyramid_levels,
+            thread_pool* tp
+        )
+        /*!
+            ensures
+                - Computes the same feats as the version above, but keeps all the
+                  intermediate images in buffers so that, once they have grown to
+                  the size of img, building a pyramid doesn't allocate any memory.
+                - If tp != 0 then the FHOG extraction of every level runs as a task
+                  in *tp.  The calling thread downsamples level after level and
+                  hands each one to the pool as soon as it exists, so the extraction
+                  of the large levels overlaps the building of the small ones.
+                - If tp == 0 and stream_fhog_pyramid() can handle the pyramid, the
+                  levels are streamed instead and only a few rows of each are ever
+                  stored.
+                - Every level is computed by exactly the same code as in the
+                  sequential version, so the results are identical.
+        !*/
+        {
+            typedef typename image_traits<image_type>::pixel_type pixel_type;
+            array<array2d<pixel_type> > temp;
+            array<array2d<pixel_type> >* images_ptr = buffers.images((pixel_type*)0);
+            if (images_ptr == 0)
+                images_ptr = &temp;
+            array<array2d<pixel_type> >& images = *images_ptr;
+
+            unsigned long levels = 0;
+            rectangle rect = get_rect(img);
+
+            pyramid_type pyr;
+            do
+            {
+                rect = pyr.rect_down(rect);
+                ++levels;
+            } while (rect.width() >= min_pyramid_layer_width && rect.height() >= min_pyramid_layer_height &&
+                levels < max_pyramid_levels);
+
+            // Everything must be sized before the first task starts, since resizing
+            // the arrays could move the elements the tasks are writing to.  Level 0
+            // is img itself, so images[0] stays empty.
+            if (feats.max_size() < levels)
+                feats.set_max_size(levels);
+            feats.set_size(levels);
+            if (images.max_size() < levels)
+                images.set_max_size(levels);
+            images.set_size(levels);
+            if (buffers.hists.max_size() < levels)
+            {
+                buffers.hists.set_max_size(levels);
+                buffers.norms.set_max_size(levels);
+            }
+            buffers.hists.set_size(levels);
+            buffers.norms.set_size(levels);
+
+            if (tp == 0)
+            {
+                if (!stream_fhog_pyramid<pyramid_type>(img, fe, feats, buffers, cell_size,
+                        filter_rows_padding, filter_cols_padding))
+                {
+                    extract_fhog_level(fe, img, feats[0], cell_size, filter_rows_padding, filter_cols_padding,
+                        buffers.hists[0], buffers.norms[0]);
+                    for (unsigned long i = 1; i < levels; ++i)
+                    {
+                        if (i == 1)
+                            pyr(img, images[1]);
+                        else
+                            pyr(images[i-1], images[i]);
+                        extract_fhog_level(fe, images[i], feats[i], cell_size, filter_rows_padding,
+                            filter_cols_padding, buffers.hists[i], buffers.norms[i]);
+                    }
+                }
+            }
+            else
+            {
+                std::vector<uint64> tasks;
+                tasks.reserve(levels);
+                try
+                {
+                    tasks.push_back(tp->add_task_by_value([&img,&fe,&feats,&buffers,cell_size,filter_rows_padding,filter_cols_padding]()
+                        { extract_fhog_level(fe, img, feats[0], cell_size, filter_rows_padding, filter_cols_padding,
+                            buffers.hists[0], buffers.norms[0]); }));
+
+                    for (unsigned long i = 1; i < levels; ++i)
+                    {
+                        if (i == 1)
+                            pyr(img, images[1]);
+                        else
+                            pyr(images[i-1], images[i]);
+
+                        tasks.push_back(tp->add_task_by_value([&images,&fe,&feats,&buffers,i,cell_size,filter_rows_padding,filter_cols_padding]()
+                            { extract_fhog_level(fe, images[i], feats[i], cell_size, filter_rows_padding,
+                                filter_cols_padding, buffers.hists[i], buffers.norms[i]); }));
+                    }
+                }
+                catch (...)
+                {
+                    // don't leave tasks running on buffers the caller may free
+                    for (unsigned long i = 0; i < tasks.size(); ++i)
+                    {
+                        try { tp->wait_for_task(tasks[i]); } catch (...) {}
+                    }
+                    throw;
+                }
+
+                for (unsigned long i = 0; i < tasks.size(); ++i)
+                    tp->wait_for_task(tasks[i]);
+            }
+
+            DLIB_ASSERT(feats[0].size() == fe.get_num_planes(), 
+                "Invalid feature extractor used with dlib::scan_fhog_pyramid.  The output does not have the \n"
+                "indicated number of planes.");
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type
+        >
+    template <
+        typename image_type
+        >
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    load (
+        const image_type& img
+    )
+    {
+        unsigned long width, height;
+        compute_fhog_window_size(width,height);
+        impl::create_fhog_pyramid<Pyramid_type>(img, fe, feats, pyramid_buffers, cell_size, height,
+            width, min_pyramid_layer_width, min_pyramid_layer_height,
+            max_pyramid_levels, 0);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type
+        >
+    template <
+        typename image_type
+        >
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    load (
+        const image_type& img,
+        thread_pool& tp
+    )
+    {
+        unsigned long width, height;
+        compute_fhog_window_size(width,height);
+        impl::create_fhog_pyramid<Pyramid_type>(img, fe, feats, pyramid_buffers, cell_size, height,
+            width, min_pyramid_layer_width, min_pyramid_layer_height,
+            max_pyramid_levels, &tp);
+    }
+
+// ----------------------------------------------------------------------------------------
 
-                for (unsigned long i = 2; i < feats.size(); ++i)
-                {
-                    pyr(temp2, temp1);
-                    fe(temp1, feats[i], cell_size,filter_rows_padding,filter_cols_padding);
-                    swap(temp1,temp2);
-                }
-            }
-        }
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type
+        >
+    template <
+        typename image_type
+        >
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    load (
+        const image_type& img,
+        workspace& ws
+    ) const
+    {
+        unsigned long width, height;
+        compute_fhog_window_size(width,height);
+        impl::create_fhog_pyramid<Pyramid_type>(img, fe, ws.feats, ws.buffers, cell_size, height,
+            width, min_pyramid_layer_width, min_pyramid_layer_height,
+            max_pyramid_levels, 0);
     }
 
 // ----------------------------------------------------------------------------------------
@@ -625,14 +1314,16 @@ namespace dlib
         >
     void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
     load (
-        const image_type& img
-    )
+        const image_type& img,
+        workspace& ws,
+        thread_pool& tp
+    ) const
     {
         unsigned long width, height;
         compute_fhog_window_size(width,height);
-        impl::create_fhog_pyramid<Pyramid_type>(img, fe, feats, cell_size, height,
+        impl::create_fhog_pyramid<Pyramid_type>(img, fe, ws.feats, ws.buffers, cell_size, height,
             width, min_pyramid_layer_width, min_pyramid_layer_height,
-            max_pyramid_levels);
+            max_pyramid_levels, &tp);
     }
 
 // ----------------------------------------------------------------------------------------
@@ -773,18 +1464,34 @@ namespace dlib
             const int cell_size,
             const int filter_rows_padding,
             const int filter_cols_padding,
-            std::vector<std::pair<double, rectangle> >& dets
+            std::vector<std::pair<double, rectangle> >& dets,
+            fhog_detection_buffers& buffers
         ) 
+        /*!
+            ensures
+                - Like the version below, but each pyramid level is filtered into its
+                  own saliency image in buffers, with its own scratch image, so that
+                  a stream of same sized images is scanned without allocating memory.
+        !*/
         {
             dets.clear();
 
-            array2d<float> saliency_image;
+            array<array2d<float> >& saliency_images = buffers.saliency_images;
+            array<array2d<float> >& scratch = buffers.scratch;
+            if (saliency_images.max_size() < feats.size())
+                saliency_images.set_max_size(feats.size());
+            saliency_images.set_size(feats.size());
+            if (scratch.max_size() < feats.size())
+                scratch.set_max_size(feats.size());
+            scratch.set_size(feats.size());
+
             pyramid_type pyr;
 
             // for all pyramid levels
             for (unsigned long l = 0; l < feats.size(); ++l)
             {
-                const rectangle area = apply_filters_to_fhog(w, feats[l], saliency_image);
+                array2d<float>& saliency_image = saliency_images[l];
+                const rectangle area = apply_filters_to_fhog(w, feats[l], saliency_image, scratch[l]);
 
                 // now search the saliency image for any detections
                 for (long r = area.top(); r <= area.bottom(); ++r)
@@ -806,6 +1513,248 @@ namespace dlib
             std::sort(dets.rbegin(), dets.rend(), compare_pair_rect);
         }
 
+        template <
+            typename pyramid_type,
+            typename feature_extractor_type,
+            typename fhog_filterbank
+            >
+        void detect_from_fhog_pyramid (
+            const array<array<array2d<float> > >& feats,
+            const feature_extractor_type& fe,
+            const fhog_filterbank& w,
+            const double thresh,
+            const unsigned long det_box_height,
+            const unsigned long det_box_width,
+            const int cell_size,
+            const int filter_rows_padding,
+            const int filter_cols_padding,
+            std::vector<std::pair<double, rectangle> >& dets
+        ) 
+        {
+            fhog_detection_buffers buffers;
+            detect_from_fhog_pyramid<pyramid_type>(feats, fe, w, thresh, det_box_height,
+                det_box_width, cell_size, filter_rows_padding, filter_cols_padding, dets,
+                buffers);
+        }
+
+        template <
+            typename fhog_filterbank
+            >
+        unsigned long first_separable_filter_plane (
+            const fhog_filterbank& w
+        )
+        {
+            unsigned long i = 0;
+            while (i < w.row_filters.size() && w.row_filters[i].size() == 0)
+                ++i;
+            return i;
+        }
+
+        template <
+            typename fhog_filterbank
+            >
+        void apply_filters_to_fhog_plane (
+            const fhog_filterbank& w,
+            const array<array2d<float> >& feats,
+            const unsigned long i,
+            array2d<float>& saliency_image,
+            array2d<float>& scratch,
+            rectangle& area
+        )
+        /*!
+            ensures
+                - Does the part of apply_filters_to_fhog(w, feats, saliency_image, scratch)
+                  that involves the i-th plane of feats.  Calling this for every plane in
+                  order gives exactly the same saliency_image and area.
+        !*/
+        {
+            // use the separable filters if they would be faster than running the regular filters.
+            if (w.num_separable_filters() > w.filters.size()*std::min(w.filters[0].nr(),w.filters[0].nc())/3.0)
+            {
+                if (i == 0)
+                    area = spatially_filter_image(feats[0], saliency_image, w.filters[0]);
+                else if (i < w.filters.size())
+                    spatially_filter_image(feats[i], saliency_image, w.filters[i], 1, false, true);
+            }
+            else
+            {
+                // The first filter overwrites saliency_image, all the others add to it.
+                const unsigned long first = first_separable_filter_plane(w);
+                if (i < w.row_filters.size())
+                {
+                    for (unsigned long j = 0; j < w.row_filters[i].size(); ++j)
+                    {
+                        area = float_spatially_filter_image_separable(feats[i], saliency_image,
+                            w.row_filters[i][j], w.col_filters[i][j], scratch, !(i == first && j == 0));
+                    }
+                }
+                if (i+1 == feats.size() && first == w.row_filters.size())
+                {
+                    saliency_image.set_size(feats[0].nr(), feats[0].nc());
+                    assign_all_pixels(saliency_image, 0);
+                }
+            }
+        }
+
+        // By default, pyramid levels whose saliency images, plus one plane and the scratch
+        // image, fit in this many bytes are filtered plane by plane for all the filterbanks
+        // at once.  Bigger levels would push the saliency images out of the cache, so they
+        // are filtered one filterbank at a time instead.
+        const unsigned long fused_fhog_filtering_bytes = 256*1024;
+
+        template <
+            typename processed_weight_vector_type
+            >
+        void apply_all_filters_to_fhog (
+            const std::vector<processed_weight_vector_type>& w,
+            const array<array2d<float> >& feats,
+            array2d<float>* saliency_images,
+            array2d<float>& scratch,
+            std::vector<rectangle>& areas,
+            const unsigned long max_fused_bytes = fused_fhog_filtering_bytes
+        )
+        /*!
+            requires
+                - saliency_images points to w.size() images
+            ensures
+                - Gives the same results as calling
+                  apply_filters_to_fhog(w[k].get_detect_argument(), feats, saliency_images[k], scratch)
+                  for every k and storing what it returns in #areas[k].
+                - The working set of the level is its w.size() saliency images plus one
+                  FHOG plane and the scratch image.  If it is no bigger than
+                  max_fused_bytes, each FHOG plane is run through all the filterbanks
+                  while it is in cache, so the level is read from memory once instead of
+                  once per filterbank.  Otherwise the level is filtered one filterbank at
+                  a time, so the saliency image being summed stays in cache.  Every
+                  saliency image is summed in the same order either way, so the results
+                  are bit for bit the same.
+        !*/
+        {
+            const unsigned long num = w.size();
+            areas.assign(num, rectangle());
+            if (feats.size() == 0)
+                return;
+
+            const unsigned long level_bytes = feats[0].size()*sizeof(float)*(num+2);
+            if (level_bytes <= max_fused_bytes)
+            {
+                for (unsigned long i = 0; i < feats.size(); ++i)
+                {
+                    for (unsigned long k = 0; k < num; ++k)
+                        apply_filters_to_fhog_plane(w[k].get_detect_argument(), feats, i,
+                            saliency_images[k], scratch, areas[k]);
+                }
+            }
+            else
+            {
+                for (unsigned long k = 0; k < num; ++k)
+                    areas[k] = apply_filters_to_fhog(w[k].get_detect_argument(), feats,
+                        saliency_images[k], scratch);
+            }
+        }
+
+        template <
+            typename pyramid_type,
+            typename feature_extractor_type,
+            typename processed_weight_vector_type
+            >
+        void detect_all_from_fhog_pyramid (
+            const array<array<array2d<float> > >& feats,
+            const feature_extractor_type& fe,
+            const std::vector<processed_weight_vector_type>& w,
+            const long num_dimensions,
+            const double adjust_threshold,
+            const unsigned long det_box_height,
+            const unsigned long det_box_width,
+            const int cell_size,
+            const int filter_rows_padding,
+            const int filter_cols_padding,
+            std::vector<rect_detection>& dets,
+            fhog_detection_buffers& buffers
+        )
+        /*!
+            ensures
+                - Runs every filterbank in w over the pyramid and stores the
+                  detections in #dets the way object_detector gathers them from
+                  detect_from_fhog_pyramid(): grouped by filterbank in the order of w,
+                  each group sorted by descending score, with
+                  detection_confidence == score - w[k].w(num_dimensions) and
+                  weight_index == k.  Only detections with a detection_confidence
+                  >= adjust_threshold are kept.
+                - The filterbanks are run over each pyramid level together by
+                  apply_all_filters_to_fhog() and all the saliency images of a level
+                  are thresholded in one pass.
+        !*/
+        {
+            dets.clear();
+            const unsigned long num = w.size();
+            if (num == 0)
+                return;
+
+            const unsigned long num_images = feats.size()*num;
+            if (buffers.saliency_images.max_size() < num_images)
+                buffers.saliency_images.set_max_size(num_images);
+            buffers.saliency_images.set_size(num_images);
+            if (buffers.scratch.max_size() < feats.size())
+                buffers.scratch.set_max_size(feats.size());
+            buffers.scratch.set_size(feats.size());
+            if (buffers.dets.size() < num)
+                buffers.dets.resize(num);
+            buffers.thresholds.resize(num);
+            for (unsigned long k = 0; k < num; ++k)
+            {
+                buffers.dets[k].clear();
+                buffers.thresholds[k] = w[k].w(num_dimensions);
+            }
+
+            pyramid_type pyr;
+
+            // for all pyramid levels
+            for (unsigned long l = 0; l < feats.size(); ++l)
+            {
+                array2d<float>* saliency_images = &buffers.saliency_images[l*num];
+                apply_all_filters_to_fhog(w, feats[l], saliency_images, buffers.scratch[l], buffers.areas);
+
+                rectangle area;
+                for (unsigned long k = 0; k < num; ++k)
+                    area += buffers.areas[k];
+
+                // now search all the saliency images for detections
+                for (long r = area.top(); r <= area.bottom(); ++r)
+                {
+                    for (long c = area.left(); c <= area.right(); ++c)
+                    {
+                        for (unsigned long k = 0; k < num; ++k)
+                        {
+                            // if we found a detection
+                            if (buffers.areas[k].contains(c,r) &&
+                                saliency_images[k][r][c] >= buffers.thresholds[k] + adjust_threshold)
+                            {
+                                rectangle rect = fe.feats_to_image(centered_rect(point(c,r),det_box_width,det_box_height), 
+                                    cell_size, filter_rows_padding, filter_cols_padding);
+                                rect = pyr.rect_up(rect, l);
+                                buffers.dets[k].push_back(std::make_pair(saliency_images[k][r][c], rect));
+                            }
+                        }
+                    }
+                }
+            }
+
+            for (unsigned long k = 0; k < num; ++k)
+            {
+                std::vector<std::pair<double, rectangle> >& kdets = buffers.dets[k];
+                std::sort(kdets.rbegin(), kdets.rend(), compare_pair_rect);
+                for (unsigned long j = 0; j < kdets.size(); ++j)
+                {
+                    rect_detection temp;
+                    temp.detection_confidence = kdets[j].first-buffers.thresholds[k];
+                    temp.weight_index = k;
+                    temp.rect = kdets[j].second;
+                    dets.push_back(temp);
+                }
+            }
+        }
+
         inline bool overlaps_any_box (
             const test_box_overlap& tester,
             const std::vector<rect_detection>& rects,
@@ -855,6 +1804,39 @@ namespace dlib
             height-2*padding, width-2*padding, cell_size, height, width, dets);
     }
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type
+        >
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    detect (
+        workspace& ws,
+        const fhog_filterbank& w,
+        std::vector<std::pair<double, rectangle> >& dets,
+        const double thresh
+    ) const
+    {
+        // make sure requires clause is not broken
+        DLIB_ASSERT(ws.is_loaded_with_image() &&
+                    w.get_num_dimensions() == get_num_dimensions(), 
+            "\t void scan_fhog_pyramid::detect()"
+            << "\n\t Invalid inputs were given to this function "
+            << "\n\t ws.is_loaded_with_image(): " << ws.is_loaded_with_image()
+            << "\n\t w.get_num_dimensions():    " << w.get_num_dimensions()
+            << "\n\t get_num_dimensions():      " << get_num_dimensions()
+            << "\n\t this: " << this
+            );
+
+        unsigned long width, height;
+        compute_fhog_window_size(width,height);
+
+        impl::detect_from_fhog_pyramid<pyramid_type>(ws.feats, fe, w, thresh,
+            height-2*padding, width-2*padding, cell_size, height, width, dets,
+            ws.detection_buffers);
+    }
+
 // ----------------------------------------------------------------------------------------
 
     template <
@@ -1213,6 +2195,127 @@ namespace dlib
 
     };
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type
+        >
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    detect (
+        const std::vector<processed_weight_vector<scan_fhog_pyramid> >& w,
+        const double adjust_threshold,
+        std::vector<rect_detection>& dets
+    ) const
+    {
+        // make sure requires clause is not broken
+        DLIB_ASSERT(is_loaded_with_image(),
+            "\t void scan_fhog_pyramid::detect()"
+            << "\n\t You must load an image before calling this function."
+            << "\n\t this: " << this
+            );
+#ifdef ENABLE_ASSERTS
+        for (unsigned long k = 0; k < w.size(); ++k)
+        {
+            DLIB_ASSERT(w[k].get_detect_argument().get_num_dimensions() == get_num_dimensions(),
+                "\t void scan_fhog_pyramid::detect()"
+                << "\n\t Invalid inputs were given to this function "
+                << "\n\t k: " << k
+                << "\n\t w[k].get_detect_argument().get_num_dimensions(): " << w[k].get_detect_argument().get_num_dimensions()
+                << "\n\t get_num_dimensions(): " << get_num_dimensions()
+                << "\n\t this: " << this
+                );
+        }
+#endif
+
+        unsigned long width, height;
+        compute_fhog_window_size(width,height);
+
+        impl::fhog_detection_buffers buffers;
+        impl::detect_all_from_fhog_pyramid<pyramid_type>(feats, fe, w, get_num_dimensions(),
+            adjust_threshold, height-2*padding, width-2*padding, cell_size, height, width,
+            dets, buffers);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type
+        >
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    detect (
+        workspace& ws,
+        const std::vector<processed_weight_vector<scan_fhog_pyramid> >& w,
+        const double adjust_threshold,
+        std::vector<rect_detection>& dets
+    ) const
+    {
+        // make sure requires clause is not broken
+        DLIB_ASSERT(ws.is_loaded_with_image(),
+            "\t void scan_fhog_pyramid::detect()"
+            << "\n\t You must load an image into ws before calling this function."
+            << "\n\t this: " << this
+            );
+#ifdef ENABLE_ASSERTS
+        for (unsigned long k = 0; k < w.size(); ++k)
+        {
+            DLIB_ASSERT(w[k].get_detect_argument().get_num_dimensions() == get_num_dimensions(),
+                "\t void scan_fhog_pyramid::detect()"
+                << "\n\t Invalid inputs were given to this function "
+                << "\n\t k: " << k
+                << "\n\t w[k].get_detect_argument().get_num_dimensions(): " << w[k].get_detect_argument().get_num_dimensions()
+                << "\n\t get_num_dimensions(): " << get_num_dimensions()
+                << "\n\t this: " << this
+                );
+        }
+#endif
+
+        unsigned long width, height;
+        compute_fhog_window_size(width,height);
+
+        impl::detect_all_from_fhog_pyramid<pyramid_type>(ws.feats, fe, w, get_num_dimensions(),
+            adjust_threshold, height-2*padding, width-2*padding, cell_size, height, width,
+            dets, ws.detection_buffers);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    // object_detector runs all its weight vectors through these, so that each pyramid
+    // level is filtered by all of them together and their saliency images are
+    // thresholded in one pass.
+
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type
+        >
+    void detect_all_weight_vectors (
+        const scan_fhog_pyramid<Pyramid_type,feature_extractor_type>& scanner,
+        const std::vector<processed_weight_vector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type> > >& w,
+        const double adjust_threshold,
+        std::vector<std::pair<double, rectangle> >& ,
+        std::vector<rect_detection>& dets_accum
+    )
+    {
+        scanner.detect(w, adjust_threshold, dets_accum);
+    }
+
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type
+        >
+    void detect_all_weight_vectors (
+        const scan_fhog_pyramid<Pyramid_type,feature_extractor_type>& scanner,
+        scan_fhog_pyramid_workspace& ws,
+        const std::vector<processed_weight_vector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type> > >& w,
+        const double adjust_threshold,
+        std::vector<std::pair<double, rectangle> >& ,
+        std::vector<rect_detection>& dets_accum
+    )
+    {
+        scanner.detect(ws, w, adjust_threshold, dets_accum);
+    }
+
 // ----------------------------------------------------------------------------------------
 // ----------------------------------------------------------------------------------------
 
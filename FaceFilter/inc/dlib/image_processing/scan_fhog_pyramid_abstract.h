@@ -6,6 +6,7 @@
 #include <vector>
 #include "../image_transforms/fhog_abstract.h"
 #include "object_detector_abstract.h"
+#include "../threads/thread_pool_extension_abstract.h"
 
 namespace dlib
 {
@@ -191,6 +192,30 @@ namespace dlib
         feature extractor.
     !*/
 
+// ----------------------------------------------------------------------------------------
+
+    class scan_fhog_pyramid_workspace : noncopyable
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This object holds everything scan_fhog_pyramid needs to scan one
+                image: the FHOG pyramid of the image and the scratch memory used to
+                build and filter it.  Passing one to the const load() and detect()
+                routines of a scan_fhog_pyramid lets any number of threads scan
+                images with the same scanner at once, each with its own workspace.
+                Since the memory is kept, scanning a stream of same sized images
+                doesn't allocate anything after the first one.
+        !*/
+    public:
+
+        bool is_loaded_with_image (
+        ) const;
+        /*!
+            ensures
+                - returns true if an image has been loaded into this workspace
+        !*/
+    };
+
 // ----------------------------------------------------------------------------------------
 
     template <
@@ -238,12 +263,16 @@ namespace dlib
                 configuration (via copy_configuration()) of a scan_fhog_pyramid object to
                 many other threads.  In this case, it is safe to copy the configuration of
                 a shared object so long as no other operations are performed on it.
+                It is also safe for many threads to call the const load() and detect()
+                routines that take a workspace on a shared object at the same time,
+                provided every thread uses its own workspace.
         !*/
 
     public:
         typedef matrix<double,0,1> feature_vector_type;
         typedef Pyramid_type pyramid_type;
         typedef Feature_extractor_type feature_extractor_type;
+        typedef scan_fhog_pyramid_workspace workspace;
 
         scan_fhog_pyramid (
         );  
@@ -276,6 +305,77 @@ namespace dlib
                 - #is_loaded_with_image() == true
                 - This object is ready to run a classifier over img to detect object
                   locations.  Call detect() to do this.
+                - If img holds unsigned char or rgb_pixel pixels, Pyramid_type is
+                  pyramid_down<N> with N > 3, the default feature extractor is used and
+                  get_cell_size() > 1, then the pyramid levels are never stored.  Each
+                  row of img is instead pushed through every level as it is read, and
+                  only a few rows of pixels and histograms are kept for each level.
+                  The features are identical to the ones made from stored levels.
+        !*/
+
+        template <
+            typename image_type
+            >
+        void load (
+            const image_type& img,
+            thread_pool& tp
+        );
+        /*!
+            requires
+                - image_type == is an implementation of array2d/array2d_kernel_abstract.h
+                - img contains some kind of pixel type. 
+                  (i.e. pixel_traits<typename image_type::type> is defined)
+            ensures
+                - Does the same thing as load(img), and leaves this object in exactly the
+                  same state, but extracts the FHOG features of the pyramid levels
+                  concurrently on the threads of tp.  The levels are still downsampled
+                  one after another by the calling thread, which hands each one to tp
+                  as soon as it is ready.
+                - The downsampled levels of grayscale (unsigned char) and rgb_pixel
+                  images are kept inside this object, so loading a stream of same sized
+                  images doesn't allocate memory after the first one.
+                - The size of tp sets how many levels are processed at once.  A
+                  thread_pool with 0 threads runs everything in the calling thread.
+        !*/
+
+        template <
+            typename image_type
+            >
+        void load (
+            const image_type& img,
+            workspace& ws
+        ) const;
+        /*!
+            requires
+                - image_type == is an implementation of array2d/array2d_kernel_abstract.h
+                - img contains some kind of pixel type. 
+                  (i.e. pixel_traits<typename image_type::type> is defined)
+            ensures
+                - Builds the same HOG pyramid as load(img), but stores it in ws rather
+                  than in this object, which is left untouched.
+                - #ws.is_loaded_with_image() == true
+                - All the memory used comes from ws.  Loading a stream of same sized
+                  grayscale (unsigned char) or rgb_pixel images into the same ws
+                  doesn't allocate memory after the first one.
+        !*/
+
+        template <
+            typename image_type
+            >
+        void load (
+            const image_type& img,
+            workspace& ws,
+            thread_pool& tp
+        ) const;
+        /*!
+            requires
+                - image_type == is an implementation of array2d/array2d_kernel_abstract.h
+                - img contains some kind of pixel type. 
+                  (i.e. pixel_traits<typename image_type::type> is defined)
+            ensures
+                - Does the same thing as load(img,ws), but extracts the FHOG features
+                  of the pyramid levels concurrently on the threads of tp, in the same
+                  way as load(img,tp).
         !*/
 
         const feature_extractor_type& get_feature_extractor(
@@ -578,6 +678,68 @@ namespace dlib
                   then it is reported in #dets.
         !*/
 
+        void detect (
+            workspace& ws,
+            const fhog_filterbank& w,
+            std::vector<std::pair<double, rectangle> >& dets,
+            const double thresh
+        ) const;
+        /*!
+            requires
+                - w.get_num_dimensions() == get_num_dimensions()
+                - ws.is_loaded_with_image() == true
+                - ws was loaded by this object, or by one with the same configuration.
+            ensures
+                - Does the same thing as detect(w,dets,thresh), but scans the HOG pyramid
+                  in ws rather than the one in this object.  The filtering scratch memory
+                  also comes from ws, so once ws and dets have grown to the size of the
+                  images being scanned this function doesn't allocate memory.
+        !*/
+
+        void detect (
+            const std::vector<processed_weight_vector<scan_fhog_pyramid> >& w,
+            const double adjust_threshold,
+            std::vector<rect_detection>& dets
+        ) const;
+        /*!
+            requires
+                - is_loaded_with_image() == true
+                - for all valid k: w[k].get_detect_argument().get_num_dimensions() == get_num_dimensions()
+            ensures
+                - Runs all the filterbanks in w over the HOG pyramid at once.  This is
+                  what object_detector uses when it holds several weight vectors, e.g.
+                  the five filters of the frontal_face_detector.  On pyramid levels
+                  small enough for the saliency images of all the filterbanks to stay in
+                  cache, each plane of the level is run through every filterbank before
+                  the next one is read, so the features are streamed from memory once per
+                  level rather than once per filterbank.  Bigger levels are filtered one
+                  filterbank at a time.  The saliency images of all the filterbanks are
+                  then thresholded in one pass.
+                - #dets holds the same detections, in the same order, as calling
+                  detect(w[k].get_detect_argument(), dets_k, w[k].w(get_num_dimensions())+adjust_threshold)
+                  for each k in turn and appending, for each element of dets_k, a
+                  rect_detection with:
+                    - detection_confidence == dets_k[i].first - w[k].w(get_num_dimensions())
+                    - weight_index == k
+                    - rect == dets_k[i].second
+        !*/
+
+        void detect (
+            workspace& ws,
+            const std::vector<processed_weight_vector<scan_fhog_pyramid> >& w,
+            const double adjust_threshold,
+            std::vector<rect_detection>& dets
+        ) const;
+        /*!
+            requires
+                - ws.is_loaded_with_image() == true
+                - ws was loaded by this object, or by one with the same configuration.
+                - for all valid k: w[k].get_detect_argument().get_num_dimensions() == get_num_dimensions()
+            ensures
+                - Does the same thing as detect(w,adjust_threshold,dets), but scans the
+                  HOG pyramid in ws and takes all its scratch memory from ws.
+        !*/
+
         void detect (
             const feature_vector_type& w,
             std::vector<std::pair<double, rectangle> >& dets,
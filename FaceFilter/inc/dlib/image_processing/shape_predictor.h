@@ -10,11 +10,26 @@
 #include "../geometry.h"
 #include "../pixel.h"
 #include "../statistics.h"
+#include "../threads.h"
+#include "../simd.h"
+#include "../uintn.h"
 #include <utility>
+#include <cstring>
+#include <cmath>
+#include <limits>
 
 namespace dlib
 {
 
+// ----------------------------------------------------------------------------------------
+
+    enum shape_predictor_leaf_type
+    {
+        float32_leaves,
+        float16_leaves,
+        int8_leaves
+    };
+
 // ----------------------------------------------------------------------------------------
 
     namespace impl
@@ -100,6 +115,607 @@ namespace dlib
             }
         };
 
+    // ------------------------------------------------------------------------------------
+
+        inline uint16 float_to_half (
+            float value
+        )
+        /*!
+            ensures
+                - returns value converted to an IEEE 754 binary16 bit pattern, rounding to
+                  the nearest representable value (ties to even).
+        !*/
+        {
+            uint32 x;
+            std::memcpy(&x, &value, sizeof(x));
+            const uint32 sign = (x >> 16) & 0x8000;
+            const uint32 mant = x & 0x7fffff;
+            const long exp = (long)((x >> 23) & 0xff) - 127 + 15;
+
+            if (((x >> 23) & 0xff) == 0xff)
+                return (uint16)(sign | 0x7c00 | (mant ? 0x200 : 0));
+            if (exp >= 31)
+                return (uint16)(sign | 0x7c00);
+            if (exp <= 0)
+            {
+                // the result is a subnormal half, or zero.
+                if (exp < -10)
+                    return (uint16)sign;
+                const uint32 m = mant | 0x800000;
+                const uint32 shift = (uint32)(14 - exp);
+                uint32 h = m >> shift;
+                const uint32 rem = m & ((1u << shift) - 1);
+                const uint32 halfway = 1u << (shift - 1);
+                if (rem > halfway || (rem == halfway && (h & 1)))
+                    ++h;
+                return (uint16)(sign | h);
+            }
+
+            // A carry out of the mantissa correctly bumps the exponent.
+            uint32 h = ((uint32)exp << 10) | (mant >> 13);
+            const uint32 rem = mant & 0x1fff;
+            if (rem > 0x1000 || (rem == 0x1000 && (h & 1)))
+                ++h;
+            return (uint16)(sign | h);
+        }
+
+        inline float half_to_float (
+            uint16 h
+        )
+        /*!
+            ensures
+                - returns the float value of the IEEE 754 binary16 bit pattern h.
+        !*/
+        {
+            // Move the exponent and mantissa into float position and rebias the
+            // exponent.  Only infinities, NaNs and subnormals need fixing up after that.
+            const uint32 shifted_exp = 0x7c00u << 13;
+            uint32 x = (uint32)(h & 0x7fff) << 13;
+            const uint32 exp = x & shifted_exp;
+            x += (127 - 15) << 23;
+            if (exp == shifted_exp)
+            {
+                x += (128 - 16) << 23;
+            }
+            else if (exp == 0)
+            {
+                // let the FPU renormalize the subnormal
+                const uint32 magic_bits = 113u << 23;
+                float value, magic;
+                x += 1 << 23;
+                std::memcpy(&value, &x, sizeof(value));
+                std::memcpy(&magic, &magic_bits, sizeof(magic));
+                value -= magic;
+                std::memcpy(&x, &value, sizeof(x));
+            }
+            x |= (uint32)(h & 0x8000) << 16;
+            float value;
+            std::memcpy(&value, &x, sizeof(value));
+            return value;
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        inline simd8f load_int8_as_simd8f (
+            const signed char* p
+        )
+        /*!
+            ensures
+                - returns the 8 values p[0] through p[7] converted to float.
+        !*/
+        {
+#if defined(DLIB_HAVE_AVX2)
+            return simd8f(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)p))));
+#elif defined(DLIB_HAVE_SSE41)
+            const __m128i v = _mm_loadl_epi64((const __m128i*)p);
+            return simd8f(simd4f(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(v))),
+                          simd4f(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(v,4)))));
+#elif defined(DLIB_HAVE_NEON)
+            const int16x8_t v = vmovl_s8(vld1_s8(p));
+            return simd8f(simd4f(vcvtq_f32_s32(vmovl_s16(vget_low_s16(v)))),
+                          simd4f(vcvtq_f32_s32(vmovl_s16(vget_high_s16(v)))));
+#else
+            return simd8f(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]);
+#endif
+        }
+
+        inline simd8f load_half_as_simd8f (
+            const uint16* p
+        )
+        /*!
+            ensures
+                - returns the 8 half floats p[0] through p[7] converted to float.
+        !*/
+        {
+#if defined(DLIB_HAVE_AVX) && defined(__F16C__)
+            return simd8f(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)p)));
+#elif defined(DLIB_HAVE_NEON) && (defined(__aarch64__) || (defined(__ARM_FP) && (__ARM_FP & 2)))
+            const uint16x8_t v = vld1q_u16(p);
+            return simd8f(simd4f(vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(v)))),
+                          simd4f(vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(v)))));
+#else
+            return simd8f(half_to_float(p[0]), half_to_float(p[1]), half_to_float(p[2]), half_to_float(p[3]),
+                          half_to_float(p[4]), half_to_float(p[5]), half_to_float(p[6]), half_to_float(p[7]));
+#endif
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        template <typename T>
+        void serialize_le_block (
+            const std::vector<T>& item,
+            std::ostream& out
+        )
+        /*!
+            requires
+                - T is an unsigned integral type
+            ensures
+                - writes item.size() and then all of item as one little-endian block of bytes.
+        !*/
+        {
+            dlib::serialize(static_cast<unsigned long>(item.size()), out);
+            std::vector<char> buf(item.size()*sizeof(T));
+            for (unsigned long i = 0; i < item.size(); ++i)
+                for (unsigned long b = 0; b < sizeof(T); ++b)
+                    buf[i*sizeof(T)+b] = (char)((item[i] >> (8*b)) & 0xff);
+            if (buf.size() != 0)
+                out.write(&buf[0], buf.size());
+            if (!out)
+                throw serialization_error("Error serializing a little-endian block");
+        }
+
+        template <typename T>
+        void deserialize_le_block (
+            std::vector<T>& item,
+            std::istream& in
+        )
+        /*!
+            ensures
+                - reads a block written by serialize_le_block()
+        !*/
+        {
+            unsigned long size;
+            dlib::deserialize(size, in);
+            item.resize(size);
+            std::vector<unsigned char> buf(size*sizeof(T));
+            if (buf.size() != 0)
+                in.read((char*)&buf[0], buf.size());
+            if (!in)
+                throw serialization_error("Error deserializing a little-endian block");
+            for (unsigned long i = 0; i < size; ++i)
+            {
+                T v = 0;
+                for (unsigned long b = 0; b < sizeof(T); ++b)
+                    v |= (T)buf[i*sizeof(T)+b] << (8*b);
+                item[i] = v;
+            }
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        struct packed_split
+        {
+            uint32 idx1;
+            uint32 idx2;
+            float thresh;
+        };
+
+        struct forest_view
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    This is a non-owning view of the arrays of one compiled cascade level
+                    (see compiled_forest below for their layout).  It is what inference
+                    runs on, so the arrays can live either in a compiled_forest or in a
+                    memory mapped model file.
+            !*/
+
+            unsigned long num_splits(unsigned long t) const { return tree_start[t+1]-tree_start[t]; }
+            unsigned long num_leaves(unsigned long t) const { return num_splits(t)+1; }
+
+            inline unsigned long find_leaf (
+                unsigned long t,
+                const std::vector<float>& feature_pixel_values,
+                unsigned long& i
+            ) const
+            /*!
+                requires
+                    - t < num_trees()
+                ensures
+                    - runs through the t-th tree and returns the offset into the leaf table
+                      of the leaf we end up in.
+                    - #i == the selected leaf node index.
+            !*/
+            {
+                const packed_split* s = splits + tree_start[t];
+                const unsigned long n = num_splits(t);
+                i = 0;
+                while (i < n)
+                {
+                    if (feature_pixel_values[s[i].idx1] - feature_pixel_values[s[i].idx2] > s[i].thresh)
+                        i = left_child(i);
+                    else
+                        i = right_child(i);
+                }
+                i = i - n;
+                return (tree_start[t]+t+i)*dims;
+            }
+
+            inline void add_leaf (
+                float* shape,
+                unsigned long t,
+                unsigned long offset
+            ) const
+            /*!
+                requires
+                    - offset was returned by find_leaf(t, ...)
+                ensures
+                    - adds the dims values of the leaf at offset to shape, converting
+                      them to float first if they are quantized.
+            !*/
+            {
+                unsigned long k = 0;
+                if (leaf_type == float32_leaves)
+                {
+                    const float* leaf = leaf_values + offset;
+                    for (; k + 8 <= dims; k += 8)
+                    {
+                        simd8f a, b;
+                        a.load(shape+k);
+                        b.load(leaf+k);
+                        (a+b).store(shape+k);
+                    }
+                    for (; k < dims; ++k)
+                        shape[k] += leaf[k];
+                }
+                else if (leaf_type == int8_leaves)
+                {
+                    const signed char* leaf = leaf_values_i8 + offset;
+                    const simd8f scale(leaf_scale[t]);
+                    for (; k + 8 <= dims; k += 8)
+                    {
+                        simd8f a;
+                        a.load(shape+k);
+                        (a + scale*load_int8_as_simd8f(leaf+k)).store(shape+k);
+                    }
+                    for (; k < dims; ++k)
+                        shape[k] += leaf_scale[t]*leaf[k];
+                }
+                else
+                {
+                    const uint16* leaf = leaf_values_f16 + offset;
+                    for (; k + 8 <= dims; k += 8)
+                    {
+                        simd8f a;
+                        a.load(shape+k);
+                        (a + load_half_as_simd8f(leaf+k)).store(shape+k);
+                    }
+                    for (; k < dims; ++k)
+                        shape[k] += half_to_float(leaf[k]);
+                }
+            }
+
+            const packed_split* splits;
+            const uint32* tree_start;
+            unsigned long num_trees;
+            unsigned long dims;
+            shape_predictor_leaf_type leaf_type;
+            const float* leaf_values;
+            const uint16* leaf_values_f16;
+            const signed char* leaf_values_i8;
+            const float* leaf_scale;
+        };
+
+    // ------------------------------------------------------------------------------------
+
+        struct compiled_forest
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    This is the inference form of one cascade level, that is, of a
+                    std::vector<regression_tree>.  Instead of one heap block per leaf it
+                    keeps two contiguous arrays: the splits of all the trees back to back
+                    and a single table holding every leaf vector.  So evaluating a level
+                    walks memory linearly rather than chasing a pointer per tree and leaf.
+
+                    The splits of tree t are splits[tree_start[t]] through
+                    splits[tree_start[t+1]-1].  Since a tree with N splits has N+1
+                    leaves, leaf l of tree t starts at element (tree_start[t]+t+l)*dims of
+                    the leaf table.
+
+                    The leaf table is held in one of three encodings, given by leaf_type:
+                        - float32_leaves: leaf_values holds the values.
+                        - float16_leaves: leaf_values_f16 holds IEEE half floats.
+                        - int8_leaves: leaf_values_i8 holds the values of tree t divided
+                          by leaf_scale[t] and rounded.
+                    Quantized leaves are turned back into floats while they are added to
+                    the shape, so they are never expanded in memory.
+            !*/
+
+            compiled_forest() : leaf_type(float32_leaves), dims(0) {}
+
+            unsigned long num_trees() const { return tree_start.size()==0 ? 0 : tree_start.size()-1; }
+            unsigned long num_splits(unsigned long t) const { return tree_start[t+1]-tree_start[t]; }
+            unsigned long num_leaves(unsigned long t) const { return num_splits(t)+1; }
+
+            void compile (
+                const std::vector<regression_tree>& trees,
+                unsigned long dims_
+            )
+            /*!
+                requires
+                    - for all valid i: trees[i].leaf_values.size() == trees[i].splits.size()+1
+                    - all the leaf vectors have dims_ elements
+                ensures
+                    - #*this represents the same forest as trees
+                    - #leaf_type == float32_leaves
+            !*/
+            {
+                dims = dims_;
+                leaf_type = float32_leaves;
+                leaf_values_f16.clear();
+                leaf_values_i8.clear();
+                leaf_scale.clear();
+                tree_start.assign(1, 0);
+                uint32 total_splits = 0;
+                for (unsigned long t = 0; t < trees.size(); ++t)
+                {
+                    total_splits += trees[t].splits.size();
+                    tree_start.push_back(total_splits);
+                }
+
+                splits.resize(total_splits);
+                leaf_values.resize((total_splits + trees.size())*dims);
+                for (unsigned long t = 0; t < trees.size(); ++t)
+                {
+                    for (unsigned long i = 0; i < trees[t].splits.size(); ++i)
+                    {
+                        packed_split& s = splits[tree_start[t]+i];
+                        s.idx1 = trees[t].splits[i].idx1;
+                        s.idx2 = trees[t].splits[i].idx2;
+                        s.thresh = trees[t].splits[i].thresh;
+                    }
+                    for (unsigned long l = 0; l < trees[t].leaf_values.size(); ++l)
+                    {
+                        DLIB_ASSERT(trees[t].leaf_values[l].size() == (long)dims,"");
+                        std::copy(trees[t].leaf_values[l].begin(), trees[t].leaf_values[l].end(),
+                                  leaf_values.begin() + (tree_start[t]+t+l)*dims);
+                    }
+                }
+            }
+
+            void decompile (
+                std::vector<regression_tree>& trees
+            ) const
+            /*!
+                ensures
+                    - #trees is the std::vector<regression_tree> this object represents.
+                      Quantized leaves are converted back to float.
+            !*/
+            {
+                trees.resize(num_trees());
+                for (unsigned long t = 0; t < trees.size(); ++t)
+                {
+                    trees[t].splits.resize(num_splits(t));
+                    for (unsigned long i = 0; i < trees[t].splits.size(); ++i)
+                    {
+                        const packed_split& s = splits[tree_start[t]+i];
+                        trees[t].splits[i].idx1 = s.idx1;
+                        trees[t].splits[i].idx2 = s.idx2;
+                        trees[t].splits[i].thresh = s.thresh;
+                    }
+                    trees[t].leaf_values.resize(num_leaves(t));
+                    for (unsigned long l = 0; l < trees[t].leaf_values.size(); ++l)
+                    {
+                        trees[t].leaf_values[l].set_size(dims);
+                        const unsigned long offset = (tree_start[t]+t+l)*dims;
+                        for (unsigned long k = 0; k < dims; ++k)
+                            trees[t].leaf_values[l](k) = leaf_value(t, offset+k);
+                    }
+                }
+            }
+
+            inline float leaf_value (
+                unsigned long t,
+                unsigned long k
+            ) const
+            /*!
+                ensures
+                    - returns element k of the leaf table of tree t, as a float.
+            !*/
+            {
+                switch (leaf_type)
+                {
+                    case float16_leaves: return half_to_float(leaf_values_f16[k]);
+                    case int8_leaves: return leaf_scale[t]*leaf_values_i8[k];
+                    default: return leaf_values[k];
+                }
+            }
+
+            void set_leaf_type (
+                shape_predictor_leaf_type new_type
+            )
+            /*!
+                ensures
+                    - #leaf_type == new_type
+                    - converts the leaf table to the new encoding.  Going from float32 to
+                      a smaller encoding loses precision.  For int8_leaves each tree gets
+                      its own scale, chosen so its largest magnitude leaf value maps to 127.
+            !*/
+            {
+                if (new_type == leaf_type)
+                    return;
+
+                // get back to float32 first
+                if (leaf_type != float32_leaves)
+                {
+                    leaf_values.resize(num_leaf_elements());
+                    for (unsigned long t = 0; t < num_trees(); ++t)
+                    {
+                        const unsigned long begin = (tree_start[t]+t)*dims;
+                        const unsigned long end = begin + num_leaves(t)*dims;
+                        for (unsigned long k = begin; k < end; ++k)
+                            leaf_values[k] = leaf_value(t, k);
+                    }
+                    leaf_values_f16.clear();
+                    leaf_values_i8.clear();
+                    leaf_scale.clear();
+                    leaf_type = float32_leaves;
+                }
+
+                if (new_type == float16_leaves)
+                {
+                    leaf_values_f16.resize(leaf_values.size());
+                    for (unsigned long k = 0; k < leaf_values.size(); ++k)
+                        leaf_values_f16[k] = float_to_half(leaf_values[k]);
+                }
+                else if (new_type == int8_leaves)
+                {
+                    leaf_values_i8.resize(leaf_values.size());
+                    leaf_scale.resize(num_trees());
+                    for (unsigned long t = 0; t < num_trees(); ++t)
+                    {
+                        const unsigned long begin = (tree_start[t]+t)*dims;
+                        const unsigned long end = begin + num_leaves(t)*dims;
+                        float max_val = 0;
+                        for (unsigned long k = begin; k < end; ++k)
+                            max_val = std::max(max_val, std::abs(leaf_values[k]));
+                        leaf_scale[t] = max_val/127;
+                        const float inv_scale = max_val == 0 ? 0 : 127/max_val;
+                        for (unsigned long k = begin; k < end; ++k)
+                        {
+                            const long q = (long)std::floor(leaf_values[k]*inv_scale + 0.5f);
+                            leaf_values_i8[k] = (signed char)put_in_range(-127, 127, q);
+                        }
+                    }
+                }
+
+                if (new_type != float32_leaves)
+                {
+                    // swap to actually release the memory
+                    std::vector<float>().swap(leaf_values);
+                    leaf_type = new_type;
+                }
+            }
+
+            unsigned long num_leaf_elements (
+            ) const
+            {
+                return (splits.size() + num_trees())*dims;
+            }
+
+            friend void serialize (const compiled_forest& item, std::ostream& out)
+            {
+                // Only used by the quantized shape_predictor format, so the thresholds
+                // are always stored as half floats.
+                dlib::serialize((int)item.leaf_type, out);
+                dlib::serialize(item.dims, out);
+                serialize_le_block(item.tree_start, out);
+                std::vector<uint32> idx(item.splits.size()*2);
+                std::vector<uint16> thresh(item.splits.size());
+                for (unsigned long i = 0; i < item.splits.size(); ++i)
+                {
+                    idx[2*i]   = item.splits[i].idx1;
+                    idx[2*i+1] = item.splits[i].idx2;
+                    thresh[i] = float_to_half(item.splits[i].thresh);
+                }
+                serialize_le_block(idx, out);
+                serialize_le_block(thresh, out);
+
+                if (item.leaf_type == float16_leaves)
+                {
+                    serialize_le_block(item.leaf_values_f16, out);
+                }
+                else if (item.leaf_type == int8_leaves)
+                {
+                    dlib::serialize(item.leaf_scale, out);
+                    std::vector<unsigned char> bytes(item.leaf_values_i8.begin(), item.leaf_values_i8.end());
+                    serialize_le_block(bytes, out);
+                }
+                else
+                {
+                    dlib::serialize(item.leaf_values, out);
+                }
+            }
+
+            friend void deserialize (compiled_forest& item, std::istream& in)
+            {
+                int leaf_type;
+                dlib::deserialize(leaf_type, in);
+                if (leaf_type != float32_leaves && leaf_type != float16_leaves && leaf_type != int8_leaves)
+                    throw serialization_error("Unknown leaf type found while deserializing dlib::shape_predictor.");
+                item.leaf_type = (shape_predictor_leaf_type)leaf_type;
+                dlib::deserialize(item.dims, in);
+                deserialize_le_block(item.tree_start, in);
+                std::vector<uint32> idx;
+                std::vector<uint16> thresh;
+                deserialize_le_block(idx, in);
+                deserialize_le_block(thresh, in);
+                if (idx.size() != thresh.size()*2 || item.tree_start.size() == 0 || item.tree_start.back() != thresh.size())
+                    throw serialization_error("Corrupt splits found while deserializing dlib::shape_predictor.");
+                item.splits.resize(thresh.size());
+                for (unsigned long i = 0; i < item.splits.size(); ++i)
+                {
+                    item.splits[i].idx1 = idx[2*i];
+                    item.splits[i].idx2 = idx[2*i+1];
+                    item.splits[i].thresh = half_to_float(thresh[i]);
+                }
+
+                item.leaf_values.clear();
+                item.leaf_values_f16.clear();
+                item.leaf_values_i8.clear();
+                item.leaf_scale.clear();
+                unsigned long num_values;
+                if (item.leaf_type == float16_leaves)
+                {
+                    deserialize_le_block(item.leaf_values_f16, in);
+                    num_values = item.leaf_values_f16.size();
+                }
+                else if (item.leaf_type == int8_leaves)
+                {
+                    dlib::deserialize(item.leaf_scale, in);
+                    std::vector<unsigned char> bytes;
+                    deserialize_le_block(bytes, in);
+                    item.leaf_values_i8.assign(bytes.begin(), bytes.end());
+                    num_values = item.leaf_values_i8.size();
+                    if (item.leaf_scale.size() != item.num_trees())
+                        throw serialization_error("Corrupt leaf scales found while deserializing dlib::shape_predictor.");
+                }
+                else
+                {
+                    dlib::deserialize(item.leaf_values, in);
+                    num_values = item.leaf_values.size();
+                }
+                if (num_values != item.num_leaf_elements())
+                    throw serialization_error("Corrupt leaf table found while deserializing dlib::shape_predictor.");
+            }
+
+            forest_view view (
+            ) const
+            {
+                forest_view v;
+                v.splits = splits.size() ? &splits[0] : 0;
+                v.tree_start = tree_start.size() ? &tree_start[0] : 0;
+                v.num_trees = num_trees();
+                v.dims = dims;
+                v.leaf_type = leaf_type;
+                v.leaf_values = leaf_values.size() ? &leaf_values[0] : 0;
+                v.leaf_values_f16 = leaf_values_f16.size() ? &leaf_values_f16[0] : 0;
+                v.leaf_values_i8 = leaf_values_i8.size() ? &leaf_values_i8[0] : 0;
+                v.leaf_scale = leaf_scale.size() ? &leaf_scale[0] : 0;
+                return v;
+            }
+
+            std::vector<packed_split> splits;
+            std::vector<uint32> tree_start;
+            shape_predictor_leaf_type leaf_type;
+            std::vector<float> leaf_values;
+            std::vector<uint16> leaf_values_f16;
+            std::vector<signed char> leaf_values_i8;
+            std::vector<float> leaf_scale;
+            unsigned long dims;
+        };
+
     // ------------------------------------------------------------------------------------
 
         inline vector<float,2> location (
@@ -176,24 +792,84 @@ namespace dlib
             const matrix<float,0,1>& from_shape,
             const matrix<float,0,1>& to_shape
         )
+        /*!
+            ensures
+                - returns the least squares similarity transform that maps the points of
+                  from_shape onto the points of to_shape.  This is what
+                  find_similarity_transform() computes, but in 2D the optimal rotation
+                  and scale have a closed form, so no SVD or temporary point vectors are
+                  needed.
+        !*/
         {
             DLIB_ASSERT(from_shape.size() == to_shape.size() && (from_shape.size()%2) == 0 && from_shape.size() > 0,"");
-            std::vector<vector<float,2> > from_points, to_points;
             const unsigned long num = from_shape.size()/2;
-            from_points.reserve(num);
-            to_points.reserve(num);
             if (num == 1)
             {
                 // Just use an identity transform if there is only one landmark.
                 return point_transform_affine();
             }
 
+            const float* from = &from_shape(0);
+            const float* to = &to_shape(0);
+            double mfx = 0, mfy = 0, mtx = 0, mty = 0;
+            for (unsigned long i = 0; i < num; ++i)
+            {
+                mfx += from[2*i];  mfy += from[2*i+1];
+                mtx += to[2*i];    mty += to[2*i+1];
+            }
+            mfx /= num;  mfy /= num;
+            mtx /= num;  mty /= num;
+
+            // With centered points f and t, the best rotation and scale is the matrix
+            // [a -b; b a] where a = sum(f.t)/sum(f.f) and b = sum(f x t)/sum(f.f).
+            double dot = 0, cross = 0, sigma_from = 0;
             for (unsigned long i = 0; i < num; ++i)
             {
-                from_points.push_back(location(from_shape,i));
-                to_points.push_back(location(to_shape,i));
+                const double fx = from[2*i]-mfx, fy = from[2*i+1]-mfy;
+                const double tx = to[2*i]-mtx,   ty = to[2*i+1]-mty;
+                dot += fx*tx + fy*ty;
+                cross += fx*ty - fy*tx;
+                sigma_from += fx*fx + fy*fy;
             }
-            return find_similarity_transform(from_points, to_points);
+
+            double a = 1, b = 0;
+            if (sigma_from != 0)
+            {
+                a = dot/sigma_from;
+                b = cross/sigma_from;
+            }
+            matrix<double,2,2> m;
+            m = a, -b,
+                b,  a;
+            const dlib::vector<double,2> t(mtx - (a*mfx - b*mfy), mty - (b*mfx + a*mfy));
+            return point_transform_affine(m, t);
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        inline point_transform_affine find_affine_transform_3 (
+            const dlib::vector<double,2>& from0, const dlib::vector<double,2>& to0,
+            const dlib::vector<double,2>& from1, const dlib::vector<double,2>& to1,
+            const dlib::vector<double,2>& from2, const dlib::vector<double,2>& to2
+        )
+        /*!
+            requires
+                - from0, from1, and from2 are not collinear
+            ensures
+                - returns the affine transform that maps each fromN exactly onto toN.
+        !*/
+        {
+            // Solve M*[f1-f0, f2-f0] == [t1-t0, t2-t0] for M, then pick the offset so
+            // that from0 lands on to0.
+            const dlib::vector<double,2> f1 = from1-from0, f2 = from2-from0;
+            const dlib::vector<double,2> t1 = to1-to0,     t2 = to2-to0;
+            const double det = f1.x()*f2.y() - f2.x()*f1.y();
+            DLIB_ASSERT(det != 0, "The points given to find_affine_transform_3() are collinear.");
+
+            matrix<double,2,2> m;
+            m = (t1.x()*f2.y() - t2.x()*f1.y())/det, (t2.x()*f1.x() - t1.x()*f2.x())/det,
+                (t1.y()*f2.y() - t2.y()*f1.y())/det, (t2.y()*f1.x() - t1.y()*f2.x())/det;
+            return point_transform_affine(m, to0 - m*from0);
         }
 
     // ------------------------------------------------------------------------------------
@@ -207,11 +883,18 @@ namespace dlib
                   to (1,1).
         !*/
         {
-            std::vector<vector<float,2> > from_points, to_points;
-            from_points.push_back(rect.tl_corner()); to_points.push_back(point(0,0));
-            from_points.push_back(rect.tr_corner()); to_points.push_back(point(1,0));
-            from_points.push_back(rect.br_corner()); to_points.push_back(point(1,1));
-            return find_affine_transform(from_points, to_points);
+            if (rect.left() == rect.right() || rect.top() == rect.bottom())
+            {
+                // degenerate rectangle, let the least squares solver sort it out.
+                std::vector<vector<float,2> > from_points, to_points;
+                from_points.push_back(rect.tl_corner()); to_points.push_back(point(0,0));
+                from_points.push_back(rect.tr_corner()); to_points.push_back(point(1,0));
+                from_points.push_back(rect.br_corner()); to_points.push_back(point(1,1));
+                return find_affine_transform(from_points, to_points);
+            }
+            return find_affine_transform_3(rect.tl_corner(), point(0,0),
+                                           rect.tr_corner(), point(1,0),
+                                           rect.br_corner(), point(1,1));
         }
 
     // ------------------------------------------------------------------------------------
@@ -225,11 +908,10 @@ namespace dlib
                   rect.br_corner().
         !*/
         {
-            std::vector<vector<float,2> > from_points, to_points;
-            to_points.push_back(rect.tl_corner()); from_points.push_back(point(0,0));
-            to_points.push_back(rect.tr_corner()); from_points.push_back(point(1,0));
-            to_points.push_back(rect.br_corner()); from_points.push_back(point(1,1));
-            return find_affine_transform(from_points, to_points);
+            // the unit square corners are never collinear, so this always works.
+            return find_affine_transform_3(point(0,0), rect.tl_corner(),
+                                           point(1,0), rect.tr_corner(),
+                                           point(1,1), rect.br_corner());
         }
 
     // ------------------------------------------------------------------------------------
@@ -237,7 +919,8 @@ namespace dlib
         template <typename image_type, typename feature_type>
         void extract_feature_pixel_values (
             const image_type& img_,
-            const rectangle& rect,
+            const rectangle& area,
+            const point_transform_affine& tform_to_img,
             const matrix<float,0,1>& current_shape,
             const matrix<float,0,1>& reference_shape,
             const std::vector<unsigned long>& reference_pixel_anchor_idx,
@@ -246,25 +929,15 @@ namespace dlib
         )
         /*!
             requires
-                - image_type == an image object that implements the interface defined in
-                  dlib/image_processing/generic_image.h 
-                - reference_pixel_anchor_idx.size() == reference_pixel_deltas.size()
-                - current_shape.size() == reference_shape.size()
-                - reference_shape.size()%2 == 0
-                - max(mat(reference_pixel_anchor_idx)) < reference_shape.size()/2
+                - area == get_rect(img_)
+                - tform_to_img == unnormalizing_tform(rect)
+                - the requirements of the version below hold
             ensures
-                - #feature_pixel_values.size() == reference_pixel_deltas.size()
-                - for all valid i:
-                    - #feature_pixel_values[i] == the value of the pixel in img_ that
-                      corresponds to the pixel identified by reference_pixel_anchor_idx[i]
-                      and reference_pixel_deltas[i] when the pixel is located relative to
-                      current_shape rather than reference_shape.
+                - does the same thing as the version below but lets the caller compute
+                  area and tform_to_img once per face rather than once per cascade level.
         !*/
         {
             const matrix<float,2,2> tform = matrix_cast<float>(find_tform_between_shapes(reference_shape, current_shape).get_m());
-            const point_transform_affine tform_to_img = unnormalizing_tform(rect);
-
-            const rectangle area = get_rect(img_);
 
             const_image_view<image_type> img(img_);
             feature_pixel_values.resize(reference_pixel_deltas.size());
@@ -280,8 +953,93 @@ namespace dlib
             }
         }
 
+        template <typename image_type, typename feature_type>
+        void extract_feature_pixel_values (
+            const image_type& img_,
+            const rectangle& rect,
+            const matrix<float,0,1>& current_shape,
+            const matrix<float,0,1>& reference_shape,
+            const std::vector<unsigned long>& reference_pixel_anchor_idx,
+            const std::vector<dlib::vector<float,2> >& reference_pixel_deltas,
+            std::vector<feature_type>& feature_pixel_values
+        )
+        /*!
+            requires
+                - image_type == an image object that implements the interface defined in
+                  dlib/image_processing/generic_image.h 
+                - reference_pixel_anchor_idx.size() == reference_pixel_deltas.size()
+                - current_shape.size() == reference_shape.size()
+                - reference_shape.size()%2 == 0
+                - max(mat(reference_pixel_anchor_idx)) < reference_shape.size()/2
+            ensures
+                - #feature_pixel_values.size() == reference_pixel_deltas.size()
+                - for all valid i:
+                    - #feature_pixel_values[i] == the value of the pixel in img_ that
+                      corresponds to the pixel identified by reference_pixel_anchor_idx[i]
+                      and reference_pixel_deltas[i] when the pixel is located relative to
+                      current_shape rather than reference_shape.
+        !*/
+        {
+            extract_feature_pixel_values(img_, get_rect(img_), unnormalizing_tform(rect), current_shape,
+                                         reference_shape, reference_pixel_anchor_idx,
+                                         reference_pixel_deltas, feature_pixel_values);
+        }
+
     } // end namespace impl
 
+// ----------------------------------------------------------------------------------------
+
+    struct shape_predictor_limits
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                How much of the cascade shape_predictor::operator() runs.  The defaults
+                run all of it.
+        !*/
+
+        shape_predictor_limits (
+        ) : 
+            max_cascades(std::numeric_limits<unsigned long>::max()),
+            max_trees(std::numeric_limits<unsigned long>::max()),
+            min_update(0)
+        {}
+
+        // only the first max_cascades levels are run
+        unsigned long max_cascades;
+        // only the first max_trees trees of each level are run
+        unsigned long max_trees;
+        // a shape stops once a level moves its parts by less than this, root mean
+        // square, as a fraction of the size of its rectangle
+        double min_update;
+    };
+
+// ----------------------------------------------------------------------------------------
+
+    class shape_predictor_workspace
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                Scratch memory for shape_predictor::operator().  Once it has been used
+                for a given number of faces, reusing it for the same number of faces
+                (or fewer) does not touch the heap again.
+        !*/
+    public:
+        shape_predictor_workspace (
+        ) {}
+
+    private:
+        friend class shape_predictor;
+
+        // one entry per face
+        std::vector<matrix<float,0,1> > shapes;
+        std::vector<point_transform_affine> tforms;
+        std::vector<std::vector<float> > feature_pixel_values;
+        // the shapes before the last level, and whether they stopped, when the limits
+        // have a min_update
+        std::vector<matrix<float,0,1> > last_shapes;
+        std::vector<unsigned char> stopped;
+    };
+
 // ----------------------------------------------------------------------------------------
 
     class shape_predictor
@@ -297,7 +1055,7 @@ namespace dlib
             const matrix<float,0,1>& initial_shape_,
             const std::vector<std::vector<impl::regression_tree> >& forests_,
             const std::vector<std::vector<dlib::vector<float,2> > >& pixel_coordinates
-        ) : initial_shape(initial_shape_), forests(forests_)
+        ) : initial_shape(initial_shape_)
         /*!
             requires
                 - initial_shape.size()%2 == 0
@@ -311,6 +1069,7 @@ namespace dlib
                       (i.e. there need to be the right number of leaves given the number of splits in the tree)
         !*/
         {
+            compile_forests(forests_);
             anchor_idx.resize(pixel_coordinates.size());
             deltas.resize(pixel_coordinates.size());
             // Each cascade uses a different set of pixels for its features.  We compute
@@ -325,41 +1084,85 @@ namespace dlib
             return initial_shape.size()/2;
         }
 
+        unsigned long num_cascades (
+        ) const
+        {
+            return forests.size();
+        }
+
+        unsigned long num_trees (
+            unsigned long cascade
+        ) const
+        {
+            DLIB_ASSERT(cascade < num_cascades(),
+                "\t unsigned long shape_predictor::num_trees()"
+                << "\n\t Invalid inputs were given to this function. "
+                << "\n\t cascade:        " << cascade
+                << "\n\t num_cascades(): " << num_cascades()
+            );
+            return forests[cascade].num_trees();
+        }
+
         unsigned long num_features (
         ) const
         {
             unsigned long num = 0;
             for (unsigned long iter = 0; iter < forests.size(); ++iter)
-                for (unsigned long i = 0; i < forests[iter].size(); ++i)
-                    num += forests[iter][i].num_leaves();
+                for (unsigned long i = 0; i < forests[iter].num_trees(); ++i)
+                    num += forests[iter].num_leaves(i);
             return num;
         }
 
+        shape_predictor_leaf_type get_leaf_type (
+        ) const
+        {
+            if (forests.size() == 0)
+                return float32_leaves;
+            return forests[0].leaf_type;
+        }
+
+        void set_leaf_type (
+            shape_predictor_leaf_type new_type
+        )
+        {
+            for (unsigned long i = 0; i < forests.size(); ++i)
+                forests[i].set_leaf_type(new_type);
+        }
+
         template <typename image_type>
         full_object_detection operator()(
             const image_type& img,
             const rectangle& rect
         ) const
         {
-            using namespace impl;
-            matrix<float,0,1> current_shape = initial_shape;
-            std::vector<float> feature_pixel_values;
-            for (unsigned long iter = 0; iter < forests.size(); ++iter)
-            {
-                extract_feature_pixel_values(img, rect, current_shape, initial_shape,
-                                             anchor_idx[iter], deltas[iter], feature_pixel_values);
-                unsigned long leaf_idx;
-                // evaluate all the trees at this level of the cascade.
-                for (unsigned long i = 0; i < forests[iter].size(); ++i)
-                    current_shape += forests[iter][i](feature_pixel_values, leaf_idx);
-            }
+            shape_predictor_workspace ws;
+            full_object_detection det;
+            (*this)(img, rect, ws, det);
+            return det;
+        }
 
-            // convert the current_shape into a full_object_detection
-            const point_transform_affine tform_to_img = unnormalizing_tform(rect);
-            std::vector<point> parts(current_shape.size()/2);
-            for (unsigned long i = 0; i < parts.size(); ++i)
-                parts[i] = tform_to_img(location(current_shape, i));
-            return full_object_detection(rect, parts);
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const rectangle& rect,
+            shape_predictor_workspace& ws,
+            full_object_detection& det
+        ) const
+        {
+            (*this)(img, rect, ws, det, shape_predictor_limits());
+        }
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const rectangle& rect,
+            shape_predictor_workspace& ws,
+            full_object_detection& det,
+            const shape_predictor_limits& limits
+        ) const
+        {
+            prepare_workspace(ws, 1);
+            predict_batch(img, &rect, &det, 0, 1, ws, limits);
         }
 
         template <typename image_type, typename T, typename U>
@@ -379,13 +1182,14 @@ namespace dlib
                 extract_feature_pixel_values(img, rect, current_shape, initial_shape,
                                              anchor_idx[iter], deltas[iter], feature_pixel_values);
                 // evaluate all the trees at this level of the cascade.
-                for (unsigned long i = 0; i < forests[iter].size(); ++i)
+                const forest_view forest = forests[iter].view();
+                for (unsigned long i = 0; i < forest.num_trees; ++i)
                 {
                     unsigned long leaf_idx;
-                    current_shape += forests[iter][i](feature_pixel_values, leaf_idx);
+                    forest.add_leaf(&current_shape(0), i, forest.find_leaf(i, feature_pixel_values, leaf_idx));
 
                     feats.push_back(std::make_pair(feat_offset+leaf_idx, 1));
-                    feat_offset += forests[iter][i].num_leaves();
+                    feat_offset += forest.num_leaves(i);
                 }
             }
 
@@ -397,23 +1201,234 @@ namespace dlib
             return full_object_detection(rect, parts);
         }
 
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const std::vector<rectangle>& rects,
+            std::vector<full_object_detection>& dets
+        ) const
+        {
+            shape_predictor_workspace ws;
+            (*this)(img, rects, dets, ws);
+        }
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const std::vector<rectangle>& rects,
+            std::vector<full_object_detection>& dets,
+            shape_predictor_workspace& ws
+        ) const
+        {
+            (*this)(img, rects, dets, ws, shape_predictor_limits());
+        }
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const std::vector<rectangle>& rects,
+            std::vector<full_object_detection>& dets,
+            shape_predictor_workspace& ws,
+            const shape_predictor_limits& limits
+        ) const
+        {
+            dets.resize(rects.size());
+            if (rects.size() == 0)
+                return;
+            prepare_workspace(ws, rects.size());
+            predict_batch(img, &rects[0], &dets[0], 0, rects.size(), ws, limits);
+        }
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const std::vector<rectangle>& rects,
+            std::vector<full_object_detection>& dets,
+            thread_pool& tp
+        ) const
+        {
+            shape_predictor_workspace ws;
+            (*this)(img, rects, dets, ws, tp);
+        }
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const std::vector<rectangle>& rects,
+            std::vector<full_object_detection>& dets,
+            shape_predictor_workspace& ws,
+            thread_pool& tp
+        ) const
+        {
+            (*this)(img, rects, dets, ws, tp, shape_predictor_limits());
+        }
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const std::vector<rectangle>& rects,
+            std::vector<full_object_detection>& dets,
+            shape_predictor_workspace& ws,
+            thread_pool& tp,
+            const shape_predictor_limits& limits
+        ) const
+        {
+            dets.resize(rects.size());
+            if (rects.size() == 0)
+                return;
+            prepare_workspace(ws, rects.size());
+            // Give each thread one contiguous run of faces so it can still walk the
+            // cascade level by level over all of them.  The workspace keeps separate
+            // buffers for each face, so the threads never share one.
+            parallel_for_blocked(tp, 0, rects.size(), [&](long begin, long end)
+                { predict_batch(img, &rects[0], &dets[0], begin, end, ws, limits); }, 1);
+        }
+
         friend void serialize (const shape_predictor& item, std::ostream& out);
 
         friend void deserialize (shape_predictor& item, std::istream& in);
 
+        friend void save_mapped_shape_predictor (const shape_predictor& item, const std::string& filename);
+
     private:
+
+        void prepare_workspace (
+            shape_predictor_workspace& ws,
+            unsigned long num
+        ) const
+        /*!
+            ensures
+                - makes ws hold scratch space for at least num faces.
+        !*/
+        {
+            if (ws.shapes.size() < num)
+            {
+                ws.shapes.resize(num);
+                ws.tforms.resize(num);
+                ws.feature_pixel_values.resize(num);
+                ws.last_shapes.resize(num);
+                ws.stopped.resize(num);
+            }
+        }
+
+        template <typename image_type>
+        void predict_batch (
+            const image_type& img,
+            const rectangle* rects,
+            full_object_detection* dets,
+            unsigned long begin,
+            unsigned long end,
+            shape_predictor_workspace& ws,
+            const shape_predictor_limits& limits
+        ) const
+        /*!
+            requires
+                - rects and dets point to arrays with at least end elements.
+                - ws holds space for at least end faces.
+            ensures
+                - #dets[i] == (*this)(img, rects[i]) with the given limits, for all i
+                  in [begin, end)
+                - only the workspace entries in [begin, end) are touched.
+        !*/
+        {
+            using namespace impl;
+            const rectangle area = get_rect(img);
+            for (unsigned long j = begin; j < end; ++j)
+            {
+                ws.shapes[j].set_size(initial_shape.size());
+                ws.shapes[j] = initial_shape;
+                ws.tforms[j] = unnormalizing_tform(rects[j]);
+                ws.stopped[j] = false;
+            }
+
+            // min_update is compared with the root mean square move of the parts, so
+            // compare the squared norm of the whole update with this instead.
+            const bool check_update = limits.min_update > 0;
+            const double min_update_sq = limits.min_update*limits.min_update*num_parts();
+
+            // Evaluate one cascade level for every face before moving on to the next
+            // one.  This way the trees of a level are pulled into the cache once per
+            // frame rather than once per face.
+            const unsigned long num_levels = std::min<unsigned long>(forests.size(), limits.max_cascades);
+            for (unsigned long iter = 0; iter < num_levels; ++iter)
+            {
+                const forest_view forest = forests[iter].view();
+                const unsigned long num_trees = std::min<unsigned long>(forest.num_trees, limits.max_trees);
+                for (unsigned long j = begin; j < end; ++j)
+                {
+                    if (ws.stopped[j])
+                        continue;
+                    if (check_update)
+                        ws.last_shapes[j] = ws.shapes[j];
+
+                    std::vector<float>& feature_pixel_values = ws.feature_pixel_values[j];
+                    extract_feature_pixel_values(img, area, ws.tforms[j], ws.shapes[j], initial_shape,
+                                                 anchor_idx[iter], deltas[iter], feature_pixel_values);
+                    unsigned long leaf_idx;
+                    for (unsigned long i = 0; i < num_trees; ++i)
+                        forest.add_leaf(&ws.shapes[j](0), i, forest.find_leaf(i, feature_pixel_values, leaf_idx));
+
+                    if (check_update && length_squared(ws.shapes[j]-ws.last_shapes[j]) < min_update_sq)
+                        ws.stopped[j] = true;
+                }
+            }
+
+            // write the results into dets, reusing their part storage when possible.
+            for (unsigned long j = begin; j < end; ++j)
+            {
+                full_object_detection& det = dets[j];
+                if (det.num_parts() != num_parts())
+                    det = full_object_detection(rects[j], std::vector<point>(num_parts()));
+                else
+                    det.get_rect() = rects[j];
+                for (unsigned long i = 0; i < num_parts(); ++i)
+                    det.part(i) = ws.tforms[j](location(ws.shapes[j], i));
+            }
+        }
+
+        void compile_forests (
+            const std::vector<std::vector<impl::regression_tree> >& trees
+        )
+        {
+            forests.resize(trees.size());
+            for (unsigned long i = 0; i < trees.size(); ++i)
+                forests[i].compile(trees[i], initial_shape.size());
+        }
+
+        void decompile_forests (
+            std::vector<std::vector<impl::regression_tree> >& trees
+        ) const
+        {
+            trees.resize(forests.size());
+            for (unsigned long i = 0; i < forests.size(); ++i)
+                forests[i].decompile(trees[i]);
+        }
+
         matrix<float,0,1> initial_shape;
-        std::vector<std::vector<impl::regression_tree> > forests;
+        // Only the compiled form of the cascade is kept in memory.  The
+        // std::vector<regression_tree> form is rebuilt when serializing.
+        std::vector<impl::compiled_forest> forests;
         std::vector<std::vector<unsigned long> > anchor_idx; 
         std::vector<std::vector<dlib::vector<float,2> > > deltas;
     };
 
     inline void serialize (const shape_predictor& item, std::ostream& out)
     {
-        int version = 1;
+        // Models with float leaves keep using the original format so that older
+        // versions of dlib can still read them.
+        int version = item.get_leaf_type() == float32_leaves ? 1 : 2;
         dlib::serialize(version, out);
         dlib::serialize(item.initial_shape, out);
-        dlib::serialize(item.forests, out);
+        if (version == 1)
+        {
+            std::vector<std::vector<impl::regression_tree> > forests;
+            item.decompile_forests(forests);
+            dlib::serialize(forests, out);
+        }
+        else
+        {
+            dlib::serialize(item.forests, out);
+        }
         dlib::serialize(item.anchor_idx, out);
         dlib::serialize(item.deltas, out);
     }
@@ -422,10 +1437,19 @@ namespace dlib
     {
         int version = 0;
         dlib::deserialize(version, in);
-        if (version != 1)
+        if (version != 1 && version != 2)
             throw serialization_error("Unexpected version found while deserializing dlib::shape_predictor.");
         dlib::deserialize(item.initial_shape, in);
-        dlib::deserialize(item.forests, in);
+        if (version == 1)
+        {
+            std::vector<std::vector<impl::regression_tree> > forests;
+            dlib::deserialize(forests, in);
+            item.compile_forests(forests);
+        }
+        else
+        {
+            dlib::deserialize(item.forests, in);
+        }
         dlib::deserialize(item.anchor_idx, in);
         dlib::deserialize(item.deltas, in);
     }
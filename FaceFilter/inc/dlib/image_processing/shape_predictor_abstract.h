@@ -7,10 +7,91 @@
 #include "../matrix.h"
 #include "../geometry.h"
 #include "../pixel.h"
+#include "../threads/thread_pool_extension_abstract.h"
 
 namespace dlib
 {
 
+// ----------------------------------------------------------------------------------------
+
+    enum shape_predictor_leaf_type
+    {
+        /*!
+            The ways a shape_predictor can store the leaf values of its regression trees.
+            Almost all of a shape_predictor's memory is spent on these values.
+                - float32_leaves: full precision.  This is the default.
+                - float16_leaves: IEEE half floats.  Half the size of float32_leaves.
+                - int8_leaves: 8 bit integers with one scale factor per tree.  A quarter
+                  of the size of float32_leaves.
+        !*/
+        float32_leaves,
+        float16_leaves,
+        int8_leaves
+    };
+
+// ----------------------------------------------------------------------------------------
+
+    struct shape_predictor_limits
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This object tells shape_predictor::operator() how much of the cascade to
+                run.  The later levels of a cascade, and the later trees of a level, only
+                refine the shape a little, so running fewer of them trades accuracy for
+                time.  Since the limits are given with each call, a caller can pick
+                them per face or per frame, e.g. running less of the cascade on small
+                or fast moving faces.
+
+                The defaults run the whole cascade, giving the same results as the
+                calls that take no limits.
+        !*/
+
+        shape_predictor_limits (
+        );
+        /*!
+            ensures
+                - #max_cascades == #max_trees == std::numeric_limits<unsigned long>::max()
+                - #min_update == 0
+        !*/
+
+        unsigned long max_cascades;
+        /*!
+            Only the first max_cascades levels of the cascade are run.
+        !*/
+
+        unsigned long max_trees;
+        /*!
+            Only the first max_trees trees of each level are run.
+        !*/
+
+        double min_update;
+        /*!
+            The cascade stops for a shape once a level moves its parts by less than
+            min_update, root mean square, measured as a fraction of the size of the
+            rectangle the shape is in.  0 never stops early.
+        !*/
+    };
+
+// ----------------------------------------------------------------------------------------
+
+    class shape_predictor_workspace
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This object holds the scratch memory used by shape_predictor::operator().
+                Passing the same workspace to every call lets a video pipeline run
+                without any heap allocations once the workspace has been used for the
+                largest number of faces seen so far.  The output full_object_detection
+                objects are overwritten in place, so they should be reused as well.
+
+                A workspace must not be used by two calls to shape_predictor::operator()
+                at the same time.
+        !*/
+    public:
+        shape_predictor_workspace (
+        );
+    };
+
 // ----------------------------------------------------------------------------------------
 
     class shape_predictor
@@ -52,6 +133,23 @@ namespace dlib
                 - returns the number of parts in the shapes predicted by this object.
         !*/
 
+        unsigned long num_cascades (
+        ) const;
+        /*!
+            ensures
+                - returns the number of levels in the cascade of this object.
+        !*/
+
+        unsigned long num_trees (
+            unsigned long cascade
+        ) const;
+        /*!
+            requires
+                - cascade < num_cascades()
+            ensures
+                - returns the number of trees in the given level of the cascade.
+        !*/
+
         unsigned long num_features (
         ) const;
         /*!
@@ -61,6 +159,26 @@ namespace dlib
                   of leaves on each tree.  
         !*/
 
+        shape_predictor_leaf_type get_leaf_type (
+        ) const;
+        /*!
+            ensures
+                - returns the encoding used to store the leaf values of the trees.
+        !*/
+
+        void set_leaf_type (
+            shape_predictor_leaf_type new_type
+        );
+        /*!
+            ensures
+                - #get_leaf_type() == new_type
+                - Converts the stored leaf values to the new encoding.  Converting to
+                  float16_leaves or int8_leaves is lossy, so the predicted shapes will
+                  differ slightly from the ones given by the float32_leaves model.
+                  Quantized leaves are converted back to float on the fly by operator(),
+                  so they are never expanded in memory.
+        !*/
+
         template <typename image_type, typename T, typename U>
         full_object_detection operator()(
             const image_type& img,
@@ -111,12 +229,165 @@ namespace dlib
                   where the 3d argument is discarded.
         !*/
 
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const rectangle& rect,
+            shape_predictor_workspace& ws,
+            full_object_detection& det
+        ) const;
+        /*!
+            requires
+                - image_type == an image object that implements the interface defined in
+                  dlib/image_processing/generic_image.h 
+            ensures
+                - #det == (*this)(img, rect)
+                - Uses ws for all temporary storage and reuses the memory already in det,
+                  so once ws and det have been through one call no more heap allocations
+                  are made.
+        !*/
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const rectangle& rect,
+            shape_predictor_workspace& ws,
+            full_object_detection& det,
+            const shape_predictor_limits& limits
+        ) const;
+        /*!
+            requires
+                - image_type == an image object that implements the interface defined in
+                  dlib/image_processing/generic_image.h 
+            ensures
+                - Does the same thing as (*this)(img, rect, ws, det) except that only the
+                  part of the cascade allowed by limits is run.
+        !*/
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const std::vector<rectangle>& rects,
+            std::vector<full_object_detection>& dets
+        ) const;
+        /*!
+            requires
+                - image_type == an image object that implements the interface defined in
+                  dlib/image_processing/generic_image.h 
+            ensures
+                - #dets.size() == rects.size()
+                - for all valid i:
+                    - #dets[i] == (*this)(img, rects[i])
+                - This is the fast way to find the shapes of several objects in one image.
+                  The cascade is evaluated one level at a time for all the rectangles, so
+                  each level's trees are only pulled into the cache once.  Also, the
+                  elements of dets are overwritten in place, so passing the same dets in
+                  every frame avoids reallocating the parts.
+        !*/
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const std::vector<rectangle>& rects,
+            std::vector<full_object_detection>& dets,
+            shape_predictor_workspace& ws
+        ) const;
+        /*!
+            requires
+                - image_type == an image object that implements the interface defined in
+                  dlib/image_processing/generic_image.h 
+            ensures
+                - Does the same thing as (*this)(img, rects, dets) except that all
+                  temporary storage comes from ws.  So once ws and dets have been used
+                  with at least rects.size() rectangles no more heap allocations are
+                  made.
+        !*/
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const std::vector<rectangle>& rects,
+            std::vector<full_object_detection>& dets,
+            shape_predictor_workspace& ws,
+            const shape_predictor_limits& limits
+        ) const;
+        /*!
+            requires
+                - image_type == an image object that implements the interface defined in
+                  dlib/image_processing/generic_image.h 
+            ensures
+                - Does the same thing as (*this)(img, rects, dets, ws) except that only
+                  the part of the cascade allowed by limits is run.  When limits has a
+                  min_update, each rectangle stops on its own.
+        !*/
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const std::vector<rectangle>& rects,
+            std::vector<full_object_detection>& dets,
+            thread_pool& tp
+        ) const;
+        /*!
+            requires
+                - image_type == an image object that implements the interface defined in
+                  dlib/image_processing/generic_image.h 
+            ensures
+                - Does the same thing as (*this)(img, rects, dets) except that the
+                  rectangles are split into contiguous runs that are processed in
+                  parallel by the threads in tp.
+        !*/
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const std::vector<rectangle>& rects,
+            std::vector<full_object_detection>& dets,
+            shape_predictor_workspace& ws,
+            thread_pool& tp
+        ) const;
+        /*!
+            requires
+                - image_type == an image object that implements the interface defined in
+                  dlib/image_processing/generic_image.h 
+            ensures
+                - Does the same thing as (*this)(img, rects, dets, tp) except that the
+                  face buffers come from ws.  Note that handing the work to tp itself
+                  still allocates.
+        !*/
+
+        template <typename image_type>
+        void operator()(
+            const image_type& img,
+            const std::vector<rectangle>& rects,
+            std::vector<full_object_detection>& dets,
+            shape_predictor_workspace& ws,
+            thread_pool& tp,
+            const shape_predictor_limits& limits
+        ) const;
+        /*!
+            requires
+                - image_type == an image object that implements the interface defined in
+                  dlib/image_processing/generic_image.h 
+            ensures
+                - Does the same thing as (*this)(img, rects, dets, ws, tp) except that
+                  only the part of the cascade allowed by limits is run.
+        !*/
+
     };
 
     void serialize (const shape_predictor& item, std::ostream& out);
     void deserialize (shape_predictor& item, std::istream& in);
     /*!
-        provides serialization support
+        provides serialization support.  Models using float32_leaves are written in the
+        original format.  Quantized models are written in a compact format where the
+        leaf table is stored as one raw little-endian block and the split thresholds are
+        stored as half floats.  deserialize() reads both formats.
+
+        If enable_raw_block_serialization() was called on out, the leaf vectors, the
+        initial shape and the anchor indices are written as raw blocks (see
+        dlib/serialize.h), which makes a float32_leaves model about a third smaller and
+        several times faster to load.
     !*/
 
 // ----------------------------------------------------------------------------------------
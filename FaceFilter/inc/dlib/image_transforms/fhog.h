@@ -327,7 +327,15 @@ namespace dlib
         // ------------------------------------------------------------------------------------
 
         template <typename image_type>
-        inline typename dlib::disable_if_c<pixel_traits<typename image_type::pixel_type>::rgb>::type get_gradient(
+        struct is_gray_u8_image
+        {
+            const static bool value = is_same_type<typename image_type::pixel_type,unsigned char>::value;
+        };
+
+        template <typename image_type>
+        inline typename dlib::disable_if_c<pixel_traits<typename image_type::pixel_type>::rgb ||
+                                           (is_gray_u8_image<image_type>::value &&
+                                            has_contiguous_rows<image_type>::value)>::type get_gradient(
             int r,
             int c,
             const image_type& img,
@@ -375,6 +383,156 @@ namespace dlib
 
             len = (grad_x*grad_x + grad_y*grad_y);
         }
+
+        inline simd8i load_8_pixels (
+            const unsigned char* p
+        )
+        /*!
+            ensures
+                - returns the 8 bytes starting at p, zero extended to 32 bits.
+        !*/
+        {
+#if defined(DLIB_HAVE_AVX2)
+            return simd8i(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)p)));
+#elif defined(DLIB_HAVE_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i p16 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)p), zero);
+            return simd8i(simd4i(_mm_unpacklo_epi16(p16, zero)), simd4i(_mm_unpackhi_epi16(p16, zero)));
+#elif defined(DLIB_HAVE_NEON)
+            const uint16x8_t p16 = vmovl_u8(vld1_u8(p));
+            return simd8i(simd4i(vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(p16)))),
+                          simd4i(vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(p16)))));
+#else
+            return simd8i(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]);
+#endif
+        }
+
+        template <typename image_type>
+        inline typename dlib::enable_if_c<is_gray_u8_image<image_type>::value &&
+                                          has_contiguous_rows<image_type>::value>::type get_gradient(
+            int r,
+            int c,
+            const image_type& img,
+            simd8f& grad_x,
+            simd8f& grad_y,
+            simd8f& len
+            )
+        {
+            // Same as the version above, but since the pixels are bytes the 8 values
+            // of each neighbor are fetched with one load rather than 8 scalar reads.
+            // The gradients are the same integers, so the results are identical.
+            const unsigned char* const row = &img[r][c];
+            const simd8i left = load_8_pixels(row - 1);
+            const simd8i right = load_8_pixels(row + 1);
+            const simd8i top = load_8_pixels(&img[r-1][c]);
+            const simd8i bottom = load_8_pixels(&img[r+1][c]);
+
+            grad_x = right - left;
+            grad_y = bottom - top;
+
+            len = (grad_x*grad_x + grad_y*grad_y);
+        }
+
+        // ------------------------------------------------------------------------------------
+
+        inline void snap_to_orientations (
+            const simd8f& grad_x,
+            const simd8f& grad_y,
+            const matrix<float,2,1>* directions,
+            int32* best_o_out
+        )
+        /*!
+            ensures
+                - #best_o_out[i] == the one of the 18 orientations (the 9 directions and
+                  their opposites) that is closest to the i-th gradient, for i in [0,8).
+        !*/
+        {
+            simd8f best_dot = 0;
+            simd8f best_o = 0;
+            for (int o = 0; o < 9; o++)
+            {
+                simd8f dot = grad_x*directions[o](0) + grad_y*directions[o](1);
+                simd8f_bool cmp = dot>best_dot;
+                best_dot = select(cmp, dot, best_dot);
+                dot *= -1;
+                best_o = select(cmp, o, best_o);
+
+                cmp = dot > best_dot;
+                best_dot = select(cmp, dot, best_dot);
+                best_o = select(cmp, o + 9, best_o);
+            }
+            simd8i(best_o).store(best_o_out);
+        }
+
+        class gray_u8_orientation_table
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    The orientation snap_to_orientations() picks for every gradient
+                    of an 8 bit grayscale image.  Both components of such a gradient
+                    are integers in [-255,255], so the 18 way snap is a lookup into a
+                    511x511 table.  The table is filled by snap_to_orientations()
+                    itself, so looking up an orientation gives exactly the same answer
+                    as computing it.
+            !*/
+        public:
+            explicit gray_u8_orientation_table (
+                const matrix<float,2,1>* directions
+            )
+            {
+                int32 best_o[8];
+                for (int gy = -255; gy <= 255; ++gy)
+                {
+                    for (int gx = -255; gx <= 255; gx += 8)
+                    {
+                        snap_to_orientations(simd8f(gx, gx+1, gx+2, gx+3, gx+4, gx+5, gx+6, gx+7),
+                                             simd8f(gy), directions, best_o);
+                        for (int i = 0; i < 8 && gx+i <= 255; ++i)
+                            table[(gy+255)*511 + gx+i+255] = best_o[i];
+                    }
+                }
+            }
+
+            unsigned char operator() (
+                int gx,
+                int gy
+            ) const { return table[(gy+255)*511 + gx+255]; }
+
+        private:
+            unsigned char table[511*511];
+        };
+
+        template <typename image_type>
+        inline typename dlib::disable_if<is_gray_u8_image<image_type> >::type snap_to_orientations (
+            const image_type& ,
+            const simd8f& grad_x,
+            const simd8f& grad_y,
+            const matrix<float,2,1>* directions,
+            int32* best_o
+        )
+        {
+            snap_to_orientations(grad_x, grad_y, directions, best_o);
+        }
+
+        template <typename image_type>
+        inline typename dlib::enable_if<is_gray_u8_image<image_type> >::type snap_to_orientations (
+            const image_type& ,
+            const simd8f& grad_x,
+            const simd8f& grad_y,
+            const matrix<float,2,1>* directions,
+            int32* best_o
+        )
+        {
+            // The 18 dot products and selects per pixel cost more than the rest of the
+            // histogram pass put together, so for byte images use the table instead.
+            // The directions are the same constants on every call.
+            static const gray_u8_orientation_table table(directions);
+            int32 gx[8], gy[8];
+            simd8i(grad_x).store(gx);
+            simd8i(grad_y).store(gy);
+            for (int i = 0; i < 8; ++i)
+                best_o[i] = table(gx[i], gy[i]);
+        }
         
         // ------------------------------------------------------------------------------------
 
@@ -500,7 +658,9 @@ namespace dlib
             const image_type& img_, 
             out_type& hog, 
             int filter_rows_padding,
-            int filter_cols_padding
+            int filter_cols_padding,
+            array2d<unsigned char>& angle,
+            array2d<float>& norm
         ) 
         {
             const_image_view<image_type> img(img_);
@@ -539,9 +699,9 @@ namespace dlib
                 return;
             }
 
-            array2d<unsigned char> angle(img.nr(), img.nc());
+            angle.set_size(img.nr(), img.nc());
 
-            array2d<float> norm(img.nr(), img.nc());
+            norm.set_size(img.nr(), img.nc());
             zero_border_pixels(norm,1,1);
 
             // memory for HOG features
@@ -570,22 +730,8 @@ namespace dlib
                     v.store(_vv);
 
                     // Now snap the gradient to one of 18 orientations
-                    simd8f best_dot = 0;
-                    simd8f best_o = 0;
-                    for (int o = 0; o < 9; o++)
-                    {
-                        simd8f dot = grad_x*directions[o](0) + grad_y*directions[o](1);
-                        simd8f_bool cmp = dot>best_dot;
-                        best_dot = select(cmp, dot, best_dot);
-                        dot *= -1;
-                        best_o = select(cmp, o, best_o);
-
-                        cmp = dot > best_dot;
-                        best_dot = select(cmp, dot, best_dot);
-                        best_o = select(cmp, o + 9, best_o);
-                    }
-
-                    int32 _best_o[8]; simd8i(best_o).store(_best_o);
+                    int32 _best_o[8];
+                    snap_to_orientations(img, grad_x, grad_y, directions, _best_o);
 
                     norm[y][x + 0] = _vv[0];
                     norm[y][x + 1] = _vv[1];
@@ -693,8 +839,372 @@ namespace dlib
             }
         }
 
+        template <
+            typename image_type, 
+            typename out_type
+            >
+        void impl_extract_fhog_features_cell_size_1(
+            const image_type& img, 
+            out_type& hog, 
+            int filter_rows_padding,
+            int filter_cols_padding
+        ) 
+        {
+            // angle and norm are only scratch memory, see the overload above.
+            array2d<unsigned char> angle;
+            array2d<float> norm;
+            impl_extract_fhog_features_cell_size_1(img, hog, filter_rows_padding, filter_cols_padding, angle, norm);
+        }
+
     // ------------------------------------------------------------------------------------
 
+        inline void get_fhog_directions (
+            matrix<float,2,1>* directions
+        )
+        /*!
+            ensures
+                - #directions[0] through #directions[8] are the unit vectors the gradients
+                  are snapped to.
+        !*/
+        {
+            directions[0] =  1.0000, 0.0000; 
+            directions[1] =  0.9397, 0.3420;
+            directions[2] =  0.7660, 0.6428;
+            directions[3] =  0.500,  0.8660;
+            directions[4] =  0.1736, 0.9848;
+            directions[5] = -0.1736, 0.9848;
+            directions[6] = -0.5000, 0.8660;
+            directions[7] = -0.7660, 0.6428;
+            directions[8] = -0.9397, 0.3420;
+        }
+
+        template <
+            typename out_type
+            >
+        bool start_fhog_features (
+            long nr,
+            long nc,
+            out_type& hog,
+            int cell_size,
+            int filter_rows_padding,
+            int filter_cols_padding,
+            int& cells_nr,
+            int& cells_nc
+        )
+        /*!
+            requires
+                - cell_size > 1
+            ensures
+                - #cells_nr and #cells_nc == the number of rows and columns of FHOG
+                  cells of an nr by nc image.
+                - returns false, with hog cleared, if the image is too small to have any
+                  features.  There is nothing left to do in that case.
+                - else sizes hog for the features and returns true.
+        !*/
+        {
+            cells_nr = (int)((float)nr/(float)cell_size + 0.5);
+            cells_nc = (int)((float)nc/(float)cell_size + 0.5);
+
+            // memory for HOG features
+            const int hog_nr = std::max(cells_nr-2, 0);
+            const int hog_nc = std::max(cells_nc-2, 0);
+            if (hog_nr == 0 || hog_nc == 0)
+            {
+                hog.clear();
+                return false;
+            }
+            init_hog(hog, hog_nr, hog_nc, filter_rows_padding, filter_cols_padding);
+            return true;
+        }
+
+        inline int fhog_histogram_row (
+            int y,
+            int cell_size
+        )
+        /*!
+            ensures
+                - returns the cell row that pixel row y mostly votes into.  It votes
+                  into rows fhog_histogram_row(y,cell_size)+1 and +2 of the padded
+                  histograms, and the result never decreases as y grows.
+        !*/
+        {
+            const float yp = ((float)y+0.5)/(float)cell_size - 0.5;
+            return (int)std::floor(yp);
+        }
+
+        template <
+            typename image_type,
+            typename hist_type
+            >
+        void add_row_to_fhog_histograms (
+            const image_type& img,
+            int y,
+            int visible_nc,
+            int cell_size,
+            const matrix<float,2,1>* directions,
+            hist_type& hist
+        )
+        /*!
+            requires
+                - img[y-1], img[y] and img[y+1] are rows of the image, each with at
+                  least visible_nc+1 pixels.
+                - hist[r][c] is the histogram of cell (r-1,c-1), with a border of one
+                  cell all the way around.  Only rows fhog_histogram_row(y,cell_size)+1
+                  and fhog_histogram_row(y,cell_size)+2 of hist are used.
+            ensures
+                - adds the gradients of pixels 1 through visible_nc-1 of row y into hist.
+        !*/
+        {
+            const float yp = ((float)y+0.5)/(float)cell_size - 0.5;
+            const int iyp = (int)std::floor(yp);
+            const float vy0 = yp - iyp;
+            const float vy1 = 1.0 - vy0;
+            // the two rows of hist this row votes into
+            matrix<float,18,1>* const hist1 = &hist[iyp+1][0];
+            matrix<float,18,1>* const hist2 = &hist[iyp+2][0];
+            int x;
+            for (x = 1; x < visible_nc - 7; x += 8)
+            {
+                simd8f xx(x, x + 1, x + 2, x + 3, x + 4, x + 5, x + 6, x + 7);
+                // v will be the length of the gradient vectors.
+                simd8f grad_x, grad_y, v;
+                get_gradient(y, x, img, grad_x, grad_y, v);
+
+                // We will use bilinear interpolation to add into the histogram bins.
+                // So first we precompute the values needed to determine how much each
+                // pixel votes into each bin.
+                simd8f xp = (xx + 0.5) / (float)cell_size + 0.5;
+                simd8i ixp = simd8i(xp);
+                simd8f vx0 = xp - ixp;
+                simd8f vx1 = 1.0f - vx0;
+
+                v = sqrt(v);
+
+                // Now snap the gradient to one of 18 orientations
+                int32 _best_o[8];
+                snap_to_orientations(img, grad_x, grad_y, directions, _best_o);
+
+
+                // Add the gradient magnitude, v, to 4 histograms around pixel using
+                // bilinear interpolation.
+                vx1 *= v;
+                vx0 *= v;
+                // The amounts for each bin
+                simd8f v11 = vy1*vx1;
+                simd8f v01 = vy0*vx1;
+                simd8f v10 = vy1*vx0;
+                simd8f v00 = vy0*vx0;
+
+                int32 _ixp[8];    ixp.store(_ixp);
+                float _v11[8];    v11.store(_v11);
+                float _v01[8];    v01.store(_v01);
+                float _v10[8];    v10.store(_v10);
+                float _v00[8];    v00.store(_v00);
+
+                hist1[_ixp[0]](_best_o[0]) += _v11[0];
+                hist2[_ixp[0]](_best_o[0]) += _v01[0];
+                hist1[_ixp[0] + 1](_best_o[0]) += _v10[0];
+                hist2[_ixp[0] + 1](_best_o[0]) += _v00[0];
+
+                hist1[_ixp[1]](_best_o[1]) += _v11[1];
+                hist2[_ixp[1]](_best_o[1]) += _v01[1];
+                hist1[_ixp[1] + 1](_best_o[1]) += _v10[1];
+                hist2[_ixp[1] + 1](_best_o[1]) += _v00[1];
+
+                hist1[_ixp[2]](_best_o[2]) += _v11[2];
+                hist2[_ixp[2]](_best_o[2]) += _v01[2];
+                hist1[_ixp[2] + 1](_best_o[2]) += _v10[2];
+                hist2[_ixp[2] + 1](_best_o[2]) += _v00[2];
+
+                hist1[_ixp[3]](_best_o[3]) += _v11[3];
+                hist2[_ixp[3]](_best_o[3]) += _v01[3];
+                hist1[_ixp[3] + 1](_best_o[3]) += _v10[3];
+                hist2[_ixp[3] + 1](_best_o[3]) += _v00[3];
+
+                hist1[_ixp[4]](_best_o[4]) += _v11[4];
+                hist2[_ixp[4]](_best_o[4]) += _v01[4];
+                hist1[_ixp[4] + 1](_best_o[4]) += _v10[4];
+                hist2[_ixp[4] + 1](_best_o[4]) += _v00[4];
+
+                hist1[_ixp[5]](_best_o[5]) += _v11[5];
+                hist2[_ixp[5]](_best_o[5]) += _v01[5];
+                hist1[_ixp[5] + 1](_best_o[5]) += _v10[5];
+                hist2[_ixp[5] + 1](_best_o[5]) += _v00[5];
+
+                hist1[_ixp[6]](_best_o[6]) += _v11[6];
+                hist2[_ixp[6]](_best_o[6]) += _v01[6];
+                hist1[_ixp[6] + 1](_best_o[6]) += _v10[6];
+                hist2[_ixp[6] + 1](_best_o[6]) += _v00[6];
+
+                hist1[_ixp[7]](_best_o[7]) += _v11[7];
+                hist2[_ixp[7]](_best_o[7]) += _v01[7];
+                hist1[_ixp[7] + 1](_best_o[7]) += _v10[7];
+                hist2[_ixp[7] + 1](_best_o[7]) += _v00[7];
+            }
+            // Now process the right columns that don't fit into simd registers.
+            for (; x < visible_nc; x++) 
+            {
+                matrix<float, 2, 1> grad;
+                float v;
+                get_gradient(y,x,img,grad,v);
+
+                // snap to one of 18 orientations
+                float best_dot = 0;
+                int best_o = 0;
+                for (int o = 0; o < 9; o++) 
+                {
+                    const float dot = dlib::dot(directions[o], grad);
+                    if (dot > best_dot) 
+                    {
+                        best_dot = dot;
+                        best_o = o;
+                    } 
+                    else if (-dot > best_dot) 
+                    {
+                        best_dot = -dot;
+                        best_o = o+9;
+                    }
+                }
+
+                v = std::sqrt(v);
+                // add to 4 histograms around pixel using bilinear interpolation
+                const float xp = ((double)x + 0.5) / (double)cell_size - 0.5;
+                const int ixp = (int)std::floor(xp);
+                const float vx0 = xp - ixp;
+                const float vx1 = 1.0 - vx0;
+
+                hist1[ixp+1](best_o) += vy1*vx1*v;
+                hist2[ixp+1](best_o) += vy0*vx1*v;
+                hist1[ixp+1+1](best_o) += vy1*vx0*v;
+                hist2[ixp+1+1](best_o) += vy0*vx0*v;
+            }
+        }
+
+        template <
+            typename hist_type,
+            typename norm_type
+            >
+        void compute_fhog_norm_row (
+            const hist_type& hist,
+            norm_type& norm,
+            int r,
+            int cells_nc
+        )
+        /*!
+            requires
+                - all the image rows that vote into row r+1 of hist have been added to it
+            ensures
+                - #norm[r][c] == the energy of cell (r,c), for all c in [0,cells_nc)
+        !*/
+        {
+            for (int c = 0; c < cells_nc; ++c)
+            {
+                float n = 0;
+                for (int o = 0; o < 9; o++) 
+                {
+                    n += (hist[r+1][c+1](o) + hist[r+1][c+1](o+9)) * (hist[r+1][c+1](o) + hist[r+1][c+1](o+9));
+                }
+                norm[r][c] = n;
+            }
+        }
+
+        template <
+            typename out_type,
+            typename hist_type,
+            typename norm_type
+            >
+        void compute_fhog_feature_row (
+            out_type& hog,
+            int y,
+            int hog_nc,
+            int filter_rows_padding,
+            int filter_cols_padding,
+            const hist_type& hist,
+            const norm_type& norm
+        )
+        /*!
+            requires
+                - rows y through y+2 of norm and row y+2 of hist are done
+            ensures
+                - stores the features of row y of hog
+        !*/
+        {
+            const int padding_rows_offset = (filter_rows_padding-1)/2;
+            const int padding_cols_offset = (filter_cols_padding-1)/2;
+            const float eps = 0.0001;
+            const int yy = y+padding_rows_offset; 
+            for (int x = 0; x < hog_nc; x++) 
+            {
+                const simd4f z1(norm[y+1][x+1],
+                                norm[y][x+1], 
+                                norm[y+1][x],  
+                                norm[y][x]);
+
+                const simd4f z2(norm[y+1][x+2],
+                                norm[y][x+2],
+                                norm[y+1][x+1],
+                                norm[y][x+1]);
+
+                const simd4f z3(norm[y+2][x+1],
+                                norm[y+1][x+1],
+                                norm[y+2][x],
+                                norm[y+1][x]);
+
+                const simd4f z4(norm[y+2][x+2],
+                                norm[y+1][x+2],
+                                norm[y+2][x+1],
+                                norm[y+1][x+1]);
+
+                const simd4f nn = 0.2*sqrt(z1+z2+z3+z4+eps);
+                const simd4f n = 0.1/nn;
+
+                simd4f t = 0;
+
+                const int xx = x+padding_cols_offset; 
+
+                // contrast-sensitive features
+                for (int o = 0; o < 18; o+=3) 
+                {
+                    simd4f temp0(hist[y+1+1][x+1+1](o));
+                    simd4f temp1(hist[y+1+1][x+1+1](o+1));
+                    simd4f temp2(hist[y+1+1][x+1+1](o+2));
+                    simd4f h0 = min(temp0,nn)*n;
+                    simd4f h1 = min(temp1,nn)*n;
+                    simd4f h2 = min(temp2,nn)*n;
+                    set_hog(hog,o,xx,yy,   sum(h0));
+                    set_hog(hog,o+1,xx,yy, sum(h1));
+                    set_hog(hog,o+2,xx,yy, sum(h2));
+                    t += h0+h1+h2;
+                }
+
+                t *= 2*0.2357;
+
+                // contrast-insensitive features
+                for (int o = 0; o < 9; o+=3) 
+                {
+                    simd4f temp0 = hist[y+1+1][x+1+1](o)   + hist[y+1+1][x+1+1](o+9);
+                    simd4f temp1 = hist[y+1+1][x+1+1](o+1) + hist[y+1+1][x+1+1](o+9+1);
+                    simd4f temp2 = hist[y+1+1][x+1+1](o+2) + hist[y+1+1][x+1+1](o+9+2);
+                    simd4f h0 = min(temp0,nn)*n;
+                    simd4f h1 = min(temp1,nn)*n;
+                    simd4f h2 = min(temp2,nn)*n;
+                    set_hog(hog,o+18,xx,yy, sum(h0));
+                    set_hog(hog,o+18+1,xx,yy, sum(h1));
+                    set_hog(hog,o+18+2,xx,yy, sum(h2));
+                }
+
+
+                float temp[4];
+                t.store(temp);
+
+                // texture features
+                set_hog(hog,27,xx,yy, temp[0]);
+                set_hog(hog,28,xx,yy, temp[1]);
+                set_hog(hog,29,xx,yy, temp[2]);
+                set_hog(hog,30,xx,yy, temp[3]);
+            }
+        }
+
         template <
             typename image_type, 
             typename out_type
@@ -704,7 +1214,9 @@ namespace dlib
             out_type& hog, 
             int cell_size,
             int filter_rows_padding,
-            int filter_cols_padding
+            int filter_cols_padding,
+            array2d<matrix<float,18,1> >& hist,
+            array2d<float>& norm
         ) 
         {
             const_image_view<image_type> img(img_);
@@ -764,33 +1276,18 @@ namespace dlib
 
             // unit vectors used to compute gradient orientation
             matrix<float,2,1> directions[9];
-            directions[0] =  1.0000, 0.0000; 
-            directions[1] =  0.9397, 0.3420;
-            directions[2] =  0.7660, 0.6428;
-            directions[3] =  0.500,  0.8660;
-            directions[4] =  0.1736, 0.9848;
-            directions[5] = -0.1736, 0.9848;
-            directions[6] = -0.5000, 0.8660;
-            directions[7] = -0.7660, 0.6428;
-            directions[8] = -0.9397, 0.3420;
-
-
-
-            // First we allocate memory for caching orientation histograms & their norms.
-            const int cells_nr = (int)((float)img.nr()/(float)cell_size + 0.5);
-            const int cells_nc = (int)((float)img.nc()/(float)cell_size + 0.5);
+            get_fhog_directions(directions);
 
-            if (cells_nr == 0 || cells_nc == 0)
-            {
-                hog.clear();
+            int cells_nr, cells_nc;
+            if (!start_fhog_features(img.nr(), img.nc(), hog, cell_size, filter_rows_padding,
+                    filter_cols_padding, cells_nr, cells_nc))
                 return;
-            }
 
             // We give hist extra padding around the edges (1 cell all the way around the
             // edge) so we can avoid needing to do boundary checks when indexing into it
             // later on.  So some statements assign to the boundary but those values are
             // never used.
-            array2d<matrix<float,18,1> > hist(cells_nr+2, cells_nc+2);
+            hist.set_size(cells_nr+2, cells_nc+2);
             for (long r = 0; r < hist.nr(); ++r)
             {
                 for (long c = 0; c < hist.nc(); ++c)
@@ -798,251 +1295,43 @@ namespace dlib
                     hist[r][c] = 0;
                 }
             }
-
-            array2d<float> norm(cells_nr, cells_nc);
-            assign_all_pixels(norm, 0);
-
-            // memory for HOG features
-            const int hog_nr = std::max(cells_nr-2, 0);
-            const int hog_nc = std::max(cells_nc-2, 0);
-            if (hog_nr == 0 || hog_nc == 0)
-            {
-                hog.clear();
-                return;
-            }
-            const int padding_rows_offset = (filter_rows_padding-1)/2;
-            const int padding_cols_offset = (filter_cols_padding-1)/2;
-            init_hog(hog, hog_nr, hog_nc, filter_rows_padding, filter_cols_padding);
+            norm.set_size(cells_nr, cells_nc);
 
             const int visible_nr = std::min((long)cells_nr*cell_size,img.nr())-1;
             const int visible_nc = std::min((long)cells_nc*cell_size,img.nc())-1;
 
             // First populate the gradient histograms
             for (int y = 1; y < visible_nr; y++) 
-            {
-                const float yp = ((float)y+0.5)/(float)cell_size - 0.5;
-                const int iyp = (int)std::floor(yp);
-                const float vy0 = yp - iyp;
-                const float vy1 = 1.0 - vy0;
-                int x;
-                for (x = 1; x < visible_nc - 7; x += 8)
-                {
-                    simd8f xx(x, x + 1, x + 2, x + 3, x + 4, x + 5, x + 6, x + 7);
-                    // v will be the length of the gradient vectors.
-                    simd8f grad_x, grad_y, v;
-                    get_gradient(y, x, img, grad_x, grad_y, v);
-
-                    // We will use bilinear interpolation to add into the histogram bins.
-                    // So first we precompute the values needed to determine how much each
-                    // pixel votes into each bin.
-                    simd8f xp = (xx + 0.5) / (float)cell_size + 0.5;
-                    simd8i ixp = simd8i(xp);
-                    simd8f vx0 = xp - ixp;
-                    simd8f vx1 = 1.0f - vx0;
-
-                    v = sqrt(v);
-
-                    // Now snap the gradient to one of 18 orientations
-                    simd8f best_dot = 0;
-                    simd8f best_o = 0;
-                    for (int o = 0; o < 9; o++)
-                    {
-                        simd8f dot = grad_x*directions[o](0) + grad_y*directions[o](1);
-                        simd8f_bool cmp = dot>best_dot;
-                        best_dot = select(cmp, dot, best_dot);
-                        dot *= -1;
-                        best_o = select(cmp, o, best_o);
-
-                        cmp = dot > best_dot;
-                        best_dot = select(cmp, dot, best_dot);
-                        best_o = select(cmp, o + 9, best_o);
-                    }
-
-
-                    // Add the gradient magnitude, v, to 4 histograms around pixel using
-                    // bilinear interpolation.
-                    vx1 *= v;
-                    vx0 *= v;
-                    // The amounts for each bin
-                    simd8f v11 = vy1*vx1;
-                    simd8f v01 = vy0*vx1;
-                    simd8f v10 = vy1*vx0;
-                    simd8f v00 = vy0*vx0;
-
-                    int32 _best_o[8]; simd8i(best_o).store(_best_o);
-                    int32 _ixp[8];    ixp.store(_ixp);
-                    float _v11[8];    v11.store(_v11);
-                    float _v01[8];    v01.store(_v01);
-                    float _v10[8];    v10.store(_v10);
-                    float _v00[8];    v00.store(_v00);
-
-                    hist[iyp + 1][_ixp[0]](_best_o[0]) += _v11[0];
-                    hist[iyp + 1 + 1][_ixp[0]](_best_o[0]) += _v01[0];
-                    hist[iyp + 1][_ixp[0] + 1](_best_o[0]) += _v10[0];
-                    hist[iyp + 1 + 1][_ixp[0] + 1](_best_o[0]) += _v00[0];
-
-                    hist[iyp + 1][_ixp[1]](_best_o[1]) += _v11[1];
-                    hist[iyp + 1 + 1][_ixp[1]](_best_o[1]) += _v01[1];
-                    hist[iyp + 1][_ixp[1] + 1](_best_o[1]) += _v10[1];
-                    hist[iyp + 1 + 1][_ixp[1] + 1](_best_o[1]) += _v00[1];
-
-                    hist[iyp + 1][_ixp[2]](_best_o[2]) += _v11[2];
-                    hist[iyp + 1 + 1][_ixp[2]](_best_o[2]) += _v01[2];
-                    hist[iyp + 1][_ixp[2] + 1](_best_o[2]) += _v10[2];
-                    hist[iyp + 1 + 1][_ixp[2] + 1](_best_o[2]) += _v00[2];
-
-                    hist[iyp + 1][_ixp[3]](_best_o[3]) += _v11[3];
-                    hist[iyp + 1 + 1][_ixp[3]](_best_o[3]) += _v01[3];
-                    hist[iyp + 1][_ixp[3] + 1](_best_o[3]) += _v10[3];
-                    hist[iyp + 1 + 1][_ixp[3] + 1](_best_o[3]) += _v00[3];
-
-                    hist[iyp + 1][_ixp[4]](_best_o[4]) += _v11[4];
-                    hist[iyp + 1 + 1][_ixp[4]](_best_o[4]) += _v01[4];
-                    hist[iyp + 1][_ixp[4] + 1](_best_o[4]) += _v10[4];
-                    hist[iyp + 1 + 1][_ixp[4] + 1](_best_o[4]) += _v00[4];
-
-                    hist[iyp + 1][_ixp[5]](_best_o[5]) += _v11[5];
-                    hist[iyp + 1 + 1][_ixp[5]](_best_o[5]) += _v01[5];
-                    hist[iyp + 1][_ixp[5] + 1](_best_o[5]) += _v10[5];
-                    hist[iyp + 1 + 1][_ixp[5] + 1](_best_o[5]) += _v00[5];
-
-                    hist[iyp + 1][_ixp[6]](_best_o[6]) += _v11[6];
-                    hist[iyp + 1 + 1][_ixp[6]](_best_o[6]) += _v01[6];
-                    hist[iyp + 1][_ixp[6] + 1](_best_o[6]) += _v10[6];
-                    hist[iyp + 1 + 1][_ixp[6] + 1](_best_o[6]) += _v00[6];
-
-                    hist[iyp + 1][_ixp[7]](_best_o[7]) += _v11[7];
-                    hist[iyp + 1 + 1][_ixp[7]](_best_o[7]) += _v01[7];
-                    hist[iyp + 1][_ixp[7] + 1](_best_o[7]) += _v10[7];
-                    hist[iyp + 1 + 1][_ixp[7] + 1](_best_o[7]) += _v00[7];
-                }
-                // Now process the right columns that don't fit into simd registers.
-                for (; x < visible_nc; x++) 
-                {
-                    matrix<float, 2, 1> grad;
-                    float v;
-                    get_gradient(y,x,img,grad,v);
-
-                    // snap to one of 18 orientations
-                    float best_dot = 0;
-                    int best_o = 0;
-                    for (int o = 0; o < 9; o++) 
-                    {
-                        const float dot = dlib::dot(directions[o], grad);
-                        if (dot > best_dot) 
-                        {
-                            best_dot = dot;
-                            best_o = o;
-                        } 
-                        else if (-dot > best_dot) 
-                        {
-                            best_dot = -dot;
-                            best_o = o+9;
-                        }
-                    }
-
-                    v = std::sqrt(v);
-                    // add to 4 histograms around pixel using bilinear interpolation
-                    const float xp = ((double)x + 0.5) / (double)cell_size - 0.5;
-                    const int ixp = (int)std::floor(xp);
-                    const float vx0 = xp - ixp;
-                    const float vx1 = 1.0 - vx0;
-
-                    hist[iyp+1][ixp+1](best_o) += vy1*vx1*v;
-                    hist[iyp+1+1][ixp+1](best_o) += vy0*vx1*v;
-                    hist[iyp+1][ixp+1+1](best_o) += vy1*vx0*v;
-                    hist[iyp+1+1][ixp+1+1](best_o) += vy0*vx0*v;
-                }
-            }
+                add_row_to_fhog_histograms(img, y, visible_nc, cell_size, directions, hist);
 
             // compute energy in each block by summing over orientations
             for (int r = 0; r < cells_nr; ++r)
-            {
-                for (int c = 0; c < cells_nc; ++c)
-                {
-                    for (int o = 0; o < 9; o++) 
-                    {
-                        norm[r][c] += (hist[r+1][c+1](o) + hist[r+1][c+1](o+9)) * (hist[r+1][c+1](o) + hist[r+1][c+1](o+9));
-                    }
-                }
-            }
+                compute_fhog_norm_row(hist, norm, r, cells_nc);
 
-            const float eps = 0.0001;
             // compute features
-            for (int y = 0; y < hog_nr; y++) 
-            {
-                const int yy = y+padding_rows_offset; 
-                for (int x = 0; x < hog_nc; x++) 
-                {
-                    const simd4f z1(norm[y+1][x+1],
-                                    norm[y][x+1], 
-                                    norm[y+1][x],  
-                                    norm[y][x]);
-
-                    const simd4f z2(norm[y+1][x+2],
-                                    norm[y][x+2],
-                                    norm[y+1][x+1],
-                                    norm[y][x+1]);
-
-                    const simd4f z3(norm[y+2][x+1],
-                                    norm[y+1][x+1],
-                                    norm[y+2][x],
-                                    norm[y+1][x]);
-
-                    const simd4f z4(norm[y+2][x+2],
-                                    norm[y+1][x+2],
-                                    norm[y+2][x+1],
-                                    norm[y+1][x+1]);
-
-                    const simd4f nn = 0.2*sqrt(z1+z2+z3+z4+eps);
-                    const simd4f n = 0.1/nn;
-
-                    simd4f t = 0;
-
-                    const int xx = x+padding_cols_offset; 
-
-                    // contrast-sensitive features
-                    for (int o = 0; o < 18; o+=3) 
-                    {
-                        simd4f temp0(hist[y+1+1][x+1+1](o));
-                        simd4f temp1(hist[y+1+1][x+1+1](o+1));
-                        simd4f temp2(hist[y+1+1][x+1+1](o+2));
-                        simd4f h0 = min(temp0,nn)*n;
-                        simd4f h1 = min(temp1,nn)*n;
-                        simd4f h2 = min(temp2,nn)*n;
-                        set_hog(hog,o,xx,yy,   sum(h0));
-                        set_hog(hog,o+1,xx,yy, sum(h1));
-                        set_hog(hog,o+2,xx,yy, sum(h2));
-                        t += h0+h1+h2;
-                    }
-
-                    t *= 2*0.2357;
-
-                    // contrast-insensitive features
-                    for (int o = 0; o < 9; o+=3) 
-                    {
-                        simd4f temp0 = hist[y+1+1][x+1+1](o)   + hist[y+1+1][x+1+1](o+9);
-                        simd4f temp1 = hist[y+1+1][x+1+1](o+1) + hist[y+1+1][x+1+1](o+9+1);
-                        simd4f temp2 = hist[y+1+1][x+1+1](o+2) + hist[y+1+1][x+1+1](o+9+2);
-                        simd4f h0 = min(temp0,nn)*n;
-                        simd4f h1 = min(temp1,nn)*n;
-                        simd4f h2 = min(temp2,nn)*n;
-                        set_hog(hog,o+18,xx,yy, sum(h0));
-                        set_hog(hog,o+18+1,xx,yy, sum(h1));
-                        set_hog(hog,o+18+2,xx,yy, sum(h2));
-                    }
-
+            for (int y = 0; y < cells_nr-2; y++) 
+                compute_fhog_feature_row(hog, y, cells_nc-2, filter_rows_padding, filter_cols_padding, hist, norm);
+        }
 
-                    float temp[4];
-                    t.store(temp);
+    // ------------------------------------------------------------------------------------
 
-                    // texture features
-                    set_hog(hog,27,xx,yy, temp[0]);
-                    set_hog(hog,28,xx,yy, temp[1]);
-                    set_hog(hog,29,xx,yy, temp[2]);
-                    set_hog(hog,30,xx,yy, temp[3]);
-                }
-            }
+        template <
+            typename image_type, 
+            typename out_type
+            >
+        void impl_extract_fhog_features(
+            const image_type& img, 
+            out_type& hog, 
+            int cell_size,
+            int filter_rows_padding,
+            int filter_cols_padding
+        ) 
+        {
+            // hist and norm are only scratch memory.  The overload above lets callers
+            // that extract features from a stream of images keep them between calls.
+            array2d<matrix<float,18,1> > hist;
+            array2d<float> norm;
+            impl_extract_fhog_features(img, hog, cell_size, filter_rows_padding, filter_cols_padding, hist, norm);
         }
 
     // ------------------------------------------------------------------------------------
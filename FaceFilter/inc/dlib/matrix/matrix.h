@@ -1844,6 +1844,67 @@ namespace dlib
         matrix<T,NR,NC,mm,l>& b
     ) { a.swap(b); }
 
+    namespace ser_helper
+    {
+        template <typename T, long NR, long NC, typename mm, typename l>
+        struct is_raw_block_matrix
+        {
+            // only row major matrices keep their values in the order of a raw block
+            static const bool value = is_raw_block_element<T>::value &&
+                                      is_same_type<l,row_major_layout>::value;
+        };
+
+        template <typename T, long NR, long NC, typename mm, typename l>
+        typename enable_if<is_raw_block_matrix<T,NR,NC,mm,l>,bool>::type serialize_raw_block (
+            const matrix<T,NR,NC,mm,l>& item,
+            std::ostream& out
+        )
+        {
+            if (!raw_block_serialization_enabled(out))
+                return false;
+            serialize_raw_block_header<T>(out);
+            serialize(item.nr(), out);
+            serialize(item.nc(), out);
+            serialize_raw_block_data(item.size() != 0 ? &item(0,0) : 0, item.size(), out);
+            return true;
+        }
+
+        template <typename T, long NR, long NC, typename mm, typename l>
+        typename disable_if<is_raw_block_matrix<T,NR,NC,mm,l>,bool>::type serialize_raw_block (
+            const matrix<T,NR,NC,mm,l>& ,
+            std::ostream& 
+        ) { return false; }
+
+        template <typename T, long NR, long NC, typename mm, typename l>
+        typename enable_if<is_raw_block_matrix<T,NR,NC,mm,l>,bool>::type deserialize_raw_block (
+            matrix<T,NR,NC,mm,l>& item,
+            std::istream& in
+        )
+        {
+            if (!raw_block_follows(in))
+                return false;
+            const raw_block_header h = deserialize_raw_block_header(in);
+            long nr, nc;
+            deserialize(nr, in);
+            deserialize(nc, in);
+            if (nr < 0 || nc < 0)
+                throw serialization_error("Error while deserializing a dlib::matrix.  Invalid raw block size");
+            if (NR != 0 && nr != NR)
+                throw serialization_error("Error while deserializing a dlib::matrix.  Invalid rows");
+            if (NC != 0 && nc != NC)
+                throw serialization_error("Error while deserializing a dlib::matrix.  Invalid columns");
+            item.set_size(nr,nc);
+            deserialize_raw_block_data(h, item.size() != 0 ? &item(0,0) : 0, item.size(), in);
+            return true;
+        }
+
+        template <typename T, long NR, long NC, typename mm, typename l>
+        typename disable_if<is_raw_block_matrix<T,NR,NC,mm,l>,bool>::type deserialize_raw_block (
+            matrix<T,NR,NC,mm,l>& ,
+            std::istream& 
+        ) { return false; }
+    }
+
     template <
         typename T,
         long NR,
@@ -1858,6 +1919,9 @@ namespace dlib
     {
         try
         {
+            if (ser_helper::serialize_raw_block(item, out))
+                return;
+
             // The reason the serialization is a little funny is because we are trying to
             // maintain backwards compatibility with an older serialization format used by
             // dlib while also encoding things in a way that lets the array2d and matrix
@@ -1892,6 +1956,9 @@ namespace dlib
     {
         try
         {
+            if (ser_helper::deserialize_raw_block(item, in))
+                return;
+
             long nr, nc;
             deserialize(nr,in); 
             deserialize(nc,in); 
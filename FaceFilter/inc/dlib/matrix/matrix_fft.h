@@ -7,6 +7,9 @@
 #include "matrix_utilities.h"
 #include "../hash.h"
 #include "../algs.h"
+#include "../numeric_constants.h"
+#include <utility>
+#include <vector>
 
 #ifdef DLIB_USE_MKL_FFT
 #include <mkl_dfti.h>
@@ -221,45 +224,29 @@ namespace dlib
 
     // ------------------------------------------------------------------------------------
 
-        template <typename T, long NR, long NC, typename MM, typename layout>
-        void fft1d_inplace(matrix<std::complex<T>,NR,NC,MM,layout>& data, bool do_backward_fft, twiddles<T>& cs)
+        template <typename T>
+        void fft1d_passes(std::complex<T>* const b, const int nthpo, twiddles<T>& cs)
         /*!
             requires
-                - is_vector(data) == true
-                - is_power_of_two(data.size()) == true
+                - b points to nthpo values
+                - is_power_of_two(nthpo) == true
             ensures
-                - This routine replaces the input std::complex<double> vector by its finite
-                  discrete complex fourier transform if do_backward_fft==true.  It replaces
-                  the input std::complex<double> vector by its finite discrete complex
-                  inverse fourier transform if do_backward_fft==false.
-
-                  The implementation is a radix-2 FFT, but with faster shortcuts for
-                  radix-4 and radix-8. It performs as many radix-8 iterations as possible,
-                  and then finishes with a radix-2 or -4 iteration if needed.
+                - does the butterfly passes of the transform of b, leaving the outputs in
+                  bit reversed order.  The passes are radix-8 as far as possible, and
+                  then finish with a radix-2 or -4 pass if needed.
         !*/
         {
-            if (data.size() == 0)
-                return;
-
-            std::complex<T>* const b = &data(0);
-            int L[16],L1,L2,L3,L4,L5,L6,L7,L8,L9,L10,L11,L12,L13,L14,L15;
-            int j1,j2,j3,j4,j5,j6,j7,j8,j9,j10,j11,j12,j13,j14;
-            int j, ij, ji;
-            int n2pow, n8pow, nthpo, ipass, nxtlt, length;
-
-            n2pow = fastlog2(data.size());
-            nthpo = data.size();
-
-            n8pow = n2pow/3;
+            const int n2pow = fastlog2(nthpo);
+            const int n8pow = n2pow/3;
 
             if(n8pow)
             {
                 /* Radix 8 iterations */
-                for(ipass=1;ipass<=n8pow;ipass++) 
+                for(int ipass=1;ipass<=n8pow;ipass++) 
                 {
                     const int p = n2pow - 3*ipass;
-                    nxtlt = 0x1 << p;
-                    length = 8*nxtlt;
+                    const int nxtlt = 0x1 << p;
+                    const int length = 8*nxtlt;
                     R8TX(nxtlt, nthpo, length, cs.get_twiddles(p),
                         b, b+nxtlt, b+2*nxtlt, b+3*nxtlt,
                         b+4*nxtlt, b+5*nxtlt, b+6*nxtlt, b+7*nxtlt);
@@ -277,6 +264,21 @@ namespace dlib
                 /* A final radix 4 iteration is needed */
                 R4TX(nthpo, b, b+1, b+2, b+3); 
             }
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        template <typename swap_function>
+        void fft1d_bit_reversal(const int n2pow, swap_function swap_values)
+        /*!
+            ensures
+                - calls swap_values(i,j) for every pair of indices i < j of a transform of
+                  length 2^n2pow that are the bit reversal of each other.
+        !*/
+        {
+            int L[16],L1,L2,L3,L4,L5,L6,L7,L8,L9,L10,L11,L12,L13,L14,L15;
+            int j1,j2,j3,j4,j5,j6,j7,j8,j9,j10,j11,j12,j13,j14;
+            int j, ij, ji;
 
             for(j=1;j<=15;j++) 
             {
@@ -306,19 +308,118 @@ namespace dlib
                                                                     for(ji=j14;ji<L15;ji+=L14) 
                                                                     {
                                                                         if(ij<ji)
-                                                                            swap(b[ij], b[ji]);
+                                                                            swap_values(ij, ji);
                                                                         ij++;
                                                                     }
+        }
 
+    // ------------------------------------------------------------------------------------
 
-            // unscramble outputs
-            if(!do_backward_fft) 
+        class bit_reversals
+        {
+            /*!
+                The point of this object is to cache the index pairs the outputs of
+                fft1d_passes() are swapped by, so the nested loops of
+                fft1d_bit_reversal() only run once for each transform length.
+            !*/
+        public:
+
+            bit_reversals()
             {
-                for(long i=1, j=data.size()-1; i<data.size()/2; i++,j--)
+                data.resize(32);
+            }
+
+            const std::vector<std::pair<int,int> >& get_swaps (
+                int n2pow
+            )
+            /*!
+                requires
+                    - 0 <= n2pow < 32
+                ensures
+                    - returns the pairs fft1d_bit_reversal(n2pow) swaps
+            !*/
+            {
+                std::vector<std::pair<int,int> >& swaps = data[n2pow];
+                if (swaps.size() == 0 && n2pow > 1)
                 {
-                    swap(b[j], b[i]);
+                    fft1d_bit_reversal(n2pow, [&swaps](int i, int j)
+                        { swaps.push_back(std::make_pair(i,j)); });
                 }
+                return swaps;
             }
+
+        private:
+            std::vector<std::vector<std::pair<int,int> > > data;
+        };
+
+    // ------------------------------------------------------------------------------------
+
+        template <typename T>
+        void fft1d_unscramble(std::complex<T>* const b, const long n)
+        /*!
+            ensures
+                - reverses the order of b[1] through b[n-1], which turns the bit reversed
+                  outputs of a backward transform into those of a forward one.
+        !*/
+        {
+            for(long i=1, j=n-1; i<n/2; i++,j--)
+            {
+                swap(b[j], b[i]);
+            }
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        template <typename T, long NR, long NC, typename MM, typename layout>
+        void fft1d_inplace(matrix<std::complex<T>,NR,NC,MM,layout>& data, bool do_backward_fft, twiddles<T>& cs)
+        /*!
+            requires
+                - is_vector(data) == true
+                - is_power_of_two(data.size()) == true
+            ensures
+                - This routine replaces the input std::complex<double> vector by its finite
+                  discrete complex fourier transform if do_backward_fft==true.  It replaces
+                  the input std::complex<double> vector by its finite discrete complex
+                  inverse fourier transform if do_backward_fft==false.
+
+                  The implementation is a radix-2 FFT, but with faster shortcuts for
+                  radix-4 and radix-8. It performs as many radix-8 iterations as possible,
+                  and then finishes with a radix-2 or -4 iteration if needed.
+        !*/
+        {
+            if (data.size() == 0)
+                return;
+
+            std::complex<T>* const b = &data(0);
+            fft1d_passes(b, data.size(), cs);
+            fft1d_bit_reversal(fastlog2(data.size()), [b](int i, int j) { swap(b[i], b[j]); });
+
+            // unscramble outputs
+            if(!do_backward_fft) 
+                fft1d_unscramble(b, data.size());
+        }
+
+        template <typename T>
+        void fft1d_inplace(std::complex<T>* const b, const long n, bool do_backward_fft, twiddles<T>& cs, bit_reversals& swaps)
+        /*!
+            requires
+                - b points to n values
+                - is_power_of_two(n) == true
+            ensures
+                - does the same as the matrix version of fft1d_inplace() on the n values
+                  of b, with the bit reversal taken from swaps.
+        !*/
+        {
+            if (n == 0)
+                return;
+
+            fft1d_passes(b, n, cs);
+            const std::vector<std::pair<int,int> >& s = swaps.get_swaps(fastlog2(n));
+            for (unsigned long i = 0; i < s.size(); ++i)
+                swap(b[s[i].first], b[s[i].second]);
+
+            if(!do_backward_fft) 
+                fft1d_unscramble(b, n);
         }
 
     // ------------------------------------------------------------------------------------
@@ -326,29 +427,75 @@ namespace dlib
         template < typename T, long NR, long NC, typename MM, typename L >
         void fft2d_inplace(
             matrix<std::complex<T>,NR,NC,MM,L>& data,
-            bool do_backward_fft
+            bool do_backward_fft,
+            twiddles<double>& cs,
+            bit_reversals& swaps,
+            matrix<std::complex<double> >& row_buff,
+            matrix<std::complex<double> >& col_buff
         )
         {
             if (data.size() == 0)
                 return;
 
-            matrix<std::complex<double> > buff;
-            twiddles<double> cs;
-
             // Compute transform row by row
             for(long r=0; r<data.nr(); ++r) 
             {
-                buff = matrix_cast<std::complex<double> >(rowm(data,r));
-                fft1d_inplace(buff, do_backward_fft, cs);
-                set_rowm(data,r) = matrix_cast<std::complex<T> >(buff);
+                row_buff = matrix_cast<std::complex<double> >(rowm(data,r));
+                fft1d_inplace(&row_buff(0), row_buff.size(), do_backward_fft, cs, swaps);
+                set_rowm(data,r) = matrix_cast<std::complex<T> >(row_buff);
             }
 
             // Compute transform column by column
             for(long c=0; c<data.nc(); ++c) 
             {
-                buff = matrix_cast<std::complex<double> >(colm(data,c));
-                fft1d_inplace(buff, do_backward_fft, cs);
-                set_colm(data,c) = matrix_cast<std::complex<T> >(buff);
+                col_buff = matrix_cast<std::complex<double> >(colm(data,c));
+                fft1d_inplace(&col_buff(0), col_buff.size(), do_backward_fft, cs, swaps);
+                set_colm(data,c) = matrix_cast<std::complex<T> >(col_buff);
+            }
+        }
+
+        template < typename T, long NR, long NC, typename MM, typename L >
+        void fft2d_inplace(
+            matrix<std::complex<T>,NR,NC,MM,L>& data,
+            bool do_backward_fft
+        )
+        {
+            twiddles<double> cs;
+            bit_reversals swaps;
+            matrix<std::complex<double> > row_buff, col_buff;
+            fft2d_inplace(data, do_backward_fft, cs, swaps, row_buff, col_buff);
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        inline void fft1d_real_finish(
+            const std::complex<double>* z,
+            const long n,
+            const std::complex<double>* w,
+            std::complex<double>* x
+        )
+        /*!
+            requires
+                - n is a power of two greater than 1
+                - z points to the n/2 values of the transform of the vector of pairs
+                  (v[2m], v[2m+1]) of some real vector v of length n, each pair taken as
+                  one complex number
+                - w[k] == exp(-2*pi*i*k/n) for k in [0, n/2]
+                - x points to n/2+1 values and doesn't overlap z
+            ensures
+                - #x[k] == the k-th value of the transform of v, for k in [0, n/2].  The
+                  others are the conjugates of these.
+        !*/
+        {
+            const long m = n/2;
+            for (long k = 0; k <= m; ++k)
+            {
+                const std::complex<double> a = z[k%m];
+                const std::complex<double> b = std::conj(z[(m-k)%m]);
+                // the transforms of the even and of the odd values of v
+                const std::complex<double> even = 0.5*(a + b);
+                const std::complex<double> odd = std::complex<double>(0,-0.5)*(a - b);
+                x[k] = even + w[k]*odd;
             }
         }
         
@@ -402,6 +549,69 @@ namespace dlib
 
     } // end namespace impl
 
+// ----------------------------------------------------------------------------------------
+
+    template <typename T>
+    class fft_workspace
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This object holds the scratch memory of fft_inplace(), ifft_inplace()
+                and fft_real(): the twiddle factors and the bit reversal permutation of
+                each transform length, and the row and column buffers of 2D transforms.
+                It is, in effect, a plan for the sizes it is used with: transforming a
+                stream of same sized matrices with one workspace doesn't allocate or
+                recompute anything after the first one.
+        !*/
+    private:
+        template <typename U, long NR, long NC, typename MM, typename L>
+        friend void fft_inplace (matrix<std::complex<U>,NR,NC,MM,L>& data, fft_workspace<U>& ws);
+        template <typename U, long NR, long NC, typename MM, typename L>
+        friend void ifft_inplace (matrix<std::complex<U>,NR,NC,MM,L>& data, fft_workspace<U>& ws);
+        template <typename U, long NR, long NC, typename MM, typename L>
+        friend void fft_real (const matrix<U,NR,NC,MM,L>& data, matrix<std::complex<U>,NR,NC,MM,L>& out, fft_workspace<U>& ws);
+
+        const std::complex<double>* get_real_twiddles (
+            long n
+        )
+        /*!
+            requires
+                - n is a power of two
+            ensures
+                - returns the n/2+1 values exp(-2*pi*i*k/n)
+        !*/
+        {
+            const unsigned long p = impl::fastlog2(n);
+            if (real_twiddles.size() <= p)
+                real_twiddles.resize(p+1);
+            matrix<std::complex<double>,0,1>& w = real_twiddles[p];
+            if (w.size() == 0)
+            {
+                w.set_size(n/2+1);
+                for (long k = 0; k < w.size(); ++k)
+                {
+                    const double phi = -2*pi*k/n;
+                    w(k) = std::complex<double>(std::cos(phi), std::sin(phi));
+                }
+            }
+            return &w(0);
+        }
+
+        impl::twiddles<T> cs;
+        // 2D and real transforms are done in double precision whatever T is.
+        impl::twiddles<double> cs_double;
+        impl::bit_reversals swaps;
+        std::vector<matrix<std::complex<double>,0,1> > real_twiddles;
+        matrix<std::complex<double> > row_buff;
+        matrix<std::complex<double> > col_buff;
+        // fft_real() buffers, apart from the others and for vectors apart from those
+        // for matrices, so that a mix of transforms doesn't keep resizing them
+        matrix<std::complex<double>,0,1> vector_packed;
+        matrix<std::complex<double>,0,1> vector_half;
+        matrix<std::complex<double>,0,1> row_packed;
+        matrix<std::complex<double> > half;
+    };
+
 // ----------------------------------------------------------------------------------------
 
     template <typename EXP>
@@ -518,6 +728,130 @@ namespace dlib
         }
     }
 
+// ----------------------------------------------------------------------------------------
+
+    template < typename T, long NR, long NC, typename MM, typename L >
+    void fft_inplace (matrix<std::complex<T>,NR,NC,MM,L>& data, fft_workspace<T>& ws)
+    {
+        // make sure requires clause is not broken
+        DLIB_CASSERT(is_power_of_two(data.nr()) && is_power_of_two(data.nc()),
+            "\t void fft_inplace(data, ws)"
+            << "\n\t The number of rows and columns must be powers of two."
+            << "\n\t data.nr(): "<< data.nr()
+            << "\n\t data.nc(): "<< data.nc()
+            << "\n\t is_power_of_two(data.nr()): " << is_power_of_two(data.nr())
+            << "\n\t is_power_of_two(data.nc()): " << is_power_of_two(data.nc())
+            );
+
+        if (data.nr() == 1 || data.nc() == 1)
+            impl::fft1d_inplace(data.size() == 0 ? 0 : &data(0), data.size(), false, ws.cs, ws.swaps);
+        else
+            impl::fft2d_inplace(data, false, ws.cs_double, ws.swaps, ws.row_buff, ws.col_buff);
+    }
+
+    template < typename T, long NR, long NC, typename MM, typename L >
+    void ifft_inplace (matrix<std::complex<T>,NR,NC,MM,L>& data, fft_workspace<T>& ws)
+    {
+        // make sure requires clause is not broken
+        DLIB_CASSERT(is_power_of_two(data.nr()) && is_power_of_two(data.nc()),
+            "\t void ifft_inplace(data, ws)"
+            << "\n\t The number of rows and columns must be powers of two."
+            << "\n\t data.nr(): "<< data.nr()
+            << "\n\t data.nc(): "<< data.nc()
+            << "\n\t is_power_of_two(data.nr()): " << is_power_of_two(data.nr())
+            << "\n\t is_power_of_two(data.nc()): " << is_power_of_two(data.nc())
+            );
+
+        if (data.nr() == 1 || data.nc() == 1)
+            impl::fft1d_inplace(data.size() == 0 ? 0 : &data(0), data.size(), true, ws.cs, ws.swaps);
+        else
+            impl::fft2d_inplace(data, true, ws.cs_double, ws.swaps, ws.row_buff, ws.col_buff);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template < typename T, long NR, long NC, typename MM, typename L >
+    void fft_real (
+        const matrix<T,NR,NC,MM,L>& data,
+        matrix<std::complex<T>,NR,NC,MM,L>& out,
+        fft_workspace<T>& ws
+    )
+    {
+        // make sure requires clause is not broken
+        DLIB_CASSERT(is_power_of_two(data.nr()) && is_power_of_two(data.nc()),
+            "\t void fft_real(data, out, ws)"
+            << "\n\t The number of rows and columns must be powers of two."
+            << "\n\t data.nr(): "<< data.nr()
+            << "\n\t data.nc(): "<< data.nc()
+            << "\n\t is_power_of_two(data.nr()): " << is_power_of_two(data.nr())
+            << "\n\t is_power_of_two(data.nc()): " << is_power_of_two(data.nc())
+            );
+
+        out.set_size(data.nr(), data.nc());
+        if (data.size() <= 1)
+        {
+            out = matrix_cast<std::complex<T> >(data);
+            return;
+        }
+
+        // A real vector of length n is transformed as the n/2 complex values made of
+        // its pairs of values, which halves the work, and the half of the output that
+        // is not the conjugate of the other half is then taken apart from that.
+        if (data.nr() == 1 || data.nc() == 1)
+        {
+            matrix<std::complex<double>,0,1>& z = ws.vector_packed;
+            const long n = data.size();
+            z.set_size(n/2);
+            for (long m = 0; m < n/2; ++m)
+                z(m) = std::complex<double>(data(2*m), data(2*m+1));
+            impl::fft1d_inplace(&z(0), n/2, false, ws.cs_double, ws.swaps);
+            matrix<std::complex<double>,0,1>& x = ws.vector_half;
+            x.set_size(n/2+1);
+            impl::fft1d_real_finish(&z(0), n, ws.get_real_twiddles(n), &x(0));
+
+            for (long k = 0; k <= n/2; ++k)
+                out(k) = std::complex<T>(x(k));
+            for (long k = n/2+1; k < n; ++k)
+                out(k) = std::complex<T>(std::conj(x(n-k)));
+            return;
+        }
+
+        // Transform the rows, keeping the nc/2+1 columns that aren't conjugates of the
+        // others, then these columns.
+        const long nr = data.nr();
+        const long nc = data.nc();
+        const std::complex<double>* const w = ws.get_real_twiddles(nc);
+        matrix<std::complex<double>,0,1>& z = ws.row_packed;
+        ws.half.set_size(nr, nc/2+1);
+        z.set_size(nc/2);
+        for (long r = 0; r < nr; ++r)
+        {
+            for (long m = 0; m < nc/2; ++m)
+                z(m) = std::complex<double>(data(r,2*m), data(r,2*m+1));
+            impl::fft1d_inplace(&z(0), nc/2, false, ws.cs_double, ws.swaps);
+            impl::fft1d_real_finish(&z(0), nc, w, &ws.half(r,0));
+        }
+
+        matrix<std::complex<double> >& x = ws.col_buff;
+        x.set_size(nr, 1);
+        for (long c = 0; c <= nc/2; ++c)
+        {
+            for (long r = 0; r < nr; ++r)
+                x(r) = ws.half(r,c);
+            impl::fft1d_inplace(&x(0), nr, false, ws.cs_double, ws.swaps);
+            for (long r = 0; r < nr; ++r)
+                ws.half(r,c) = x(r);
+        }
+
+        for (long r = 0; r < nr; ++r)
+        {
+            for (long c = 0; c <= nc/2; ++c)
+                out(r,c) = std::complex<T>(ws.half(r,c));
+            for (long c = nc/2+1; c < nc; ++c)
+                out(r,c) = std::complex<T>(std::conj(ws.half((nr-r)%nr, nc-c)));
+        }
+    }
+
 // ----------------------------------------------------------------------------------------
 
     /*
@@ -814,6 +1148,32 @@ namespace dlib
         call_mkl_fft_inplace(data, true);
     }
 
+    // MKL keeps its own scratch memory, so the workspace goes unused.
+    inline void fft_inplace (matrix<std::complex<double>,0,1>& data, fft_workspace<double>&)
+    {
+        call_mkl_fft_inplace(data, false);
+    }
+    inline void ifft_inplace(matrix<std::complex<double>,0,1>& data, fft_workspace<double>&)
+    {
+        call_mkl_fft_inplace(data, true);
+    }
+    inline void fft_inplace (matrix<std::complex<double>,1,0>& data, fft_workspace<double>&)
+    {
+        call_mkl_fft_inplace(data, false);
+    }
+    inline void ifft_inplace(matrix<std::complex<double>,1,0>& data, fft_workspace<double>&)
+    {
+        call_mkl_fft_inplace(data, true);
+    }
+    inline void fft_inplace (matrix<std::complex<double> >& data, fft_workspace<double>&)
+    {
+        call_mkl_fft_inplace(data, false);
+    }
+    inline void ifft_inplace(matrix<std::complex<double> >& data, fft_workspace<double>&)
+    {
+        call_mkl_fft_inplace(data, true);
+    }
+
 #endif // DLIB_USE_MKL_FFT
 
 // ----------------------------------------------------------------------------------------
@@ -110,6 +110,96 @@ namespace dlib
                   inverse transformation.  
     !*/
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename T
+        >
+    class fft_workspace
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This object holds the scratch memory of fft_inplace(), ifft_inplace()
+                and fft_real(): the twiddle factors and the bit reversal permutation of
+                each transform length, and the row and column buffers of 2D transforms.
+                It is, in effect, a plan for the sizes it is used with: transforming a
+                stream of same sized matrices with one workspace doesn't allocate or
+                recompute anything after the first one.
+
+                A workspace must not be used by two threads at once.
+        !*/
+    };
+
+// ----------------------------------------------------------------------------------------
+
+    template < 
+        typename T, 
+        long NR,
+        long NC,
+        typename MM,
+        typename L 
+        >
+    void fft_inplace (
+        matrix<std::complex<T>,NR,NC,MM,L>& data,
+        fft_workspace<T>& ws
+    );
+    /*!
+        requires
+            - is_power_of_two(data.nr()) == true
+            - is_power_of_two(data.nc()) == true
+        ensures
+            - performs fft_inplace(data), keeping its scratch memory in ws.
+    !*/
+
+// ----------------------------------------------------------------------------------------
+
+    template < 
+        typename T, 
+        long NR,
+        long NC,
+        typename MM,
+        typename L 
+        >
+    void ifft_inplace (
+        matrix<std::complex<T>,NR,NC,MM,L>& data,
+        fft_workspace<T>& ws
+    );
+    /*!
+        requires
+            - is_power_of_two(data.nr()) == true
+            - is_power_of_two(data.nc()) == true
+        ensures
+            - performs ifft_inplace(data), keeping its scratch memory in ws.
+    !*/
+
+// ----------------------------------------------------------------------------------------
+
+    template < 
+        typename T, 
+        long NR,
+        long NC,
+        typename MM,
+        typename L 
+        >
+    void fft_real (
+        const matrix<T,NR,NC,MM,L>& data,
+        matrix<std::complex<T>,NR,NC,MM,L>& out,
+        fft_workspace<T>& ws
+    );
+    /*!
+        requires
+            - is_power_of_two(data.nr()) == true
+            - is_power_of_two(data.nc()) == true
+            - &data and &out don't refer to the same object
+        ensures
+            - #out == fft(matrix_cast<std::complex<T> >(data)), up to rounding.  Since
+              half of the transform of real data is the conjugate of the other half,
+              this takes about half the time of fft_inplace() on the complex copy of
+              data.
+            - The computations are done in double precision, like those of 2D
+              transforms, and the scratch memory is kept in ws.
+    !*/
+
 // ----------------------------------------------------------------------------------------
 
 }
@@ -1701,9 +1701,17 @@ escape_banded_detection:
                 0,   0,   0,
                 m10, m28, m10
             };
-        const matrix<double,5,9> filt(derivative_filters);
-        // Now w contains the parameters of the quadratic surface
-        const matrix<double,5,1> w = filt*pix;
+        // Now w contains the parameters of the quadratic surface.  (Multiplying by a
+        // matrix<double,5,9> would put the filters on the heap, they are too big for the
+        // stack based layout.)
+        matrix<double,5,1> w;
+        for (long k = 0; k < 5; ++k)
+        {
+            double sum = 0;
+            for (long j = 0; j < 9; ++j)
+                sum += derivative_filters[k*9+j]*pix(j);
+            w(k) = sum;
+        }
 
 
         // Now newton step to the max point on the surface
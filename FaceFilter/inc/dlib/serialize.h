@@ -136,6 +136,33 @@
         then serialize the exponent and mantissa values using dlib's integral serialization
         format.  Therefore, the output is first the exponent and then the mantissa.  Note that
         the mantissa is a signed integer (i.e. there is not a separate sign bit).
+
+    RAW BLOCK SERIALIZATION FORMAT
+        A std::vector, dlib::matrix or dlib::array2d of integers, floats or doubles is
+        written a value at a time in the formats above, which takes several stream calls
+        per value.  After enable_raw_block_serialization(out) is called on a stream,
+        serialize() writes these objects into it as raw blocks instead, with one call to
+        out.write() for all the values.  deserialize() reads both formats, whether
+        enable_raw_block_serialization() was called or not, since the first byte tells
+        them apart.  Older versions of dlib can't read raw blocks.
+
+        A raw block is:
+            - the byte 0x72.  Every other format of these objects starts with the control
+              byte of an integer, whose 0x70 bits are always 0.
+            - the format version, 1
+            - the byte order of the values, 0 for little endian and 1 for big endian
+            - the kind of values, 'i' for signed integers, 'u' for unsigned integers or
+              'f' for IEEE floating point numbers
+            - the size of a value in bytes
+            - for a std::vector, its size, and for a matrix or array2d, its number of
+              rows and then of columns, in the integral serialization format
+            - the values, in the byte order of the machine that wrote them (little
+              endian on all the usual ones) and, for a matrix or array2d, in row major
+              order.
+        When the values are laid out like the ones being read, they are read with one
+        call.  Otherwise they are byte swapped or converted to the size being read, and
+        an integer that doesn't fit throws a serialization_error, like it does in the
+        integral serialization format.
 !*/
 
 
@@ -154,6 +181,8 @@
 #include <memory>
 #include <set>
 #include <limits>
+#include <algorithm>
+#include <cstring>
 #include "uintn.h"
 #include "interfaces/enumerable.h"
 #include "interfaces/map_pair.h"
@@ -619,6 +648,317 @@ namespace dlib
         deserialize_floating_point(item,in);
     }
 
+// ----------------------------------------------------------------------------------------
+
+    namespace ser_helper
+    {
+        inline int raw_block_index (
+        )
+        {
+            static const int index = std::ios_base::xalloc();
+            return index;
+        }
+    }
+
+    inline void enable_raw_block_serialization (
+        std::ostream& out,
+        bool enabled = true
+    )
+    /*!
+        ensures
+            - From now on, serialize() writes the matrix, array2d and std::vector objects
+              of integers, floats and doubles it is given into out as raw blocks if
+              enabled is true, and in the usual format otherwise.  See RAW BLOCK
+              SERIALIZATION FORMAT above.
+    !*/
+    {
+        out.iword(ser_helper::raw_block_index()) = enabled ? 1 : 0;
+    }
+
+    inline bool raw_block_serialization_enabled (
+        std::ostream& out
+    )
+    /*!
+        ensures
+            - returns true if enable_raw_block_serialization(out) was last called with
+              enabled set to true, and false otherwise.
+    !*/
+    {
+        return out.iword(ser_helper::raw_block_index()) != 0;
+    }
+
+    namespace ser_helper
+    {
+        // The first byte of a raw block.  Its 0x70 bits are set, so it can't be the
+        // control byte of an integer, which every other container format starts with.
+        const unsigned char raw_block_marker = 0x72;
+        const unsigned char raw_block_version = 1;
+
+        template <typename T>
+        struct is_raw_block_element
+        {
+            // integers and IEEE floats of 4 or 8 bytes, which are laid out the same on
+            // every platform give or take their byte order and, for integers, their size.
+            static const bool value = std::numeric_limits<T>::is_specialized &&
+                ((std::numeric_limits<T>::is_integer && !is_same_type<T,bool>::value) ||
+                 (std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8)));
+        };
+
+        struct raw_block_header
+        {
+            unsigned char big_endian;
+            unsigned char kind; // 'i' signed integer, 'u' unsigned integer or 'f' float
+            unsigned char size;
+        };
+
+        inline bool host_is_big_endian (
+        )
+        {
+            const uint16 probe = 1;
+            return *reinterpret_cast<const unsigned char*>(&probe) == 0;
+        }
+
+        template <typename T>
+        raw_block_header get_raw_block_header (
+        )
+        {
+            raw_block_header h;
+            h.big_endian = host_is_big_endian() ? 1 : 0;
+            if (!std::numeric_limits<T>::is_integer)
+                h.kind = 'f';
+            else if (std::numeric_limits<T>::is_signed)
+                h.kind = 'i';
+            else
+                h.kind = 'u';
+            h.size = sizeof(T);
+            return h;
+        }
+
+        template <typename T>
+        void serialize_raw_block_header (
+            std::ostream& out
+        )
+        /*!
+            ensures
+                - writes the header of a raw block of T values.
+        !*/
+        {
+            const raw_block_header h = get_raw_block_header<T>();
+            const char buf[5] = { (char)raw_block_marker, (char)raw_block_version,
+                                  (char)h.big_endian, (char)h.kind, (char)h.size };
+            out.write(buf, sizeof(buf));
+            if (!out)
+                throw serialization_error("Error serializing a raw block header");
+        }
+
+        inline bool raw_block_follows (
+            std::istream& in
+        )
+        /*!
+            ensures
+                - returns true if the next object in in is a raw block.  Nothing is read.
+        !*/
+        {
+            return in.rdbuf()->sgetc() == raw_block_marker;
+        }
+
+        inline raw_block_header deserialize_raw_block_header (
+            std::istream& in
+        )
+        {
+            unsigned char buf[5];
+            if (in.rdbuf()->sgetn(reinterpret_cast<char*>(buf), sizeof(buf)) != sizeof(buf))
+            {
+                in.setstate(std::ios::badbit);
+                throw serialization_error("Error deserializing a raw block header");
+            }
+            if (buf[0] != raw_block_marker)
+                throw serialization_error("Error deserializing a raw block header");
+            if (buf[1] != raw_block_version)
+                throw serialization_error("Unsupported raw block version found while deserializing");
+
+            raw_block_header h;
+            h.big_endian = buf[2];
+            h.kind = buf[3];
+            h.size = buf[4];
+            const bool int_size = h.size == 1 || h.size == 2 || h.size == 4 || h.size == 8;
+            if (h.big_endian > 1 ||
+                !((h.kind == 'f' && (h.size == 4 || h.size == 8)) ||
+                  ((h.kind == 'i' || h.kind == 'u') && int_size)))
+                throw serialization_error("Corrupt raw block header found while deserializing");
+            return h;
+        }
+
+        template <typename T>
+        void serialize_raw_block_data (
+            const T* data,
+            unsigned long n,
+            std::ostream& out
+        )
+        /*!
+            ensures
+                - writes the n values at data with a single call to out.write().
+        !*/
+        {
+            if (n != 0)
+                out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(n*sizeof(T)));
+            if (!out)
+                throw serialization_error("Error serializing a raw block");
+        }
+
+        template <typename T>
+        void deserialize_raw_block_data (
+            const raw_block_header& h,
+            T* data,
+            unsigned long n,
+            std::istream& in
+        )
+        /*!
+            requires
+                - is_raw_block_element<T>::value == true
+            ensures
+                - reads the n values of a raw block whose header was h into data.  When
+                  the values are laid out like T, this is a single call to
+                  in.rdbuf()->sgetn().  Otherwise they are converted one by one, and
+                  integers that don't fit in a T make this throw serialization_error.
+        !*/
+        {
+            const raw_block_header mine = get_raw_block_header<T>();
+            if ((h.kind == 'f') != (mine.kind == 'f'))
+                throw serialization_error("Error deserializing a raw block: it holds the wrong kind of numbers");
+
+            if (h.kind == mine.kind && h.size == mine.size)
+            {
+                const std::streamsize bytes = static_cast<std::streamsize>(n*sizeof(T));
+                if (n != 0 && in.rdbuf()->sgetn(reinterpret_cast<char*>(data), bytes) != bytes)
+                {
+                    in.setstate(std::ios::badbit);
+                    throw serialization_error("Error deserializing a raw block");
+                }
+                if (h.big_endian != mine.big_endian && sizeof(T) > 1)
+                {
+                    unsigned char* p = reinterpret_cast<unsigned char*>(data);
+                    for (unsigned long i = 0; i < n; ++i, p += sizeof(T))
+                        std::reverse(p, p + sizeof(T));
+                }
+                return;
+            }
+
+            // Values of another size, converted a chunk at a time.
+            const unsigned long chunk = 1024;
+            unsigned char buf[chunk*8];
+            for (unsigned long start = 0; start < n; start += chunk)
+            {
+                const unsigned long count = std::min(chunk, n - start);
+                const std::streamsize bytes = static_cast<std::streamsize>(count*h.size);
+                if (in.rdbuf()->sgetn(reinterpret_cast<char*>(buf), bytes) != bytes)
+                {
+                    in.setstate(std::ios::badbit);
+                    throw serialization_error("Error deserializing a raw block");
+                }
+                for (unsigned long i = 0; i < count; ++i)
+                {
+                    const unsigned char* p = buf + i*h.size;
+                    uint64 bits = 0;
+                    for (unsigned long b = 0; b < h.size; ++b)
+                        bits = (bits << 8) | p[h.big_endian ? b : h.size-1-b];
+
+                    if (h.kind == 'f')
+                    {
+                        if (h.size == 4)
+                        {
+                            const uint32 bits32 = static_cast<uint32>(bits);
+                            float value;
+                            std::memcpy(&value, &bits32, sizeof(value));
+                            data[start+i] = static_cast<T>(value);
+                        }
+                        else
+                        {
+                            double value;
+                            std::memcpy(&value, &bits, sizeof(value));
+                            data[start+i] = static_cast<T>(value);
+                        }
+                    }
+                    else if (h.kind == 'u' || ((bits >> (8*h.size-1)) & 1) == 0)
+                    {
+                        if (bits > static_cast<uint64>(std::numeric_limits<T>::max()))
+                            throw serialization_error("Error deserializing a raw block: a value doesn't fit");
+                        data[start+i] = static_cast<T>(bits);
+                    }
+                    else
+                    {
+                        // a negative number, sign extended to 64 bits
+                        if (h.size < 8)
+                            bits |= ~static_cast<uint64>(0) << (8*h.size);
+                        const int64 value = static_cast<int64>(bits);
+                        if (!std::numeric_limits<T>::is_signed ||
+                            value < static_cast<int64>(std::numeric_limits<T>::min()))
+                            throw serialization_error("Error deserializing a raw block: a value doesn't fit");
+                        data[start+i] = static_cast<T>(value);
+                    }
+                }
+            }
+        }
+
+        template <typename T, typename alloc>
+        typename enable_if<is_raw_block_element<T>,bool>::type serialize_raw_block (
+            const std::vector<T,alloc>& item,
+            std::ostream& out
+        )
+        /*!
+            ensures
+                - if (raw_block_serialization_enabled(out)) then
+                    - writes item into out as a raw block
+                    - returns true
+                - else
+                    - returns false
+        !*/
+        {
+            if (!raw_block_serialization_enabled(out))
+                return false;
+            serialize_raw_block_header<T>(out);
+            dlib::serialize(static_cast<unsigned long>(item.size()), out);
+            serialize_raw_block_data(item.size() != 0 ? &item[0] : 0, item.size(), out);
+            return true;
+        }
+
+        template <typename T, typename alloc>
+        typename disable_if<is_raw_block_element<T>,bool>::type serialize_raw_block (
+            const std::vector<T,alloc>& ,
+            std::ostream& 
+        ) { return false; }
+
+        template <typename T, typename alloc>
+        typename enable_if<is_raw_block_element<T>,bool>::type deserialize_raw_block (
+            std::vector<T,alloc>& item,
+            std::istream& in
+        )
+        /*!
+            ensures
+                - if (the next object in in is a raw block) then
+                    - reads it into item
+                    - returns true
+                - else
+                    - returns false
+        !*/
+        {
+            if (!raw_block_follows(in))
+                return false;
+            const raw_block_header h = deserialize_raw_block_header(in);
+            unsigned long size;
+            dlib::deserialize(size, in);
+            item.resize(size);
+            deserialize_raw_block_data(h, item.size() != 0 ? &item[0] : 0, size, in);
+            return true;
+        }
+
+        template <typename T, typename alloc>
+        typename disable_if<is_raw_block_element<T>,bool>::type deserialize_raw_block (
+            std::vector<T,alloc>& ,
+            std::istream& 
+        ) { return false; }
+    }
+
 // ----------------------------------------------------------------------------------------
 // prototypes
 
@@ -951,6 +1291,9 @@ namespace dlib
     {
         try
         { 
+            if (ser_helper::serialize_raw_block(item, out))
+                return;
+
             const unsigned long size = static_cast<unsigned long>(item.size());
 
             serialize(size,out); 
@@ -969,6 +1312,9 @@ namespace dlib
     {
         try 
         { 
+            if (ser_helper::deserialize_raw_block(item, in))
+                return;
+
             unsigned long size;
             deserialize(size,in); 
             item.resize(size);
@@ -28,13 +28,21 @@ namespace dlib
             } catch(string_cast_error&) {}
             return std::thread::hardware_concurrency();
         }
+
+        thread_pool_backend default_backend()
+        {
+            const char* be = getenv("DLIB_THREAD_POOL_BACKEND");
+            if (be && std::string(be) == "work_stealing")
+                return work_stealing_backend;
+            return shared_queue_backend;
+        }
     }
 
 // ----------------------------------------------------------------------------------------
 
     thread_pool& default_thread_pool()
     {
-        static thread_pool tp(impl::default_num_threads());
+        static thread_pool tp(impl::default_num_threads(), impl::default_backend());
         return tp;
     }
 }
@@ -20,6 +20,9 @@ namespace dlib
               environment variable is set to an integer then the thread pool will contain
               DLIB_NUM_THREADS threads, otherwise it will contain
               std::thread::hardware_concurrency() threads.
+            - the thread pool uses the work_stealing_backend if the
+              DLIB_THREAD_POOL_BACKEND environment variable is set to "work_stealing",
+              otherwise the shared_queue_backend.
     !*/
 
 // ----------------------------------------------------------------------------------------
@@ -4,35 +4,853 @@
 #define DLIB_THREAD_POOl_CPPh_ 
 
 #include "thread_pool_extension.h"
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace dlib
 {
 
+// ----------------------------------------------------------------------------------------
+
+    namespace
+    {
+        // The scheduler and index of the worker thread running on this thread, if any.
+        thread_local const void* current_scheduler = 0;
+        thread_local long current_worker = -1;
+
+        // The scheduler and id of the task this thread is running, if any.
+        thread_local const void* running_scheduler = 0;
+        thread_local uint64 running_task = 0;
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    class thread_pool_implementation::work_stealing_scheduler
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This is the work_stealing_backend of the thread_pool.  Tasks live in a
+                fixed array of records, so nothing is allocated once it's built.  A
+                free record is taken from a lock-free stack, filled in, and its index
+                is pushed onto the deque of the worker thread that made it, or onto a
+                shared queue when some other thread did.  Workers pop their own deque
+                from the bottom (newest first), then the shared queue, then steal from
+                the top of the other deques (oldest first).  None of this takes a lock.
+
+                A thread waiting for tasks runs queued ones in the meantime, so a task
+                may itself add tasks and wait for them without deadlocking the pool.
+                That's also why wait_for_all_tasks() doesn't wait for every task its
+                thread submitted but only for those submitted by the task it runs, or
+                outside of any task: a thread may be running several nested tasks,
+                and waiting for those below it on its stack would never end.
+                Only idle threads sleep, on a condition variable, and submitters and
+                finished tasks only take its mutex when someone sleeps.
+
+            CONVENTION
+                - capacity == the number of task records, a power of 2
+                - records[i] == the i-th task record and ids[i] its task id, 0 if it's
+                  free or done.  owners[i] == the thread that submitted it and
+                  owner_tasks[i] == the id of the task it was submitted from, 0 if
+                  none.
+                - task ids are records[i].next_task_id*capacity + i, so they are never
+                  0 or 1 and wait_for_task() can tell a finished task from its record.
+                - free_head == (a tag << 32) | (the index+1 of the top free record),
+                  the tag being bumped by every change so a stale compare_exchange
+                  fails.  free_next[i] == the index+1 of the record under record i.
+                - deques[w] == the deque of worker w, queue == the shared queue.
+                - num_sleeping == the number of idle workers waiting on work_ready,
+                  num_waiting == the number of threads waiting on task_done.
+        !*/
+
+    public:
+
+        explicit work_stealing_scheduler (
+            unsigned long num_threads
+        );
+
+        unsigned long num_threads (
+        ) const { return deques.size(); }
+
+        bool is_worker (
+        ) const { return current_scheduler == this; }
+
+        long new_task (
+        );
+        /*!
+            ensures
+                - returns the index of a free record, or -1 if the caller is a worker
+                  thread or is running a task and there is none.
+        !*/
+
+        uint64 submit (
+            long idx
+        );
+
+        void worker (
+            long w
+        );
+        /*!
+            this is the function that executes worker w
+        !*/
+
+        void wait_for_task (
+            uint64 task_id
+        );
+
+        void wait_for_all_tasks (
+        );
+
+        void stop (
+        );
+        /*!
+            ensures
+                - waits for all tasks to finish and tells the workers to return
+        !*/
+
+        void propagate_exception (
+        );
+        /*!
+            ensures
+                - rethrows the oldest exception thrown by a task that hasn't been
+                  rethrown yet, if any.
+        !*/
+
+        task_state_type& record (
+            long idx
+        ) { return records[idx]; }
+
+        long index_of (
+            const task_state_type& task
+        ) const { return &task - records.get(); }
+
+    private:
+
+        class task_deque
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    The deque of Chase and Lev ("Dynamic circular work-stealing
+                    deque", SPAA 2005) with the memory orderings of Le et al.
+                    ("Correct and efficient work-stealing for weak memory models",
+                    PPoPP 2013).  It never grows: no more than capacity records
+                    exist, so it can't overflow.  Only its owner calls push() and
+                    pop(), anyone calls steal().
+            !*/
+        public:
+            explicit task_deque (
+                unsigned long capacity
+            ) : top(0), bottom(0), mask(capacity-1), items(new std::atomic<long>[capacity]) {}
+
+            void push (
+                long idx
+            )
+            {
+                const int64 b = bottom.load(std::memory_order_relaxed);
+                items[b&mask].store(idx, std::memory_order_relaxed);
+                // publishes the task record to the thieves, which load bottom
+                // with acquire
+                bottom.store(b+1, std::memory_order_release);
+            }
+
+            long pop (
+            )
+            {
+                const int64 b = bottom.load(std::memory_order_relaxed) - 1;
+                bottom.store(b, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                int64 t = top.load(std::memory_order_relaxed);
+                long idx = -1;
+                if (t <= b)
+                {
+                    idx = items[b&mask].load(std::memory_order_relaxed);
+                    if (t == b)
+                    {
+                        // the last item, race the thieves for it
+                        if (!top.compare_exchange_strong(t, t+1, std::memory_order_seq_cst,
+                                                         std::memory_order_relaxed))
+                            idx = -1;
+                        bottom.store(b+1, std::memory_order_relaxed);
+                    }
+                }
+                else
+                {
+                    bottom.store(b+1, std::memory_order_relaxed);
+                }
+                return idx;
+            }
+
+            long steal (
+            )
+            {
+                while (true)
+                {
+                    int64 t = top.load(std::memory_order_acquire);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    const int64 b = bottom.load(std::memory_order_acquire);
+                    if (t >= b)
+                        return -1;
+                    const long idx = items[t&mask].load(std::memory_order_relaxed);
+                    if (top.compare_exchange_strong(t, t+1, std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed))
+                        return idx;
+                }
+            }
+
+            bool empty (
+            ) const
+            {
+                return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+            }
+
+        private:
+            std::atomic<int64> top;
+            std::atomic<int64> bottom;
+            const int64 mask;
+            std::unique_ptr<std::atomic<long>[]> items;
+        };
+
+        class task_queue
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    Dmitry Vyukov's bounded multi-producer multi-consumer queue,
+                    where every cell has a sequence number telling whether it's
+                    ready to be written or read.  Like task_deque it can't overflow.
+            !*/
+        public:
+            explicit task_queue (
+                unsigned long capacity
+            ) : head(0), tail(0), mask(capacity-1), cells(new cell[capacity])
+            {
+                for (unsigned long i = 0; i < capacity; ++i)
+                    cells[i].seq.store(i, std::memory_order_relaxed);
+            }
+
+            void push (
+                long idx
+            )
+            {
+                std::size_t pos = tail.load(std::memory_order_relaxed);
+                cell* c;
+                while (true)
+                {
+                    c = &cells[pos&mask];
+                    const std::size_t seq = c->seq.load(std::memory_order_acquire);
+                    const std::ptrdiff_t dif = (std::ptrdiff_t)seq - (std::ptrdiff_t)pos;
+                    if (dif == 0)
+                    {
+                        if (tail.compare_exchange_weak(pos, pos+1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else
+                    {
+                        // dif < 0 would mean the queue is full, which can't happen
+                        pos = tail.load(std::memory_order_relaxed);
+                    }
+                }
+                c->idx = idx;
+                c->seq.store(pos+1, std::memory_order_release);
+            }
+
+            long pop (
+            )
+            {
+                std::size_t pos = head.load(std::memory_order_relaxed);
+                cell* c;
+                while (true)
+                {
+                    c = &cells[pos&mask];
+                    const std::size_t seq = c->seq.load(std::memory_order_acquire);
+                    const std::ptrdiff_t dif = (std::ptrdiff_t)seq - (std::ptrdiff_t)(pos+1);
+                    if (dif == 0)
+                    {
+                        if (head.compare_exchange_weak(pos, pos+1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if (dif < 0)
+                    {
+                        return -1;
+                    }
+                    else
+                    {
+                        pos = head.load(std::memory_order_relaxed);
+                    }
+                }
+                const long idx = c->idx;
+                c->seq.store(pos+mask+1, std::memory_order_release);
+                return idx;
+            }
+
+            bool empty (
+            ) const
+            {
+                return tail.load(std::memory_order_relaxed) == head.load(std::memory_order_relaxed);
+            }
+
+        private:
+            struct cell
+            {
+                std::atomic<std::size_t> seq;
+                long idx;
+            };
+
+            std::atomic<std::size_t> head;
+            std::atomic<std::size_t> tail;
+            const std::size_t mask;
+            std::unique_ptr<cell[]> cells;
+        };
+
+        long find_task (
+            long w
+        );
+        /*!
+            ensures
+                - takes a queued task for worker w, or for a thread that isn't a
+                  worker if w == -1, and returns its record index.  Returns -1 if
+                  there is none.
+        !*/
+
+        bool has_work (
+        ) const;
+
+        uint64 current_task (
+        ) const { return running_scheduler == this ? running_task : 0; }
+        /*!
+            ensures
+                - returns the id of the task of this scheduler the calling thread is
+                  running, 0 if none.
+        !*/
+
+        void run_task (
+            long idx
+        );
+
+        void free_record (
+            long idx
+        );
+
+        long pop_free_record (
+        );
+
+        void notify_work (
+        );
+
+        void notify_done (
+        );
+
+        template <typename F>
+        void help_until (
+            const F& done
+        );
+        /*!
+            ensures
+                - runs queued tasks until done() returns true, sleeping when there
+                  is nothing to run.
+        !*/
+
+        // how many times an idle thread looks for work again before sleeping
+        static const int spin_rounds = 64;
+
+        const unsigned long capacity;
+        std::unique_ptr<task_state_type[]> records;
+        std::unique_ptr<std::atomic<uint64>[]> ids;
+        std::unique_ptr<std::atomic<thread_id_type>[]> owners;
+        std::unique_ptr<std::atomic<uint64>[]> owner_tasks;
+        std::unique_ptr<std::atomic<uint32>[]> free_next;
+        std::atomic<uint64> free_head;
+
+        std::vector<std::unique_ptr<task_deque> > deques;
+        task_queue queue;
+
+        std::mutex sleep_mutex;
+        std::condition_variable work_ready;
+        std::condition_variable task_done;
+        std::atomic<long> num_sleeping;
+        std::atomic<long> num_waiting;
+        bool we_are_destructing;
+
+        std::mutex exception_mutex;
+        std::vector<std::exception_ptr> exceptions;
+        std::atomic<bool> has_exceptions;
+    };
+
+// ----------------------------------------------------------------------------------------
+
+    namespace
+    {
+        unsigned long work_stealing_capacity (
+            unsigned long num_threads
+        )
+        {
+            // enough records for a parallel_for() split in 8 blocks per thread, twice
+            unsigned long capacity = 128;
+            while (capacity < 16*num_threads)
+                capacity *= 2;
+            return capacity;
+        }
+    }
+
+    thread_pool_implementation::work_stealing_scheduler::
+    work_stealing_scheduler (
+        unsigned long num_threads
+    ) :
+        capacity(work_stealing_capacity(num_threads)),
+        records(new task_state_type[capacity]),
+        ids(new std::atomic<uint64>[capacity]),
+        owners(new std::atomic<thread_id_type>[capacity]),
+        owner_tasks(new std::atomic<uint64>[capacity]),
+        free_next(new std::atomic<uint32>[capacity]),
+        free_head(0),
+        queue(capacity),
+        num_sleeping(0),
+        num_waiting(0),
+        we_are_destructing(false),
+        has_exceptions(false)
+    {
+        for (unsigned long i = 0; i < capacity; ++i)
+        {
+            ids[i].store(0, std::memory_order_relaxed);
+            owners[i].store(0, std::memory_order_relaxed);
+            owner_tasks[i].store(0, std::memory_order_relaxed);
+        }
+        for (unsigned long i = capacity; i > 0; --i)
+            free_record(i-1);
+
+        deques.resize(num_threads);
+        for (auto& d : deques)
+            d.reset(new task_deque(capacity));
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    void thread_pool_implementation::work_stealing_scheduler::
+    free_record (
+        long idx
+    )
+    {
+        uint64 head = free_head.load(std::memory_order_relaxed);
+        uint64 next_head;
+        do
+        {
+            free_next[idx].store(static_cast<uint32>(head), std::memory_order_relaxed);
+            next_head = (((head>>32) + 1)<<32) | static_cast<uint64>(idx+1);
+        } while (!free_head.compare_exchange_weak(head, next_head, std::memory_order_release,
+                                                  std::memory_order_relaxed));
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    long thread_pool_implementation::work_stealing_scheduler::
+    pop_free_record (
+    )
+    {
+        uint64 head = free_head.load(std::memory_order_acquire);
+        while (true)
+        {
+            const uint32 top = static_cast<uint32>(head);
+            if (top == 0)
+                return -1;
+            const uint64 next_head = (((head>>32) + 1)<<32) |
+                free_next[top-1].load(std::memory_order_relaxed);
+            if (free_head.compare_exchange_weak(head, next_head, std::memory_order_acquire,
+                                                std::memory_order_acquire))
+                return top-1;
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    long thread_pool_implementation::work_stealing_scheduler::
+    new_task (
+    )
+    {
+        while (true)
+        {
+            propagate_exception();
+
+            // Tasks waiting for their own tasks hold records too, so a thread
+            // running a task mustn't wait for a record to be freed.
+            const long idx = pop_free_record();
+            if (idx != -1 || is_worker() || current_task() != 0)
+                return idx;
+
+            help_until([this](){ return static_cast<uint32>(free_head.load(std::memory_order_relaxed)) != 0; });
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    uint64 thread_pool_implementation::work_stealing_scheduler::
+    submit (
+        long idx
+    )
+    {
+        const uint64 id = records[idx].next_task_id*capacity + idx;
+        records[idx].next_task_id += 1;
+        owners[idx].store(get_thread_id(), std::memory_order_relaxed);
+        owner_tasks[idx].store(current_task(), std::memory_order_relaxed);
+        ids[idx].store(id, std::memory_order_release);
+
+        if (is_worker())
+            deques[current_worker]->push(idx);
+        else
+            queue.push(idx);
+
+        notify_work();
+        return id;
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    long thread_pool_implementation::work_stealing_scheduler::
+    find_task (
+        long w
+    )
+    {
+        long idx = -1;
+        if (w != -1)
+            idx = deques[w]->pop();
+        if (idx == -1)
+            idx = queue.pop();
+
+        // steal from the others, starting with the next worker so the thieves
+        // spread out
+        const long n = deques.size();
+        for (long i = 1; i <= n && idx == -1; ++i)
+        {
+            const long victim = (w + i)%n;
+            if (victim != w)
+                idx = deques[victim]->steal();
+        }
+        return idx;
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    bool thread_pool_implementation::work_stealing_scheduler::
+    has_work (
+    ) const
+    {
+        if (!queue.empty())
+            return true;
+        for (auto& d : deques)
+        {
+            if (!d->empty())
+                return true;
+        }
+        return false;
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    void thread_pool_implementation::work_stealing_scheduler::
+    notify_work (
+    )
+    {
+        // Pairs with the fence of a thread about to sleep: either it sees the
+        // new task or we see it sleeping.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const bool sleeping = num_sleeping.load(std::memory_order_relaxed) != 0;
+        const bool waiting = num_waiting.load(std::memory_order_relaxed) != 0;
+        if (sleeping || waiting)
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            if (sleeping)
+                work_ready.notify_one();
+            // waiting threads run tasks too
+            if (waiting)
+                task_done.notify_all();
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    void thread_pool_implementation::work_stealing_scheduler::
+    notify_done (
+    )
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (num_waiting.load(std::memory_order_relaxed) != 0)
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            task_done.notify_all();
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    void thread_pool_implementation::work_stealing_scheduler::
+    run_task (
+        long idx
+    )
+    {
+        task_state_type& task = records[idx];
+
+        const void* const outer_scheduler = running_scheduler;
+        const uint64 outer_task = running_task;
+        running_scheduler = this;
+        running_task = ids[idx].load(std::memory_order_relaxed);
+        try
+        {
+            if (task.bfp)
+                task.bfp();
+            else if (task.mfp0)
+                task.mfp0();
+            else if (task.mfp1)
+                task.mfp1(task.arg1);
+            else if (task.mfp2)
+                task.mfp2(task.arg1, task.arg2);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            exceptions.push_back(std::current_exception());
+            has_exceptions.store(true, std::memory_order_release);
+        }
+        running_scheduler = outer_scheduler;
+        running_task = outer_task;
+
+        task.bfp.clear();
+        task.mfp0.clear();
+        task.mfp1.clear();
+        task.mfp2.clear();
+        task.arg1 = 0;
+        task.arg2 = 0;
+        task.function_copy.reset();
+
+        ids[idx].store(0, std::memory_order_release);
+        free_record(idx);
+        notify_done();
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <typename F>
+    void thread_pool_implementation::work_stealing_scheduler::
+    help_until (
+        const F& done
+    )
+    {
+        const long w = is_worker() ? current_worker : -1;
+        int spins = 0;
+        while (!done())
+        {
+            const long idx = find_task(w);
+            if (idx != -1)
+            {
+                run_task(idx);
+                spins = 0;
+            }
+            else if (spins < spin_rounds)
+            {
+                ++spins;
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::unique_lock<std::mutex> lock(sleep_mutex);
+                num_waiting.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (!done() && !has_work())
+                    task_done.wait(lock);
+                num_waiting.fetch_sub(1, std::memory_order_relaxed);
+                spins = 0;
+            }
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    void thread_pool_implementation::work_stealing_scheduler::
+    worker (
+        long w
+    )
+    {
+        current_scheduler = this;
+        current_worker = w;
+
+        int spins = 0;
+        while (true)
+        {
+            const long idx = find_task(w);
+            if (idx != -1)
+            {
+                run_task(idx);
+                spins = 0;
+                continue;
+            }
+            if (spins < spin_rounds)
+            {
+                ++spins;
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            if (we_are_destructing)
+                break;
+            num_sleeping.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!has_work())
+                work_ready.wait(lock);
+            num_sleeping.fetch_sub(1, std::memory_order_relaxed);
+            spins = 0;
+        }
+
+        current_scheduler = 0;
+        current_worker = -1;
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    void thread_pool_implementation::work_stealing_scheduler::
+    wait_for_task (
+        uint64 task_id
+    )
+    {
+        const unsigned long idx = static_cast<unsigned long>(task_id%capacity);
+        help_until([&](){ return ids[idx].load(std::memory_order_acquire) != task_id; });
+        propagate_exception();
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    void thread_pool_implementation::work_stealing_scheduler::
+    wait_for_all_tasks (
+    )
+    {
+        const thread_id_type thread_id = get_thread_id();
+        const uint64 task_id = current_task();
+        help_until([&]()
+        {
+            for (unsigned long i = 0; i < capacity; ++i)
+            {
+                // A record can be reused by another thread between these loads, but
+                // only once the task we'd be waiting for is done.
+                if (ids[i].load(std::memory_order_acquire) != 0 &&
+                    owners[i].load(std::memory_order_relaxed) == thread_id &&
+                    owner_tasks[i].load(std::memory_order_relaxed) == task_id)
+                    return false;
+            }
+            return true;
+        });
+        propagate_exception();
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    void thread_pool_implementation::work_stealing_scheduler::
+    stop (
+    )
+    {
+        help_until([this]()
+        {
+            for (unsigned long i = 0; i < capacity; ++i)
+            {
+                if (ids[i].load(std::memory_order_acquire) != 0)
+                    return false;
+            }
+            return true;
+        });
+
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        we_are_destructing = true;
+        work_ready.notify_all();
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    void thread_pool_implementation::work_stealing_scheduler::
+    propagate_exception (
+    )
+    {
+        if (!has_exceptions.load(std::memory_order_acquire))
+            return;
+
+        std::unique_lock<std::mutex> lock(exception_mutex);
+        if (exceptions.empty())
+            return;
+        std::exception_ptr eptr = exceptions.front();
+        exceptions.erase(exceptions.begin());
+        has_exceptions.store(!exceptions.empty(), std::memory_order_release);
+        lock.unlock();
+        std::rethrow_exception(eptr);
+    }
+
+// ----------------------------------------------------------------------------------------
 // ----------------------------------------------------------------------------------------
 
     thread_pool_implementation::
     thread_pool_implementation (
-        unsigned long num_threads
+        unsigned long num_threads,
+        thread_pool_backend backend
     ) : 
         task_done_signaler(m),
         task_ready_signaler(m),
         we_are_destructing(false)
     {
-        tasks.resize(num_threads);
         threads.resize(num_threads);
+        if (backend == work_stealing_backend && num_threads != 0)
+        {
+            scheduler.reset(new work_stealing_scheduler(num_threads));
+            for (unsigned long i = 0; i < num_threads; ++i)
+            {
+                threads[i] = std::thread([this,i](){this->scheduler->worker(i);});
+            }
+            return;
+        }
+
+        tasks.resize(num_threads);
         for (unsigned long i = 0; i < num_threads; ++i)
         {
             threads[i] = std::thread([&](){this->thread();});
         }
     }
 
+// ----------------------------------------------------------------------------------------
+
+    thread_pool_implementation::task_state_type* thread_pool_implementation::
+    new_scheduled_task (
+    )
+    {
+        const long idx = scheduler->new_task();
+        if (idx == -1)
+            return 0;
+        return &scheduler->record(idx);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    uint64 thread_pool_implementation::
+    submit_scheduled_task (
+        task_state_type& task
+    )
+    {
+        return scheduler->submit(scheduler->index_of(task));
+    }
+
 // ----------------------------------------------------------------------------------------
 
     void thread_pool_implementation::
     shutdown_pool (
     )
     {
+        if (scheduler)
+        {
+            scheduler->stop();
+            for (auto& t : threads)
+                t.join();
+            threads.clear();
+
+            // Throw any unhandled exceptions.  Since shutdown_pool() is only called
+            // in the destructor this will kill the program.
+            scheduler->propagate_exception();
+            return;
+        }
+
         {
             auto_mutex M(m);
             
@@ -85,6 +903,9 @@ namespace dlib
     num_threads_in_pool (
     ) const
     {
+        if (scheduler)
+            return scheduler->num_threads();
+
         auto_mutex M(m);
         return tasks.size();
     }
@@ -96,6 +917,12 @@ namespace dlib
         uint64 task_id
     ) const
     {
+        if (scheduler)
+        {
+            scheduler->wait_for_task(task_id);
+            return;
+        }
+
         auto_mutex M(m);
         if (tasks.size() != 0)
         {
@@ -114,6 +941,12 @@ namespace dlib
     wait_for_all_tasks (
     ) const
     {
+        if (scheduler)
+        {
+            scheduler->wait_for_all_tasks();
+            return;
+        }
+
         const thread_id_type thread_id = get_thread_id();
 
         auto_mutex M(m);
@@ -291,6 +1124,19 @@ namespace dlib
         std::shared_ptr<function_object_copy>& item
     )
     {
+        if (scheduler)
+        {
+            task_state_type* task = new_scheduled_task();
+            if (task == 0)
+            {
+                bfp();
+                return 1;
+            }
+            task->bfp = bfp;
+            task->function_copy.swap(item);
+            return submit_scheduled_task(*task);
+        }
+
         auto_mutex M(m);
         const thread_id_type my_thread_id = get_thread_id();
 
@@ -334,6 +1180,9 @@ namespace dlib
     is_task_thread (
     ) const
     {
+        if (scheduler)
+            return scheduler->is_worker();
+
         auto_mutex M(m);
         return is_worker_thread(get_thread_id());
     }
@@ -23,6 +23,12 @@ namespace dlib
 
     class thread_pool_implementation;
 
+    enum thread_pool_backend
+    {
+        shared_queue_backend,
+        work_stealing_backend
+    };
+
     template <
         typename T
         >
@@ -142,12 +148,19 @@ namespace dlib
                 - m == the mutex used to protect everything in this object
                 - worker_thread_ids == an array that contains the thread ids for
                   all the threads in the thread pool
+
+                - if (this pool uses the work_stealing_backend) then
+                    - scheduler.get() != 0 and it does all the scheduling.  tasks,
+                      worker_thread_ids, m and the signalers aren't used at all.
+                - else
+                    - scheduler.get() == 0
         !*/
         typedef bound_function_pointer::kernel_1a_c bfp_type;
 
         friend class thread_pool;
-        explicit thread_pool_implementation (
-            unsigned long num_threads
+        thread_pool_implementation (
+            unsigned long num_threads,
+            thread_pool_backend backend
         );
 
     public:
@@ -173,6 +186,20 @@ namespace dlib
             void (T::*funct)()
         )
         {
+            if (scheduler)
+            {
+                task_state_type* task = new_scheduled_task();
+                if (task == 0)
+                {
+                    // called from within a task while every task record is in
+                    // use, so just perform the task right here
+                    (obj.*funct)();
+                    return 1;
+                }
+                task->mfp0.set(obj,funct);
+                return submit_scheduled_task(*task);
+            }
+
             auto_mutex M(m);
             const thread_id_type my_thread_id = get_thread_id();
 
@@ -216,6 +243,21 @@ namespace dlib
             long arg1
         )
         {
+            if (scheduler)
+            {
+                task_state_type* task = new_scheduled_task();
+                if (task == 0)
+                {
+                    // called from within a task while every task record is in
+                    // use, so just perform the task right here
+                    (obj.*funct)(arg1);
+                    return 1;
+                }
+                task->mfp1.set(obj,funct);
+                task->arg1 = arg1;
+                return submit_scheduled_task(*task);
+            }
+
             auto_mutex M(m);
             const thread_id_type my_thread_id = get_thread_id();
 
@@ -261,6 +303,22 @@ namespace dlib
             long arg2
         )
         {
+            if (scheduler)
+            {
+                task_state_type* task = new_scheduled_task();
+                if (task == 0)
+                {
+                    // called from within a task while every task record is in
+                    // use, so just perform the task right here
+                    (obj.*funct)(arg1, arg2);
+                    return 1;
+                }
+                task->mfp2.set(obj,funct);
+                task->arg1 = arg1;
+                task->arg2 = arg2;
+                return submit_scheduled_task(*task);
+            }
+
             auto_mutex M(m);
             const thread_id_type my_thread_id = get_thread_id();
 
@@ -343,6 +401,37 @@ namespace dlib
 
     private:
 
+        class work_stealing_scheduler;
+
+        struct task_state_type;
+
+        task_state_type* new_scheduled_task (
+        );
+        /*!
+            requires
+                - scheduler.get() != 0
+            ensures
+                - rethrows any exception a task threw that hasn't been rethrown yet.
+                - if (the calling thread is a worker thread or is running a task, and
+                  every task record of the scheduler is in use) then
+                    - returns 0, the caller must perform its task itself.
+                - else
+                    - returns an empty task record, blocking (and running other
+                      tasks) until one is free.  The caller must fill in its
+                      function pointers and hand it to submit_scheduled_task().
+        !*/
+
+        uint64 submit_scheduled_task (
+            task_state_type& task
+        );
+        /*!
+            requires
+                - task was returned by new_scheduled_task() and has been filled in
+            ensures
+                - queues the task for the worker threads.
+                - returns the task id for this new task
+        !*/
+
         bool is_worker_thread (
             const thread_id_type id
         ) const;
@@ -477,6 +566,8 @@ namespace dlib
 
         std::vector<std::thread> threads;
 
+        std::unique_ptr<work_stealing_scheduler> scheduler;
+
         // restricted functions
         thread_pool_implementation(thread_pool_implementation&);        // copy constructor
         thread_pool_implementation& operator=(thread_pool_implementation&);    // assignment operator
@@ -499,10 +590,11 @@ namespace dlib
 
     public:
         explicit thread_pool (
-            unsigned long num_threads
+            unsigned long num_threads,
+            thread_pool_backend backend = shared_queue_backend
         ) 
         {
-            impl.reset(new thread_pool_implementation(num_threads));
+            impl.reset(new thread_pool_implementation(num_threads, backend));
         }
 
         ~thread_pool (
@@ -202,6 +202,38 @@ namespace dlib
     template <typename T> bool operator>  (const future<T>& a, const T& b)         { return a.get() >  b; }
     template <typename T> bool operator>  (const T& a,         const future<T>& b) { return a       >  b.get(); }
 
+// ----------------------------------------------------------------------------------------
+
+    enum thread_pool_backend
+    {
+        shared_queue_backend,
+        work_stealing_backend
+    };
+    /*!
+        These select how a thread_pool hands its tasks to its threads.
+
+        shared_queue_backend 
+            All the tasks sit in one array, as many as there are threads, behind one
+            mutex, and every add_task() and finished task wakes the threads up
+            through a condition variable.  A thread waiting for tasks just sleeps,
+            and a task submitted from a pool thread when no thread is free is run
+            right away by that thread.
+
+        work_stealing_backend
+            Every thread has a deque of tasks it pushes the tasks it submits onto
+            and pops its next task from, newest first, and the tasks submitted by
+            other threads go to a shared queue.  A thread with nothing to do steals
+            the oldest task of another one.  None of this takes a lock, and a
+            thread only takes a mutex to sleep when it's idle, so small tasks cost
+            far less.  A thread waiting for tasks (in wait_for_task(),
+            wait_for_all_tasks() or a future) runs queued tasks in the meantime, so
+            tasks may add tasks to the same pool and wait for them, e.g. nest
+            parallel_for() calls, without deadlocking it.  There is room for many
+            more tasks than threads: add_task() only blocks, or runs the task right
+            away when called from a task, once 16 per thread (and at least 128)
+            are queued or running.
+    !*/
+
 // ----------------------------------------------------------------------------------------
 
     class thread_pool 
@@ -234,11 +266,14 @@ namespace dlib
 
     public:
         explicit thread_pool (
-            unsigned long num_threads
+            unsigned long num_threads,
+            thread_pool_backend backend = shared_queue_backend
         );
         /*!
             ensures
                 - #num_threads_in_pool() == num_threads
+                - the pool schedules its tasks with the given backend.  The
+                  work_stealing_backend makes no difference when num_threads == 0.
             throws
                 - std::bad_alloc
                 - dlib::thread_error
@@ -406,6 +441,10 @@ namespace dlib
                 - the call to this function blocks until all tasks which were submitted
                   to the thread pool by the thread that is calling this function have 
                   finished.
+                - When the pool uses the work_stealing_backend and this function is
+                  called from within one of its tasks, only the tasks submitted by that
+                  task are waited for.  The calling thread may be running several
+                  nested tasks at once then, see thread_pool_backend.
         !*/
 
         // --------------------
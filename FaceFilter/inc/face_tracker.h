@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_FACE_TRACKER_H)
+#define _FACE_TRACKER_H
+
+#include "preview_image.h"
+#include <dlib/image_processing/correlation_tracker.h>
+#include <dlib/image_processing/frontal_face_detector.h>
+#include <dlib/threads.h>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * @brief Finds the faces of a stream of preview frames, mostly by following
+ *        the faces of the frame before.
+ * @details Every face found by a full-frame scan seeds a
+ *          dlib::correlation_tracker, and between two full scans the faces
+ *          are followed by their trackers, updated side by side on the thread
+ *          pool.  Only when a tracker's peak-to-sidelobe ratio drops, meaning
+ *          it is losing the face, the face is detected again: it is looked for
+ *          in a region around its last position, and only at the scales close
+ *          to its last size, the region being resized so that the face would
+ *          fill the detection window one pyramid level down and scanned over
+ *          three pyramid levels.  That takes a fraction of a full scan, and
+ *          the tracker is seeded again from what it finds.
+ *
+ *          A full scan is wanted when no face is known, every
+ *          full_scan_interval frames, and in the frame after a face was lost
+ *          or only found with a score under the threshold of a full scan.
+ *          The budget decides when a wanted full scan actually runs: every
+ *          frame adds budget_ns of credit, every frame spends the time its
+ *          scans took, and a full scan waits until the credit covers what the
+ *          last one cost.  Over a run of frames the tracker takes about
+ *          budget_ns a frame, or less.
+ * @remarks An object must not be used by two threads at once.
+ */
+class face_tracker {
+public:
+	face_tracker();
+
+	/**
+	 * @brief Sets the detector, e.g. dlib::get_frontal_face_detector(), and
+	 *        forgets the faces found so far.
+	 */
+	void set_detector(const dlib::frontal_face_detector& detector);
+
+	bool has_detector() const {
+		return detector.num_detectors() != 0;
+	}
+
+	/**
+	 * @brief Sets the most frames between two full scans (default: 30).
+	 */
+	void set_full_scan_interval(int frames);
+
+	/**
+	 * @brief Sets the average time the tracker may take per frame, 0 for no
+	 *        limit (the default).
+	 */
+	void set_budget_ns(uint64_t budget_ns);
+
+	/**
+	 * @brief Sets the pool the correlation trackers of several faces are
+	 *        updated on, NULL to update them one after the other (the
+	 *        default).
+	 */
+	void set_thread_pool(dlib::thread_pool *tp);
+
+	/**
+	 * @brief Forgets the faces found so far, so the next frame is scanned in
+	 *        full.
+	 */
+	void reset();
+
+	/**
+	 * @brief Finds the faces of the next frame.
+	 * @remarks A face that was missed is still reported at its last position
+	 *          for a couple of frames, so a single bad frame doesn't make it
+	 *          blink.
+	 *
+	 * @param img  The frame; it should be the view the previous frames were
+	 *             given in
+	 *
+	 * @return The faces, in the coordinates of img.  The vector is only valid
+	 *         until the next call.
+	 */
+	const std::vector<dlib::rectangle>& update(const preview_luma_image& img);
+
+	uint64_t last_frame_ns() const {
+		return _last_frame_ns;
+	}
+
+	void reset_stats();
+
+	uint64_t total_ns; /* time spent since the last reset_stats() */
+	uint64_t frames; /* frames since the last reset_stats() */
+	uint64_t full_scans; /* full scans since the last reset_stats() */
+	uint64_t redetections; /* region scans of faces whose tracker got lost, since the last reset_stats() */
+
+private:
+	struct track {
+		/* 32x32 filters track a face about as well as the default 64x64 ones, for half the time */
+		track() :
+				score(0), misses(0), psr(0), tracker(5) {
+			/* the pyramid of extract_image_chip() can't read rotated previews */
+			tracker.use_area_averaged_chips(true);
+		}
+
+		dlib::rectangle rect;
+		double score; /* detection score of the last time the face was detected */
+		int misses; /* frames in a row the face was not found in */
+		double psr; /* peak-to-sidelobe ratio of the last tracker update */
+		dlib::correlation_tracker tracker;
+	};
+
+	void _scan_full(const preview_luma_image& img);
+	void _follow_tracks(const preview_luma_image& img);
+	bool _scan_roi(const preview_luma_image& img, track& t);
+	void _remove_duplicates();
+
+	dlib::frontal_face_detector detector;
+	dlib::frontal_face_detector roi_detector; /* detector limited to 3 levels */
+	dlib::frontal_face_detector::workspace full_ws;
+	dlib::frontal_face_detector::workspace roi_ws;
+	std::vector<dlib::rect_detection> dets;
+	dlib::array2d<unsigned char> chip; /* the region of a face, resized */
+
+	dlib::thread_pool *pool;
+	std::vector<track> tracks;
+	std::vector<dlib::rectangle> faces;
+	bool low_confidence; /* a face was lost or weak in the last frame */
+	int frames_since_full;
+	int full_scan_interval;
+	uint64_t budget_ns;
+	int64_t credit; /* time the budget still allows, may be negative */
+	uint64_t full_scan_ns; /* time the last full scan took */
+	uint64_t _last_frame_ns;
+};
+
+#endif
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_FILTER_PIPELINE_H)
+#define _FILTER_PIPELINE_H
+
+#include "nv12_frame.h"
+#include <dlib/threads.h>
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+/*
+ * How much of its work a stage does.  When a frame takes longer than the
+ * pipeline budget, the most expensive stage is first reduced (if it has a
+ * cheaper mode) and then dropped.
+ */
+typedef enum {
+	FILTER_STAGE_FULL,
+	FILTER_STAGE_REDUCED,
+	FILTER_STAGE_DROPPED
+} filter_stage_state_e;
+
+/**
+ * @brief One step of a filter_pipeline.
+ * @details A stage is either pointwise, meaning every output byte only
+ *          depends on the same input byte (and, in the UV plane, on whether it
+ *          is Cb or Cr), or a frame stage that needs whole planes.
+ *          Consecutive pointwise stages are fused by the pipeline: it feeds
+ *          them the planes in small chunks so every byte is read from and
+ *          written to memory once, however many of them there are.
+ */
+class filter_stage {
+public:
+	explicit filter_stage(const char *name);
+	virtual ~filter_stage();
+
+	const char *name() const {
+		return _name;
+	}
+
+	/**
+	 * @brief Returns true if the stage implements run_y() and run_uv()
+	 *        rather than run().
+	 */
+	virtual bool is_pointwise() const = 0;
+
+	/**
+	 * @brief Returns true if the stage has a cheaper FILTER_STAGE_REDUCED
+	 *        mode.
+	 */
+	virtual bool can_reduce() const {
+		return false;
+	}
+
+	/**
+	 * @brief Filters part of the Y plane (pointwise stages only).
+	 */
+	virtual void run_y(unsigned char * /*y*/, size_t /*size*/) {
+	}
+
+	/**
+	 * @brief Filters part of the UV plane (pointwise stages only).
+	 * @remarks The chunk always starts on a Cb byte.
+	 */
+	virtual void run_uv(unsigned char * /*uv*/, size_t /*size*/) {
+	}
+
+	/**
+	 * @brief Filters a whole frame (frame stages only).
+	 *
+	 * @param frame    The frame
+	 * @param reduced  True if the stage should run in its cheaper mode
+	 */
+	virtual void run(const nv12_frame& /*frame*/, bool /*reduced*/) {
+	}
+
+	filter_stage_state_e state; /* set by the pipeline budget */
+	uint64_t last_ns; /* time spent in the last frame */
+	uint64_t total_ns; /* time spent since the last reset_stats() */
+	uint64_t frames; /* frames the stage ran on since the last reset_stats() */
+
+private:
+	const char *_name;
+};
+
+/**
+ * @brief Creates one of the built-in stages by name.
+ * @details The names are: sepia, grayscale, invert, nored, noblue, pinky,
+ *          gaussian and emboss.  Gaussian and emboss can be reduced to the Y
+ *          plane only.
+ *
+ * @param name  The name of the stage
+ * @param tp    The pool the frame stages spread their rows over
+ *
+ * @return The new stage, or NULL if there is no stage with that name
+ */
+filter_stage *filter_stage_create(const char *name, dlib::thread_pool& tp);
+
+/**
+ * @brief A chain of filter stages applied to every preview frame.
+ * @details The stages run in the order they were added.  Every stage keeps
+ *          nanosecond timing counters, and an optional per-frame budget
+ *          reduces or drops the most expensive stage whenever a frame runs
+ *          over it.  Stages are brought back one at a time, in the reverse
+ *          order, after a run of frames that used less than half the budget.
+ * @remarks A pipeline must only be used from one thread at a time.
+ */
+class filter_pipeline {
+public:
+	filter_pipeline();
+
+	/**
+	 * @brief Appends a stage.  The pipeline takes ownership of it.
+	 */
+	void add(filter_stage *stage);
+
+	/**
+	 * @brief Replaces the stages by the ones named in a comma separated
+	 *        list, e.g. "gaussian,sepia".
+	 *
+	 * @return false if one of the names is unknown; the pipeline is left
+	 *         empty in that case
+	 */
+	bool set_chain(const char *chain, dlib::thread_pool& tp);
+
+	void clear();
+
+	/**
+	 * @brief Sets the per-frame time budget, 0 for none (the default).
+	 */
+	void set_budget_ns(uint64_t budget_ns);
+
+	/**
+	 * @brief Runs all the stages that are not dropped over the frame.
+	 */
+	void run(const nv12_frame& frame);
+
+	size_t num_stages() const {
+		return stages.size();
+	}
+	const filter_stage& stage(size_t i) const {
+		return *stages[i];
+	}
+	uint64_t last_frame_ns() const {
+		return _last_frame_ns;
+	}
+
+	void reset_stats();
+
+private:
+	void _run_fused(const nv12_frame& frame, size_t begin, size_t end);
+	void _apply_budget();
+
+	std::vector<std::unique_ptr<filter_stage> > stages;
+	std::vector<size_t> degraded; /* stages the budget touched, oldest first */
+	uint64_t budget_ns;
+	uint64_t _last_frame_ns;
+	int calm_frames; /* frames in a row under half the budget */
+};
+
+/*
+ * Filter presets offered by the "Filter" button.  Preset 0 leaves the
+ * preview untouched.
+ */
+#define FILTER_PRESET_COUNT 12
+
+/**
+ * @brief Returns the stage chain of a preset, for filter_pipeline::set_chain().
+ */
+const char *filter_preset_chain(int preset);
+
+#endif
@@ -2,12 +2,76 @@
 #define _LANDMARK_H
 
 #include "data.h"
+#include "sticker.h"
 #include <iostream>
 #include <dlib/image_processing.h>
 #include <dlib/image_transforms.h>
 #include <fstream>
 
-std::vector<dlib::full_object_detection> face_landmark(camera_preview_data_s* frame, dlib::shape_predictor* sp, int sticker, std::vector<dlib::rectangle> faces, int count);
 void draw_landmark(camera_preview_data_s* frame, const dlib::full_object_detection shape);
 
+/* Stickers, in the order the "Sticker" button goes through them */
+typedef enum {
+	STICKER_NONE,
+	STICKER_MUSTACHE,
+	STICKER_EAR,
+	STICKER_HAT,
+	STICKER_GLASSES
+} sticker_e;
+
+/**
+ * @brief The images the stickers are made of, and how they sit on a face.
+ * @details The preview draws with one set through load_stickers() and
+ *          draw_sticker(); a thread that draws stickers elsewhere, like the
+ *          photo_queue, has its own.
+ * @remarks An object must not be used by two threads at once.
+ */
+class sticker_set {
+public:
+	/**
+	 * @param rotation  How the frames are turned to get the view the
+	 *                  landmarks are given in
+	 */
+	explicit sticker_set(preview_rotation_e rotation);
+
+	/**
+	 * @brief Decodes the sticker images found in a directory, see
+	 *        load_stickers().
+	 */
+	bool load(const char* dir);
+
+	/**
+	 * @brief Draws a sticker on a face, see draw_sticker().
+	 */
+	void draw(const nv12_frame& frame, int sticker, const dlib::full_object_detection& shape);
+
+private:
+	void _draw_piece(const nv12_frame& frame, int piece, const dlib::dpoint& center, double width);
+	void _draw_piece_on(const nv12_frame& frame, int piece, const dlib::dpoint& bottom, double width);
+
+	sticker_cache cache;
+	std::vector<int> piece_ids; /* by piece, -1 for the missing ones */
+};
+
+/**
+ * @brief Decodes the sticker images found in a directory.
+ * @details Every image is decoded once; stickers whose images are missing
+ *          are not drawn.
+ *
+ * @param dir  The directory, ending with a '/'
+ *
+ * @return true if all the images were loaded
+ */
+bool load_stickers(const char* dir);
+
+/**
+ * @brief Draws a sticker on a face.
+ *
+ * @param frame    The preview frame
+ * @param sticker  The sticker, one of sticker_e
+ * @param shape    The landmarks of the face, in the coordinates of the
+ *                 frame turned by PREVIEW_ROTATION_90
+ */
+void draw_sticker(const nv12_frame& frame, int sticker, const dlib::full_object_detection& shape);
+
 #endif
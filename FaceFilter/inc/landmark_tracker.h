@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_LANDMARK_TRACKER_H)
+#define _LANDMARK_TRACKER_H
+
+#include "preview_image.h"
+#include <dlib/image_processing/shape_predictor.h>
+#include <dlib/threads.h>
+#include <stdint.h>
+#include <vector>
+
+/* side of the grid of luma means a face is summed up by */
+#define LANDMARK_SIG_SIZE 8
+
+/**
+ * @brief Finds the landmarks of the faces of a stream of preview frames,
+ *        running the shape predictor only on the faces that moved.
+ * @details Every face is matched with the face of the frame before that
+ *          overlaps it most.  Two cheap cues tell whether it moved since the
+ *          shape predictor last ran on it: how far its rectangle went, and how
+ *          much the luma inside its last rectangle changed, measured on a
+ *          LANDMARK_SIG_SIZE x LANDMARK_SIG_SIZE grid of means.  When both are
+ *          under their thresholds, the last landmarks are kept instead, but
+ *          never for more than max_stale_frames frames in a row.
+ *
+ *          The landmarks of each face are followed by a constant velocity
+ *          filter: a shape predictor result is only partly taken in, the rest
+ *          coming from the landmarks before moved on at their velocity, which
+ *          takes most of the jitter out.  A face found still loses its
+ *          velocity, and a face that moved a lot takes the new landmarks as
+ *          they are, so the filter neither overshoots nor lags behind.
+ * @remarks An object must not be used by two threads at once.
+ */
+class landmark_tracker {
+public:
+	landmark_tracker();
+
+	/**
+	 * @brief Sets the shape predictor, which must outlive the tracker or be
+	 *        replaced first, and forgets the faces seen so far.
+	 */
+	void set_predictor(const dlib::shape_predictor *sp);
+
+	/**
+	 * @brief Sets the most frames in a row the landmarks of a face may be
+	 *        kept for (default: 4), 0 to run the shape predictor on
+	 *        every frame.
+	 */
+	void set_max_stale_frames(int frames);
+
+	/**
+	 * @brief Sets how far a face may move, as a part of its size, and how much
+	 *        the mean luma of its grid may change, in levels, without the shape
+	 *        predictor running on it (defaults: 0.03 and 3).
+	 */
+	void set_motion_thresholds(double move, double luma);
+
+	/**
+	 * @brief Sets the pool the shape predictor spreads several faces over,
+	 *        NULL for none (the default).
+	 */
+	void set_thread_pool(dlib::thread_pool *tp);
+
+	/**
+	 * @brief Forgets the faces seen so far, so the shape predictor runs on
+	 *        all the faces of the next frame.
+	 */
+	void reset();
+
+	/**
+	 * @brief Finds the landmarks of the faces of the next frame.
+	 *
+	 * @param img    The frame
+	 * @param faces  Its faces
+	 *
+	 * @return The landmarks of each face, in the order of faces.  The vector
+	 *         is only valid until the next call.
+	 */
+	const std::vector<dlib::full_object_detection>& update(
+			const preview_luma_image& img,
+			const std::vector<dlib::rectangle>& faces);
+
+	void reset_stats();
+
+	uint64_t total_ns; /* time spent since the last reset_stats() */
+	uint64_t frames; /* frames since the last reset_stats() */
+	uint64_t shapes; /* landmarks returned since the last reset_stats() */
+	uint64_t predictions; /* of those, the ones the shape predictor found */
+
+private:
+	struct track {
+		track() :
+				stale(0) {
+		}
+
+		dlib::rectangle rect; /* face the shape predictor last ran on */
+		unsigned char sig[LANDMARK_SIG_SIZE * LANDMARK_SIG_SIZE]; /* luma grid of rect then */
+		std::vector<dlib::dpoint> pos; /* filtered landmarks then */
+		std::vector<dlib::dpoint> vel; /* their velocity, per frame */
+		int stale; /* frames since then */
+	};
+
+	void _match_tracks(const std::vector<dlib::rectangle>& faces);
+	bool _moved(const preview_luma_image& img, const dlib::rectangle& face,
+			const track& t) const;
+	void _take_shape(const preview_luma_image& img, const dlib::rectangle& face,
+			const dlib::full_object_detection& det, track& t);
+
+	const dlib::shape_predictor *sp;
+	dlib::shape_predictor_workspace sp_ws;
+	dlib::thread_pool *pool;
+	std::vector<track> tracks; /* one per face of the last frame */
+	std::vector<track> next; /* tracks matched with the faces of this frame */
+	std::vector<bool> fresh; /* the track of a face is new */
+	std::vector<dlib::rectangle> run_rects; /* faces the shape predictor runs on */
+	std::vector<size_t> run_faces; /* and their index in faces */
+	std::vector<dlib::full_object_detection> dets; /* what it finds */
+	std::vector<dlib::full_object_detection> result;
+	int max_stale_frames;
+	double move_threshold;
+	double luma_threshold;
+};
+
+#endif
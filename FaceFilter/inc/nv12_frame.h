@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_NV12_FRAME_H)
+#define _NV12_FRAME_H
+
+#include <stddef.h>
+
+/**
+ * @brief The planes of an NV12 image.
+ * @details This is all the filter code needs to know about a frame, so it
+ *          works the same on camera preview frames (see preview_image.h)
+ *          and on frames read from a file on a desktop machine.
+ */
+struct nv12_frame {
+	unsigned char *y; /* luma, height rows */
+	unsigned char *uv; /* interleaved Cb/Cr at half resolution, height/2 rows */
+	long width; /* pixels (and bytes) in a row of either plane */
+	long height;
+	long stride; /* bytes between the starts of two rows, in both planes */
+
+	nv12_frame() :
+			y(NULL), uv(NULL), width(0), height(0), stride(0) {
+	}
+
+	nv12_frame(unsigned char *y_, unsigned char *uv_, long width_,
+			long height_, long stride_) :
+			y(y_), uv(uv_), width(width_), height(height_), stride(stride_) {
+	}
+
+	size_t y_size() const {
+		return (size_t) (stride * height);
+	}
+	size_t uv_size() const {
+		return (size_t) (stride * (height / 2));
+	}
+};
+
+/*
+ * Clockwise rotation between a frame and the way it is looked at, e.g.
+ * through a preview_luma_image.  The landmark code works on frames rotated by
+ * PREVIEW_ROTATION_90, because the sensor is mounted sideways.
+ */
+typedef enum {
+	PREVIEW_ROTATION_0,
+	PREVIEW_ROTATION_90,
+	PREVIEW_ROTATION_180,
+	PREVIEW_ROTATION_270
+} preview_rotation_e;
+
+#endif
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_PHOTO_QUEUE_H)
+#define _PHOTO_QUEUE_H
+
+#include "nv12_frame.h"
+#include <dlib/image_processing/shape_predictor.h>
+#include <dlib/pipe.h>
+#include <dlib/threads.h>
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief What became of a photo, given to the photo_queue saved callback.
+ */
+struct photo_result {
+	std::string path; /* the file the photo was written to */
+	bool ok; /* false if it could not be written */
+	bool processed; /* false if it was written as captured */
+	int faces; /* faces the stickers were drawn on */
+	uint64_t wait_ns; /* time from push() to the start of the processing */
+	uint64_t process_ns; /* decoding, landmarks, filters and stickers */
+	uint64_t write_ns; /* encoding and writing */
+};
+
+/**
+ * @brief Applies the filter and the sticker of the preview to captured
+ *        photos and saves them, on threads of its own.
+ * @details push() copies the JPEG the camera captured into one of a fixed
+ *          number of jobs and returns at once; when every job is taken, the
+ *          photo is refused rather than waited for.  A processing thread
+ *          decodes the photo, finds its faces in a scaled down luma decode,
+ *          runs the shape predictor on them at full resolution, and applies
+ *          the filter preset and the sticker in NV12 like the preview does.
+ *          The photo is then turned upright and handed to a writing thread,
+ *          which encodes it and writes it, so the next photo is processed
+ *          while the last one is written.  A photo with neither a filter nor
+ *          a sticker is written as captured.
+ *
+ *          The processing thread spreads nothing over a thread pool, so the
+ *          preview keeps the other cores to itself.
+ * @remarks push() must only be called from one thread at a time.  The shape
+ *          predictor must not change while photos with a sticker are queued.
+ *          The app and dlib must be built with DLIB_JPEG_SUPPORT; without it
+ *          every photo is written as captured, which the first push() logs.
+ */
+class photo_queue {
+public:
+	/**
+	 * @brief Called on the writing thread once a photo is written, or could
+	 *        not be.
+	 */
+	typedef void (*saved_cb)(const photo_result& result);
+
+	/**
+	 * @param size      The most photos waiting to be processed or written
+	 * @param rotation  How the captured photos are turned to be upright, like
+	 *                  the view the preview landmarks are found in
+	 */
+	photo_queue(size_t size, preview_rotation_e rotation);
+	~photo_queue();
+
+	/**
+	 * @brief Sets the directory the sticker images are loaded from, see
+	 *        load_stickers().  Must be called before the first push().
+	 */
+	void set_resource_dir(const char *dir);
+
+	/**
+	 * @brief Sets the shape predictor, which must outlive the queue.
+	 */
+	void set_predictor(const dlib::shape_predictor *sp);
+
+	void set_saved_cb(saved_cb cb);
+
+	/**
+	 * @brief Queues a captured photo.  Never blocks.
+	 *
+	 * @param jpeg     The JPEG, copied before push() returns
+	 * @param size     Its size in bytes
+	 * @param path     The file to write the photo to
+	 * @param filter   The filter preset, see filter_preset_chain()
+	 * @param sticker  The sticker, one of sticker_e
+	 *
+	 * @return false if the photo was refused because the queue is full
+	 */
+	bool push(const unsigned char *jpeg, size_t size, const char *path,
+			int filter, int sticker);
+
+	/**
+	 * @brief Waits for the photos queued so far to be written and ends the
+	 *        threads.  The next push() starts them again.
+	 */
+	void stop();
+
+private:
+	struct job;
+	struct processor;
+
+	static void _process_thread(photo_queue *q);
+	static void _write_thread(photo_queue *q);
+	bool _process(job& j, processor& p);
+	void _write(job& j);
+
+	const size_t size;
+	const preview_rotation_e rotation;
+	std::string resource_dir;
+	const dlib::shape_predictor *sp;
+	saved_cb cb;
+
+	std::vector<std::unique_ptr<job> > jobs;
+	dlib::pipe<job*> free_jobs; /* jobs push() may fill */
+	dlib::pipe<job*> to_process; /* filled by push(), NULL to stop */
+	dlib::pipe<job*> to_write; /* processed, NULL to stop */
+	std::unique_ptr<dlib::thread_function> process_thread;
+	std::unique_ptr<dlib::thread_function> write_thread;
+};
+
+#endif
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_PREVIEW_IMAGE_H)
+#define _PREVIEW_IMAGE_H
+
+/*
+ * Desktop tools define PREVIEW_IMAGE_NO_CAMERA to use preview_luma_image on
+ * their own buffers, without the Tizen camera API.
+ */
+#if !defined(PREVIEW_IMAGE_NO_CAMERA)
+#include <camera.h>
+#endif
+#include "nv12_frame.h"
+#include <dlib/geometry/rectangle.h>
+#include <dlib/image_processing/generic_image.h>
+#include <dlib/pixel.h>
+#include <utility>
+
+#if !defined(PREVIEW_IMAGE_NO_CAMERA)
+/**
+ * @brief Returns the row stride of an NV12 preview frame.
+ * @remarks The planes may be padded at the end of every row; the Y and UV
+ *          planes share the same stride.
+ */
+inline long preview_stride(const camera_preview_data_s *frame) {
+	if (frame->height > 0
+			&& frame->data.double_plane.y_size
+					>= (unsigned int) (frame->width * frame->height))
+		return frame->data.double_plane.y_size / frame->height;
+	return frame->width;
+}
+
+/**
+ * @brief Returns the planes of an NV12 preview frame.
+ */
+inline nv12_frame preview_nv12_frame(camera_preview_data_s *frame) {
+	return nv12_frame(frame->data.double_plane.y, frame->data.double_plane.uv,
+			frame->width, frame->height, preview_stride(frame));
+}
+#endif
+
+/**
+ * @brief Read-only dlib image over the Y plane of an NV12 preview frame.
+ * @details No pixel is copied: the rotation and the row stride of the camera
+ *          buffer are folded into a signed (row step, column step) pair, so
+ *          dlib::const_image_view reads the camera memory directly.
+ * @remarks Pixels of a rotated view are not contiguous along a row, so the
+ *          image must only be read through dlib::const_image_view (which is
+ *          what shape_predictor does).  It must not outlive the frame.
+ */
+struct preview_luma_image {
+	const unsigned char *origin; /* pixel at row 0, column 0 of the view */
+	long row_step; /* byte offset between two consecutive rows */
+	long col_step; /* byte offset between two consecutive columns */
+	long rows;
+	long cols;
+
+	preview_luma_image() :
+			origin(NULL), row_step(0), col_step(0), rows(0), cols(0) {
+	}
+
+	preview_luma_image(const unsigned char *y, int width, int height,
+			long stride, preview_rotation_e rotation) {
+		set(y, width, height, stride, rotation);
+	}
+
+#if !defined(PREVIEW_IMAGE_NO_CAMERA)
+	preview_luma_image(const camera_preview_data_s *frame,
+			preview_rotation_e rotation) {
+		set(frame->data.double_plane.y, frame->width, frame->height,
+				preview_stride(frame), rotation);
+	}
+#endif
+
+	void set(const unsigned char *y, int width, int height, long stride,
+			preview_rotation_e rotation) {
+		switch (rotation) {
+		case PREVIEW_ROTATION_90:
+			origin = y + (height - 1) * stride;
+			row_step = 1;
+			col_step = -stride;
+			rows = width;
+			cols = height;
+			break;
+		case PREVIEW_ROTATION_180:
+			origin = y + (height - 1) * stride + (width - 1);
+			row_step = -stride;
+			col_step = -1;
+			rows = height;
+			cols = width;
+			break;
+		case PREVIEW_ROTATION_270:
+			origin = y + (width - 1);
+			row_step = -1;
+			col_step = stride;
+			rows = width;
+			cols = height;
+			break;
+		default:
+			origin = y;
+			row_step = stride;
+			col_step = 1;
+			rows = height;
+			cols = width;
+			break;
+		}
+	}
+
+	long nr() const {
+		return rows;
+	}
+	long nc() const {
+		return cols;
+	}
+
+	/**
+	 * @brief Returns the view of a rectangle of this view, which must lie
+	 *        inside it.  No pixel is copied.
+	 */
+	preview_luma_image crop(const dlib::rectangle& rect) const {
+		preview_luma_image img(*this);
+		img.origin += rect.top() * row_step + rect.left() * col_step;
+		img.rows = rect.height();
+		img.cols = rect.width();
+		return img;
+	}
+};
+
+/* generic image interface, see dlib/image_processing/generic_image.h */
+inline long num_rows(const preview_luma_image& img) {
+	return img.rows;
+}
+inline long num_columns(const preview_luma_image& img) {
+	return img.cols;
+}
+inline const void* image_data(const preview_luma_image& img) {
+	return img.origin;
+}
+inline long width_step(const preview_luma_image& img) {
+	return img.row_step;
+}
+inline void swap(preview_luma_image& a, preview_luma_image& b) {
+	std::swap(a, b);
+}
+
+namespace dlib {
+
+template<>
+struct image_traits<preview_luma_image> {
+	typedef unsigned char pixel_type;
+};
+
+/*
+ * const_image_view normally assumes unit column stride.  This specialization
+ * applies the column step too, which is what makes rotated views possible.
+ */
+template<>
+class const_image_view<preview_luma_image> {
+public:
+	typedef unsigned char pixel_type;
+
+	struct pix_row {
+		pix_row(const unsigned char *data_, long col_step_) :
+				data(data_), col_step(col_step_) {
+		}
+		const unsigned char& operator[](long col) const {
+			return data[col * col_step];
+		}
+	private:
+		const unsigned char * const data;
+		const long col_step;
+	};
+
+	const_image_view(const preview_luma_image& img) :
+			_data(img.origin), _row_step(img.row_step), _col_step(img.col_step),
+			_nr(img.rows), _nc(img.cols) {
+	}
+
+	long nr() const {
+		return _nr;
+	}
+	long nc() const {
+		return _nc;
+	}
+	unsigned long size() const {
+		return static_cast<unsigned long>(nr() * nc());
+	}
+
+	const pix_row operator[](long row) const {
+		DLIB_ASSERT(0 <= row && row < _nr,
+				"\t The given row index is out of range."
+				<< "\n\t row: " << row
+				<< "\n\t _nr: " << _nr);
+		return pix_row(_data + _row_step * row, _col_step);
+	}
+
+private:
+	const unsigned char *_data;
+	long _row_step;
+	long _col_step;
+	long _nr;
+	long _nc;
+};
+
+/* the columns of a rotated view are not next to each other in memory */
+template<>
+struct has_contiguous_rows<const_image_view<preview_luma_image> > {
+	const static bool value = false;
+};
+
+}
+
+#endif
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_STICKER_H)
+#define _STICKER_H
+
+#include "nv12_frame.h"
+#include <dlib/array2d.h>
+#include <dlib/pixel.h>
+#include <dlib/geometry/vector.h>
+#include <stdint.h>
+#include <map>
+#include <vector>
+
+/* sizes of one sticker kept by a sticker_cache */
+#define STICKER_MAX_SIZES 24
+
+/**
+ * @brief A sticker at one size, ready to be blended into NV12 frames.
+ * @details The pixels are already turned to the orientation of the frame,
+ *          converted to BT.601 video range YCbCr and premultiplied by alpha.
+ *          The chroma is subsampled 2x2 like NV12, with the alpha of each
+ *          chroma sample stored next to both its Cb and Cr byte, so the Y and
+ *          the UV rows are blended by the same kernel.
+ */
+struct sticker_bitmap {
+	long width; /* pixels in a row, always even */
+	long height; /* rows, always even */
+	std::vector<unsigned char> y; /* premultiplied luma, width x height */
+	std::vector<unsigned char> a; /* alpha of the luma, width x height */
+	std::vector<unsigned char> uv; /* premultiplied Cb/Cr, width x height/2 */
+	std::vector<unsigned char> uv_a; /* alpha of the chroma, same layout as uv */
+	uint64_t last_used; /* for the eviction of unused sizes */
+};
+
+/**
+ * @brief Blends a sticker bitmap into a frame.
+ * @details Every byte becomes p + d * (255 - a) / 255 (in 8-bit fixed
+ *          point), where p is the premultiplied sticker value, a its alpha
+ *          and d the frame byte.  The bitmap is clipped against the edges of
+ *          the frame, so it may hang over any of them.  The rows use NEON or
+ *          SSE2 when the compiler targets them.
+ *
+ * @param frame  The frame
+ * @param bm     The sticker
+ * @param x      The frame column of the left edge of the sticker; rounded
+ *               down to an even column to line up with the chroma
+ * @param y      The frame row of the top edge of the sticker; rounded down to
+ *               an even row
+ */
+void sticker_blend(const nv12_frame& frame, const sticker_bitmap& bm, long x,
+		long y);
+
+/**
+ * @brief Decoded stickers and the sizes they have been drawn at.
+ * @details Each sticker is decoded once into premultiplied RGBA, together with
+ *          a chain of mip levels that halve its size down to a few pixels.
+ *          Sizes are asked for in the coordinates of the rotated view the
+ *          landmarks are found in, and quantized to steps of 1/16 octave
+ *          (about 4%).  The first time a step is drawn, its bitmap is
+ *          resampled from the nearest larger mip level and kept, so after that
+ *          drawing a sticker is a map lookup and a blend.  At most
+ *          STICKER_MAX_SIZES sizes are kept per sticker; the one unused the
+ *          longest goes first.
+ * @remarks An object must not be used by two threads at once.
+ */
+class sticker_cache {
+public:
+	/**
+	 * @param rotation  How the frames the stickers are drawn into are turned
+	 *                  to get the view the positions and sizes are given in
+	 */
+	explicit sticker_cache(preview_rotation_e rotation);
+
+	/**
+	 * @brief Decodes a PNG file and adds it to the cache.
+	 * @remarks dlib must be built with DLIB_PNG_SUPPORT; without it every
+	 *          load fails.
+	 *
+	 * @return The id of the sticker, or -1 if the file could not be decoded
+	 */
+	int load(const char *path);
+
+	/**
+	 * @brief Adds an already decoded, non-premultiplied image to the cache.
+	 *
+	 * @return The id of the sticker, or -1 if the image is empty
+	 */
+	int add(const dlib::array2d<dlib::rgb_alpha_pixel>& img);
+
+	/**
+	 * @brief Returns the height over the width of a sticker, in the view.
+	 */
+	double aspect(int id) const;
+
+	/**
+	 * @brief Returns the bitmap of a sticker at a given width in the view,
+	 *        resampling it the first time that size is asked for.
+	 */
+	const sticker_bitmap& get(int id, double width);
+
+	/**
+	 * @brief Draws a sticker centered on a point of the view.
+	 *
+	 * @param frame   The frame
+	 * @param id      The sticker
+	 * @param center  The center of the sticker, in view coordinates
+	 * @param width   The width of the sticker in the view
+	 */
+	void draw(const nv12_frame& frame, int id, const dlib::dpoint& center,
+			double width);
+
+	size_t size() const {
+		return stickers.size();
+	}
+
+	void clear();
+
+private:
+	/* premultiplied RGBA, 4 bytes a pixel */
+	struct rgba_image {
+		long nc;
+		long nr;
+		std::vector<unsigned char> px;
+	};
+
+	struct sticker {
+		std::vector<rgba_image> mips; /* mips[0] is the decoded image */
+		std::map<int, sticker_bitmap> sizes; /* by quantization step */
+	};
+
+	void _build(const sticker& s, long width, long height,
+			sticker_bitmap& bm);
+
+	preview_rotation_e rotation;
+	std::vector<sticker> stickers;
+	uint64_t uses; /* counts calls to get() */
+	rgba_image scaled; /* scratch for _build() */
+};
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_YUV_CONVOLVE_H)
+#define _YUV_CONVOLVE_H
+
+#include "nv12_frame.h"
+#include <dlib/threads.h>
+#include <vector>
+
+/**
+ * @brief 3x3 neighbourhood filters for the planes of NV12 preview frames.
+ * @details The Gaussian blur runs as two separable 8-bit fixed-point passes
+ *          (weights 27/202/27 out of 256).  The emboss uses the integer
+ *          kernel
+ *              2  1  0
+ *              1  1 -1
+ *              0 -1 -2
+ *          and clamps the result to 0..255.  Pixels outside the plane count
+ *          as 0.  Each pass runs the branch-free interior with NEON or SSE2
+ *          where available, does the border rows and columns separately, and
+ *          spreads the rows over the threads of the given pool.
+ * @remarks One intermediate plane is kept between frames, so after the first
+ *          frame no memory is allocated.  An object must not be used by two
+ *          threads at once.
+ */
+class yuv_convolver {
+public:
+	explicit yuv_convolver(dlib::thread_pool& tp);
+
+	/**
+	 * @brief Blurs a plane in place.
+	 *
+	 * @param plane   The first byte of the plane
+	 * @param width   The number of bytes in a row
+	 * @param height  The number of rows
+	 * @param stride  The distance in bytes between two rows
+	 * @param step    The distance in bytes between two horizontally
+	 *                neighbouring samples: 1 for Y, 2 for interleaved UV
+	 */
+	void gaussian(unsigned char *plane, long width, long height, long stride,
+			int step);
+
+	/**
+	 * @brief Embosses a plane in place.  The parameters are the same as
+	 *        for gaussian().
+	 */
+	void emboss(unsigned char *plane, long width, long height, long stride,
+			int step);
+
+	/**
+	 * @brief Blurs both planes of an NV12 frame.
+	 */
+	void gaussian(const nv12_frame& frame);
+
+	/**
+	 * @brief Embosses both planes of an NV12 frame.
+	 */
+	void emboss(const nv12_frame& frame);
+
+private:
+	void _reserve(long width, long height);
+
+	dlib::thread_pool& tp;
+	std::vector<unsigned char> buf; /* intermediate plane, width x height */
+	std::vector<unsigned char> zero_row; /* stands in for rows outside the plane */
+};
+
+#endif
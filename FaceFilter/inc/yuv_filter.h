@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_YUV_FILTER_H)
+#define _YUV_FILTER_H
+
+#include <stddef.h>
+
+/*
+ * Per-pixel colour filters for NV12 planes.  Every filter works in place on
+ * whole planes: the Y plane, and the UV plane where even bytes are Cb and odd
+ * bytes are Cr.  The kernels use NEON or SSE2 when the compiler targets them
+ * and plain C otherwise; all paths give the same bytes.  They are what the
+ * point stages of filter_pipeline.h run.
+ */
+
+/**
+ * @brief Replaces every byte of the plane with 255 minus its value.
+ *
+ * @param data  The plane
+ * @param size  The number of bytes in the plane
+ */
+void yuv_filter_invert(unsigned char *data, size_t size);
+
+/**
+ * @brief Rewrites the chroma of an interleaved UV plane.
+ * @details Every Cb byte becomes (Cb & cb_mask) | cb and every Cr byte
+ *          becomes (Cr & cr_mask) | cr, so a mask of 0 replaces the channel
+ *          and a mask of 0xff with a value of 0 keeps it.
+ *
+ * @param uv       The interleaved UV plane, starting with a Cb byte
+ * @param size     The number of bytes in the plane
+ * @param cb_mask  The mask applied to Cb
+ * @param cr_mask  The mask applied to Cr
+ * @param cb       The bits set in Cb
+ * @param cr       The bits set in Cr
+ */
+void yuv_filter_chroma(unsigned char *uv, size_t size, unsigned char cb_mask,
+		unsigned char cr_mask, unsigned char cb, unsigned char cr);
+
+/**
+ * @brief Multiplies by 1.2 the bytes of the plane that are below 128.
+ *
+ * @param data  The plane, usually Y
+ * @param size  The number of bytes in the plane
+ */
+void yuv_filter_boost_dark(unsigned char *data, size_t size);
+
+/**
+ * @brief Multiplies by 1.2 the bytes of the plane that hold an even value.
+ * @remarks Results above 255 are clamped to 255.
+ *
+ * @param data  The plane, usually UV
+ * @param size  The number of bytes in the plane
+ */
+void yuv_filter_boost_even(unsigned char *data, size_t size);
+
+#endif
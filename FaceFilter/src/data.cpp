@@ -17,11 +17,19 @@
 #include "main.h"
 #include "data.h"
 #include "landmark.h"
+#include "preview_image.h"
+#include "filter_pipeline.h"
+#include "face_tracker.h"
+#include "landmark_tracker.h"
+#include "photo_queue.h"
 
 typedef struct _camdata {
 	camera_h g_camera; /* Camera handle */
 	std::vector<dlib::rectangle> faces; /* detected faces */
+	bool track_faces; /* the camera can't detect faces, the tracker finds them */
+	face_tracker tracker; /* finds the faces when track_faces is set */
 	dlib::shape_predictor sp; /* shape predictor */
+	landmark_tracker landmarks; /* runs sp on the faces that moved */
 
 	Evas_Object *cam_display;
 	Evas_Object *cam_display_box;
@@ -33,14 +41,19 @@ typedef struct _camdata {
 
 	Evas_Object *filter_bt;
 	Evas_Object *sticker_bt;bool cam_prev;
-	int filter;
-	int sticker;
+	int filter; /* filter preset, see filter_preset_chain() */
+	int pipeline_filter; /* the preset pipeline was last built for */
+	filter_pipeline pipeline; /* filters applied to every preview frame */
+	int sticker; /* see sticker_e */
+	bool stickers_loaded;
 	int width;
 	int height;
 	int count;
 } camdata;
 
 static camdata cam_data;
+/* filters, stickers and saves the captured photos, see _camera_capturing_cb() */
+static photo_queue photos(PHOTO_QUEUE_SIZE, PREVIEW_ROTATION_90);
 //static rgbmat rgb_frame;
 
 static char *camera_directory = NULL;
@@ -214,6 +227,41 @@ static void _image_saved(void *data) {
 	free(data);
 }
 
+/**
+ * @brief Called when the image could not be saved.
+ * @remarks This function matches the Ecore_Cb() signature defined in the
+ *          Ecore_Legacy.h header file.
+ *
+ * @param data  The path the image was to be stored to
+ */
+static void _image_not_saved(void *data) {
+	PRINT_MSG("Could not store the image in the %s", (char * ) data);
+	free(data);
+}
+
+/**
+ * @brief Called by the photo queue, on its writing thread, once a photo is
+ *        written or could not be.  The message is shown from the main loop.
+ *
+ * @param result  What became of the photo
+ */
+static void _photo_saved(const photo_result& result) {
+	dlog_print(DLOG_DEBUG, LOG_TAG, "photo %s: %s, %d faces, waited %llu us,"
+			" processed in %llu us, written in %llu us", result.path.c_str(),
+			result.processed ? "processed" : "as captured", result.faces,
+			(unsigned long long) (result.wait_ns / 1000),
+			(unsigned long long) (result.process_ns / 1000),
+			(unsigned long long) (result.write_ns / 1000));
+	if (!result.ok)
+		dlog_print(DLOG_ERROR, LOG_TAG, "Could not write %s",
+				result.path.c_str());
+
+	char *file_path = strdup(result.path.c_str());
+	if (file_path != NULL)
+		ecore_job_add(result.ok ? _image_saved : _image_not_saved,
+				(void *) file_path);
+}
+
 /**
  * @brief Called to get information about image data taken by the camera
  *        once per frame while capturing.
@@ -233,24 +281,24 @@ static void _camera_capturing_cb(camera_image_data_s *image,
 		camera_image_data_s *postview, camera_image_data_s *thumbnail,
 		void *user_data) {
 	if (NULL != image && NULL != image->data) {
-		dlog_print(DLOG_DEBUG, LOG_TAG, "Writing image to file.");
+		dlog_print(DLOG_DEBUG, LOG_TAG, "Queueing the image.");
 
-		char *file_path = (char *) malloc(sizeof(char) * BUFLEN);
+		char file_path[BUFLEN];
 
 		/* Create a full path to newly created file for storing the taken photo. */
 		snprintf(file_path, BUFLEN, "%s/cam%d.jpg", camera_directory,
 				(int) time(NULL));
 
-		/* Open the file for writing. */
-		FILE *file = fopen(file_path, "w+");
-
-		/* Write the image to a file. */
-		fwrite(image->data, 1, image->size, file);
-
-		/* Close the file. */
-		fclose(file);
-
-		ecore_job_add(_image_saved, (void *) file_path);
+		/*
+		 * The photo is filtered, given the sticker and written by the photo
+		 * queue, so the camera can go back to the preview at once.
+		 */
+		if (!photos.push((const unsigned char *) image->data, image->size,
+				file_path, cam_data.filter, cam_data.sticker)) {
+			dlog_print(DLOG_ERROR, LOG_TAG,
+					"The photo queue is full, %s is dropped.", file_path);
+			PRINT_MSG("Still saving the last photos, this one is dropped.");
+		}
 	} else {
 		dlog_print(DLOG_ERROR, LOG_TAG,
 				"An error occurred during taking the photo. The image is NULL.");
@@ -511,7 +559,7 @@ static void __camera_cb_preview(void *data, Evas_Object *obj,
  */
 static int camera_attr_get_filter_range(int *min, int *max) {
 	*min = 0;
-	*max = MAX_FILTER;
+	*max = FILTER_PRESET_COUNT - 1;
 	return 0;
 }
 
@@ -533,319 +581,6 @@ static int camera_attr_set_filter(int filter) {
 	return 0;
 }
 
-void _chroma_mod_sepia(unsigned char* data, uint64_t size) {
-	uint64_t i = 0;
-
-	for (i = 0; i < size; i++) {
-		int Cval = (int) (data[i]);
-
-		if (i % 2 == 0) //Even byte reflects Cb chroma value
-				{
-			Cval = 114; //Setting the Cb value to look like sepia
-		} else //Odd byte reflects Cr chroma value
-		{
-			Cval = 144; //Setting the Cr value to look like sepia
-		}
-		data[i] = (unsigned char) Cval;
-	}
-}
-
-void _grayscale_mod(unsigned char* data, uint64_t size) {
-	uint64_t i = 0;
-	for (i = 0; i < size; i++) {
-		data[i] = 128;
-	}
-}
-
-void _invert_mod(unsigned char* data, uint64_t size) {
-	uint_fast64_t i = 0; // can't find difference between uint64 vs fast64
-	for (i = 0; i < size; i++) {
-		data[i] = 255 - data[i];
-	}
-}
-
-void _nored_mod(unsigned char* data, uint64_t size) {
-	uint_fast64_t i = 0; // can't find difference between uint64 vs fast64
-	for (i = 0; i < size; i++) {
-		if (i % 2 == 1)
-			data[i] = 128;
-	}
-}
-
-void _noblue_mod(unsigned char* data, uint64_t size) {
-	uint_fast64_t i = 0; // can't find difference between uint64 vs fast64
-	for (i = 0; i < size; i++) {
-		if (i % 2 == 0)
-			data[i] = 128;
-	}
-}
-
-void _emboss_mod(unsigned char* data, uint64_t size) {
-	uint64_t x = 0;
-	uint64_t w = (uint64_t) cam_data.width;
-	float mask[9] = { -2.0f, -1.0f, 0.0f, -1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 2.0f };
-
-	unsigned char* ndata;
-	ndata = (unsigned char*) malloc(sizeof(unsigned char) * size);
-
-	for (x = 0; x < size; x++) {
-		float val[9] = { 0, };
-		if (x < w + 1)
-			val[0] = 0;
-		else
-			val[0] = data[x - w - 1] * mask[8];
-
-		if (x < w)
-			val[1] = 0;
-		else
-			val[1] = data[x - w] * mask[7];
-
-		if (x < w - 1)
-			val[2] = 0;
-		else
-			val[2] = data[x - w + 1] * mask[6];
-
-		if (x < 1)
-			val[3] = 0;
-		else
-			val[3] = data[x - 1] * mask[5];
-
-		val[4] = data[x] * mask[4];
-
-		if (x + 1 > size)
-			val[5] = 0;
-		else
-			val[5] = data[x + 1] * mask[3];
-
-		if (x + w - 1 > size)
-			val[6] = 0;
-		else
-			val[6] = data[x + w - 1] * mask[2];
-
-		if (x + w > size)
-			val[7] = 0;
-		else
-			val[7] = data[x + w] * mask[1];
-
-		if (x + w + 1 > size)
-			val[8] = 0;
-		else
-			val[8] = data[x + w + 1] * mask[0];
-
-		float sum = 0;
-		for (int i = 0; i < 9; i++)
-			sum += val[i];
-
-		ndata[x] = (unsigned char) sum;
-		//ndata[x] =(unsigned char) (sum/8);
-	}
-	memcpy(data, ndata, sizeof(unsigned char) * size);
-}
-void _emboss_mod_uv(unsigned char* data, uint64_t size) {
-	uint64_t x = 0;
-	uint64_t w = (uint64_t) cam_data.width;
-	float mask[9] = { -2.0f, -1.0f, 0.0f, -1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 2.0f };
-
-	unsigned char* ndata;
-	ndata = (unsigned char*) malloc(sizeof(unsigned char) * size);
-
-	for (x = 0; x < size; x++) {
-		float val[9] = { 0, };
-		if (x < w + 2)
-			val[0] = 0;
-		else
-			val[0] = data[x - w - 2] * mask[8];
-
-		if (x < w)
-			val[1] = 0;
-		else
-			val[1] = data[x - w] * mask[7];
-
-		if (x < w - 2)
-			val[2] = 0;
-		else
-			val[2] = data[x - w + 2] * mask[6];
-
-		if (x < 2)
-			val[3] = 0;
-		else
-			val[3] = data[x - 2] * mask[5];
-
-		val[4] = data[x] * mask[4];
-
-		if (x + 2 > size)
-			val[5] = 0;
-		else
-			val[5] = data[x + 2] * mask[3];
-
-		if (x + w - 2 > size)
-			val[6] = 0;
-		else
-			val[6] = data[x + w - 2] * mask[2];
-
-		if (x + w > size)
-			val[7] = 0;
-		else
-			val[7] = data[x + w] * mask[1];
-
-		if (x + w + 2 > size)
-			val[8] = 0;
-		else
-			val[8] = data[x + w + 2] * mask[0];
-
-		float sum = 0;
-		for (int i = 0; i < 9; i++)
-			sum += val[i];
-
-		ndata[x] = (unsigned char) sum;
-		//ndata[x] =(unsigned char) (sum/8);
-	}
-	memcpy(data, ndata, sizeof(unsigned char) * size);
-}
-
-void _gaussian_mod(unsigned char* data, uint64_t size) {
-	uint64_t x = 0;
-	uint64_t w = (uint64_t) cam_data.width;
-//	float xmask[5] = {.0003, .1065, .7866, .1065, .0003};
-	float mask[9] = { .0113, .0838, .0113, .0838, .6193, .0838, .0113, .0838,
-			.0113 };
-
-	unsigned char* ndata;
-	ndata = (unsigned char*) malloc(sizeof(unsigned char) * size);
-
-	for (x = 0; x < size; x++) {
-		float val[9] = { 0, };
-		if (x < w + 1)
-			val[0] = 0;
-		else
-			val[0] = data[x - w - 1] * mask[8];
-
-		if (x < w)
-			val[1] = 0;
-		else
-			val[1] = data[x - w] * mask[7];
-
-		if (x < w - 1)
-			val[2] = 0;
-		else
-			val[2] = data[x - w + 1] * mask[6];
-
-		if (x < 1)
-			val[3] = 0;
-		else
-			val[3] = data[x - 1] * mask[5];
-
-		val[4] = data[x] * mask[4];
-
-		if (x + 1 > size)
-			val[5] = 0;
-		else
-			val[5] = data[x + 1] * mask[3];
-
-		if (x + w - 1 > size)
-			val[6] = 0;
-		else
-			val[6] = data[x + w - 1] * mask[2];
-
-		if (x + w > size)
-			val[7] = 0;
-		else
-			val[7] = data[x + w] * mask[1];
-
-		if (x + w + 1 > size)
-			val[8] = 0;
-		else
-			val[8] = data[x + w + 1] * mask[0];
-
-		float sum = 0;
-		for (int i = 0; i < 8; i++)
-			sum += val[i];
-
-		ndata[x] = (unsigned char) sum;
-		//ndata[x] =(unsigned char) (sum/8);
-	}
-	memcpy(data, ndata, sizeof(unsigned char) * size);
-}
-
-void _gaussian_mod_uv(unsigned char* data, uint64_t size) {
-	uint64_t x = 0;
-	uint64_t w = (uint64_t) cam_data.width;
-	float mask[9] = { .0113, .0838, .0113, .0838, .6193, .0838, .0113, .0838,
-			.0113 };
-
-	unsigned char* ndata = (unsigned char*) malloc(
-			sizeof(unsigned char) * size);
-
-	for (x = 0; x < size; x++) {
-		float val[9] = { 0, };
-		if (x < 8)
-			val[0] = 0;
-		else
-			val[0] = data[x - 8] * mask[8];
-
-		if (x < 6)
-			val[1] = 0;
-		else
-			val[1] = data[x - 6] * mask[7];
-
-		if (x < 4)
-			val[2] = 0;
-		else
-			val[2] = data[x - 4] * mask[6];
-
-		if (x < 2)
-			val[3] = 0;
-		else
-			val[3] = data[x - 2] * mask[5];
-
-		val[4] = data[x] * mask[4];
-
-		if (x + 2 > size)
-			val[5] = 0;
-		else
-			val[5] = data[x + 2] * mask[3];
-
-		if (x + 4 > size)
-			val[6] = 0;
-		else
-			val[6] = data[x + 4] * mask[2];
-
-		if (x + 6 > size)
-			val[7] = 0;
-		else
-			val[7] = data[x + 6] * mask[1];
-
-		if (x + 8 > size)
-			val[8] = 0;
-		else
-			val[8] = data[x + 8] * mask[0];
-
-		float sum = 0;
-		for (int i = 0; i < 8; i++)
-			sum += val[i];
-
-		ndata[x] = (unsigned char) sum;
-	}
-
-	memcpy(data, ndata, sizeof(unsigned char) * size);
-}
-
-void _pinky_mod(unsigned char* data, uint64_t size) {
-	uint_fast64_t i = 0; // can't find difference between uint64 vs fast64
-	for (i = 0; i < size; i++) {
-		if (data[i] < 128)
-			data[i] *= 1.2;
-	}
-}
-
-void _pinky_mod_uv(unsigned char* data, uint64_t size) {
-	uint_fast64_t i = 0; // can't find difference between uint64 vs fast64
-	for (i = 0; i < size; i++) {
-		if (data[i] % 2 == 0)
-			data[i] *= 1.2;
-	}
-}
-
 static void __camera_cb_filter(void *data, Evas_Object *obj, void *event_info) {
 	/*
 	 * Get the minimal and maximal supported value for the camera filter
@@ -881,16 +616,12 @@ static void __camera_cb_filter(void *data, Evas_Object *obj, void *event_info) {
 	} else
 		PRINT_MSG("Filter set to %d", filter);
 
-	/* TODO: Apply filter to preview image */
-	//if (camera_set_preview_cb(cam_data.g_camera, _camera_preview_callback, NULL)
-	//		== CAMERA_ERROR_NONE) {
-	//PRINT_MSG("ready to modify");
-	//}
+	/* _camera_preview_callback() picks up the new preset with the next frame. */
 }
 
 static int camera_attr_get_sticker_range(int* min, int* max) {
-	*min = 1;
-	*max = 5;
+	*min = STICKER_MUSTACHE;
+	*max = STICKER_GLASSES;
 	return 0;
 }
 
@@ -930,56 +661,114 @@ static void _camera_face_detected_cb(camera_detected_face_s* faces, int count,
 	//PRINT_MSG("face format conversion takes %f sec", time);
 }
 
-void face_landmark(camera_preview_data_s *frame, int count)
+const std::vector<dlib::full_object_detection>& face_landmark(
+		camera_preview_data_s *frame, const std::vector<dlib::rectangle>& faces)
 {
-	//clock_t begin;
-	dlib::array2d<u_int64_t> img;
-	img.set_size(frame->width, frame->height);
-	if (frame->data.double_plane.y_size != frame->width * frame->height) {
-		PRINT_MSG("Error: y_size: %d, width: %d, height: %d",
-				frame->data.double_plane.y_size, frame->width, frame->height);
-		//return NULL;
+	/*
+	 * Look at the Y plane through a rotated view instead of copying it into
+	 * an array2d; the copy used to take 0.3 sec per frame on TM1.
+	 */
+	preview_luma_image img(frame, PREVIEW_ROTATION_90);
+
+	// Now we will go ask the shape_predictor to tell us the pose of
+	// each face that moved; the others keep the landmarks of the frames
+	// before.  All the faces go through the cascade together, and group shots
+	// are spread over the default thread pool.
+	const std::vector<dlib::full_object_detection>& shapes =
+			cam_data.landmarks.update(img, faces);
+
+	if (cam_data.landmarks.frames == FILTER_STATS_FRAMES) {
+		dlog_print(DLOG_DEBUG, LOG_TAG,
+				"landmarks: %llu us/frame, %llu of %llu shapes predicted",
+				(unsigned long long) (cam_data.landmarks.total_ns
+						/ cam_data.landmarks.frames / 1000),
+				(unsigned long long) cam_data.landmarks.predictions,
+				(unsigned long long) cam_data.landmarks.shapes);
+		cam_data.landmarks.reset_stats();
 	}
+	return shapes;
+}
 
+/**
+ * @brief Draws the landmarks found by face_landmark() and their stickers.
+ *
+ * @param frame   The preview frame
+ * @param shapes  The landmarks
+ */
+static void _draw_faces(camera_preview_data_s *frame,
+		const std::vector<dlib::full_object_detection>& shapes)
+{
+	for (unsigned long i = 0; i < shapes.size(); ++i) {
+		const dlib::full_object_detection& shape = shapes[i];
 
-	for (int i = 0; i < frame->data.double_plane.y_size; i++) {
-		// img[i % frame->width][ i / frame->width] = (frame->data.double_plane.y)[i];
-		img[i % frame->width][frame->height - i / frame->width-1] = (frame->data.double_plane.y)[i];
+		draw_landmark(frame, shape);
+		draw_sticker(preview_nv12_frame(frame), cam_data.sticker, shape);
 	}
+}
 
-	//float time = (double) (clock() - begin) / CLOCKS_PER_SEC; // TM1: 0.3 sec
-	//PRINT_MSG("frame format conversion takes %f sec", time);
-
-	// Now we will go ask the shape_predictor to tell us the pose of
-	// each face we detected.
-	for (unsigned long i = 0; i < count; ++i) {
-		//begin = clock();
-		dlib::full_object_detection shape = cam_data.sp(img, cam_data.faces[i]);
-		//time = (double) (clock() - begin) / CLOCKS_PER_SEC; // TM1: 0.1 sec
-		//PRINT_MSG("Finding landmark takes %f sec", time);
+/**
+ * @brief Runs the filter pipeline of the current preset over a frame.
+ * @details The pipeline is rebuilt on the camera thread whenever the preset
+ *          chosen with the "Filter" button changes, and its per-stage timing
+ *          is logged every FILTER_STATS_FRAMES frames.
+ *
+ * @param frame  The preview frame
+ */
+static void _filter_frame(camera_preview_data_s *frame) {
+	static int frames = 0;
+
+	int filter = cam_data.filter;
+	if (filter != cam_data.pipeline_filter) {
+		cam_data.pipeline.set_chain(filter_preset_chain(filter),
+				dlib::default_thread_pool());
+		cam_data.pipeline.set_budget_ns(FILTER_BUDGET_NS);
+		cam_data.pipeline_filter = filter;
+		frames = 0;
+	}
+	if (cam_data.pipeline.num_stages() == 0)
+		return;
 
-		draw_landmark(frame, shape);
+	cam_data.pipeline.run(preview_nv12_frame(frame));
+
+	if (++frames == FILTER_STATS_FRAMES) {
+		for (size_t i = 0; i < cam_data.pipeline.num_stages(); i++) {
+			const filter_stage& stage = cam_data.pipeline.stage(i);
+			dlog_print(DLOG_DEBUG, LOG_TAG, "filter %s: %llu us/frame, state %d",
+					stage.name(),
+					stage.frames ?
+							(unsigned long long) (stage.total_ns / stage.frames
+									/ 1000) :
+							0ULL, stage.state);
+		}
+		cam_data.pipeline.reset_stats();
+		frames = 0;
+	}
+}
 
-		 switch(cam_data.sticker) {
-		 case 1:
-		 //sticker_mustache(shape);
-		 break;
-		 case 2:
-		 //sticker_hairband(shape);
-		 break;
-		 case 3:
-		 //sticker_ear(shape);
-		 break;
-		 case 4:
-		 //sticker_hat(shape);
-		 break;
-		 case 5:
-		 //sticker_glasses(shape);
-		 break;
-		 default:
-		 break;
-		 }
+/**
+ * @brief Finds the faces of a frame with the face tracker, for cameras that
+ *        can't detect them, and logs its timing every FILTER_STATS_FRAMES
+ *        frames.
+ *
+ * @param frame  The preview frame
+ *
+ * @return The faces, in the coordinates used by face_landmark()
+ */
+static std::vector<dlib::rectangle> _track_faces(camera_preview_data_s *frame) {
+	const std::vector<dlib::rectangle>& faces = cam_data.tracker.update(
+			preview_luma_image(frame, PREVIEW_ROTATION_90));
+
+	if (cam_data.tracker.frames == FILTER_STATS_FRAMES) {
+		dlog_print(DLOG_DEBUG, LOG_TAG,
+				"face tracker: %llu us/frame, %llu full scans and %llu redetections in %llu frames",
+				(unsigned long long) (cam_data.tracker.total_ns
+						/ cam_data.tracker.frames / 1000),
+				(unsigned long long) cam_data.tracker.full_scans,
+				(unsigned long long) cam_data.tracker.redetections,
+				(unsigned long long) cam_data.tracker.frames);
+		cam_data.tracker.reset_stats();
 	}
+	return faces;
 }
 
 void _camera_preview_callback(camera_preview_data_s *frame, void *user_data) {
@@ -987,31 +776,21 @@ void _camera_preview_callback(camera_preview_data_s *frame, void *user_data) {
 			&& frame->num_of_planes == 2) {
 
 		std::vector<dlib::rectangle> buf =
-				*((std::vector<dlib::rectangle>*) user_data);
+				cam_data.track_faces ?
+						_track_faces(frame) :
+						*((std::vector<dlib::rectangle>*) user_data);
 		size_t count = buf.size();
-		/* get face landmark */
+		/* get face landmark, before the filters change the luma */
+		const std::vector<dlib::full_object_detection> *shapes = NULL;
+		if (count > 0)
+			shapes = &face_landmark(frame, buf);
+		else
+			cam_data.landmarks.reset();
+
+		_filter_frame(frame);
+
 		if (count > 0) {
-			//clock_t sTime = clock();
-			face_landmark(frame, count);
-			//float time = (double) (clock() - sTime) / CLOCKS_PER_SEC; // 0.3 sec in TM1
-			//PRINT_MSG("Face landmark takes %f sec", time);
-
-			switch (cam_data.sticker) {
-			case 0: //
-				break;
-			case 1: // mustache
-				break;
-			case 2: // hat
-				break;
-			case 3: // ear
-				break;
-			case 4: // glasses
-				break;
-			case 5: // hairband
-				break;
-			default:
-				break;
-			}
+			_draw_faces(frame, *shapes);
 
 			//time_t eTime = clock();
 			//float gap = (float) (eTime - sTime) / (CLOCKS_PER_SEC);
@@ -1075,7 +854,12 @@ static void __camera_cb_sticker(void *data, Evas_Object *obj,
 		snprintf(file_path, BUFLEN, "%s%s", resource_path,
 				"shape_predictor_68_face_landmarks.dat");
 
-		dlib::deserialize(file_path) >> cam_data.sp;
+		/*
+		 * The shape predictor is loaded once: the photo queue may be running
+		 * it on a captured photo.
+		 */
+		if (cam_data.sp.num_parts() == 0)
+			dlib::deserialize(file_path) >> cam_data.sp;
 		free(file_path);
 
 		/*
@@ -1095,6 +879,15 @@ static void __camera_cb_sticker(void *data, Evas_Object *obj,
 			PRINT_MSG("Could not stop the camera preview.");
 		}
 
+		/*
+		 * The stickers are decoded once, the first time one is chosen, while
+		 * no preview callback can be drawing them.
+		 */
+		if (!cam_data.stickers_loaded) {
+			load_stickers(resource_path);
+			cam_data.stickers_loaded = true;
+		}
+
 		error_code = camera_start_preview(cam_data.g_camera);
 		if (CAMERA_ERROR_NONE != error_code) {
 			DLOG_PRINT_ERROR("camera_start_preview", error_code);
@@ -1108,6 +901,29 @@ static void __camera_cb_sticker(void *data, Evas_Object *obj,
 		}
 	}
 
+	/*
+	 * Without face detection in the camera, the faces are found in the
+	 * preview frames by the face tracker.  It is set up here, before the
+	 * preview callback can use it.
+	 */
+	cam_data.track_faces = !camera_is_supported_face_detection(
+			cam_data.g_camera);
+	if (cam_data.track_faces) {
+		if (!cam_data.tracker.has_detector()) {
+			cam_data.tracker.set_detector(dlib::get_frontal_face_detector());
+			cam_data.tracker.set_budget_ns(FACE_BUDGET_NS);
+			cam_data.tracker.set_full_scan_interval(FACE_FULL_SCAN_FRAMES);
+			cam_data.tracker.set_thread_pool(&dlib::default_thread_pool());
+		}
+		cam_data.tracker.reset();
+		cam_data.tracker.reset_stats();
+	}
+
+	cam_data.landmarks.set_predictor(&cam_data.sp);
+	cam_data.landmarks.set_max_stale_frames(LANDMARK_MAX_STALE_FRAMES);
+	cam_data.landmarks.set_thread_pool(&dlib::default_thread_pool());
+	cam_data.landmarks.reset_stats();
+
 	error_code = camera_set_preview_cb(cam_data.g_camera,
 			_camera_preview_callback, &cam_data.faces);
 	if (CAMERA_ERROR_NONE != error_code) {
@@ -1120,6 +936,9 @@ static void __camera_cb_sticker(void *data, Evas_Object *obj,
 		PRINT_MSG("Could not restart the camera preview.");
 	}
 
+	if (cam_data.track_faces)
+		return;
+
 	error_code = camera_start_face_detection(cam_data.g_camera,
 			_camera_face_detected_cb, &cam_data.faces);
 	if (CAMERA_ERROR_NONE != error_code) {
@@ -1152,6 +971,9 @@ void camera_pop_cb() {
 	camera_destroy(cam_data.g_camera);
 	cam_data.g_camera = NULL;
 
+	/* Wait for the captured photos to be written. */
+	photos.stop();
+
 	/* Free the Camera directory path. */
 	free(camera_directory);
 }
@@ -1245,6 +1067,15 @@ void create_buttons_in_main_window(void) {
 		return;
 	}
 
+	/* The captured photos are given the filter and the sticker of the preview. */
+	char *resource_path = app_get_resource_path();
+	if (resource_path != NULL) {
+		photos.set_resource_dir(resource_path);
+		free(resource_path);
+	}
+	photos.set_predictor(&cam_data.sp);
+	photos.set_saved_cb(_photo_saved);
+
 	/* Check the camera state after creating the handle. */
 	camera_state_e state;
 	error_code = camera_get_state(cam_data.g_camera, &state);
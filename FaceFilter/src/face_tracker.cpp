@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "face_tracker.h"
+#include "clock.h"
+#include <dlib/image_transforms/interpolation.h>
+#include <dlib/threads/parallel_for_extension.h>
+#include <algorithm>
+#include <cmath>
+
+/* part of the size of a face added on each side of the region it is looked for in */
+#define FACE_ROI_MARGIN 0.5
+/* pyramid levels a region is scanned over, the face being expected on the middle one */
+#define FACE_ROI_LEVELS 3
+/* threshold adjustment of the region scans, so faces are followed a bit below the full scan threshold */
+#define FACE_ROI_THRESHOLD -0.5
+/* frames a face is still reported after it was last found */
+#define FACE_MAX_MISSES 2
+/* peak-to-sidelobe ratio under which a tracker is taken to be losing its face */
+#define FACE_MIN_PSR 7.0
+
+typedef dlib::frontal_face_detector::image_scanner_type face_scanner;
+
+face_tracker::face_tracker() :
+		total_ns(0), frames(0), full_scans(0), redetections(0), pool(NULL), low_confidence(
+				false), frames_since_full(0), full_scan_interval(30), budget_ns(
+				0), credit(0), full_scan_ns(0), _last_frame_ns(0) {
+}
+
+void face_tracker::set_detector(const dlib::frontal_face_detector& d) {
+	detector = d;
+
+	face_scanner scanner;
+	scanner.copy_configuration(d.get_scanner());
+	scanner.set_max_pyramid_levels(FACE_ROI_LEVELS);
+	/* the filters don't depend on the levels, so their SVDs are reused */
+	std::vector<dlib::processed_weight_vector<face_scanner> > w;
+	for (unsigned long i = 0; i < d.num_detectors(); i++)
+		w.push_back(d.get_processed_w(i));
+	roi_detector = dlib::frontal_face_detector(scanner, d.get_overlap_tester(),
+			w);
+
+	reset();
+}
+
+void face_tracker::set_full_scan_interval(int frames) {
+	full_scan_interval = frames > 1 ? frames : 1;
+}
+
+void face_tracker::set_budget_ns(uint64_t budget) {
+	budget_ns = budget;
+	credit = 0;
+}
+
+void face_tracker::set_thread_pool(dlib::thread_pool *tp) {
+	pool = tp;
+}
+
+void face_tracker::reset() {
+	tracks.clear();
+	faces.clear();
+	low_confidence = false;
+	frames_since_full = 0;
+	credit = 0;
+	full_scan_ns = 0;
+}
+
+void face_tracker::reset_stats() {
+	total_ns = 0;
+	frames = 0;
+	full_scans = 0;
+	redetections = 0;
+}
+
+const std::vector<dlib::rectangle>& face_tracker::update(
+		const preview_luma_image& img) {
+	const uint64_t start = now_ns();
+
+	if (budget_ns != 0) {
+		/* don't save up more than a full scan takes */
+		credit += budget_ns;
+		const int64_t cap = std::max(full_scan_ns, budget_ns);
+		if (credit > cap)
+			credit = cap;
+	}
+
+	frames_since_full++;
+	const bool want_full = tracks.empty() || low_confidence
+			|| frames_since_full >= full_scan_interval;
+	if (want_full && (budget_ns == 0 || credit >= (int64_t) full_scan_ns))
+		_scan_full(img);
+	else if (!tracks.empty())
+		_follow_tracks(img);
+
+	faces.clear();
+	for (size_t i = 0; i < tracks.size(); i++)
+		faces.push_back(tracks[i].rect);
+
+	_last_frame_ns = now_ns() - start;
+	if (budget_ns != 0)
+		credit -= _last_frame_ns;
+	total_ns += _last_frame_ns;
+	frames++;
+	return faces;
+}
+
+void face_tracker::_scan_full(const preview_luma_image& img) {
+	const uint64_t start = now_ns();
+
+	detector.detect(img, full_ws, dets);
+	/* resized rather than rebuilt, so the trackers keep their buffers */
+	tracks.resize(dets.size());
+	for (size_t i = 0; i < dets.size(); i++) {
+		tracks[i].rect = dets[i].rect;
+		tracks[i].score = dets[i].detection_confidence;
+		tracks[i].misses = 0;
+	}
+	if (pool != NULL && tracks.size() > 1)
+		dlib::parallel_for(*pool, 0, tracks.size(), [&](long i) {
+			tracks[i].tracker.start_track(img, tracks[i].rect);
+		}, 1);
+	else
+		for (size_t i = 0; i < tracks.size(); i++)
+			tracks[i].tracker.start_track(img, tracks[i].rect);
+	low_confidence = false;
+	frames_since_full = 0;
+	full_scans++;
+
+	full_scan_ns = now_ns() - start;
+}
+
+/*
+ * Moves every face to where its tracker followed it, and detects again the
+ * faces whose tracker is losing them.
+ */
+void face_tracker::_follow_tracks(const preview_luma_image& img) {
+	if (pool != NULL && tracks.size() > 1)
+		dlib::parallel_for(*pool, 0, tracks.size(), [&](long i) {
+			tracks[i].psr = tracks[i].tracker.update(img);
+		}, 1);
+	else
+		for (size_t i = 0; i < tracks.size(); i++)
+			tracks[i].psr = tracks[i].tracker.update(img);
+
+	low_confidence = false;
+	for (size_t i = 0; i < tracks.size(); i++) {
+		track& t = tracks[i];
+		t.rect = t.tracker.get_position();
+		if (t.psr >= FACE_MIN_PSR) {
+			t.misses = 0;
+			continue;
+		}
+
+		redetections++;
+		if (_scan_roi(img, t)) {
+			t.tracker.start_track(img, t.rect);
+		} else {
+			t.misses++;
+			low_confidence = true;
+		}
+	}
+
+	_remove_duplicates();
+}
+
+/*
+ * Looks for a face in a region around its last position.  The region is
+ * resized so the face, at its last size, would fill the detection window on
+ * the middle one of the FACE_ROI_LEVELS levels roi_detector scans.
+ */
+bool face_tracker::_scan_roi(const preview_luma_image& img, track& t) {
+	const dlib::rectangle area(0, 0, img.nc() - 1, img.nr() - 1);
+	const double window = roi_detector.get_scanner().get_detection_window_width();
+	const double face_scale = window
+			/ std::pow(dlib::pyramid_rate(face_scanner::pyramid_type()),
+					(FACE_ROI_LEVELS - 1) / 2);
+
+	const double size = std::max(t.rect.width(), t.rect.height());
+	const long roi_size = (long) (size * (1 + 2 * FACE_ROI_MARGIN) + 0.5);
+	const dlib::rectangle roi = dlib::centered_rect(t.rect, roi_size, roi_size).intersect(
+			area);
+
+	double best = 0;
+	long found = -1;
+	const double scale = face_scale / size;
+	const long chip_nr = (long) (roi.height() * scale + 0.5);
+	const long chip_nc = (long) (roi.width() * scale + 0.5);
+	if (roi.width() > 1 && roi.height() > 1 && chip_nr > 1 && chip_nc > 1) {
+		chip.set_size(chip_nr, chip_nc);
+		dlib::resize_image(img.crop(roi), chip);
+		roi_detector.detect(chip, roi_ws, dets, FACE_ROI_THRESHOLD);
+		for (size_t j = 0; j < dets.size(); j++) {
+			if (found < 0 || dets[j].detection_confidence > best) {
+				best = dets[j].detection_confidence;
+				found = j;
+			}
+		}
+	}
+
+	if (found < 0)
+		return false;
+
+	/* the inverse of the mapping resize_image() used */
+	const dlib::rectangle& r = dets[found].rect;
+	const double sx = (roi.width() - 1) / (double) (chip_nc - 1);
+	const double sy = (roi.height() - 1) / (double) (chip_nr - 1);
+	t.rect = dlib::rectangle(roi.left() + (long) std::floor(r.left() * sx + 0.5),
+			roi.top() + (long) std::floor(r.top() * sy + 0.5),
+			roi.left() + (long) std::floor(r.right() * sx + 0.5),
+			roi.top() + (long) std::floor(r.bottom() * sy + 0.5));
+	t.score = best;
+	t.misses = 0;
+	if (best < 0)
+		low_confidence = true;
+	return true;
+}
+
+/*
+ * Drops the faces that were missed too often, and of two faces that ended up
+ * on the same spot, the one seen longer ago or else the weaker one.
+ */
+void face_tracker::_remove_duplicates() {
+	size_t n = 0;
+	for (size_t i = 0; i < tracks.size(); i++) {
+		if (tracks[i].misses > FACE_MAX_MISSES)
+			continue;
+		bool keep = true;
+		for (size_t j = 0; j < n && keep; j++) {
+			if (detector.get_overlap_tester()(tracks[i].rect, tracks[j].rect)) {
+				if (tracks[i].misses < tracks[j].misses
+						|| (tracks[i].misses == tracks[j].misses
+								&& tracks[i].score > tracks[j].score))
+					tracks[j] = tracks[i];
+				keep = false;
+			}
+		}
+		if (keep) {
+			if (n != i)
+				tracks[n] = tracks[i];
+			n++;
+		}
+	}
+	tracks.resize(n);
+}
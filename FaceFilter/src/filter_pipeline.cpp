@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "filter_pipeline.h"
+#include "clock.h"
+#include "yuv_filter.h"
+#include "yuv_convolve.h"
+#include <string.h>
+#include <string>
+
+/*
+ * Bytes of a plane handed to the fused pointwise stages at a time.  Small
+ * enough to stay in L1 while every stage of the run goes over it.
+ */
+#define FUSED_CHUNK (16 * 1024)
+
+/* frames under half the budget before a degraded stage is brought back */
+#define CALM_FRAMES_TO_RESTORE 30
+
+filter_stage::filter_stage(const char *name) :
+		state(FILTER_STAGE_FULL), last_ns(0), total_ns(0), frames(0), _name(
+				name) {
+}
+
+filter_stage::~filter_stage() {
+}
+
+/* The built-in stages */
+
+namespace {
+
+class chroma_stage: public filter_stage {
+public:
+	chroma_stage(const char *name, unsigned char cb_mask, unsigned char cr_mask,
+			unsigned char cb, unsigned char cr) :
+			filter_stage(name), cb_mask(cb_mask), cr_mask(cr_mask), cb(cb), cr(
+					cr) {
+	}
+	bool is_pointwise() const {
+		return true;
+	}
+	void run_uv(unsigned char *uv, size_t size) {
+		yuv_filter_chroma(uv, size, cb_mask, cr_mask, cb, cr);
+	}
+private:
+	unsigned char cb_mask, cr_mask, cb, cr;
+};
+
+class invert_stage: public filter_stage {
+public:
+	invert_stage() :
+			filter_stage("invert") {
+	}
+	bool is_pointwise() const {
+		return true;
+	}
+	void run_y(unsigned char *y, size_t size) {
+		yuv_filter_invert(y, size);
+	}
+	void run_uv(unsigned char *uv, size_t size) {
+		yuv_filter_invert(uv, size);
+	}
+};
+
+class pinky_stage: public filter_stage {
+public:
+	pinky_stage() :
+			filter_stage("pinky") {
+	}
+	bool is_pointwise() const {
+		return true;
+	}
+	void run_y(unsigned char *y, size_t size) {
+		yuv_filter_boost_dark(y, size);
+	}
+	void run_uv(unsigned char *uv, size_t size) {
+		yuv_filter_boost_even(uv, size);
+	}
+};
+
+/* reduced mode: luma only, the chroma is left alone */
+class gaussian_stage: public filter_stage {
+public:
+	explicit gaussian_stage(dlib::thread_pool& tp) :
+			filter_stage("gaussian"), conv(tp) {
+	}
+	bool is_pointwise() const {
+		return false;
+	}
+	bool can_reduce() const {
+		return true;
+	}
+	void run(const nv12_frame& frame, bool reduced) {
+		conv.gaussian(frame.y, frame.width, frame.height, frame.stride, 1);
+		if (!reduced)
+			conv.gaussian(frame.uv, frame.width, frame.height / 2,
+					frame.stride, 2);
+	}
+private:
+	yuv_convolver conv;
+};
+
+/* reduced mode: luma only, the chroma is left alone */
+class emboss_stage: public filter_stage {
+public:
+	explicit emboss_stage(dlib::thread_pool& tp) :
+			filter_stage("emboss"), conv(tp) {
+	}
+	bool is_pointwise() const {
+		return false;
+	}
+	bool can_reduce() const {
+		return true;
+	}
+	void run(const nv12_frame& frame, bool reduced) {
+		conv.emboss(frame.y, frame.width, frame.height, frame.stride, 1);
+		if (!reduced)
+			conv.emboss(frame.uv, frame.width, frame.height / 2, frame.stride,
+					2);
+	}
+private:
+	yuv_convolver conv;
+};
+
+}
+
+filter_stage *filter_stage_create(const char *name, dlib::thread_pool& tp) {
+	if (!strcmp(name, "sepia"))
+		return new chroma_stage("sepia", 0, 0, 114, 144);
+	if (!strcmp(name, "grayscale"))
+		return new chroma_stage("grayscale", 0, 0, 128, 128);
+	if (!strcmp(name, "nored"))
+		return new chroma_stage("nored", 0xff, 0, 0, 128);
+	if (!strcmp(name, "noblue"))
+		return new chroma_stage("noblue", 0, 0xff, 128, 0);
+	if (!strcmp(name, "invert"))
+		return new invert_stage();
+	if (!strcmp(name, "pinky"))
+		return new pinky_stage();
+	if (!strcmp(name, "gaussian"))
+		return new gaussian_stage(tp);
+	if (!strcmp(name, "emboss"))
+		return new emboss_stage(tp);
+	return NULL;
+}
+
+filter_pipeline::filter_pipeline() :
+		budget_ns(0), _last_frame_ns(0), calm_frames(0) {
+}
+
+void filter_pipeline::add(filter_stage *stage) {
+	stages.push_back(std::unique_ptr<filter_stage>(stage));
+}
+
+bool filter_pipeline::set_chain(const char *chain, dlib::thread_pool& tp) {
+	clear();
+	std::string names(chain);
+	size_t begin = 0;
+	while (begin < names.size()) {
+		size_t end = names.find(',', begin);
+		if (end == std::string::npos)
+			end = names.size();
+		if (end > begin) {
+			filter_stage *stage = filter_stage_create(
+					names.substr(begin, end - begin).c_str(), tp);
+			if (stage == NULL) {
+				clear();
+				return false;
+			}
+			add(stage);
+		}
+		begin = end + 1;
+	}
+	return true;
+}
+
+void filter_pipeline::clear() {
+	stages.clear();
+	degraded.clear();
+	calm_frames = 0;
+	_last_frame_ns = 0;
+}
+
+void filter_pipeline::set_budget_ns(uint64_t budget) {
+	budget_ns = budget;
+	calm_frames = 0;
+}
+
+void filter_pipeline::reset_stats() {
+	for (size_t i = 0; i < stages.size(); i++) {
+		stages[i]->last_ns = 0;
+		stages[i]->total_ns = 0;
+		stages[i]->frames = 0;
+	}
+}
+
+/*
+ * Runs the pointwise stages [begin, end) chunk by chunk, so each chunk is
+ * loaded once and then stays in cache for all of them.  Dropped stages must
+ * already have been filtered out by the caller.
+ */
+void filter_pipeline::_run_fused(const nv12_frame& frame, size_t begin,
+		size_t end) {
+	unsigned char *planes[2] = { frame.y, frame.uv };
+	const size_t sizes[2] = { frame.y_size(), frame.uv_size() };
+
+	for (int p = 0; p < 2; p++) {
+		for (size_t off = 0; off < sizes[p]; off += FUSED_CHUNK) {
+			const size_t n =
+					sizes[p] - off < FUSED_CHUNK ? sizes[p] - off : FUSED_CHUNK;
+			for (size_t i = begin; i < end; i++) {
+				filter_stage& s = *stages[i];
+				if (s.state == FILTER_STAGE_DROPPED)
+					continue;
+				const uint64_t t0 = now_ns();
+				if (p == 0)
+					s.run_y(planes[p] + off, n);
+				else
+					s.run_uv(planes[p] + off, n);
+				s.last_ns += now_ns() - t0;
+			}
+		}
+	}
+}
+
+void filter_pipeline::run(const nv12_frame& frame) {
+	const uint64_t start = now_ns();
+
+	for (size_t i = 0; i < stages.size(); i++)
+		stages[i]->last_ns = 0;
+
+	size_t i = 0;
+	while (i < stages.size()) {
+		filter_stage& s = *stages[i];
+		if (s.is_pointwise()) {
+			size_t end = i + 1;
+			while (end < stages.size() && stages[end]->is_pointwise())
+				end++;
+			_run_fused(frame, i, end);
+			i = end;
+		} else {
+			if (s.state != FILTER_STAGE_DROPPED) {
+				const uint64_t t0 = now_ns();
+				s.run(frame, s.state == FILTER_STAGE_REDUCED);
+				s.last_ns = now_ns() - t0;
+			}
+			i++;
+		}
+	}
+
+	for (size_t i = 0; i < stages.size(); i++) {
+		if (stages[i]->state != FILTER_STAGE_DROPPED) {
+			stages[i]->total_ns += stages[i]->last_ns;
+			stages[i]->frames++;
+		}
+	}
+
+	_last_frame_ns = now_ns() - start;
+	_apply_budget();
+}
+
+void filter_pipeline::_apply_budget() {
+	if (budget_ns == 0)
+		return;
+
+	if (_last_frame_ns > budget_ns) {
+		calm_frames = 0;
+		/* cut down the stage that cost the most in this frame */
+		size_t worst = stages.size();
+		for (size_t i = 0; i < stages.size(); i++) {
+			if (stages[i]->state == FILTER_STAGE_DROPPED)
+				continue;
+			if (worst == stages.size()
+					|| stages[i]->last_ns > stages[worst]->last_ns)
+				worst = i;
+		}
+		if (worst == stages.size())
+			return;
+		filter_stage& s = *stages[worst];
+		if (s.state == FILTER_STAGE_FULL && s.can_reduce())
+			s.state = FILTER_STAGE_REDUCED;
+		else
+			s.state = FILTER_STAGE_DROPPED;
+		degraded.push_back(worst);
+	} else if (!degraded.empty() && _last_frame_ns < budget_ns / 2) {
+		if (++calm_frames >= CALM_FRAMES_TO_RESTORE) {
+			/* undo the most recent step */
+			filter_stage& s = *stages[degraded.back()];
+			degraded.pop_back();
+			if (s.state == FILTER_STAGE_DROPPED && s.can_reduce())
+				s.state = FILTER_STAGE_REDUCED;
+			else
+				s.state = FILTER_STAGE_FULL;
+			calm_frames = 0;
+		}
+	} else {
+		calm_frames = 0;
+	}
+}
+
+const char *filter_preset_chain(int preset) {
+	static const char *chains[FILTER_PRESET_COUNT] = {
+		"",
+		"sepia",
+		"grayscale",
+		"invert",
+		"nored",
+		"noblue",
+		"pinky",
+		"gaussian",
+		"emboss",
+		"gaussian,sepia",
+		"emboss,grayscale",
+		"pinky,gaussian"
+	};
+	if (preset < 0 || preset >= FILTER_PRESET_COUNT)
+		return "";
+	return chains[preset];
+}
@@ -76,213 +76,113 @@ void draw_landmark(camera_preview_data_s* frame, const full_object_detection sha
 			}
 	}
 }
-/*
-void sticker_mustache(const full_object_detection shape){
-    try{
-        assign_image(out_img, in_img);
-
-        array2d<rgb_alpha_pixel> st;
-        load_image(st, fname + to_string(idx) + ".png");
-
-        // resize sticker image
-        long w = shape.get_rect().right() - shape.get_rect().left();
-        int nh = (int)(w/st.nc() * st.nr());
-        array2d<rgb_alpha_pixel> stst(nh, w);
-        resize_image(st, stst);
-
-        int p = (int)(shape.part(30))(0);
-        int q = (int)(shape.part(30))(1);
-        int sw = (int)stst.nr()/2;
-        int sh = (int)stst.nc()/2;
-
-        for(int x=-sw;x<sw;x++){
-            for(int y=-sh;y<sh;y++){
-                if(stst[x+sw][y+sh].alpha != 0){
-                    out_img[x+q][y+p].red = stst[x+sw][y+sh].red;
-                    out_img[x+q][y+p].blue = stst[x+sw][y+sh].blue;
-                    out_img[x+q][y+p].green = stst[x+sw][y+sh].green;
-                }
-            }
-        }
-    }
-    catch (exception &e)
-    {
-    	dlog_print(DLOG_ERROR, LOG_TAG, "\nexception thrown!");
-    	dlog_print(DLOG_ERROR, LOG_TAG, e.what());
-    }
+/* the images the stickers are made of, in res/ */
+typedef enum {
+	PIECE_MUSTACHE,
+	PIECE_EAR_L,
+	PIECE_EAR_R,
+	PIECE_HAT,
+	PIECE_GLASSES,
+	PIECE_COUNT
+} sticker_piece_e;
+
+static const char* piece_files[PIECE_COUNT] = {
+	"sticker/mustache.png",
+	"sticker/ear_l.png",
+	"sticker/ear_r.png",
+	"sticker/hat.png",
+	"sticker/glasses.png"
+};
+
+sticker_set::sticker_set(preview_rotation_e rotation) :
+		cache(rotation), piece_ids(PIECE_COUNT, -1)
+{
 }
 
-void sticker_hairband(const full_object_detection shape, int idx){
-    try{
-        assign_image(out_img, in_img);
-
-        long h = ((shape.part(21)+shape.part(22)) - shape.part(33))(1);
-
-        // get position of top of forehead
-        dlib::vector<long int, 2l> fore_l = dlib::vector<long int, 2l>((shape.part(19))(0), h);
-
-        dlib::vector<long int, 2l> fore_r = dlib::vector<long int, 2l>((shape.part(24))(0), h);
-        
-        // load hairband image
-        array2d<rgb_alpha_pixel> st;
-        load_image(st, fname + to_string(idx) + "l.png");
-
-        // resize sticker image
-        int nw = (int)((float)h/st.nr() * st.nc());
-        array2d<rgb_alpha_pixel> stst(h, nw);
-        resize_image(st, stst);
-
-        // processing at left side
-        int p = (int)fore_l(0);
-        int q = (int)fore_l(1);
-        int sw = (int)stst.nr()/2;
-        int sh = (int)stst.nc()/2;
-
-        for(int x=-sw;x<sw;x++){
-            for(int y=-sh;y<sh;y++){
-                if(stst[x+sw][y+sh].alpha != 0){
-                    out_img[x+q][y+p].red = stst[x+sw][y+sh].red;
-                    out_img[x+q][y+p].blue = stst[x+sw][y+sh].blue;
-                    out_img[x+q][y+p].green = stst[x+sw][y+sh].green;
-                }
-            }
-        }
-        
-        // processing at right side
-        load_image(st, fname + to_string(idx) + "r.png");
-        nw = (int)((float)h/st.nr() * st.nc());
-        array2d<rgb_alpha_pixel> ststn(h, nw);
-        resize_image(st, ststn);
-
-        p = (int)fore_r(0);
-        q = (int)fore_r(1);
+bool sticker_set::load(const char* dir)
+{
+	char path[BUFLEN];
+	bool ok = true;
 
-        for(int x=-sw;x<sw;x++){
-            for(int y=-sh;y<sh;y++){
-                if(ststn[x+sw][y+sh].alpha != 0){
-                    out_img[x+q][y+p].red = ststn[x+sw][y+sh].red;
-                    out_img[x+q][y+p].blue = ststn[x+sw][y+sh].blue;
-                    out_img[x+q][y+p].green = ststn[x+sw][y+sh].green;
-                }
-            }
-        }
-    }
-    catch (exception &e)
-    {
-    	dlog_print(DLOG_ERROR, LOG_TAG, "\nexception thrown!");
-    	dlog_print(DLOG_ERROR, LOG_TAG, e.what());
-    }
+	cache.clear();
+	for(int i = 0; i < PIECE_COUNT; i++)
+	{
+		snprintf(path, BUFLEN, "%s%s", dir, piece_files[i]);
+		piece_ids[i] = cache.load(path);
+		if(piece_ids[i] < 0)
+		{
+			dlog_print(DLOG_ERROR, LOG_TAG, "Could not load sticker %s", path);
+			ok = false;
+		}
+	}
+	return ok;
 }
 
-void sticker_ear(const full_object_detection shape, int idx)
+static dpoint _part(const full_object_detection& shape, unsigned long i)
 {
-	 try{
-	        long h = ((shape.part(21) + shape.part(22)) - shape.part(33))(1);
-
-	        dlib::vector<long int, 2l> fore_l = dlib::vector<long int, 2l>((shape.part(19))(0), h);
-	        dlib::vector<long int, 2l> fore_r = dlib::vector<long int, 2l>((shape.part(24))(0), h);
-
-	        int nw = (int)(h/origin_img.nr() * origin_img.nc());
-	        resize_img.set_size(h, nw);
-	        resize_image(origin_img, resize_img, interpolate_bilinear());
-
-	        int p = (int)fore_l(0);
-	        int q = (int)fore_l(1);
-	        int sw = (int)resize_img.nr()/2;
-	        int sh = (int)resize_img.nc()/2;
-
-	        for(int i = -sw; i < sw; i++) {
-	            for(int j = -sh; j < sh; j++) {
-	                if(resize_img[i+sw][j+sh].alpha == 0)
-	                    continue;
-	                cimg[i+q][j+p].red = resize_img[i+sw][j+sh].red;
-	                cimg[i+q][j+p].blue = resize_img[i+sw][j+sh].blue;
-	                cimg[i+q][j+p].green = resize_img[i+sw][j+sh].green;
-	            }
-	        }
-
-	        char* new_name;
-	        strncpy(new_name, img_name, strlen(img_name));
-	        new_name[strlen(new_name) - 5] = 'r';
-	        load_image(origin_img, new_name);
-
-	        resize_image(origin_img, resize_img, interpolate_bilinear());
-	        p = (int)fore_r(0);
-	        q = (int)fore_r(1);
-
-	        for(int i = -sw; i < sw; i++) {
-	            for(int j = -sh; j < sh; j++) {
-	                if(resize_img[i+sw][j+sh].alpha == 0)
-	                    continue;
-	                cimg[i+q][j+p].red = resize_img[i+sw][j+sh].red;
-	                cimg[i+q][j+p].blue = resize_img[i+sw][j+sh].blue;
-	                cimg[i+q][j+p].green = resize_img[i+sw][j+sh].green;
-	            }
-	        }
-
-	        delete(new_name);
-	    }
-
-	    catch (exception &e)
-	    {
-	    	dlog_print(DLOG_ERROR, LOG_TAG, "\nexception thrown!");
-	    	dlog_print(DLOG_ERROR, LOG_TAG, e.what());
-	    }
-
+	return dpoint(shape.part(i));
 }
-void sticker_hat(const full_object_detection shape)
+
+/* draws a piece centered on a point */
+void sticker_set::_draw_piece(const nv12_frame& frame, int piece, const dpoint& center, double width)
 {
-	long h =((shape.part(21) + shape.part(22)) - shape.part(33))(1);
-	rectangle rect = shape.get_rect();
-	long width = rect.right() - rect.left();
-	long height = rect.bottom() - rect.top();
+	if(piece_ids[piece] >= 0)
+		cache.draw(frame, piece_ids[piece], center, width);
+}
 
-	dlib::vector<long int, 21> fore = dlib::vector<long int, 21> ((shape.part(27))(0), h);
+/* draws a piece standing on a point, i.e. with the middle of its bottom edge there */
+void sticker_set::_draw_piece_on(const nv12_frame& frame, int piece, const dpoint& bottom, double width)
+{
+	if(piece_ids[piece] < 0)
+		return;
+	double height = width * cache.aspect(piece_ids[piece]);
+	cache.draw(frame, piece_ids[piece], bottom - dpoint(0, height / 2), width);
+}
 
-	int w = (int)(h/origin_img.nr() * origin_img.nc());
-	resize_img.set_size(height, width);
-	resize_image(origin_img, resize_img, interpolate_bilinear());
+void sticker_set::draw(const nv12_frame& frame, int sticker, const full_object_detection& shape)
+{
+	double face_width = shape.get_rect().width();
 
-	int p = (int)fore(0);
-	int q = (int)fore(1);
-	int sw = (int)resize_img.nc()/2;
-	int sh = (int)resize_img.nr()/2;
+	// The top of the forehead is about as far above the eyebrows as the
+	// bottom of the nose is below them.
+	dpoint forehead = _part(shape, 21) + _part(shape, 22) - _part(shape, 33);
+	dpoint forehead_l(_part(shape, 19).x(), forehead.y());
+	dpoint forehead_r(_part(shape, 24).x(), forehead.y());
 
-	for(int i = 0; i < resize_img.nc(); i++)
+	switch(sticker)
 	{
-		for(int j = 0; j < resize_img.nr(); j++)
-		{
-			if(resize_img[i+w][j+h].alpha == 0)
-				continue;
-			img[i+q-sw][j+p-sh].red = resize_img[i][j].red;
-			img[i+q-sw][j+p-sh].blue = resize_img[i][j].blue;
-			img[i+q-sw][j+p-sh]].green = resize_img[i][j].green;
-		}
+	case STICKER_MUSTACHE:
+		// between the bottom of the nose and the top of the upper lip
+		_draw_piece(frame, PIECE_MUSTACHE, (_part(shape, 33) + _part(shape, 51)) / 2, face_width / 2);
+		break;
+	case STICKER_EAR:
+		_draw_piece_on(frame, PIECE_EAR_L, forehead_l, face_width / 3);
+		_draw_piece_on(frame, PIECE_EAR_R, forehead_r, face_width / 3);
+		break;
+	case STICKER_HAT:
+		_draw_piece_on(frame, PIECE_HAT, forehead, face_width * 1.2);
+		break;
+	case STICKER_GLASSES:
+		// centered between the outer corners of the eyes
+		_draw_piece(frame, PIECE_GLASSES, (_part(shape, 36) + _part(shape, 45)) / 2, face_width);
+		break;
+	default:
+		break;
 	}
 }
-void sticker_glasses(const full_object_detection shape)
-{
-	rectangle rect = shape.get_rect();
-	long height = (shape.part(41)(1) - shape.part(19)(1))*3; //From left eyebow to bottom of left eye
-	long width = rect.right() - rect.left();
-	resize_img.set_size(height, width);
-	resize_image(origin_img, resize_img, interpolate_bilinear());
 
-	long m_x = shape.part(27)(0);
-	long m_y = shape.part(27)(1);
+/* the stickers of the preview */
+static sticker_set stickers(PREVIEW_ROTATION_90);
 
-	for(int i = 0; i < resize_img.nr(); i++)
-	{
-		for(int j = 0; j < resize_img.nc(); j++)
-		{
-			if(resize_img[i][j].alpha == 0)
-				continue;
-			img[i - resize_img.nr()/2 + m_y][j - resize_img.nc()/2 + m_x].red = resize_img[i][j].red;
-			img[i - resize_img.nr()/2 + m_y][j - resize_img.nc()/2 + m_x].blue = resize_img[i][j].blue;
-			img[i - resize_img.nr()/2 + m_y][j - resize_img.nc()/2 + m_x].green = resize_img[i][j].green;
-		}
-	}
+bool load_stickers(const char* dir)
+{
+	return stickers.load(dir);
 }
-*/
+
+void draw_sticker(const nv12_frame& frame, int sticker, const full_object_detection& shape)
+{
+	stickers.draw(frame, sticker, shape);
+}
+
 // ----------------------------------------------------------------------------------------
 
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "landmark_tracker.h"
+#include "clock.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+/* part of a shape predictor result the filtered landmarks move by */
+#define LANDMARK_ALPHA 0.5
+/* part of the same result the velocity of the landmarks changes by */
+#define LANDMARK_BETA 0.1
+/* move, as a part of the face size, over which the landmarks aren't filtered */
+#define LANDMARK_SNAP_MOVE 0.1
+/* overlap of a face with the face of the frame before it is matched with */
+#define LANDMARK_MIN_OVERLAP 0.5
+
+/*
+ * Sums up the luma of a rectangle as a LANDMARK_SIG_SIZE square grid, every
+ * cell being the mean of four pixels of it.
+ */
+static void _luma_grid(const preview_luma_image& img,
+		const dlib::rectangle& rect, unsigned char *sig) {
+	const dlib::rectangle r = rect.intersect(dlib::get_rect(img));
+	if (r.is_empty()) {
+		std::fill(sig, sig + LANDMARK_SIG_SIZE * LANDMARK_SIG_SIZE, 0);
+		return;
+	}
+
+	const dlib::const_image_view<preview_luma_image> view(img);
+	const double cw = r.width() / (double) LANDMARK_SIG_SIZE;
+	const double ch = r.height() / (double) LANDMARK_SIG_SIZE;
+	for (int gy = 0; gy < LANDMARK_SIG_SIZE; gy++) {
+		const long y0 = r.top() + (long) ((gy + 0.25) * ch);
+		const long y1 = r.top() + (long) ((gy + 0.75) * ch);
+		for (int gx = 0; gx < LANDMARK_SIG_SIZE; gx++) {
+			const long x0 = r.left() + (long) ((gx + 0.25) * cw);
+			const long x1 = r.left() + (long) ((gx + 0.75) * cw);
+			sig[gy * LANDMARK_SIG_SIZE + gx] = (view[y0][x0] + view[y0][x1]
+					+ view[y1][x0] + view[y1][x1] + 2) / 4;
+		}
+	}
+}
+
+static double _overlap(const dlib::rectangle& a, const dlib::rectangle& b) {
+	const double inner = a.intersect(b).area();
+	return inner / (a.area() + b.area() - inner);
+}
+
+landmark_tracker::landmark_tracker() :
+		total_ns(0), frames(0), shapes(0), predictions(0), sp(NULL), pool(NULL), max_stale_frames(
+				4), move_threshold(0.03), luma_threshold(3) {
+}
+
+void landmark_tracker::set_predictor(const dlib::shape_predictor *p) {
+	sp = p;
+	reset();
+}
+
+void landmark_tracker::set_max_stale_frames(int frames) {
+	max_stale_frames = frames > 0 ? frames : 0;
+}
+
+void landmark_tracker::set_motion_thresholds(double move, double luma) {
+	move_threshold = move;
+	luma_threshold = luma;
+}
+
+void landmark_tracker::set_thread_pool(dlib::thread_pool *tp) {
+	pool = tp;
+}
+
+void landmark_tracker::reset() {
+	tracks.clear();
+}
+
+void landmark_tracker::reset_stats() {
+	total_ns = 0;
+	frames = 0;
+	shapes = 0;
+	predictions = 0;
+}
+
+const std::vector<dlib::full_object_detection>& landmark_tracker::update(
+		const preview_luma_image& img,
+		const std::vector<dlib::rectangle>& faces) {
+	const uint64_t start = now_ns();
+
+	if (sp == NULL || sp->num_parts() == 0) {
+		result.clear();
+		return result;
+	}
+
+	_match_tracks(faces);
+
+	run_rects.clear();
+	run_faces.clear();
+	for (size_t i = 0; i < faces.size(); i++) {
+		track& t = next[i];
+		if (fresh[i] || t.stale >= max_stale_frames
+				|| _moved(img, faces[i], t)) {
+			run_rects.push_back(faces[i]);
+			run_faces.push_back(i);
+		} else {
+			/* the face is still, whatever speed it had is gone */
+			std::fill(t.vel.begin(), t.vel.end(), dlib::dpoint(0, 0));
+			t.stale++;
+		}
+	}
+
+	if (pool != NULL && run_rects.size() > 1)
+		(*sp)(img, run_rects, dets, sp_ws, *pool);
+	else if (!run_rects.empty())
+		(*sp)(img, run_rects, dets, sp_ws);
+	for (size_t k = 0; k < run_faces.size(); k++)
+		_take_shape(img, faces[run_faces[k]], dets[k], next[run_faces[k]]);
+
+	const unsigned long n = sp->num_parts();
+	result.resize(faces.size());
+	for (size_t i = 0; i < faces.size(); i++) {
+		const track& t = next[i];
+		dlib::full_object_detection& det = result[i];
+		if (det.num_parts() != n)
+			det = dlib::full_object_detection(faces[i],
+					std::vector<dlib::point>(n));
+		else
+			det.get_rect() = faces[i];
+		for (unsigned long j = 0; j < n; j++)
+			det.part(j) = t.pos[j];
+	}
+	tracks.swap(next);
+
+	total_ns += now_ns() - start;
+	frames++;
+	shapes += faces.size();
+	predictions += run_faces.size();
+	return result;
+}
+
+/*
+ * Moves into next[i] the track of the face of the frame before that overlaps
+ * faces[i] most, if any, and sets fresh[i] if there is none.
+ */
+void landmark_tracker::_match_tracks(const std::vector<dlib::rectangle>& faces) {
+	/* resized rather than rebuilt, so the tracks keep their buffers */
+	next.resize(faces.size());
+	fresh.assign(faces.size(), true);
+	for (size_t i = 0; i < faces.size(); i++) {
+		double best = LANDMARK_MIN_OVERLAP;
+		long found = -1;
+		for (size_t j = 0; j < tracks.size(); j++) {
+			/* tracks already matched were left empty */
+			if (tracks[j].pos.empty())
+				continue;
+			const double overlap = _overlap(faces[i], tracks[j].rect);
+			if (overlap > best) {
+				best = overlap;
+				found = j;
+			}
+		}
+		if (found >= 0) {
+			std::swap(next[i], tracks[found]);
+			tracks[found].pos.clear();
+			fresh[i] = false;
+		} else {
+			/* what is left in next[i] is from an older frame */
+			next[i].pos.clear();
+			next[i].stale = 0;
+		}
+	}
+}
+
+/*
+ * Tells whether a face moved or changed enough since the shape predictor last
+ * ran on it to run it again.
+ */
+bool landmark_tracker::_moved(const preview_luma_image& img,
+		const dlib::rectangle& face, const track& t) const {
+	const double size = std::max(t.rect.width(), t.rect.height());
+	const double move = dlib::length(dlib::dcenter(face) - dlib::dcenter(t.rect))
+			+ std::abs((double) face.width() - t.rect.width());
+	if (move > move_threshold * size)
+		return true;
+
+	unsigned char sig[LANDMARK_SIG_SIZE * LANDMARK_SIG_SIZE];
+	_luma_grid(img, t.rect, sig);
+	int diff = 0;
+	for (int i = 0; i < LANDMARK_SIG_SIZE * LANDMARK_SIG_SIZE; i++)
+		diff += std::abs(sig[i] - t.sig[i]);
+	return diff > luma_threshold * LANDMARK_SIG_SIZE * LANDMARK_SIG_SIZE;
+}
+
+/*
+ * Takes the landmarks the shape predictor found for a face into its track.
+ */
+void landmark_tracker::_take_shape(const preview_luma_image& img,
+		const dlib::rectangle& face, const dlib::full_object_detection& det,
+		track& t) {
+	const unsigned long n = det.num_parts();
+	const double size = std::max(t.rect.width(), t.rect.height());
+	const bool snap = t.pos.size() != n
+			|| dlib::length(dlib::dcenter(face) - dlib::dcenter(t.rect))
+					> LANDMARK_SNAP_MOVE * size;
+
+	if (snap) {
+		t.pos.resize(n);
+		t.vel.resize(n);
+		for (unsigned long j = 0; j < n; j++) {
+			t.pos[j] = det.part(j);
+			t.vel[j] = dlib::dpoint(0, 0);
+		}
+	} else {
+		/* frames since the last result */
+		const double dt = t.stale + 1;
+		for (unsigned long j = 0; j < n; j++) {
+			const dlib::dpoint predicted = t.pos[j] + t.vel[j] * dt;
+			const dlib::dpoint residual = dlib::dpoint(det.part(j)) - predicted;
+			t.pos[j] = predicted + residual * LANDMARK_ALPHA;
+			t.vel[j] += residual * (LANDMARK_BETA / dt);
+		}
+	}
+
+	t.rect = face;
+	_luma_grid(img, face, t.sig);
+	t.stale = 0;
+}
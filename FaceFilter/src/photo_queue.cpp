@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "photo_queue.h"
+#include "clock.h"
+#include "main.h"
+#include "landmark.h"
+#include "filter_pipeline.h"
+#include "preview_image.h"
+#include <dlib/image_processing/frontal_face_detector.h>
+#include <dlib/image_loader/jpeg_loader.h>
+#include <dlib/image_saver/save_jpeg.h>
+#include <algorithm>
+#include <stdio.h>
+
+/* shorter side of the luma decode the faces of a photo are looked for in */
+#define PHOTO_DETECT_SIDE 480
+/* JPEG quality of the processed photos */
+#define PHOTO_JPEG_QUALITY 95
+
+static inline unsigned char _clamp_byte(int v) {
+	return v <= 0 ? 0 : v >= 255 ? 255 : (unsigned char) v;
+}
+
+/*
+ * Converts an RGB image to BT.601 video range NV12, the format of the preview
+ * frames, so the filters and the stickers work on photos unchanged.  Every
+ * chroma sample is taken from the mean of its four pixels.
+ */
+static void _rgb_to_nv12(const dlib::array2d<dlib::rgb_pixel>& rgb,
+		const nv12_frame& frame) {
+	for (long r = 0; r < frame.height; r += 2) {
+		unsigned char *y0 = frame.y + r * frame.stride;
+		unsigned char *y1 = y0 + frame.stride;
+		unsigned char *uv = frame.uv + r / 2 * frame.stride;
+		for (long c = 0; c < frame.width; c += 2) {
+			const dlib::rgb_pixel *p[4] = { &rgb[r][c], &rgb[r][c + 1],
+					&rgb[r + 1][c], &rgb[r + 1][c + 1] };
+			unsigned char *y[4] = { y0 + c, y0 + c + 1, y1 + c, y1 + c + 1 };
+			int sr = 0, sg = 0, sb = 0;
+			for (int k = 0; k < 4; k++) {
+				*y[k] = (66 * p[k]->red + 129 * p[k]->green + 25 * p[k]->blue
+						+ 128 + (16 << 8)) >> 8;
+				sr += p[k]->red;
+				sg += p[k]->green;
+				sb += p[k]->blue;
+			}
+			uv[c] = (-38 * sr - 74 * sg + 112 * sb + 512 + (128 << 10)) >> 10;
+			uv[c + 1] = (112 * sr - 94 * sg - 18 * sb + 512 + (128 << 10)) >> 10;
+		}
+	}
+}
+
+/*
+ * Converts an NV12 frame back to RGB, turned clockwise by rotation like a
+ * preview_luma_image.
+ */
+static void _nv12_to_rgb(const nv12_frame& frame, preview_rotation_e rotation,
+		dlib::array2d<dlib::rgb_pixel>& rgb) {
+	/* frame column and row of out[r][c]: x0 + r * xr + c * xc, likewise y */
+	long x0 = 0, xr = 0, xc = 1, y0 = 0, yr = 1, yc = 0;
+	switch (rotation) {
+	case PREVIEW_ROTATION_90:
+		xr = 1, xc = 0, y0 = frame.height - 1, yr = 0, yc = -1;
+		break;
+	case PREVIEW_ROTATION_180:
+		x0 = frame.width - 1, xc = -1, y0 = frame.height - 1, yr = -1;
+		break;
+	case PREVIEW_ROTATION_270:
+		x0 = frame.width - 1, xr = -1, xc = 0, yr = 0, yc = 1;
+		break;
+	default:
+		break;
+	}
+	const bool sideways = rotation == PREVIEW_ROTATION_90
+			|| rotation == PREVIEW_ROTATION_270;
+	rgb.set_size(sideways ? frame.width : frame.height,
+			sideways ? frame.height : frame.width);
+
+	for (long r = 0; r < rgb.nr(); r++) {
+		long x = x0 + r * xr, y = y0 + r * yr;
+		for (long c = 0; c < rgb.nc(); c++, x += xc, y += yc) {
+			const int l = 298 * (frame.y[y * frame.stride + x] - 16) + 128;
+			const unsigned char *uv = frame.uv + y / 2 * frame.stride + (x & ~1L);
+			const int d = uv[0] - 128;
+			const int e = uv[1] - 128;
+			dlib::rgb_pixel& p = rgb[r][c];
+			p.red = _clamp_byte((l + 409 * e) >> 8);
+			p.green = _clamp_byte((l - 100 * d - 208 * e) >> 8);
+			p.blue = _clamp_byte((l + 516 * d) >> 8);
+		}
+	}
+}
+
+struct photo_queue::job {
+	std::vector<unsigned char> jpeg; /* as captured */
+	std::string path;
+	int filter;
+	int sticker;
+	uint64_t pushed_ns;
+	dlib::array2d<dlib::rgb_pixel> out; /* the photo to write, if processed */
+	photo_result result;
+};
+
+/*
+ * What the processing thread keeps from one photo to the next, so the
+ * buffers of a photo of the same size are reused.
+ */
+struct photo_queue::processor {
+	explicit processor(preview_rotation_e rotation) :
+			has_detector(false), pool(0), pipeline_filter(-1), stickers(
+					rotation), stickers_loaded(false) {
+	}
+
+	dlib::array2d<dlib::rgb_pixel> rgb; /* the decoded photo */
+	std::vector<unsigned char> yuv; /* the photo in NV12 */
+	dlib::array2d<unsigned char> small; /* luma decode faces are found in */
+	bool has_detector;
+	dlib::frontal_face_detector detector;
+	dlib::frontal_face_detector::workspace det_ws;
+	std::vector<dlib::rect_detection> dets;
+	std::vector<dlib::rectangle> faces;
+	dlib::shape_predictor_workspace sp_ws;
+	std::vector<dlib::full_object_detection> shapes;
+	dlib::thread_pool pool; /* without threads, the stages run inline */
+	filter_pipeline pipeline;
+	int pipeline_filter; /* the preset pipeline was last built for */
+	sticker_set stickers;
+	bool stickers_loaded;
+};
+
+photo_queue::photo_queue(size_t size_, preview_rotation_e rotation_) :
+		size(size_), rotation(rotation_), sp(NULL), cb(NULL), free_jobs(
+				size_), to_process(size_), to_write(size_) {
+}
+
+photo_queue::~photo_queue() {
+	stop();
+}
+
+void photo_queue::set_resource_dir(const char *dir) {
+	resource_dir = dir;
+}
+
+void photo_queue::set_predictor(const dlib::shape_predictor *p) {
+	sp = p;
+}
+
+void photo_queue::set_saved_cb(saved_cb c) {
+	cb = c;
+}
+
+bool photo_queue::push(const unsigned char *jpeg, size_t bytes,
+		const char *path, int filter, int sticker) {
+	if (!process_thread) {
+		for (size_t i = 0; i < size; i++) {
+			jobs.push_back(std::unique_ptr<job>(new job));
+			job *j = jobs.back().get();
+			free_jobs.enqueue(j);
+		}
+		process_thread.reset(
+				new dlib::thread_function(&photo_queue::_process_thread, this));
+		write_thread.reset(
+				new dlib::thread_function(&photo_queue::_write_thread, this));
+#if !defined(DLIB_JPEG_SUPPORT)
+		dlog_print(DLOG_WARN, LOG_TAG, "Built without DLIB_JPEG_SUPPORT: "
+				"photos are saved as captured, without filter or sticker.");
+#endif
+	}
+
+	job *j;
+	if (!free_jobs.dequeue_or_timeout(j, 0))
+		return false;
+	j->jpeg.assign(jpeg, jpeg + bytes);
+	j->path = path;
+	j->filter = filter;
+	j->sticker = sticker;
+	j->pushed_ns = now_ns();
+	/* never blocks, there are no more jobs than room in the pipe */
+	to_process.enqueue(j);
+	return true;
+}
+
+void photo_queue::stop() {
+	if (!process_thread)
+		return;
+
+	/* the threads pass the NULL on and end once the jobs before it are done */
+	job *end = NULL;
+	to_process.enqueue(end);
+	process_thread.reset();
+	write_thread.reset();
+
+	job *j;
+	while (free_jobs.dequeue_or_timeout(j, 0))
+		;
+	jobs.clear();
+}
+
+void photo_queue::_process_thread(photo_queue *q) {
+	processor p(q->rotation);
+	job *j;
+	while (q->to_process.dequeue(j)) {
+		if (j == NULL) {
+			q->to_write.enqueue(j);
+			return;
+		}
+
+		const uint64_t start = now_ns();
+		j->result = photo_result();
+		j->result.path = j->path;
+		j->result.wait_ns = start - j->pushed_ns;
+		try {
+			j->result.processed = q->_process(*j, p);
+		} catch (std::exception&) {
+			/* e.g. out of memory for a large photo: save it as captured */
+			j->result.processed = false;
+		}
+		j->result.process_ns = now_ns() - start;
+		q->to_write.enqueue(j);
+	}
+}
+
+void photo_queue::_write_thread(photo_queue *q) {
+	job *j;
+	while (q->to_write.dequeue(j)) {
+		if (j == NULL)
+			return;
+
+		const uint64_t start = now_ns();
+		q->_write(*j);
+		j->result.write_ns = now_ns() - start;
+		if (q->cb != NULL)
+			q->cb(j->result);
+		q->free_jobs.enqueue(j);
+	}
+}
+
+/*
+ * Applies the filter and the sticker of a job to its photo and leaves the
+ * result, upright, in j.out.
+ *
+ * @return false if the photo should be written as captured: there is
+ *         nothing to apply, or it could not be decoded
+ */
+bool photo_queue::_process(job& j, processor& p) {
+	const bool filter = filter_preset_chain(j.filter)[0] != '\0';
+	const bool sticker = j.sticker != STICKER_NONE && sp != NULL
+			&& sp->num_parts() != 0;
+	if (!filter && !sticker)
+		return false;
+
+#if defined(DLIB_JPEG_SUPPORT)
+	try {
+		dlib::load_jpeg(p.rgb, &j.jpeg[0], j.jpeg.size());
+	} catch (dlib::image_load_error&) {
+		return false;
+	}
+	const long width = p.rgb.nc() & ~1L;
+	const long height = p.rgb.nr() & ~1L;
+	if (width == 0 || height == 0)
+		return false;
+
+	p.yuv.resize(width * height * 3 / 2);
+	const nv12_frame frame(&p.yuv[0], &p.yuv[width * height], width, height,
+			width);
+	_rgb_to_nv12(p.rgb, frame);
+
+	p.shapes.clear();
+	if (sticker) {
+		/*
+		 * The faces are found in a decode scaled down by libjpeg, and the
+		 * landmarks on the full photo.
+		 */
+		unsigned long scale = 1;
+		while (scale < 8
+				&& std::min(width, height) / (long) (scale * 2)
+						>= PHOTO_DETECT_SIDE)
+			scale *= 2;
+		dlib::load_jpeg_luma(p.small, &j.jpeg[0], j.jpeg.size(), scale);
+		if (!p.has_detector) {
+			p.detector = dlib::get_frontal_face_detector();
+			p.has_detector = true;
+		}
+		p.detector.detect(
+				preview_luma_image(&p.small[0][0], p.small.nc(), p.small.nr(),
+						p.small.nc(), rotation), p.det_ws, p.dets);
+
+		const preview_luma_image img(frame.y, width, height, frame.stride,
+				rotation);
+		const dlib::rectangle bounds = dlib::get_rect(img);
+		const long s = scale;
+		p.faces.clear();
+		for (size_t i = 0; i < p.dets.size(); i++) {
+			const dlib::rectangle& r = p.dets[i].rect;
+			const dlib::rectangle face = dlib::rectangle(r.left() * s,
+					r.top() * s, r.right() * s + s - 1, r.bottom() * s + s - 1)
+					.intersect(bounds);
+			if (!face.is_empty())
+				p.faces.push_back(face);
+		}
+		if (!p.faces.empty())
+			(*sp)(img, p.faces, p.shapes, p.sp_ws);
+	}
+	if (!filter && p.shapes.empty())
+		return false;
+
+	if (filter) {
+		if (j.filter != p.pipeline_filter) {
+			p.pipeline.set_chain(filter_preset_chain(j.filter), p.pool);
+			p.pipeline_filter = j.filter;
+		}
+		p.pipeline.run(frame);
+	}
+
+	if (!p.shapes.empty() && !p.stickers_loaded) {
+		p.stickers.load(resource_dir.c_str());
+		p.stickers_loaded = true;
+	}
+	for (size_t i = 0; i < p.shapes.size(); i++)
+		p.stickers.draw(frame, j.sticker, p.shapes[i]);
+	j.result.faces = p.shapes.size();
+
+	_nv12_to_rgb(frame, rotation, j.out);
+	return true;
+#else
+	/* push() logged that photos aren't processed in this build */
+	(void) p;
+	return false;
+#endif
+}
+
+/*
+ * Encodes the photo of a job, or takes it as captured, and writes it next to
+ * its path first so no one sees it half written.
+ */
+void photo_queue::_write(job& j) {
+	const std::string part = j.path + ".part";
+	bool ok = false;
+
+#if defined(DLIB_JPEG_SUPPORT)
+	if (j.result.processed) {
+		try {
+			/* libjpeg writes through a stdio buffer of its own */
+			dlib::save_jpeg(j.out, part, PHOTO_JPEG_QUALITY);
+			ok = true;
+		} catch (std::exception&) {
+			ok = false;
+		}
+	}
+#endif
+	if (!ok) {
+		/* as captured, in one write of the whole file */
+		j.result.processed = false;
+		FILE *file = fopen(part.c_str(), "wb");
+		if (file != NULL) {
+			ok = fwrite(&j.jpeg[0], 1, j.jpeg.size(), file) == j.jpeg.size();
+			if (fclose(file) != 0)
+				ok = false;
+		}
+	}
+
+	if (ok)
+		ok = rename(part.c_str(), j.path.c_str()) == 0;
+	if (!ok)
+		remove(part.c_str());
+	j.result.ok = ok;
+}
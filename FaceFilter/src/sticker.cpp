@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sticker.h"
+#include <math.h>
+#if defined(DLIB_PNG_SUPPORT)
+#include <dlib/image_loader/png_loader.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define STICKER_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define STICKER_SSE2
+#endif
+
+/* quantization steps of the sticker sizes per octave */
+#define STEPS_PER_OCTAVE 16
+
+/*
+ * d = p + d * (255 - a) / 255 for n bytes.  The division is done as
+ * (d * (256 - a - (a >> 7))) >> 8, which is exact for a == 0 and a == 255
+ * and within one step in between; every path computes the same bytes.
+ */
+static void _blend_row(unsigned char *d, const unsigned char *p,
+		const unsigned char *a, long n) {
+	long i = 0;
+#if defined(STICKER_NEON)
+	const uint16x8_t c256 = vdupq_n_u16(256);
+	for (; i + 16 <= n; i += 16) {
+		const uint8x16_t av = vld1q_u8(a + i);
+		const uint8x16_t dv = vld1q_u8(d + i);
+		const uint16x8_t alo = vmovl_u8(vget_low_u8(av));
+		const uint16x8_t ahi = vmovl_u8(vget_high_u8(av));
+		const uint16x8_t ilo = vsubq_u16(c256, vsraq_n_u16(alo, alo, 7));
+		const uint16x8_t ihi = vsubq_u16(c256, vsraq_n_u16(ahi, ahi, 7));
+		const uint8x8_t rlo = vshrn_n_u16(
+				vmulq_u16(vmovl_u8(vget_low_u8(dv)), ilo), 8);
+		const uint8x8_t rhi = vshrn_n_u16(
+				vmulq_u16(vmovl_u8(vget_high_u8(dv)), ihi), 8);
+		vst1q_u8(d + i, vqaddq_u8(vcombine_u8(rlo, rhi), vld1q_u8(p + i)));
+	}
+#elif defined(STICKER_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i c256 = _mm_set1_epi16(256);
+	for (; i + 16 <= n; i += 16) {
+		const __m128i av = _mm_loadu_si128((const __m128i *) (a + i));
+		const __m128i dv = _mm_loadu_si128((const __m128i *) (d + i));
+		const __m128i alo = _mm_unpacklo_epi8(av, zero);
+		const __m128i ahi = _mm_unpackhi_epi8(av, zero);
+		const __m128i ilo = _mm_sub_epi16(c256,
+				_mm_add_epi16(alo, _mm_srli_epi16(alo, 7)));
+		const __m128i ihi = _mm_sub_epi16(c256,
+				_mm_add_epi16(ahi, _mm_srli_epi16(ahi, 7)));
+		const __m128i rlo = _mm_srli_epi16(
+				_mm_mullo_epi16(_mm_unpacklo_epi8(dv, zero), ilo), 8);
+		const __m128i rhi = _mm_srli_epi16(
+				_mm_mullo_epi16(_mm_unpackhi_epi8(dv, zero), ihi), 8);
+		_mm_storeu_si128((__m128i *) (d + i),
+				_mm_adds_epu8(_mm_packus_epi16(rlo, rhi),
+						_mm_loadu_si128((const __m128i *) (p + i))));
+	}
+#endif
+	for (; i < n; i++) {
+		const unsigned int r = (d[i] * (256 - a[i] - (a[i] >> 7))) >> 8;
+		const unsigned int s = r + p[i];
+		d[i] = s > 255 ? 255 : s;
+	}
+}
+
+void sticker_blend(const nv12_frame& frame, const sticker_bitmap& bm, long x,
+		long y) {
+	x -= x & 1;
+	y -= y & 1;
+
+	/* NV12 frames have even sizes; an odd last row or column is left alone */
+	const long fw = frame.width & ~1L;
+	const long fh = frame.height & ~1L;
+	const long x0 = x < 0 ? 0 : x;
+	const long y0 = y < 0 ? 0 : y;
+	const long x1 = x + bm.width < fw ? x + bm.width : fw;
+	const long y1 = y + bm.height < fh ? y + bm.height : fh;
+	if (x0 >= x1 || y0 >= y1)
+		return;
+
+	const long n = x1 - x0;
+	for (long r = y0; r < y1; r++) {
+		const long off = (r - y) * bm.width + (x0 - x);
+		_blend_row(frame.y + r * frame.stride + x0, &bm.y[off], &bm.a[off], n);
+	}
+	/* y0 and y1 are even, so every chroma row is covered by two luma rows */
+	for (long r = y0; r < y1; r += 2) {
+		const long off = (r - y) / 2 * bm.width + (x0 - x);
+		_blend_row(frame.uv + r / 2 * frame.stride + x0, &bm.uv[off],
+				&bm.uv_a[off], n);
+	}
+}
+
+/* rounds up to an even size of at least 2 */
+static inline long _even(double v) {
+	const long n = lround(v);
+	return n < 2 ? 2 : (n + 1) & ~1L;
+}
+
+static inline unsigned char _clamp_byte(double v) {
+	return v <= 0 ? 0 : v >= 255 ? 255 : (unsigned char) lround(v);
+}
+
+sticker_cache::sticker_cache(preview_rotation_e rotation_) :
+		rotation(rotation_), uses(0) {
+	scaled.nc = scaled.nr = 0;
+}
+
+int sticker_cache::load(const char *path) {
+#if defined(DLIB_PNG_SUPPORT)
+	try {
+		dlib::array2d<dlib::rgb_alpha_pixel> img;
+		dlib::load_png(img, path);
+		return add(img);
+	} catch (dlib::error&) {
+		return -1;
+	}
+#else
+	(void) path;
+	return -1;
+#endif
+}
+
+int sticker_cache::add(const dlib::array2d<dlib::rgb_alpha_pixel>& img) {
+	if (img.size() == 0)
+		return -1;
+
+	stickers.push_back(sticker());
+	std::vector<rgba_image>& mips = stickers.back().mips;
+
+	rgba_image base;
+	base.nc = img.nc();
+	base.nr = img.nr();
+	base.px.resize(base.nc * base.nr * 4);
+	unsigned char *q = &base.px[0];
+	for (long r = 0; r < img.nr(); r++) {
+		for (long c = 0; c < img.nc(); c++, q += 4) {
+			const dlib::rgb_alpha_pixel& p = img[r][c];
+			q[0] = (p.red * p.alpha + 127) / 255;
+			q[1] = (p.green * p.alpha + 127) / 255;
+			q[2] = (p.blue * p.alpha + 127) / 255;
+			q[3] = p.alpha;
+		}
+	}
+	mips.push_back(base);
+
+	/* 2x2 box filter down to a few pixels; exact on premultiplied data */
+	while (mips.back().nc >= 4 && mips.back().nr >= 4) {
+		const rgba_image& src = mips.back();
+		rgba_image half;
+		half.nc = src.nc / 2;
+		half.nr = src.nr / 2;
+		half.px.resize(half.nc * half.nr * 4);
+		for (long r = 0; r < half.nr; r++) {
+			const unsigned char *s0 = &src.px[(2 * r) * src.nc * 4];
+			const unsigned char *s1 = s0 + src.nc * 4;
+			unsigned char *d = &half.px[r * half.nc * 4];
+			for (long c = 0; c < half.nc; c++, s0 += 8, s1 += 8, d += 4)
+				for (int k = 0; k < 4; k++)
+					d[k] = (s0[k] + s0[k + 4] + s1[k] + s1[k + 4] + 2) >> 2;
+		}
+		mips.push_back(half);
+	}
+
+	return (int) stickers.size() - 1;
+}
+
+double sticker_cache::aspect(int id) const {
+	const rgba_image& base = stickers[id].mips[0];
+	return (double) base.nr / base.nc;
+}
+
+const sticker_bitmap& sticker_cache::get(int id, double width) {
+	sticker& s = stickers[id];
+	const int step = (int) floor(
+			STEPS_PER_OCTAVE * log2(width < 2 ? 2 : width) + 0.5);
+
+	uses++;
+	std::map<int, sticker_bitmap>::iterator it = s.sizes.find(step);
+	if (it == s.sizes.end()) {
+		if (s.sizes.size() >= STICKER_MAX_SIZES) {
+			std::map<int, sticker_bitmap>::iterator oldest = s.sizes.begin();
+			for (it = s.sizes.begin(); it != s.sizes.end(); ++it)
+				if (it->second.last_used < oldest->second.last_used)
+					oldest = it;
+			s.sizes.erase(oldest);
+		}
+		const double w = pow(2.0, (double) step / STEPS_PER_OCTAVE);
+		it = s.sizes.insert(std::make_pair(step, sticker_bitmap())).first;
+		_build(s, _even(w), _even(w * aspect(id)), it->second);
+	}
+	it->second.last_used = uses;
+	return it->second;
+}
+
+/*
+ * Resamples a sticker to width x height pixels of the view, turns it to the
+ * frame orientation and converts it to premultiplied NV12.
+ */
+void sticker_cache::_build(const sticker& s, long width, long height,
+		sticker_bitmap& bm) {
+	/* the smallest mip level still at least as large as the target */
+	size_t level = 0;
+	while (level + 1 < s.mips.size() && s.mips[level + 1].nc >= width
+			&& s.mips[level + 1].nr >= height)
+		level++;
+	const rgba_image& src = s.mips[level];
+
+	/* bilinear, with 8-bit fixed-point weights and clamped edges */
+	scaled.nc = width;
+	scaled.nr = height;
+	scaled.px.resize(width * height * 4);
+	const double sx = (double) src.nc / width;
+	const double sy = (double) src.nr / height;
+	unsigned char *d = &scaled.px[0];
+	for (long r = 0; r < height; r++) {
+		double fy = (r + 0.5) * sy - 0.5;
+		fy = fy < 0 ? 0 : fy;
+		long y0 = (long) fy;
+		const long y1 = y0 + 1 < src.nr ? y0 + 1 : src.nr - 1;
+		const int wy = (int) ((fy - y0) * 256);
+		for (long c = 0; c < width; c++, d += 4) {
+			double fx = (c + 0.5) * sx - 0.5;
+			fx = fx < 0 ? 0 : fx;
+			long x0 = (long) fx;
+			const long x1 = x0 + 1 < src.nc ? x0 + 1 : src.nc - 1;
+			const int wx = (int) ((fx - x0) * 256);
+			const unsigned char *p00 = &src.px[(y0 * src.nc + x0) * 4];
+			const unsigned char *p01 = &src.px[(y0 * src.nc + x1) * 4];
+			const unsigned char *p10 = &src.px[(y1 * src.nc + x0) * 4];
+			const unsigned char *p11 = &src.px[(y1 * src.nc + x1) * 4];
+			for (int k = 0; k < 4; k++) {
+				const int top = p00[k] * (256 - wx) + p01[k] * wx;
+				const int bottom = p10[k] * (256 - wx) + p11[k] * wx;
+				d[k] = (top * (256 - wy) + bottom * wy + (1 << 15)) >> 16;
+			}
+		}
+	}
+
+	/* turn to the frame: (u, v) of the frame bitmap reads (sx, sy) of scaled */
+	const bool turned = rotation == PREVIEW_ROTATION_90
+			|| rotation == PREVIEW_ROTATION_270;
+	bm.width = turned ? height : width;
+	bm.height = turned ? width : height;
+	bm.y.resize(bm.width * bm.height);
+	bm.a.resize(bm.width * bm.height);
+	bm.uv.resize(bm.width * bm.height / 2);
+	bm.uv_a.resize(bm.width * bm.height / 2);
+	std::vector<double> cb(bm.width * bm.height), cr(bm.width * bm.height);
+
+	for (long v = 0; v < bm.height; v++) {
+		for (long u = 0; u < bm.width; u++) {
+			long x, y;
+			switch (rotation) {
+			case PREVIEW_ROTATION_90:
+				x = width - 1 - v;
+				y = u;
+				break;
+			case PREVIEW_ROTATION_180:
+				x = width - 1 - u;
+				y = height - 1 - v;
+				break;
+			case PREVIEW_ROTATION_270:
+				x = v;
+				y = height - 1 - u;
+				break;
+			default:
+				x = u;
+				y = v;
+				break;
+			}
+			const unsigned char *p = &scaled.px[(y * width + x) * 4];
+			const double a = p[3] / 255.0;
+			/* BT.601 video range, applied to premultiplied RGB */
+			const long i = v * bm.width + u;
+			bm.y[i] = _clamp_byte(
+					16 * a + 0.2568 * p[0] + 0.5041 * p[1] + 0.0979 * p[2]);
+			bm.a[i] = p[3];
+			cb[i] = 128 * a - 0.1482 * p[0] - 0.2910 * p[1] + 0.4392 * p[2];
+			cr[i] = 128 * a + 0.4392 * p[0] - 0.3678 * p[1] - 0.0714 * p[2];
+		}
+	}
+
+	for (long v = 0; v < bm.height; v += 2) {
+		for (long u = 0; u < bm.width; u += 2) {
+			const long i = v * bm.width + u;
+			const long j = i + bm.width;
+			const long o = v / 2 * bm.width + u;
+			const double pcb = (cb[i] + cb[i + 1] + cb[j] + cb[j + 1]) / 4;
+			const double pcr = (cr[i] + cr[i + 1] + cr[j] + cr[j + 1]) / 4;
+			const unsigned char a = (bm.a[i] + bm.a[i + 1] + bm.a[j]
+					+ bm.a[j + 1] + 2) >> 2;
+			bm.uv[o] = _clamp_byte(pcb);
+			bm.uv[o + 1] = _clamp_byte(pcr);
+			bm.uv_a[o] = a;
+			bm.uv_a[o + 1] = a;
+		}
+	}
+}
+
+void sticker_cache::draw(const nv12_frame& frame, int id,
+		const dlib::dpoint& center, double width) {
+	const sticker_bitmap& bm = get(id, width);
+	const bool turned = rotation == PREVIEW_ROTATION_90
+			|| rotation == PREVIEW_ROTATION_270;
+	const long vw = turned ? bm.height : bm.width;
+	const long vh = turned ? bm.width : bm.height;
+
+	/* top left corner in the view, then the top left corner in the frame */
+	const long c0 = lround(center.x() - vw / 2.0);
+	const long r0 = lround(center.y() - vh / 2.0);
+	long x, y;
+	switch (rotation) {
+	case PREVIEW_ROTATION_90:
+		x = r0;
+		y = frame.height - c0 - vw;
+		break;
+	case PREVIEW_ROTATION_180:
+		x = frame.width - c0 - vw;
+		y = frame.height - r0 - vh;
+		break;
+	case PREVIEW_ROTATION_270:
+		x = frame.width - r0 - vh;
+		y = c0;
+		break;
+	default:
+		x = c0;
+		y = r0;
+		break;
+	}
+	sticker_blend(frame, bm, x, y);
+}
+
+void sticker_cache::clear() {
+	stickers.clear();
+}
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "yuv_convolve.h"
+#include <string.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define YUV_CONVOLVE_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define YUV_CONVOLVE_SSE2
+#endif
+
+/* Gaussian weights in 1/256, from the old 3x3 mask .0113/.0838/.6193 */
+#define GAUSS_SIDE 27
+#define GAUSS_CENTER 202
+
+/*
+ * Row kernels.  Every kernel has a vector loop for the interior, a scalar loop
+ * for what the vector loop leaves over, and handles the first and last `step`
+ * columns on their own so the interior never needs a bounds check.
+ */
+
+static inline unsigned char _gauss(int a, int b, int c) {
+	return (unsigned char) ((GAUSS_SIDE * (a + c) + GAUSS_CENTER * b + 128) >> 8);
+}
+
+static inline unsigned char _clamp(int v) {
+	return (unsigned char) (v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+/* weighted sum of a 3-tap neighbourhood, 16 bytes at a time */
+#if defined(YUV_CONVOLVE_NEON)
+static inline uint8x16_t _gauss16(uint8x16_t a, uint8x16_t b, uint8x16_t c) {
+	uint16x8_t lo = vaddl_u8(vget_low_u8(a), vget_low_u8(c));
+	uint16x8_t hi = vaddl_u8(vget_high_u8(a), vget_high_u8(c));
+	lo = vmulq_n_u16(lo, GAUSS_SIDE);
+	hi = vmulq_n_u16(hi, GAUSS_SIDE);
+	lo = vmlal_u8(lo, vget_low_u8(b), vdup_n_u8(GAUSS_CENTER));
+	hi = vmlal_u8(hi, vget_high_u8(b), vdup_n_u8(GAUSS_CENTER));
+	return vcombine_u8(vrshrn_n_u16(lo, 8), vrshrn_n_u16(hi, 8));
+}
+#elif defined(YUV_CONVOLVE_SSE2)
+static inline __m128i _gauss8(__m128i a, __m128i b, __m128i c) {
+	const __m128i side = _mm_set1_epi16(GAUSS_SIDE);
+	const __m128i center = _mm_set1_epi16(GAUSS_CENTER);
+	const __m128i round = _mm_set1_epi16(128);
+	__m128i sum = _mm_mullo_epi16(_mm_add_epi16(a, c), side);
+	sum = _mm_add_epi16(sum, _mm_mullo_epi16(b, center));
+	return _mm_srli_epi16(_mm_add_epi16(sum, round), 8);
+}
+
+static inline __m128i _gauss16(__m128i a, __m128i b, __m128i c) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i lo = _gauss8(_mm_unpacklo_epi8(a, zero),
+			_mm_unpacklo_epi8(b, zero), _mm_unpacklo_epi8(c, zero));
+	const __m128i hi = _gauss8(_mm_unpackhi_epi8(a, zero),
+			_mm_unpackhi_epi8(b, zero), _mm_unpackhi_epi8(c, zero));
+	return _mm_packus_epi16(lo, hi);
+}
+#endif
+
+static inline void _load3_store(const unsigned char *a, const unsigned char *b,
+		const unsigned char *c, unsigned char *dst) {
+#if defined(YUV_CONVOLVE_NEON)
+	vst1q_u8(dst, _gauss16(vld1q_u8(a), vld1q_u8(b), vld1q_u8(c)));
+#elif defined(YUV_CONVOLVE_SSE2)
+	_mm_storeu_si128((__m128i *) dst,
+			_gauss16(_mm_loadu_si128((const __m128i *) a),
+					_mm_loadu_si128((const __m128i *) b),
+					_mm_loadu_si128((const __m128i *) c)));
+#endif
+}
+
+/* horizontal Gaussian pass of one row */
+static void _gauss_row_h(const unsigned char *src, unsigned char *dst,
+		long width, int step) {
+	if (width <= 2 * step) {
+		for (long x = 0; x < width; x++)
+			dst[x] = _gauss(x >= step ? src[x - step] : 0, src[x],
+					x + step < width ? src[x + step] : 0);
+		return;
+	}
+
+	for (long x = 0; x < step; x++)
+		dst[x] = _gauss(0, src[x], src[x + step]);
+
+	long x = step;
+#if defined(YUV_CONVOLVE_NEON) || defined(YUV_CONVOLVE_SSE2)
+	for (; x + 16 <= width - step; x += 16)
+		_load3_store(src + x - step, src + x, src + x + step, dst + x);
+#endif
+	for (; x < width - step; x++)
+		dst[x] = _gauss(src[x - step], src[x], src[x + step]);
+
+	for (; x < width; x++)
+		dst[x] = _gauss(src[x - step], src[x], 0);
+}
+
+/* vertical Gaussian pass of one row, from the rows above and below */
+static void _gauss_row_v(const unsigned char *up, const unsigned char *mid,
+		const unsigned char *down, unsigned char *dst, long width) {
+	long x = 0;
+#if defined(YUV_CONVOLVE_NEON) || defined(YUV_CONVOLVE_SSE2)
+	for (; x + 16 <= width; x += 16)
+		_load3_store(up + x, mid + x, down + x, dst + x);
+#endif
+	for (; x < width; x++)
+		dst[x] = _gauss(up[x], mid[x], down[x]);
+}
+
+/*
+ * Emboss of one pixel.  u, m and d point at the same column in the rows
+ * above, at and below the pixel.
+ */
+static inline int _emboss(const unsigned char *u, const unsigned char *m,
+		const unsigned char *d, long l, long r) {
+	return 2 * (u[l] - d[r]) + (u[0] - d[0]) + (m[l] - m[r]) + m[0];
+}
+
+/* emboss of one row */
+static void _emboss_row(const unsigned char *up, const unsigned char *mid,
+		const unsigned char *down, unsigned char *dst, long width, int step) {
+	if (width <= 2 * step) {
+		/* too narrow for an interior, so go through a zero-padded copy */
+		unsigned char u[16] = { 0, }, m[16] = { 0, }, d[16] = { 0, };
+		memcpy(u + 4, up, width);
+		memcpy(m + 4, mid, width);
+		memcpy(d + 4, down, width);
+		for (long x = 0; x < width; x++)
+			dst[x] = _clamp(_emboss(u + 4 + x, m + 4 + x, d + 4 + x, -step,
+					step));
+		return;
+	}
+
+	/* left border: the left neighbours are outside the plane */
+	for (long x = 0; x < step; x++)
+		dst[x] = _clamp(
+				(up[x] - down[x]) - 2 * down[x + step] - mid[x + step]
+						+ mid[x]);
+
+	long x = step;
+#if defined(YUV_CONVOLVE_NEON)
+	for (; x + 16 <= width - step; x += 16) {
+		const uint8x16_t ul = vld1q_u8(up + x - step), uc = vld1q_u8(up + x);
+		const uint8x16_t ml = vld1q_u8(mid + x - step), mc = vld1q_u8(mid + x),
+				mr = vld1q_u8(mid + x + step);
+		const uint8x16_t dc = vld1q_u8(down + x), dr = vld1q_u8(down + x + step);
+		int16x8_t s[2];
+		for (int h = 0; h < 2; h++) {
+#define LANES(v) vreinterpretq_s16_u16(vmovl_u8(h ? vget_high_u8(v) : vget_low_u8(v)))
+			int16x8_t t = vshlq_n_s16(vsubq_s16(LANES(ul), LANES(dr)), 1);
+			t = vaddq_s16(t, vsubq_s16(LANES(uc), LANES(dc)));
+			t = vaddq_s16(t, vsubq_s16(LANES(ml), LANES(mr)));
+			s[h] = vaddq_s16(t, LANES(mc));
+#undef LANES
+		}
+		vst1q_u8(dst + x, vcombine_u8(vqmovun_s16(s[0]), vqmovun_s16(s[1])));
+	}
+#elif defined(YUV_CONVOLVE_SSE2)
+	const __m128i z = _mm_setzero_si128();
+	for (; x + 16 <= width - step; x += 16) {
+#define LOAD(p) _mm_loadu_si128((const __m128i *) (p))
+		const __m128i ul = LOAD(up + x - step), uc = LOAD(up + x);
+		const __m128i ml = LOAD(mid + x - step), mc = LOAD(mid + x), mr = LOAD(
+				mid + x + step);
+		const __m128i dc = LOAD(down + x), dr = LOAD(down + x + step);
+#undef LOAD
+		__m128i s[2];
+		for (int h = 0; h < 2; h++) {
+#define LANES(v) (h ? _mm_unpackhi_epi8(v, z) : _mm_unpacklo_epi8(v, z))
+			__m128i t = _mm_slli_epi16(_mm_sub_epi16(LANES(ul), LANES(dr)), 1);
+			t = _mm_add_epi16(t, _mm_sub_epi16(LANES(uc), LANES(dc)));
+			t = _mm_add_epi16(t, _mm_sub_epi16(LANES(ml), LANES(mr)));
+			s[h] = _mm_add_epi16(t, LANES(mc));
+#undef LANES
+		}
+		_mm_storeu_si128((__m128i *) (dst + x), _mm_packus_epi16(s[0], s[1]));
+	}
+#endif
+	for (; x < width - step; x++)
+		dst[x] = _clamp(_emboss(up + x, mid + x, down + x, -step, step));
+
+	/* right border: the right neighbours are outside the plane */
+	for (; x < width; x++)
+		dst[x] = _clamp(
+				2 * up[x - step] + (up[x] - down[x]) + mid[x - step] + mid[x]);
+}
+
+yuv_convolver::yuv_convolver(dlib::thread_pool& tp_) :
+		tp(tp_) {
+}
+
+void yuv_convolver::_reserve(long width, long height) {
+	if (buf.size() < (size_t) (width * height))
+		buf.resize(width * height);
+	if (zero_row.size() < (size_t) width)
+		zero_row.resize(width, 0);
+}
+
+void yuv_convolver::gaussian(unsigned char *plane, long width, long height,
+		long stride, int step) {
+	if (width <= 0 || height <= 0)
+		return;
+	_reserve(width, height);
+	unsigned char *tmp = &buf[0];
+	const unsigned char *zero = &zero_row[0];
+
+	/* horizontal pass from the plane into buf ... */
+	dlib::parallel_for_blocked(tp, 0, height, [&](long begin, long end) {
+		for (long y = begin; y < end; y++)
+			_gauss_row_h(plane + y * stride, tmp + y * width, width, step);
+	});
+
+	/* ... and the vertical pass from buf back into the plane */
+	dlib::parallel_for_blocked(tp, 0, height, [&](long begin, long end) {
+		for (long y = begin; y < end; y++) {
+			const unsigned char *up = y > 0 ? tmp + (y - 1) * width : zero;
+			const unsigned char *down =
+					y + 1 < height ? tmp + (y + 1) * width : zero;
+			_gauss_row_v(up, tmp + y * width, down, plane + y * stride, width);
+		}
+	});
+}
+
+void yuv_convolver::emboss(unsigned char *plane, long width, long height,
+		long stride, int step) {
+	if (width <= 0 || height <= 0)
+		return;
+	_reserve(width, height);
+	unsigned char *tmp = &buf[0];
+	const unsigned char *zero = &zero_row[0];
+
+	/* the kernel isn't separable, so keep the original plane in buf ... */
+	dlib::parallel_for_blocked(tp, 0, height, [&](long begin, long end) {
+		for (long y = begin; y < end; y++)
+			memcpy(tmp + y * width, plane + y * stride, width);
+	});
+
+	/* ... and write the result straight into the plane */
+	dlib::parallel_for_blocked(tp, 0, height, [&](long begin, long end) {
+		for (long y = begin; y < end; y++) {
+			const unsigned char *up = y > 0 ? tmp + (y - 1) * width : zero;
+			const unsigned char *down =
+					y + 1 < height ? tmp + (y + 1) * width : zero;
+			_emboss_row(up, tmp + y * width, down, plane + y * stride, width,
+					step);
+		}
+	});
+}
+
+void yuv_convolver::gaussian(const nv12_frame& frame) {
+	gaussian(frame.y, frame.width, frame.height, frame.stride, 1);
+	gaussian(frame.uv, frame.width, frame.height / 2, frame.stride, 2);
+}
+
+void yuv_convolver::emboss(const nv12_frame& frame) {
+	emboss(frame.y, frame.width, frame.height, frame.stride, 1);
+	emboss(frame.uv, frame.width, frame.height / 2, frame.stride, 2);
+}
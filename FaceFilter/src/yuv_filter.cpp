@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "yuv_filter.h"
+#include <string.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define YUV_FILTER_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define YUV_FILTER_SSE2
+#endif
+
+/*
+ * The kernels below handle 16 bytes per step and leave the remaining tail to
+ * the scalar loop, so they accept planes of any size and alignment.  Blocks
+ * always start at an even offset from the start of the plane, which keeps
+ * the Cb/Cr interleaving lined up with the byte lanes.
+ */
+
+/*
+ * d * 1.2, rounded down, without floating point.  (d * 205) >> 10 == d / 5
+ * for every byte value, and fits in 16 bits.
+ */
+static inline unsigned int _boost(unsigned int d) {
+	return d + ((d * 205) >> 10);
+}
+
+void yuv_filter_invert(unsigned char *data, size_t size) {
+	size_t i = 0;
+#if defined(YUV_FILTER_NEON)
+	for (; i + 16 <= size; i += 16)
+		vst1q_u8(data + i, vmvnq_u8(vld1q_u8(data + i)));
+#elif defined(YUV_FILTER_SSE2)
+	const __m128i ones = _mm_set1_epi8(-1);
+	for (; i + 16 <= size; i += 16) {
+		__m128i *p = (__m128i *) (data + i);
+		_mm_storeu_si128(p, _mm_xor_si128(_mm_loadu_si128(p), ones));
+	}
+#endif
+	for (; i < size; i++)
+		data[i] = 255 - data[i];
+}
+
+void yuv_filter_chroma(unsigned char *uv, size_t size, unsigned char cb_mask,
+		unsigned char cr_mask, unsigned char cb, unsigned char cr) {
+	if (cb_mask == 0 && cr_mask == 0 && cb == cr) {
+		memset(uv, cb, size);
+		return;
+	}
+
+	size_t i = 0;
+#if defined(YUV_FILTER_NEON)
+	const uint8x16_t mask = vreinterpretq_u8_u16(
+			vdupq_n_u16(cb_mask | (cr_mask << 8)));
+	const uint8x16_t bits = vreinterpretq_u8_u16(vdupq_n_u16(cb | (cr << 8)));
+	for (; i + 16 <= size; i += 16)
+		vst1q_u8(uv + i, vorrq_u8(vandq_u8(vld1q_u8(uv + i), mask), bits));
+#elif defined(YUV_FILTER_SSE2)
+	const __m128i mask = _mm_set1_epi16((short) (cb_mask | (cr_mask << 8)));
+	const __m128i bits = _mm_set1_epi16((short) (cb | (cr << 8)));
+	for (; i + 16 <= size; i += 16) {
+		__m128i *p = (__m128i *) (uv + i);
+		_mm_storeu_si128(p,
+				_mm_or_si128(_mm_and_si128(_mm_loadu_si128(p), mask), bits));
+	}
+#endif
+	for (; i + 2 <= size; i += 2) {
+		uv[i] = (uv[i] & cb_mask) | cb;
+		uv[i + 1] = (uv[i + 1] & cr_mask) | cr;
+	}
+	if (i < size)
+		uv[i] = (uv[i] & cb_mask) | cb;
+}
+
+#if defined(YUV_FILTER_NEON)
+/* _boost() of all 16 lanes, clamped to 255 */
+static inline uint8x16_t _boost_neon(uint8x16_t d) {
+	const uint16x8_t lo = vmovl_u8(vget_low_u8(d));
+	const uint16x8_t hi = vmovl_u8(vget_high_u8(d));
+	const uint16x8_t blo = vaddq_u16(lo, vshrq_n_u16(vmulq_n_u16(lo, 205), 10));
+	const uint16x8_t bhi = vaddq_u16(hi, vshrq_n_u16(vmulq_n_u16(hi, 205), 10));
+	return vcombine_u8(vqmovn_u16(blo), vqmovn_u16(bhi));
+}
+#elif defined(YUV_FILTER_SSE2)
+/* _boost() of all 16 lanes, clamped to 255 */
+static inline __m128i _boost_sse2(__m128i d) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i k = _mm_set1_epi16(205);
+	const __m128i lo = _mm_unpacklo_epi8(d, zero);
+	const __m128i hi = _mm_unpackhi_epi8(d, zero);
+	const __m128i blo = _mm_add_epi16(lo,
+			_mm_srli_epi16(_mm_mullo_epi16(lo, k), 10));
+	const __m128i bhi = _mm_add_epi16(hi,
+			_mm_srli_epi16(_mm_mullo_epi16(hi, k), 10));
+	return _mm_packus_epi16(blo, bhi);
+}
+
+static inline __m128i _select_sse2(__m128i mask, __m128i a, __m128i b) {
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+#endif
+
+void yuv_filter_boost_dark(unsigned char *data, size_t size) {
+	size_t i = 0;
+#if defined(YUV_FILTER_NEON)
+	const uint8x16_t limit = vdupq_n_u8(128);
+	for (; i + 16 <= size; i += 16) {
+		const uint8x16_t d = vld1q_u8(data + i);
+		vst1q_u8(data + i, vbslq_u8(vcltq_u8(d, limit), _boost_neon(d), d));
+	}
+#elif defined(YUV_FILTER_SSE2)
+	for (; i + 16 <= size; i += 16) {
+		__m128i *p = (__m128i *) (data + i);
+		const __m128i d = _mm_loadu_si128(p);
+		/* bytes below 128 are the non-negative ones when read as signed */
+		const __m128i dark = _mm_cmpgt_epi8(d, _mm_set1_epi8(-1));
+		_mm_storeu_si128(p, _select_sse2(dark, _boost_sse2(d), d));
+	}
+#endif
+	for (; i < size; i++)
+		if (data[i] < 128)
+			data[i] = (unsigned char) _boost(data[i]);
+}
+
+void yuv_filter_boost_even(unsigned char *data, size_t size) {
+	size_t i = 0;
+#if defined(YUV_FILTER_NEON)
+	const uint8x16_t one = vdupq_n_u8(1);
+	for (; i + 16 <= size; i += 16) {
+		const uint8x16_t d = vld1q_u8(data + i);
+		const uint8x16_t even = vceqq_u8(vandq_u8(d, one), vdupq_n_u8(0));
+		vst1q_u8(data + i, vbslq_u8(even, _boost_neon(d), d));
+	}
+#elif defined(YUV_FILTER_SSE2)
+	const __m128i one = _mm_set1_epi8(1);
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= size; i += 16) {
+		__m128i *p = (__m128i *) (data + i);
+		const __m128i d = _mm_loadu_si128(p);
+		const __m128i even = _mm_cmpeq_epi8(_mm_and_si128(d, one), zero);
+		_mm_storeu_si128(p, _select_sse2(even, _boost_sse2(d), d));
+	}
+#endif
+	for (; i < size; i++) {
+		if (data[i] % 2 == 0) {
+			unsigned int v = _boost(data[i]);
+			data[i] = (unsigned char) (v > 255 ? 255 : v);
+		}
+	}
+}
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Times the frontal face detector per frame, and the two ways its five
+ * filterbanks can be run over a loaded FHOG pyramid:
+ *
+ * - one at a time, as object_detector did before scan_fhog_pyramid got its
+ *   detect() for several filterbanks: a scanner.detect() per filterbank;
+ * - all at once with that detect(), which thresholds the saliency images of
+ *   all the filterbanks in one pass over each pyramid level.
+ *
+ * Both must give the same detections.  Then the filtering of every pyramid
+ * level is timed in the two orders impl::apply_all_filters_to_fhog() chooses
+ * between: filterbank by filterbank, and plane by plane, running each FHOG
+ * plane through all the filterbanks while it is in cache.  Both must give the
+ * same saliency images.  detect() takes the second order on the levels whose
+ * working set fits in fused_fhog_filtering_bytes, which is the column to
+ * check against the timings on the target.  The frames are synthetic unless
+ * an image is given.
+ * Build it from the FaceFilter directory with something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/face_detector_bench.cpp -ldlib -lpthread
+ *
+ * and run it on the target device class, e.g. with 640 480 and 1920 1080.
+ */
+
+#include <dlib/image_processing/frontal_face_detector.h>
+#include <dlib/image_io.h>
+#include <chrono>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+typedef dlib::scan_fhog_pyramid<dlib::pyramid_down<6> > scanner_type;
+typedef dlib::processed_weight_vector<scanner_type> weight_vector;
+
+static void _usage(const char *argv0) {
+	fprintf(stderr, "usage: %s WIDTH HEIGHT [options]\n"
+			"       %s --image FILE [options]\n"
+			"options:\n"
+			"  --repeat N      runs of everything, the best is kept (default: 7)\n"
+			"  --threshold T   adjust_threshold of the detector (default: 0)\n",
+			argv0, argv0);
+}
+
+static inline uint64_t _now_ns() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*
+ * What object_detector did before scan_fhog_pyramid::detect() took all the
+ * filterbanks at once.
+ */
+static void _detect_separately(const scanner_type& scanner,
+		const std::vector<weight_vector>& w, double adjust_threshold,
+		std::vector<std::pair<double, dlib::rectangle> >& dets,
+		std::vector<dlib::rect_detection>& all) {
+	all.clear();
+	for (unsigned long k = 0; k < w.size(); k++) {
+		const double thresh = w[k].w(scanner.get_num_dimensions());
+		scanner.detect(w[k].get_detect_argument(), dets,
+				thresh + adjust_threshold);
+		for (size_t j = 0; j < dets.size(); j++) {
+			dlib::rect_detection d;
+			d.detection_confidence = dets[j].first - thresh;
+			d.weight_index = k;
+			d.rect = dets[j].second;
+			all.push_back(d);
+		}
+	}
+}
+
+static bool _same(const std::vector<dlib::rect_detection>& a,
+		const std::vector<dlib::rect_detection>& b) {
+	if (a.size() != b.size())
+		return false;
+	for (size_t i = 0; i < a.size(); i++)
+		if (a[i].rect != b[i].rect || a[i].weight_index != b[i].weight_index
+				|| a[i].detection_confidence != b[i].detection_confidence)
+			return false;
+	return true;
+}
+
+/*
+ * Filters one pyramid level with every filterbank through
+ * impl::apply_all_filters_to_fhog(), forced to one order or the other.
+ */
+static void _filter_level(const std::vector<weight_vector>& w,
+		const dlib::array<dlib::array2d<float> >& feats, bool by_plane,
+		dlib::array<dlib::array2d<float> >& saliency,
+		dlib::array2d<float>& scratch, std::vector<dlib::rectangle>& areas) {
+	dlib::impl::apply_all_filters_to_fhog(w, feats, &saliency[0], scratch, areas,
+			by_plane ? ULONG_MAX : 0);
+}
+
+static bool _same_saliency(const dlib::array<dlib::array2d<float> >& a,
+		const dlib::array<dlib::array2d<float> >& b) {
+	for (size_t k = 0; k < a.size(); k++) {
+		if (a[k].nr() != b[k].nr() || a[k].nc() != b[k].nc())
+			return false;
+		for (long r = 0; r < a[k].nr(); r++)
+			for (long c = 0; c < a[k].nc(); c++)
+				if (a[k][r][c] != b[k][r][c])
+					return false;
+	}
+	return true;
+}
+
+int main(int argc, char **argv) {
+	long width = 0, height = 0;
+	const char *image_path = NULL;
+	long repeat = 7;
+	double adjust_threshold = 0;
+	int i = 1;
+	if (argc >= 3 && argv[1][0] != '-') {
+		width = atol(argv[1]);
+		height = atol(argv[2]);
+		i = 3;
+	}
+	for (; i < argc; i++) {
+		if (!strcmp(argv[i], "--image") && i + 1 < argc)
+			image_path = argv[++i];
+		else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+			repeat = atol(argv[++i]);
+		else if (!strcmp(argv[i], "--threshold") && i + 1 < argc)
+			adjust_threshold = atof(argv[++i]);
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if ((image_path == NULL && (width <= 0 || height <= 0)) || repeat <= 0) {
+		_usage(argv[0]);
+		return 1;
+	}
+
+	dlib::array2d<unsigned char> img;
+	if (image_path != NULL) {
+		try {
+			dlib::load_image(img, image_path);
+		} catch (std::exception& e) {
+			fprintf(stderr, "can't load %s: %s\n", image_path, e.what());
+			return 1;
+		}
+	} else {
+		/* smooth waves with noise: plenty of gradients, no face */
+		img.set_size(height, width);
+		srand(5);
+		for (long r = 0; r < height; r++) {
+			for (long c = 0; c < width; c++) {
+				const int v = (int) (128 + 100 * sin(r * 0.05) * cos(c * 0.03))
+						+ rand() % 40;
+				img[r][c] = (unsigned char) (v < 0 ? 0 : (v > 255 ? 255 : v));
+			}
+		}
+	}
+
+	dlib::frontal_face_detector detector = dlib::get_frontal_face_detector();
+	std::vector<weight_vector> w;
+	for (unsigned long k = 0; k < detector.num_detectors(); k++)
+		w.push_back(detector.get_processed_w(k));
+
+	scanner_type scanner;
+	scanner.copy_configuration(detector.get_scanner());
+	scanner.load(img);
+
+	/* the same pyramid, to time the levels one by one */
+	dlib::array<dlib::array<dlib::array2d<float> > > feats;
+	dlib::impl::create_fhog_pyramid<dlib::pyramid_down<6> >(img,
+			scanner.get_feature_extractor(), feats, scanner.get_cell_size(),
+			scanner.get_fhog_window_height(), scanner.get_fhog_window_width(),
+			scanner.get_min_pyramid_layer_width(),
+			scanner.get_min_pyramid_layer_height(),
+			scanner.get_max_pyramid_levels());
+
+	std::vector<dlib::rect_detection> faces, separate, all;
+	std::vector<std::pair<double, dlib::rectangle> > dets;
+	uint64_t detector_ns = ~0ULL, separate_ns = ~0ULL, all_ns = ~0ULL;
+	std::vector<uint64_t> level_bank_ns(feats.size(), ~0ULL),
+			level_plane_ns(feats.size(), ~0ULL);
+	dlib::array<dlib::array2d<float> > saliency, plane_saliency;
+	saliency.set_max_size(w.size());
+	saliency.set_size(w.size());
+	plane_saliency.set_max_size(w.size());
+	plane_saliency.set_size(w.size());
+	bool same_saliency = true;
+	dlib::array2d<float> scratch;
+	std::vector<dlib::rectangle> areas(w.size());
+
+	for (long r = 0; r < repeat; r++) {
+		uint64_t start = _now_ns();
+		detector(img, faces, adjust_threshold);
+		detector_ns = std::min(detector_ns, _now_ns() - start);
+
+		start = _now_ns();
+		_detect_separately(scanner, w, adjust_threshold, dets, separate);
+		separate_ns = std::min(separate_ns, _now_ns() - start);
+
+		start = _now_ns();
+		scanner.detect(w, adjust_threshold, all);
+		all_ns = std::min(all_ns, _now_ns() - start);
+
+		for (size_t l = 0; l < feats.size(); l++) {
+			start = _now_ns();
+			_filter_level(w, feats[l], false, saliency, scratch, areas);
+			level_bank_ns[l] = std::min(level_bank_ns[l], _now_ns() - start);
+
+			start = _now_ns();
+			_filter_level(w, feats[l], true, plane_saliency, scratch, areas);
+			level_plane_ns[l] = std::min(level_plane_ns[l], _now_ns() - start);
+			same_saliency &= _same_saliency(saliency, plane_saliency);
+		}
+	}
+
+	if (!_same(separate, all)) {
+		fprintf(stderr, "detect() with all the filterbanks differs from the"
+				" separate scans\n");
+		return 1;
+	}
+	if (!same_saliency) {
+		fprintf(stderr, "the two filtering orders give different saliency"
+				" images\n");
+		return 1;
+	}
+
+	printf("%ldx%ld, %lu filterbanks, %lu pyramid levels, %lu faces,"
+			" best of %ld\n", img.nc(), img.nr(), (unsigned long) w.size(),
+			(unsigned long) feats.size(), (unsigned long) faces.size(), repeat);
+	printf("whole detector                 %8.2f ms/frame\n", detector_ns / 1e6);
+	printf("filterbanks one at a time      %8.2f ms\n", separate_ns / 1e6);
+	printf("detect() with all of them      %8.2f ms, %lu detections, the same\n",
+			all_ns / 1e6, (unsigned long) all.size());
+
+	printf("level  size (cells)  by filterbank  by plane  detect() uses\n");
+	for (size_t l = 0; l < feats.size(); l++) {
+		const unsigned long level_bytes = feats[l][0].size() * sizeof(float)
+				* (w.size() + 2);
+		printf("%5lu  %5ldx%-6ld %10.3f ms %8.3f ms  %s\n", (unsigned long) l,
+				feats[l][0].nc(), feats[l][0].nr(), level_bank_ns[l] / 1e6,
+				level_plane_ns[l] / 1e6,
+				level_bytes <= dlib::impl::fused_fhog_filtering_bytes ?
+						"by plane" : "by filterbank");
+	}
+	return 0;
+}
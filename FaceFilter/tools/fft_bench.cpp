@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Times one call of each 2D transform of dlib/matrix/matrix_fft.h on the
+ * square sizes correlation_tracker uses, 64x64 and 128x128 by default:
+ *
+ * - fft_inplace(data), which computes its twiddle factors and bit reversals
+ *   again on every call, as every transform did before fft_workspace;
+ * - fft_inplace(data, ws) and ifft_inplace(data, ws), which keep them in ws;
+ * - fft_real(data, out, ws), the transform of real data the tracker runs on
+ *   its feature planes.
+ *
+ * The first three transform a complex copy of the same real matrix, and
+ * the copy is timed with them, as the tracker made it before fft_real().
+ * The results are compared with fft() first.  Build it from the FaceFilter
+ * directory with something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/fft_bench.cpp
+ *
+ * and run it on the target device class.
+ */
+
+#include <dlib/matrix.h>
+#include <dlib/rand.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+typedef std::complex<double> complex_type;
+
+static void _usage(const char *argv0) {
+	fprintf(stderr, "usage: %s [options]\n"
+			"options:\n"
+			"  --size N        transform NxN matrices, a power of two (default:\n"
+			"                  64 and 128)\n"
+			"  --repeat N      calls of every transform, the best run of ten\n"
+			"                  is kept (default: 200)\n", argv0);
+}
+
+static inline uint64_t _now_ns() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*
+ * The largest difference between a and b, relative to the largest value
+ * of b.
+ */
+static double _relative_error(const dlib::matrix<complex_type>& a,
+		const dlib::matrix<complex_type>& b) {
+	return dlib::max(dlib::abs(a - b)) / dlib::max(dlib::abs(b));
+}
+
+/*
+ * Every transform must give what fft() and ifft() do, to rounding, and the
+ * workspace overloads exactly what the plain ones do.  ifft_inplace() leaves
+ * out the 1/size scaling of ifft().
+ */
+static bool _check(const dlib::matrix<double>& x,
+		dlib::fft_workspace<double>& ws) {
+	const dlib::matrix<complex_type> c = dlib::matrix_cast<complex_type>(x);
+	const dlib::matrix<complex_type> ref = dlib::fft(c);
+	const dlib::matrix<complex_type> iref = dlib::ifft(c) * (double) c.size();
+	dlib::matrix<complex_type> plain(c), with_ws(c), iplain(c), iwith_ws(c), out;
+	dlib::fft_inplace(plain);
+	dlib::fft_inplace(with_ws, ws);
+	dlib::ifft_inplace(iplain);
+	dlib::ifft_inplace(iwith_ws, ws);
+	dlib::fft_real(x, out, ws);
+
+	const double e = std::max(_relative_error(plain, ref),
+			_relative_error(iplain, iref));
+	const double e_real = _relative_error(out, ref);
+	if (e > 1e-12 || e_real > 1e-12 || plain != with_ws || iplain != iwith_ws) {
+		fprintf(stderr, "the transforms of %ldx%ld differ from fft(): %g, real"
+				" %g%s\n", x.nr(), x.nc(), e, e_real,
+				plain != with_ws || iplain != iwith_ws ?
+						", and the workspace changes the result" : "");
+		return false;
+	}
+	return true;
+}
+
+enum transform {
+	FFT_PLAIN, FFT_WORKSPACE, IFFT_WORKSPACE, FFT_REAL, NUM_TRANSFORMS
+};
+
+static const char *transform_names[NUM_TRANSFORMS] = {
+	"fft_inplace(data)",
+	"fft_inplace(data, ws)",
+	"ifft_inplace(data, ws)",
+	"fft_real(data, out, ws)"
+};
+
+/*
+ * The best time of one call, in ns, over ten runs of repeat calls.
+ */
+static double _time(transform t, const dlib::matrix<double>& x,
+		dlib::fft_workspace<double>& ws, long repeat) {
+	dlib::matrix<complex_type> c, out;
+	uint64_t best = ~0ULL;
+	for (int run = 0; run < 10; run++) {
+		const uint64_t start = _now_ns();
+		for (long i = 0; i < repeat; i++) {
+			switch (t) {
+			case FFT_PLAIN:
+				c = dlib::matrix_cast<complex_type>(x);
+				dlib::fft_inplace(c);
+				break;
+			case FFT_WORKSPACE:
+				c = dlib::matrix_cast<complex_type>(x);
+				dlib::fft_inplace(c, ws);
+				break;
+			case IFFT_WORKSPACE:
+				c = dlib::matrix_cast<complex_type>(x);
+				dlib::ifft_inplace(c, ws);
+				break;
+			default:
+				dlib::fft_real(x, out, ws);
+				break;
+			}
+		}
+		best = std::min(best, _now_ns() - start);
+	}
+	return (double) best / repeat;
+}
+
+int main(int argc, char **argv) {
+	std::vector<long> sizes;
+	long repeat = 200;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--size") && i + 1 < argc)
+			sizes.push_back(atol(argv[++i]));
+		else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+			repeat = atol(argv[++i]);
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (sizes.empty()) {
+		sizes.push_back(64);
+		sizes.push_back(128);
+	}
+	for (size_t s = 0; s < sizes.size(); s++) {
+		if (sizes[s] <= 0 || !dlib::is_power_of_two(sizes[s])) {
+			fprintf(stderr, "%ld isn't a power of two\n", sizes[s]);
+			return 1;
+		}
+	}
+	if (repeat <= 0) {
+		fprintf(stderr, "bad repeat count\n");
+		return 1;
+	}
+
+	dlib::rand rnd;
+	for (size_t s = 0; s < sizes.size(); s++) {
+		dlib::matrix<double> x(sizes[s], sizes[s]);
+		for (long r = 0; r < x.nr(); r++)
+			for (long c = 0; c < x.nc(); c++)
+				x(r, c) = rnd.get_random_gaussian();
+
+		/* a fresh workspace, so the check also sizes it before the timing */
+		dlib::fft_workspace<double> ws;
+		if (!_check(x, ws))
+			return 1;
+
+		double ns[NUM_TRANSFORMS];
+		for (int t = 0; t < NUM_TRANSFORMS; t++)
+			ns[t] = _time((transform) t, x, ws, repeat);
+
+		printf("%ldx%ld, the same as fft() and ifft()\n", x.nr(), x.nc());
+		for (int t = 0; t < NUM_TRANSFORMS; t++)
+			printf("  %-24s %9.1f us  %5.2fx\n", transform_names[t], ns[t] / 1e3,
+					ns[FFT_PLAIN] / ns[t]);
+	}
+	return 0;
+}
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Reports what building the FHOG pyramid of the face detector costs in
+ * memory, per frame, three ways:
+ *
+ * - "per frame": impl::create_fhog_pyramid() without buffers, as dlib did it
+ *   before scan_fhog_pyramid kept its memory, allocating every level image,
+ *   histogram and norm image again for each frame;
+ * - "stored": scan_fhog_pyramid::load(img, tp), which keeps those images
+ *   between frames;
+ * - "streamed": scan_fhog_pyramid::load(img), which pushes each row down the
+ *   pyramid and only keeps a few rows of each level.
+ *
+ * For each it gives the peak heap use while loading, what stays allocated
+ * afterwards, and the DRAM traffic of a frame.  The heap is measured by
+ * replacing operator new.  The traffic is the last-level cache misses of the
+ * load times the 64 byte line, read through perf_event_open(); where the
+ * kernel offers no hardware counters, as in most VMs, it says so and prints
+ * the bytes of intermediate images a frame writes and reads back instead, a
+ * lower bound for the traffic they cause once they no longer fit in the
+ * cache.  The features of the stored and streamed paths are compared last.
+ * Build it from the FaceFilter directory with something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/fhog_memory_bench.cpp -ldlib -lpthread
+ */
+
+#include <dlib/image_processing/frontal_face_detector.h>
+#include <chrono>
+#include <errno.h>
+#include <math.h>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+/*
+ * Heap use, counted by every operator new.  The size of each block is kept
+ * in front of it.
+ */
+
+static size_t heap_now = 0, heap_peak = 0;
+
+static void* _alloc(std::size_t size) {
+	size_t *p = (size_t *) malloc(size + 16);
+	if (p == NULL)
+		throw std::bad_alloc();
+	*p = size;
+	heap_now += size;
+	if (heap_now > heap_peak)
+		heap_peak = heap_now;
+	return (char *) p + 16;
+}
+
+static void _free(void *q) {
+	if (q == NULL)
+		return;
+	size_t *p = (size_t *) ((char *) q - 16);
+	heap_now -= *p;
+	free(p);
+}
+
+void* operator new(std::size_t size) {
+	return _alloc(size);
+}
+
+void* operator new[](std::size_t size) {
+	return _alloc(size);
+}
+
+void operator delete(void *p) noexcept {
+	_free(p);
+}
+
+void operator delete[](void *p) noexcept {
+	_free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+	_free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept {
+	_free(p);
+}
+
+/*
+ * Last-level cache misses of this thread, or -1 without hardware counters.
+ */
+
+static int _llc_fd = -1;
+
+static void _llc_open() {
+#if defined(__linux__)
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.config = PERF_COUNT_HW_CACHE_MISSES;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	_llc_fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+	if (_llc_fd < 0)
+		fprintf(stderr, "no hardware cache counters (%s)\n", strerror(errno));
+#endif
+}
+
+static long long _llc_misses() {
+	long long count;
+	if (_llc_fd < 0 || read(_llc_fd, &count, sizeof(count)) != sizeof(count))
+		return -1;
+	return count;
+}
+
+static inline uint64_t _now_ns() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void _usage(const char *argv0) {
+	fprintf(stderr, "usage: %s WIDTH HEIGHT [options]\n"
+			"options:\n"
+			"  --frames N      frames to load with each (default: 20)\n", argv0);
+}
+
+typedef dlib::pyramid_down<6> pyramid_type;
+typedef dlib::scan_fhog_pyramid<pyramid_type> scanner_type;
+typedef dlib::array<dlib::array<dlib::array2d<float> > > fhog_pyramid;
+
+struct result {
+	size_t peak; /* heap in use at the highest point of a load */
+	size_t kept; /* heap still in use after it */
+	double ms; /* best time of a frame */
+	long long misses; /* last-level cache misses of a frame, or -1 */
+};
+
+/*
+ * Loads the same frame a few times into fresh objects, the first time to
+ * size their buffers.  peak and kept include what the objects hold.
+ */
+template<typename load_fn>
+static result _measure(load_fn load, long frames) {
+	result res = { 0, 0, 1e30, -1 };
+	const size_t before = heap_now;
+	load();
+	for (long f = 0; f < frames; f++) {
+		heap_peak = heap_now;
+		const long long misses = _llc_misses();
+		const uint64_t start = _now_ns();
+		load();
+		res.ms = std::min(res.ms, (_now_ns() - start) / 1e6);
+		if (misses >= 0)
+			res.misses = _llc_misses() - misses;
+		res.peak = heap_peak - before;
+	}
+	res.kept = heap_now - before;
+	return res;
+}
+
+/*
+ * The bytes a frame of the stored path writes into level images, cell
+ * histograms and norms, and reads back at least once: the pyramid levels
+ * the scanner builds, as load() sizes them.
+ */
+static double _intermediate_mb(const scanner_type& scanner, long width,
+		long height) {
+	pyramid_type pyr;
+	dlib::rectangle rect(0, 0, width - 1, height - 1);
+	const long cell = scanner.get_cell_size();
+	double bytes = 0;
+	for (unsigned long l = 0; l < scanner.get_max_pyramid_levels(); l++) {
+		if (rect.width() < scanner.get_min_pyramid_layer_width()
+				|| rect.height() < scanner.get_min_pyramid_layer_height())
+			break;
+		const double cells = (double) (rect.width() / cell)
+				* (rect.height() / cell);
+		if (l > 0)
+			bytes += rect.area(); /* the level image; level 0 is the frame */
+		bytes += cells * (18 + 1) * sizeof(float); /* histograms and norms */
+		rect = pyr.rect_down(rect);
+	}
+	return 2 * bytes / 1e6;
+}
+
+static void _print(const char *name, const result& r) {
+	printf("%-10s peak %8.0f KB  kept %8.0f KB  %8.2f ms/frame", name,
+			r.peak / 1024.0, r.kept / 1024.0, r.ms);
+	if (r.misses >= 0)
+		printf("  DRAM %7.2f MB/frame", r.misses * 64 / 1e6);
+	printf("\n");
+}
+
+int main(int argc, char **argv) {
+	if (argc < 3) {
+		_usage(argv[0]);
+		return 1;
+	}
+	const long width = atol(argv[1]);
+	const long height = atol(argv[2]);
+	long frames = 20;
+	for (int i = 3; i < argc; i++) {
+		if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+			frames = atol(argv[++i]);
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (width <= 0 || height <= 0 || frames <= 0) {
+		fprintf(stderr, "bad frame size or count\n");
+		return 1;
+	}
+
+	dlib::array2d<unsigned char> img(height, width);
+	srand(5);
+	for (long r = 0; r < height; r++) {
+		for (long c = 0; c < width; c++) {
+			const int v = (int) (128 + 100 * sin(r * 0.05) * cos(c * 0.03))
+					+ rand() % 40;
+			img[r][c] = (unsigned char) (v < 0 ? 0 : (v > 255 ? 255 : v));
+		}
+	}
+
+	const dlib::frontal_face_detector detector =
+			dlib::get_frontal_face_detector();
+	scanner_type stored, streamed;
+	stored.copy_configuration(detector.get_scanner());
+	streamed.copy_configuration(detector.get_scanner());
+	dlib::thread_pool tp(1);
+	fhog_pyramid per_frame;
+
+	struct {
+		const scanner_type *s;
+		const dlib::array2d<unsigned char> *img;
+		fhog_pyramid *feats;
+		void operator()() const {
+			feats->clear();
+			dlib::impl::create_fhog_pyramid<pyramid_type>(*img,
+					s->get_feature_extractor(), *feats, s->get_cell_size(),
+					s->get_fhog_window_height(), s->get_fhog_window_width(),
+					s->get_min_pyramid_layer_width(),
+					s->get_min_pyramid_layer_height(), s->get_max_pyramid_levels());
+		}
+	} load_per_frame = { &stored, &img, &per_frame };
+	struct {
+		scanner_type *s;
+		const dlib::array2d<unsigned char> *img;
+		dlib::thread_pool *tp;
+		void operator()() const {
+			s->load(*img, *tp);
+		}
+	} load_stored = { &stored, &img, &tp };
+	struct {
+		scanner_type *s;
+		const dlib::array2d<unsigned char> *img;
+		void operator()() const {
+			s->load(*img);
+		}
+	} load_streamed = { &streamed, &img };
+
+	_llc_open();
+	printf("%ldx%ld gray, the face detector's pyramid, %ld frames\n", width,
+			height, frames);
+	_print("per frame", _measure(load_per_frame, frames));
+	per_frame.clear();
+	_print("stored", _measure(load_stored, frames));
+	_print("streamed", _measure(load_streamed, frames));
+	if (_llc_fd < 0)
+		printf("intermediate images written and read back by the stored path:"
+				" %.1f MB/frame; the streamed path keeps 4 rows per level\n",
+				_intermediate_mb(stored, width, height));
+
+	/* every window of every level, scored by a random filter */
+	const dlib::matrix<double, 0, 1> weights = dlib::randm(
+			stored.get_num_dimensions(), 1) - 0.5;
+	const scanner_type::fhog_filterbank filter = stored.build_fhog_filterbank(
+			weights);
+	std::vector<std::pair<double, dlib::rectangle> > a, b;
+	stored.detect(filter, a, -1e30);
+	streamed.detect(filter, b, -1e30);
+	if (a != b) {
+		fprintf(stderr, "the streamed features differ from the stored ones\n");
+		return 1;
+	}
+	printf("the streamed and stored features are the same\n");
+	return 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Writes inc/dlib/image_processing/frontal_face_detector_table.h, the tables
+ * dlib::get_frontal_face_detector() builds its detector from: the scanner
+ * settings, the weight vectors, and the separable filters their SVDs give.
+ * The detector is the one of get_serialized_frontal_faces(), or one saved
+ * with dlib::serialize().  Build it from the FaceFilter directory with
+ * something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/frontal_face_table.cpp -ldlib -lpthread
+ *
+ * and run it as
+ *
+ *   ./a.out inc/dlib/image_processing/frontal_face_detector_table.h
+ */
+
+#include <dlib/image_processing/object_detector.h>
+#include <dlib/image_processing/scan_fhog_pyramid.h>
+#include <dlib/image_processing/frontal_face_detector_serialized.h>
+#include <chrono>
+#include <stdio.h>
+
+/*
+ * dlib::frontal_face_detector, without frontal_face_detector.h, so the tool
+ * builds even when the table is missing or out of date
+ */
+typedef dlib::scan_fhog_pyramid<dlib::pyramid_down<6> > face_scanner;
+typedef dlib::object_detector<face_scanner> face_detector;
+
+static void _usage(const char *argv0) {
+	fprintf(stderr, "usage: %s OUT.h [DETECTOR.svm]\n"
+			"  DETECTOR.svm is a serialized frontal_face_detector (default: the\n"
+			"  one of get_serialized_frontal_faces())\n", argv0);
+}
+
+static void _write_doubles(FILE *out, const double *v, long n) {
+	for (long i = 0; i < n; i++)
+		fprintf(out, "%s%.17g,%s", i % 4 == 0 ? "            " : " ", v[i],
+				i % 4 == 3 || i == n - 1 ? "\n" : "");
+}
+
+static void _write_floats(FILE *out, const float *v, long n) {
+	for (long i = 0; i < n; i++)
+		fprintf(out, "%s%.9gf,%s", i % 6 == 0 ? "            " : " ", v[i],
+				i % 6 == 5 || i == n - 1 ? "\n" : "");
+}
+
+int main(int argc, char **argv) {
+	if (argc < 2 || argc > 3) {
+		_usage(argv[0]);
+		return 1;
+	}
+
+	const std::chrono::steady_clock::time_point start =
+			std::chrono::steady_clock::now();
+	face_detector detector;
+	try {
+		if (argc == 3) {
+			dlib::deserialize(argv[2]) >> detector;
+		} else {
+			std::istringstream sin(dlib::get_serialized_frontal_faces());
+			dlib::deserialize(detector, sin);
+		}
+	} catch (std::exception& e) {
+		fprintf(stderr, "can't load the detector: %s\n", e.what());
+		return 1;
+	}
+	fprintf(stderr, "decoded the detector in %.1f ms\n",
+			std::chrono::duration<double, std::milli>(
+					std::chrono::steady_clock::now() - start).count());
+
+	const face_scanner& scanner = detector.get_scanner();
+	const unsigned long planes = scanner.get_feature_extractor().get_num_planes();
+	const unsigned long rows = scanner.get_fhog_window_height();
+	const unsigned long cols = scanner.get_fhog_window_width();
+	const long dims = scanner.get_num_dimensions();
+	if (detector.num_detectors() == 0 || (long) (planes * rows * cols) != dims) {
+		fprintf(stderr, "the detector is empty or its filters aren't %lu planes"
+				" of %lux%lu\n", planes, rows, cols);
+		return 1;
+	}
+
+	/* the separable filters of every plane of every detector, in order */
+	std::vector<unsigned char> counts;
+	std::vector<float> filters;
+	unsigned long num_separable = 0;
+	for (unsigned long i = 0; i < detector.num_detectors(); i++) {
+		const face_scanner::fhog_filterbank& fb = detector.get_processed_w(i).fb;
+		for (unsigned long p = 0; p < planes; p++) {
+			if (fb.col_filters[p].size() > 255) {
+				fprintf(stderr, "plane %lu of detector %lu has more than 255"
+						" separable filters\n", p, i);
+				return 1;
+			}
+			counts.push_back(fb.col_filters[p].size());
+			num_separable += fb.col_filters[p].size();
+			for (size_t j = 0; j < fb.col_filters[p].size(); j++) {
+				filters.insert(filters.end(), fb.col_filters[p][j].begin(),
+						fb.col_filters[p][j].end());
+				filters.insert(filters.end(), fb.row_filters[p][j].begin(),
+						fb.row_filters[p][j].end());
+			}
+		}
+	}
+
+	FILE *out = fopen(argv[1], "w");
+	if (out == NULL) {
+		fprintf(stderr, "can't write %s\n", argv[1]);
+		return 1;
+	}
+
+	fprintf(out,
+			"// Copyright (C) 2013  Davis E. King (davis@dlib.net)\n"
+					"// License: Boost Software License   See LICENSE.txt for the full license.\n"
+					"#ifndef DLIB_FRONTAL_FACE_DETECTOR_TABLe_Hh_\n"
+					"#define DLIB_FRONTAL_FACE_DETECTOR_TABLe_Hh_\n"
+					"\n"
+					"// Made by FaceFilter's tools/frontal_face_table.cpp, don't edit.\n"
+					"\n"
+					"namespace dlib\n"
+					"{\n"
+					"    namespace frontal_face_table\n"
+					"    {\n");
+	fprintf(out, "        const unsigned long num_detectors = %lu;\n",
+			detector.num_detectors());
+	fprintf(out, "        const unsigned long window_width = %lu;\n",
+			scanner.get_detection_window_width());
+	fprintf(out, "        const unsigned long window_height = %lu;\n",
+			scanner.get_detection_window_height());
+	fprintf(out, "        const unsigned long cell_size = %lu;\n",
+			scanner.get_cell_size());
+	fprintf(out, "        const unsigned long padding = %lu;\n",
+			scanner.get_padding());
+	fprintf(out, "        const unsigned long max_pyramid_levels = %lu;\n",
+			scanner.get_max_pyramid_levels());
+	fprintf(out, "        const unsigned long min_pyramid_layer_width = %lu;\n",
+			scanner.get_min_pyramid_layer_width());
+	fprintf(out, "        const unsigned long min_pyramid_layer_height = %lu;\n",
+			scanner.get_min_pyramid_layer_height());
+	fprintf(out, "        const double nuclear_norm_regularization_strength = %.17g;\n",
+			scanner.get_nuclear_norm_regularization_strength());
+	fprintf(out, "        const double iou_thresh = %.17g;\n",
+			detector.get_overlap_tester().get_iou_thresh());
+	fprintf(out, "        const double percent_covered_thresh = %.17g;\n",
+			detector.get_overlap_tester().get_percent_covered_thresh());
+	fprintf(out, "\n"
+			"        // Every filter is num_planes planes of filter_rows x filter_cols.\n");
+	fprintf(out, "        const unsigned long num_planes = %lu;\n", planes);
+	fprintf(out, "        const unsigned long filter_rows = %lu;\n", rows);
+	fprintf(out, "        const unsigned long filter_cols = %lu;\n", cols);
+	fprintf(out, "        const unsigned long num_dimensions = %ld;\n", dims);
+
+	fprintf(out, "\n"
+			"        // The weight vectors, each of num_dimensions+1 values, the last\n"
+			"        // one being the threshold.\n"
+			"        inline const double* weights()\n"
+			"        {\n"
+			"            static const double table[%lu] = {\n",
+			detector.num_detectors() * (dims + 1));
+	for (unsigned long i = 0; i < detector.num_detectors(); i++)
+		_write_doubles(out, &detector.get_w(i)(0), dims + 1);
+	fprintf(out, "            };\n"
+			"            return table;\n"
+			"        }\n");
+
+	fprintf(out, "\n"
+			"        // How many separable filters each plane of each detector has.\n"
+			"        inline const unsigned char* separable_counts()\n"
+			"        {\n"
+			"            static const unsigned char table[%lu] = {\n",
+			(unsigned long) counts.size());
+	for (size_t i = 0; i < counts.size(); i++)
+		fprintf(out, "%s%u,%s", i % 16 == 0 ? "            " : " ", counts[i],
+				i % 16 == 15 || i == counts.size() - 1 ? "\n" : "");
+	fprintf(out, "            };\n"
+			"            return table;\n"
+			"        }\n");
+
+	fprintf(out, "\n"
+			"        // The separable filters, in the order of separable_counts(), each\n"
+			"        // being its column filter of filter_rows values followed by its row\n"
+			"        // filter of filter_cols values.\n"
+			"        inline const float* separable_filters()\n"
+			"        {\n"
+			"            static const float table[%lu] = {\n",
+			(unsigned long) filters.size());
+	_write_floats(out, &filters[0], filters.size());
+	fprintf(out, "            };\n"
+			"            return table;\n"
+			"        }\n"
+			"    }\n"
+			"}\n"
+			"\n"
+			"#endif // DLIB_FRONTAL_FACE_DETECTOR_TABLe_Hh_\n"
+			"\n");
+
+	if (fclose(out) != 0) {
+		fprintf(stderr, "can't write %s\n", argv[1]);
+		return 1;
+	}
+	fprintf(stderr, "%lu detectors, %lu separable filters\n",
+			detector.num_detectors(), num_separable);
+	return 0;
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Checks that dlib::shape_predictor makes no heap allocation per frame once
+ * its shape_predictor_workspace and output detections are warmed up, for a
+ * single face and for a batch, with float32, float16 and int8 leaves.  Every
+ * operator new is counted.  It exits with 1 if a frame allocated.  Without a
+ * model file, a random 68-point model is made in memory.  Build it from the
+ * FaceFilter directory with something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/landmark_allocs.cpp -ldlib -lpthread
+ */
+
+#include <dlib/image_processing.h>
+#include <dlib/rand.h>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static unsigned long allocations = 0;
+
+void* operator new(std::size_t size) {
+	allocations++;
+	void *p = malloc(size ? size : 1);
+	if (p == NULL)
+		throw std::bad_alloc();
+	return p;
+}
+
+void* operator new[](std::size_t size) {
+	allocations++;
+	void *p = malloc(size ? size : 1);
+	if (p == NULL)
+		throw std::bad_alloc();
+	return p;
+}
+
+void operator delete(void *p) noexcept {
+	free(p);
+}
+
+void operator delete[](void *p) noexcept {
+	free(p);
+}
+
+static void _usage(const char *argv0) {
+	fprintf(stderr, "usage: %s [MODEL.dat] [options]\n"
+			"options:\n"
+			"  --faces N       faces in the batch (default: 4)\n"
+			"  --frames N      frames after the warm-up (default: 100)\n", argv0);
+}
+
+/*
+ * A model of random trees over random pixels, the shape of the 68-point
+ * one but smaller.  The landmarks it gives mean nothing; the allocations
+ * it makes are the ones a trained model would.
+ */
+static dlib::shape_predictor _random_model() {
+	const unsigned long parts = 68, levels = 4, trees = 50, depth = 4,
+			pixels = 200;
+	dlib::rand rnd;
+	dlib::matrix<float, 0, 1> initial_shape(parts * 2);
+	for (long i = 0; i < initial_shape.size(); i++)
+		initial_shape(i) = rnd.get_random_float();
+
+	std::vector<std::vector<dlib::impl::regression_tree> > forests(levels);
+	std::vector<std::vector<dlib::vector<float, 2> > > pixel_coordinates(
+			levels);
+	for (unsigned long l = 0; l < levels; l++) {
+		for (unsigned long p = 0; p < pixels; p++)
+			pixel_coordinates[l].push_back(
+					dlib::vector<float, 2>(rnd.get_random_float(),
+							rnd.get_random_float()));
+		forests[l].resize(trees);
+		for (unsigned long t = 0; t < trees; t++) {
+			dlib::impl::regression_tree& tree = forests[l][t];
+			tree.splits.resize((1 << depth) - 1);
+			for (size_t s = 0; s < tree.splits.size(); s++) {
+				tree.splits[s].idx1 = rnd.get_random_32bit_number() % pixels;
+				tree.splits[s].idx2 = rnd.get_random_32bit_number() % pixels;
+				tree.splits[s].thresh = rnd.get_random_gaussian() * 20;
+			}
+			tree.leaf_values.resize(1 << depth);
+			for (size_t v = 0; v < tree.leaf_values.size(); v++) {
+				tree.leaf_values[v].set_size(parts * 2);
+				for (long i = 0; i < tree.leaf_values[v].size(); i++)
+					tree.leaf_values[v](i) = rnd.get_random_gaussian() * 0.001;
+			}
+		}
+	}
+	return dlib::shape_predictor(initial_shape, forests, pixel_coordinates);
+}
+
+int main(int argc, char **argv) {
+	const char *model_path = NULL;
+	long num_faces = 4;
+	long frames = 100;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--faces") && i + 1 < argc)
+			num_faces = atol(argv[++i]);
+		else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+			frames = atol(argv[++i]);
+		else if (argv[i][0] != '-' && model_path == NULL)
+			model_path = argv[i];
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (num_faces <= 0 || frames <= 0) {
+		fprintf(stderr, "bad face or frame count\n");
+		return 1;
+	}
+
+	dlib::shape_predictor sp;
+	if (model_path != NULL) {
+		try {
+			dlib::deserialize(model_path) >> sp;
+		} catch (std::exception& e) {
+			fprintf(stderr, "can't load %s: %s\n", model_path, e.what());
+			return 1;
+		}
+	} else {
+		sp = _random_model();
+	}
+	sp.set_leaf_type(dlib::float32_leaves);
+
+	dlib::array2d<unsigned char> img(480, 640);
+	dlib::rand rnd;
+	for (long r = 0; r < img.nr(); r++)
+		for (long c = 0; c < img.nc(); c++)
+			img[r][c] = rnd.get_random_8bit_number();
+	std::vector<dlib::rectangle> faces;
+	for (long i = 0; i < num_faces; i++)
+		faces.push_back(
+				dlib::centered_rect(
+						dlib::point(100 + 440 * i / std::max(1L, num_faces - 1),
+								240), 150, 150));
+
+	static const dlib::shape_predictor_leaf_type types[] = {
+			dlib::float32_leaves, dlib::float16_leaves, dlib::int8_leaves };
+	static const char *names[] = { "float32", "float16", "int8" };
+	dlib::shape_predictor_workspace ws;
+	dlib::full_object_detection single;
+	std::vector<dlib::full_object_detection> batch;
+	bool ok = true;
+	for (int t = 0; t < 3; t++) {
+		sp.set_leaf_type(types[t]);
+
+		/* the first frame sizes the workspace and the detections */
+		sp(img, faces[0], ws, single);
+		sp(img, faces, batch, ws);
+
+		unsigned long before = allocations;
+		for (long f = 0; f < frames; f++)
+			sp(img, faces[f % num_faces], ws, single);
+		const unsigned long single_allocs = allocations - before;
+
+		before = allocations;
+		for (long f = 0; f < frames; f++)
+			sp(img, faces, batch, ws);
+		const unsigned long batch_allocs = allocations - before;
+
+		/* the same frame, alternating between a batch and a single face */
+		before = allocations;
+		for (long f = 0; f < frames; f++) {
+			sp(img, faces, batch, ws);
+			sp(img, faces[f % num_faces], ws, single);
+		}
+		const unsigned long mixed_allocs = allocations - before;
+
+		printf("%-8s single %lu, batch of %ld %lu, both %lu allocations in"
+				" %ld frames\n", names[t], single_allocs, num_faces,
+				batch_allocs, mixed_allocs, frames);
+		if (single_allocs != 0 || batch_allocs != 0 || mixed_allocs != 0)
+			ok = false;
+	}
+
+	/* for comparison: the overload that makes its own workspace */
+	const unsigned long before = allocations;
+	single = sp(img, faces[0]);
+	printf("operator()(img, rect) without a workspace: %lu allocations\n",
+			allocations - before);
+
+	printf("%s\n", ok ? "ok" : "FAILED: a frame allocated after the warm-up");
+	return ok ? 0 : 1;
+}
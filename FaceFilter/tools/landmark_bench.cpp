@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Compares the per-face latency of dlib::shape_predictor with the way it
+ * ran before its forests were flattened: a std::vector of split_feature and
+ * one matrix per leaf for every tree, walked tree by tree.  That reference
+ * is rebuilt here from the float form of the model, so both run the same
+ * trees on the same faces, and their landmarks are compared.  Build it from
+ * the FaceFilter directory with something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/landmark_bench.cpp -ldlib -lpthread
+ *
+ * and run it on the target device class.  Without IMAGE, the faces are
+ * boxes on a synthetic 640x480 image; with one (any format load_image()
+ * reads in the build), they are the faces the frontal face detector finds.
+ */
+
+#include <dlib/image_processing.h>
+#include <dlib/image_processing/frontal_face_detector.h>
+#include <dlib/image_io.h>
+#include <dlib/rand.h>
+#include <chrono>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static void _usage(const char *argv0) {
+	fprintf(stderr, "usage: %s MODEL.dat [IMAGE] [options]\n"
+			"options:\n"
+			"  --faces N       boxes on the synthetic image (default: 4)\n"
+			"  --repeat N      run every face N times (default: 50)\n", argv0);
+}
+
+static inline uint64_t _now_ns() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*
+ * shape_predictor::operator() as it was before the compiled forests, over
+ * the version 1 serialization of a model.
+ */
+struct reference_predictor {
+	dlib::matrix<float, 0, 1> initial_shape;
+	std::vector<std::vector<dlib::impl::regression_tree> > forests;
+	std::vector<std::vector<unsigned long> > anchor_idx;
+	std::vector<std::vector<dlib::vector<float, 2> > > deltas;
+
+	void load(const dlib::shape_predictor& sp) {
+		dlib::shape_predictor copy(sp);
+		copy.set_leaf_type(dlib::float32_leaves);
+		std::stringstream buf;
+		dlib::serialize(copy, buf);
+		int version;
+		dlib::deserialize(version, buf);
+		dlib::deserialize(initial_shape, buf);
+		dlib::deserialize(forests, buf);
+		dlib::deserialize(anchor_idx, buf);
+		dlib::deserialize(deltas, buf);
+	}
+
+	static dlib::point_transform_affine _rect_tform(const dlib::rectangle& rect,
+			bool to_unit) {
+		std::vector<dlib::vector<float, 2> > rect_points, unit_points;
+		rect_points.push_back(rect.tl_corner());
+		unit_points.push_back(dlib::point(0, 0));
+		rect_points.push_back(rect.tr_corner());
+		unit_points.push_back(dlib::point(1, 0));
+		rect_points.push_back(rect.br_corner());
+		unit_points.push_back(dlib::point(1, 1));
+		return to_unit ?
+				dlib::find_affine_transform(rect_points, unit_points) :
+				dlib::find_affine_transform(unit_points, rect_points);
+	}
+
+	template<typename image_type>
+	void _features(const image_type& img_, const dlib::rectangle& rect,
+			const dlib::matrix<float, 0, 1>& current_shape, unsigned long iter,
+			std::vector<float>& values) const {
+		using dlib::impl::location;
+		std::vector<dlib::vector<float, 2> > from_points, to_points;
+		for (long i = 0; i < initial_shape.size() / 2; i++) {
+			from_points.push_back(location(initial_shape, i));
+			to_points.push_back(location(current_shape, i));
+		}
+		const dlib::matrix<float, 2, 2> tform = dlib::matrix_cast<float>(
+				dlib::find_similarity_transform(from_points, to_points).get_m());
+		const dlib::point_transform_affine tform_to_img = _rect_tform(rect,
+				false);
+		const dlib::rectangle area = dlib::get_rect(img_);
+		const dlib::const_image_view<image_type> img(img_);
+		values.resize(deltas[iter].size());
+		for (unsigned long i = 0; i < values.size(); i++) {
+			const dlib::point p = tform_to_img(
+					tform * deltas[iter][i]
+							+ location(current_shape, anchor_idx[iter][i]));
+			values[i] = area.contains(p) ?
+					dlib::get_pixel_intensity(img[p.y()][p.x()]) : 0;
+		}
+	}
+
+	template<typename image_type>
+	dlib::full_object_detection operator()(const image_type& img,
+			const dlib::rectangle& rect) const {
+		dlib::matrix<float, 0, 1> current_shape = initial_shape;
+		std::vector<float> values;
+		for (unsigned long iter = 0; iter < forests.size(); iter++) {
+			_features(img, rect, current_shape, iter, values);
+			unsigned long leaf_idx;
+			for (unsigned long i = 0; i < forests[iter].size(); i++)
+				current_shape += forests[iter][i](values, leaf_idx);
+		}
+		const dlib::point_transform_affine tform_to_img = _rect_tform(rect,
+				false);
+		std::vector<dlib::point> parts(current_shape.size() / 2);
+		for (unsigned long i = 0; i < parts.size(); i++)
+			parts[i] = tform_to_img(dlib::impl::location(current_shape, i));
+		return dlib::full_object_detection(rect, parts);
+	}
+};
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		_usage(argv[0]);
+		return 1;
+	}
+
+	const char *model_path = argv[1];
+	const char *image_path = NULL;
+	long num_faces = 4;
+	long repeat = 50;
+	for (int i = 2; i < argc; i++) {
+		if (!strcmp(argv[i], "--faces") && i + 1 < argc)
+			num_faces = atol(argv[++i]);
+		else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+			repeat = atol(argv[++i]);
+		else if (argv[i][0] != '-' && image_path == NULL)
+			image_path = argv[i];
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (num_faces <= 0 || repeat <= 0) {
+		fprintf(stderr, "bad face or repeat count\n");
+		return 1;
+	}
+
+	dlib::shape_predictor sp;
+	reference_predictor reference;
+	try {
+		dlib::deserialize(model_path) >> sp;
+		reference.load(sp);
+	} catch (std::exception& e) {
+		fprintf(stderr, "can't load %s: %s\n", model_path, e.what());
+		return 1;
+	}
+
+	dlib::array2d<unsigned char> img;
+	std::vector<dlib::rectangle> faces;
+	if (image_path != NULL) {
+		try {
+			dlib::load_image(img, image_path);
+		} catch (std::exception& e) {
+			fprintf(stderr, "can't load %s: %s\n", image_path, e.what());
+			return 1;
+		}
+		faces = dlib::get_frontal_face_detector()(img);
+		if (faces.empty()) {
+			fprintf(stderr, "no face found in %s\n", image_path);
+			return 1;
+		}
+	} else {
+		img.set_size(480, 640);
+		dlib::rand rnd;
+		for (long r = 0; r < img.nr(); r++)
+			for (long c = 0; c < img.nc(); c++)
+				img[r][c] = (unsigned char) ((r + c) / 5
+						+ rnd.get_random_8bit_number() % 64);
+		for (long i = 0; i < num_faces; i++)
+			faces.push_back(
+					dlib::centered_rect(
+							dlib::point(100 + 440 * i / std::max(1L, num_faces - 1),
+									240), 160, 160));
+	}
+
+	printf("%lu faces, model of %lu levels of %lu trees, %lu parts\n",
+			(unsigned long) faces.size(), sp.num_cascades(), sp.num_trees(0),
+			sp.num_parts());
+
+	/* the reference first, then both entry points of the compiled model */
+	std::vector<dlib::full_object_detection> ref_shapes(faces.size());
+	uint64_t ref_ns = 0;
+	for (long r = 0; r < repeat; r++) {
+		const uint64_t start = _now_ns();
+		for (size_t i = 0; i < faces.size(); i++)
+			ref_shapes[i] = reference(img, faces[i]);
+		ref_ns += _now_ns() - start;
+	}
+
+	std::vector<dlib::full_object_detection> shapes(faces.size());
+	uint64_t single_ns = 0;
+	for (long r = 0; r < repeat; r++) {
+		const uint64_t start = _now_ns();
+		for (size_t i = 0; i < faces.size(); i++)
+			shapes[i] = sp(img, faces[i]);
+		single_ns += _now_ns() - start;
+	}
+
+	dlib::shape_predictor_workspace ws;
+	std::vector<dlib::full_object_detection> batch;
+	uint64_t batch_ns = 0;
+	for (long r = 0; r < repeat; r++) {
+		const uint64_t start = _now_ns();
+		sp(img, faces, batch, ws);
+		batch_ns += _now_ns() - start;
+	}
+
+	double max_err = 0, batch_err = 0;
+	for (size_t i = 0; i < faces.size(); i++) {
+		for (unsigned long j = 0; j < sp.num_parts(); j++) {
+			max_err = std::max(max_err,
+					dlib::length(shapes[i].part(j) - ref_shapes[i].part(j)));
+			batch_err = std::max(batch_err,
+					dlib::length(batch[i].part(j) - ref_shapes[i].part(j)));
+		}
+	}
+
+	const double per_face = 1e3 * repeat * faces.size();
+	printf("%-28s %9.1f us/face\n", "reference (tree by tree)",
+			ref_ns / per_face);
+	printf("%-28s %9.1f us/face %6.2fx, max %.2f px from the reference\n",
+			"operator()(img, rect)", single_ns / per_face,
+			(double) ref_ns / single_ns, max_err);
+	printf("%-28s %9.1f us/face %6.2fx, max %.2f px from the reference\n",
+			"batch with a workspace", batch_ns / per_face,
+			(double) ref_ns / batch_ns, batch_err);
+	return 0;
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Times how long a shape predictor, e.g. shape_predictor_68_face_landmarks.dat,
+ * takes to load as it is and once written with the raw blocks of
+ * enable_raw_block_serialization().  The copy with raw blocks is written to
+ * OUT.dat, both are loaded the way the app does, from their file, and from
+ * memory, which leaves out the reads of the file.  Both must load to the same
+ * model.  Build it from the FaceFilter directory with something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/landmark_load_bench.cpp -ldlib -lpthread
+ *
+ * and run it on the target device class, where the first load of the app
+ * is.  The file reads are only cold the first time, after the page cache is
+ * dropped.
+ */
+
+#include <dlib/image_processing.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static void _usage(const char *argv0) {
+	fprintf(stderr, "usage: %s MODEL.dat OUT.dat [options]\n"
+			"options:\n"
+			"  --repeat N      loads of each file, the best is kept (default: 5)\n",
+			argv0);
+}
+
+static inline uint64_t _now_ns() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static double _file_mb(const char *path) {
+	struct stat st;
+	return stat(path, &st) == 0 ? st.st_size / 1e6 : 0;
+}
+
+static bool _read_file(const char *path, std::string& data) {
+	std::ifstream in(path, std::ios::binary);
+	std::ostringstream buf;
+	buf << in.rdbuf();
+	data = buf.str();
+	return in.good() || in.eof();
+}
+
+struct result {
+	double file_ms; /* best time of deserialize(path) >> sp */
+	double memory_ms; /* best time of the same from the bytes of the file */
+};
+
+static result _measure(const char *path, const std::string& data, long repeat,
+		dlib::shape_predictor& sp) {
+	result res = { 1e30, 1e30 };
+	for (long r = 0; r < repeat; r++) {
+		uint64_t start = _now_ns();
+		dlib::deserialize(path) >> sp;
+		res.file_ms = std::min(res.file_ms, (_now_ns() - start) / 1e6);
+
+		std::istringstream in(data);
+		start = _now_ns();
+		dlib::deserialize(sp, in);
+		res.memory_ms = std::min(res.memory_ms, (_now_ns() - start) / 1e6);
+	}
+	return res;
+}
+
+/*
+ * The usual serialization of a model, which doesn't depend on how it was
+ * loaded.
+ */
+static std::string _serialized(const dlib::shape_predictor& sp) {
+	std::ostringstream out;
+	dlib::serialize(sp, out);
+	return out.str();
+}
+
+int main(int argc, char **argv) {
+	if (argc < 3) {
+		_usage(argv[0]);
+		return 1;
+	}
+
+	const char *in_path = argv[1];
+	const char *out_path = argv[2];
+	long repeat = 5;
+	for (int i = 3; i < argc; i++) {
+		if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+			repeat = atol(argv[++i]);
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (repeat <= 0) {
+		fprintf(stderr, "bad repeat count\n");
+		return 1;
+	}
+
+	dlib::shape_predictor sp, raw_sp;
+	std::string data, raw_data;
+	try {
+		/* the first load, from a cold cache if it was dropped */
+		const uint64_t start = _now_ns();
+		dlib::deserialize(in_path) >> sp;
+		printf("first load of %s: %.1f ms\n", in_path, (_now_ns() - start) / 1e6);
+
+		std::ofstream out(out_path, std::ios::binary);
+		dlib::enable_raw_block_serialization(out);
+		dlib::serialize(sp, out);
+		out.close();
+		if (!out) {
+			fprintf(stderr, "can't write %s\n", out_path);
+			return 1;
+		}
+		if (!_read_file(in_path, data) || !_read_file(out_path, raw_data)) {
+			fprintf(stderr, "can't read the models back\n");
+			return 1;
+		}
+
+		printf("%ld features, %lu landmarks, best of %ld loads\n",
+				sp.num_features(), sp.num_parts(), repeat);
+		const result plain = _measure(in_path, data, repeat, sp);
+		printf("as it is   %6.1f MB  %8.1f ms from the file  %8.1f ms from"
+				" memory\n", _file_mb(in_path), plain.file_ms, plain.memory_ms);
+		const result raw = _measure(out_path, raw_data, repeat, raw_sp);
+		printf("raw blocks %6.1f MB  %8.1f ms from the file  %8.1f ms from"
+				" memory\n", _file_mb(out_path), raw.file_ms, raw.memory_ms);
+	} catch (std::exception& e) {
+		fprintf(stderr, "%s\n", e.what());
+		return 1;
+	}
+
+	if (_serialized(sp) != _serialized(raw_sp)) {
+		fprintf(stderr, "the model loaded from %s differs from %s\n", out_path,
+				in_path);
+		return 1;
+	}
+	printf("both load to the same model\n");
+	return 0;
+}
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Converts a shape predictor, e.g. shape_predictor_68_face_landmarks.dat, to
+ * float16 or int8 leaves (see shape_predictor::set_leaf_type()), or to the
+ * memory-mapped format of save_mapped_shape_predictor(), and reports what the
+ * conversion costs: file size, load time, time per face, and how far the
+ * landmarks move from the ones of the float model.  The faces are the ones
+ * the frontal face detector finds in IMAGE (dlib/face.jpg), plus synthetic
+ * crops of each: the face box shifted and scaled by up to 10%, as the
+ * detector and the trackers give them from frame to frame.  Build it from
+ * the FaceFilter directory with something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc -DDLIB_JPEG_SUPPORT tools/landmark_model.cpp \
+ *       -ldlib -ljpeg -lpthread
+ *
+ * and run it as e.g.
+ *
+ *   ./a.out shape_predictor_68_face_landmarks.dat sp_int8.dat --leaves int8 \
+ *       --image ../dlib/face.jpg
+ */
+
+#include <dlib/image_processing.h>
+#include <dlib/image_processing/frontal_face_detector.h>
+#include <dlib/image_io.h>
+#include <dlib/rand.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <vector>
+
+static void _usage(const char *argv0) {
+	fprintf(stderr,
+			"usage: %s IN.dat OUT.dat [options]\n"
+					"options:\n"
+					"  --leaves TYPE   float32, float16 or int8 (default: int8)\n"
+					"  --mapped        write the memory-mapped format instead of the\n"
+					"                  serialized one\n"
+					"  --image FILE    report the error and the speed on the faces of\n"
+					"                  FILE\n"
+					"  --crops N       synthetic crops per face for the report\n"
+					"                  (default: 20)\n"
+					"  --repeat N      run every face N times, for the timing\n"
+					"                  (default: 20)\n", argv0);
+}
+
+static inline uint64_t _now_ns() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static double _file_mb(const char *path) {
+	struct stat st;
+	return stat(path, &st) == 0 ? st.st_size / 1e6 : 0;
+}
+
+/*
+ * Loads a model the way the app does, and returns how long it took.
+ */
+static double _load_ms(const char *path, dlib::shape_predictor& sp) {
+	const uint64_t start = _now_ns();
+	dlib::deserialize(path) >> sp;
+	return (_now_ns() - start) / 1e6;
+}
+
+int main(int argc, char **argv) {
+	if (argc < 3) {
+		_usage(argv[0]);
+		return 1;
+	}
+
+	const char *in_path = argv[1];
+	const char *out_path = argv[2];
+	dlib::shape_predictor_leaf_type leaves = dlib::int8_leaves;
+	bool mapped = false;
+	const char *image_path = NULL;
+	long crops = 20;
+	long repeat = 20;
+	for (int i = 3; i < argc; i++) {
+		if (!strcmp(argv[i], "--leaves") && i + 1 < argc) {
+			const char *type = argv[++i];
+			if (!strcmp(type, "float32"))
+				leaves = dlib::float32_leaves;
+			else if (!strcmp(type, "float16"))
+				leaves = dlib::float16_leaves;
+			else if (!strcmp(type, "int8"))
+				leaves = dlib::int8_leaves;
+			else {
+				_usage(argv[0]);
+				return 1;
+			}
+		} else if (!strcmp(argv[i], "--mapped"))
+			mapped = true;
+		else if (!strcmp(argv[i], "--image") && i + 1 < argc)
+			image_path = argv[++i];
+		else if (!strcmp(argv[i], "--crops") && i + 1 < argc)
+			crops = atol(argv[++i]);
+		else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+			repeat = atol(argv[++i]);
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (crops < 0 || repeat <= 0) {
+		fprintf(stderr, "bad crop or repeat count\n");
+		return 1;
+	}
+
+	dlib::shape_predictor original, converted;
+	double in_ms;
+	try {
+		in_ms = _load_ms(in_path, original);
+		converted = original;
+		converted.set_leaf_type(leaves);
+		if (mapped)
+			dlib::save_mapped_shape_predictor(converted, out_path);
+		else
+			dlib::serialize(out_path) << converted;
+	} catch (std::exception& e) {
+		fprintf(stderr, "can't convert %s: %s\n", in_path, e.what());
+		return 1;
+	}
+
+	/* what the app pays to load the new file */
+	double out_ms;
+	dlib::mapped_shape_predictor view;
+	try {
+		if (mapped) {
+			const uint64_t start = _now_ns();
+			view.load(out_path);
+			out_ms = (_now_ns() - start) / 1e6;
+		} else {
+			out_ms = _load_ms(out_path, converted);
+		}
+	} catch (std::exception& e) {
+		fprintf(stderr, "can't read back %s: %s\n", out_path, e.what());
+		return 1;
+	}
+
+	printf("%-10s %8.2f MB, loaded in %8.1f ms\n", "input", _file_mb(in_path),
+			in_ms);
+	printf("%-10s %8.2f MB, loaded in %8.1f ms%s\n", "output",
+			_file_mb(out_path), out_ms, mapped ? " (mapped)" : "");
+
+	if (image_path == NULL)
+		return 0;
+
+	dlib::array2d<unsigned char> img;
+	try {
+		dlib::load_image(img, image_path);
+	} catch (std::exception& e) {
+		fprintf(stderr, "can't load %s: %s\n", image_path, e.what());
+		return 1;
+	}
+	const std::vector<dlib::rectangle> found =
+			dlib::get_frontal_face_detector()(img);
+	if (found.empty()) {
+		fprintf(stderr, "no face found in %s\n", image_path);
+		return 1;
+	}
+
+	/* the detected boxes, then the shifted and scaled crops of each */
+	std::vector<dlib::rectangle> faces(found);
+	dlib::rand rnd;
+	for (size_t i = 0; i < found.size(); i++) {
+		for (long k = 0; k < crops; k++) {
+			const double size = found[i].width()
+					* (0.9 + 0.2 * rnd.get_random_double());
+			const dlib::dpoint shift(
+					found[i].width() * (0.2 * rnd.get_random_double() - 0.1),
+					found[i].height() * (0.2 * rnd.get_random_double() - 0.1));
+			faces.push_back(
+					dlib::centered_rect(dlib::center(found[i]) + shift,
+							(unsigned long) size, (unsigned long) size));
+		}
+	}
+
+	dlib::shape_predictor_workspace ws;
+	std::vector<dlib::full_object_detection> reference(faces.size()),
+			shapes(faces.size());
+	uint64_t float_ns = 0, out_ns = 0;
+	for (long r = 0; r < repeat; r++) {
+		uint64_t start = _now_ns();
+		for (size_t i = 0; i < faces.size(); i++)
+			original(img, faces[i], ws, reference[i]);
+		float_ns += _now_ns() - start;
+
+		start = _now_ns();
+		for (size_t i = 0; i < faces.size(); i++) {
+			if (mapped)
+				shapes[i] = view(img, faces[i]);
+			else
+				converted(img, faces[i], ws, shapes[i]);
+		}
+		out_ns += _now_ns() - start;
+	}
+
+	double err = 0, rel_err = 0, max_err = 0;
+	long parts = 0;
+	for (size_t i = 0; i < faces.size(); i++) {
+		for (unsigned long j = 0; j < shapes[i].num_parts(); j++) {
+			const double d = dlib::length(
+					shapes[i].part(j) - reference[i].part(j));
+			err += d;
+			rel_err += d / faces[i].width();
+			max_err = std::max(max_err, d);
+			parts++;
+		}
+	}
+
+	printf("%lu faces in %s, %ld crops of each\n",
+			(unsigned long) found.size(), image_path, crops);
+	const double runs = 1e3 * repeat * faces.size();
+	printf("%-10s %8.1f us/face\n", "input", float_ns / runs);
+	printf("%-10s %8.1f us/face\n", "output", out_ns / runs);
+	printf("error from the input: mean %.3f px (%.3f%% of the face width),"
+			" max %.2f px\n", err / parts, 100 * rel_err / parts, max_err);
+	return 0;
+}
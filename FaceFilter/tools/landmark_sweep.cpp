@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measures how much accuracy a shape predictor loses, and how much time it
+ * saves, when only part of its cascade runs (see shape_predictor_limits).  The
+ * faces of raw NV12 frames are found with the frontal face detector, and every
+ * operating point is compared with the full model on them.  Build it from the
+ * FaceFilter directory with something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/landmark_sweep.cpp -ldlib -lpthread
+ *
+ * and run it on the target device class, over frames dumped from its camera
+ * or made with e.g.
+ *
+ *   ffmpeg -i clip.mp4 -pix_fmt nv12 -f rawvideo clip.nv12
+ */
+
+#include "nv12_frame.h"
+#include <dlib/image_processing.h>
+#include <dlib/image_processing/frontal_face_detector.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static void _usage(const char *argv0) {
+	fprintf(stderr,
+			"usage: %s MODEL.dat WIDTH HEIGHT IN.nv12 [options]\n"
+					"options:\n"
+					"  --rotate DEG    turn the frames clockwise by 0, 90, 180 or 270\n"
+					"                  degrees before looking for faces (default: 90,\n"
+					"                  like the preview)\n"
+					"  --frames N      use the first N frames at most (default: 100)\n"
+					"  --repeat N      run every operating point N times, for the\n"
+					"                  timing (default: 5)\n",
+			argv0);
+}
+
+static inline uint64_t _now_ns() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*
+ * Copies the Y plane of a frame into img, turned clockwise by rotation.
+ */
+static void _rotated_luma(const unsigned char *y, long width, long height,
+		preview_rotation_e rotation, dlib::array2d<unsigned char>& img) {
+	const bool sideways = rotation == PREVIEW_ROTATION_90
+			|| rotation == PREVIEW_ROTATION_270;
+	img.set_size(sideways ? width : height, sideways ? height : width);
+	for (long r = 0; r < img.nr(); r++) {
+		for (long c = 0; c < img.nc(); c++) {
+			long sr, sc;
+			switch (rotation) {
+			case PREVIEW_ROTATION_90:
+				sr = height - 1 - c;
+				sc = r;
+				break;
+			case PREVIEW_ROTATION_180:
+				sr = height - 1 - r;
+				sc = width - 1 - c;
+				break;
+			case PREVIEW_ROTATION_270:
+				sr = c;
+				sc = width - 1 - r;
+				break;
+			default:
+				sr = r;
+				sc = c;
+				break;
+			}
+			img[r][c] = y[sr * width + sc];
+		}
+	}
+}
+
+struct operating_point {
+	char name[48];
+	dlib::shape_predictor_limits limits;
+};
+
+int main(int argc, char **argv) {
+	if (argc < 5) {
+		_usage(argv[0]);
+		return 1;
+	}
+
+	const char *model_path = argv[1];
+	const long width = atol(argv[2]);
+	const long height = atol(argv[3]);
+	const char *in_path = argv[4];
+	int rotate = 90;
+	long max_frames = 100;
+	long repeat = 5;
+
+	for (int i = 5; i < argc; i++) {
+		if (!strcmp(argv[i], "--rotate") && i + 1 < argc)
+			rotate = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+			max_frames = atol(argv[++i]);
+		else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+			repeat = atol(argv[++i]);
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (width <= 0 || height <= 0 || height % 2 != 0 || max_frames <= 0
+			|| repeat <= 0 || rotate % 90 != 0) {
+		fprintf(stderr, "bad frame size, rotation or count\n");
+		return 1;
+	}
+	const preview_rotation_e rotation = (preview_rotation_e) ((rotate / 90) & 3);
+
+	dlib::shape_predictor sp;
+	try {
+		dlib::deserialize(model_path) >> sp;
+	} catch (std::exception& e) {
+		fprintf(stderr, "can't load %s: %s\n", model_path, e.what());
+		return 1;
+	}
+	if (sp.num_cascades() == 0) {
+		fprintf(stderr, "%s holds an empty model\n", model_path);
+		return 1;
+	}
+
+	FILE *in = fopen(in_path, "rb");
+	if (in == NULL) {
+		fprintf(stderr, "can't open %s\n", in_path);
+		return 1;
+	}
+
+	/* the frames that have faces, and their faces */
+	dlib::frontal_face_detector detector = dlib::get_frontal_face_detector();
+	const size_t frame_size = width * height * 3 / 2;
+	std::vector<unsigned char> frame(frame_size);
+	dlib::array<dlib::array2d<unsigned char> > images;
+	std::vector<std::vector<dlib::rectangle> > faces;
+	long frames = 0, num_faces = 0;
+	while (frames < max_frames
+			&& fread(&frame[0], 1, frame_size, in) == frame_size) {
+		frames++;
+		dlib::array2d<unsigned char> img;
+		_rotated_luma(&frame[0], width, height, rotation, img);
+		std::vector<dlib::rectangle> dets = detector(img);
+		if (dets.empty())
+			continue;
+		images.push_back(img);
+		faces.push_back(dets);
+		num_faces += dets.size();
+	}
+	fclose(in);
+	if (num_faces == 0) {
+		fprintf(stderr, "no face found in %ld frames of %s\n", frames, in_path);
+		return 1;
+	}
+
+	/* the operating points: fewer levels, fewer trees, early stops */
+	std::vector<operating_point> points;
+	operating_point p;
+	strcpy(p.name, "full");
+	points.push_back(p);
+	for (unsigned long k = sp.num_cascades() - 1; k >= 1; k--) {
+		p = operating_point();
+		snprintf(p.name, sizeof(p.name), "cascades %lu", k);
+		p.limits.max_cascades = k;
+		points.push_back(p);
+	}
+	const unsigned long trees = sp.num_trees(0);
+	for (int quarters = 3; quarters >= 1; quarters--) {
+		p = operating_point();
+		p.limits.max_trees = trees * quarters / 4;
+		snprintf(p.name, sizeof(p.name), "trees %lu", p.limits.max_trees);
+		points.push_back(p);
+	}
+	static const double updates[] = { 0.0005, 0.001, 0.002, 0.005, 0.01 };
+	for (size_t i = 0; i < sizeof(updates) / sizeof(updates[0]); i++) {
+		p = operating_point();
+		p.limits.min_update = updates[i];
+		snprintf(p.name, sizeof(p.name), "min update %g", updates[i]);
+		points.push_back(p);
+	}
+
+	printf("%ld faces in %lu of %ld frames, model of %lu levels of %lu trees\n",
+			num_faces, (unsigned long) images.size(), frames,
+			sp.num_cascades(), trees);
+	printf("%-18s %10s %10s %10s %10s %8s\n", "operating point", "us/face",
+			"speedup", "err px", "err %face", "max px");
+
+	dlib::shape_predictor_workspace ws;
+	std::vector<std::vector<dlib::full_object_detection> > reference(
+			images.size());
+	std::vector<dlib::full_object_detection> shapes;
+	double full_ns = 0;
+	for (size_t k = 0; k < points.size(); k++) {
+		uint64_t ns = 0;
+		double err = 0, rel_err = 0, max_err = 0;
+		long parts = 0;
+		for (size_t i = 0; i < images.size(); i++) {
+			for (long r = 0; r < repeat; r++) {
+				const uint64_t start = _now_ns();
+				sp(images[i], faces[i], shapes, ws, points[k].limits);
+				ns += _now_ns() - start;
+			}
+			if (k == 0) {
+				reference[i] = shapes;
+				continue;
+			}
+			for (size_t f = 0; f < shapes.size(); f++) {
+				const double size = std::max(faces[i][f].width(),
+						faces[i][f].height());
+				for (unsigned long j = 0; j < shapes[f].num_parts(); j++) {
+					const double d = dlib::length(
+							shapes[f].part(j) - reference[i][f].part(j));
+					err += d;
+					rel_err += d / size;
+					max_err = std::max(max_err, d);
+					parts++;
+				}
+			}
+		}
+
+		const double per_face = (double) ns / repeat / num_faces;
+		if (k == 0)
+			full_ns = per_face;
+		printf("%-18s %10.1f %9.2fx %10.3f %10.3f %8.1f\n", points[k].name,
+				per_face / 1e3, full_ns / per_face, parts ? err / parts : 0.0,
+				parts ? 100 * rel_err / parts : 0.0, max_err);
+	}
+	return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Runs a filter pipeline over raw NV12 frames on a desktop machine, so
+ * filter chains can be checked and profiled without a device.  Build it
+ * from the FaceFilter directory with something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/nv12_filter.cpp src/filter_pipeline.cpp \
+ *       src/yuv_filter.cpp src/yuv_convolve.cpp -ldlib -lpthread
+ *
+ * and feed it frames dumped from the camera or made with e.g.
+ *
+ *   ffmpeg -i clip.mp4 -pix_fmt nv12 -f rawvideo clip.nv12
+ */
+
+#include "filter_pipeline.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static void _usage(const char *argv0) {
+	fprintf(stderr,
+			"usage: %s WIDTH HEIGHT CHAIN IN.nv12 [OUT.nv12] [options]\n"
+					"  CHAIN is a comma separated list of stages, e.g. gaussian,sepia,\n"
+					"  or preset:N for one of the presets of the Filter button.\n"
+					"options:\n"
+					"  --budget-ms MS  per-frame budget (default: none)\n"
+					"  --threads N     threads for the frame stages (default: 1)\n"
+					"  --repeat N      run every frame N times (default: 1)\n",
+			argv0);
+}
+
+int main(int argc, char **argv) {
+	if (argc < 5) {
+		_usage(argv[0]);
+		return 1;
+	}
+
+	const long width = atol(argv[1]);
+	const long height = atol(argv[2]);
+	const char *chain = argv[3];
+	const char *in_path = argv[4];
+	const char *out_path = NULL;
+	double budget_ms = 0;
+	unsigned long threads = 1;
+	long repeat = 1;
+
+	for (int i = 5; i < argc; i++) {
+		if (!strcmp(argv[i], "--budget-ms") && i + 1 < argc)
+			budget_ms = atof(argv[++i]);
+		else if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+			threads = strtoul(argv[++i], NULL, 10);
+		else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+			repeat = atol(argv[++i]);
+		else if (argv[i][0] != '-' && out_path == NULL)
+			out_path = argv[i];
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (width <= 0 || height <= 0 || height % 2 != 0 || repeat <= 0) {
+		fprintf(stderr, "bad frame size or repeat count\n");
+		return 1;
+	}
+
+	if (!strncmp(chain, "preset:", 7))
+		chain = filter_preset_chain(atoi(chain + 7));
+
+	dlib::thread_pool tp(threads > 1 ? threads : 0);
+	filter_pipeline pipeline;
+	if (!pipeline.set_chain(chain, tp)) {
+		fprintf(stderr, "unknown stage in \"%s\"\n", chain);
+		return 1;
+	}
+	pipeline.set_budget_ns((uint64_t) (budget_ms * 1e6));
+
+	FILE *in = fopen(in_path, "rb");
+	if (in == NULL) {
+		fprintf(stderr, "can't open %s\n", in_path);
+		return 1;
+	}
+	FILE *out = NULL;
+	if (out_path != NULL && (out = fopen(out_path, "wb")) == NULL) {
+		fprintf(stderr, "can't open %s\n", out_path);
+		fclose(in);
+		return 1;
+	}
+
+	const size_t frame_size = width * height * 3 / 2;
+	std::vector<unsigned char> src(frame_size), frame(frame_size);
+	long frames = 0;
+	uint64_t total_ns = 0, worst_ns = 0;
+	while (fread(&src[0], 1, frame_size, in) == frame_size) {
+		for (long r = 0; r < repeat; r++) {
+			memcpy(&frame[0], &src[0], frame_size);
+			pipeline.run(
+					nv12_frame(&frame[0], &frame[width * height], width,
+							height, width));
+			total_ns += pipeline.last_frame_ns();
+			if (pipeline.last_frame_ns() > worst_ns)
+				worst_ns = pipeline.last_frame_ns();
+			frames++;
+		}
+		if (out != NULL)
+			fwrite(&frame[0], 1, frame_size, out);
+	}
+	fclose(in);
+	if (out != NULL)
+		fclose(out);
+
+	if (frames == 0) {
+		fprintf(stderr, "%s holds no complete %ldx%ld frame\n", in_path,
+				width, height);
+		return 1;
+	}
+
+	printf("%ld frames of %ldx%ld, chain \"%s\"\n", frames, width, height,
+			chain);
+	printf("frame: %.1f us average, %.1f us worst, %.2f GB/s\n",
+			total_ns / 1e3 / frames, worst_ns / 1e3,
+			(double) frame_size * frames / total_ns);
+	static const char *states[] = { "full", "reduced", "dropped" };
+	for (size_t i = 0; i < pipeline.num_stages(); i++) {
+		const filter_stage& s = pipeline.stage(i);
+		printf("  %-10s %9.1f us/frame over %llu frames, now %s\n", s.name(),
+				s.frames ? s.total_ns / 1e3 / s.frames : 0.0,
+				(unsigned long long) s.frames, states[s.state]);
+	}
+	return 0;
+}
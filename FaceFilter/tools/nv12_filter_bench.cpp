@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Runs every point filter of yuv_filter.h over synthetic 720p and 1080p
+ * planes, next to the byte-at-a-time functions data.cpp used before them,
+ * and reports the throughput of both in GB/s.  The results of the two are
+ * compared first, on odd sizes and unaligned starts too.  Build it from the
+ * FaceFilter directory with something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/nv12_filter_bench.cpp src/yuv_filter.cpp
+ *
+ * adding the -m or -mfpu flags of the target, since the kernels are picked
+ * at compile time.
+ */
+
+#include "yuv_filter.h"
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+/*
+ * The filters of data.cpp before yuv_filter.h, as they were.
+ */
+
+static void _old_sepia(unsigned char *data, uint64_t size) {
+	for (uint64_t i = 0; i < size; i++) {
+		if (i % 2 == 0)
+			data[i] = 114;
+		else
+			data[i] = 144;
+	}
+}
+
+static void _old_grayscale(unsigned char *data, uint64_t size) {
+	for (uint64_t i = 0; i < size; i++)
+		data[i] = 128;
+}
+
+static void _old_invert(unsigned char *data, uint64_t size) {
+	for (uint_fast64_t i = 0; i < size; i++)
+		data[i] = 255 - data[i];
+}
+
+static void _old_nored(unsigned char *data, uint64_t size) {
+	for (uint_fast64_t i = 0; i < size; i++)
+		if (i % 2 == 1)
+			data[i] = 128;
+}
+
+static void _old_noblue(unsigned char *data, uint64_t size) {
+	for (uint_fast64_t i = 0; i < size; i++)
+		if (i % 2 == 0)
+			data[i] = 128;
+}
+
+static void _old_pinky(unsigned char *data, uint64_t size) {
+	for (uint_fast64_t i = 0; i < size; i++)
+		if (data[i] < 128)
+			data[i] *= 1.2;
+}
+
+static void _old_pinky_uv(unsigned char *data, uint64_t size) {
+	for (uint_fast64_t i = 0; i < size; i++)
+		if (data[i] % 2 == 0)
+			data[i] *= 1.2;
+}
+
+/*
+ * The same filters through yuv_filter.h, the way data.cpp calls them.
+ */
+
+static void _sepia(unsigned char *data, size_t size) {
+	yuv_filter_chroma(data, size, 0, 0, 114, 144);
+}
+
+static void _grayscale(unsigned char *data, size_t size) {
+	yuv_filter_chroma(data, size, 0, 0, 128, 128);
+}
+
+static void _nored(unsigned char *data, size_t size) {
+	yuv_filter_chroma(data, size, 0xff, 0, 0, 128);
+}
+
+static void _noblue(unsigned char *data, size_t size) {
+	yuv_filter_chroma(data, size, 0, 0xff, 128, 0);
+}
+
+struct filter {
+	const char *name;
+	bool uv; /* runs on the UV plane, else on Y */
+	void (*old_fn)(unsigned char *, uint64_t);
+	void (*new_fn)(unsigned char *, size_t);
+};
+
+static const filter filters[] = {
+	{ "sepia", true, _old_sepia, _sepia },
+	{ "grayscale", true, _old_grayscale, _grayscale },
+	{ "invert", false, _old_invert, yuv_filter_invert },
+	{ "nored", true, _old_nored, _nored },
+	{ "noblue", true, _old_noblue, _noblue },
+	{ "pinky", false, _old_pinky, yuv_filter_boost_dark },
+	{ "pinky_uv", true, _old_pinky_uv, yuv_filter_boost_even }
+};
+static const size_t num_filters = sizeof(filters) / sizeof(filters[0]);
+
+static inline uint64_t _now_ns() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*
+ * Random bytes, leaving out the even values of 214 and up for pinky_uv: the
+ * old code wrapped them around, the new one clamps them to 255.
+ */
+static void _fill(std::vector<unsigned char>& data, const filter& f) {
+	for (size_t i = 0; i < data.size(); i++) {
+		data[i] = rand() & 0xff;
+		if (f.old_fn == _old_pinky_uv && data[i] % 2 == 0 && data[i] >= 214)
+			data[i] = 100;
+	}
+}
+
+static bool _check(const filter& f) {
+	static const size_t sizes[] = { 0, 1, 15, 16, 17, 33, 1001, 4099 };
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+		for (size_t offset = 0; offset < 3; offset++) {
+			std::vector<unsigned char> a(sizes[s] + offset);
+			_fill(a, f);
+			std::vector<unsigned char> b(a);
+			f.old_fn(&a[0] + offset, sizes[s]);
+			f.new_fn(&b[0] + offset, sizes[s]);
+			if (a != b) {
+				fprintf(stderr, "%s differs from the old code on %lu bytes at"
+						" offset %lu\n", f.name, (unsigned long) sizes[s],
+						(unsigned long) offset);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static void _usage(const char *argv0) {
+	fprintf(stderr, "usage: %s [options]\n"
+			"options:\n"
+			"  --size WxH      frame size (default: 1280x720 and 1920x1080)\n"
+			"  --repeat N      runs of every filter (default: 200)\n", argv0);
+}
+
+int main(int argc, char **argv) {
+	std::vector<long> widths, heights;
+	long repeat = 200;
+	for (int i = 1; i < argc; i++) {
+		long w, h;
+		if (!strcmp(argv[i], "--size") && i + 1 < argc
+				&& sscanf(argv[++i], "%ldx%ld", &w, &h) == 2) {
+			widths.push_back(w);
+			heights.push_back(h);
+		} else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+			repeat = atol(argv[++i]);
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (widths.empty()) {
+		widths.push_back(1280);
+		heights.push_back(720);
+		widths.push_back(1920);
+		heights.push_back(1080);
+	}
+	if (repeat <= 0) {
+		fprintf(stderr, "bad repeat count\n");
+		return 1;
+	}
+
+	for (size_t i = 0; i < num_filters; i++)
+		if (!_check(filters[i]))
+			return 1;
+	printf("all filters match the old code\n");
+
+	for (size_t s = 0; s < widths.size(); s++) {
+		printf("%ldx%ld\n", widths[s], heights[s]);
+		for (size_t i = 0; i < num_filters; i++) {
+			const filter& f = filters[i];
+			const size_t size = widths[s] * heights[s] / (f.uv ? 2 : 1);
+			std::vector<unsigned char> plane(size);
+			_fill(plane, f);
+
+			uint64_t start = _now_ns();
+			for (long r = 0; r < repeat; r++)
+				f.old_fn(&plane[0], size);
+			const uint64_t old_ns = _now_ns() - start;
+
+			start = _now_ns();
+			for (long r = 0; r < repeat; r++)
+				f.new_fn(&plane[0], size);
+			const uint64_t new_ns = _now_ns() - start;
+
+			printf("  %-10s %s  old %7.2f GB/s  new %7.2f GB/s  %6.1fx\n",
+					f.name, f.uv ? "UV" : "Y ", (double) size * repeat / old_ns,
+					(double) size * repeat / new_ns, (double) old_ns / new_ns);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Compares reading the preview luma through a preview_luma_image with the
+ * copy face_landmark() used to make: a fresh array2d<u_int64_t> per frame,
+ * filled a pixel at a time with a % and a / to turn it by 90 degrees.
+ * Synthetic NV12 frames are made in memory, so no device or camera dump is
+ * needed.  With a model, the landmarks of a few face boxes are found on both
+ * and must come out the same.  Build it from the FaceFilter directory with
+ * something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc -DPREVIEW_IMAGE_NO_CAMERA \
+ *       tools/preview_luma_bench.cpp -ldlib -lpthread
+ */
+
+#include "preview_image.h"
+#include <dlib/array2d.h>
+#include <dlib/image_processing.h>
+#include <dlib/rand.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <vector>
+
+static void _usage(const char *argv0) {
+	fprintf(stderr,
+			"usage: %s WIDTH HEIGHT [options]\n"
+					"options:\n"
+					"  --stride N      bytes between two rows of the frame (default:\n"
+					"                  WIDTH)\n"
+					"  --model FILE    also find landmarks with this shape predictor\n"
+					"  --faces N       face boxes per frame for the model (default: 2)\n"
+					"  --frames N      frames to run (default: 100)\n",
+			argv0);
+}
+
+static inline uint64_t _now_ns() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*
+ * The copy face_landmark() made before preview_luma_image, kept as it was
+ * for the comparison: it assumes rows of exactly width bytes.
+ */
+static void _old_copy(const unsigned char *y, int width, int height,
+		dlib::array2d<u_int64_t>& img) {
+	img.set_size(width, height);
+	for (int i = 0; i < width * height; i++)
+		img[i % width][height - i / width - 1] = y[i];
+}
+
+/*
+ * Sums every pixel of an image, so that reading it can be timed.
+ */
+template<typename image_type>
+static uint64_t _sum(const image_type& img) {
+	const dlib::const_image_view<image_type> view(img);
+	uint64_t sum = 0;
+	for (long r = 0; r < view.nr(); r++)
+		for (long c = 0; c < view.nc(); c++)
+			sum += view[r][c];
+	return sum;
+}
+
+int main(int argc, char **argv) {
+	if (argc < 3) {
+		_usage(argv[0]);
+		return 1;
+	}
+
+	const long width = atol(argv[1]);
+	const long height = atol(argv[2]);
+	long stride = width;
+	const char *model_path = NULL;
+	long num_faces = 2;
+	long frames = 100;
+
+	for (int i = 3; i < argc; i++) {
+		if (!strcmp(argv[i], "--stride") && i + 1 < argc)
+			stride = atol(argv[++i]);
+		else if (!strcmp(argv[i], "--model") && i + 1 < argc)
+			model_path = argv[++i];
+		else if (!strcmp(argv[i], "--faces") && i + 1 < argc)
+			num_faces = atol(argv[++i]);
+		else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+			frames = atol(argv[++i]);
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (width <= 0 || height <= 0 || height % 2 != 0 || stride < width
+			|| num_faces <= 0 || frames <= 0) {
+		fprintf(stderr, "bad frame size, stride or count\n");
+		return 1;
+	}
+
+	dlib::shape_predictor sp;
+	if (model_path != NULL) {
+		try {
+			dlib::deserialize(model_path) >> sp;
+		} catch (std::exception& e) {
+			fprintf(stderr, "can't load %s: %s\n", model_path, e.what());
+			return 1;
+		}
+	}
+
+	/* a smooth gradient with noise, in a buffer with padded rows */
+	std::vector<unsigned char> frame(stride * height * 3 / 2);
+	dlib::rand rnd;
+	for (long r = 0; r < height; r++)
+		for (long c = 0; c < width; c++)
+			frame[r * stride + c] = (unsigned char) ((r + c) / 4
+					+ rnd.get_random_8bit_number() % 32);
+	/* the old copy can't skip the padding, so it gets a packed plane */
+	std::vector<unsigned char> packed(width * height);
+	for (long r = 0; r < height; r++)
+		memcpy(&packed[r * width], &frame[r * stride], width);
+
+	/* face boxes spread over the view, which is height wide once turned */
+	std::vector<dlib::rectangle> faces;
+	const long side = std::min(width, height) / 3;
+	for (long i = 0; i < num_faces; i++) {
+		const long left = (height - side) * i / std::max(1L, num_faces - 1);
+		faces.push_back(
+				dlib::rectangle(left, (width - side) / 2, left + side - 1,
+						(width + side) / 2 - 1));
+	}
+
+	printf("%ldx%ld frames, stride %ld, %ld frames\n", width, height, stride,
+			frames);
+
+	/* the same pixels either way */
+	dlib::array2d<u_int64_t> copy;
+	_old_copy(&packed[0], width, height, copy);
+	const preview_luma_image view(&frame[0], width, height, stride,
+			PREVIEW_ROTATION_90);
+	const dlib::const_image_view<preview_luma_image> pixels(view);
+	for (long r = 0; r < copy.nr(); r++) {
+		for (long c = 0; c < copy.nc(); c++) {
+			if (pixels[r][c] != copy[r][c]) {
+				fprintf(stderr, "the view differs from the copy at (%ld, %ld)\n",
+						r, c);
+				return 1;
+			}
+		}
+	}
+
+	uint64_t copy_ns = 0, copy_read_ns = 0, view_read_ns = 0, check = 0;
+	for (long f = 0; f < frames; f++) {
+		uint64_t start = _now_ns();
+		_old_copy(&packed[0], width, height, copy);
+		copy_ns += _now_ns() - start;
+
+		start = _now_ns();
+		check += _sum(copy);
+		copy_read_ns += _now_ns() - start;
+
+		start = _now_ns();
+		check -= _sum(
+				preview_luma_image(&frame[0], width, height, stride,
+						PREVIEW_ROTATION_90));
+		view_read_ns += _now_ns() - start;
+	}
+	if (check != 0) {
+		fprintf(stderr, "the view and the copy don't sum the same\n");
+		return 1;
+	}
+	printf("copy into array2d<u_int64_t>  %9.1f us/frame, %6.2f MB\n",
+			copy_ns / 1e3 / frames, copy.size() * sizeof(u_int64_t) / 1e6);
+	printf("read the copy                 %9.1f us/frame\n",
+			copy_read_ns / 1e3 / frames);
+	printf("read the view (no copy)       %9.1f us/frame\n",
+			view_read_ns / 1e3 / frames);
+
+	if (model_path == NULL)
+		return 0;
+
+	dlib::shape_predictor_workspace ws;
+	std::vector<dlib::full_object_detection> from_copy, from_view;
+	uint64_t copy_sp_ns = 0, view_sp_ns = 0;
+	for (long f = 0; f < frames; f++) {
+		uint64_t start = _now_ns();
+		_old_copy(&packed[0], width, height, copy);
+		from_copy.clear();
+		for (size_t i = 0; i < faces.size(); i++)
+			from_copy.push_back(sp(copy, faces[i]));
+		copy_sp_ns += _now_ns() - start;
+
+		start = _now_ns();
+		sp(preview_luma_image(&frame[0], width, height, stride,
+				PREVIEW_ROTATION_90), faces, from_view, ws);
+		view_sp_ns += _now_ns() - start;
+	}
+	for (size_t i = 0; i < faces.size(); i++) {
+		for (unsigned long j = 0; j < sp.num_parts(); j++) {
+			if (from_copy[i].part(j) != from_view[i].part(j)) {
+				fprintf(stderr, "landmark %lu of face %lu differs\n", j,
+						(unsigned long) i);
+				return 1;
+			}
+		}
+	}
+	printf("copy + landmarks              %9.1f us/frame (%ld faces)\n",
+			copy_sp_ns / 1e3 / frames, num_faces);
+	printf("view + landmarks              %9.1f us/frame, same landmarks\n",
+			view_sp_ns / 1e3 / frames);
+	return 0;
+}
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Times the work the app gives dlib::thread_pool on a 640x480 frame, with
+ * the shared_queue_backend the pool has always had and with the
+ * work_stealing_backend:
+ *
+ * - a parallel_for_blocked() over the rows of the frame, and an empty
+ *   parallel_for() over 64 indices: what the scheduling itself costs;
+ * - the frontal face detector, which spreads the levels of its FHOG pyramid
+ *   over the pool;
+ * - the landmarks of a few faces, one task per face;
+ * - four detectors in a parallel_for(), each spreading its pyramid on the
+ *   same pool, which needs nested tasks.
+ *
+ * Both backends must give the same faces and landmarks.  The frame is
+ * synthetic, with the faces as boxes side by side on it.  Build it from the
+ * FaceFilter directory with something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/thread_pool_bench.cpp -ldlib -lpthread
+ *
+ * and run it on the target device class: on a single core it only shows
+ * what the scheduling costs, not how the work scales.
+ */
+
+#include <dlib/image_processing.h>
+#include <dlib/image_processing/frontal_face_detector.h>
+#include <dlib/threads.h>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static void _usage(const char *argv0) {
+	fprintf(stderr, "usage: %s MODEL.dat [options]\n"
+			"options:\n"
+			"  --threads N     threads in the pool (default: 4)\n"
+			"  --faces N       boxes on the frame, up to 5 (default: 5)\n"
+			"  --repeat N      runs of every workload, the best is kept\n"
+			"                  (default: 20)\n", argv0);
+}
+
+static inline uint64_t _now_ns() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*
+ * The best time of fn, in us, after a first run to size its buffers.
+ */
+template<typename fn_type>
+static double _best_us(long repeat, fn_type fn) {
+	fn();
+	uint64_t best = ~0ULL;
+	for (long r = 0; r < repeat; r++) {
+		const uint64_t start = _now_ns();
+		fn();
+		best = std::min(best, _now_ns() - start);
+	}
+	return best / 1e3;
+}
+
+struct result {
+	double rows_us;
+	double empty_us;
+	double detector_us;
+	double landmarks_us;
+	double nested_us;
+	bool nested_same; /* the nested detectors found the faces the first did */
+	std::vector<dlib::rectangle> faces;
+	std::vector<dlib::full_object_detection> shapes;
+};
+
+static result _run(dlib::thread_pool_backend backend, unsigned long threads,
+		long repeat, const dlib::array2d<unsigned char>& img,
+		const dlib::frontal_face_detector& detector,
+		const dlib::shape_predictor& sp,
+		const std::vector<dlib::rectangle>& boxes) {
+	dlib::thread_pool tp(threads, backend);
+	result res;
+
+	std::vector<float> sums(img.nr());
+	res.rows_us = _best_us(repeat * 10, [&]() {
+		dlib::parallel_for_blocked(tp, 0, img.nr(), [&](long begin, long end) {
+			for (long r = begin; r < end; r++) {
+				float sum = 0;
+				for (long c = 0; c < img.nc(); c++)
+					sum += img[r][c];
+				sums[r] = sum;
+			}
+		});
+	});
+	res.empty_us = _best_us(repeat * 10, [&]() {
+		dlib::parallel_for(tp, 0, 64, [](long) {});
+	});
+
+	dlib::frontal_face_detector d(detector);
+	res.detector_us = _best_us(repeat, [&]() {
+		res.faces = d(img, tp);
+	});
+
+	dlib::shape_predictor_workspace ws;
+	res.landmarks_us = _best_us(repeat * 10, [&]() {
+		sp(img, boxes, res.shapes, ws, tp);
+	});
+
+	std::vector<dlib::frontal_face_detector> detectors(4, detector);
+	std::vector<std::vector<dlib::rectangle> > faces(4);
+	res.nested_us = _best_us(repeat / 4 + 1, [&]() {
+		dlib::parallel_for(tp, 0, 4, [&](long i) {
+			faces[i] = detectors[i](img, tp);
+		});
+	});
+	res.nested_same = true;
+	for (size_t i = 0; i < faces.size(); i++)
+		res.nested_same &= faces[i] == res.faces;
+	return res;
+}
+
+static bool _same_shapes(const std::vector<dlib::full_object_detection>& a,
+		const std::vector<dlib::full_object_detection>& b) {
+	if (a.size() != b.size())
+		return false;
+	for (size_t i = 0; i < a.size(); i++) {
+		if (a[i].num_parts() != b[i].num_parts())
+			return false;
+		for (unsigned long p = 0; p < a[i].num_parts(); p++)
+			if (a[i].part(p) != b[i].part(p))
+				return false;
+	}
+	return true;
+}
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		_usage(argv[0]);
+		return 1;
+	}
+	const char *model_path = argv[1];
+	long threads = 4;
+	long num_faces = 5;
+	long repeat = 20;
+	for (int i = 2; i < argc; i++) {
+		if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+			threads = atol(argv[++i]);
+		else if (!strcmp(argv[i], "--faces") && i + 1 < argc)
+			num_faces = atol(argv[++i]);
+		else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+			repeat = atol(argv[++i]);
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (threads < 0 || num_faces < 1 || num_faces > 5 || repeat <= 0) {
+		_usage(argv[0]);
+		return 1;
+	}
+
+	dlib::shape_predictor sp;
+	try {
+		dlib::deserialize(model_path) >> sp;
+	} catch (std::exception& e) {
+		fprintf(stderr, "can't load %s: %s\n", model_path, e.what());
+		return 1;
+	}
+
+	/* smooth waves with noise, and the faces side by side across the middle */
+	dlib::array2d<unsigned char> img(480, 640);
+	srand(5);
+	for (long r = 0; r < img.nr(); r++) {
+		for (long c = 0; c < img.nc(); c++) {
+			const int v = (int) (128 + 100 * sin(r * 0.05) * cos(c * 0.03))
+					+ rand() % 40;
+			img[r][c] = (unsigned char) (v < 0 ? 0 : (v > 255 ? 255 : v));
+		}
+	}
+	std::vector<dlib::rectangle> boxes;
+	for (long i = 0; i < num_faces; i++)
+		boxes.push_back(dlib::centered_rect(dlib::point(100 + 110 * i, 240), 100,
+				100));
+
+	const dlib::frontal_face_detector detector =
+			dlib::get_frontal_face_detector();
+	printf("640x480, %ld threads, %ld faces, best of %ld\n", threads, num_faces,
+			repeat);
+	printf("%-14s %9s %9s %9s %9s %9s\n", "", "rows", "empty", "detector",
+			"landmarks", "nested");
+	const dlib::thread_pool_backend backends[] = {
+		dlib::shared_queue_backend, dlib::work_stealing_backend
+	};
+	const char *names[] = { "shared queue", "work stealing" };
+	std::vector<result> results;
+	for (int b = 0; b < 2; b++) {
+		results.push_back(_run(backends[b], threads, repeat, img, detector, sp,
+				boxes));
+		const result& r = results.back();
+		printf("%-14s %6.1f us %6.1f us %6.0f us %6.0f us %6.0f us\n", names[b],
+				r.rows_us, r.empty_us, r.detector_us, r.landmarks_us,
+				r.nested_us);
+	}
+
+	if (!results[0].nested_same || !results[1].nested_same) {
+		fprintf(stderr, "the nested detectors give different faces\n");
+		return 1;
+	}
+	if (results[0].faces != results[1].faces
+			|| !_same_shapes(results[0].shapes, results[1].shapes)) {
+		fprintf(stderr, "the backends give different faces or landmarks\n");
+		return 1;
+	}
+	printf("both backends give the same faces and landmarks\n");
+	return 0;
+}
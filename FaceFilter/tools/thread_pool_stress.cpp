@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Stress test of dlib::thread_pool, run on pools of 0, 1, 2, 4 and 8 threads
+ * with each backend:
+ *
+ * - parallel_for() sums;
+ * - three levels of parallel_for() nested on the same pool;
+ * - futures;
+ * - more tasks from outside the pool than the work_stealing_backend has
+ *   task records;
+ * - wait_for_task() on each of a few hundred tasks;
+ * - an exception thrown by a task, caught by wait_for_all_tasks();
+ * - two threads submitting parallel_for()s at once.
+ *
+ * It exits with 1 at the first wrong result; a deadlock hangs it.  Build it
+ * from the FaceFilter directory with something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/thread_pool_stress.cpp -ldlib -lpthread
+ *
+ * and run it a few times on the target, and under ThreadSanitizer
+ * (-fsanitize=thread, with dlib built the same way) on a desktop.
+ */
+
+#include <dlib/threads.h>
+#include <atomic>
+#include <stdexcept>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+static void _usage(const char *argv0) {
+	fprintf(stderr, "usage: %s [options]\n"
+			"options:\n"
+			"  --backend NAME  shared_queue or work_stealing (default: both)\n"
+			"  --rounds N      runs of the whole test (default: 1)\n", argv0);
+}
+
+static bool _fail(const char *what, unsigned long threads, long got,
+		long expected) {
+	fprintf(stderr, "%s, %lu threads: %ld instead of %ld\n", what, threads, got,
+			expected);
+	return false;
+}
+
+static bool _stress(dlib::thread_pool_backend backend, unsigned long threads) {
+	dlib::thread_pool tp(threads, backend);
+
+	for (int r = 0; r < 200; r++) {
+		std::vector<int> v(10000, 0);
+		dlib::parallel_for(tp, 0, (long) v.size(), [&](long i) {
+			v[i] += 1;
+		});
+		long sum = 0;
+		for (size_t i = 0; i < v.size(); i++)
+			sum += v[i];
+		if (sum != 10000)
+			return _fail("parallel_for sum", threads, sum, 10000);
+	}
+
+	std::atomic<long> nested(0);
+	for (int r = 0; r < 50; r++) {
+		dlib::parallel_for(tp, 0, 64, [&](long) {
+			dlib::parallel_for(tp, 0, 64, [&](long) {
+				dlib::parallel_for(tp, 0, 4, [&](long) {
+					nested++;
+				});
+			});
+		});
+	}
+	if (nested != 50 * 64 * 64 * 4)
+		return _fail("nested parallel_for", threads, nested, 50 * 64 * 64 * 4);
+
+	dlib::future<int> a, b;
+	const auto set_seven = [](int& x) {
+		x = 7;
+	};
+	for (int r = 0; r < 1000; r++) {
+		a = 0;
+		b = 0;
+		tp.add_task_by_value(set_seven, a);
+		tp.add_task_by_value(set_seven, b);
+		if (a.get() + b.get() != 14)
+			return _fail("futures", threads, a.get() + b.get(), 14);
+	}
+
+	std::atomic<long> many(0);
+	for (int i = 0; i < 5000; i++)
+		tp.add_task_by_value([&]() {
+			many++;
+		});
+	tp.wait_for_all_tasks();
+	if (many != 5000)
+		return _fail("tasks from outside", threads, many, 5000);
+
+	std::vector<dlib::uint64> ids;
+	std::atomic<long> waited(0);
+	for (int i = 0; i < 300; i++)
+		ids.push_back(tp.add_task_by_value([&]() {
+			waited++;
+		}));
+	for (size_t i = 0; i < ids.size(); i++)
+		tp.wait_for_task(ids[i]);
+	if (waited != 300)
+		return _fail("wait_for_task", threads, waited, 300);
+
+	bool caught = false;
+	try {
+		tp.add_task_by_value([]() {
+			throw std::runtime_error("thrown by a task");
+		});
+		tp.wait_for_all_tasks();
+	} catch (std::runtime_error&) {
+		caught = true;
+	}
+	if (!caught)
+		return _fail("exceptions caught", threads, 0, 1);
+
+	std::atomic<long> both(0);
+	std::thread other([&]() {
+		for (int r = 0; r < 100; r++)
+			dlib::parallel_for(tp, 0, 100, [&](long) {
+				both++;
+			});
+	});
+	for (int r = 0; r < 100; r++)
+		dlib::parallel_for(tp, 0, 100, [&](long) {
+			both++;
+		});
+	other.join();
+	if (both != 20000)
+		return _fail("two submitting threads", threads, both, 20000);
+	return true;
+}
+
+int main(int argc, char **argv) {
+	std::vector<dlib::thread_pool_backend> backends;
+	long rounds = 1;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--backend") && i + 1 < argc) {
+			const char *name = argv[++i];
+			if (!strcmp(name, "shared_queue"))
+				backends.push_back(dlib::shared_queue_backend);
+			else if (!strcmp(name, "work_stealing"))
+				backends.push_back(dlib::work_stealing_backend);
+			else {
+				_usage(argv[0]);
+				return 1;
+			}
+		} else if (!strcmp(argv[i], "--rounds") && i + 1 < argc)
+			rounds = atol(argv[++i]);
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (backends.empty()) {
+		backends.push_back(dlib::shared_queue_backend);
+		backends.push_back(dlib::work_stealing_backend);
+	}
+	if (rounds <= 0) {
+		fprintf(stderr, "bad round count\n");
+		return 1;
+	}
+
+	static const unsigned long thread_counts[] = { 0, 1, 2, 4, 8 };
+	for (long r = 0; r < rounds; r++) {
+		for (size_t b = 0; b < backends.size(); b++) {
+			for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]);
+					t++) {
+				if (!_stress(backends[b], thread_counts[t]))
+					return 1;
+			}
+		}
+	}
+	printf("%ld rounds passed\n", rounds);
+	return 0;
+}
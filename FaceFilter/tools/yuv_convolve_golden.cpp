@@ -0,0 +1,580 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd
+ *
+ * Licensed under the Flora License, Version 1.1 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://floralicense.org/license/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Golden-image check of yuv_convolver.  It runs in two parts:
+ *
+ * - the output must be byte-identical to a plain per-pixel reference of what
+ *   yuv_convolve.h documents, for sizes from 1x1 up, padded strides, and
+ *   steps of 1 and 2;
+ * - on a synthetic frame, the output is compared with the one of the
+ *   flat-array functions data.cpp used before yuv_convolver, within the
+ *   tolerances below.
+ *
+ * It exits with 1 if either part fails, then reports the time both take on
+ * 720p and 1080p Y planes.  Build it from the FaceFilter directory with
+ * something like
+ *
+ *   g++ -std=c++11 -O2 -Iinc tools/yuv_convolve_golden.cpp \
+ *       src/yuv_convolve.cpp -ldlib -lpthread
+ *
+ * adding the -m or -mfpu flags of the target, since the kernels are picked
+ * at compile time.
+ */
+
+#include "yuv_convolve.h"
+#include <chrono>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+/*
+ * How far the new output may be from the old one, inside the one-pixel
+ * border (the old code wrapped rows into each other there):
+ *
+ * - Gaussian, Y: the old loop summed 8 of its 9 taps, dropping the
+ *   bottom-right one (.0113), and truncated instead of rounding.  That is
+ *   at most 255 * .0113 + 1 levels.
+ * - Gaussian, UV: the old pass was a horizontal-only blur over the taps at
+ *   -8..+6 bytes, with the 3x3 weights, and the new one is the 2D blur of
+ *   the Y plane with a step of 2.  The two only agree on flat areas, so the
+ *   tolerance is loose and the mean difference is reported too.
+ * - Emboss, Y and UV: identical wherever the old result was within 0..255.
+ *   Outside of it, the old float -> unsigned char conversion was undefined
+ *   and the new code saturates.
+ */
+#define GAUSSIAN_Y_TOLERANCE 4
+#define GAUSSIAN_UV_TOLERANCE 16
+#define GAUSSIAN_UV_MEAN_TOLERANCE 3.0
+
+/*
+ * The filters of data.cpp before yuv_convolver, as they were, except that
+ * they free their buffer and _old_gaussian_uv() no longer reads the unused
+ * width.  They read up to width + 2 bytes past the end of the plane, so the
+ * planes given to them are padded with zeros.
+ */
+
+static struct {
+	int width;
+} cam_data;
+
+static void _old_emboss(unsigned char* data, uint64_t size) {
+	uint64_t x = 0;
+	uint64_t w = (uint64_t) cam_data.width;
+	float mask[9] = { -2.0f, -1.0f, 0.0f, -1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 2.0f };
+
+	unsigned char* ndata;
+	ndata = (unsigned char*) malloc(sizeof(unsigned char) * size);
+
+	for (x = 0; x < size; x++) {
+		float val[9] = { 0, };
+		if (x < w + 1)
+			val[0] = 0;
+		else
+			val[0] = data[x - w - 1] * mask[8];
+
+		if (x < w)
+			val[1] = 0;
+		else
+			val[1] = data[x - w] * mask[7];
+
+		if (x < w - 1)
+			val[2] = 0;
+		else
+			val[2] = data[x - w + 1] * mask[6];
+
+		if (x < 1)
+			val[3] = 0;
+		else
+			val[3] = data[x - 1] * mask[5];
+
+		val[4] = data[x] * mask[4];
+
+		if (x + 1 > size)
+			val[5] = 0;
+		else
+			val[5] = data[x + 1] * mask[3];
+
+		if (x + w - 1 > size)
+			val[6] = 0;
+		else
+			val[6] = data[x + w - 1] * mask[2];
+
+		if (x + w > size)
+			val[7] = 0;
+		else
+			val[7] = data[x + w] * mask[1];
+
+		if (x + w + 1 > size)
+			val[8] = 0;
+		else
+			val[8] = data[x + w + 1] * mask[0];
+
+		float sum = 0;
+		for (int i = 0; i < 9; i++)
+			sum += val[i];
+
+		ndata[x] = (unsigned char) sum;
+		//ndata[x] =(unsigned char) (sum/8);
+	}
+	memcpy(data, ndata, sizeof(unsigned char) * size);
+	free(ndata);
+}
+static void _old_emboss_uv(unsigned char* data, uint64_t size) {
+	uint64_t x = 0;
+	uint64_t w = (uint64_t) cam_data.width;
+	float mask[9] = { -2.0f, -1.0f, 0.0f, -1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 2.0f };
+
+	unsigned char* ndata;
+	ndata = (unsigned char*) malloc(sizeof(unsigned char) * size);
+
+	for (x = 0; x < size; x++) {
+		float val[9] = { 0, };
+		if (x < w + 2)
+			val[0] = 0;
+		else
+			val[0] = data[x - w - 2] * mask[8];
+
+		if (x < w)
+			val[1] = 0;
+		else
+			val[1] = data[x - w] * mask[7];
+
+		if (x < w - 2)
+			val[2] = 0;
+		else
+			val[2] = data[x - w + 2] * mask[6];
+
+		if (x < 2)
+			val[3] = 0;
+		else
+			val[3] = data[x - 2] * mask[5];
+
+		val[4] = data[x] * mask[4];
+
+		if (x + 2 > size)
+			val[5] = 0;
+		else
+			val[5] = data[x + 2] * mask[3];
+
+		if (x + w - 2 > size)
+			val[6] = 0;
+		else
+			val[6] = data[x + w - 2] * mask[2];
+
+		if (x + w > size)
+			val[7] = 0;
+		else
+			val[7] = data[x + w] * mask[1];
+
+		if (x + w + 2 > size)
+			val[8] = 0;
+		else
+			val[8] = data[x + w + 2] * mask[0];
+
+		float sum = 0;
+		for (int i = 0; i < 9; i++)
+			sum += val[i];
+
+		ndata[x] = (unsigned char) sum;
+		//ndata[x] =(unsigned char) (sum/8);
+	}
+	memcpy(data, ndata, sizeof(unsigned char) * size);
+	free(ndata);
+}
+
+static void _old_gaussian(unsigned char* data, uint64_t size) {
+	uint64_t x = 0;
+	uint64_t w = (uint64_t) cam_data.width;
+//	float xmask[5] = {.0003, .1065, .7866, .1065, .0003};
+	float mask[9] = { .0113, .0838, .0113, .0838, .6193, .0838, .0113, .0838,
+			.0113 };
+
+	unsigned char* ndata;
+	ndata = (unsigned char*) malloc(sizeof(unsigned char) * size);
+
+	for (x = 0; x < size; x++) {
+		float val[9] = { 0, };
+		if (x < w + 1)
+			val[0] = 0;
+		else
+			val[0] = data[x - w - 1] * mask[8];
+
+		if (x < w)
+			val[1] = 0;
+		else
+			val[1] = data[x - w] * mask[7];
+
+		if (x < w - 1)
+			val[2] = 0;
+		else
+			val[2] = data[x - w + 1] * mask[6];
+
+		if (x < 1)
+			val[3] = 0;
+		else
+			val[3] = data[x - 1] * mask[5];
+
+		val[4] = data[x] * mask[4];
+
+		if (x + 1 > size)
+			val[5] = 0;
+		else
+			val[5] = data[x + 1] * mask[3];
+
+		if (x + w - 1 > size)
+			val[6] = 0;
+		else
+			val[6] = data[x + w - 1] * mask[2];
+
+		if (x + w > size)
+			val[7] = 0;
+		else
+			val[7] = data[x + w] * mask[1];
+
+		if (x + w + 1 > size)
+			val[8] = 0;
+		else
+			val[8] = data[x + w + 1] * mask[0];
+
+		float sum = 0;
+		for (int i = 0; i < 8; i++)
+			sum += val[i];
+
+		ndata[x] = (unsigned char) sum;
+		//ndata[x] =(unsigned char) (sum/8);
+	}
+	memcpy(data, ndata, sizeof(unsigned char) * size);
+	free(ndata);
+}
+
+static void _old_gaussian_uv(unsigned char* data, uint64_t size) {
+	uint64_t x = 0;
+	float mask[9] = { .0113, .0838, .0113, .0838, .6193, .0838, .0113, .0838,
+			.0113 };
+
+	unsigned char* ndata = (unsigned char*) malloc(
+			sizeof(unsigned char) * size);
+
+	for (x = 0; x < size; x++) {
+		float val[9] = { 0, };
+		if (x < 8)
+			val[0] = 0;
+		else
+			val[0] = data[x - 8] * mask[8];
+
+		if (x < 6)
+			val[1] = 0;
+		else
+			val[1] = data[x - 6] * mask[7];
+
+		if (x < 4)
+			val[2] = 0;
+		else
+			val[2] = data[x - 4] * mask[6];
+
+		if (x < 2)
+			val[3] = 0;
+		else
+			val[3] = data[x - 2] * mask[5];
+
+		val[4] = data[x] * mask[4];
+
+		if (x + 2 > size)
+			val[5] = 0;
+		else
+			val[5] = data[x + 2] * mask[3];
+
+		if (x + 4 > size)
+			val[6] = 0;
+		else
+			val[6] = data[x + 4] * mask[2];
+
+		if (x + 6 > size)
+			val[7] = 0;
+		else
+			val[7] = data[x + 6] * mask[1];
+
+		if (x + 8 > size)
+			val[8] = 0;
+		else
+			val[8] = data[x + 8] * mask[0];
+
+		float sum = 0;
+		for (int i = 0; i < 8; i++)
+			sum += val[i];
+
+		ndata[x] = (unsigned char) sum;
+	}
+
+	memcpy(data, ndata, sizeof(unsigned char) * size);
+	free(ndata);
+}
+
+
+/*
+ * The plain reference: what yuv_convolve.h documents, a pixel at a time,
+ * with the pixels outside the plane as 0.
+ */
+
+static int _at(const std::vector<unsigned char>& p, long w, long h, long x,
+		long y) {
+	return (x < 0 || y < 0 || x >= w || y >= h) ? 0 : p[y * w + x];
+}
+
+static void _ref_gaussian(std::vector<unsigned char>& p, long w, long h,
+		int step) {
+	std::vector<unsigned char> t(p.size());
+	for (long y = 0; y < h; y++)
+		for (long x = 0; x < w; x++)
+			t[y * w + x] = (27 * (_at(p, w, h, x - step, y)
+					+ _at(p, w, h, x + step, y)) + 202 * _at(p, w, h, x, y) + 128)
+					>> 8;
+	for (long y = 0; y < h; y++)
+		for (long x = 0; x < w; x++)
+			p[y * w + x] = (27 * (_at(t, w, h, x, y - 1) + _at(t, w, h, x, y + 1))
+					+ 202 * _at(t, w, h, x, y) + 128) >> 8;
+}
+
+static int _emboss_at(const std::vector<unsigned char>& p, long w, long h,
+		long x, long y, int step) {
+	return 2 * _at(p, w, h, x - step, y - 1) + _at(p, w, h, x, y - 1)
+			+ _at(p, w, h, x - step, y) + _at(p, w, h, x, y)
+			- _at(p, w, h, x + step, y) - _at(p, w, h, x, y + 1)
+			- 2 * _at(p, w, h, x + step, y + 1);
+}
+
+static void _ref_emboss(std::vector<unsigned char>& p, long w, long h,
+		int step) {
+	const std::vector<unsigned char> in(p);
+	for (long y = 0; y < h; y++) {
+		for (long x = 0; x < w; x++) {
+			const int v = _emboss_at(in, w, h, x, y, step);
+			p[y * w + x] = (unsigned char) (v < 0 ? 0 : (v > 255 ? 255 : v));
+		}
+	}
+}
+
+static inline uint64_t _now_ns() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void _fill_random(std::vector<unsigned char>& p) {
+	for (size_t i = 0; i < p.size(); i++)
+		p[i] = rand() & 0xff;
+}
+
+static bool _check_reference(yuv_convolver& conv) {
+	static const long widths[] = { 1, 2, 3, 4, 5, 16, 17, 33, 100 };
+	static const long heights[] = { 1, 2, 3, 9 };
+	static const long pads[] = { 0, 11 };
+	for (size_t wi = 0; wi < sizeof(widths) / sizeof(widths[0]); wi++)
+	for (size_t hi = 0; hi < sizeof(heights) / sizeof(heights[0]); hi++)
+	for (size_t pi = 0; pi < sizeof(pads) / sizeof(pads[0]); pi++)
+	for (int step = 1; step <= 2; step++)
+	for (int emboss = 0; emboss < 2; emboss++) {
+		const long w = widths[wi], h = heights[hi], stride = w + pads[pi];
+		std::vector<unsigned char> plane(stride * h), ref(w * h);
+		_fill_random(plane);
+		for (long y = 0; y < h; y++)
+			memcpy(&ref[y * w], &plane[y * stride], w);
+		const std::vector<unsigned char> before(plane);
+
+		if (emboss) {
+			conv.emboss(&plane[0], w, h, stride, step);
+			_ref_emboss(ref, w, h, step);
+		} else {
+			conv.gaussian(&plane[0], w, h, stride, step);
+			_ref_gaussian(ref, w, h, step);
+		}
+		for (long y = 0; y < h; y++) {
+			if (memcmp(&plane[y * stride], &ref[y * w], w) != 0
+					|| memcmp(&plane[y * stride + w], &before[y * stride + w],
+							stride - w) != 0) {
+				fprintf(stderr, "%s differs from the reference on %ldx%ld,"
+						" stride %ld, step %d, row %ld\n",
+						emboss ? "emboss" : "gaussian", w, h, stride, step, y);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/*
+ * A frame that looks more like a picture than noise: smooth waves, a few
+ * sharp edges, and a little grain.  Zero-padded for the old functions.
+ */
+static std::vector<unsigned char> _frame(long w, long h) {
+	std::vector<unsigned char> p(w * h + w + 2, 0);
+	for (long y = 0; y < h; y++) {
+		for (long x = 0; x < w; x++) {
+			int v = 128 + (int) (60 * sin(x * 0.05) * cos(y * 0.07))
+					+ rand() % 16;
+			if ((x / 64 + y / 48) % 5 == 0)
+				v -= 40;
+			p[y * w + x] = (unsigned char) (v < 0 ? 0 : (v > 255 ? 255 : v));
+		}
+	}
+	return p;
+}
+
+struct diff {
+	int max;
+	double mean;
+};
+
+static diff _interior_diff(const std::vector<unsigned char>& a,
+		const std::vector<unsigned char>& b, long w, long h, int step) {
+	diff d = { 0, 0 };
+	long n = 0;
+	for (long y = 1; y < h - 1; y++) {
+		for (long x = step; x < w - step; x++) {
+			const int v = abs(a[y * w + x] - b[y * w + x]);
+			d.max = std::max(d.max, v);
+			d.mean += v;
+			n++;
+		}
+	}
+	d.mean /= std::max(n, 1L);
+	return d;
+}
+
+static bool _check_gaussian(yuv_convolver& conv, long w, long h, int step) {
+	const std::vector<unsigned char> in = _frame(w, h);
+	std::vector<unsigned char> old_out(in), new_out(in);
+	cam_data.width = (int) w;
+	if (step == 1)
+		_old_gaussian(&old_out[0], w * h);
+	else
+		_old_gaussian_uv(&old_out[0], w * h);
+	conv.gaussian(&new_out[0], w, h, w, step);
+
+	const diff d = _interior_diff(old_out, new_out, w, h, step);
+	const bool ok = step == 1 ?
+			d.max <= GAUSSIAN_Y_TOLERANCE :
+			d.max <= GAUSSIAN_UV_TOLERANCE
+					&& d.mean <= GAUSSIAN_UV_MEAN_TOLERANCE;
+	printf("gaussian %s: max %d, mean %.2f levels from the old output%s\n",
+			step == 1 ? "Y " : "UV", d.max, d.mean, ok ? "" : "  FAILED");
+	return ok;
+}
+
+static bool _check_emboss(yuv_convolver& conv, long w, long h, int step) {
+	const std::vector<unsigned char> in = _frame(w, h);
+	std::vector<unsigned char> old_out(in), new_out(in);
+	cam_data.width = (int) w;
+	if (step == 1)
+		_old_emboss(&old_out[0], w * h);
+	else
+		_old_emboss_uv(&old_out[0], w * h);
+	conv.emboss(&new_out[0], w, h, w, step);
+
+	long same = 0, n = 0;
+	for (long y = 1; y < h - 1; y++) {
+		for (long x = step; x < w - step; x++) {
+			const int v = _emboss_at(in, w, h, x, y, step);
+			if (v < 0 || v > 255)
+				continue;
+			n++;
+			same += old_out[y * w + x] == new_out[y * w + x];
+		}
+	}
+	const bool ok = same == n;
+	printf("emboss   %s: %ld of %ld defined pixels identical to the old"
+			" output%s\n", step == 1 ? "Y " : "UV", same, n, ok ? "" : "  FAILED");
+	return ok;
+}
+
+static void _usage(const char *argv0) {
+	fprintf(stderr, "usage: %s [options]\n"
+			"options:\n"
+			"  --threads N     threads in the pool (default: 3)\n"
+			"  --repeat N      runs of every filter for the timing; 0 skips it\n"
+			"                  (default: 10)\n", argv0);
+}
+
+int main(int argc, char **argv) {
+	long threads = 3;
+	long repeat = 10;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+			threads = atol(argv[++i]);
+		else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+			repeat = atol(argv[++i]);
+		else {
+			_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (threads < 0 || repeat < 0) {
+		fprintf(stderr, "bad thread or repeat count\n");
+		return 1;
+	}
+
+	dlib::thread_pool tp(threads);
+	yuv_convolver conv(tp);
+	srand(1);
+
+	if (!_check_reference(conv))
+		return 1;
+	printf("identical to the reference on every size, stride and step\n");
+
+	/* a 640x480 frame: its Y plane, and its UV plane of 240 rows */
+	bool ok = true;
+	ok &= _check_gaussian(conv, 640, 480, 1);
+	ok &= _check_gaussian(conv, 640, 240, 2);
+	ok &= _check_emboss(conv, 640, 480, 1);
+	ok &= _check_emboss(conv, 640, 240, 2);
+	if (!ok)
+		return 1;
+
+	if (repeat == 0)
+		return 0;
+	static const long sizes[][2] = { { 1280, 720 }, { 1920, 1080 } };
+	for (int s = 0; s < 2; s++) {
+		const long w = sizes[s][0], h = sizes[s][1];
+		std::vector<unsigned char> plane = _frame(w, h);
+		cam_data.width = (int) w;
+
+		uint64_t start = _now_ns();
+		for (long r = 0; r < repeat; r++)
+			_old_gaussian(&plane[0], w * h);
+		const uint64_t old_gauss_ns = _now_ns() - start;
+		start = _now_ns();
+		for (long r = 0; r < repeat; r++)
+			conv.gaussian(&plane[0], w, h, w, 1);
+		const uint64_t gauss_ns = _now_ns() - start;
+		start = _now_ns();
+		for (long r = 0; r < repeat; r++)
+			_old_emboss(&plane[0], w * h);
+		const uint64_t old_emboss_ns = _now_ns() - start;
+		start = _now_ns();
+		for (long r = 0; r < repeat; r++)
+			conv.emboss(&plane[0], w, h, w, 1);
+		const uint64_t emboss_ns = _now_ns() - start;
+
+		const double per_run = 1e6 * repeat;
+		printf("%ldx%ld Y  gaussian old %6.2f ms new %6.2f ms | emboss old"
+				" %6.2f ms new %6.2f ms\n", w, h, old_gauss_ns / per_run,
+				gauss_ns / per_run, old_emboss_ns / per_run, emboss_ns / per_run);
+	}
+	return 0;
+}